@@ -118,7 +118,10 @@ let val_translate t s =
     | "GLbyte"      -> p "Val_int(%s)" s
     | "void*"   -> p "(value)(%s)" s
     | "GLvoid*"   -> p "(value)(%s)" s
-    | "GLstring"  -> p "caml_copy_string(%s)" s
+    | "GLstring"  -> p "copy_gl_string(%s)" s
+    | "GLint64"     -> p "Val_long(%s)" s
+    | "GLuint64"    -> p "Val_long(%s)" s
+    | "GLsync"      -> p "alloc_sync(%s)" s
     | _             -> "unknown"
 
 (* Extract the C value from an ML FFI value *)
@@ -144,6 +147,9 @@ let translate_val t =
   | "GLushort"    -> "Int_val"
   | "GLbyte"      -> "Int_val"
   | "GLstring"    -> "String_val"
+  | "GLint64"     -> "Long_val"
+  | "GLuint64"    -> "Long_val"
+  | "GLsync"      -> "Sync_val"
   | _             -> "unknown"
 
 (* Translate an ML array to a C pointer *)
@@ -171,6 +177,10 @@ let translate_ptr t s =
   | "GLbitfield*" -> p "Data_bigarray_val(%s)" s
   | "GLushort*"   -> p "Data_bigarray_val(%s)" s
   | "GLbyte*"     -> p "Data_bigarray_val(%s)" s
+  | "GLint64*"    -> p "Data_bigarray_val(%s)" s
+  | "GLuint64*"   -> p "Data_bigarray_val(%s)" s
+  | "GLint64EXT*" -> p "Data_bigarray_val(%s)" s
+  | "GLuint64EXT*"  -> p "Data_bigarray_val(%s)" s
   | "GLstring*"   -> p "(GLstring *)(%s)" s
   | _ -> "unknown"
 
@@ -181,7 +191,7 @@ let translate_dblptr t s =
   | "void**"    -> p "Data_bigarray_val(%s)" s
   | "GLvoid**"  -> p "Data_bigarray_val(%s)" s
   | "GLboolean**" -> p "Data_bigarray_val(%s)" s
-  | "GLchar**"  -> p "(GLchar** )(%s)" s
+  | "GLchar**"  -> p "string_array(%s)" s
   | _ -> "unknown"
 
 
@@ -208,6 +218,9 @@ let translate_ml t =
     | "GLushort"    -> "int"
     | "GLbyte"      -> "int"
     | "GLstring"  -> "string"
+    | "GLint64"     -> "int"
+    | "GLuint64"    -> "int"
+    | "GLsync"      -> "sync"
     | "GLbyte*"     -> "byte_array"
     | "GLubyte*"    -> "ubyte_array"
     | "void*"     -> "'a"
@@ -227,5 +240,9 @@ let translate_ml t =
     | "GLboolean**" -> "word_matrix"
     | "GLsizei*"    -> "word_array"
     | "GLenum*"     -> "word_array"
+    | "GLint64*"    -> "dword_array"
+    | "GLuint64*"   -> "dword_array"
+    | "GLint64EXT*" -> "dword_array"
+    | "GLuint64EXT*"  -> "dword_array"
     | _             -> "unknown"
 
@@ -0,0 +1,66 @@
+
+(** Client array arenas.
+	The arrays given to [glVertexPointer] and the other gl*Pointer functions are read by OpenGL when drawing,
+	after the call has returned, so they must neither move nor be freed in between. An arena hands out
+	Bigarray slices of memory allocated outside the Ocaml heap: [alloc a Bigarray.float32 n] returns a
+	[float_array] of n elements, aligned on 16 bytes, which can be filled and passed to the gl*Pointer functions.
+	[reset] recycles all slices at once, typically at the start of every frame, so steady-state use allocates
+	no memory. Slices must not be used after the [reset] or [destroy] that recycles them.
+	An arena that runs out of room allocates a larger chunk, and keeps only that one at the next [reset]; the
+	chunks it retires are freed at the [reset] after that, so that pointers OpenGL still holds into them stay
+	valid until the arrays are set again.
+	[destroy] frees the memory at once; an arena dropped without it frees its memory when it is collected, and
+	since slices do not keep their arena alive, the arena must stay reachable as long as its slices are used. *)
+type t = {
+	mutable chunks : ubyte_array list;
+	mutable retired : ubyte_array list;
+	mutable used : int
+}
+
+external alloc_chunk : int -> ubyte_array = "glstub_arena_alloc"
+external free_chunk : ubyte_array -> unit = "glstub_arena_free"
+external slice : ubyte_array -> int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_arena_slice"
+
+let alignment = 16
+
+(** Free the memory of the arena; it can not be used afterwards *)
+let destroy a =
+	List.iter free_chunk a.chunks;
+	List.iter free_chunk a.retired;
+	a.chunks <- [];
+	a.retired <- [];
+	a.used <- 0
+
+(** Create an arena of size bytes *)
+let create size =
+	let a = { chunks = [alloc_chunk (max size alignment)]; retired = []; used = 0 } in
+	Gc.finalise destroy a;
+	a
+
+(** Allocate a slice of n elements of the given kind *)
+let alloc a kind n =
+	let bytes = n * Bigarray.kind_size_in_bytes kind in
+	let chunk = List.hd a.chunks in
+	let offset = (a.used + alignment - 1) land (lnot (alignment - 1)) in
+	if offset + bytes <= Bigarray.Array1.dim chunk then begin
+		a.used <- offset + bytes;
+		slice chunk offset n kind
+	end else begin
+		let c = alloc_chunk (max bytes (2 * Bigarray.Array1.dim chunk)) in
+		a.chunks <- c :: a.chunks;
+		a.used <- bytes;
+		slice c 0 n kind
+	end
+
+(** Recycle all slices *)
+let reset a =
+	List.iter free_chunk a.retired;
+	(match a.chunks with
+	| c :: rest -> a.retired <- rest; a.chunks <- [c]
+	| [] -> a.retired <- []);
+	a.used <- 0
+
+(** Bytes in use and bytes available in the current chunk *)
+let used a = a.used
+let capacity a = match a.chunks with c :: _ -> Bigarray.Array1.dim c | [] -> 0
+
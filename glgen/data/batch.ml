@@ -0,0 +1,73 @@
+
+(** Multi-draw batches.
+	[multi_draw_arrays] and [multi_draw_elements] are typed versions of [Direct.glMultiDrawArrays] and
+	[Direct.glMultiDrawElements]: first vertices and counts are [word_array]s, and element offsets are an [int_array]
+	of byte offsets into the bound element array buffer (its elements have the size of a pointer). All of them are
+	handed to OpenGL as they are, without any copy.
+	A batch collects the ranges of many meshes stored in the same buffers: [add b start count] appends one range,
+	and [flush_arrays] or [flush_elements] draws all of them with a single call and empties the batch. For
+	[flush_arrays] start is the first vertex of a range, for [flush_elements] the byte offset of its first index.
+	The storage is kept and grows as needed, so a batch that is refilled every frame allocates nothing. *)
+type t = {
+	mutable first : word_array;
+	mutable offsets : int_array;
+	mutable count : word_array;
+	mutable length : int
+}
+
+let check name n a =
+	if n < 0 || n > Bigarray.Array1.dim a then invalid_argument (name ^ ": array too short")
+
+(** Draw the n vertex ranges starting at first.{i} with count.{i} vertices *)
+let multi_draw_arrays mode (first : word_array) (count : word_array) n =
+	check "Batch.multi_draw_arrays" n first;
+	check "Batch.multi_draw_arrays" n count;
+	Direct.glMultiDrawArrays mode first count n
+
+(** Draw the n ranges of count.{i} indices of type typ starting at byte offset offsets.{i} *)
+let multi_draw_elements mode (count : word_array) typ (offsets : int_array) n =
+	check "Batch.multi_draw_elements" n count;
+	check "Batch.multi_draw_elements" n offsets;
+	Direct.glMultiDrawElements mode count typ offsets n
+
+(** Create an empty batch with room for n ranges *)
+let create n =
+	let n = max n 16 in
+	{ first = make_word_array n; offsets = make_int_array n; count = make_word_array n; length = 0 }
+
+(** Number of ranges in b *)
+let length b = b.length
+
+(** Discard all ranges, keeping the storage *)
+let clear b = b.length <- 0
+
+let grow b =
+	let n = 2 * Bigarray.Array1.dim b.count in
+	let copy make a =
+		let a' = make n in
+		Bigarray.Array1.blit (Bigarray.Array1.sub a 0 b.length) (Bigarray.Array1.sub a' 0 b.length);
+		a'
+	in
+	b.first <- copy make_word_array b.first;
+	b.offsets <- copy make_int_array b.offsets;
+	b.count <- copy make_word_array b.count
+
+(** Append the range of count vertices or indices beginning at start *)
+let add b start count =
+	if b.length = Bigarray.Array1.dim b.count then grow b;
+	let i = b.length in
+	Bigarray.Array1.unsafe_set b.first i (Int32.of_int start);
+	Bigarray.Array1.unsafe_set b.offsets i start;
+	Bigarray.Array1.unsafe_set b.count i (Int32.of_int count);
+	b.length <- i + 1
+
+(** Draw all ranges as vertex ranges with glMultiDrawArrays, and empty b *)
+let flush_arrays b mode =
+	if b.length > 0 then multi_draw_arrays mode b.first b.count b.length;
+	b.length <- 0
+
+(** Draw all ranges as index ranges of type typ with glMultiDrawElements, and empty b *)
+let flush_elements b mode typ =
+	if b.length > 0 then multi_draw_elements mode b.count typ b.offsets b.length;
+	b.length <- 0
+
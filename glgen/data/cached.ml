@@ -0,0 +1,174 @@
+
+(** Cached state changes.
+	The functions below have the names and arguments of the GL functions they replace, but skip
+	the call when the value it sets is already current, e.g. binding the texture that is already bound.
+	The known values are kept in a [state], one per OpenGL context: use [make_current] when switching
+	contexts. Everything starts out unknown, so the first call always reaches OpenGL.
+	Only changes made through this module are seen: call [invalidate] after changing the same state
+	through the plain bindings or any other library. *)
+type state = {
+	mutable active_texture : int;
+	mutable program : int;
+	mutable vertex_array : int;
+	mutable blend_src : int;
+	mutable blend_dst : int;
+	textures : (int, int) Hashtbl.t;
+	buffers : (int, int) Hashtbl.t;
+	capabilities : (int, int) Hashtbl.t;
+	mutable issued : int;
+	mutable elided : int
+}
+
+(** Create a state with everything unknown *)
+let create () = {
+	active_texture = -1;
+	program = -1;
+	vertex_array = -1;
+	blend_src = -1;
+	blend_dst = -1;
+	textures = Hashtbl.create 16;
+	buffers = Hashtbl.create 8;
+	capabilities = Hashtbl.create 16;
+	issued = 0;
+	elided = 0
+}
+
+let current = ref (create ())
+
+(** Use state s for the calls that follow; s should belong to the current OpenGL context *)
+let make_current s = current := s
+
+(** The state in use *)
+let get_current () = !current
+
+(** Forget everything known about the current context *)
+let invalidate () =
+	let s = !current in
+	s.active_texture <- -1;
+	s.program <- -1;
+	s.vertex_array <- -1;
+	s.blend_src <- -1;
+	s.blend_dst <- -1;
+	Hashtbl.clear s.textures;
+	Hashtbl.clear s.buffers;
+	Hashtbl.clear s.capabilities
+
+(** Number of calls passed on to OpenGL and number of calls dropped, for the current state *)
+let issued () = (!current).issued
+let elided () = (!current).elided
+let reset_counters () =
+	(!current).issued <- 0;
+	(!current).elided <- 0
+
+let find h k = try Hashtbl.find h k with Not_found -> -1
+
+(* Run f unless the known value is already v, then remember v *)
+let change s known v set f =
+	if (known : int) = v then
+		s.elided <- s.elided + 1
+	else begin
+		s.issued <- s.issued + 1;
+		set v;
+		f ()
+	end
+
+(* The active texture unit, asked of OpenGL while it is unknown *)
+let active_unit s =
+	if s.active_texture < 0 then begin
+		let a = [| 0 |] in
+		glGetIntegerv gl_active_texture a;
+		s.active_texture <- a.(0)
+	end;
+	s.active_texture
+
+(* Texture bindings and texture enables belong to the active texture unit *)
+let unit_key s k = ((active_unit s) lsl 16) lor k
+
+let is_texture_capability c =
+	c = gl_texture_1d || c = gl_texture_2d || c = gl_texture_3d || c = gl_texture_cube_map ||
+	c = gl_texture_rectangle_arb || (c >= gl_texture_gen_s && c <= gl_texture_gen_q)
+
+let capability_key s c = if is_texture_capability c then unit_key s c else c
+
+(* Reset the bindings in h that refer to one of the deleted names to 0 *)
+let unbind h names =
+	let keys = Hashtbl.fold (fun k v l -> if Array.mem v names then k :: l else l) h [] in
+	List.iter (fun k -> Hashtbl.replace h k 0) keys
+
+let glActiveTexture t =
+	let s = !current in
+	change s s.active_texture t (fun v -> s.active_texture <- v) (fun () -> glActiveTexture t)
+
+let glBindTexture target tex =
+	let s = !current in
+	let k = unit_key s target in
+	change s (find s.textures k) tex (Hashtbl.replace s.textures k) (fun () -> glBindTexture target tex)
+
+let glBindBuffer target buf =
+	let s = !current in
+	change s (find s.buffers target) buf (Hashtbl.replace s.buffers target) (fun () -> glBindBuffer target buf)
+
+let glBindVertexArray a =
+	let s = !current in
+	change s s.vertex_array a
+		(fun v -> s.vertex_array <- v; Hashtbl.remove s.buffers gl_element_array_buffer)
+		(fun () -> glBindVertexArray a)
+
+let glUseProgram p =
+	let s = !current in
+	change s s.program p (fun v -> s.program <- v) (fun () -> glUseProgram p)
+
+let set_capability c b f =
+	let s = !current in
+	let k = capability_key s c in
+	change s (find s.capabilities k) b (Hashtbl.replace s.capabilities k) (fun () -> f c)
+
+let glEnable c = set_capability c 1 glEnable
+let glDisable c = set_capability c 0 glDisable
+
+let glBlendFunc src dst =
+	let s = !current in
+	change s (if s.blend_src = src then s.blend_dst else -1) dst
+		(fun v -> s.blend_src <- src; s.blend_dst <- v)
+		(fun () -> glBlendFunc src dst)
+
+let glBlendFuncSeparate srgb drgb salpha dalpha =
+	let s = !current in
+	s.issued <- s.issued + 1;
+	s.blend_src <- -1;
+	s.blend_dst <- -1;
+	glBlendFuncSeparate srgb drgb salpha dalpha
+
+(** Deleting bound objects reverts their bindings to 0 *)
+let glDeleteTextures n names =
+	glDeleteTextures n names;
+	unbind (!current).textures (Array.sub names 0 n)
+
+let glDeleteBuffers n names =
+	glDeleteBuffers n names;
+	unbind (!current).buffers (Array.sub names 0 n)
+
+let glDeleteVertexArrays n names =
+	glDeleteVertexArrays n names;
+	let s = !current in
+	if Array.mem s.vertex_array (Array.sub names 0 n) then begin
+		s.vertex_array <- 0;
+		Hashtbl.remove s.buffers gl_element_array_buffer
+	end
+
+(** A deleted program may stay in use until another one is, and its name be given to a new program, so the
+	program in use becomes unknown *)
+let glDeleteProgram p =
+	glDeleteProgram p;
+	let s = !current in
+	if s.program = p then s.program <- -1
+
+(** Popping attributes restores state behind the cache's back *)
+let glPopAttrib () =
+	invalidate ();
+	glPopAttrib ()
+
+let glPopClientAttrib () =
+	invalidate ();
+	glPopClientAttrib ()
+
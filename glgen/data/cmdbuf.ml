@@ -0,0 +1,44 @@
+
+(** Command buffers.
+	Each encoder below has the name and arguments of the GL function it records,
+	preceded by the buffer: [Cmdbuf.glBindTexture b gl_texture_2d tex] appends the
+	opcode of glBindTexture followed by its two operands. All operands are stored
+	as doubles, which holds GL ints, enums and floats exactly. [execute] replays the
+	whole buffer with a single C call; a buffer may be executed any number of times,
+	so static scenes can be recorded once and resubmitted every frame.
+	Only functions with scalar arguments and no result can be recorded. *)
+type t = {
+	mutable data : double_array;
+	mutable len : int
+}
+
+(** Create an empty command buffer with room for n slots *)
+let create n = { data = make_double_array (max n 16); len = 0 }
+
+(** Discard all recorded commands, keeping the storage *)
+let clear b = b.len <- 0
+
+(** Number of slots in use *)
+let length b = b.len
+
+(** Grow the storage of b to at least n slots *)
+let grow b n =
+	let size = ref (max 16 (Bigarray.Array1.dim b.data)) in
+	while !size < n do size := 2 * !size done;
+	let d = make_double_array !size in
+	Bigarray.Array1.blit (Bigarray.Array1.sub b.data 0 b.len) (Bigarray.Array1.sub d 0 b.len);
+	b.data <- d
+
+(** Reserve n slots at the end of b and return the index of the first one *)
+let reserve b n =
+	let o = b.len in
+	if o + n > Bigarray.Array1.dim b.data then grow b (o + n);
+	b.len <- o + n;
+	o
+
+external execute' : double_array -> int -> unit = "glstub_cmdbuf_execute"
+
+(** Replay all commands recorded in b *)
+let execute b = execute' b.data b.len
+
+(** Opcode table: name and number of operands of every opcode *)
@@ -0,0 +1,66 @@
+
+(** Fences.
+	[insert ()] puts a fence into the command stream, and [wait f] blocks until the GPU has passed it, with the Ocaml
+	runtime lock released so that other threads keep running meanwhile; [signaled f] tests without waiting.
+	A [ring] keeps one fence per region of a ring buffer, so that a region is only overwritten once the GPU has
+	finished reading it: [acquire r] waits for the next region and returns its index, and [release r i] fences
+	region i after the commands that read it have been issued. Fences must be deleted with [delete]. *)
+type t = sync
+
+external client_wait : sync -> int -> int -> int = "glstub_fence_wait"
+
+(** Fence the commands issued so far *)
+let insert () = glFenceSync gl_sync_gpu_commands_complete 0
+
+(** Test whether the GPU has passed the fence, without waiting *)
+let signaled f =
+	let r = glClientWaitSync f 0 0 in
+	r = gl_already_signaled || r = gl_condition_satisfied
+
+(** Wait until the GPU has passed the fence or timeout nanoseconds have elapsed (by default no time limit),
+	flushing the commands first. Returns [false] on timeout *)
+let wait ?(timeout = max_int) f =
+	let r = client_wait f gl_sync_flush_commands_bit timeout in
+	if r = gl_wait_failed then failwith "Fence.wait: glClientWaitSync failed";
+	r <> gl_timeout_expired
+
+let delete f = glDeleteSync f
+
+type ring = {
+	fences : t option array;
+	mutable next : int
+}
+
+(** Create a ring of n regions *)
+let ring n = {
+	fences = Array.make n None;
+	next = 0
+}
+
+(** Wait until the GPU is done with the next region, and return its index *)
+let acquire r =
+	let i = r.next in
+	(match r.fences.(i) with
+	| Some f ->
+		ignore (wait f);
+		delete f;
+		r.fences.(i) <- None
+	| None -> ());
+	r.next <- (i + 1) mod Array.length r.fences;
+	i
+
+(** Fence region i of the ring *)
+let release r i =
+	(match r.fences.(i) with
+	| Some f -> delete f
+	| None -> ());
+	r.fences.(i) <- Some (insert ())
+
+(** Delete the fences of the ring *)
+let destroy r =
+	Array.iteri (fun i f ->
+		(match f with
+		| Some f -> delete f
+		| None -> ());
+		r.fences.(i) <- None) r.fences
+
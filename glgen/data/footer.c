@@ -0,0 +1,643 @@
+
+/*
+ * Hand-written stubs, appended after the generated ones so that they can call through the same function pointers.
+ */
+
+#define GL_BUFFER_SIZE 0x8764
+
+/* Wrap a buffer mapping in a Bigarray of the given kind, without copying */
+static value map_view(char *fname, void *p, GLsizeiptr length, value kind)
+{
+        char msg[256];
+        int k = Int_val(kind);
+        if(p == NULL)
+        {
+                snprintf(msg, sizeof(msg), "%s failed", fname);
+                failwith(msg);
+        }
+        return alloc_bigarray_dims(k | BIGARRAY_C_LAYOUT | BIGARRAY_EXTERNAL, 1, p, (intnat)(length / caml_ba_element_size[k]));
+}
+
+value glstub_map_buffer(value v0, value v1, value v2)
+{
+        CAMLparam3(v0, v1, v2);
+        GLint size = 0;
+        void *p;
+        LOAD_FUNCTION(glGetBufferParameteriv);
+        LOAD_FUNCTION(glMapBuffer);
+        (*stub_glGetBufferParameteriv)(Int_val(v0), GL_BUFFER_SIZE, &size);
+        p = (*stub_glMapBuffer)(Int_val(v0), Int_val(v1));
+        CAMLreturn(map_view("glMapBuffer", p, size, v2));
+}
+
+value glstub_map_buffer_range(value v0, value v1, value v2, value v3, value v4)
+{
+        CAMLparam5(v0, v1, v2, v3, v4);
+        void *p;
+        LOAD_FUNCTION(glMapBufferRange);
+        p = (*stub_glMapBufferRange)(Int_val(v0), Long_val(v1), Long_val(v2), Int_val(v3));
+        CAMLreturn(map_view("glMapBufferRange", p, Long_val(v2), v4));
+}
+
+/* Shrink a view to nothing once its mapping is gone, so that bounds checks catch any further access */
+value glstub_unmap_view(value v0)
+{
+        struct caml_bigarray *b = Bigarray_val(v0);
+        b->dim[0] = 0;
+        b->data = NULL;
+        return Val_unit;
+}
+
+/* Arena chunks: malloc'd memory that the GC neither moves nor frees */
+value glstub_arena_alloc(value v0)
+{
+        CAMLparam1(v0);
+        void *p = malloc(Long_val(v0) > 0 ? Long_val(v0) : 1);
+        if(p == NULL) raise_out_of_memory();
+        CAMLreturn(alloc_bigarray_dims(BIGARRAY_UINT8 | BIGARRAY_C_LAYOUT | BIGARRAY_EXTERNAL, 1, p, (intnat)Long_val(v0)));
+}
+
+value glstub_arena_free(value v0)
+{
+        free(Data_bigarray_val(v0));
+        return glstub_unmap_view(v0);
+}
+
+/* View of n elements of the given kind, starting at a byte offset in a chunk */
+value glstub_arena_slice(value v0, value v1, value v2, value v3)
+{
+        CAMLparam4(v0, v1, v2, v3);
+        char *p = (char *)Data_bigarray_val(v0) + Long_val(v1);
+        CAMLreturn(alloc_bigarray_dims(Int_val(v3) | BIGARRAY_C_LAYOUT | BIGARRAY_EXTERNAL, 1, (void *)p, (intnat)Long_val(v2)));
+}
+
+/* Copy rows of row_bytes bytes from a packed Bigarray into one whose rows are pitch bytes apart, optionally upside down */
+value glstub_copy_rows(value v0, value v1, value v2, value v3, value v4, value v5)
+{
+        CAMLparam5(v0, v1, v2, v3, v4);
+        CAMLxparam1(v5);
+        char *src = Data_bigarray_val(v0);
+        char *dst = Data_bigarray_val(v1);
+        intnat rows = Long_val(v2), row_bytes = Long_val(v3), pitch = Long_val(v4);
+        intnat i;
+        if(rows <= 0) CAMLreturn(Val_unit);
+        if(row_bytes < 0 || pitch < row_bytes || bigarray_byte_size(Bigarray_val(v0)) < (uintnat)(rows * row_bytes)
+                || bigarray_byte_size(Bigarray_val(v1)) < (uintnat)((rows - 1) * pitch + row_bytes))
+                invalid_argument("copy_rows");
+        for(i = 0; i < rows; i++)
+                memcpy(dst + (Bool_val(v5) ? rows - 1 - i : i) * pitch, src + i * row_bytes, row_bytes);
+        CAMLreturn(Val_unit);
+}
+
+value glstub_copy_rows_byte(value * argv, int n)
+{
+        return glstub_copy_rows(argv[0], argv[1], argv[2], argv[3], argv[4], argv[5]);
+}
+
+/*
+ * Mat4: column-major 4x4 float matrices stored in float32 Bigarrays, as glUniformMatrix4fv and glLoadMatrixf
+ * expect them. Products are computed a column at a time, with SSE or NEON when the compiler targets them.
+ */
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define MAT4_PI 3.14159265358979323846
+
+/* Data of a float32 Bigarray holding at least n floats */
+static float *float_data(value v, intnat n, char *fname)
+{
+        struct caml_ba_array *b = Caml_ba_array_val(v);
+        intnat size = 1;
+        int i;
+        for(i = 0; i < b->num_dims; i++) size *= b->dim[i];
+        if(size < n) invalid_argument(fname);
+        return (float *)b->data;
+}
+
+/* r = m * v for a 4-component vector v; r must not overlap v */
+static void mat4_transform(float *r, const float *m, const float *v)
+{
+#if defined(__SSE__) || defined(_M_X64)
+        __m128 c = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(v[0]));
+        c = _mm_add_ps(c, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+        c = _mm_add_ps(c, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+        c = _mm_add_ps(c, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+        _mm_storeu_ps(r, c);
+#elif defined(__ARM_NEON)
+        float32x4_t c = vmulq_n_f32(vld1q_f32(m), v[0]);
+        c = vmlaq_n_f32(c, vld1q_f32(m + 4), v[1]);
+        c = vmlaq_n_f32(c, vld1q_f32(m + 8), v[2]);
+        c = vmlaq_n_f32(c, vld1q_f32(m + 12), v[3]);
+        vst1q_f32(r, c);
+#else
+        int i;
+        for(i = 0; i < 4; i++) r[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+#endif
+}
+
+/* r = a * b; r may be a or b */
+static void mat4_mul(float *r, const float *a, const float *b)
+{
+        float t[16];
+        int j;
+        for(j = 0; j < 4; j++) mat4_transform(t + 4 * j, a, b + 4 * j);
+        memcpy(r, t, sizeof(t));
+}
+
+value glstub_mat4_mul(value v0, value v1, value v2)
+{
+        float *r = float_data(v0, 16, "Mat4.mul");
+        float *a = float_data(v1, 16, "Mat4.mul");
+        float *b = float_data(v2, 16, "Mat4.mul");
+        mat4_mul(r, a, b);
+        return Val_unit;
+}
+
+/* r = inverse of a, by cofactors; false, leaving r unchanged, if a is singular */
+value glstub_mat4_invert(value v0, value v1)
+{
+        float *r = float_data(v0, 16, "Mat4.invert");
+        float *m = float_data(v1, 16, "Mat4.invert");
+        float t[16];
+        double det;
+        int i;
+        t[0] = m[5]*m[10]*m[15] - m[5]*m[11]*m[14] - m[9]*m[6]*m[15] + m[9]*m[7]*m[14] + m[13]*m[6]*m[11] - m[13]*m[7]*m[10];
+        t[4] = -m[4]*m[10]*m[15] + m[4]*m[11]*m[14] + m[8]*m[6]*m[15] - m[8]*m[7]*m[14] - m[12]*m[6]*m[11] + m[12]*m[7]*m[10];
+        t[8] = m[4]*m[9]*m[15] - m[4]*m[11]*m[13] - m[8]*m[5]*m[15] + m[8]*m[7]*m[13] + m[12]*m[5]*m[11] - m[12]*m[7]*m[9];
+        t[12] = -m[4]*m[9]*m[14] + m[4]*m[10]*m[13] + m[8]*m[5]*m[14] - m[8]*m[6]*m[13] - m[12]*m[5]*m[10] + m[12]*m[6]*m[9];
+        t[1] = -m[1]*m[10]*m[15] + m[1]*m[11]*m[14] + m[9]*m[2]*m[15] - m[9]*m[3]*m[14] - m[13]*m[2]*m[11] + m[13]*m[3]*m[10];
+        t[5] = m[0]*m[10]*m[15] - m[0]*m[11]*m[14] - m[8]*m[2]*m[15] + m[8]*m[3]*m[14] + m[12]*m[2]*m[11] - m[12]*m[3]*m[10];
+        t[9] = -m[0]*m[9]*m[15] + m[0]*m[11]*m[13] + m[8]*m[1]*m[15] - m[8]*m[3]*m[13] - m[12]*m[1]*m[11] + m[12]*m[3]*m[9];
+        t[13] = m[0]*m[9]*m[14] - m[0]*m[10]*m[13] - m[8]*m[1]*m[14] + m[8]*m[2]*m[13] + m[12]*m[1]*m[10] - m[12]*m[2]*m[9];
+        t[2] = m[1]*m[6]*m[15] - m[1]*m[7]*m[14] - m[5]*m[2]*m[15] + m[5]*m[3]*m[14] + m[13]*m[2]*m[7] - m[13]*m[3]*m[6];
+        t[6] = -m[0]*m[6]*m[15] + m[0]*m[7]*m[14] + m[4]*m[2]*m[15] - m[4]*m[3]*m[14] - m[12]*m[2]*m[7] + m[12]*m[3]*m[6];
+        t[10] = m[0]*m[5]*m[15] - m[0]*m[7]*m[13] - m[4]*m[1]*m[15] + m[4]*m[3]*m[13] + m[12]*m[1]*m[7] - m[12]*m[3]*m[5];
+        t[14] = -m[0]*m[5]*m[14] + m[0]*m[6]*m[13] + m[4]*m[1]*m[14] - m[4]*m[2]*m[13] - m[12]*m[1]*m[6] + m[12]*m[2]*m[5];
+        t[3] = -m[1]*m[6]*m[11] + m[1]*m[7]*m[10] + m[5]*m[2]*m[11] - m[5]*m[3]*m[10] - m[9]*m[2]*m[7] + m[9]*m[3]*m[6];
+        t[7] = m[0]*m[6]*m[11] - m[0]*m[7]*m[10] - m[4]*m[2]*m[11] + m[4]*m[3]*m[10] + m[8]*m[2]*m[7] - m[8]*m[3]*m[6];
+        t[11] = -m[0]*m[5]*m[11] + m[0]*m[7]*m[9] + m[4]*m[1]*m[11] - m[4]*m[3]*m[9] - m[8]*m[1]*m[7] + m[8]*m[3]*m[5];
+        t[15] = m[0]*m[5]*m[10] - m[0]*m[6]*m[9] - m[4]*m[1]*m[10] + m[4]*m[2]*m[9] + m[8]*m[1]*m[6] - m[8]*m[2]*m[5];
+        det = (double)m[0] * t[0] + (double)m[1] * t[4] + (double)m[2] * t[8] + (double)m[3] * t[12];
+        if(det == 0.) return Val_false;
+        for(i = 0; i < 16; i++) r[i] = (float)(t[i] / det);
+        return Val_true;
+}
+
+/* dst.(i) = m * src.(i) for the first n matrices of two n x 16 matrices */
+value glstub_mat4_mul_batch(value v0, value v1, value v2, value v3)
+{
+        intnat n = Long_val(v3), i;
+        float *dst = float_data(v0, 16 * n, "Mat4.mul_batch");
+        float *m = float_data(v1, 16, "Mat4.mul_batch");
+        float *src = float_data(v2, 16 * n, "Mat4.mul_batch");
+        for(i = 0; i < n; i++) mat4_mul(dst + 16 * i, m, src + 16 * i);
+        return Val_unit;
+}
+
+/* Transform n 4-component points from src into dst, which may be the same array */
+value glstub_mat4_transform_points(value v0, value v1, value v2, value v3)
+{
+        intnat n = Long_val(v3), i;
+        float *dst = float_data(v0, 4 * n, "Mat4.transform_points");
+        float *m = float_data(v1, 16, "Mat4.transform_points");
+        float *src = float_data(v2, 4 * n, "Mat4.transform_points");
+        float t[4];
+        for(i = 0; i < n; i++)
+        {
+                mat4_transform(t, m, src + 4 * i);
+                memcpy(dst + 4 * i, t, sizeof(t));
+        }
+        return Val_unit;
+}
+
+/* Perspective projection as gluPerspective, with the vertical field of view in degrees */
+value glstub_mat4_perspective_nat(value v0, double fovy, double aspect, double znear, double zfar)
+{
+        float *m = float_data(v0, 16, "Mat4.perspective");
+        double f = 1. / tan(fovy * MAT4_PI / 360.);
+        memset(m, 0, 16 * sizeof(float));
+        m[0] = (float)(f / aspect);
+        m[5] = (float)f;
+        m[10] = (float)((zfar + znear) / (znear - zfar));
+        m[11] = -1.f;
+        m[14] = (float)(2. * zfar * znear / (znear - zfar));
+        return Val_unit;
+}
+
+value glstub_mat4_perspective(value v0, value v1, value v2, value v3, value v4)
+{
+        return glstub_mat4_perspective_nat(v0, Double_val(v1), Double_val(v2), Double_val(v3), Double_val(v4));
+}
+
+/* Orthographic projection as glOrtho */
+value glstub_mat4_ortho_nat(value v0, double left, double right, double bottom, double top, double znear, double zfar)
+{
+        float *m = float_data(v0, 16, "Mat4.ortho");
+        memset(m, 0, 16 * sizeof(float));
+        m[0] = (float)(2. / (right - left));
+        m[5] = (float)(2. / (top - bottom));
+        m[10] = (float)(-2. / (zfar - znear));
+        m[12] = (float)(-(right + left) / (right - left));
+        m[13] = (float)(-(top + bottom) / (top - bottom));
+        m[14] = (float)(-(zfar + znear) / (zfar - znear));
+        m[15] = 1.f;
+        return Val_unit;
+}
+
+value glstub_mat4_ortho_byte(value * argv, int n)
+{
+        return glstub_mat4_ortho_nat(argv[0], Double_val(argv[1]), Double_val(argv[2]), Double_val(argv[3]),
+                Double_val(argv[4]), Double_val(argv[5]), Double_val(argv[6]));
+}
+
+/* Viewing transformation as gluLookAt */
+value glstub_mat4_look_at_nat(value v0, double ex, double ey, double ez, double cx, double cy, double cz,
+        double ux, double uy, double uz)
+{
+        float *m = float_data(v0, 16, "Mat4.look_at");
+        double f[3], s[3], u[3], l;
+        f[0] = cx - ex; f[1] = cy - ey; f[2] = cz - ez;
+        l = sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+        if(l > 0.) { f[0] /= l; f[1] /= l; f[2] /= l; }
+        s[0] = f[1] * uz - f[2] * uy; s[1] = f[2] * ux - f[0] * uz; s[2] = f[0] * uy - f[1] * ux;
+        l = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+        if(l > 0.) { s[0] /= l; s[1] /= l; s[2] /= l; }
+        u[0] = s[1] * f[2] - s[2] * f[1]; u[1] = s[2] * f[0] - s[0] * f[2]; u[2] = s[0] * f[1] - s[1] * f[0];
+        m[0] = (float)s[0]; m[4] = (float)s[1]; m[8] = (float)s[2];
+        m[1] = (float)u[0]; m[5] = (float)u[1]; m[9] = (float)u[2];
+        m[2] = (float)-f[0]; m[6] = (float)-f[1]; m[10] = (float)-f[2];
+        m[3] = m[7] = m[11] = 0.f;
+        m[12] = (float)-(s[0] * ex + s[1] * ey + s[2] * ez);
+        m[13] = (float)-(u[0] * ex + u[1] * ey + u[2] * ez);
+        m[14] = (float)(f[0] * ex + f[1] * ey + f[2] * ez);
+        m[15] = 1.f;
+        return Val_unit;
+}
+
+value glstub_mat4_look_at_byte(value * argv, int n)
+{
+        return glstub_mat4_look_at_nat(argv[0], Double_val(argv[1]), Double_val(argv[2]), Double_val(argv[3]),
+                Double_val(argv[4]), Double_val(argv[5]), Double_val(argv[6]),
+                Double_val(argv[7]), Double_val(argv[8]), Double_val(argv[9]));
+}
+
+value glstub_stats_enabled(value unit)
+{
+#ifdef GLCAML_PROFILE
+        return Val_true;
+#else
+        return Val_false;
+#endif
+}
+
+/* Name, number of calls and seconds spent of every function called since the last reset */
+value glstub_stats_snapshot(value unit)
+{
+        CAMLparam1(unit);
+        CAMLlocal3(result, item, name);
+        size_t n = sizeof(glstub_entries) / sizeof(glstub_entries[0]);
+        size_t i, count = 0;
+        for(i = 0; i < n; i++) if(glstub_entries[i].stat->calls) count++;
+        result = alloc_tuple(count);
+        count = 0;
+        for(i = 0; i < n; i++)
+        {
+                struct glstub_stat *s = glstub_entries[i].stat;
+                if(s->calls == 0) continue;
+                name = copy_string(glstub_entries[i].name);
+                item = alloc_tuple(3);
+                Store_field(item, 0, name);
+                Store_field(item, 1, Val_long(s->calls));
+                Store_field(item, 2, copy_double(s->time));
+                Store_field(result, count++, item);
+        }
+        CAMLreturn(result);
+}
+
+value glstub_stats_reset(value unit)
+{
+        size_t n = sizeof(glstub_entries) / sizeof(glstub_entries[0]);
+        size_t i;
+        for(i = 0; i < n; i++)
+        {
+                glstub_entries[i].stat->calls = 0;
+                glstub_entries[i].stat->time = 0.;
+        }
+        return Val_unit;
+}
+
+
+/*
+ * Shader sources: the strings of each source are passed to glShaderSource through the scratch arrays of
+ * string_array, with their lengths, so neither side copies or converts anything.
+ */
+value glstub_shader_source(value v0, value v1)
+{
+        GLchar **strings = string_array(v1);
+        LOAD_FUNCTION(glShaderSource);
+        (*stub_glShaderSource)(Int_val(v0), Wosize_val(v1), strings, length_scratch);
+#ifdef GLCAML_CHECKED
+        check_error("glShaderSource", "(%ld, %ld, ...)", (long)Int_val(v0), (long)Wosize_val(v1));
+#endif
+        return Val_unit;
+}
+
+/* Set the source of every shader in v0 to the strings at the same index in v1, and compile it */
+value glstub_compile_shaders(value v0, value v1)
+{
+        mlsize_t i, n = Wosize_val(v0);
+        if(Wosize_val(v1) != n) invalid_argument("compile_shaders: one source is needed per shader");
+        LOAD_FUNCTION(glShaderSource);
+        LOAD_FUNCTION(glCompileShader);
+        for(i = 0; i < n; i++)
+        {
+                GLuint shader = Int_val(Field(v0, i));
+                value source = Field(v1, i);
+                GLchar **strings = string_array(source);
+                (*stub_glShaderSource)(shader, Wosize_val(source), strings, length_scratch);
+                (*stub_glCompileShader)(shader);
+#ifdef GLCAML_CHECKED
+                check_error("glCompileShader", "(%ld)", (long)shader);
+#endif
+        }
+        return Val_unit;
+}
+
+/*
+ * Fence: glClientWaitSync with the runtime lock released, so that other threads keep running while this one waits
+ * for the GPU. The GLsync is read out of its block first, since the block may move while the lock is released.
+ */
+value glstub_fence_wait(value v0, value v1, value v2)
+{
+        GLsync sync = Sync_val(v0);
+        GLbitfield flags = Int_val(v1);
+        GLuint64 timeout = Long_val(v2);
+        GLenum r;
+        LOAD_FUNCTION(glClientWaitSync);
+        caml_enter_blocking_section();
+        r = (*stub_glClientWaitSync)(sync, flags, timeout);
+        caml_leave_blocking_section();
+#ifdef GLCAML_CHECKED
+        check_error("glClientWaitSync", "(%p, 0x%lx, %ld)", (void *)sync, (long)flags, (long)timeout);
+#endif
+        return Val_int(r);
+}
+
+/*
+ * Handles: custom blocks owning the name of a GL object. A handle that is collected without having been deleted
+ * cannot delete its object from the finalizer, which may run on a thread without the context, so it pushes it onto
+ * a lock-free stack; Handle.collect deletes everything on the stack, and is called at every swap by
+ * Win.swap_buffers and Sdl.swap_buffers, which find it registered as "Glcaml.Handle.collect" (see glcaml_drain.h).
+ * The estimated byte size of each object is also reported to the GC, when the handle is created and whenever
+ * the size grows, so that large textures and buffers get collected sooner.
+ */
+#define HANDLE_KINDS 9
+#define HANDLE_GC_MAX (256 * 1024 * 1024)
+
+struct gl_handle
+{
+        struct gl_handle *next;
+        int kind;
+        int deleted;
+        GLuint name;
+        intnat bytes;
+};
+
+#if defined(__GNUC__)
+#define ATOMIC_ADD(p, n) __atomic_fetch_add(p, n, __ATOMIC_RELAXED)
+#define ATOMIC_PUSH(head, node) \
+        do node->next = __atomic_load_n(head, __ATOMIC_RELAXED); \
+        while(!__atomic_compare_exchange_n(head, &node->next, node, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+#define ATOMIC_TAKE(head) __atomic_exchange_n(head, NULL, __ATOMIC_ACQUIRE)
+#else
+/* Without atomics, finalizers are assumed to run with the runtime lock held, as in Ocaml 4 */
+#define ATOMIC_ADD(p, n) (*(p) += (n))
+#define ATOMIC_PUSH(head, node) (node->next = *(head), *(head) = node)
+#define ATOMIC_TAKE(head) take_all(head)
+static struct gl_handle *take_all(struct gl_handle **head)
+{
+        struct gl_handle *h = *head;
+        *head = NULL;
+        return h;
+}
+#endif
+
+static struct gl_handle *deletion_queue = NULL;
+static intnat handle_live[HANDLE_KINDS];
+static intnat handle_bytes[HANDLE_KINDS];
+
+#define Handle_val(v) (*((struct gl_handle **)Data_custom_val(v)))
+
+/* Test whether a function is available, looking it up without raising */
+#define AVAILABLE(func) \
+        ((stub_##func == NULL ? (void)(stub_##func = (pfn##func)try_load_function(#func)) : (void)0), \
+        (void *)stub_##func != (void *)&missing_function)
+
+#define DELETE_NAMES(func, name) \
+        if(AVAILABLE(func)) (*stub_##func)(1, &name); \
+        else return #func
+
+/* As DELETE_NAMES, falling back to the extension function ext where func is missing */
+#define DELETE_NAMES_OR(func, ext, name) \
+        if(AVAILABLE(func)) (*stub_##func)(1, &name); \
+        else if(AVAILABLE(ext)) (*stub_##ext)(1, &name); \
+        else return #func
+
+#define DELETE_NAME(func, name) \
+        if(AVAILABLE(func)) (*stub_##func)(name); \
+        else return #func
+
+/* Delete the object of a handle; the kinds are the constructors of Handle.kind. Returns NULL, or the name of the
+ * missing function when the object could not be deleted, in which case it still counts as live */
+static const char *delete_object(struct gl_handle *h)
+{
+        GLuint name = h->name;
+        switch(h->kind)
+        {
+        case 0: DELETE_NAMES(glDeleteTextures, name); break;
+        case 1: DELETE_NAMES_OR(glDeleteBuffers, glDeleteBuffersARB, name); break;
+        case 2: DELETE_NAMES_OR(glDeleteRenderbuffers, glDeleteRenderbuffersEXT, name); break;
+        case 3: DELETE_NAMES_OR(glDeleteFramebuffers, glDeleteFramebuffersEXT, name); break;
+        case 4: DELETE_NAME(glDeleteProgram, name); break;
+        case 5: DELETE_NAME(glDeleteShader, name); break;
+        case 6: DELETE_NAMES(glDeleteVertexArrays, name); break;
+        case 7: DELETE_NAMES_OR(glDeleteQueries, glDeleteQueriesARB, name); break;
+        case 8: DELETE_NAMES(glDeleteSamplers, name); break;
+        }
+        ATOMIC_ADD(&handle_live[h->kind], -1);
+        ATOMIC_ADD(&handle_bytes[h->kind], -h->bytes);
+        return NULL;
+}
+
+static void finalize_handle(value v)
+{
+        struct gl_handle *h = Handle_val(v);
+        if(h->deleted) free(h);
+        else ATOMIC_PUSH(&deletion_queue, h);
+}
+
+static int compare_handle(value v1, value v2)
+{
+        struct gl_handle *a = Handle_val(v1), *b = Handle_val(v2);
+        if(a->kind != b->kind) return a->kind < b->kind ? -1 : 1;
+        return a->name < b->name ? -1 : a->name > b->name ? 1 : 0;
+}
+
+static intnat hash_handle(value v)
+{
+        return Handle_val(v)->kind * 65599 + Handle_val(v)->name;
+}
+
+static struct custom_operations handle_ops = {
+        "glcaml.handle",
+        finalize_handle,
+        compare_handle,
+        hash_handle,
+        custom_serialize_default,
+        custom_deserialize_default
+};
+
+/* Delete the objects of the handles collected so far; must be called with the context current. The first
+ * missing deletion function is reported by check_error, as for the [@@noalloc] stubs */
+static void drain_deletions(void)
+{
+        struct gl_handle *h = ATOMIC_TAKE(&deletion_queue), *next;
+        const char *missing;
+        for(; h != NULL; h = next)
+        {
+                next = h->next;
+                missing = delete_object(h);
+                if(missing != NULL && missing_name == NULL) missing_name = missing;
+                free(h);
+        }
+}
+
+value glstub_handle_wrap(value v0, value v1, value v2)
+{
+        CAMLparam3(v0, v1, v2);
+        CAMLlocal1(result);
+        struct gl_handle *h = malloc(sizeof(struct gl_handle));
+        if(h == NULL) caml_raise_out_of_memory();
+        h->next = NULL;
+        h->kind = Int_val(v0);
+        h->deleted = 0;
+        h->name = Int_val(v1);
+        h->bytes = Long_val(v2);
+        ATOMIC_ADD(&handle_live[h->kind], 1);
+        ATOMIC_ADD(&handle_bytes[h->kind], h->bytes);
+        result = caml_alloc_custom(&handle_ops, sizeof(struct gl_handle *), h->bytes, HANDLE_GC_MAX);
+        Handle_val(result) = h;
+        CAMLreturn(result);
+}
+
+value glstub_handle_name(value v0)
+{
+        struct gl_handle *h = Handle_val(v0);
+        if(h->deleted) invalid_argument("Handle.name: the object has been deleted");
+        return Val_int(h->name);
+}
+
+value glstub_handle_set_bytes(value v0, value v1)
+{
+        struct gl_handle *h = Handle_val(v0);
+        if(!h->deleted)
+        {
+                ATOMIC_ADD(&handle_bytes[h->kind], Long_val(v1) - h->bytes);
+                if(Long_val(v1) > h->bytes) caml_adjust_gc_speed(Long_val(v1) - h->bytes, HANDLE_GC_MAX);
+                h->bytes = Long_val(v1);
+        }
+        return Val_unit;
+}
+
+value glstub_handle_delete(value v0)
+{
+        char msg[256];
+        struct gl_handle *h = Handle_val(v0);
+        const char *missing;
+        if(!h->deleted)
+        {
+                missing = delete_object(h);
+                if(missing != NULL)
+                {
+                        snprintf(msg, sizeof(msg), "%s is not available", missing);
+                        failwith(msg);
+                }
+                h->deleted = 1;
+        }
+        return Val_unit;
+}
+
+value glstub_handle_collect(value unit)
+{
+        drain_deletions();
+        return Val_unit;
+}
+
+value glstub_handle_live(value v0)
+{
+        return Val_long(handle_live[Int_val(v0)]);
+}
+
+value glstub_handle_bytes(value v0)
+{
+        return Val_long(handle_bytes[Int_val(v0)]);
+}
+
+/*
+ * Render queue: draws are sorted by 64-bit keys made of pass (4 bits), program (12 bits), texture (12 bits),
+ * depth (16 bits) and submission index (20 bits), with a least significant digit radix sort that skips the bytes
+ * all keys share. The draws are an int32 Bigarray of pass, program, texture and depth for each draw; the keys
+ * Bigarray holds 2n keys, the second half being scratch space.
+ */
+#include <stdint.h>
+
+#define RENDER_QUEUE_MAX (1 << 20)
+
+static void radix_sort(uint64_t *keys, uint64_t *tmp, intnat n)
+{
+        intnat counts[8][256];
+        intnat i, sum, c;
+        uint64_t *src = keys, *dst = tmp, *t;
+        int d, b;
+        memset(counts, 0, sizeof(counts));
+        for(i = 0; i < n; i++)
+                for(d = 0; d < 8; d++) counts[d][(keys[i] >> (8 * d)) & 0xff]++;
+        for(d = 0; d < 8; d++)
+        {
+                if(counts[d][(keys[0] >> (8 * d)) & 0xff] == n) continue;
+                for(b = 0, sum = 0; b < 256; b++)
+                {
+                        c = counts[d][b];
+                        counts[d][b] = sum;
+                        sum += c;
+                }
+                for(i = 0; i < n; i++) dst[counts[d][(src[i] >> (8 * d)) & 0xff]++] = src[i];
+                t = src;
+                src = dst;
+                dst = t;
+        }
+        if(src != keys) memcpy(keys, src, n * sizeof(uint64_t));
+}
+
+value glstub_render_queue_sort(value v0, value v1, value v2, value v3)
+{
+        int32_t *draws = Data_bigarray_val(v0);
+        intnat i, n = Long_val(v1);
+        uint64_t *keys = Data_bigarray_val(v2);
+        int32_t *order = Data_bigarray_val(v3);
+        if(n < 0 || n > RENDER_QUEUE_MAX || Caml_ba_array_val(v0)->dim[0] < 4 * n ||
+           Caml_ba_array_val(v2)->dim[0] < 2 * n || Caml_ba_array_val(v3)->dim[0] < n)
+                invalid_argument("Render_queue.sort");
+        for(i = 0; i < n; i++)
+        {
+                int32_t *d = draws + 4 * i;
+                keys[i] = ((uint64_t)(d[0] & 0xf) << 60) | ((uint64_t)(d[1] & 0xfff) << 48) |
+                        ((uint64_t)(d[2] & 0xfff) << 36) | ((uint64_t)(d[3] & 0xffff) << 20) | (uint64_t)i;
+        }
+        if(n > 1) radix_sort(keys, keys + n, n);
+        for(i = 0; i < n; i++) order[i] = (int32_t)(keys[i] & (RENDER_QUEUE_MAX - 1));
+        return Val_unit;
+}
@@ -0,0 +1,161 @@
+
+(** GPU profiler.
+	[begin_scope p "shadows"] and [end_scope p] bracket a part of a frame whose GPU time is measured with timer
+	queries. Results are collected by [end_frame], called once per frame, which only reads the queries that have
+	completed, so it never waits for the GPU: a scope shows up in [report] a few frames after it was issued.
+	[report] gives, for every scope name, the number of samples and the minimum, average and maximum time in
+	milliseconds. With ARB_timer_query scopes may nest; with only EXT_timer_query a scope opened inside another
+	one is not measured. Without timer queries (e.g. on a software renderer) every function does nothing
+	and [report] stays empty; [available] tells which is the case. *)
+type scope = {
+	mutable count : int;
+	mutable total : float;
+	mutable min : float;
+	mutable max : float
+}
+
+type sample = {
+	name : string;
+	first : int;
+	last : int
+}
+
+type t = {
+	mutable support : int;
+	mutable free : int list;
+	mutable open_scopes : (string * int) list;
+	pending : sample Queue.t;
+	scopes : (string, scope) Hashtbl.t;
+	word : word_array;
+	dword : dword_array
+}
+
+(** Create a profiler. Nothing is asked of OpenGL until the first scope *)
+let create () = {
+	support = -1;
+	free = [];
+	open_scopes = [];
+	pending = Queue.create ();
+	scopes = Hashtbl.create 16;
+	word = make_word_array 1;
+	dword = make_dword_array 1
+}
+
+(* 0: no timer queries, 1: elapsed time queries only, 2: timestamps *)
+let support p =
+	if p.support < 0 then
+		p.support <-
+			if has_extension "GL_ARB_timer_query" then 2
+			else if has_extension "GL_EXT_timer_query" then 1
+			else 0;
+	p.support
+
+(** Test whether timer queries are available *)
+let available p = support p > 0
+
+(* Take a query object from the pool *)
+let query p =
+	if p.free = [] then begin
+		let a = Array.make 16 0 in
+		glGenQueries 16 a;
+		p.free <- Array.to_list a
+	end;
+	let q = List.hd p.free in
+	p.free <- List.tl p.free;
+	q
+
+(** Start measuring a scope *)
+let begin_scope p name =
+	match support p with
+	| 2 ->
+		let q = query p in
+		glQueryCounter q gl_timestamp;
+		p.open_scopes <- (name, q) :: p.open_scopes
+	| 1 when p.open_scopes = [] ->
+		let q = query p in
+		glBeginQuery gl_time_elapsed_ext q;
+		p.open_scopes <- [(name, q)]
+	| 1 -> p.open_scopes <- (name, -1) :: p.open_scopes
+	| _ -> ()
+
+(** Stop measuring the innermost scope *)
+let end_scope p =
+	match p.open_scopes with
+	| [] -> if support p > 0 then invalid_argument "Gpu_profiler.end_scope: no scope is open"
+	| (name, q) :: rest ->
+		p.open_scopes <- rest;
+		if q >= 0 then
+			if p.support = 2 then begin
+				let q' = query p in
+				glQueryCounter q' gl_timestamp;
+				Queue.add { name = name; first = q; last = q' } p.pending
+			end else begin
+				glEndQuery gl_time_elapsed_ext;
+				Queue.add { name = name; first = q; last = -1 } p.pending
+			end
+
+(** Measure the GPU time of f () as a scope *)
+let scope p name f =
+	begin_scope p name;
+	let r = (try f () with e -> end_scope p; raise e) in
+	end_scope p;
+	r
+
+let result_available p q =
+	Direct.glGetQueryObjectiv q gl_query_result_available p.word;
+	p.word.{0} <> 0l
+
+let result p q =
+	if p.support = 2 then
+		Direct.glGetQueryObjectui64v q gl_query_result p.dword
+	else
+		Direct.glGetQueryObjectui64vEXT q gl_query_result p.dword;
+	Int64.to_float p.dword.{0}
+
+let record p name ns =
+	let ms = ns /. 1e6 in
+	let s =
+		try Hashtbl.find p.scopes name with Not_found ->
+			let s = { count = 0; total = 0.; min = infinity; max = 0. } in
+			Hashtbl.add p.scopes name s;
+			s
+	in
+	s.count <- s.count + 1;
+	s.total <- s.total +. ms;
+	if ms < s.min then s.min <- ms;
+	if ms > s.max then s.max <- ms
+
+(** Collect the results of all completed scopes, without waiting for the others *)
+let end_frame p =
+	let rec collect () =
+		if not (Queue.is_empty p.pending) then begin
+			let s = Queue.peek p.pending in
+			if result_available p (if s.last >= 0 then s.last else s.first) then begin
+				ignore (Queue.pop p.pending);
+				if s.last >= 0 then begin
+					record p s.name (result p s.last -. result p s.first);
+					p.free <- s.last :: p.free
+				end else
+					record p s.name (result p s.first);
+				p.free <- s.first :: p.free;
+				collect ()
+			end
+		end
+	in
+	collect ()
+
+(** Statistics of every scope: name, number of samples, and minimum, average and maximum milliseconds *)
+let report p =
+	List.sort compare
+		(Hashtbl.fold (fun name s l -> (name, s.count, s.min, s.total /. float_of_int s.count, s.max) :: l) p.scopes [])
+
+(** Forget the statistics collected so far *)
+let reset p = Hashtbl.clear p.scopes
+
+(** Delete the query objects of p *)
+let destroy p =
+	Queue.iter (fun s -> p.free <- s.first :: (if s.last >= 0 then s.last :: p.free else p.free)) p.pending;
+	Queue.clear p.pending;
+	glDeleteQueries (List.length p.free) (Array.of_list p.free);
+	p.free <- []
+
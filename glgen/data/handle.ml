@@ -0,0 +1,66 @@
+
+(** Garbage-collected object handles.
+	A handle owns the name of a texture, buffer, program or other GL object, and deletes it when the handle is
+	collected: the finalizer queues the name, and the queue is emptied by [collect], which this module registers
+	with the Ocaml runtime so that [Win.swap_buffers] and [Sdl.swap_buffers] call it after every swap, on the
+	thread that owns the context. Programs that swap buffers some other way must call [collect] once per frame.
+	[delete] deletes an object at once. Each handle carries an estimated size in bytes, given when it is created
+	and updated with [set_bytes] after allocating storage; both are reported to the GC, so that handles of large
+	objects are collected sooner. [live] and [bytes] count the objects of each kind that have not been deleted
+	yet, including those whose deletion function is missing: [delete] raises [Failure] for them, and [check_error]
+	does for the ones [collect] could not delete. *)
+type t
+
+(** Object kinds, in the order glcaml_stub.c expects them *)
+type kind =
+	| Texture
+	| Buffer
+	| Renderbuffer
+	| Framebuffer
+	| Program
+	| Shader
+	| Vertex_array
+	| Query
+	| Sampler
+
+(** [wrap kind name bytes] takes ownership of an existing object *)
+external wrap : kind -> int -> int -> t = "glstub_handle_wrap"
+
+(** The name of the object; raises [Invalid_argument] once it has been deleted *)
+external name : t -> int = "glstub_handle_name"
+
+(** Set the estimated size of the object, e.g. after [glBufferData] or [glTexImage2D] *)
+external set_bytes : t -> int -> unit = "glstub_handle_set_bytes"
+
+(** Delete the object now *)
+external delete : t -> unit = "glstub_handle_delete"
+
+(** Delete the objects of the handles collected so far. The context must be current *)
+external collect : unit -> unit = "glstub_handle_collect"
+let _ = Callback.register "Glcaml.Handle.collect" collect
+
+(** Number and estimated bytes of the objects of a kind that have not been deleted *)
+external live : kind -> int = "glstub_handle_live"
+external bytes : kind -> int = "glstub_handle_bytes"
+
+let kinds = [Texture; Buffer; Renderbuffer; Framebuffer; Program; Shader; Vertex_array; Query; Sampler]
+
+(** Live count and estimated bytes of every kind *)
+let stats () = List.map (fun k -> (k, live k, bytes k)) kinds
+
+let gen kind f bytes =
+	let a = [| 0 |] in
+	f 1 a;
+	wrap kind a.(0) bytes
+
+(** Create an object of each kind, with an optional size estimate *)
+let texture ?(bytes = 0) () = gen Texture glGenTextures bytes
+let buffer ?(bytes = 0) () = gen Buffer glGenBuffers bytes
+let renderbuffer ?(bytes = 0) () = gen Renderbuffer glGenRenderbuffers bytes
+let framebuffer () = gen Framebuffer glGenFramebuffers 0
+let vertex_array () = gen Vertex_array glGenVertexArrays 0
+let query () = gen Query glGenQueries 0
+let sampler () = gen Sampler glGenSamplers 0
+let program () = wrap Program (glCreateProgram ()) 0
+let shader kind = wrap Shader (glCreateShader kind) 0
+
@@ -27,6 +27,8 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdarg.h>
+#include <math.h>
 
 #include <caml/mlvalues.h>
 #include <caml/memory.h>
@@ -34,14 +36,17 @@
 #include <caml/fail.h>
 #include <caml/callback.h>
 #include <caml/bigarray.h>
+#include <caml/custom.h>
+#include <caml/signals.h>
 
-#include <GL/glew.h>
+#include <stdlib.h>
+#include <stddef.h>
 
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
 typedef unsigned int GLbitfield;
 typedef void GLvoid;
-//typedef char GLbyte;
+typedef signed char GLbyte;
 typedef short GLshort;
 typedef int GLint;
 typedef unsigned char GLubyte;
@@ -56,22 +61,33 @@ typedef char GLchar;
 typedef ptrdiff_t GLsizeiptr;
 typedef ptrdiff_t GLintptr;
 typedef char* GLstring;
+typedef long long GLint64;
+typedef unsigned long long GLuint64;
+typedef long long GLint64EXT;
+typedef unsigned long long GLuint64EXT;
+typedef struct __GLsync *GLsync;
 
 #ifdef _WIN32
 #include <windows.h>
 
+#define GL_LIBRARY "opengl32.dll"
+
 static HMODULE lib=NULL;
 
-static void init_lib()
+static int init_lib()
 {
-        if(lib)return;
-        lib = LoadLibrary("opengl32.dll");
-        if(lib == NULL) failwith("error loading opengl32.dll");
+        if(lib)return 1;
+        lib = LoadLibrary(GL_LIBRARY);
+        return lib != NULL;
 }
 
 static void *get_proc_address(char *fname)
 {
-        return GetProcAddress(lib, fname);
+        /* wglGetProcAddress only knows about functions beyond OpenGL 1.1 */
+        void *f = (void *)wglGetProcAddress(fname);
+        if(f == NULL || f == (void *)1 || f == (void *)2 || f == (void *)3 || f == (void *)-1)
+                f = (void *)GetProcAddress(lib, fname);
+        return f;
 }
 
 #endif
@@ -83,18 +99,26 @@ static void *get_proc_address(char *fname)
 #include <dlfcn.h>
 #include <stdio.h>
 
+#define GL_LIBRARY "libGL.so.1"
+
 static void* lib=NULL;
+static void *(*glx_get_proc_address)(const GLubyte *)=NULL;
 
-static void init_lib()
+static int init_lib()
 {
-        if(lib)return;
-        lib = dlopen("libGL.so.1",RTLD_LAZY);
-        if(lib == NULL) failwith("error loading libGL.so.1");
+        if(lib)return 1;
+        lib = dlopen(GL_LIBRARY,RTLD_LAZY);
+        if(lib == NULL) return 0;
+        glx_get_proc_address = (void *(*)(const GLubyte *))dlsym(lib, "glXGetProcAddressARB");
+        return 1;
 }
 
 static void *get_proc_address(char *fname)
 {
-        return dlsym(lib, fname);
+        void *f = NULL;
+        if(glx_get_proc_address) f = glx_get_proc_address((const GLubyte *)fname);
+        if(f == NULL) f = dlsym(lib, fname);
+        return f;
 }
 
 #endif
@@ -106,14 +130,16 @@ static void *get_proc_address(char *fname)
 #include <dlfcn.h>
 #include <stdio.h>
 
+#define GL_LIBRARY "libGL.dylib"
+
 static void* lib=NULL;
 
-static void init_lib()
+static int init_lib()
 {
-        if(lib)return;
-        lib = dlopen("libGL.dylib",RTLD_LAZY);
+        if(lib)return 1;
+        lib = dlopen(GL_LIBRARY,RTLD_LAZY);
         if(lib == NULL) lib = dlopen("/System/Library/Frameworks/OpenGL.framework/Libraries/libGL.dylib", RTLD_LAZY);
-        if(lib == NULL) failwith("error loading libGL.dylib");
+        return lib != NULL;
 }
 
 static void *get_proc_address(char *fname)
@@ -122,6 +148,365 @@ static void *get_proc_address(char *fname)
 }
 #endif
 
+/*
+ * Every GL function is called through a pointer which is resolved the first time the function is called,
+ * so only the entry points a program actually uses are ever looked up.
+ * Entry points that are not available are marked with the address of missing_function, so that they are
+ * looked up only once by the [@@noalloc] stubs. Those cannot raise: they skip the call and keep the name of
+ * the first such function in missing_name, for which check_error raises Failure. Other stubs leave it alone,
+ * so that the failure is not blamed on an unrelated call.
+ */
+static char missing_function;
+static const char *missing_name = NULL;
+
+/*
+ * Call statistics: when compiled with GLCAML_PROFILE, every stub counts its calls and the time spent in it,
+ * including the conversion of its arguments. The clock is monotonic, in seconds, and is also available to Ocaml.
+ */
+struct glstub_stat
+{
+        intnat calls;
+        double time;
+};
+
+#ifdef _WIN32
+static double profile_clock()
+{
+        static LARGE_INTEGER freq;
+        LARGE_INTEGER t;
+        if(freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&t);
+        return (double)t.QuadPart / (double)freq.QuadPart;
+}
+#else
+#include <time.h>
+static double profile_clock()
+{
+        struct timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return t.tv_sec + t.tv_nsec * 1e-9;
+}
+#endif
+
+value glstub_monotonic_clock(value unit)
+{
+        return caml_copy_double(profile_clock());
+}
+
+#ifdef GLCAML_PROFILE
+#define PROFILE_BEGIN(func) double profile_start = profile_clock();
+#define PROFILE_END(func) stat_##func.calls++; stat_##func.time += profile_clock() - profile_start;
+#else
+#define PROFILE_BEGIN(func)
+#define PROFILE_END(func)
+#endif
+
+#define DECLARE_FUNCTION(func, args, ret) \
+typedef ret (APIENTRY *pfn##func)args; \
+static pfn##func stub_##func = NULL; \
+static struct glstub_stat stat_##func
+
+#define LOAD_FUNCTION(func) \
+        if(stub_##func == NULL || (void *)stub_##func == (void *)&missing_function) \
+                stub_##func = (pfn##func)load_function(#func)
+
+#define LOAD_FUNCTION_NOALLOC(func, fail) \
+        if(stub_##func == NULL) stub_##func = (pfn##func)try_load_function(#func); \
+        if((void *)stub_##func == (void *)&missing_function) \
+        { \
+                if(missing_name == NULL) missing_name = #func; \
+                return fail; \
+        }
+
+static void *try_load_function(char *fname)
+{
+        void *f = NULL;
+        if(init_lib()) f = get_proc_address(fname);
+        return f ? f : (void *)&missing_function;
+}
+
+static void *load_function(char *fname)
+{
+        char msg[256];
+        void *f;
+        if(!init_lib()) failwith("error loading " GL_LIBRARY);
+        f = get_proc_address(fname);
+        if(f == NULL)
+        {
+                snprintf(msg, sizeof(msg), "%s is not available", fname);
+                failwith(msg);
+        }
+        return f;
+}
+
+/* Raise Failure for the first function a [@@noalloc] stub or a handle deletion could not call */
+static void raise_missing_function()
+{
+        char msg[256];
+        snprintf(msg, sizeof(msg), "%s is not available", missing_name);
+        missing_name = NULL;
+        failwith(msg);
+}
+
+struct glstub_entry
+{
+        const char *name;
+        void **slot;
+        struct glstub_stat *stat;
+};
+
+static int compare_entry(const void *name, const void *entry)
+{
+        return strcmp((const char *)name, ((const struct glstub_entry *)entry)->name);
+}
+
+/* Resolve the named function now, raising an exception if it is unknown or not available */
+static void preload_function(struct glstub_entry *entries, size_t n, char *fname)
+{
+        char msg[256];
+        struct glstub_entry *e = bsearch(fname, entries, n, sizeof(struct glstub_entry), compare_entry);
+        if(e == NULL)
+        {
+                snprintf(msg, sizeof(msg), "Glcaml.preload: unknown function %s", fname);
+                invalid_argument(msg);
+        }
+        if(*e->slot == NULL || *e->slot == (void *)&missing_function) *e->slot = load_function(fname);
+}
+
+/*
+ * The gl*Pointer functions keep the address of their array, and OpenGL reads it when drawing, after the call
+ * has returned. A string may have been moved by the GC by then, and a Bigarray allocated by Ocaml freed, so only
+ * offsets into a bound buffer object (ints) and Bigarrays whose memory the GC does not own, such as Arena slices,
+ * are accepted.
+ */
+static GLvoid *retained_pointer(value v, char *fname)
+{
+        char msg[256];
+        if(Is_long(v)) return (GLvoid *)Long_val(v);
+        if(Tag_val(v) != Custom_tag || strcmp(Custom_ops_val(v)->identifier, "_bigarray") != 0 ||
+                (Caml_ba_array_val(v)->flags & CAML_BA_MANAGED_MASK) != CAML_BA_EXTERNAL)
+        {
+                snprintf(msg, sizeof(msg), "%s: client arrays must be Arena slices or buffer offsets", fname);
+                invalid_argument(msg);
+        }
+        return Data_bigarray_val(v);
+}
+
+/*
+ * Sync objects are custom blocks holding the GLsync, so that Ocaml can compare and hash them but not forge them.
+ * Collecting a block does not delete its sync object, since glDeleteSync needs the context to be current.
+ */
+#define Sync_val(v) (*((GLsync *)Data_custom_val(v)))
+
+static int compare_sync(value v1, value v2)
+{
+        uintnat a = (uintnat)Sync_val(v1), b = (uintnat)Sync_val(v2);
+        return a < b ? -1 : a > b ? 1 : 0;
+}
+
+static intnat hash_sync(value v)
+{
+        return (intnat)(uintnat)Sync_val(v);
+}
+
+static struct custom_operations sync_ops = {
+        "glcaml.sync",
+        custom_finalize_default,
+        compare_sync,
+        hash_sync,
+        custom_serialize_default,
+        custom_deserialize_default
+};
+
+static value alloc_sync(GLsync sync)
+{
+        value v = caml_alloc_custom(&sync_ops, sizeof(GLsync), 0, 1);
+        Sync_val(v) = sync;
+        return v;
+}
+
+/* GLstring results: glGetString returns NULL for names that are invalid in the current context, such as
+ * GL_EXTENSIONS in a core profile, which is returned as an empty string */
+static value copy_gl_string(GLstring s)
+{
+        return caml_copy_string(s == NULL ? "" : s);
+}
+
+/*
+ * GLchar** arguments point into the Ocaml strings of a string array. The array of pointers, and the array of
+ * lengths next to it, are scratch space reused from call to call, so that no string is copied or measured with
+ * strlen. Strings do not move during the call, since nothing is allocated in the Ocaml heap until it returns.
+ */
+static GLchar **string_scratch = NULL;
+static GLint *length_scratch = NULL;
+static mlsize_t scratch_size = 0;
+
+static GLchar **string_array(value v)
+{
+        mlsize_t i, n = Wosize_val(v);
+        if(n > scratch_size)
+        {
+                mlsize_t size = n < 2 * scratch_size ? 2 * scratch_size : n;
+                GLchar **strings = realloc(string_scratch, size * sizeof(GLchar *));
+                GLint *lengths;
+                if(strings == NULL) caml_raise_out_of_memory();
+                string_scratch = strings;
+                lengths = realloc(length_scratch, size * sizeof(GLint));
+                if(lengths == NULL) caml_raise_out_of_memory();
+                length_scratch = lengths;
+                scratch_size = size;
+        }
+        for(i = 0; i < n; i++)
+        {
+                string_scratch[i] = (GLchar *)String_val(Field(v, i));
+                length_scratch[i] = caml_string_length(Field(v, i));
+        }
+        return string_scratch;
+}
+
+/*
+ * GL errors are raised as Gl_error (message, code). The [@@noalloc] stubs cannot raise: in checked builds they
+ * keep the first error they see, with its message, until the next boxed stub or check_error raises it.
+ * glGetError may not be called between glBegin and glEnd, so errors are not polled there.
+ */
+static char pending_error[256];
+static GLenum pending_code = 0;
+static int in_begin = 0;
+static GLenum (APIENTRY *get_error_function)(void) = NULL;
+
+static void raise_gl_error(char *msg, GLenum code)
+{
+        value args[2];
+        const value *exn = caml_named_value("Glcaml.Gl_error");
+        if(exn == NULL) failwith(msg);
+        args[1] = Val_int(code);
+        args[0] = caml_copy_string(msg);
+        caml_raise_with_args(*exn, 2, args);
+}
+
+static const char *gl_error_name(GLenum code)
+{
+        switch(code)
+        {
+                case 0x0500: return "GL_INVALID_ENUM";
+                case 0x0501: return "GL_INVALID_VALUE";
+                case 0x0502: return "GL_INVALID_OPERATION";
+                case 0x0503: return "GL_STACK_OVERFLOW";
+                case 0x0504: return "GL_STACK_UNDERFLOW";
+                case 0x0505: return "GL_OUT_OF_MEMORY";
+                case 0x0506: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+                default: return "GL error";
+        }
+}
+
+static GLenum get_error()
+{
+        if(get_error_function == NULL)
+                get_error_function = (GLenum (APIENTRY *)(void))try_load_function("glGetError");
+        if((void *)get_error_function == (void *)&missing_function) return 0;
+        return (*get_error_function)();
+}
+
+static void raise_pending_error()
+{
+        char msg[256];
+        GLenum code = pending_code;
+        pending_code = 0;
+        strcpy(msg, pending_error);
+        raise_gl_error(msg, code);
+}
+
+/* Raise the error kept by a [@@noalloc] stub, or the one OpenGL reports now */
+value glstub_check_error(value unit)
+{
+        GLenum code;
+        if(missing_name) raise_missing_function();
+        if(pending_code) raise_pending_error();
+        if(in_begin) return Val_unit;
+        code = get_error();
+        if(code) raise_gl_error((char *)gl_error_name(code), code);
+        return Val_unit;
+}
+
+#ifdef GLCAML_CHECKED
+/* Poll glGetError after fname, except between glBegin and glEnd */
+static GLenum poll_error(const char *fname)
+{
+        if(strcmp(fname, "glBegin") == 0)
+        {
+                in_begin = 1;
+                return 0;
+        }
+        if(strcmp(fname, "glEnd") == 0) in_begin = 0;
+        return in_begin ? 0 : get_error();
+}
+
+static void format_error(char *buf, size_t n, GLenum code, const char *fname, const char *fmt, va_list args)
+{
+        int k = snprintf(buf, n, "%s in %s", gl_error_name(code), fname);
+        if(k > 0 && (size_t)k < n) vsnprintf(buf + k, n - k, fmt, args);
+}
+
+/* Called by the boxed stubs after the GL call: fmt and the arguments describe the call */
+static void check_error(const char *fname, const char *fmt, ...)
+{
+        char msg[256];
+        va_list args;
+        GLenum code;
+        if(pending_code) raise_pending_error();
+        code = poll_error(fname);
+        if(code == 0) return;
+        va_start(args, fmt);
+        format_error(msg, sizeof(msg), code, fname, fmt, args);
+        va_end(args);
+        raise_gl_error(msg, code);
+}
+
+/* Called by the [@@noalloc] stubs, which keep the error for later */
+static void latch_error(const char *fname, const char *fmt, ...)
+{
+        va_list args;
+        GLenum code = poll_error(fname);
+        if(code == 0 || pending_code) return;
+        va_start(args, fmt);
+        format_error(pending_error, sizeof(pending_error), code, fname, fmt, args);
+        va_end(args);
+        pending_code = code;
+}
+
+/* Length of an array argument, in elements or in bytes; -1 for buffer offsets and unknown values */
+static intnat array_length(value v, int bytes)
+{
+        struct caml_ba_array *b;
+        intnat n;
+        int i;
+        if(Is_long(v)) return -1;
+        if(Tag_val(v) == String_tag) return caml_string_length(v);
+        if(Tag_val(v) == Double_array_tag)
+        {
+                n = Wosize_val(v) / Double_wosize;
+                return bytes ? n * sizeof(double) : n;
+        }
+        if(Tag_val(v) != Custom_tag || strcmp(Custom_ops_val(v)->identifier, "_bigarray") != 0) return -1;
+        b = Caml_ba_array_val(v);
+        n = 1;
+        for(i = 0; i < b->num_dims; i++) n *= b->dim[i];
+        return bytes ? n * caml_ba_element_size[b->flags & CAML_BA_KIND_MASK] : n;
+}
+
+/* Raise Invalid_argument if the array v is shorter than the n elements (or bytes) fname reads or writes */
+static void check_length(const char *fname, value v, intnat n, int bytes)
+{
+        char msg[256];
+        intnat l = array_length(v, bytes);
+        if(l >= 0 && l < n)
+        {
+                snprintf(msg, sizeof(msg), "%s: array of %ld %s, %ld needed", fname, (long)l, bytes ? "bytes" : "elements", (long)n);
+                invalid_argument(msg);
+        }
+}
+#endif
+
 value unsafe_coercion(value v)
 {
         CAMLparam1(v);
@@ -66,6 +66,9 @@ type int_matrix = (int, Bigarray.int_elt, Bigarray.c_layout) Bigarray.Array2.t
 type float_matrix = (float, Bigarray.float32_elt, Bigarray.c_layout) Bigarray.Array2.t
 type double_matrix = (float, Bigarray.float64_elt, Bigarray.c_layout) Bigarray.Array2.t
 
+(** Sync objects, as returned by [glFenceSync] *)
+type sync
+
 (** Create 1-dimensional arrays of the following types:
 	- 8-bit signed bytes
 	- 8-bit unsigned bytes
@@ -175,5 +178,32 @@ let int_to_bool_array i = Array.map bool_of_int i
 let copy_to_bool_array src dst = 
 	Array.mapi (fun i c -> dst.(i) <-  bool_of_int src.(i)) dst
 
+(** Resolve the named OpenGL functions now instead of on their first call.
+	Raises [Failure] if one of them is not provided by the OpenGL implementation,
+	and [Invalid_argument] if it is not a GLCaml function. *)
+external preload : string list -> unit = "glstub_preload"
+
+(** OpenGL functions are resolved lazily, so there is nothing to initialise any more.
+	Kept for compatibility with the GLEW-based versions of GLCaml; always returns 0 (GLEW_OK). *)
+let glewInit () = 0
+
+(** Raised with the name and the code of an OpenGL error. In checked builds the message also names the
+	function that set the error and its arguments. *)
+exception Gl_error of string * int
+let _ = Callback.register_exception "Glcaml.Gl_error" (Gl_error ("", 0))
+
+(** Raise [Gl_error] if OpenGL reports an error, or if a [@@noalloc] binding saw one in a checked build.
+	Raise [Failure] if a [@@noalloc] binding or [Handle.collect] found its OpenGL function missing. *)
+external check_error : unit -> unit = "glstub_check_error"
+
+(** Set the source of a shader to the concatenation of the strings, as [glShaderSource shader (Array.length strings)
+	strings lengths] does, but without converting any array: the lengths are those of the strings. *)
+external shader_source : int -> string array -> unit = "glstub_shader_source"
+
+(** [compile_shaders shaders sources] sets the source of each shader [shaders.(i)] to the strings [sources.(i)] and
+	compiles it, in a single call, e.g. to compile the permutations of a shader built from different prefixes.
+	Compile status and info logs are queried as usual. *)
+external compile_shaders : int array -> string array array -> unit = "glstub_compile_shaders"
+
 
 
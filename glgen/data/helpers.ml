@@ -0,0 +1,47 @@
+
+(* Helpers built on the bindings above, shared by the modules below *)
+
+(** Seconds elapsed on a monotonic clock, from an unspecified origin *)
+external monotonic_clock : unit -> float = "glstub_monotonic_clock"
+
+(** Major version of the OpenGL context, from [glGetString gl_version]; 0 if it can not be read *)
+let gl_major_version () =
+	let v = glGetString gl_version in
+	let rec digits i n =
+		if i < String.length v && v.[i] >= '0' && v.[i] <= '9' then digits (i + 1) (10 * n + Char.code v.[i] - 48) else n
+	in
+	digits 0 0
+
+(** Test whether the current context advertises an extension. OpenGL 3 and later contexts are asked for each
+	extension with [glGetStringi], since core profiles do not return the list through [glGetString]. *)
+let has_extension name =
+	if gl_major_version () >= 3 then begin
+		let n = [| 0 |] in
+		glGetIntegerv gl_num_extensions n;
+		let rec find i = i < n.(0) && (glGetStringi gl_extensions i = name || find (i + 1)) in
+		find 0
+	end else begin
+		let exts = glGetString gl_extensions in
+		let n = String.length name and l = String.length exts in
+		let rec at i =
+			(i + n <= l) &&
+			(((i = 0 || exts.[i - 1] = ' ') && String.sub exts i n = name && (i + n = l || exts.[i + n] = ' ')) || at (i + 1))
+		in
+		at 0
+	end
+
+(** [status get o pname] tests a boolean parameter of a shader or program, e.g.
+	[status glGetShaderiv s gl_compile_status] *)
+let status get o pname =
+	let a = [| 0 |] in
+	get o pname a;
+	a.(0) <> 0
+
+(** [info_log get get_log o] is the info log of a shader or program, e.g.
+	[info_log glGetProgramiv glGetProgramInfoLog p] *)
+let info_log get get_log o =
+	let n = [| 0 |] in
+	get o gl_info_log_length n;
+	let len = [| 0 |] and s = String.make (max n.(0) 1) ' ' in
+	get_log o (String.length s) len s;
+	String.sub s 0 len.(0)
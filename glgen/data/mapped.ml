@@ -0,0 +1,58 @@
+
+(** Mapped buffer objects.
+	[glMapBuffer target access kind] maps the buffer bound to target and returns a Bigarray of the given kind
+	that aliases the mapping: [Mapped.glMapBuffer gl_array_buffer gl_write_only Bigarray.float32] is a
+	[float_array] covering the whole buffer, and values stored in it go straight into the buffer, without the
+	intermediate copy of [glBufferData]. [glMapBufferRange] maps part of a buffer (offset and length in bytes).
+	A view is valid until the buffer is unmapped with [glUnmapBuffer] from this module, which shrinks every view
+	of that buffer to length 0 so that further accesses raise [Invalid_argument] instead of touching unmapped memory.
+	Views are tracked per buffer object, found through the binding of the target; for a target whose binding is
+	not known here, they are tracked per target. Sub-arrays of a view are not tracked and must not be used after
+	unmapping, nor may [unsafe_get]/[unsafe_set]. *)
+external map_buffer : int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_map_buffer"
+external map_buffer_range : int -> int -> int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_map_buffer_range"
+external unmap_view : ('a, 'b, 'c) Bigarray.Array1.t -> unit = "glstub_unmap_view"
+
+(* Invalidation functions of the views of every mapped buffer, by buffer name (or minus the target) *)
+let views : (int, unit -> unit) Hashtbl.t = Hashtbl.create 4
+
+(* Buffer targets and the parameters that query their bindings *)
+let bindings = [
+	(gl_array_buffer, gl_array_buffer_binding);
+	(gl_element_array_buffer, gl_element_array_buffer_binding);
+	(gl_pixel_pack_buffer, gl_pixel_pack_buffer_binding);
+	(gl_pixel_unpack_buffer, gl_pixel_unpack_buffer_binding);
+	(gl_copy_read_buffer, gl_copy_read_buffer);
+	(gl_copy_write_buffer, gl_copy_write_buffer);
+	(gl_texture_buffer, gl_texture_buffer);
+	(gl_transform_feedback_buffer_nv, gl_transform_feedback_buffer_binding_nv);
+	(gl_draw_indirect_buffer, gl_draw_indirect_buffer_binding);
+	(gl_uniform_buffer, gl_uniform_buffer_binding);
+	(gl_shader_storage_buffer, gl_shader_storage_buffer_binding);
+	(gl_atomic_counter_buffer, gl_atomic_counter_buffer_binding);
+	(gl_dispatch_indirect_buffer, gl_dispatch_indirect_buffer_binding);
+	(gl_query_buffer, gl_query_buffer_binding)
+]
+
+let buffer target =
+	match (try Some (List.assoc target bindings) with Not_found -> None) with
+	| Some pname ->
+		let a = [| 0 |] in
+		glGetIntegerv pname a;
+		a.(0)
+	| None -> - target
+
+let track target a =
+	Hashtbl.add views (buffer target) (fun () -> unmap_view a);
+	a
+
+let glMapBuffer target access kind = track target (map_buffer target access kind)
+let glMapBufferRange target offset length access kind = track target (map_buffer_range target offset length access kind)
+
+(** Unmap the buffer bound to target and invalidate its views *)
+let glUnmapBuffer target =
+	let b = buffer target in
+	List.iter (fun f -> f ()) (Hashtbl.find_all views b);
+	while Hashtbl.mem views b do Hashtbl.remove views b done;
+	glUnmapBuffer target
+
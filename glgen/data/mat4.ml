@@ -0,0 +1,130 @@
+
+(** 4x4 matrices.
+	A matrix is a [float_array] of 16 single-precision floats in column-major order, which is what
+	[Direct.glUniformMatrix4fv] and [Direct.glLoadMatrixf] take, so it reaches OpenGL without any conversion.
+	Products, inversion, projections and the batch operations are computed in C, using SSE or NEON when the C
+	compiler targets them; every function writes its result into a matrix given as first argument and allocates
+	nothing. Angles are in degrees, as for [glRotatef] and [gluPerspective].
+	A [stack] replaces the fixed-function matrix stack: [push], [pop], [translate], [rotate]... act on its top
+	matrix, and [top s] can be passed directly to [uniform] or [Direct.glUniformMatrix4fv].
+	Batches of n matrices are [float_matrix]es of n rows of 16 floats. *)
+type t = float_array
+
+(** [mul r a b] sets r to the product a * b; r may be a or b *)
+external mul : t -> t -> t -> unit = "glstub_mat4_mul"
+
+(** [invert r a] sets r to the inverse of a, or returns false and leaves r unchanged if a is singular *)
+external invert : t -> t -> bool = "glstub_mat4_invert"
+
+(** [perspective m fovy aspect znear zfar] sets m to a perspective projection *)
+external perspective : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+	= "glstub_mat4_perspective" "glstub_mat4_perspective_nat"
+
+(** [ortho m left right bottom top znear zfar] sets m to an orthographic projection *)
+external ortho : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) ->
+	(float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_mat4_ortho_byte" "glstub_mat4_ortho_nat"
+
+(** [look_at m eyex eyey eyez centerx centery centerz upx upy upz] sets m to a viewing transformation *)
+external look_at : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) ->
+	(float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+	= "glstub_mat4_look_at_byte" "glstub_mat4_look_at_nat"
+
+(** [mul_batch dst m src n] sets the first n rows of dst to m times the rows of src *)
+external mul_batch : float_matrix -> t -> float_matrix -> int -> unit = "glstub_mat4_mul_batch"
+
+(** [transform_points dst m src n] transforms the n points (x, y, z, w) packed in src into dst *)
+external transform_points : float_array -> t -> float_array -> int -> unit = "glstub_mat4_transform_points"
+
+(** Set m to the identity *)
+let identity (m : t) =
+	Bigarray.Array1.fill m 0.;
+	m.{0} <- 1.; m.{5} <- 1.; m.{10} <- 1.; m.{15} <- 1.
+
+(** A new identity matrix *)
+let create () =
+	let m = make_float_array 16 in
+	identity m;
+	m
+
+(** Copy src into dst *)
+let copy (dst : t) (src : t) = Bigarray.Array1.blit src dst
+
+(** Set m to its transpose *)
+let transpose (m : t) =
+	for i = 0 to 3 do
+		for j = i + 1 to 3 do
+			let x = m.{4 * i + j} in
+			m.{4 * i + j} <- m.{4 * j + i};
+			m.{4 * j + i} <- x
+		done
+	done
+
+(** Set m to a translation *)
+let translation m x y z =
+	identity m;
+	m.{12} <- x; m.{13} <- y; m.{14} <- z
+
+(** Set m to a scaling *)
+let scaling m x y z =
+	identity m;
+	m.{0} <- x; m.{5} <- y; m.{10} <- z
+
+(** Set m to a rotation of angle degrees around the axis (x, y, z), as glRotatef *)
+let rotation m angle x y z =
+	let l = sqrt (x *. x +. y *. y +. z *. z) in
+	let x, y, z = if l > 0. then x /. l, y /. l, z /. l else 0., 0., 1. in
+	let a = angle *. 3.14159265358979323846 /. 180. in
+	let c = cos a and s = sin a in
+	let d = 1. -. c in
+	identity m;
+	m.{0} <- x *. x *. d +. c;
+	m.{1} <- y *. x *. d +. z *. s;
+	m.{2} <- x *. z *. d -. y *. s;
+	m.{4} <- x *. y *. d -. z *. s;
+	m.{5} <- y *. y *. d +. c;
+	m.{6} <- y *. z *. d +. x *. s;
+	m.{8} <- x *. z *. d +. y *. s;
+	m.{9} <- y *. z *. d -. x *. s;
+	m.{10} <- z *. z *. d +. c
+
+(** Pass m to the uniform at location loc of the current program *)
+let uniform loc (m : t) = Direct.glUniformMatrix4fv loc 1 false m
+
+(** Replace the current fixed-function matrix with m *)
+let load (m : t) = Direct.glLoadMatrixf m
+
+type stack = {
+	mutable depth : int;
+	levels : t array;
+	scratch : t
+}
+
+(** A matrix stack of at most n levels, holding the identity *)
+let stack n = { depth = 0; levels = Array.init (max n 1) (fun _ -> create ()); scratch = create () }
+
+(** The matrix on top of s; it changes with every operation on s *)
+let top s = s.levels.(s.depth)
+
+(** Push a copy of the top matrix *)
+let push s =
+	if s.depth + 1 >= Array.length s.levels then invalid_argument "Mat4.push: stack overflow";
+	copy s.levels.(s.depth + 1) (top s);
+	s.depth <- s.depth + 1
+
+(** Pop the top matrix *)
+let pop s =
+	if s.depth = 0 then invalid_argument "Mat4.pop: stack underflow";
+	s.depth <- s.depth - 1
+
+(** Replace the top matrix with the identity or with m *)
+let load_identity s = identity (top s)
+let load_matrix s m = copy (top s) m
+
+(** Multiply the top matrix by m on the right, as glMultMatrixf *)
+let mult s m = mul (top s) (top s) m
+
+(** Multiply the top matrix by a translation, a scaling or a rotation, as glTranslatef, glScalef and glRotatef *)
+let translate s x y z = translation s.scratch x y z; mult s s.scratch
+let scale s x y z = scaling s.scratch x y z; mult s s.scratch
+let rotate s angle x y z = rotation s.scratch angle x y z; mult s s.scratch
+
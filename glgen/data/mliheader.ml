@@ -73,22 +73,131 @@ The parameters are translated according to the following table:
 - GLboolean** 	-> word_matrix
 - GLsizei*   	-> int array
 - GLenum*    	-> int array
+- GLint64*   	-> int array
+- GLuint64*   	-> int array
+- GLint64    	-> int
+- GLuint64    	-> int
+- GLsync    	-> sync
 
 
+The OpenGL 3.x and 4.x entry points for instancing, base vertices, multi-draw, indirect draws, sync objects and
+samplers are included. Sync objects returned by [glFenceSync] have the abstract type [sync], and [GLuint64] timeouts
+are ints counting nanoseconds. The [indirect] argument of [glDrawArraysIndirect], [glMultiDrawElementsIndirect] and
+the like is a byte offset into the buffer bound to [gl_draw_indirect_buffer], so these functions only take scalars.
+
 Void pointers are represented by the polymorphic type ['a], but in the FFI only strings, Bigarrays, or foreign-function interface bindings to C arrays 
 are actually processed properly (such as [SDLCaml.surface_pixels] which returns in essence a pointer to an array containing the bitmap contents).
 Passing other types will most likely result in a segfault. 
+The gl*Pointer functions (and [glInterleavedArrays]) are the exception: OpenGL keeps the pointer and reads the array
+when drawing, after the garbage collector may have moved a string or freed a Bigarray, so they only accept integer offsets
+into a bound buffer object and Bigarrays whose memory the garbage collector does not own, and raise [Invalid_argument]
+otherwise. The submodule [Arena] provides reusable client arrays allocated outside the Ocaml heap for them.
 
 There is one function ([glEdgeFlagPointerListIBM]) which requires an array of arrays of Booleans. The array of array of GLbooleans is in GLCaml
 in this single instance represented by a 2-dimensional Bigarray of 32-bit integers, so manual conversion from and to bools need to take place.
 All other conversions are handled automatically by GLCaml.
 
+The automatic conversions allocate a fresh Bigarray and copy the Ocaml array into it on every call, and copy mutable
+parameters back afterwards. For code that calls such functions every frame, the submodule [Direct] contains the
+unconverted bindings of every function that takes array arguments: they accept the Bigarray types listed in the table
+above ([word_array], [float_array], [ubyte_array], ...) as-is and write results straight into them, so preallocated
+buffers can be reused without any allocation or copying. [Direct] can be opened after [Glcaml] to replace the
+converting bindings, e.g. [Direct.glUniformMatrix4fv loc 1 false m] with [m : float_array].
+[shader_source] and [compile_shaders] pass string arrays to [glShaderSource] with the lengths of the strings,
+without converting anything; [compile_shaders] sets the sources of many shaders and compiles them in one call.
+
 The parameter conversion convention means that a lot of the OpenGL functions are superfluous in GLCaml, since they have the same Ocaml signature
 despite having different C signatures. [glVertex2i] and [glVertex2s], for instance, take int and short arguments respectively in C, but both take native 
 integers in Ocaml. Likewise [glVertex2f] (single-precision floats) and [glVertex2d] (double precision floats) both translate to having double precision float arguments
 in the Ocaml bindings. This also means that precision may be lost or overflow may occur when using integer arguments for an OpenGL function that
 uses 8-bit or 16-bit integers; likewise when using Ocaml floats for OpenGL functions using single-precision floats.
 
+Functions that take and return only scalars ([int], [float], [bool], [unit]) are declared [[@@noalloc]], with
+[float] arguments [[@unboxed]] and [int] arguments [[@untagged]]. In native code they call straight into a C stub that
+receives raw doubles and integers, skipping the boxing and the GC root registration of the bytecode stubs.
+This requires Ocaml 4.03 or higher.
+
+The same scalar functions can also be recorded into a command buffer (submodule [Cmdbuf]) instead of being called:
+[Cmdbuf.glEnable b gl_blend] appends an opcode and its operands to a growable Bigarray, and [Cmdbuf.execute b]
+replays everything recorded in [b] with a single call into C. Buffers are kept until cleared, so they can be
+resubmitted every frame.
+
+Redundant state changes can be filtered out with the submodule [Cached], which shadows [glBindTexture], [glBindBuffer],
+[glUseProgram], [glEnable], [glDisable], [glBlendFunc] and a few related functions, remembers the values they set for each
+context, and drops calls that would set a value that is already current. [Cached.elided ()] counts the dropped calls.
+
+Buffer objects can be filled without an intermediate copy through the submodule [Mapped], whose [glMapBuffer] and
+[glMapBufferRange] return a Bigarray (e.g. a [float_array]) aliasing the mapped buffer memory. Views are invalidated
+by [Mapped.glUnmapBuffer].
+
+The submodule [Readback] reads the framebuffer asynchronously: [Readback.read] queues a [glReadPixels] into a ring of
+pixel pack buffers and returns a ticket, whose pixels can be fetched a few frames later without stalling, either as a
+Bigarray or straight into an image with a row pitch such as an SDL surface.
+
+Textures that change every frame can be updated through the submodule [Texture_stream], which writes each new image
+into a mapped pixel unpack buffer and uploads it with an asynchronous [glTexSubImage2D].
+
+GPU time can be measured with the submodule [Gpu_profiler]: [begin_scope]/[end_scope] bracket named parts of a frame,
+timed with ARB_timer_query or EXT_timer_query, and [report] gives the minimum, average and maximum time of each scope.
+Results are read back a few frames late so as not to stall; without timer queries the profiler does nothing.
+
+When [glcaml_stub.c] is compiled with [GLCAML_PROFILE] defined, every binding counts its calls and the CPU time spent
+in it; the submodule [Stats] reports and resets these counters.
+
+Many meshes stored in the same buffers can be drawn with one call through the submodule [Batch]: [Batch.add] appends
+the range of one mesh, and [Batch.flush_arrays] or [Batch.flush_elements] hands all ranges to [glMultiDrawArrays] or
+[glMultiDrawElements] as Bigarrays, without copying them.
+
+Matrices for [glUniformMatrix4fv] can be built with the submodule [Mat4]: 4x4 matrices are [float_array]s in
+column-major order, multiplied, inverted and projected in C, and [Mat4.stack] gives a matrix stack in the style of
+the fixed-function one whose top is passed to OpenGL without conversion.
+
+Legacy [glBegin]/[glEnd] drawing code can be sped up with the submodule [Recorder], whose versions of [glBegin],
+[glVertex3f], [glColor3f] and the like call OpenGL as usual, except inside [Recorder.record f]: there the geometry
+drawn by f is captured into a buffer object, and the returned mesh is redrawn with [Recorder.draw] in a few calls.
+
+Shader programs can be stored on disk with the submodule [Program_cache]: [Program_cache.program] compiles and
+links the sources once, saves the result with [glGetProgramBinary], and loads it with [glProgramBinary] on later
+runs, as long as the sources, the key of the setup function and the OpenGL driver are unchanged.
+
+Many programs can be built without blocking the first frames through the submodule [Shader_compiler]:
+[Shader_compiler.submit] queues a program and [Shader_compiler.update], called once per frame, finishes the ones
+that are ready. With KHR_parallel_shader_compile the driver compiles them on its own threads; otherwise a few are
+compiled in every frame, within a time budget.
+
+The CPU and the GPU can be kept apart with the submodule [Fence]: [Fence.insert] fences the commands issued so
+far and [Fence.wait] waits for the GPU to pass the fence, releasing the Ocaml runtime lock while it waits.
+[Fence.ring] tells when each region of a ring buffer may be overwritten, without [glFinish].
+
+Render-to-texture passes can share framebuffer objects through the submodule [Render_target], a pool of targets
+keyed by size, format and number of samples: [Render_target.acquire] and [Render_target.release] (or
+[Render_target.transient], released at the end of the frame) recycle the same textures and renderbuffers from pass
+to pass and from frame to frame, so steady-state frames create none.
+
+GL objects can be owned by the garbage collector through the submodule [Handle]: a handle deletes its texture,
+buffer, program or other object once it is collected, at the next [Win.swap_buffers] or [Sdl.swap_buffers] (or
+[Handle.collect]), and [Handle.stats] counts the live objects and their estimated bytes of each kind.
+
+Scenes with more textures than video memory can use the submodule [Residency], which keeps textures within a
+budget of bytes by evicting the least recently used ones, either to a copy in main memory or to a reload function,
+and reloads them on their next [Residency.use]. [Residency.hit_rate] tells how often textures were resident.
+
+Draws can be reordered to save state changes with the submodule [Render_queue]: [Render_queue.add] queues a draw
+with its pass, program, texture and depth, and [Render_queue.execute] sorts the queue with a radix sort in C and
+replays it, binding each program and texture once per run of draws that use it.
+
+Every binding can check for OpenGL errors: when [glcaml_stub.c] is compiled with [GLCAML_CHECKED] defined, each call
+is followed by [glGetError], and an error raises [Gl_error] with a message naming the function and its arguments.
+Arrays that are too short for the call, such as fewer than [16 * count] floats for [glUniformMatrix4fv], raise
+[Invalid_argument] before reaching OpenGL. The [[@@noalloc]] bindings cannot raise, so they keep their error until
+the next call of another binding or of [check_error]. Without [GLCAML_CHECKED] none of this is compiled in, and
+[check_error] can be called at chosen points instead.
+
+OpenGL functions are looked up in the OpenGL library the first time they are called, and the result is cached,
+so only the functions a program uses are ever resolved; no GLEW or other initialisation is needed. If a function
+is not available, calling it raises [Failure] in bytecode, while the [[@@noalloc]] native bindings cannot raise:
+they do nothing, return 0 or [false], and the [Failure] is raised by the next call of [check_error]. Use [preload] to resolve functions up front and check that they exist.
+
 Note that most OpenGL implementations use single-precision floating point internally, even if the call is made with an API function using doubles.
 OpenGL 3.0, due to be released in 2008, will only support single precision floating point.
 
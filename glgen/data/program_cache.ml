@@ -0,0 +1,143 @@
+
+(** Program binary cache.
+	[program c sources] builds a shader program from a list of (shader type, source) pairs and stores the linked
+	program in the directory of c with [glGetProgramBinary]. Later runs load it with [glProgramBinary] instead of
+	compiling the sources again. Files are named after a digest of the sources, of the setup key and of the vendor,
+	renderer and version strings of OpenGL, so a driver update simply misses the cache. A binary rejected by the driver is
+	replaced by compiling the sources. Without ARB_get_program_binary (or OpenGL 4.1) every program is compiled.
+	Compile and link errors raise [Failure] with the info log. *)
+type t = {
+	dir : string;
+	mutable support : int;
+	mutable driver : string;
+	mutable hits : int;
+	mutable misses : int
+}
+
+(** Create a cache storing its files in the existing directory dir. Nothing is asked of OpenGL until the first program *)
+let create dir = {
+	dir = dir;
+	support = -1;
+	driver = "";
+	hits = 0;
+	misses = 0
+}
+
+(** Number of programs loaded from the cache and number of programs compiled *)
+let hits c = c.hits
+let misses c = c.misses
+
+(* 0: no program binaries, 1: program binaries *)
+let support c =
+	if c.support < 0 then begin
+		c.support <-
+			(try
+				preload ["glGetProgramBinary"; "glProgramBinary"; "glProgramParameteri"];
+				let n = [| 0 |] in
+				glGetIntegerv gl_num_program_binary_formats n;
+				if n.(0) > 0 then 1 else 0
+			with Failure _ | Gl_error _ -> 0);
+		c.driver <- String.concat "\n" (List.map glGetString [gl_vendor; gl_renderer; gl_version])
+	end;
+	c.support
+
+(** Test whether programs can be cached with the current context *)
+let available c = support c > 0
+
+(* Compile and link the sources *)
+let compile c setup sources =
+	let p = glCreateProgram () in
+	let shader (kind, src) =
+		let s = glCreateShader kind in
+		shader_source s [| src |];
+		glCompileShader s;
+		if not (status glGetShaderiv s gl_compile_status) then begin
+			let log = info_log glGetShaderiv glGetShaderInfoLog s in
+			glDeleteShader s;
+			glDeleteProgram p;
+			failwith ("Program_cache: " ^ log)
+		end;
+		glAttachShader p s;
+		s
+	in
+	let shaders = List.map shader sources in
+	setup p;
+	if c.support > 0 then glProgramParameteri p gl_program_binary_retrievable_hint 1;
+	glLinkProgram p;
+	List.iter (fun s -> glDetachShader p s; glDeleteShader s) shaders;
+	if not (status glGetProgramiv p gl_link_status) then begin
+		let log = info_log glGetProgramiv glGetProgramInfoLog p in
+		glDeleteProgram p;
+		failwith ("Program_cache: " ^ log)
+	end;
+	p
+
+let path c key sources =
+	let key = String.concat "\000" (c.driver :: key :: List.map (fun (kind, src) -> string_of_int kind ^ "\000" ^ src) sources) in
+	Filename.concat c.dir (Digest.to_hex (Digest.string key) ^ ".bin")
+
+(* A cache file holds the binary format followed by the binary *)
+let read_binary path =
+	try
+		let ic = open_in_bin path in
+		let r =
+			try
+				let format = input_binary_int ic in
+				Some (format, really_input_string ic (in_channel_length ic - 4))
+			with End_of_file -> None
+		in
+		close_in ic;
+		r
+	with Sys_error _ -> None
+
+let write_binary path p =
+	let n = [| 0 |] in
+	glGetProgramiv p gl_program_binary_length n;
+	if n.(0) > 0 then begin
+		let b = make_ubyte_array n.(0) and len = [| 0 |] and format = [| 0 |] in
+		glGetProgramBinary p n.(0) len format b;
+		let tmp = path ^ ".tmp" in
+		try
+			let oc = open_out_bin tmp in
+			output_binary_int oc format.(0);
+			output_string oc (String.sub (to_string b) 0 len.(0));
+			close_out oc;
+			Sys.rename tmp path
+		with Sys_error _ -> ()
+	end
+
+(* Load a binary, or return None if the driver rejects it *)
+let load format binary =
+	let p = glCreateProgram () in
+	let ok =
+		try
+			glProgramBinary p format binary (String.length binary);
+			status glGetProgramiv p gl_link_status
+		with Gl_error _ -> false
+	in
+	if ok then Some p else (glDeleteProgram p; None)
+
+(** Build a program from (shader type, source) pairs, e.g. [[(gl_vertex_shader, vs); (gl_fragment_shader, fs)]].
+	setup is called with the program before it is linked, e.g. for [glBindAttribLocation]; its effect is part of the
+	stored binary, so it is not called when the program comes from the cache. key names what setup does, e.g. the
+	attribute locations it binds, and goes into the digest: programs built from the same sources with different
+	setups must be given different keys, or they share a cache file *)
+let program c ?(setup = fun _ -> ()) ?(key = "") sources =
+	if support c = 0 then compile c setup sources else begin
+		let path = path c key sources in
+		let cached =
+			match read_binary path with
+			| Some (format, binary) -> load format binary
+			| None -> None
+		in
+		match cached with
+		| Some p ->
+			c.hits <- c.hits + 1;
+			p
+		| None ->
+			c.misses <- c.misses + 1;
+			let p = compile c setup sources in
+			write_binary path p;
+			p
+	end
+
@@ -0,0 +1,110 @@
+
+(** Asynchronous framebuffer readback.
+	[read r x y w h format typ] starts copying a block of the framebuffer into the next pixel pack buffer of
+	the ring r, like [glReadPixels], but returns at once with a ticket instead of waiting for the GPU.
+	Call [end_frame] once per frame: after [latency] frames (2 by default) the transfer has normally completed,
+	[ready] becomes true and [fetch] copies the pixels out without stalling. Fetching earlier is allowed, but waits.
+	A ticket stays valid until its buffer is reused, [slots] reads later; [fetch] raises [Invalid_argument] for
+	tickets that are no longer valid. Rows are tightly packed and bottom-up, as OpenGL returns them;
+	[fetch_rows] copies them top-down into an image with a row pitch instead, e.g. a locked SDL surface with
+	[Readback.fetch_rows r t (Sdl.Video.surface_pixels s) (Sdl.Video.surface_pitch s)].
+	Requires OpenGL 2.1 or ARB_pixel_buffer_object. *)
+type ticket = {
+	slot : int;
+	serial : int;
+	frame : int;
+	rows : int;
+	row_bytes : int
+}
+
+type t = {
+	buffers : int array;
+	sizes : int array;
+	serials : int array;
+	latency : int;
+	mutable next : int;
+	mutable frames : int
+}
+
+external copy_rows : ubyte_array -> ubyte_array -> int -> int -> int -> bool -> unit = "glstub_copy_rows_byte" "glstub_copy_rows"
+
+(** Create a ring of pixel pack buffers *)
+let create ?(slots = 3) ?(latency = 2) () =
+	let buffers = Array.make slots 0 in
+	glGenBuffers slots buffers;
+	{ buffers = buffers; sizes = Array.make slots 0; serials = Array.make slots (-1); latency = latency; next = 0; frames = 0 }
+
+(** Delete the buffers of r *)
+let destroy r = glDeleteBuffers (Array.length r.buffers) r.buffers
+
+(** Size in bytes of a pixel of the given format and type *)
+let pixel_size format typ =
+	let components =
+		if format = gl_rgba || format = gl_bgra then 4
+		else if format = gl_rgb || format = gl_bgr then 3
+		else if format = gl_luminance_alpha then 2
+		else 1
+	in
+	if typ = gl_unsigned_byte || typ = gl_byte then components
+	else if typ = gl_unsigned_short || typ = gl_short then 2 * components
+	else if typ = gl_unsigned_int_8_8_8_8 || typ = gl_unsigned_int_8_8_8_8_rev || typ = gl_unsigned_int_10_10_10_2 ||
+		typ = gl_unsigned_int_2_10_10_10_rev then 4
+	else if typ = gl_unsigned_short_5_6_5 || typ = gl_unsigned_short_4_4_4_4 || typ = gl_unsigned_short_5_5_5_1 ||
+		typ = gl_unsigned_short_5_6_5_rev || typ = gl_unsigned_short_4_4_4_4_rev || typ = gl_unsigned_short_1_5_5_5_rev then 2
+	else if typ = gl_unsigned_byte_3_3_2 || typ = gl_unsigned_byte_2_3_3_rev then 1
+	else 4 * components
+
+(** Start reading a block of the framebuffer *)
+let read r x y w h format typ =
+	let slot = r.next mod (Array.length r.buffers) in
+	let row_bytes = w * (pixel_size format typ) in
+	glBindBuffer gl_pixel_pack_buffer r.buffers.(slot);
+	if r.sizes.(slot) < row_bytes * h then begin
+		glBufferData gl_pixel_pack_buffer (row_bytes * h) 0 gl_stream_read;
+		r.sizes.(slot) <- row_bytes * h
+	end;
+	let alignment = [| 0 |] in
+	glGetIntegerv gl_pack_alignment alignment;
+	glPixelStorei gl_pack_alignment 1;
+	glReadPixels x y w h format typ 0;
+	glPixelStorei gl_pack_alignment alignment.(0);
+	glBindBuffer gl_pixel_pack_buffer 0;
+	r.serials.(slot) <- r.next;
+	r.next <- r.next + 1;
+	{ slot = slot; serial = r.serials.(slot); frame = r.frames; rows = h; row_bytes = row_bytes }
+
+(** Mark the end of a frame *)
+let end_frame r = r.frames <- r.frames + 1
+
+(** Test whether the pixels of t can be fetched without waiting, and whether t is still valid *)
+let ready r t = r.frames - t.frame >= r.latency
+let valid r t = r.serials.(t.slot) = t.serial
+
+(** Size in bytes of the pixels of t *)
+let size t = t.rows * t.row_bytes
+
+let with_mapping r t f =
+	if not (valid r t) then invalid_argument "Readback: ticket is no longer valid";
+	glBindBuffer gl_pixel_pack_buffer r.buffers.(t.slot);
+	let m = Mapped.glMapBuffer gl_pixel_pack_buffer gl_read_only Bigarray.int8_unsigned in
+	let finish () =
+		ignore (Mapped.glUnmapBuffer gl_pixel_pack_buffer);
+		glBindBuffer gl_pixel_pack_buffer 0
+	in
+	(try f m with e -> finish (); raise e);
+	finish ()
+
+(** Copy the pixels of t into dst, which must hold at least [size t] bytes *)
+let fetch r t dst =
+	with_mapping r t (fun m -> copy_rows m dst t.rows t.row_bytes t.row_bytes false)
+
+(** Copy the pixels of t into a fresh ubyte_array *)
+let get r t =
+	let a = Bigarray.Array1.create Bigarray.int8_unsigned Bigarray.c_layout (size t) in
+	fetch r t a;
+	a
+
+(** Copy the pixels of t top-down into pixels, with rows pitch bytes apart *)
+let fetch_rows r t pixels pitch =
+	with_mapping r t (fun m -> copy_rows m pixels t.rows t.row_bytes pitch true)
+
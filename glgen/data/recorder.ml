@@ -0,0 +1,193 @@
+
+(** Immediate-mode recorder.
+	The functions below have the names and arguments of [glBegin], [glEnd], [glVertex3f], [glColor3f], [glNormal3f],
+	[glTexCoord2f] and their variants. Outside of [record] they call OpenGL as usual. Inside [record f], the
+	vertices emitted between [glBegin] and [glEnd] are captured instead, with the current color, normal and texture
+	coordinate, into an interleaved array that is uploaded to a buffer object when f returns. The resulting [mesh]
+	is drawn with [draw], which sets up vertex arrays and issues one multi-draw per run of primitives of the same
+	mode, so a legacy scene recorded once is redrawn every frame at the cost of a handful of calls.
+	Only the geometry is recorded: any other GL call made by f, such as a [glRotatef] or a [glBindTexture], takes
+	effect once during the recording. [draw] uses the fixed-function vertex arrays, binds [gl_array_buffer] behind the
+	back of [Cached], and leaves the current color, normal and texture coordinate undefined. *)
+type mesh = {
+	vbo : int;
+	vertices : int;
+	colors : bool;
+	normals : bool;
+	texcoords : bool;
+	groups : (int * word_array * word_array * int) list
+}
+
+type recording = {
+	mutable data : float_array;
+	mutable len : int;
+	current : float_array;
+	mutable mode : int;
+	mutable first : int;
+	mutable ranges : (int * int * int) list;
+	mutable has_colors : bool;
+	mutable has_normals : bool;
+	mutable has_texcoords : bool
+}
+
+(* Interleaved vertex: position (4 floats), color (4), normal (3), texture coordinate (2) *)
+let vertex_size = 13
+let stride = 4 * vertex_size
+
+let recording = ref None
+
+let new_recording () =
+	let current = make_float_array 9 in
+	Bigarray.Array1.fill current 0.;
+	current.{0} <- 1.; current.{1} <- 1.; current.{2} <- 1.; current.{3} <- 1.; current.{6} <- 1.;
+	{ data = make_float_array (256 * vertex_size); len = 0; current = current; mode = -1; first = 0; ranges = [];
+	  has_colors = false; has_normals = false; has_texcoords = false }
+
+let grow r =
+	let d = make_float_array (2 * Bigarray.Array1.dim r.data) in
+	Bigarray.Array1.blit (Bigarray.Array1.sub r.data 0 r.len) (Bigarray.Array1.sub d 0 r.len);
+	r.data <- d
+
+let emit r x y z w =
+	if r.mode < 0 then invalid_argument "Recorder: vertex outside glBegin/glEnd";
+	if r.len + vertex_size > Bigarray.Array1.dim r.data then grow r;
+	let d = r.data and o = r.len in
+	d.{o} <- x; d.{o + 1} <- y; d.{o + 2} <- z; d.{o + 3} <- w;
+	for i = 0 to 8 do d.{o + 4 + i} <- r.current.{i} done;
+	r.len <- o + vertex_size
+
+(* Number of vertices of one primitive of the independent primitive modes, which can be merged across glBegin/glEnd *)
+let primitive_size mode =
+	if mode = gl_points then 1
+	else if mode = gl_lines then 2
+	else if mode = gl_triangles then 3
+	else if mode = gl_quads then 4
+	else 0
+
+let glBegin mode =
+	match !recording with
+	| None -> glBegin mode
+	| Some r ->
+		if r.mode >= 0 then invalid_argument "Recorder.glBegin: already inside glBegin/glEnd";
+		r.mode <- mode;
+		r.first <- r.len / vertex_size
+
+let glEnd () =
+	match !recording with
+	| None -> glEnd ()
+	| Some r ->
+		if r.mode < 0 then invalid_argument "Recorder.glEnd: no glBegin";
+		let count = r.len / vertex_size - r.first in
+		let k = primitive_size r.mode in
+		let count = if k > 0 then count - count mod k else count in
+		(match r.ranges with
+		| (mode, first, n) :: rest when mode = r.mode && k > 0 && first + n = r.first ->
+			r.ranges <- (mode, first, n + count) :: rest
+		| l -> if count > 0 then r.ranges <- (r.mode, r.first, count) :: l);
+		r.mode <- -1
+
+let set_color r red green blue alpha =
+	r.has_colors <- true;
+	r.current.{0} <- red; r.current.{1} <- green; r.current.{2} <- blue; r.current.{3} <- alpha
+
+let set_normal r x y z =
+	r.has_normals <- true;
+	r.current.{4} <- x; r.current.{5} <- y; r.current.{6} <- z
+
+let set_texcoord r s t =
+	r.has_texcoords <- true;
+	r.current.{7} <- s; r.current.{8} <- t
+
+let glVertex2f x y = match !recording with None -> glVertex2f x y | Some r -> emit r x y 0. 1.
+let glVertex2d x y = match !recording with None -> glVertex2d x y | Some r -> emit r x y 0. 1.
+let glVertex2i x y = match !recording with None -> glVertex2i x y | Some r -> emit r (float x) (float y) 0. 1.
+let glVertex2iv v = match !recording with None -> glVertex2iv v | Some r -> emit r (float v.(0)) (float v.(1)) 0. 1.
+let glVertex3f x y z = match !recording with None -> glVertex3f x y z | Some r -> emit r x y z 1.
+let glVertex3d x y z = match !recording with None -> glVertex3d x y z | Some r -> emit r x y z 1.
+let glVertex3i x y z = match !recording with None -> glVertex3i x y z | Some r -> emit r (float x) (float y) (float z) 1.
+let glVertex3fv v = match !recording with None -> glVertex3fv v | Some r -> emit r v.(0) v.(1) v.(2) 1.
+let glVertex4f x y z w = match !recording with None -> glVertex4f x y z w | Some r -> emit r x y z w
+let glVertex4d x y z w = match !recording with None -> glVertex4d x y z w | Some r -> emit r x y z w
+
+let glColor3f red green blue = match !recording with None -> glColor3f red green blue | Some r -> set_color r red green blue 1.
+let glColor3d red green blue = match !recording with None -> glColor3d red green blue | Some r -> set_color r red green blue 1.
+let glColor4f red green blue alpha =
+	match !recording with None -> glColor4f red green blue alpha | Some r -> set_color r red green blue alpha
+let glColor4d red green blue alpha =
+	match !recording with None -> glColor4d red green blue alpha | Some r -> set_color r red green blue alpha
+let glColor3ub red green blue =
+	match !recording with
+	| None -> glColor3ub red green blue
+	| Some r -> set_color r (float red /. 255.) (float green /. 255.) (float blue /. 255.) 1.
+let glColor4ub red green blue alpha =
+	match !recording with
+	| None -> glColor4ub red green blue alpha
+	| Some r -> set_color r (float red /. 255.) (float green /. 255.) (float blue /. 255.) (float alpha /. 255.)
+
+let glNormal3f x y z = match !recording with None -> glNormal3f x y z | Some r -> set_normal r x y z
+let glNormal3d x y z = match !recording with None -> glNormal3d x y z | Some r -> set_normal r x y z
+
+let glTexCoord2f s t = match !recording with None -> glTexCoord2f s t | Some r -> set_texcoord r s t
+let glTexCoord2d s t = match !recording with None -> glTexCoord2d s t | Some r -> set_texcoord r s t
+
+(* Turn the ranges, recorded last first, into runs of the same mode *)
+let make_groups ranges : (int * word_array * word_array * int) list =
+	let group mode l =
+		let n = List.length l in
+		let first = make_word_array n and count = make_word_array n in
+		List.iteri (fun i (f, c) -> first.{i} <- Int32.of_int f; count.{i} <- Int32.of_int c) l;
+		(mode, first, count, n)
+	in
+	let rec runs acc = function
+		| [] -> acc
+		| (mode, f, c) :: rest ->
+			(match acc with
+			| (m, l) :: acc' when m = mode -> runs ((m, (f, c) :: l) :: acc') rest
+			| _ -> runs ((mode, [(f, c)]) :: acc) rest)
+	in
+	List.map (fun (mode, l) -> group mode l) (runs [] ranges)
+
+(** Record the geometry drawn by f into a mesh *)
+let record f =
+	let r = new_recording () in
+	let saved = !recording in
+	recording := Some r;
+	(try f () with e -> recording := saved; raise e);
+	recording := saved;
+	if r.mode >= 0 then invalid_argument "Recorder.record: glBegin without glEnd";
+	let a = [| 0 |] in
+	glGenBuffers 1 a;
+	glBindBuffer gl_array_buffer a.(0);
+	glBufferData gl_array_buffer (4 * r.len) (Bigarray.Array1.sub r.data 0 (max r.len 1)) gl_static_draw;
+	glBindBuffer gl_array_buffer 0;
+	{ vbo = a.(0); vertices = r.len / vertex_size; colors = r.has_colors; normals = r.has_normals;
+	  texcoords = r.has_texcoords; groups = make_groups r.ranges }
+
+(** Number of vertices of a mesh *)
+let vertices m = m.vertices
+
+(** Draw a mesh *)
+let draw m =
+	glPushClientAttrib gl_client_vertex_array_bit;
+	glBindBuffer gl_array_buffer m.vbo;
+	glEnableClientState gl_vertex_array;
+	glVertexPointer 4 gl_float stride 0;
+	if m.colors then begin
+		glEnableClientState gl_color_array;
+		glColorPointer 4 gl_float stride 16
+	end;
+	if m.normals then begin
+		glEnableClientState gl_normal_array;
+		glNormalPointer gl_float stride 32
+	end;
+	if m.texcoords then begin
+		glEnableClientState gl_texture_coord_array;
+		glTexCoordPointer 2 gl_float stride 44
+	end;
+	List.iter (fun (mode, first, count, n) -> Batch.multi_draw_arrays mode first count n) m.groups;
+	glBindBuffer gl_array_buffer 0;
+	glPopClientAttrib ()
+
+(** Delete the buffer object of a mesh; it can not be drawn afterwards *)
+let delete m = glDeleteBuffers 1 [| m.vbo |]
+
@@ -0,0 +1,107 @@
+
+(** Render queue.
+	Draws are submitted in any order with [add q ~pass ~program ~texture ~depth payload] and replayed by
+	[execute q draw], which sorts them by pass, program, texture and depth (front to back, depth from 0. to 1.),
+	binds each program and texture once per run of draws that share it, and calls [draw payload] for every draw.
+	The sort is a radix sort in C over 64-bit keys; only the low 12 bits of program and texture names go into the
+	keys, so names beyond 4095 may interleave, which costs extra binds but never binds the wrong object. Passes
+	range from 0 to 15 and a queue holds up to 2^20 draws. The storage is kept and grows as needed, so a queue
+	that is refilled every frame allocates nothing. *)
+type t = {
+	mutable draws : word_array;
+	mutable payloads : int array;
+	mutable keys : dword_array;
+	mutable order : word_array;
+	mutable length : int;
+	mutable program_binds : int;
+	mutable texture_binds : int
+}
+
+external sort' : word_array -> int -> dword_array -> word_array -> unit = "glstub_render_queue_sort"
+
+let max_length = 1 lsl 20
+
+(** Create an empty queue with room for n draws *)
+let create n =
+	let n = min (max n 16) max_length in
+	{
+		draws = make_word_array (4 * n);
+		payloads = Array.make n 0;
+		keys = make_dword_array (2 * n);
+		order = make_word_array n;
+		length = 0;
+		program_binds = 0;
+		texture_binds = 0
+	}
+
+(** Number of draws in q *)
+let length q = q.length
+
+(** Discard all draws, keeping the storage *)
+let clear q = q.length <- 0
+
+(** Number of glUseProgram and glBindTexture calls made by the last [execute] *)
+let program_binds q = q.program_binds
+let texture_binds q = q.texture_binds
+
+let grow q =
+	if q.length >= max_length then invalid_argument "Render_queue.add: too many draws";
+	let n = min (2 * Array.length q.payloads) max_length in
+	let draws = make_word_array (4 * n) in
+	Bigarray.Array1.blit (Bigarray.Array1.sub q.draws 0 (4 * q.length)) (Bigarray.Array1.sub draws 0 (4 * q.length));
+	q.draws <- draws;
+	q.payloads <- Array.append q.payloads (Array.make (n - q.length) 0);
+	q.keys <- make_dword_array (2 * n);
+	q.order <- make_word_array n
+
+(** Queue a draw; raises [Invalid_argument] if pass is not between 0 and 15 *)
+let add q ~pass ~program ~texture ~depth payload =
+	if pass < 0 || pass > 15 then invalid_argument "Render_queue.add: pass out of 0..15";
+	if q.length = Array.length q.payloads then grow q;
+	let i = q.length in
+	let o = 4 * i in
+	let d = if depth <= 0. then 0 else if depth >= 1. then 0xffff else truncate (depth *. 65535.) in
+	Bigarray.Array1.unsafe_set q.draws o (Int32.of_int pass);
+	Bigarray.Array1.unsafe_set q.draws (o + 1) (Int32.of_int program);
+	Bigarray.Array1.unsafe_set q.draws (o + 2) (Int32.of_int texture);
+	Bigarray.Array1.unsafe_set q.draws (o + 3) (Int32.of_int d);
+	q.payloads.(i) <- payload;
+	q.length <- i + 1
+
+(** Sort the draws; [sorted q k] is then the payload of the k-th draw *)
+let sort q = sort' q.draws q.length q.keys q.order
+
+let sorted q k = q.payloads.(Int32.to_int q.order.{k})
+
+(** Sort and replay the draws, binding programs and textures (on [gl_texture_2d]) as needed. pass is called when
+	a new pass begins, before its first draw, e.g. to bind its render target *)
+let execute q ?(pass = fun _ -> ()) draw =
+	sort q;
+	q.program_binds <- 0;
+	q.texture_binds <- 0;
+	let current_pass = ref (-1) and program = ref (-1) and texture = ref (-1) in
+	for k = 0 to q.length - 1 do
+		let i = Int32.to_int (Bigarray.Array1.unsafe_get q.order k) in
+		let o = 4 * i in
+		let p = Int32.to_int (Bigarray.Array1.unsafe_get q.draws o) in
+		if p <> !current_pass then begin
+			current_pass := p;
+			program := -1;
+			texture := -1;
+			pass p
+		end;
+		let prog = Int32.to_int (Bigarray.Array1.unsafe_get q.draws (o + 1)) in
+		if prog <> !program then begin
+			program := prog;
+			q.program_binds <- q.program_binds + 1;
+			glUseProgram prog
+		end;
+		let tex = Int32.to_int (Bigarray.Array1.unsafe_get q.draws (o + 2)) in
+		if tex <> !texture then begin
+			texture := tex;
+			q.texture_binds <- q.texture_binds + 1;
+			glBindTexture gl_texture_2d tex
+		end;
+		draw q.payloads.(i)
+	done
+
@@ -0,0 +1,210 @@
+
+(** Render target pool.
+	A render target is a framebuffer object with a colour attachment (a texture, or a renderbuffer when it is
+	multisampled) and an optional depth renderbuffer. [acquire p w h format] returns a free target of that size,
+	internal format, depth format and number of samples, and [release p t] gives it back to the pool, so that later
+	passes and frames reuse it instead of creating new textures. [transient p ...] acquires a target that is released
+	by [end_frame]; free targets left unused for more than [keep] frames are deleted there. Creating a target
+	changes the texture and renderbuffer bindings (call [Cached.invalidate] when using [Cached]) and restores the
+	framebuffer binding. Colour formats may be normalised, float or integer formats, e.g. [gl_rgba32ui_ext]. *)
+type target = {
+	framebuffer : int;
+	color : int;
+	depth : int;
+	width : int;
+	height : int;
+	format : int;
+	depth_format : int;
+	samples : int;
+	mutable released : int
+}
+
+type t = {
+	free : (int * int * int * int * int, target list) Hashtbl.t;
+	mutable transients : target list;
+	mutable frame : int;
+	keep : int;
+	mutable created : int;
+	mutable reused : int
+}
+
+(** Create a pool. keep is the number of frames a free target is kept for *)
+let create ?(keep = 60) () = {
+	free = Hashtbl.create 16;
+	transients = [];
+	frame = 0;
+	keep = keep;
+	created = 0;
+	reused = 0
+}
+
+(** Number of targets created and number of acquisitions served by a free target *)
+let created p = p.created
+let reused p = p.reused
+
+let key t = (t.width, t.height, t.format, t.depth_format, t.samples)
+
+let get pname =
+	let a = [| 0 |] in
+	glGetIntegerv pname a;
+	a.(0)
+
+let gen f =
+	let a = [| 0 |] in
+	f 1 a;
+	a.(0)
+
+let delete t =
+	glDeleteFramebuffers 1 [| t.framebuffer |];
+	if t.samples > 0 then glDeleteRenderbuffers 1 [| t.color |] else glDeleteTextures 1 [| t.color |];
+	if t.depth <> 0 then glDeleteRenderbuffers 1 [| t.depth |]
+
+let renderbuffer samples format width height =
+	let rb = gen glGenRenderbuffers in
+	glBindRenderbuffer gl_renderbuffer rb;
+	if samples > 0 then
+		glRenderbufferStorageMultisample gl_renderbuffer samples format width height
+	else
+		glRenderbufferStorage gl_renderbuffer format width height;
+	rb
+
+(* Format and type of the pixels of an internal format, which glTexImage2D needs even without data:
+	integer formats take the *_INTEGER formats, depth formats the depth formats, float formats floats *)
+let pixel_format internal =
+	let components =
+		if List.mem internal [gl_r8; gl_r16; gl_r16f; gl_r32f] then 1
+		else if List.mem internal [gl_rg8; gl_rg16; gl_rg16f; gl_rg32f] then 2
+		else if List.mem internal [gl_rgb8; gl_srgb8; gl_rgb16; gl_rgb16f; gl_rgb32f; gl_r11f_g11f_b10f_ext; gl_rgb9_e5_ext] then 3
+		else 4
+	in
+	if List.mem internal [gl_depth_component16; gl_depth_component24; gl_depth_component32; gl_depth_component32f] then
+		(gl_depth_component, gl_float)
+	else if internal = gl_depth24_stencil8 then
+		(gl_depth_stencil, gl_unsigned_int_24_8)
+	else if internal = gl_depth32f_stencil8 then
+		(gl_depth_stencil, gl_float_32_unsigned_int_24_8_rev_nv)
+	else if internal >= 0x8231 && internal <= 0x823c then
+		(* GL_R8I to GL_RG32UI: signed formats have odd values *)
+		((if internal <= 0x8236 then gl_red_integer_ext else gl_rg_integer), if internal land 1 = 1 then gl_int else gl_unsigned_int)
+	else if internal >= gl_rgba32ui_ext && internal <= gl_rgb8i_ext then
+		(* GL_RGBA32UI to GL_RGB8I, in groups of six starting with RGBA and RGB *)
+		((if (internal - gl_rgba32ui_ext) mod 6 = 1 then gl_rgb_integer_ext else gl_rgba_integer_ext),
+			if internal >= gl_rgba32i_ext then gl_int else gl_unsigned_int)
+	else if internal = 0x906f then
+		(* GL_RGB10_A2UI *)
+		(gl_rgba_integer_ext, gl_unsigned_int_2_10_10_10_rev)
+	else
+		let format = List.nth [gl_red; gl_rg; gl_rgb; gl_rgba] (components - 1) in
+		let float = List.mem internal
+			[gl_r16f; gl_rg16f; gl_rgb16f; gl_rgba16f; gl_r32f; gl_rg32f; gl_rgb32f; gl_rgba32f; gl_r11f_g11f_b10f_ext; gl_rgb9_e5_ext]
+		in
+		(format, if float then gl_float else gl_unsigned_byte)
+
+let make width height format depth_format samples =
+	let bound = get gl_framebuffer_binding in
+	let fb = gen glGenFramebuffers in
+	glBindFramebuffer gl_framebuffer fb;
+	let color =
+		if samples > 0 then begin
+			let rb = renderbuffer samples format width height in
+			glFramebufferRenderbuffer gl_framebuffer gl_color_attachment0 gl_renderbuffer rb;
+			rb
+		end else begin
+			let tex = gen glGenTextures in
+			glBindTexture gl_texture_2d tex;
+			let pixels, typ = pixel_format format in
+			glTexImage2D gl_texture_2d 0 format width height 0 pixels typ 0;
+			(* Integer textures can not be sampled with linear filtering *)
+			let filter = if typ = gl_int || typ = gl_unsigned_int || pixels = gl_rgba_integer_ext then gl_nearest else gl_linear in
+			glTexParameteri gl_texture_2d gl_texture_min_filter filter;
+			glTexParameteri gl_texture_2d gl_texture_mag_filter filter;
+			glTexParameteri gl_texture_2d gl_texture_wrap_s gl_clamp_to_edge;
+			glTexParameteri gl_texture_2d gl_texture_wrap_t gl_clamp_to_edge;
+			glFramebufferTexture2D gl_framebuffer gl_color_attachment0 gl_texture_2d tex 0;
+			tex
+		end
+	in
+	let depth =
+		if depth_format = 0 then 0 else begin
+			let rb = renderbuffer samples depth_format width height in
+			let attachment =
+				if depth_format = gl_depth24_stencil8 || depth_format = gl_depth32f_stencil8 then gl_depth_stencil_attachment
+				else gl_depth_attachment
+			in
+			glFramebufferRenderbuffer gl_framebuffer attachment gl_renderbuffer rb;
+			rb
+		end
+	in
+	let status = glCheckFramebufferStatus gl_framebuffer in
+	glBindFramebuffer gl_framebuffer bound;
+	let t = {
+		framebuffer = fb; color = color; depth = depth; width = width; height = height;
+		format = format; depth_format = depth_format; samples = samples; released = 0
+	} in
+	if status <> gl_framebuffer_complete then begin
+		delete t;
+		failwith (Printf.sprintf "Render_target: incomplete framebuffer (0x%x)" status)
+	end;
+	t
+
+(** Take a target of the given size and internal format from the pool, or create one. depth is the internal format
+	of the depth buffer, 0 (the default) for none; samples is the number of samples, 0 (the default) for a target
+	whose colour can be read as a texture *)
+let acquire p ?(depth = 0) ?(samples = 0) width height format =
+	let k = (width, height, format, depth, samples) in
+	match (try Hashtbl.find p.free k with Not_found -> []) with
+	| t :: rest ->
+		if rest = [] then Hashtbl.remove p.free k else Hashtbl.replace p.free k rest;
+		p.reused <- p.reused + 1;
+		t
+	| [] ->
+		p.created <- p.created + 1;
+		make width height format depth samples
+
+(** Give a target back to the pool *)
+let release p t =
+	let k = key t in
+	t.released <- p.frame;
+	Hashtbl.replace p.free k (t :: (try Hashtbl.find p.free k with Not_found -> []))
+
+(** Acquire a target for the rest of the frame *)
+let transient p ?depth ?samples width height format =
+	let t = acquire p ?depth ?samples width height format in
+	p.transients <- t :: p.transients;
+	t
+
+(** Release the transient targets, and delete the targets that have been free for more than [keep] frames *)
+let end_frame p =
+	List.iter (release p) p.transients;
+	p.transients <- [];
+	p.frame <- p.frame + 1;
+	Hashtbl.filter_map_inplace (fun _ l ->
+		let l, old = List.partition (fun t -> p.frame - t.released <= p.keep) l in
+		List.iter delete old;
+		if l = [] then None else Some l) p.free
+
+(** Draw into a target *)
+let bind t =
+	glBindFramebuffer gl_framebuffer t.framebuffer;
+	glViewport 0 0 t.width t.height
+
+(** The texture holding the colour of a target that is not multisampled *)
+let texture t =
+	if t.samples > 0 then invalid_argument "Render_target.texture: multisampled target";
+	t.color
+
+(** Copy the colour of src, e.g. a multisampled target, into dst, which has the same size *)
+let resolve src dst =
+	let bound = get gl_framebuffer_binding in
+	glBindFramebuffer gl_read_framebuffer src.framebuffer;
+	glBindFramebuffer gl_draw_framebuffer dst.framebuffer;
+	glBlitFramebuffer 0 0 src.width src.height 0 0 dst.width dst.height gl_color_buffer_bit gl_nearest;
+	glBindFramebuffer gl_framebuffer bound
+
+(** Delete every target of the pool; acquired targets must be deleted with [delete] *)
+let destroy p =
+	List.iter (release p) p.transients;
+	p.transients <- [];
+	Hashtbl.iter (fun _ l -> List.iter delete l) p.free;
+	Hashtbl.reset p.free
+
@@ -0,0 +1,176 @@
+
+(** Texture residency.
+	A manager keeps the textures it knows within a budget of bytes. [use m tex] returns the texture name to bind,
+	reloading the texture if it was evicted, and marks it as used in the current frame. When the textures exceed
+	the budget, the least recently used ones are evicted: a texture added with [add_reload] is deleted and its
+	load function is called again on its next use; one added with [add_cached] is read back into a Bigarray in
+	main memory first and uploaded again from there, as RGBA8 with linear filtering and, if it had them, mipmaps.
+	Textures used in the current frame are never evicted, so the budget may be exceeded until [end_frame].
+	[hit_rate] gives the fraction of uses that found the texture resident; first loads count as misses.
+	Loads and readbacks change the [gl_texture_2d] binding. *)
+type source =
+	| Reload of (unit -> int * int)
+	| Cached of int * int * bool
+
+(* Resident textures form a doubly linked list from the most recently used (newest) to the least recently used
+	(oldest), so that marking a texture as used and evicting the oldest one are constant time *)
+type texture = {
+	source : source;
+	mutable name : int;
+	mutable bytes : int;
+	mutable last_used : int;
+	mutable pixels : ubyte_array;
+	mutable newer : texture option;
+	mutable older : texture option
+}
+
+type t = {
+	mutable budget : int;
+	mutable used : int;
+	mutable frame : int;
+	mutable newest : texture option;
+	mutable oldest : texture option;
+	mutable hits : int;
+	mutable misses : int;
+	mutable evictions : int
+}
+
+(** Create a manager with a budget in bytes *)
+let create budget = {
+	budget = budget;
+	used = 0;
+	frame = 0;
+	newest = None;
+	oldest = None;
+	hits = 0;
+	misses = 0;
+	evictions = 0
+}
+
+let set_budget m budget = m.budget <- budget
+
+(** Bytes of the resident textures *)
+let used m = m.used
+
+(** Number of uses that found the texture resident, of uses that loaded it, and of evictions *)
+let hits m = m.hits
+let misses m = m.misses
+let evictions m = m.evictions
+
+let hit_rate m = if m.hits + m.misses = 0 then 1. else float_of_int m.hits /. float_of_int (m.hits + m.misses)
+
+let reset_counters m =
+	m.hits <- 0;
+	m.misses <- 0;
+	m.evictions <- 0
+
+(** The name of a texture, 0 while it is evicted *)
+let name tex = tex.name
+
+let no_pixels = make_ubyte_array 0
+
+let unlink m tex =
+	(match tex.newer with Some t -> t.older <- tex.older | None -> m.newest <- tex.older);
+	(match tex.older with Some t -> t.newer <- tex.newer | None -> m.oldest <- tex.newer);
+	tex.newer <- None;
+	tex.older <- None
+
+let push m tex =
+	tex.older <- m.newest;
+	(match m.newest with Some t -> t.newer <- Some tex | None -> m.oldest <- Some tex);
+	m.newest <- Some tex
+
+let add m source name bytes =
+	let tex = { source = source; name = name; bytes = bytes; last_used = m.frame; pixels = no_pixels; newer = None; older = None } in
+	if name <> 0 then begin
+		push m tex;
+		m.used <- m.used + bytes
+	end;
+	tex
+
+(** Add a texture created by load, which returns its name and size in bytes. It is loaded on first use *)
+let add_reload m load = add m (Reload load) 0 0
+
+(** Add an existing RGBA texture of the given size, kept in main memory while it is evicted *)
+let add_cached m ?(mipmap = false) width height name =
+	add m (Cached (width, height, mipmap)) name (width * height * 4 * (if mipmap then 4 else 3) / 3)
+
+let unload m tex =
+	glDeleteTextures 1 [| tex.name |];
+	tex.name <- 0;
+	unlink m tex;
+	m.used <- m.used - tex.bytes
+
+let evict m tex =
+	(match tex.source with
+	| Cached (width, height, _) ->
+		tex.pixels <- make_ubyte_array (width * height * 4);
+		glBindTexture gl_texture_2d tex.name;
+		glGetTexImage gl_texture_2d 0 gl_rgba gl_unsigned_byte tex.pixels
+	| Reload _ -> ());
+	unload m tex;
+	m.evictions <- m.evictions + 1
+
+let load m tex =
+	(match tex.source with
+	| Reload f ->
+		let name, bytes = f () in
+		tex.name <- name;
+		tex.bytes <- bytes
+	| Cached (width, height, mipmap) ->
+		if Bigarray.Array1.dim tex.pixels = 0 then invalid_argument "Residency.use: the texture has been removed";
+		let a = [| 0 |] in
+		glGenTextures 1 a;
+		glBindTexture gl_texture_2d a.(0);
+		glTexImage2D gl_texture_2d 0 gl_rgba8 width height 0 gl_rgba gl_unsigned_byte tex.pixels;
+		glTexParameteri gl_texture_2d gl_texture_mag_filter gl_linear;
+		if mipmap then begin
+			glTexParameteri gl_texture_2d gl_texture_min_filter gl_linear_mipmap_linear;
+			glGenerateMipmap gl_texture_2d
+		end else
+			glTexParameteri gl_texture_2d gl_texture_min_filter gl_linear;
+		tex.name <- a.(0);
+		tex.pixels <- no_pixels);
+	push m tex;
+	m.used <- m.used + tex.bytes
+
+(* Evict least recently used textures, except those used in this frame, until needed more bytes fit *)
+let rec make_room m needed =
+	if m.used + needed > m.budget then
+		match m.oldest with
+		| Some tex when tex.last_used < m.frame ->
+			evict m tex;
+			make_room m needed
+		| _ -> ()
+
+(** The name of a texture, loading it if needed, and mark it as used in this frame *)
+let use m tex =
+	tex.last_used <- m.frame;
+	if tex.name <> 0 then begin
+		m.hits <- m.hits + 1;
+		match m.newest with
+		| Some t when t == tex -> ()
+		| _ ->
+			unlink m tex;
+			push m tex
+	end else begin
+		m.misses <- m.misses + 1;
+		make_room m tex.bytes;
+		load m tex;
+		make_room m 0
+	end;
+	tex.name
+
+(** Bind a texture, loading it if needed *)
+let bind m target tex = glBindTexture target (use m tex)
+
+(** Start a new frame, evicting textures if the budget is exceeded *)
+let end_frame m =
+	m.frame <- m.frame + 1;
+	make_room m 0
+
+(** Delete a texture and forget it *)
+let remove m tex =
+	if tex.name <> 0 then unload m tex;
+	tex.pixels <- no_pixels
+
@@ -0,0 +1,141 @@
+
+(** Asynchronous shader compilation.
+	[submit q sources] queues a program built from (shader type, source) pairs and returns a job, and [update q],
+	called once per frame, moves the jobs along without waiting for the driver. With KHR_parallel_shader_compile
+	(or the ARB version) all submitted shaders are handed to the driver at once, which compiles and links them on
+	its own threads, and [update] only polls [gl_completion_status_khr]. Without it, [update] compiles and links
+	waiting programs one after the other until the time budget of q is spent, so the work is spread over frames.
+	[result job] is [Pending] until the program is linked. *)
+type result =
+	| Pending
+	| Ready of int
+	| Failed of string
+
+type job = {
+	sources : (int * string) list;
+	setup : int -> unit;
+	mutable shaders : int array;
+	mutable program : int;
+	mutable result : result
+}
+
+type t = {
+	mutable support : int;
+	budget : float;
+	waiting : job Queue.t;
+	mutable compiling : job list;
+	mutable linking : job list
+}
+
+(** Create a scheduler. budget is the time in seconds [update] may spend compiling when the driver cannot
+	compile in parallel *)
+let create ?(budget = 0.004) () = {
+	support = -1;
+	budget = budget;
+	waiting = Queue.create ();
+	compiling = [];
+	linking = []
+}
+
+(* 0: compile on this thread, 1: the driver compiles in parallel *)
+let support q =
+	if q.support < 0 then
+		q.support <-
+			if has_extension "GL_KHR_parallel_shader_compile" ||
+				has_extension "GL_ARB_parallel_shader_compile" then 1 else 0;
+	q.support
+
+(** Test whether the driver compiles shaders in parallel *)
+let available q = support q > 0
+
+(** The state of a job *)
+let result job = job.result
+
+(** Number of jobs that are not finished yet *)
+let pending q = Queue.length q.waiting + List.length q.compiling + List.length q.linking
+
+let fail job log =
+	Array.iter glDeleteShader job.shaders;
+	if job.program <> 0 then glDeleteProgram job.program;
+	job.shaders <- [||];
+	job.program <- 0;
+	job.result <- Failed log
+
+(* Create the shaders of the jobs and compile all of them in one call *)
+let compile jobs =
+	List.iter (fun job -> job.shaders <- Array.of_list (List.map (fun (kind, _) -> glCreateShader kind) job.sources)) jobs;
+	compile_shaders
+		(Array.concat (List.map (fun job -> job.shaders) jobs))
+		(Array.of_list (List.concat (List.map (fun job -> List.map (fun (_, src) -> [| src |]) job.sources) jobs)))
+
+(* Link the program of a compiled job; the link may still be running when this returns *)
+let link job =
+	let failed = List.filter (fun s -> not (status glGetShaderiv s gl_compile_status)) (Array.to_list job.shaders) in
+	match failed with
+	| s :: _ -> fail job (info_log glGetShaderiv glGetShaderInfoLog s)
+	| [] ->
+		let p = glCreateProgram () in
+		job.program <- p;
+		Array.iter (glAttachShader p) job.shaders;
+		job.setup p;
+		glLinkProgram p;
+		Array.iter (fun s -> glDetachShader p s; glDeleteShader s) job.shaders;
+		job.shaders <- [||]
+
+let finish job =
+	if job.result = Pending then
+		if status glGetProgramiv job.program gl_link_status then
+			job.result <- Ready job.program
+		else
+			fail job (info_log glGetProgramiv glGetProgramInfoLog job.program)
+
+let linked q job =
+	if job.result = Pending then q.linking <- job :: q.linking
+
+(** Queue programs built from lists of (shader type, source) pairs. With parallel compilation the shaders of
+	all of them are passed to the driver in a single call. setup is called with each program before it is linked *)
+let submit_all q ?(setup = fun _ -> ()) programs =
+	let jobs = List.map (fun sources -> { sources = sources; setup = setup; shaders = [||]; program = 0; result = Pending }) programs in
+	if support q > 0 then begin
+		compile jobs;
+		q.compiling <- List.rev_append jobs q.compiling
+	end else
+		List.iter (fun job -> Queue.add job q.waiting) jobs;
+	jobs
+
+(** Queue one program *)
+let submit q ?setup sources = List.hd (submit_all q ?setup [sources])
+
+(* Compile and link a job, waiting for the driver *)
+let build job =
+	compile [job];
+	link job;
+	finish job
+
+(** Move the jobs along: finish those the driver is done with, or compile waiting ones until the budget is spent *)
+let update q =
+	if support q > 0 then begin
+		let complete get o = status get o gl_completion_status_khr in
+		let linking, finished = List.partition (fun job -> not (complete glGetProgramiv job.program)) q.linking in
+		q.linking <- linking;
+		List.iter finish finished;
+		let compiling, compiled =
+			List.partition (fun job -> not (Array.for_all (complete glGetShaderiv) job.shaders)) q.compiling in
+		q.compiling <- compiling;
+		List.iter (fun job -> link job; linked q job) compiled
+	end else begin
+		let stop = monotonic_clock () +. q.budget in
+		while not (Queue.is_empty q.waiting) && monotonic_clock () < stop do
+			build (Queue.pop q.waiting)
+		done
+	end
+
+(** Finish every job now, waiting for the driver *)
+let flush q =
+	List.iter (fun job -> link job; linked q job) (List.rev q.compiling);
+	q.compiling <- [];
+	List.iter finish q.linking;
+	q.linking <- [];
+	Queue.iter build q.waiting;
+	Queue.clear q.waiting
+
@@ -0,0 +1,15 @@
+
+(** Call statistics.
+	When glcaml_stub.c is compiled with GLCAML_PROFILE defined ([make GLCAML_PROFILE=1]), every stub counts its
+	calls and the time spent in it, including the conversion of its arguments. [snapshot ()] returns the name,
+	number of calls and total seconds of every function called since the last [reset ()], most expensive first.
+	In a normal build nothing is counted, [enabled ()] is false and [snapshot ()] is empty. *)
+external enabled : unit -> bool = "glstub_stats_enabled"
+external snapshot' : unit -> (string * int * float) array = "glstub_stats_snapshot"
+external reset : unit -> unit = "glstub_stats_reset"
+
+let snapshot () =
+	let a = snapshot' () in
+	Array.stable_sort (fun (_, _, t) (_, _, t') -> compare t' t) a;
+	a
+
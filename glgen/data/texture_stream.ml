@@ -0,0 +1,73 @@
+
+(** Streaming textures.
+	A streaming texture owns a ring of pixel unpack buffers for updating the whole of a texture every frame, as for
+	video or software-rendered layers. [begin_update s] returns a [ubyte_array] that maps the next buffer of the
+	ring: the caller writes the new image into it (tightly packed rows, bottom-up, in the format and type given to
+	[create]). [end_update s] unmaps it and issues a [glTexSubImage2D] that sources from the buffer, so the copy into
+	the texture happens asynchronously on the GPU instead of synchronising with the driver. Each buffer is orphaned
+	before it is mapped, so writing never waits for a transfer that is still in progress.
+	The view returned by [begin_update] is invalid after [end_update], or after [cancel_update], which unmaps the
+	buffer without uploading it. [end_update] leaves the texture bound to its
+	target on the active texture unit. Requires OpenGL 2.1 or ARB_pixel_buffer_object. *)
+type t = {
+	texture : int;
+	target : int;
+	width : int;
+	height : int;
+	format : int;
+	typ : int;
+	bytes : int;
+	buffers : int array;
+	mutable next : int;
+	mutable mapped : bool
+}
+
+(** Create a streaming texture that updates level 0 of texture (of size width x height) on target *)
+let create ?(slots = 2) ?(target = gl_texture_2d) texture width height format typ =
+	let buffers = Array.make slots 0 in
+	glGenBuffers slots buffers;
+	{ texture = texture; target = target; width = width; height = height; format = format; typ = typ;
+	bytes = width * height * (Readback.pixel_size format typ); buffers = buffers; next = 0; mapped = false }
+
+(** Delete the buffers of s; the texture itself is left alone *)
+let destroy s = glDeleteBuffers (Array.length s.buffers) s.buffers
+
+(** Map the next buffer of s for writing the new image *)
+let begin_update s =
+	if s.mapped then invalid_argument "Texture_stream.begin_update: update already in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	glBufferData gl_pixel_unpack_buffer s.bytes 0 gl_stream_draw;
+	let v = Mapped.glMapBuffer gl_pixel_unpack_buffer gl_write_only Bigarray.int8_unsigned in
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- true;
+	v
+
+(** Unmap the buffer and upload it into the texture *)
+let end_update s =
+	if not s.mapped then invalid_argument "Texture_stream.end_update: no update in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	ignore (Mapped.glUnmapBuffer gl_pixel_unpack_buffer);
+	glBindTexture s.target s.texture;
+	let alignment = [| 0 |] in
+	glGetIntegerv gl_unpack_alignment alignment;
+	glPixelStorei gl_unpack_alignment 1;
+	glTexSubImage2D s.target 0 0 0 s.width s.height s.format s.typ 0;
+	glPixelStorei gl_unpack_alignment alignment.(0);
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- false;
+	s.next <- (s.next + 1) mod (Array.length s.buffers)
+
+(** Unmap the buffer without uploading it, leaving the texture as it was *)
+let cancel_update s =
+	if not s.mapped then invalid_argument "Texture_stream.cancel_update: no update in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	ignore (Mapped.glUnmapBuffer gl_pixel_unpack_buffer);
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- false
+
+(** Write a new image with f and upload it; if f raises, nothing is uploaded *)
+let update s f =
+	let v = begin_update s in
+	(try f v with e -> cancel_update s; raise e);
+	end_update s
+
@@ -24,6 +24,20 @@ let rec flatten l sep =
 
 (* -------------------------------- C function stubs ---------------------------------*)
 
+(* Is a parameter a scalar that can be passed without boxing or allocation? *)
+let is_scalar p =
+  match p.pptr with
+  | VOID -> true
+  | VARIABLE ->
+    (match translate_ml p.pname with
+      | "int" | "float" | "bool" -> true
+      | _ -> false)
+  | _ -> false
+
+(* Related: Does a function only take and return scalars? *)
+let is_scalar_func f =
+  (List.for_all is_scalar f.fparams) && (is_scalar f.freturn)
+
 (* Create stub parameter declarations *)
 let make_arg_list start nparams prefix =
   flatten
@@ -71,12 +85,12 @@ let make_stub_return f =
     (sprintf "\tCAMLreturn(result);\n")
 
 (* Make C stub code typedef declarations for a given function *)
-let make_typedef_decl f = ""
-  (* let arglist = flatten (List.map (fun i -> i.pname) f.fparams) ", " in *)
-  (* (sprintf "DECLARE_FUNCTION(%s,(%s),%s);\n" f.fname arglist f.freturn.pname) *)
+let make_typedef_decl f =
+  let arglist = flatten (List.map (fun i -> i.pname) f.fparams) ", " in
+  (sprintf "DECLARE_FUNCTION(%s,(%s),%s);\n" f.fname arglist f.freturn.pname)
 
-(* Make C stub function call *)
-let make_func_call f =
+(* Make C stub function call through the lazily loaded function pointer *)
+let make_func_call_with load f =
   let l = (List.length f.fparams) in
   let args =
     if (l = 1) && (let h = List.hd f.fparams in (h.pptr = VOID)) then
@@ -87,15 +101,30 @@ let make_func_call f =
   let return =
   if (f.freturn.pptr = VOID) then "" else "ret = "
   in
-  (sprintf "\t%s %s(%s);\n"  return f.fname args)
-  (* (sprintf "\tLOAD_FUNCTION(%s);\n"  f.fname) ^ *)
-  (* (sprintf "\t%s(*stub_%s)(%s);\n"  return f.fname args) *)
+  (sprintf "\t%s;\n" load) ^
+  (sprintf "\t%s(*stub_%s)(%s);\n"  return f.fname args)
+
+let make_func_call f =
+  make_func_call_with (sprintf "LOAD_FUNCTION(%s)" f.fname) f
+
+(* Test whether b occurs in a *)
+let has_substring a b =
+  let la = String.length a and lb = String.length b in
+  let rec at i = (i + lb <= la) && ((String.sub a i lb) = b || at (i + 1)) in
+  at 0
+
+(* Functions that keep their array argument after returning: OpenGL reads it at draw time *)
+let retains_pointer f =
+  (f.fname = "glInterleavedArrays") ||
+  ((has_substring f.fname "Pointer") && not (has_substring f.fname "glGet"))
 
 (* Load ML value into C type *)
-let ml_var_to_c i p =
+let ml_var_to_c f i p =
   match p.pptr with
   | VOID    -> ""
   | VARIABLE  ->  sprintf "\t%s lv%d = %s(v%d);\n" p.pname i (translate_val p.pname) i
+  | POINTER when (retains_pointer f) && (p.pname = "GLvoid*" || p.pname = "void*") ->
+    sprintf "\t%s lv%d = retained_pointer(v%d, \"%s\");\n" p.pname i i f.fname
   | POINTER   ->  sprintf "\t%s lv%d = %s;\n" p.pname i (translate_ptr p.pname (sprintf "v%d" i))
   | DOUBLEPOINTER -> sprintf "\t%s lv%d = %s;\n" p.pname i (translate_dblptr p.pname (sprintf "v%d" i))
 
@@ -103,7 +132,7 @@ let ml_var_to_c i p =
 let make_param_decl f =
   let vars =
   flatten (Array.to_list (Array.mapi
-    (fun i s -> ml_var_to_c i s) (Array.of_list f.fparams))) ""
+    (fun i s -> ml_var_to_c f i s) (Array.of_list f.fparams))) ""
   and ret = if (f.freturn.pptr = VOID) then "" else (sprintf  "\t%s ret;\n" f.freturn.pname)
   in
   vars ^ ret
@@ -124,6 +153,157 @@ let make_byte_decl f =
     (sprintf "\treturn glstub_%s(%s);\n}\n" f.fname params)
 
 
+(* Native C type of an unboxed or untagged scalar *)
+let native_type p =
+  if (p.pptr = VOID) then
+    "value"
+  else
+    match translate_ml p.pname with
+    | "int" -> "intnat"
+    | "float" -> "double"
+    | _ -> "value"
+
+(* Load unboxed ML value into C type *)
+let native_var_to_c i p =
+  match p.pptr with
+  | VOID -> ""
+  | _ ->
+    if (translate_ml p.pname) = "bool" then
+      sprintf "\t%s lv%d = Bool_val(v%d);\n" p.pname i i
+    else
+      sprintf "\t%s lv%d = v%d;\n" p.pname i i
+
+(* Make native stub return *)
+let make_native_return f =
+  if (f.freturn.pptr = VOID) then
+    "\treturn Val_unit;\n"
+  else if (translate_ml f.freturn.pname) = "bool" then
+    "\treturn Val_bool(ret);\n"
+  else
+    "\treturn ret;\n"
+
+(* Value returned by a native stub whose function is not available *)
+let native_unavailable f =
+  if (f.freturn.pptr = VOID) then
+    "Val_unit"
+  else if (translate_ml f.freturn.pname) = "bool" then
+    "Val_false"
+  else
+    "0"
+
+(* Checked build: printf conversion and value describing parameter i *)
+let check_arg i p =
+  match p.pptr with
+  | VOID -> []
+  | VARIABLE when p.pname = "GLenum" -> [("0x%lx", sprintf "(long)lv%d" i)]
+  | VARIABLE when (translate_ml p.pname) = "float" -> [("%g", sprintf "(double)lv%d" i)]
+  | VARIABLE when (translate_ml p.pname) = "string" -> [("%s", sprintf "(const char *)lv%d" i)]
+  | VARIABLE when (translate_ml p.pname) = "sync" -> [("%p", sprintf "(void *)lv%d" i)]
+  | VARIABLE -> [("%ld", sprintf "(long)lv%d" i)]
+  | _ -> [("%p", sprintf "(const void *)lv%d" i)]
+
+(* Checked build: report the GL error set by the call, with its arguments *)
+let make_error_check check f =
+  if f.fname = "glGetError" then
+    ""
+  else
+    let args = List.concat (List.mapi check_arg f.fparams) in
+    "#ifdef GLCAML_CHECKED\n" ^
+    (sprintf "\t%s(\"%s\", \"(%s)\"%s);\n" check f.fname
+      (flatten (List.map fst args) ", ")
+      (flatten (List.map (fun (_, a) -> ", " ^ a) args) "")) ^
+    "#endif\n"
+
+let is_prefix p s =
+  (String.length s >= String.length p) && (String.sub s 0 (String.length p) = p)
+
+(* The name without a trailing ARB, EXT or NV suffix, so that glUniform4fvARB is classified as glUniform4fv *)
+let base_name name =
+  let l = String.length name in
+  let ends s = l > String.length s && String.sub name (l - String.length s) (String.length s) = s in
+  if ends "ARB" || ends "EXT" then String.sub name 0 (l - 3)
+  else if ends "NV" then String.sub name 0 (l - 2)
+  else name
+
+(* Number of components of a vector function such as glVertex3fv or glVertexAttrib4Nubv, or 0 *)
+let vector_size name =
+  let l = String.length name in
+  let is_letter c = (c >= 'a' && c <= 'z') || c = 'N' in
+  let rec find i =
+    if i < 2 then 0
+    else if name.[i] >= '1' && name.[i] <= '4' then Char.code name.[i] - Char.code '0'
+    else if is_letter name.[i] then find (i - 1)
+    else 0
+  in
+  if l < 4 || name.[l - 1] <> 'v' || not (is_letter name.[l - 2]) then 0 else find (l - 2)
+
+(* Number of floats of one matrix of glUniformMatrix4fv or glUniformMatrix2x3fv *)
+let matrix_size name =
+  let k = String.length "glUniformMatrix" in
+  let d i = Char.code name.[i] - Char.code '0' in
+  if name.[k + 1] = 'x' then (d k) * (d (k + 2)) else (d k) * (d k)
+
+(* Vector functions that take a count of vectors just before the array, e.g. glVertexAttribs4fvNV *)
+let counted_vectors = ["glVertexAttribs"; "glProgramParameters"; "glProgramEnvParameters"; "glProgramLocalParameters"]
+
+(* Checked build: array arguments whose length follows from the other arguments.
+   Each check is the parameter, the length needed and whether it is counted in bytes *)
+let length_checks f =
+  let fparams = Array.of_list f.fparams in
+  let n = Array.length fparams in
+  let indices t = List.filter (fun i -> t fparams.(i)) (Array.to_list (Array.init n (fun i -> i))) in
+  let pointers = indices (fun p -> p.pptr = POINTER) in
+  let sizes = indices (fun p -> p.pname = "GLsizeiptr") in
+  let name = base_name f.fname in
+  match pointers, sizes with
+  | [p], _ when is_prefix "glUniformMatrix" name && n = 4 ->
+    [(p, sprintf "(intnat)lv1 * %d" (matrix_size name), 0)]
+  | [p], _ when is_prefix "glUniform" name && n = 3 && vector_size name > 0 ->
+    [(p, sprintf "(intnat)lv1 * %d" (vector_size name), 0)]
+  | [p], _ when (is_prefix "glGen" name || is_prefix "glDelete" name) && n = 2 && fparams.(0).pname = "GLsizei" ->
+    [(p, "(intnat)lv0", 0)]
+  | [p], [s] when fparams.(p).pname = "GLvoid*" ->
+    [(p, sprintf "(intnat)lv%d" s, 1)]
+  | [p], _ when p > 0 && vector_size name > 0 && List.exists (fun q -> is_prefix q name) counted_vectors ->
+    [(p, sprintf "(intnat)lv%d * %d" (p - 1) (vector_size name), 0)]
+  | [p], _ when vector_size name > 0 && not (is_prefix "glGet" name) ->
+    [(p, sprintf "%d" (vector_size name), 0)]
+  | _ -> []
+
+let make_length_check f =
+  match length_checks f with
+  | [] -> ""
+  | l ->
+    "#ifdef GLCAML_CHECKED\n" ^
+    (flatten (List.map (fun (p, len, bytes) -> sprintf "\tcheck_length(\"%s\", v%d, %s, %d);\n" f.fname p len bytes) l) "") ^
+    "#endif\n"
+
+(* Make native stub functions for scalar-only functions: unboxed floats and
+   untagged ints, no CAMLparam/CAMLreturn, called from ML as [@@noalloc] *)
+let make_native_decl f =
+  if not (is_scalar_func f) then
+    ""
+  else
+    let fparams = Array.of_list f.fparams in
+    let arglist =
+    flatten
+      (Array.to_list
+        (Array.mapi (fun i p -> sprintf "%s v%d" (native_type p) i) fparams)) ", "
+    and vars = flatten (Array.to_list (Array.mapi native_var_to_c fparams)) ""
+    and ret = if (f.freturn.pptr = VOID) then "" else (sprintf "\t%s ret;\n" f.freturn.pname)
+    in
+    (sprintf "\n%s glstub_%s_nat(%s)\n" (native_type f.freturn) f.fname arglist) ^
+    "{\n" ^
+    (sprintf "\tPROFILE_BEGIN(%s)\n" f.fname) ^
+    vars ^
+    ret ^
+    (make_func_call_with (sprintf "LOAD_FUNCTION_NOALLOC(%s, %s)" f.fname (native_unavailable f)) f) ^
+    (make_error_check "latch_error" f) ^
+    (sprintf "\tPROFILE_END(%s)\n" f.fname) ^
+    (make_native_return f) ^
+    "}\n"
+
+
 (* Make C stub function declaration for a given function *)
 let make_func_decl f =
   let arglist = make_arg_list 0 (List.length f.fparams) "value v" in
@@ -132,11 +312,75 @@ let make_func_decl f =
   "{\n" ^
   (make_caml_params f) ^
   (make_caml_local f) ^
+  (sprintf "\tPROFILE_BEGIN(%s)\n" f.fname) ^
   (make_param_decl f) ^
+  (make_length_check f) ^
   (make_func_call f) ^
+  (make_error_check "check_error" f) ^
+  (sprintf "\tPROFILE_END(%s)\n" f.fname) ^
   (make_stub_return f) ^
   "}\n"  ^
-  (make_byte_decl f)
+  (make_byte_decl f) ^
+  (make_native_decl f)
+
+
+(* Functions that can be recorded into a command buffer: scalar arguments, no result *)
+let cmdbuf_functions () =
+  List.filter (fun f -> (is_scalar_func f) && (f.freturn.pptr = VOID)) !qfunctions
+
+(* Number of operands of a recorded function *)
+let cmdbuf_arity f =
+  List.length (List.filter (fun p -> p.pptr <> VOID) f.fparams)
+
+(* Decode operand i of a recorded command into its C type *)
+let cmdbuf_operand i p =
+  if (translate_ml p.pname) = "float" then
+    sprintf "(%s)p[%d]" p.pname (i + 1)
+  else
+    sprintf "(%s)(intnat)p[%d]" p.pname (i + 1)
+
+(* Make command buffer dispatch case for opcode op *)
+let make_cmdbuf_case op f =
+  let n = cmdbuf_arity f in
+  let args =
+  flatten
+    (Array.to_list
+      (Array.mapi cmdbuf_operand (Array.of_list (List.filter (fun p -> p.pptr <> VOID) f.fparams)))) ", "
+  in
+  sprintf "\t\tcase %d: LOAD_FUNCTION(%s); (*stub_%s)(%s); p += %d; break;\n" op f.fname f.fname args (n + 1)
+
+(* Make command buffer interpreter *)
+let make_cmdbuf_decl () =
+  let cases =
+  flatten (List.mapi make_cmdbuf_case (cmdbuf_functions ())) ""
+  in
+  "value glstub_cmdbuf_execute(value v0, value v1)\n{\n" ^
+  "\tCAMLparam2(v0, v1);\n" ^
+  "\tdouble *p = Data_bigarray_val(v0);\n" ^
+  "\tdouble *end = p + Int_val(v1);\n" ^
+  "\twhile (p < end) {\n" ^
+  "\t\tswitch ((int)p[0]) {\n" ^
+  cases ^
+  "\t\tdefault: failwith(\"Cmdbuf.execute: invalid opcode\");\n" ^
+  "\t\t}\n" ^
+  "\t}\n" ^
+  "\tCAMLreturn(Val_unit);\n}\n"
+
+
+(* Make table of function pointers and call statistics, sorted by name, and the preload stub *)
+let make_preload_decl () =
+  let entries =
+  flatten (List.map (fun f -> sprintf "\t{\"%s\", (void **)&stub_%s, &stat_%s}" f.fname f.fname f.fname) !qfunctions) ",\n"
+  in
+  "static struct glstub_entry glstub_entries[] = {\n" ^ entries ^ "\n};\n\n" ^
+  "value glstub_preload(value v0)\n{\n" ^
+  "\tCAMLparam1(v0);\n" ^
+  "\tvalue l = v0;\n" ^
+  "\twhile (Is_block(l)) {\n" ^
+  "\t\tpreload_function(glstub_entries, sizeof(glstub_entries) / sizeof(glstub_entries[0]), String_val(Field(l, 0)));\n" ^
+  "\t\tl = Field(l, 1);\n" ^
+  "\t}\n" ^
+  "\tCAMLreturn(Val_unit);\n}\n\n"
 
 
 (* Create C stub file *)
@@ -145,7 +389,8 @@ let create_c_stub_file () =
   let src =
   List.fold_left (fun i f -> i ^ (sprintf "%s\n" (make_func_decl f))) header !qfunctions
   in
-  write_file src "output/glcaml_stub.c"
+  let footer = read_file "data/footer.c" in
+  write_file (src ^ (make_preload_decl ()) ^ (make_cmdbuf_decl ()) ^ footer) "output/glcaml_stub.c"
 
 
 (* -------------------------------- ML code ---------------------------------*)
@@ -177,16 +422,28 @@ let has_pointer_args f =
   List.fold_left (fun i p -> i || (is_bigarray p)) false f.fparams
 
 
+(* Translate a scalar to its unboxed/untagged native ML type *)
+let translate_native p =
+  match translate_ml p.pname with
+  | "int" when p.pptr = VARIABLE -> "(int [@untagged])"
+  | "float" when p.pptr = VARIABLE -> "(float [@unboxed])"
+  | s -> s
+
 (* Create normal GL function declarations *)
 let make_normal_ml_func_decl f =
-  let parms = flatten (List.map (fun i -> translate_ml i.pname) f.fparams) " -> "
-  and return = translate_ml f.freturn.pname
-  and byte = if (List.length f.fparams) < 6 then
+  let byte = if (List.length f.fparams) < 6 then
     (sprintf "glstub_%s" f.fname)
   else
     (sprintf "glstub_%s_byte" f.fname)
   in
-  sprintf "external %s: %s -> %s = \"%s\" \"glstub_%s\"\n" f.fname parms return byte f.fname
+  if is_scalar_func f then
+    let parms = flatten (List.map translate_native f.fparams) " -> "
+    and return = translate_native f.freturn in
+    sprintf "external %s: %s -> %s = \"%s\" \"glstub_%s_nat\" [@@noalloc]\n" f.fname parms return byte f.fname
+  else
+    let parms = flatten (List.map (fun i -> translate_ml i.pname) f.fparams) " -> "
+    and return = translate_ml f.freturn.pname in
+    sprintf "external %s: %s -> %s = \"%s\" \"glstub_%s\"\n" f.fname parms return byte f.fname
 
 
 (* Create extended GL function declarations (argument preprocessing) *)
@@ -250,13 +507,91 @@ let make_ml_func_decls () =
   List.fold_left (fun i f -> i ^ (mk f)) "" !qfunctions
 
 
+(* Create direct GL function declarations: the raw bigarray externals of
+   every function that has a converting wrapper, without conversion or copy-back *)
+let make_direct_ml_decls () =
+  let mk f =
+    if has_pointer_args f then
+      make_normal_ml_func_decl f
+    else
+      ""
+  in
+  "\nmodule Direct = struct\n" ^
+  (List.fold_left (fun i f -> i ^ (mk f)) "" !qfunctions) ^
+  "end\n"
+
+
+(* Encode operand i of a recorded command *)
+let cmdbuf_encode i p =
+  let arg = sprintf "p%d" i in
+  let v =
+    match translate_ml p.pname with
+    | "float" -> arg
+    | "bool" -> sprintf "(if %s then 1. else 0.)" arg
+    | _ -> sprintf "(float_of_int %s)" arg
+  in
+  sprintf "Bigarray.Array1.unsafe_set d (o + %d) %s;\n" (i + 1) v
+
+(* Create command buffer encoder for opcode op *)
+let make_cmdbuf_encoder op f =
+  let fparams = Array.of_list (List.filter (fun p -> p.pptr <> VOID) f.fparams) in
+  let arglist = flatten (Array.to_list (Array.mapi (fun i p -> sprintf " p%d" i) fparams)) "" in
+  (sprintf "let %s b%s =\n" f.fname arglist) ^
+  (sprintf "let o = reserve b %d in\n" ((Array.length fparams) + 1)) ^
+  "let d = b.data in\n" ^
+  (sprintf "Bigarray.Array1.unsafe_set d o %d.;\n" op) ^
+  (flatten (Array.to_list (Array.mapi cmdbuf_encode fparams)) "") ^
+  "()\n"
+
+(* Create command buffer module: runtime, opcode table and encoders *)
+let make_cmdbuf_ml_decls () =
+  let l = cmdbuf_functions () in
+  let table =
+  flatten (List.map (fun f -> sprintf "(\"%s\", %d)" f.fname (cmdbuf_arity f)) l) ";\n"
+  in
+  "\nmodule Cmdbuf = struct\n" ^
+  (read_file "data/cmdbuf.ml") ^
+  "let opcodes = [|\n" ^ table ^ "\n|]\n\n" ^
+  (flatten (List.mapi make_cmdbuf_encoder l) "") ^
+  "end\n"
+
+
+(* Create a submodule from a hand-written data file *)
+let make_data_module name file =
+  (sprintf "\nmodule %s = struct\n" name) ^
+  (read_file file) ^
+  "end\n"
+
 
 (* Create ML stub file *)
 let create_ml_stub_file () =
   let header = read_file "data/header.ml" in
   let decls = make_gl_constant_decls () in
   let funcs = make_ml_func_decls () in
-  let src = header ^ decls ^ funcs in
+  let direct = make_direct_ml_decls () in
+  let cmdbuf = make_cmdbuf_ml_decls () in
+  let helpers = read_file "data/helpers.ml" in
+  let cached = make_data_module "Cached" "data/cached.ml" in
+  let mapped = make_data_module "Mapped" "data/mapped.ml" in
+  let arena = make_data_module "Arena" "data/arena.ml" in
+  let readback = make_data_module "Readback" "data/readback.ml" in
+  let texture_stream = make_data_module "Texture_stream" "data/texture_stream.ml" in
+  let gpu_profiler = make_data_module "Gpu_profiler" "data/gpu_profiler.ml" in
+  let stats = make_data_module "Stats" "data/stats.ml" in
+  let batch = make_data_module "Batch" "data/batch.ml" in
+  let mat4 = make_data_module "Mat4" "data/mat4.ml" in
+  let recorder = make_data_module "Recorder" "data/recorder.ml" in
+  let program_cache = make_data_module "Program_cache" "data/program_cache.ml" in
+  let shader_compiler = make_data_module "Shader_compiler" "data/shader_compiler.ml" in
+  let fence = make_data_module "Fence" "data/fence.ml" in
+  let render_target = make_data_module "Render_target" "data/render_target.ml" in
+  let handle = make_data_module "Handle" "data/handle.ml" in
+  let residency = make_data_module "Residency" "data/residency.ml" in
+  let render_queue = make_data_module "Render_queue" "data/render_queue.ml" in
+  let src =
+    header ^ decls ^ funcs ^ direct ^ cmdbuf ^ helpers ^
+    cached ^ mapped ^ arena ^ readback ^ texture_stream ^ gpu_profiler ^ stats ^ batch ^ mat4 ^ recorder ^ program_cache ^ shader_compiler ^ fence ^ render_target ^ handle ^ residency ^ render_queue
+  in
   write_file src "output/glcaml.ml"
 
 
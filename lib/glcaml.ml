@@ -66,6 +66,9 @@ type int_matrix = (int, Bigarray.int_elt, Bigarray.c_layout) Bigarray.Array2.t
 type float_matrix = (float, Bigarray.float32_elt, Bigarray.c_layout) Bigarray.Array2.t
 type double_matrix = (float, Bigarray.float64_elt, Bigarray.c_layout) Bigarray.Array2.t
 
+(** Sync objects, as returned by [glFenceSync] *)
+type sync
+
 (** Create 1-dimensional arrays of the following types:
 	- 8-bit signed bytes
 	- 8-bit unsigned bytes
@@ -175,6 +178,33 @@ let int_to_bool_array i = Array.map bool_of_int i
 let copy_to_bool_array src dst = 
 	Array.mapi (fun i c -> dst.(i) <-  bool_of_int src.(i)) dst
 
+(** Resolve the named OpenGL functions now instead of on their first call.
+	Raises [Failure] if one of them is not provided by the OpenGL implementation,
+	and [Invalid_argument] if it is not a GLCaml function. *)
+external preload : string list -> unit = "glstub_preload"
+
+(** OpenGL functions are resolved lazily, so there is nothing to initialise any more.
+	Kept for compatibility with the GLEW-based versions of GLCaml; always returns 0 (GLEW_OK). *)
+let glewInit () = 0
+
+(** Raised with the name and the code of an OpenGL error. In checked builds the message also names the
+	function that set the error and its arguments. *)
+exception Gl_error of string * int
+let _ = Callback.register_exception "Glcaml.Gl_error" (Gl_error ("", 0))
+
+(** Raise [Gl_error] if OpenGL reports an error, or if a [@@noalloc] binding saw one in a checked build.
+	Raise [Failure] if a [@@noalloc] binding or [Handle.collect] found its OpenGL function missing. *)
+external check_error : unit -> unit = "glstub_check_error"
+
+(** Set the source of a shader to the concatenation of the strings, as [glShaderSource shader (Array.length strings)
+	strings lengths] does, but without converting any array: the lengths are those of the strings. *)
+external shader_source : int -> string array -> unit = "glstub_shader_source"
+
+(** [compile_shaders shaders sources] sets the source of each shader [shaders.(i)] to the strings [sources.(i)] and
+	compiles it, in a single call, e.g. to compile the permutations of a shader built from different prefixes.
+	Compile status and info logs are queried as usual. *)
+external compile_shaders : int array -> string array array -> unit = "glstub_compile_shaders"
+
 
 
 let gl_constant_color = 0x00008001
@@ -3013,17 +3043,119 @@ let gl_compressed_srgb = 0x00008c48
 let gl_compressed_srgb_alpha = 0x00008c49
 let gl_compressed_sluminance = 0x00008c4a
 let gl_compressed_sluminance_alpha = 0x00008c4b
-external glAccum: int -> float -> unit = "glstub_glAccum" "glstub_glAccum"
-external glActiveStencilFaceEXT: int -> unit = "glstub_glActiveStencilFaceEXT" "glstub_glActiveStencilFaceEXT"
-external glActiveTexture: int -> unit = "glstub_glActiveTexture" "glstub_glActiveTexture"
-external glActiveTextureARB: int -> unit = "glstub_glActiveTextureARB" "glstub_glActiveTextureARB"
+let gl_map_read_bit = 0x00000001
+let gl_map_write_bit = 0x00000002
+let gl_map_invalidate_range_bit = 0x00000004
+let gl_map_invalidate_buffer_bit = 0x00000008
+let gl_map_flush_explicit_bit = 0x00000010
+let gl_map_unsynchronized_bit = 0x00000020
+let gl_time_elapsed_ext = 0x000088bf
+let gl_time_elapsed = 0x000088bf
+let gl_timestamp = 0x00008e28
+let gl_major_version = 0x0000821b
+let gl_minor_version = 0x0000821c
+let gl_num_extensions = 0x0000821d
+let gl_context_flags = 0x0000821e
+let gl_rgba32f = 0x00008814
+let gl_rgb32f = 0x00008815
+let gl_rgba16f = 0x0000881a
+let gl_rgb16f = 0x0000881b
+let gl_half_float = 0x0000140b
+let gl_rg = 0x00008227
+let gl_rg_integer = 0x00008228
+let gl_r8 = 0x00008229
+let gl_r16 = 0x0000822a
+let gl_rg8 = 0x0000822b
+let gl_rg16 = 0x0000822c
+let gl_r16f = 0x0000822d
+let gl_r32f = 0x0000822e
+let gl_rg16f = 0x0000822f
+let gl_rg32f = 0x00008230
+let gl_depth_component32f = 0x00008cac
+let gl_depth32f_stencil8 = 0x00008cad
+let gl_depth_stencil = 0x000084f9
+let gl_unsigned_int_24_8 = 0x000084fa
+let gl_depth24_stencil8 = 0x000088f0
+let gl_framebuffer = 0x00008d40
+let gl_read_framebuffer = 0x00008ca8
+let gl_draw_framebuffer = 0x00008ca9
+let gl_renderbuffer = 0x00008d41
+let gl_framebuffer_complete = 0x00008cd5
+let gl_framebuffer_binding = 0x00008ca6
+let gl_draw_framebuffer_binding = 0x00008ca6
+let gl_read_framebuffer_binding = 0x00008caa
+let gl_renderbuffer_binding = 0x00008ca7
+let gl_color_attachment0 = 0x00008ce0
+let gl_color_attachment1 = 0x00008ce1
+let gl_color_attachment2 = 0x00008ce2
+let gl_color_attachment3 = 0x00008ce3
+let gl_depth_attachment = 0x00008d00
+let gl_stencil_attachment = 0x00008d20
+let gl_depth_stencil_attachment = 0x0000821a
+let gl_max_samples = 0x00008d57
+let gl_vertex_array_binding = 0x000085b5
+let gl_copy_read_buffer = 0x00008f36
+let gl_copy_write_buffer = 0x00008f37
+let gl_uniform_buffer = 0x00008a11
+let gl_uniform_buffer_binding = 0x00008a28
+let gl_texture_buffer = 0x00008c2a
+let gl_primitive_restart = 0x00008f9d
+let gl_primitive_restart_index = 0x00008f9e
+let gl_context_core_profile_bit = 0x00000001
+let gl_context_compatibility_profile_bit = 0x00000002
+let gl_context_profile_mask = 0x00009126
+let gl_program_point_size = 0x00008642
+let gl_texture_2d_multisample = 0x00009100
+let gl_max_server_wait_timeout = 0x00009111
+let gl_object_type = 0x00009112
+let gl_sync_condition = 0x00009113
+let gl_sync_status = 0x00009114
+let gl_sync_flags = 0x00009115
+let gl_sync_fence = 0x00009116
+let gl_sync_gpu_commands_complete = 0x00009117
+let gl_unsignaled = 0x00009118
+let gl_signaled = 0x00009119
+let gl_already_signaled = 0x0000911a
+let gl_timeout_expired = 0x0000911b
+let gl_condition_satisfied = 0x0000911c
+let gl_wait_failed = 0x0000911d
+let gl_sync_flush_commands_bit = 0x00000001
+let gl_vertex_attrib_array_divisor = 0x000088fe
+let gl_sampler_binding = 0x00008919
+let gl_any_samples_passed = 0x00008c2f
+let gl_draw_indirect_buffer = 0x00008f3f
+let gl_draw_indirect_buffer_binding = 0x00008f43
+let gl_atomic_counter_buffer = 0x000092c0
+let gl_atomic_counter_buffer_binding = 0x000092c1
+let gl_shader_storage_buffer = 0x000090d2
+let gl_shader_storage_buffer_binding = 0x000090d3
+let gl_dispatch_indirect_buffer = 0x000090ee
+let gl_dispatch_indirect_buffer_binding = 0x000090ef
+let gl_query_buffer = 0x00009192
+let gl_query_buffer_binding = 0x00009193
+let gl_map_persistent_bit = 0x00000040
+let gl_map_coherent_bit = 0x00000080
+let gl_dynamic_storage_bit = 0x00000100
+let gl_client_storage_bit = 0x00000200
+let gl_program_binary_retrievable_hint = 0x00008257
+let gl_program_binary_length = 0x00008741
+let gl_num_program_binary_formats = 0x000087fe
+let gl_program_binary_formats = 0x000087ff
+let gl_max_shader_compiler_threads_khr = 0x000091b0
+let gl_completion_status_khr = 0x000091b1
+let gl_max_shader_compiler_threads_arb = 0x000091b0
+let gl_completion_status_arb = 0x000091b1
+external glAccum: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glAccum" "glstub_glAccum_nat" [@@noalloc]
+external glActiveStencilFaceEXT: (int [@untagged]) -> unit = "glstub_glActiveStencilFaceEXT" "glstub_glActiveStencilFaceEXT_nat" [@@noalloc]
+external glActiveTexture: (int [@untagged]) -> unit = "glstub_glActiveTexture" "glstub_glActiveTexture_nat" [@@noalloc]
+external glActiveTextureARB: (int [@untagged]) -> unit = "glstub_glActiveTextureARB" "glstub_glActiveTextureARB_nat" [@@noalloc]
 external glActiveVaryingNV: int -> string -> unit = "glstub_glActiveVaryingNV" "glstub_glActiveVaryingNV"
-external glAddSwapHintRectWIN: int -> int -> int -> int -> unit = "glstub_glAddSwapHintRectWIN" "glstub_glAddSwapHintRectWIN"
-external glAlphaFragmentOp1ATI: int -> int -> int -> int -> int -> int -> unit = "glstub_glAlphaFragmentOp1ATI_byte" "glstub_glAlphaFragmentOp1ATI"
-external glAlphaFragmentOp2ATI: int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glAlphaFragmentOp2ATI_byte" "glstub_glAlphaFragmentOp2ATI"
-external glAlphaFragmentOp3ATI: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glAlphaFragmentOp3ATI_byte" "glstub_glAlphaFragmentOp3ATI"
-external glAlphaFunc: int -> float -> unit = "glstub_glAlphaFunc" "glstub_glAlphaFunc"
-external glApplyTextureEXT: int -> unit = "glstub_glApplyTextureEXT" "glstub_glApplyTextureEXT"
+external glAddSwapHintRectWIN: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAddSwapHintRectWIN" "glstub_glAddSwapHintRectWIN_nat" [@@noalloc]
+external glAlphaFragmentOp1ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAlphaFragmentOp1ATI_byte" "glstub_glAlphaFragmentOp1ATI_nat" [@@noalloc]
+external glAlphaFragmentOp2ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAlphaFragmentOp2ATI_byte" "glstub_glAlphaFragmentOp2ATI_nat" [@@noalloc]
+external glAlphaFragmentOp3ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAlphaFragmentOp3ATI_byte" "glstub_glAlphaFragmentOp3ATI_nat" [@@noalloc]
+external glAlphaFunc: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glAlphaFunc" "glstub_glAlphaFunc_nat" [@@noalloc]
+external glApplyTextureEXT: (int [@untagged]) -> unit = "glstub_glApplyTextureEXT" "glstub_glApplyTextureEXT_nat" [@@noalloc]
 
 external glAreProgramsResidentNV: int -> word_array -> word_array -> bool = "glstub_glAreProgramsResidentNV" "glstub_glAreProgramsResidentNV"
 let glAreProgramsResidentNV p0 p1 p2 =
@@ -3059,43 +3191,48 @@ let _ = copy_word_array np2 bp2 in
 let _ = copy_to_bool_array bp2 p2 in
 r
 
-external glArrayElement: int -> unit = "glstub_glArrayElement" "glstub_glArrayElement"
-external glArrayElementEXT: int -> unit = "glstub_glArrayElementEXT" "glstub_glArrayElementEXT"
-external glArrayObjectATI: int -> int -> int -> int -> int -> int -> unit = "glstub_glArrayObjectATI_byte" "glstub_glArrayObjectATI"
-external glAsyncMarkerSGIX: int -> unit = "glstub_glAsyncMarkerSGIX" "glstub_glAsyncMarkerSGIX"
-external glAttachObjectARB: int -> int -> unit = "glstub_glAttachObjectARB" "glstub_glAttachObjectARB"
-external glAttachShader: int -> int -> unit = "glstub_glAttachShader" "glstub_glAttachShader"
-external glBegin: int -> unit = "glstub_glBegin" "glstub_glBegin"
-external glBeginFragmentShaderATI: unit -> unit = "glstub_glBeginFragmentShaderATI" "glstub_glBeginFragmentShaderATI"
-external glBeginOcclusionQueryNV: int -> unit = "glstub_glBeginOcclusionQueryNV" "glstub_glBeginOcclusionQueryNV"
-external glBeginQuery: int -> int -> unit = "glstub_glBeginQuery" "glstub_glBeginQuery"
-external glBeginQueryARB: int -> int -> unit = "glstub_glBeginQueryARB" "glstub_glBeginQueryARB"
-external glBeginSceneEXT: unit -> unit = "glstub_glBeginSceneEXT" "glstub_glBeginSceneEXT"
-external glBeginTransformFeedbackNV: int -> unit = "glstub_glBeginTransformFeedbackNV" "glstub_glBeginTransformFeedbackNV"
-external glBeginVertexShaderEXT: unit -> unit = "glstub_glBeginVertexShaderEXT" "glstub_glBeginVertexShaderEXT"
+external glArrayElement: (int [@untagged]) -> unit = "glstub_glArrayElement" "glstub_glArrayElement_nat" [@@noalloc]
+external glArrayElementEXT: (int [@untagged]) -> unit = "glstub_glArrayElementEXT" "glstub_glArrayElementEXT_nat" [@@noalloc]
+external glArrayObjectATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glArrayObjectATI_byte" "glstub_glArrayObjectATI_nat" [@@noalloc]
+external glAsyncMarkerSGIX: (int [@untagged]) -> unit = "glstub_glAsyncMarkerSGIX" "glstub_glAsyncMarkerSGIX_nat" [@@noalloc]
+external glAttachObjectARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAttachObjectARB" "glstub_glAttachObjectARB_nat" [@@noalloc]
+external glAttachShader: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glAttachShader" "glstub_glAttachShader_nat" [@@noalloc]
+external glBegin: (int [@untagged]) -> unit = "glstub_glBegin" "glstub_glBegin_nat" [@@noalloc]
+external glBeginFragmentShaderATI: unit -> unit = "glstub_glBeginFragmentShaderATI" "glstub_glBeginFragmentShaderATI_nat" [@@noalloc]
+external glBeginOcclusionQueryNV: (int [@untagged]) -> unit = "glstub_glBeginOcclusionQueryNV" "glstub_glBeginOcclusionQueryNV_nat" [@@noalloc]
+external glBeginQuery: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBeginQuery" "glstub_glBeginQuery_nat" [@@noalloc]
+external glBeginQueryARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBeginQueryARB" "glstub_glBeginQueryARB_nat" [@@noalloc]
+external glBeginSceneEXT: unit -> unit = "glstub_glBeginSceneEXT" "glstub_glBeginSceneEXT_nat" [@@noalloc]
+external glBeginTransformFeedbackNV: (int [@untagged]) -> unit = "glstub_glBeginTransformFeedbackNV" "glstub_glBeginTransformFeedbackNV_nat" [@@noalloc]
+external glBeginVertexShaderEXT: unit -> unit = "glstub_glBeginVertexShaderEXT" "glstub_glBeginVertexShaderEXT_nat" [@@noalloc]
 external glBindAttribLocation: int -> int -> string -> unit = "glstub_glBindAttribLocation" "glstub_glBindAttribLocation"
 external glBindAttribLocationARB: int -> int -> string -> unit = "glstub_glBindAttribLocationARB" "glstub_glBindAttribLocationARB"
-external glBindBuffer: int -> int -> unit = "glstub_glBindBuffer" "glstub_glBindBuffer"
-external glBindBufferARB: int -> int -> unit = "glstub_glBindBufferARB" "glstub_glBindBufferARB"
-external glBindBufferBaseNV: int -> int -> int -> unit = "glstub_glBindBufferBaseNV" "glstub_glBindBufferBaseNV"
-external glBindBufferOffsetNV: int -> int -> int -> int -> unit = "glstub_glBindBufferOffsetNV" "glstub_glBindBufferOffsetNV"
-external glBindBufferRangeNV: int -> int -> int -> int -> int -> unit = "glstub_glBindBufferRangeNV" "glstub_glBindBufferRangeNV"
+external glBindBuffer: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBuffer" "glstub_glBindBuffer_nat" [@@noalloc]
+external glBindBufferARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferARB" "glstub_glBindBufferARB_nat" [@@noalloc]
+external glBindBufferBase: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferBase" "glstub_glBindBufferBase_nat" [@@noalloc]
+external glBindBufferBaseNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferBaseNV" "glstub_glBindBufferBaseNV_nat" [@@noalloc]
+external glBindBufferOffsetNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferOffsetNV" "glstub_glBindBufferOffsetNV_nat" [@@noalloc]
+external glBindBufferRange: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferRange" "glstub_glBindBufferRange_nat" [@@noalloc]
+external glBindBufferRangeNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindBufferRangeNV" "glstub_glBindBufferRangeNV_nat" [@@noalloc]
 external glBindFragDataLocationEXT: int -> int -> string -> unit = "glstub_glBindFragDataLocationEXT" "glstub_glBindFragDataLocationEXT"
-external glBindFragmentShaderATI: int -> unit = "glstub_glBindFragmentShaderATI" "glstub_glBindFragmentShaderATI"
-external glBindFramebufferEXT: int -> int -> unit = "glstub_glBindFramebufferEXT" "glstub_glBindFramebufferEXT"
-external glBindLightParameterEXT: int -> int -> int = "glstub_glBindLightParameterEXT" "glstub_glBindLightParameterEXT"
-external glBindMaterialParameterEXT: int -> int -> int = "glstub_glBindMaterialParameterEXT" "glstub_glBindMaterialParameterEXT"
-external glBindParameterEXT: int -> int = "glstub_glBindParameterEXT" "glstub_glBindParameterEXT"
-external glBindProgramARB: int -> int -> unit = "glstub_glBindProgramARB" "glstub_glBindProgramARB"
-external glBindProgramNV: int -> int -> unit = "glstub_glBindProgramNV" "glstub_glBindProgramNV"
-external glBindRenderbufferEXT: int -> int -> unit = "glstub_glBindRenderbufferEXT" "glstub_glBindRenderbufferEXT"
-external glBindTexGenParameterEXT: int -> int -> int -> int = "glstub_glBindTexGenParameterEXT" "glstub_glBindTexGenParameterEXT"
-external glBindTexture: int -> int -> unit = "glstub_glBindTexture" "glstub_glBindTexture"
-external glBindTextureEXT: int -> int -> unit = "glstub_glBindTextureEXT" "glstub_glBindTextureEXT"
-external glBindTextureUnitParameterEXT: int -> int -> int = "glstub_glBindTextureUnitParameterEXT" "glstub_glBindTextureUnitParameterEXT"
-external glBindVertexArray: int -> unit = "glstub_glBindVertexArray" "glstub_glBindVertexArray"
-external glBindVertexArrayAPPLE: int -> unit = "glstub_glBindVertexArrayAPPLE" "glstub_glBindVertexArrayAPPLE"
-external glBindVertexShaderEXT: int -> unit = "glstub_glBindVertexShaderEXT" "glstub_glBindVertexShaderEXT"
+external glBindFragmentShaderATI: (int [@untagged]) -> unit = "glstub_glBindFragmentShaderATI" "glstub_glBindFragmentShaderATI_nat" [@@noalloc]
+external glBindFramebuffer: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindFramebuffer" "glstub_glBindFramebuffer_nat" [@@noalloc]
+external glBindFramebufferEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindFramebufferEXT" "glstub_glBindFramebufferEXT_nat" [@@noalloc]
+external glBindLightParameterEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glBindLightParameterEXT" "glstub_glBindLightParameterEXT_nat" [@@noalloc]
+external glBindMaterialParameterEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glBindMaterialParameterEXT" "glstub_glBindMaterialParameterEXT_nat" [@@noalloc]
+external glBindParameterEXT: (int [@untagged]) -> (int [@untagged]) = "glstub_glBindParameterEXT" "glstub_glBindParameterEXT_nat" [@@noalloc]
+external glBindProgramARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindProgramARB" "glstub_glBindProgramARB_nat" [@@noalloc]
+external glBindProgramNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindProgramNV" "glstub_glBindProgramNV_nat" [@@noalloc]
+external glBindRenderbuffer: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindRenderbuffer" "glstub_glBindRenderbuffer_nat" [@@noalloc]
+external glBindRenderbufferEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindRenderbufferEXT" "glstub_glBindRenderbufferEXT_nat" [@@noalloc]
+external glBindSampler: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindSampler" "glstub_glBindSampler_nat" [@@noalloc]
+external glBindTexGenParameterEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glBindTexGenParameterEXT" "glstub_glBindTexGenParameterEXT_nat" [@@noalloc]
+external glBindTexture: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindTexture" "glstub_glBindTexture_nat" [@@noalloc]
+external glBindTextureEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBindTextureEXT" "glstub_glBindTextureEXT_nat" [@@noalloc]
+external glBindTextureUnitParameterEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glBindTextureUnitParameterEXT" "glstub_glBindTextureUnitParameterEXT_nat" [@@noalloc]
+external glBindVertexArray: (int [@untagged]) -> unit = "glstub_glBindVertexArray" "glstub_glBindVertexArray_nat" [@@noalloc]
+external glBindVertexArrayAPPLE: (int [@untagged]) -> unit = "glstub_glBindVertexArrayAPPLE" "glstub_glBindVertexArrayAPPLE_nat" [@@noalloc]
+external glBindVertexShaderEXT: (int [@untagged]) -> unit = "glstub_glBindVertexShaderEXT" "glstub_glBindVertexShaderEXT_nat" [@@noalloc]
 external glBinormalPointerEXT: int -> int -> 'a -> unit = "glstub_glBinormalPointerEXT" "glstub_glBinormalPointerEXT"
 
 external glBitmap: int -> int -> float -> float -> float -> float -> ubyte_array -> unit = "glstub_glBitmap_byte" "glstub_glBitmap"
@@ -3104,37 +3241,55 @@ let np6 = to_ubyte_array p6 in
 let r = glBitmap p0 p1 p2 p3 p4 p5 np6 in
 r
 
-external glBlendColor: float -> float -> float -> float -> unit = "glstub_glBlendColor" "glstub_glBlendColor"
-external glBlendColorEXT: float -> float -> float -> float -> unit = "glstub_glBlendColorEXT" "glstub_glBlendColorEXT"
-external glBlendEquation: int -> unit = "glstub_glBlendEquation" "glstub_glBlendEquation"
-external glBlendEquationEXT: int -> unit = "glstub_glBlendEquationEXT" "glstub_glBlendEquationEXT"
-external glBlendEquationSeparate: int -> int -> unit = "glstub_glBlendEquationSeparate" "glstub_glBlendEquationSeparate"
-external glBlendEquationSeparateEXT: int -> int -> unit = "glstub_glBlendEquationSeparateEXT" "glstub_glBlendEquationSeparateEXT"
-external glBlendFunc: int -> int -> unit = "glstub_glBlendFunc" "glstub_glBlendFunc"
-external glBlendFuncSeparate: int -> int -> int -> int -> unit = "glstub_glBlendFuncSeparate" "glstub_glBlendFuncSeparate"
-external glBlendFuncSeparateEXT: int -> int -> int -> int -> unit = "glstub_glBlendFuncSeparateEXT" "glstub_glBlendFuncSeparateEXT"
-external glBlitFramebufferEXT: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glBlitFramebufferEXT_byte" "glstub_glBlitFramebufferEXT"
+external glBlendColor: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glBlendColor" "glstub_glBlendColor_nat" [@@noalloc]
+external glBlendColorEXT: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glBlendColorEXT" "glstub_glBlendColorEXT_nat" [@@noalloc]
+external glBlendEquation: (int [@untagged]) -> unit = "glstub_glBlendEquation" "glstub_glBlendEquation_nat" [@@noalloc]
+external glBlendEquationEXT: (int [@untagged]) -> unit = "glstub_glBlendEquationEXT" "glstub_glBlendEquationEXT_nat" [@@noalloc]
+external glBlendEquationSeparate: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlendEquationSeparate" "glstub_glBlendEquationSeparate_nat" [@@noalloc]
+external glBlendEquationSeparateEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlendEquationSeparateEXT" "glstub_glBlendEquationSeparateEXT_nat" [@@noalloc]
+external glBlendFunc: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlendFunc" "glstub_glBlendFunc_nat" [@@noalloc]
+external glBlendFuncSeparate: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlendFuncSeparate" "glstub_glBlendFuncSeparate_nat" [@@noalloc]
+external glBlendFuncSeparateEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlendFuncSeparateEXT" "glstub_glBlendFuncSeparateEXT_nat" [@@noalloc]
+external glBlitFramebuffer: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlitFramebuffer_byte" "glstub_glBlitFramebuffer_nat" [@@noalloc]
+external glBlitFramebufferEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glBlitFramebufferEXT_byte" "glstub_glBlitFramebufferEXT_nat" [@@noalloc]
 external glBufferData: int -> int -> 'a -> int -> unit = "glstub_glBufferData" "glstub_glBufferData"
 external glBufferDataARB: int -> int -> 'a -> int -> unit = "glstub_glBufferDataARB" "glstub_glBufferDataARB"
+external glBufferStorage: int -> int -> 'a -> int -> unit = "glstub_glBufferStorage" "glstub_glBufferStorage"
 external glBufferSubData: int -> int -> int -> 'a -> unit = "glstub_glBufferSubData" "glstub_glBufferSubData"
 external glBufferSubDataARB: int -> int -> int -> 'a -> unit = "glstub_glBufferSubDataARB" "glstub_glBufferSubDataARB"
-external glCallList: int -> unit = "glstub_glCallList" "glstub_glCallList"
+external glCallList: (int [@untagged]) -> unit = "glstub_glCallList" "glstub_glCallList_nat" [@@noalloc]
 external glCallLists: int -> int -> 'a -> unit = "glstub_glCallLists" "glstub_glCallLists"
-external glCheckFramebufferStatusEXT: int -> int = "glstub_glCheckFramebufferStatusEXT" "glstub_glCheckFramebufferStatusEXT"
-external glClampColorARB: int -> int -> unit = "glstub_glClampColorARB" "glstub_glClampColorARB"
-external glClear: int -> unit = "glstub_glClear" "glstub_glClear"
-external glClearAccum: float -> float -> float -> float -> unit = "glstub_glClearAccum" "glstub_glClearAccum"
-external glClearColor: float -> float -> float -> float -> unit = "glstub_glClearColor" "glstub_glClearColor"
-external glClearColorIiEXT: int -> int -> int -> int -> unit = "glstub_glClearColorIiEXT" "glstub_glClearColorIiEXT"
-external glClearColorIuiEXT: int -> int -> int -> int -> unit = "glstub_glClearColorIuiEXT" "glstub_glClearColorIuiEXT"
-external glClearDepth: float -> unit = "glstub_glClearDepth" "glstub_glClearDepth"
-external glClearDepthdNV: float -> unit = "glstub_glClearDepthdNV" "glstub_glClearDepthdNV"
-external glClearDepthfOES: float -> unit = "glstub_glClearDepthfOES" "glstub_glClearDepthfOES"
-external glClearIndex: float -> unit = "glstub_glClearIndex" "glstub_glClearIndex"
-external glClearStencil: int -> unit = "glstub_glClearStencil" "glstub_glClearStencil"
-external glClientActiveTexture: int -> unit = "glstub_glClientActiveTexture" "glstub_glClientActiveTexture"
-external glClientActiveTextureARB: int -> unit = "glstub_glClientActiveTextureARB" "glstub_glClientActiveTextureARB"
-external glClientActiveVertexStreamATI: int -> unit = "glstub_glClientActiveVertexStreamATI" "glstub_glClientActiveVertexStreamATI"
+external glCheckFramebufferStatus: (int [@untagged]) -> (int [@untagged]) = "glstub_glCheckFramebufferStatus" "glstub_glCheckFramebufferStatus_nat" [@@noalloc]
+external glCheckFramebufferStatusEXT: (int [@untagged]) -> (int [@untagged]) = "glstub_glCheckFramebufferStatusEXT" "glstub_glCheckFramebufferStatusEXT_nat" [@@noalloc]
+external glClampColorARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glClampColorARB" "glstub_glClampColorARB_nat" [@@noalloc]
+external glClear: (int [@untagged]) -> unit = "glstub_glClear" "glstub_glClear_nat" [@@noalloc]
+external glClearAccum: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glClearAccum" "glstub_glClearAccum_nat" [@@noalloc]
+
+external glClearBufferfv: int -> int -> float_array -> unit = "glstub_glClearBufferfv" "glstub_glClearBufferfv"
+let glClearBufferfv p0 p1 p2 =
+let np2 = to_float_array p2 in
+let r = glClearBufferfv p0 p1 np2 in
+r
+
+
+external glClearBufferiv: int -> int -> word_array -> unit = "glstub_glClearBufferiv" "glstub_glClearBufferiv"
+let glClearBufferiv p0 p1 p2 =
+let np2 = to_word_array p2 in
+let r = glClearBufferiv p0 p1 np2 in
+r
+
+external glClearColor: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glClearColor" "glstub_glClearColor_nat" [@@noalloc]
+external glClearColorIiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glClearColorIiEXT" "glstub_glClearColorIiEXT_nat" [@@noalloc]
+external glClearColorIuiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glClearColorIuiEXT" "glstub_glClearColorIuiEXT_nat" [@@noalloc]
+external glClearDepth: (float [@unboxed]) -> unit = "glstub_glClearDepth" "glstub_glClearDepth_nat" [@@noalloc]
+external glClearDepthdNV: (float [@unboxed]) -> unit = "glstub_glClearDepthdNV" "glstub_glClearDepthdNV_nat" [@@noalloc]
+external glClearDepthfOES: (float [@unboxed]) -> unit = "glstub_glClearDepthfOES" "glstub_glClearDepthfOES_nat" [@@noalloc]
+external glClearIndex: (float [@unboxed]) -> unit = "glstub_glClearIndex" "glstub_glClearIndex_nat" [@@noalloc]
+external glClearStencil: (int [@untagged]) -> unit = "glstub_glClearStencil" "glstub_glClearStencil_nat" [@@noalloc]
+external glClientActiveTexture: (int [@untagged]) -> unit = "glstub_glClientActiveTexture" "glstub_glClientActiveTexture_nat" [@@noalloc]
+external glClientActiveTextureARB: (int [@untagged]) -> unit = "glstub_glClientActiveTextureARB" "glstub_glClientActiveTextureARB_nat" [@@noalloc]
+external glClientActiveVertexStreamATI: (int [@untagged]) -> unit = "glstub_glClientActiveVertexStreamATI" "glstub_glClientActiveVertexStreamATI_nat" [@@noalloc]
+external glClientWaitSync: sync -> int -> int -> int = "glstub_glClientWaitSync" "glstub_glClientWaitSync"
 external glClipPlane: int -> float array -> unit = "glstub_glClipPlane" "glstub_glClipPlane"
 
 external glClipPlanefOES: int -> float_array -> unit = "glstub_glClipPlanefOES" "glstub_glClipPlanefOES"
@@ -3144,7 +3299,7 @@ let r = glClipPlanefOES p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glColor3b: int -> int -> int -> unit = "glstub_glColor3b" "glstub_glColor3b"
+external glColor3b: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3b" "glstub_glColor3b_nat" [@@noalloc]
 
 external glColor3bv: byte_array -> unit = "glstub_glColor3bv" "glstub_glColor3bv"
 let glColor3bv p0 =
@@ -3152,10 +3307,10 @@ let np0 = to_byte_array p0 in
 let r = glColor3bv np0 in
 r
 
-external glColor3d: float -> float -> float -> unit = "glstub_glColor3d" "glstub_glColor3d"
+external glColor3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor3d" "glstub_glColor3d_nat" [@@noalloc]
 external glColor3dv: float array -> unit = "glstub_glColor3dv" "glstub_glColor3dv"
-external glColor3f: float -> float -> float -> unit = "glstub_glColor3f" "glstub_glColor3f"
-external glColor3fVertex3fSUN: float -> float -> float -> float -> float -> float -> unit = "glstub_glColor3fVertex3fSUN_byte" "glstub_glColor3fVertex3fSUN"
+external glColor3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor3f" "glstub_glColor3f_nat" [@@noalloc]
+external glColor3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor3fVertex3fSUN_byte" "glstub_glColor3fVertex3fSUN_nat" [@@noalloc]
 
 external glColor3fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glColor3fVertex3fvSUN" "glstub_glColor3fVertex3fvSUN"
 let glColor3fVertex3fvSUN p0 p1 =
@@ -3173,7 +3328,7 @@ let np0 = to_float_array p0 in
 let r = glColor3fv np0 in
 r
 
-external glColor3hNV: int -> int -> int -> unit = "glstub_glColor3hNV" "glstub_glColor3hNV"
+external glColor3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3hNV" "glstub_glColor3hNV_nat" [@@noalloc]
 
 external glColor3hvNV: ushort_array -> unit = "glstub_glColor3hvNV" "glstub_glColor3hvNV"
 let glColor3hvNV p0 =
@@ -3182,7 +3337,7 @@ let r = glColor3hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glColor3i: int -> int -> int -> unit = "glstub_glColor3i" "glstub_glColor3i"
+external glColor3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3i" "glstub_glColor3i_nat" [@@noalloc]
 
 external glColor3iv: word_array -> unit = "glstub_glColor3iv" "glstub_glColor3iv"
 let glColor3iv p0 =
@@ -3190,7 +3345,7 @@ let np0 = to_word_array p0 in
 let r = glColor3iv np0 in
 r
 
-external glColor3s: int -> int -> int -> unit = "glstub_glColor3s" "glstub_glColor3s"
+external glColor3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3s" "glstub_glColor3s_nat" [@@noalloc]
 
 external glColor3sv: short_array -> unit = "glstub_glColor3sv" "glstub_glColor3sv"
 let glColor3sv p0 =
@@ -3198,7 +3353,7 @@ let np0 = to_short_array p0 in
 let r = glColor3sv np0 in
 r
 
-external glColor3ub: int -> int -> int -> unit = "glstub_glColor3ub" "glstub_glColor3ub"
+external glColor3ub: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3ub" "glstub_glColor3ub_nat" [@@noalloc]
 
 external glColor3ubv: ubyte_array -> unit = "glstub_glColor3ubv" "glstub_glColor3ubv"
 let glColor3ubv p0 =
@@ -3206,7 +3361,7 @@ let np0 = to_ubyte_array p0 in
 let r = glColor3ubv np0 in
 r
 
-external glColor3ui: int -> int -> int -> unit = "glstub_glColor3ui" "glstub_glColor3ui"
+external glColor3ui: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3ui" "glstub_glColor3ui_nat" [@@noalloc]
 
 external glColor3uiv: word_array -> unit = "glstub_glColor3uiv" "glstub_glColor3uiv"
 let glColor3uiv p0 =
@@ -3214,7 +3369,7 @@ let np0 = to_word_array p0 in
 let r = glColor3uiv np0 in
 r
 
-external glColor3us: int -> int -> int -> unit = "glstub_glColor3us" "glstub_glColor3us"
+external glColor3us: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor3us" "glstub_glColor3us_nat" [@@noalloc]
 
 external glColor3usv: ushort_array -> unit = "glstub_glColor3usv" "glstub_glColor3usv"
 let glColor3usv p0 =
@@ -3222,7 +3377,7 @@ let np0 = to_ushort_array p0 in
 let r = glColor3usv np0 in
 r
 
-external glColor4b: int -> int -> int -> int -> unit = "glstub_glColor4b" "glstub_glColor4b"
+external glColor4b: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4b" "glstub_glColor4b_nat" [@@noalloc]
 
 external glColor4bv: byte_array -> unit = "glstub_glColor4bv" "glstub_glColor4bv"
 let glColor4bv p0 =
@@ -3230,10 +3385,10 @@ let np0 = to_byte_array p0 in
 let r = glColor4bv np0 in
 r
 
-external glColor4d: float -> float -> float -> float -> unit = "glstub_glColor4d" "glstub_glColor4d"
+external glColor4d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor4d" "glstub_glColor4d_nat" [@@noalloc]
 external glColor4dv: float array -> unit = "glstub_glColor4dv" "glstub_glColor4dv"
-external glColor4f: float -> float -> float -> float -> unit = "glstub_glColor4f" "glstub_glColor4f"
-external glColor4fNormal3fVertex3fSUN: float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glColor4fNormal3fVertex3fSUN_byte" "glstub_glColor4fNormal3fVertex3fSUN"
+external glColor4f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor4f" "glstub_glColor4f_nat" [@@noalloc]
+external glColor4fNormal3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor4fNormal3fVertex3fSUN_byte" "glstub_glColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glColor4fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glColor4fNormal3fVertex3fvSUN" "glstub_glColor4fNormal3fVertex3fvSUN"
 let glColor4fNormal3fVertex3fvSUN p0 p1 p2 =
@@ -3253,7 +3408,7 @@ let np0 = to_float_array p0 in
 let r = glColor4fv np0 in
 r
 
-external glColor4hNV: int -> int -> int -> int -> unit = "glstub_glColor4hNV" "glstub_glColor4hNV"
+external glColor4hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4hNV" "glstub_glColor4hNV_nat" [@@noalloc]
 
 external glColor4hvNV: ushort_array -> unit = "glstub_glColor4hvNV" "glstub_glColor4hvNV"
 let glColor4hvNV p0 =
@@ -3262,7 +3417,7 @@ let r = glColor4hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glColor4i: int -> int -> int -> int -> unit = "glstub_glColor4i" "glstub_glColor4i"
+external glColor4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4i" "glstub_glColor4i_nat" [@@noalloc]
 
 external glColor4iv: word_array -> unit = "glstub_glColor4iv" "glstub_glColor4iv"
 let glColor4iv p0 =
@@ -3270,7 +3425,7 @@ let np0 = to_word_array p0 in
 let r = glColor4iv np0 in
 r
 
-external glColor4s: int -> int -> int -> int -> unit = "glstub_glColor4s" "glstub_glColor4s"
+external glColor4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4s" "glstub_glColor4s_nat" [@@noalloc]
 
 external glColor4sv: short_array -> unit = "glstub_glColor4sv" "glstub_glColor4sv"
 let glColor4sv p0 =
@@ -3278,8 +3433,8 @@ let np0 = to_short_array p0 in
 let r = glColor4sv np0 in
 r
 
-external glColor4ub: int -> int -> int -> int -> unit = "glstub_glColor4ub" "glstub_glColor4ub"
-external glColor4ubVertex2fSUN: int -> int -> int -> int -> float -> float -> unit = "glstub_glColor4ubVertex2fSUN_byte" "glstub_glColor4ubVertex2fSUN"
+external glColor4ub: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4ub" "glstub_glColor4ub_nat" [@@noalloc]
+external glColor4ubVertex2fSUN: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor4ubVertex2fSUN_byte" "glstub_glColor4ubVertex2fSUN_nat" [@@noalloc]
 
 external glColor4ubVertex2fvSUN: ubyte_array -> float_array -> unit = "glstub_glColor4ubVertex2fvSUN" "glstub_glColor4ubVertex2fvSUN"
 let glColor4ubVertex2fvSUN p0 p1 =
@@ -3290,7 +3445,7 @@ let _ = copy_ubyte_array np0 p0 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glColor4ubVertex3fSUN: int -> int -> int -> int -> float -> float -> float -> unit = "glstub_glColor4ubVertex3fSUN_byte" "glstub_glColor4ubVertex3fSUN"
+external glColor4ubVertex3fSUN: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glColor4ubVertex3fSUN_byte" "glstub_glColor4ubVertex3fSUN_nat" [@@noalloc]
 
 external glColor4ubVertex3fvSUN: ubyte_array -> float_array -> unit = "glstub_glColor4ubVertex3fvSUN" "glstub_glColor4ubVertex3fvSUN"
 let glColor4ubVertex3fvSUN p0 p1 =
@@ -3308,7 +3463,7 @@ let np0 = to_ubyte_array p0 in
 let r = glColor4ubv np0 in
 r
 
-external glColor4ui: int -> int -> int -> int -> unit = "glstub_glColor4ui" "glstub_glColor4ui"
+external glColor4ui: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4ui" "glstub_glColor4ui_nat" [@@noalloc]
 
 external glColor4uiv: word_array -> unit = "glstub_glColor4uiv" "glstub_glColor4uiv"
 let glColor4uiv p0 =
@@ -3316,7 +3471,7 @@ let np0 = to_word_array p0 in
 let r = glColor4uiv np0 in
 r
 
-external glColor4us: int -> int -> int -> int -> unit = "glstub_glColor4us" "glstub_glColor4us"
+external glColor4us: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColor4us" "glstub_glColor4us_nat" [@@noalloc]
 
 external glColor4usv: ushort_array -> unit = "glstub_glColor4usv" "glstub_glColor4usv"
 let glColor4usv p0 =
@@ -3324,12 +3479,12 @@ let np0 = to_ushort_array p0 in
 let r = glColor4usv np0 in
 r
 
-external glColorFragmentOp1ATI: int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glColorFragmentOp1ATI_byte" "glstub_glColorFragmentOp1ATI"
-external glColorFragmentOp2ATI: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glColorFragmentOp2ATI_byte" "glstub_glColorFragmentOp2ATI"
-external glColorFragmentOp3ATI: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glColorFragmentOp3ATI_byte" "glstub_glColorFragmentOp3ATI"
-external glColorMask: bool -> bool -> bool -> bool -> unit = "glstub_glColorMask" "glstub_glColorMask"
-external glColorMaskIndexedEXT: int -> bool -> bool -> bool -> bool -> unit = "glstub_glColorMaskIndexedEXT" "glstub_glColorMaskIndexedEXT"
-external glColorMaterial: int -> int -> unit = "glstub_glColorMaterial" "glstub_glColorMaterial"
+external glColorFragmentOp1ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColorFragmentOp1ATI_byte" "glstub_glColorFragmentOp1ATI_nat" [@@noalloc]
+external glColorFragmentOp2ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColorFragmentOp2ATI_byte" "glstub_glColorFragmentOp2ATI_nat" [@@noalloc]
+external glColorFragmentOp3ATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColorFragmentOp3ATI_byte" "glstub_glColorFragmentOp3ATI_nat" [@@noalloc]
+external glColorMask: bool -> bool -> bool -> bool -> unit = "glstub_glColorMask" "glstub_glColorMask_nat" [@@noalloc]
+external glColorMaskIndexedEXT: (int [@untagged]) -> bool -> bool -> bool -> bool -> unit = "glstub_glColorMaskIndexedEXT" "glstub_glColorMaskIndexedEXT_nat" [@@noalloc]
+external glColorMaterial: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glColorMaterial" "glstub_glColorMaterial_nat" [@@noalloc]
 external glColorPointer: int -> int -> int -> 'a -> unit = "glstub_glColorPointer" "glstub_glColorPointer"
 external glColorPointerEXT: int -> int -> int -> int -> 'a -> unit = "glstub_glColorPointerEXT" "glstub_glColorPointerEXT"
 external glColorPointerListIBM: int -> int -> int -> 'a -> int -> unit = "glstub_glColorPointerListIBM" "glstub_glColorPointerListIBM"
@@ -3369,9 +3524,9 @@ let _ = copy_word_array np2 p2 in
 r
 
 external glColorTableSGI: int -> int -> int -> int -> int -> 'a -> unit = "glstub_glColorTableSGI_byte" "glstub_glColorTableSGI"
-external glCombinerInputNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glCombinerInputNV_byte" "glstub_glCombinerInputNV"
-external glCombinerOutputNV: int -> int -> int -> int -> int -> int -> int -> bool -> bool -> bool -> unit = "glstub_glCombinerOutputNV_byte" "glstub_glCombinerOutputNV"
-external glCombinerParameterfNV: int -> float -> unit = "glstub_glCombinerParameterfNV" "glstub_glCombinerParameterfNV"
+external glCombinerInputNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCombinerInputNV_byte" "glstub_glCombinerInputNV_nat" [@@noalloc]
+external glCombinerOutputNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> bool -> bool -> unit = "glstub_glCombinerOutputNV_byte" "glstub_glCombinerOutputNV_nat" [@@noalloc]
+external glCombinerParameterfNV: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glCombinerParameterfNV" "glstub_glCombinerParameterfNV_nat" [@@noalloc]
 
 external glCombinerParameterfvNV: int -> float_array -> unit = "glstub_glCombinerParameterfvNV" "glstub_glCombinerParameterfvNV"
 let glCombinerParameterfvNV p0 p1 =
@@ -3380,7 +3535,7 @@ let r = glCombinerParameterfvNV p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glCombinerParameteriNV: int -> int -> unit = "glstub_glCombinerParameteriNV" "glstub_glCombinerParameteriNV"
+external glCombinerParameteriNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCombinerParameteriNV" "glstub_glCombinerParameteriNV_nat" [@@noalloc]
 
 external glCombinerParameterivNV: int -> word_array -> unit = "glstub_glCombinerParameterivNV" "glstub_glCombinerParameterivNV"
 let glCombinerParameterivNV p0 p1 =
@@ -3397,8 +3552,8 @@ let r = glCombinerStageParameterfvNV p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glCompileShader: int -> unit = "glstub_glCompileShader" "glstub_glCompileShader"
-external glCompileShaderARB: int -> unit = "glstub_glCompileShaderARB" "glstub_glCompileShaderARB"
+external glCompileShader: (int [@untagged]) -> unit = "glstub_glCompileShader" "glstub_glCompileShader_nat" [@@noalloc]
+external glCompileShaderARB: (int [@untagged]) -> unit = "glstub_glCompileShaderARB" "glstub_glCompileShaderARB_nat" [@@noalloc]
 external glCompressedTexImage1D: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glCompressedTexImage1D_byte" "glstub_glCompressedTexImage1D"
 external glCompressedTexImage1DARB: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glCompressedTexImage1DARB_byte" "glstub_glCompressedTexImage1DARB"
 external glCompressedTexImage2D: int -> int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glCompressedTexImage2D_byte" "glstub_glCompressedTexImage2D"
@@ -3415,8 +3570,8 @@ external glConvolutionFilter1D: int -> int -> int -> int -> int -> 'a -> unit =
 external glConvolutionFilter1DEXT: int -> int -> int -> int -> int -> 'a -> unit = "glstub_glConvolutionFilter1DEXT_byte" "glstub_glConvolutionFilter1DEXT"
 external glConvolutionFilter2D: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glConvolutionFilter2D_byte" "glstub_glConvolutionFilter2D"
 external glConvolutionFilter2DEXT: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glConvolutionFilter2DEXT_byte" "glstub_glConvolutionFilter2DEXT"
-external glConvolutionParameterf: int -> int -> float -> unit = "glstub_glConvolutionParameterf" "glstub_glConvolutionParameterf"
-external glConvolutionParameterfEXT: int -> int -> float -> unit = "glstub_glConvolutionParameterfEXT" "glstub_glConvolutionParameterfEXT"
+external glConvolutionParameterf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glConvolutionParameterf" "glstub_glConvolutionParameterf_nat" [@@noalloc]
+external glConvolutionParameterfEXT: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glConvolutionParameterfEXT" "glstub_glConvolutionParameterfEXT_nat" [@@noalloc]
 
 external glConvolutionParameterfv: int -> int -> float_array -> unit = "glstub_glConvolutionParameterfv" "glstub_glConvolutionParameterfv"
 let glConvolutionParameterfv p0 p1 p2 =
@@ -3432,8 +3587,8 @@ let r = glConvolutionParameterfvEXT p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glConvolutionParameteri: int -> int -> int -> unit = "glstub_glConvolutionParameteri" "glstub_glConvolutionParameteri"
-external glConvolutionParameteriEXT: int -> int -> int -> unit = "glstub_glConvolutionParameteriEXT" "glstub_glConvolutionParameteriEXT"
+external glConvolutionParameteri: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glConvolutionParameteri" "glstub_glConvolutionParameteri_nat" [@@noalloc]
+external glConvolutionParameteriEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glConvolutionParameteriEXT" "glstub_glConvolutionParameteriEXT_nat" [@@noalloc]
 
 external glConvolutionParameteriv: int -> int -> word_array -> unit = "glstub_glConvolutionParameteriv" "glstub_glConvolutionParameteriv"
 let glConvolutionParameteriv p0 p1 p2 =
@@ -3449,30 +3604,31 @@ let r = glConvolutionParameterivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glCopyColorSubTable: int -> int -> int -> int -> int -> unit = "glstub_glCopyColorSubTable" "glstub_glCopyColorSubTable"
-external glCopyColorSubTableEXT: int -> int -> int -> int -> int -> unit = "glstub_glCopyColorSubTableEXT" "glstub_glCopyColorSubTableEXT"
-external glCopyColorTable: int -> int -> int -> int -> int -> unit = "glstub_glCopyColorTable" "glstub_glCopyColorTable"
-external glCopyColorTableSGI: int -> int -> int -> int -> int -> unit = "glstub_glCopyColorTableSGI" "glstub_glCopyColorTableSGI"
-external glCopyConvolutionFilter1D: int -> int -> int -> int -> int -> unit = "glstub_glCopyConvolutionFilter1D" "glstub_glCopyConvolutionFilter1D"
-external glCopyConvolutionFilter1DEXT: int -> int -> int -> int -> int -> unit = "glstub_glCopyConvolutionFilter1DEXT" "glstub_glCopyConvolutionFilter1DEXT"
-external glCopyConvolutionFilter2D: int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyConvolutionFilter2D_byte" "glstub_glCopyConvolutionFilter2D"
-external glCopyConvolutionFilter2DEXT: int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyConvolutionFilter2DEXT_byte" "glstub_glCopyConvolutionFilter2DEXT"
-external glCopyPixels: int -> int -> int -> int -> int -> unit = "glstub_glCopyPixels" "glstub_glCopyPixels"
-external glCopyTexImage1D: int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexImage1D_byte" "glstub_glCopyTexImage1D"
-external glCopyTexImage1DEXT: int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexImage1DEXT_byte" "glstub_glCopyTexImage1DEXT"
-external glCopyTexImage2D: int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexImage2D_byte" "glstub_glCopyTexImage2D"
-external glCopyTexImage2DEXT: int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexImage2DEXT_byte" "glstub_glCopyTexImage2DEXT"
-external glCopyTexSubImage1D: int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage1D_byte" "glstub_glCopyTexSubImage1D"
-external glCopyTexSubImage1DEXT: int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage1DEXT_byte" "glstub_glCopyTexSubImage1DEXT"
-external glCopyTexSubImage2D: int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage2D_byte" "glstub_glCopyTexSubImage2D"
-external glCopyTexSubImage2DEXT: int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage2DEXT_byte" "glstub_glCopyTexSubImage2DEXT"
-external glCopyTexSubImage3D: int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage3D_byte" "glstub_glCopyTexSubImage3D"
-external glCopyTexSubImage3DEXT: int -> int -> int -> int -> int -> int -> int -> int -> int -> unit = "glstub_glCopyTexSubImage3DEXT_byte" "glstub_glCopyTexSubImage3DEXT"
-external glCreateProgram: unit -> int = "glstub_glCreateProgram" "glstub_glCreateProgram"
-external glCreateProgramObjectARB: unit -> int = "glstub_glCreateProgramObjectARB" "glstub_glCreateProgramObjectARB"
-external glCreateShader: int -> int = "glstub_glCreateShader" "glstub_glCreateShader"
-external glCreateShaderObjectARB: int -> int = "glstub_glCreateShaderObjectARB" "glstub_glCreateShaderObjectARB"
-external glCullFace: int -> unit = "glstub_glCullFace" "glstub_glCullFace"
+external glCopyBufferSubData: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyBufferSubData" "glstub_glCopyBufferSubData_nat" [@@noalloc]
+external glCopyColorSubTable: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyColorSubTable" "glstub_glCopyColorSubTable_nat" [@@noalloc]
+external glCopyColorSubTableEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyColorSubTableEXT" "glstub_glCopyColorSubTableEXT_nat" [@@noalloc]
+external glCopyColorTable: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyColorTable" "glstub_glCopyColorTable_nat" [@@noalloc]
+external glCopyColorTableSGI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyColorTableSGI" "glstub_glCopyColorTableSGI_nat" [@@noalloc]
+external glCopyConvolutionFilter1D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyConvolutionFilter1D" "glstub_glCopyConvolutionFilter1D_nat" [@@noalloc]
+external glCopyConvolutionFilter1DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyConvolutionFilter1DEXT" "glstub_glCopyConvolutionFilter1DEXT_nat" [@@noalloc]
+external glCopyConvolutionFilter2D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyConvolutionFilter2D_byte" "glstub_glCopyConvolutionFilter2D_nat" [@@noalloc]
+external glCopyConvolutionFilter2DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyConvolutionFilter2DEXT_byte" "glstub_glCopyConvolutionFilter2DEXT_nat" [@@noalloc]
+external glCopyPixels: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyPixels" "glstub_glCopyPixels_nat" [@@noalloc]
+external glCopyTexImage1D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexImage1D_byte" "glstub_glCopyTexImage1D_nat" [@@noalloc]
+external glCopyTexImage1DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexImage1DEXT_byte" "glstub_glCopyTexImage1DEXT_nat" [@@noalloc]
+external glCopyTexImage2D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexImage2D_byte" "glstub_glCopyTexImage2D_nat" [@@noalloc]
+external glCopyTexImage2DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexImage2DEXT_byte" "glstub_glCopyTexImage2DEXT_nat" [@@noalloc]
+external glCopyTexSubImage1D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage1D_byte" "glstub_glCopyTexSubImage1D_nat" [@@noalloc]
+external glCopyTexSubImage1DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage1DEXT_byte" "glstub_glCopyTexSubImage1DEXT_nat" [@@noalloc]
+external glCopyTexSubImage2D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage2D_byte" "glstub_glCopyTexSubImage2D_nat" [@@noalloc]
+external glCopyTexSubImage2DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage2DEXT_byte" "glstub_glCopyTexSubImage2DEXT_nat" [@@noalloc]
+external glCopyTexSubImage3D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage3D_byte" "glstub_glCopyTexSubImage3D_nat" [@@noalloc]
+external glCopyTexSubImage3DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glCopyTexSubImage3DEXT_byte" "glstub_glCopyTexSubImage3DEXT_nat" [@@noalloc]
+external glCreateProgram: unit -> (int [@untagged]) = "glstub_glCreateProgram" "glstub_glCreateProgram_nat" [@@noalloc]
+external glCreateProgramObjectARB: unit -> (int [@untagged]) = "glstub_glCreateProgramObjectARB" "glstub_glCreateProgramObjectARB_nat" [@@noalloc]
+external glCreateShader: (int [@untagged]) -> (int [@untagged]) = "glstub_glCreateShader" "glstub_glCreateShader_nat" [@@noalloc]
+external glCreateShaderObjectARB: (int [@untagged]) -> (int [@untagged]) = "glstub_glCreateShaderObjectARB" "glstub_glCreateShaderObjectARB_nat" [@@noalloc]
+external glCullFace: (int [@untagged]) -> unit = "glstub_glCullFace" "glstub_glCullFace_nat" [@@noalloc]
 external glCullParameterdvEXT: int -> float array -> unit = "glstub_glCullParameterdvEXT" "glstub_glCullParameterdvEXT"
 
 external glCullParameterfvEXT: int -> float_array -> unit = "glstub_glCullParameterfvEXT" "glstub_glCullParameterfvEXT"
@@ -3482,8 +3638,8 @@ let r = glCullParameterfvEXT p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glCurrentPaletteMatrixARB: int -> unit = "glstub_glCurrentPaletteMatrixARB" "glstub_glCurrentPaletteMatrixARB"
-external glDeleteAsyncMarkersSGIX: int -> int -> unit = "glstub_glDeleteAsyncMarkersSGIX" "glstub_glDeleteAsyncMarkersSGIX"
+external glCurrentPaletteMatrixARB: (int [@untagged]) -> unit = "glstub_glCurrentPaletteMatrixARB" "glstub_glCurrentPaletteMatrixARB_nat" [@@noalloc]
+external glDeleteAsyncMarkersSGIX: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDeleteAsyncMarkersSGIX" "glstub_glDeleteAsyncMarkersSGIX_nat" [@@noalloc]
 
 external glDeleteBuffers: int -> word_array -> unit = "glstub_glDeleteBuffers" "glstub_glDeleteBuffers"
 let glDeleteBuffers p0 p1 =
@@ -3515,7 +3671,15 @@ let r = glDeleteFencesNV p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDeleteFragmentShaderATI: int -> unit = "glstub_glDeleteFragmentShaderATI" "glstub_glDeleteFragmentShaderATI"
+external glDeleteFragmentShaderATI: (int [@untagged]) -> unit = "glstub_glDeleteFragmentShaderATI" "glstub_glDeleteFragmentShaderATI_nat" [@@noalloc]
+
+external glDeleteFramebuffers: int -> word_array -> unit = "glstub_glDeleteFramebuffers" "glstub_glDeleteFramebuffers"
+let glDeleteFramebuffers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glDeleteFramebuffers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
 
 external glDeleteFramebuffersEXT: int -> word_array -> unit = "glstub_glDeleteFramebuffersEXT" "glstub_glDeleteFramebuffersEXT"
 let glDeleteFramebuffersEXT p0 p1 =
@@ -3524,8 +3688,8 @@ let r = glDeleteFramebuffersEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDeleteLists: int -> int -> unit = "glstub_glDeleteLists" "glstub_glDeleteLists"
-external glDeleteObjectARB: int -> unit = "glstub_glDeleteObjectARB" "glstub_glDeleteObjectARB"
+external glDeleteLists: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDeleteLists" "glstub_glDeleteLists_nat" [@@noalloc]
+external glDeleteObjectARB: (int [@untagged]) -> unit = "glstub_glDeleteObjectARB" "glstub_glDeleteObjectARB_nat" [@@noalloc]
 
 external glDeleteOcclusionQueriesNV: int -> word_array -> unit = "glstub_glDeleteOcclusionQueriesNV" "glstub_glDeleteOcclusionQueriesNV"
 let glDeleteOcclusionQueriesNV p0 p1 =
@@ -3534,7 +3698,7 @@ let r = glDeleteOcclusionQueriesNV p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDeleteProgram: int -> unit = "glstub_glDeleteProgram" "glstub_glDeleteProgram"
+external glDeleteProgram: (int [@untagged]) -> unit = "glstub_glDeleteProgram" "glstub_glDeleteProgram_nat" [@@noalloc]
 
 external glDeleteProgramsARB: int -> word_array -> unit = "glstub_glDeleteProgramsARB" "glstub_glDeleteProgramsARB"
 let glDeleteProgramsARB p0 p1 =
@@ -3567,6 +3731,14 @@ let _ = copy_word_array np1 p1 in
 r
 
 
+external glDeleteRenderbuffers: int -> word_array -> unit = "glstub_glDeleteRenderbuffers" "glstub_glDeleteRenderbuffers"
+let glDeleteRenderbuffers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glDeleteRenderbuffers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
+
 external glDeleteRenderbuffersEXT: int -> word_array -> unit = "glstub_glDeleteRenderbuffersEXT" "glstub_glDeleteRenderbuffersEXT"
 let glDeleteRenderbuffersEXT p0 p1 =
 let np1 = to_word_array p1 in
@@ -3574,7 +3746,16 @@ let r = glDeleteRenderbuffersEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDeleteShader: int -> unit = "glstub_glDeleteShader" "glstub_glDeleteShader"
+
+external glDeleteSamplers: int -> word_array -> unit = "glstub_glDeleteSamplers" "glstub_glDeleteSamplers"
+let glDeleteSamplers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glDeleteSamplers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
+external glDeleteShader: (int [@untagged]) -> unit = "glstub_glDeleteShader" "glstub_glDeleteShader_nat" [@@noalloc]
+external glDeleteSync: sync -> unit = "glstub_glDeleteSync" "glstub_glDeleteSync"
 
 external glDeleteTextures: int -> word_array -> unit = "glstub_glDeleteTextures" "glstub_glDeleteTextures"
 let glDeleteTextures p0 p1 =
@@ -3606,16 +3787,16 @@ let r = glDeleteVertexArraysAPPLE p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDeleteVertexShaderEXT: int -> unit = "glstub_glDeleteVertexShaderEXT" "glstub_glDeleteVertexShaderEXT"
-external glDepthBoundsEXT: float -> float -> unit = "glstub_glDepthBoundsEXT" "glstub_glDepthBoundsEXT"
-external glDepthBoundsdNV: float -> float -> unit = "glstub_glDepthBoundsdNV" "glstub_glDepthBoundsdNV"
-external glDepthFunc: int -> unit = "glstub_glDepthFunc" "glstub_glDepthFunc"
-external glDepthMask: bool -> unit = "glstub_glDepthMask" "glstub_glDepthMask"
-external glDepthRange: float -> float -> unit = "glstub_glDepthRange" "glstub_glDepthRange"
-external glDepthRangedNV: float -> float -> unit = "glstub_glDepthRangedNV" "glstub_glDepthRangedNV"
-external glDepthRangefOES: float -> float -> unit = "glstub_glDepthRangefOES" "glstub_glDepthRangefOES"
-external glDetachObjectARB: int -> int -> unit = "glstub_glDetachObjectARB" "glstub_glDetachObjectARB"
-external glDetachShader: int -> int -> unit = "glstub_glDetachShader" "glstub_glDetachShader"
+external glDeleteVertexShaderEXT: (int [@untagged]) -> unit = "glstub_glDeleteVertexShaderEXT" "glstub_glDeleteVertexShaderEXT_nat" [@@noalloc]
+external glDepthBoundsEXT: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glDepthBoundsEXT" "glstub_glDepthBoundsEXT_nat" [@@noalloc]
+external glDepthBoundsdNV: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glDepthBoundsdNV" "glstub_glDepthBoundsdNV_nat" [@@noalloc]
+external glDepthFunc: (int [@untagged]) -> unit = "glstub_glDepthFunc" "glstub_glDepthFunc_nat" [@@noalloc]
+external glDepthMask: bool -> unit = "glstub_glDepthMask" "glstub_glDepthMask_nat" [@@noalloc]
+external glDepthRange: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glDepthRange" "glstub_glDepthRange_nat" [@@noalloc]
+external glDepthRangedNV: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glDepthRangedNV" "glstub_glDepthRangedNV_nat" [@@noalloc]
+external glDepthRangefOES: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glDepthRangefOES" "glstub_glDepthRangefOES_nat" [@@noalloc]
+external glDetachObjectARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDetachObjectARB" "glstub_glDetachObjectARB_nat" [@@noalloc]
+external glDetachShader: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDetachShader" "glstub_glDetachShader_nat" [@@noalloc]
 
 external glDetailTexFuncSGIS: int -> int -> float_array -> unit = "glstub_glDetailTexFuncSGIS" "glstub_glDetailTexFuncSGIS"
 let glDetailTexFuncSGIS p0 p1 p2 =
@@ -3624,16 +3805,19 @@ let r = glDetailTexFuncSGIS p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glDisable: int -> unit = "glstub_glDisable" "glstub_glDisable"
-external glDisableClientState: int -> unit = "glstub_glDisableClientState" "glstub_glDisableClientState"
-external glDisableIndexedEXT: int -> int -> unit = "glstub_glDisableIndexedEXT" "glstub_glDisableIndexedEXT"
-external glDisableVariantClientStateEXT: int -> unit = "glstub_glDisableVariantClientStateEXT" "glstub_glDisableVariantClientStateEXT"
-external glDisableVertexAttribArray: int -> unit = "glstub_glDisableVertexAttribArray" "glstub_glDisableVertexAttribArray"
-external glDisableVertexAttribArrayARB: int -> unit = "glstub_glDisableVertexAttribArrayARB" "glstub_glDisableVertexAttribArrayARB"
-external glDrawArrays: int -> int -> int -> unit = "glstub_glDrawArrays" "glstub_glDrawArrays"
-external glDrawArraysEXT: int -> int -> int -> unit = "glstub_glDrawArraysEXT" "glstub_glDrawArraysEXT"
-external glDrawArraysInstancedEXT: int -> int -> int -> int -> unit = "glstub_glDrawArraysInstancedEXT" "glstub_glDrawArraysInstancedEXT"
-external glDrawBuffer: int -> unit = "glstub_glDrawBuffer" "glstub_glDrawBuffer"
+external glDisable: (int [@untagged]) -> unit = "glstub_glDisable" "glstub_glDisable_nat" [@@noalloc]
+external glDisableClientState: (int [@untagged]) -> unit = "glstub_glDisableClientState" "glstub_glDisableClientState_nat" [@@noalloc]
+external glDisableIndexedEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDisableIndexedEXT" "glstub_glDisableIndexedEXT_nat" [@@noalloc]
+external glDisableVariantClientStateEXT: (int [@untagged]) -> unit = "glstub_glDisableVariantClientStateEXT" "glstub_glDisableVariantClientStateEXT_nat" [@@noalloc]
+external glDisableVertexAttribArray: (int [@untagged]) -> unit = "glstub_glDisableVertexAttribArray" "glstub_glDisableVertexAttribArray_nat" [@@noalloc]
+external glDisableVertexAttribArrayARB: (int [@untagged]) -> unit = "glstub_glDisableVertexAttribArrayARB" "glstub_glDisableVertexAttribArrayARB_nat" [@@noalloc]
+external glDrawArrays: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArrays" "glstub_glDrawArrays_nat" [@@noalloc]
+external glDrawArraysEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArraysEXT" "glstub_glDrawArraysEXT_nat" [@@noalloc]
+external glDrawArraysIndirect: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArraysIndirect" "glstub_glDrawArraysIndirect_nat" [@@noalloc]
+external glDrawArraysInstanced: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArraysInstanced" "glstub_glDrawArraysInstanced_nat" [@@noalloc]
+external glDrawArraysInstancedBaseInstance: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArraysInstancedBaseInstance" "glstub_glDrawArraysInstancedBaseInstance_nat" [@@noalloc]
+external glDrawArraysInstancedEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawArraysInstancedEXT" "glstub_glDrawArraysInstancedEXT_nat" [@@noalloc]
+external glDrawBuffer: (int [@untagged]) -> unit = "glstub_glDrawBuffer" "glstub_glDrawBuffer_nat" [@@noalloc]
 
 external glDrawBuffers: int -> word_array -> unit = "glstub_glDrawBuffers" "glstub_glDrawBuffers"
 let glDrawBuffers p0 p1 =
@@ -3657,16 +3841,23 @@ let r = glDrawBuffersATI p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glDrawElementArrayAPPLE: int -> int -> int -> unit = "glstub_glDrawElementArrayAPPLE" "glstub_glDrawElementArrayAPPLE"
-external glDrawElementArrayATI: int -> int -> unit = "glstub_glDrawElementArrayATI" "glstub_glDrawElementArrayATI"
+external glDrawElementArrayAPPLE: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawElementArrayAPPLE" "glstub_glDrawElementArrayAPPLE_nat" [@@noalloc]
+external glDrawElementArrayATI: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawElementArrayATI" "glstub_glDrawElementArrayATI_nat" [@@noalloc]
 external glDrawElements: int -> int -> int -> 'a -> unit = "glstub_glDrawElements" "glstub_glDrawElements"
+external glDrawElementsBaseVertex: int -> int -> int -> 'a -> int -> unit = "glstub_glDrawElementsBaseVertex" "glstub_glDrawElementsBaseVertex"
+external glDrawElementsIndirect: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawElementsIndirect" "glstub_glDrawElementsIndirect_nat" [@@noalloc]
+external glDrawElementsInstanced: int -> int -> int -> 'a -> int -> unit = "glstub_glDrawElementsInstanced" "glstub_glDrawElementsInstanced"
+external glDrawElementsInstancedBaseInstance: int -> int -> int -> 'a -> int -> int -> unit = "glstub_glDrawElementsInstancedBaseInstance_byte" "glstub_glDrawElementsInstancedBaseInstance"
+external glDrawElementsInstancedBaseVertex: int -> int -> int -> 'a -> int -> int -> unit = "glstub_glDrawElementsInstancedBaseVertex_byte" "glstub_glDrawElementsInstancedBaseVertex"
+external glDrawElementsInstancedBaseVertexBaseInstance: int -> int -> int -> 'a -> int -> int -> int -> unit = "glstub_glDrawElementsInstancedBaseVertexBaseInstance_byte" "glstub_glDrawElementsInstancedBaseVertexBaseInstance"
 external glDrawElementsInstancedEXT: int -> int -> int -> 'a -> int -> unit = "glstub_glDrawElementsInstancedEXT" "glstub_glDrawElementsInstancedEXT"
 external glDrawPixels: int -> int -> int -> int -> 'a -> unit = "glstub_glDrawPixels" "glstub_glDrawPixels"
-external glDrawRangeElementArrayAPPLE: int -> int -> int -> int -> int -> unit = "glstub_glDrawRangeElementArrayAPPLE" "glstub_glDrawRangeElementArrayAPPLE"
-external glDrawRangeElementArrayATI: int -> int -> int -> int -> unit = "glstub_glDrawRangeElementArrayATI" "glstub_glDrawRangeElementArrayATI"
+external glDrawRangeElementArrayAPPLE: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawRangeElementArrayAPPLE" "glstub_glDrawRangeElementArrayAPPLE_nat" [@@noalloc]
+external glDrawRangeElementArrayATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glDrawRangeElementArrayATI" "glstub_glDrawRangeElementArrayATI_nat" [@@noalloc]
 external glDrawRangeElements: int -> int -> int -> int -> int -> 'a -> unit = "glstub_glDrawRangeElements_byte" "glstub_glDrawRangeElements"
+external glDrawRangeElementsBaseVertex: int -> int -> int -> int -> int -> 'a -> int -> unit = "glstub_glDrawRangeElementsBaseVertex_byte" "glstub_glDrawRangeElementsBaseVertex"
 external glDrawRangeElementsEXT: int -> int -> int -> int -> int -> 'a -> unit = "glstub_glDrawRangeElementsEXT_byte" "glstub_glDrawRangeElementsEXT"
-external glEdgeFlag: bool -> unit = "glstub_glEdgeFlag" "glstub_glEdgeFlag"
+external glEdgeFlag: bool -> unit = "glstub_glEdgeFlag" "glstub_glEdgeFlag_nat" [@@noalloc]
 external glEdgeFlagPointer: int -> 'a -> unit = "glstub_glEdgeFlagPointer" "glstub_glEdgeFlagPointer"
 
 external glEdgeFlagPointerEXT: int -> int -> word_array -> unit = "glstub_glEdgeFlagPointerEXT" "glstub_glEdgeFlagPointerEXT"
@@ -3688,24 +3879,24 @@ r
 
 external glElementPointerAPPLE: int -> 'a -> unit = "glstub_glElementPointerAPPLE" "glstub_glElementPointerAPPLE"
 external glElementPointerATI: int -> 'a -> unit = "glstub_glElementPointerATI" "glstub_glElementPointerATI"
-external glEnable: int -> unit = "glstub_glEnable" "glstub_glEnable"
-external glEnableClientState: int -> unit = "glstub_glEnableClientState" "glstub_glEnableClientState"
-external glEnableIndexedEXT: int -> int -> unit = "glstub_glEnableIndexedEXT" "glstub_glEnableIndexedEXT"
-external glEnableVariantClientStateEXT: int -> unit = "glstub_glEnableVariantClientStateEXT" "glstub_glEnableVariantClientStateEXT"
-external glEnableVertexAttribArray: int -> unit = "glstub_glEnableVertexAttribArray" "glstub_glEnableVertexAttribArray"
-external glEnableVertexAttribArrayARB: int -> unit = "glstub_glEnableVertexAttribArrayARB" "glstub_glEnableVertexAttribArrayARB"
-external glEnd: unit -> unit = "glstub_glEnd" "glstub_glEnd"
-external glEndFragmentShaderATI: unit -> unit = "glstub_glEndFragmentShaderATI" "glstub_glEndFragmentShaderATI"
-external glEndList: unit -> unit = "glstub_glEndList" "glstub_glEndList"
-external glEndOcclusionQueryNV: unit -> unit = "glstub_glEndOcclusionQueryNV" "glstub_glEndOcclusionQueryNV"
-external glEndQuery: int -> unit = "glstub_glEndQuery" "glstub_glEndQuery"
-external glEndQueryARB: int -> unit = "glstub_glEndQueryARB" "glstub_glEndQueryARB"
-external glEndSceneEXT: unit -> unit = "glstub_glEndSceneEXT" "glstub_glEndSceneEXT"
-external glEndTransformFeedbackNV: unit -> unit = "glstub_glEndTransformFeedbackNV" "glstub_glEndTransformFeedbackNV"
-external glEndVertexShaderEXT: unit -> unit = "glstub_glEndVertexShaderEXT" "glstub_glEndVertexShaderEXT"
-external glEvalCoord1d: float -> unit = "glstub_glEvalCoord1d" "glstub_glEvalCoord1d"
+external glEnable: (int [@untagged]) -> unit = "glstub_glEnable" "glstub_glEnable_nat" [@@noalloc]
+external glEnableClientState: (int [@untagged]) -> unit = "glstub_glEnableClientState" "glstub_glEnableClientState_nat" [@@noalloc]
+external glEnableIndexedEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glEnableIndexedEXT" "glstub_glEnableIndexedEXT_nat" [@@noalloc]
+external glEnableVariantClientStateEXT: (int [@untagged]) -> unit = "glstub_glEnableVariantClientStateEXT" "glstub_glEnableVariantClientStateEXT_nat" [@@noalloc]
+external glEnableVertexAttribArray: (int [@untagged]) -> unit = "glstub_glEnableVertexAttribArray" "glstub_glEnableVertexAttribArray_nat" [@@noalloc]
+external glEnableVertexAttribArrayARB: (int [@untagged]) -> unit = "glstub_glEnableVertexAttribArrayARB" "glstub_glEnableVertexAttribArrayARB_nat" [@@noalloc]
+external glEnd: unit -> unit = "glstub_glEnd" "glstub_glEnd_nat" [@@noalloc]
+external glEndFragmentShaderATI: unit -> unit = "glstub_glEndFragmentShaderATI" "glstub_glEndFragmentShaderATI_nat" [@@noalloc]
+external glEndList: unit -> unit = "glstub_glEndList" "glstub_glEndList_nat" [@@noalloc]
+external glEndOcclusionQueryNV: unit -> unit = "glstub_glEndOcclusionQueryNV" "glstub_glEndOcclusionQueryNV_nat" [@@noalloc]
+external glEndQuery: (int [@untagged]) -> unit = "glstub_glEndQuery" "glstub_glEndQuery_nat" [@@noalloc]
+external glEndQueryARB: (int [@untagged]) -> unit = "glstub_glEndQueryARB" "glstub_glEndQueryARB_nat" [@@noalloc]
+external glEndSceneEXT: unit -> unit = "glstub_glEndSceneEXT" "glstub_glEndSceneEXT_nat" [@@noalloc]
+external glEndTransformFeedbackNV: unit -> unit = "glstub_glEndTransformFeedbackNV" "glstub_glEndTransformFeedbackNV_nat" [@@noalloc]
+external glEndVertexShaderEXT: unit -> unit = "glstub_glEndVertexShaderEXT" "glstub_glEndVertexShaderEXT_nat" [@@noalloc]
+external glEvalCoord1d: (float [@unboxed]) -> unit = "glstub_glEvalCoord1d" "glstub_glEvalCoord1d_nat" [@@noalloc]
 external glEvalCoord1dv: float array -> unit = "glstub_glEvalCoord1dv" "glstub_glEvalCoord1dv"
-external glEvalCoord1f: float -> unit = "glstub_glEvalCoord1f" "glstub_glEvalCoord1f"
+external glEvalCoord1f: (float [@unboxed]) -> unit = "glstub_glEvalCoord1f" "glstub_glEvalCoord1f_nat" [@@noalloc]
 
 external glEvalCoord1fv: float_array -> unit = "glstub_glEvalCoord1fv" "glstub_glEvalCoord1fv"
 let glEvalCoord1fv p0 =
@@ -3713,9 +3904,9 @@ let np0 = to_float_array p0 in
 let r = glEvalCoord1fv np0 in
 r
 
-external glEvalCoord2d: float -> float -> unit = "glstub_glEvalCoord2d" "glstub_glEvalCoord2d"
+external glEvalCoord2d: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glEvalCoord2d" "glstub_glEvalCoord2d_nat" [@@noalloc]
 external glEvalCoord2dv: float array -> unit = "glstub_glEvalCoord2dv" "glstub_glEvalCoord2dv"
-external glEvalCoord2f: float -> float -> unit = "glstub_glEvalCoord2f" "glstub_glEvalCoord2f"
+external glEvalCoord2f: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glEvalCoord2f" "glstub_glEvalCoord2f_nat" [@@noalloc]
 
 external glEvalCoord2fv: float_array -> unit = "glstub_glEvalCoord2fv" "glstub_glEvalCoord2fv"
 let glEvalCoord2fv p0 =
@@ -3723,11 +3914,11 @@ let np0 = to_float_array p0 in
 let r = glEvalCoord2fv np0 in
 r
 
-external glEvalMapsNV: int -> int -> unit = "glstub_glEvalMapsNV" "glstub_glEvalMapsNV"
-external glEvalMesh1: int -> int -> int -> unit = "glstub_glEvalMesh1" "glstub_glEvalMesh1"
-external glEvalMesh2: int -> int -> int -> int -> int -> unit = "glstub_glEvalMesh2" "glstub_glEvalMesh2"
-external glEvalPoint1: int -> unit = "glstub_glEvalPoint1" "glstub_glEvalPoint1"
-external glEvalPoint2: int -> int -> unit = "glstub_glEvalPoint2" "glstub_glEvalPoint2"
+external glEvalMapsNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glEvalMapsNV" "glstub_glEvalMapsNV_nat" [@@noalloc]
+external glEvalMesh1: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glEvalMesh1" "glstub_glEvalMesh1_nat" [@@noalloc]
+external glEvalMesh2: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glEvalMesh2" "glstub_glEvalMesh2_nat" [@@noalloc]
+external glEvalPoint1: (int [@untagged]) -> unit = "glstub_glEvalPoint1" "glstub_glEvalPoint1_nat" [@@noalloc]
+external glEvalPoint2: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glEvalPoint2" "glstub_glEvalPoint2_nat" [@@noalloc]
 
 external glExecuteProgramNV: int -> int -> float_array -> unit = "glstub_glExecuteProgramNV" "glstub_glExecuteProgramNV"
 let glExecuteProgramNV p0 p1 p2 =
@@ -3736,7 +3927,7 @@ let r = glExecuteProgramNV p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glExtractComponentEXT: int -> int -> int -> unit = "glstub_glExtractComponentEXT" "glstub_glExtractComponentEXT"
+external glExtractComponentEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glExtractComponentEXT" "glstub_glExtractComponentEXT_nat" [@@noalloc]
 
 external glFeedbackBuffer: int -> int -> float_array -> unit = "glstub_glFeedbackBuffer" "glstub_glFeedbackBuffer"
 let glFeedbackBuffer p0 p1 p2 =
@@ -3745,8 +3936,9 @@ let r = glFeedbackBuffer p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glFinalCombinerInputNV: int -> int -> int -> int -> unit = "glstub_glFinalCombinerInputNV" "glstub_glFinalCombinerInputNV"
-external glFinish: unit -> unit = "glstub_glFinish" "glstub_glFinish"
+external glFenceSync: int -> int -> sync = "glstub_glFenceSync" "glstub_glFenceSync"
+external glFinalCombinerInputNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFinalCombinerInputNV" "glstub_glFinalCombinerInputNV_nat" [@@noalloc]
+external glFinish: unit -> unit = "glstub_glFinish" "glstub_glFinish_nat" [@@noalloc]
 
 external glFinishAsyncSGIX: word_array -> int = "glstub_glFinishAsyncSGIX" "glstub_glFinishAsyncSGIX"
 let glFinishAsyncSGIX p0 =
@@ -3755,24 +3947,25 @@ let r = glFinishAsyncSGIX np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glFinishFenceAPPLE: int -> unit = "glstub_glFinishFenceAPPLE" "glstub_glFinishFenceAPPLE"
-external glFinishFenceNV: int -> unit = "glstub_glFinishFenceNV" "glstub_glFinishFenceNV"
-external glFinishObjectAPPLE: int -> int -> unit = "glstub_glFinishObjectAPPLE" "glstub_glFinishObjectAPPLE"
-external glFinishTextureSUNX: unit -> unit = "glstub_glFinishTextureSUNX" "glstub_glFinishTextureSUNX"
-external glFlush: unit -> unit = "glstub_glFlush" "glstub_glFlush"
-external glFlushPixelDataRangeNV: int -> unit = "glstub_glFlushPixelDataRangeNV" "glstub_glFlushPixelDataRangeNV"
-external glFlushRasterSGIX: unit -> unit = "glstub_glFlushRasterSGIX" "glstub_glFlushRasterSGIX"
+external glFinishFenceAPPLE: (int [@untagged]) -> unit = "glstub_glFinishFenceAPPLE" "glstub_glFinishFenceAPPLE_nat" [@@noalloc]
+external glFinishFenceNV: (int [@untagged]) -> unit = "glstub_glFinishFenceNV" "glstub_glFinishFenceNV_nat" [@@noalloc]
+external glFinishObjectAPPLE: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFinishObjectAPPLE" "glstub_glFinishObjectAPPLE_nat" [@@noalloc]
+external glFinishTextureSUNX: unit -> unit = "glstub_glFinishTextureSUNX" "glstub_glFinishTextureSUNX_nat" [@@noalloc]
+external glFlush: unit -> unit = "glstub_glFlush" "glstub_glFlush_nat" [@@noalloc]
+external glFlushMappedBufferRange: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFlushMappedBufferRange" "glstub_glFlushMappedBufferRange_nat" [@@noalloc]
+external glFlushPixelDataRangeNV: (int [@untagged]) -> unit = "glstub_glFlushPixelDataRangeNV" "glstub_glFlushPixelDataRangeNV_nat" [@@noalloc]
+external glFlushRasterSGIX: unit -> unit = "glstub_glFlushRasterSGIX" "glstub_glFlushRasterSGIX_nat" [@@noalloc]
 external glFlushVertexArrayRangeAPPLE: int -> 'a -> unit = "glstub_glFlushVertexArrayRangeAPPLE" "glstub_glFlushVertexArrayRangeAPPLE"
-external glFlushVertexArrayRangeNV: unit -> unit = "glstub_glFlushVertexArrayRangeNV" "glstub_glFlushVertexArrayRangeNV"
+external glFlushVertexArrayRangeNV: unit -> unit = "glstub_glFlushVertexArrayRangeNV" "glstub_glFlushVertexArrayRangeNV_nat" [@@noalloc]
 external glFogCoordPointer: int -> int -> 'a -> unit = "glstub_glFogCoordPointer" "glstub_glFogCoordPointer"
 external glFogCoordPointerEXT: int -> int -> 'a -> unit = "glstub_glFogCoordPointerEXT" "glstub_glFogCoordPointerEXT"
 external glFogCoordPointerListIBM: int -> int -> 'a -> int -> unit = "glstub_glFogCoordPointerListIBM" "glstub_glFogCoordPointerListIBM"
-external glFogCoordd: float -> unit = "glstub_glFogCoordd" "glstub_glFogCoordd"
-external glFogCoorddEXT: float -> unit = "glstub_glFogCoorddEXT" "glstub_glFogCoorddEXT"
+external glFogCoordd: (float [@unboxed]) -> unit = "glstub_glFogCoordd" "glstub_glFogCoordd_nat" [@@noalloc]
+external glFogCoorddEXT: (float [@unboxed]) -> unit = "glstub_glFogCoorddEXT" "glstub_glFogCoorddEXT_nat" [@@noalloc]
 external glFogCoorddv: float array -> unit = "glstub_glFogCoorddv" "glstub_glFogCoorddv"
 external glFogCoorddvEXT: float array -> unit = "glstub_glFogCoorddvEXT" "glstub_glFogCoorddvEXT"
-external glFogCoordf: float -> unit = "glstub_glFogCoordf" "glstub_glFogCoordf"
-external glFogCoordfEXT: float -> unit = "glstub_glFogCoordfEXT" "glstub_glFogCoordfEXT"
+external glFogCoordf: (float [@unboxed]) -> unit = "glstub_glFogCoordf" "glstub_glFogCoordf_nat" [@@noalloc]
+external glFogCoordfEXT: (float [@unboxed]) -> unit = "glstub_glFogCoordfEXT" "glstub_glFogCoordfEXT_nat" [@@noalloc]
 
 external glFogCoordfv: float_array -> unit = "glstub_glFogCoordfv" "glstub_glFogCoordfv"
 let glFogCoordfv p0 =
@@ -3787,7 +3980,7 @@ let np0 = to_float_array p0 in
 let r = glFogCoordfvEXT np0 in
 r
 
-external glFogCoordhNV: int -> unit = "glstub_glFogCoordhNV" "glstub_glFogCoordhNV"
+external glFogCoordhNV: (int [@untagged]) -> unit = "glstub_glFogCoordhNV" "glstub_glFogCoordhNV_nat" [@@noalloc]
 
 external glFogCoordhvNV: ushort_array -> unit = "glstub_glFogCoordhvNV" "glstub_glFogCoordhvNV"
 let glFogCoordhvNV p0 =
@@ -3804,7 +3997,7 @@ let r = glFogFuncSGIS p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glFogf: int -> float -> unit = "glstub_glFogf" "glstub_glFogf"
+external glFogf: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFogf" "glstub_glFogf_nat" [@@noalloc]
 
 external glFogfv: int -> float_array -> unit = "glstub_glFogfv" "glstub_glFogfv"
 let glFogfv p0 p1 =
@@ -3812,7 +4005,7 @@ let np1 = to_float_array p1 in
 let r = glFogfv p0 np1 in
 r
 
-external glFogi: int -> int -> unit = "glstub_glFogi" "glstub_glFogi"
+external glFogi: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFogi" "glstub_glFogi_nat" [@@noalloc]
 
 external glFogiv: int -> word_array -> unit = "glstub_glFogiv" "glstub_glFogiv"
 let glFogiv p0 p1 =
@@ -3820,10 +4013,10 @@ let np1 = to_word_array p1 in
 let r = glFogiv p0 np1 in
 r
 
-external glFragmentColorMaterialEXT: int -> int -> unit = "glstub_glFragmentColorMaterialEXT" "glstub_glFragmentColorMaterialEXT"
-external glFragmentColorMaterialSGIX: int -> int -> unit = "glstub_glFragmentColorMaterialSGIX" "glstub_glFragmentColorMaterialSGIX"
-external glFragmentLightModelfEXT: int -> float -> unit = "glstub_glFragmentLightModelfEXT" "glstub_glFragmentLightModelfEXT"
-external glFragmentLightModelfSGIX: int -> float -> unit = "glstub_glFragmentLightModelfSGIX" "glstub_glFragmentLightModelfSGIX"
+external glFragmentColorMaterialEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentColorMaterialEXT" "glstub_glFragmentColorMaterialEXT_nat" [@@noalloc]
+external glFragmentColorMaterialSGIX: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentColorMaterialSGIX" "glstub_glFragmentColorMaterialSGIX_nat" [@@noalloc]
+external glFragmentLightModelfEXT: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentLightModelfEXT" "glstub_glFragmentLightModelfEXT_nat" [@@noalloc]
+external glFragmentLightModelfSGIX: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentLightModelfSGIX" "glstub_glFragmentLightModelfSGIX_nat" [@@noalloc]
 
 external glFragmentLightModelfvEXT: int -> float_array -> unit = "glstub_glFragmentLightModelfvEXT" "glstub_glFragmentLightModelfvEXT"
 let glFragmentLightModelfvEXT p0 p1 =
@@ -3840,8 +4033,8 @@ let r = glFragmentLightModelfvSGIX p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glFragmentLightModeliEXT: int -> int -> unit = "glstub_glFragmentLightModeliEXT" "glstub_glFragmentLightModeliEXT"
-external glFragmentLightModeliSGIX: int -> int -> unit = "glstub_glFragmentLightModeliSGIX" "glstub_glFragmentLightModeliSGIX"
+external glFragmentLightModeliEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentLightModeliEXT" "glstub_glFragmentLightModeliEXT_nat" [@@noalloc]
+external glFragmentLightModeliSGIX: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentLightModeliSGIX" "glstub_glFragmentLightModeliSGIX_nat" [@@noalloc]
 
 external glFragmentLightModelivEXT: int -> word_array -> unit = "glstub_glFragmentLightModelivEXT" "glstub_glFragmentLightModelivEXT"
 let glFragmentLightModelivEXT p0 p1 =
@@ -3858,8 +4051,8 @@ let r = glFragmentLightModelivSGIX p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glFragmentLightfEXT: int -> int -> float -> unit = "glstub_glFragmentLightfEXT" "glstub_glFragmentLightfEXT"
-external glFragmentLightfSGIX: int -> int -> float -> unit = "glstub_glFragmentLightfSGIX" "glstub_glFragmentLightfSGIX"
+external glFragmentLightfEXT: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentLightfEXT" "glstub_glFragmentLightfEXT_nat" [@@noalloc]
+external glFragmentLightfSGIX: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentLightfSGIX" "glstub_glFragmentLightfSGIX_nat" [@@noalloc]
 
 external glFragmentLightfvEXT: int -> int -> float_array -> unit = "glstub_glFragmentLightfvEXT" "glstub_glFragmentLightfvEXT"
 let glFragmentLightfvEXT p0 p1 p2 =
@@ -3876,8 +4069,8 @@ let r = glFragmentLightfvSGIX p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glFragmentLightiEXT: int -> int -> int -> unit = "glstub_glFragmentLightiEXT" "glstub_glFragmentLightiEXT"
-external glFragmentLightiSGIX: int -> int -> int -> unit = "glstub_glFragmentLightiSGIX" "glstub_glFragmentLightiSGIX"
+external glFragmentLightiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentLightiEXT" "glstub_glFragmentLightiEXT_nat" [@@noalloc]
+external glFragmentLightiSGIX: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentLightiSGIX" "glstub_glFragmentLightiSGIX_nat" [@@noalloc]
 
 external glFragmentLightivEXT: int -> int -> word_array -> unit = "glstub_glFragmentLightivEXT" "glstub_glFragmentLightivEXT"
 let glFragmentLightivEXT p0 p1 p2 =
@@ -3894,8 +4087,8 @@ let r = glFragmentLightivSGIX p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glFragmentMaterialfEXT: int -> int -> float -> unit = "glstub_glFragmentMaterialfEXT" "glstub_glFragmentMaterialfEXT"
-external glFragmentMaterialfSGIX: int -> int -> float -> unit = "glstub_glFragmentMaterialfSGIX" "glstub_glFragmentMaterialfSGIX"
+external glFragmentMaterialfEXT: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentMaterialfEXT" "glstub_glFragmentMaterialfEXT_nat" [@@noalloc]
+external glFragmentMaterialfSGIX: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glFragmentMaterialfSGIX" "glstub_glFragmentMaterialfSGIX_nat" [@@noalloc]
 
 external glFragmentMaterialfvEXT: int -> int -> float_array -> unit = "glstub_glFragmentMaterialfvEXT" "glstub_glFragmentMaterialfvEXT"
 let glFragmentMaterialfvEXT p0 p1 p2 =
@@ -3912,8 +4105,8 @@ let r = glFragmentMaterialfvSGIX p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glFragmentMaterialiEXT: int -> int -> int -> unit = "glstub_glFragmentMaterialiEXT" "glstub_glFragmentMaterialiEXT"
-external glFragmentMaterialiSGIX: int -> int -> int -> unit = "glstub_glFragmentMaterialiSGIX" "glstub_glFragmentMaterialiSGIX"
+external glFragmentMaterialiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentMaterialiEXT" "glstub_glFragmentMaterialiEXT_nat" [@@noalloc]
+external glFragmentMaterialiSGIX: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFragmentMaterialiSGIX" "glstub_glFragmentMaterialiSGIX_nat" [@@noalloc]
 
 external glFragmentMaterialivEXT: int -> int -> word_array -> unit = "glstub_glFragmentMaterialivEXT" "glstub_glFragmentMaterialivEXT"
 let glFragmentMaterialivEXT p0 p1 p2 =
@@ -3930,19 +4123,21 @@ let r = glFragmentMaterialivSGIX p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glFrameZoomSGIX: int -> unit = "glstub_glFrameZoomSGIX" "glstub_glFrameZoomSGIX"
-external glFramebufferRenderbufferEXT: int -> int -> int -> int -> unit = "glstub_glFramebufferRenderbufferEXT" "glstub_glFramebufferRenderbufferEXT"
-external glFramebufferTexture1DEXT: int -> int -> int -> int -> int -> unit = "glstub_glFramebufferTexture1DEXT" "glstub_glFramebufferTexture1DEXT"
-external glFramebufferTexture2DEXT: int -> int -> int -> int -> int -> unit = "glstub_glFramebufferTexture2DEXT" "glstub_glFramebufferTexture2DEXT"
-external glFramebufferTexture3DEXT: int -> int -> int -> int -> int -> int -> unit = "glstub_glFramebufferTexture3DEXT_byte" "glstub_glFramebufferTexture3DEXT"
-external glFramebufferTextureEXT: int -> int -> int -> int -> unit = "glstub_glFramebufferTextureEXT" "glstub_glFramebufferTextureEXT"
-external glFramebufferTextureFaceEXT: int -> int -> int -> int -> int -> unit = "glstub_glFramebufferTextureFaceEXT" "glstub_glFramebufferTextureFaceEXT"
-external glFramebufferTextureLayerEXT: int -> int -> int -> int -> int -> unit = "glstub_glFramebufferTextureLayerEXT" "glstub_glFramebufferTextureLayerEXT"
-external glFreeObjectBufferATI: int -> unit = "glstub_glFreeObjectBufferATI" "glstub_glFreeObjectBufferATI"
-external glFrontFace: int -> unit = "glstub_glFrontFace" "glstub_glFrontFace"
-external glFrustum: float -> float -> float -> float -> float -> float -> unit = "glstub_glFrustum_byte" "glstub_glFrustum"
-external glFrustumfOES: float -> float -> float -> float -> float -> float -> unit = "glstub_glFrustumfOES_byte" "glstub_glFrustumfOES"
-external glGenAsyncMarkersSGIX: int -> int = "glstub_glGenAsyncMarkersSGIX" "glstub_glGenAsyncMarkersSGIX"
+external glFrameZoomSGIX: (int [@untagged]) -> unit = "glstub_glFrameZoomSGIX" "glstub_glFrameZoomSGIX_nat" [@@noalloc]
+external glFramebufferRenderbuffer: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferRenderbuffer" "glstub_glFramebufferRenderbuffer_nat" [@@noalloc]
+external glFramebufferRenderbufferEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferRenderbufferEXT" "glstub_glFramebufferRenderbufferEXT_nat" [@@noalloc]
+external glFramebufferTexture1DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTexture1DEXT" "glstub_glFramebufferTexture1DEXT_nat" [@@noalloc]
+external glFramebufferTexture2D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTexture2D" "glstub_glFramebufferTexture2D_nat" [@@noalloc]
+external glFramebufferTexture2DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTexture2DEXT" "glstub_glFramebufferTexture2DEXT_nat" [@@noalloc]
+external glFramebufferTexture3DEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTexture3DEXT_byte" "glstub_glFramebufferTexture3DEXT_nat" [@@noalloc]
+external glFramebufferTextureEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTextureEXT" "glstub_glFramebufferTextureEXT_nat" [@@noalloc]
+external glFramebufferTextureFaceEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTextureFaceEXT" "glstub_glFramebufferTextureFaceEXT_nat" [@@noalloc]
+external glFramebufferTextureLayerEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glFramebufferTextureLayerEXT" "glstub_glFramebufferTextureLayerEXT_nat" [@@noalloc]
+external glFreeObjectBufferATI: (int [@untagged]) -> unit = "glstub_glFreeObjectBufferATI" "glstub_glFreeObjectBufferATI_nat" [@@noalloc]
+external glFrontFace: (int [@untagged]) -> unit = "glstub_glFrontFace" "glstub_glFrontFace_nat" [@@noalloc]
+external glFrustum: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glFrustum_byte" "glstub_glFrustum_nat" [@@noalloc]
+external glFrustumfOES: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glFrustumfOES_byte" "glstub_glFrustumfOES_nat" [@@noalloc]
+external glGenAsyncMarkersSGIX: (int [@untagged]) -> (int [@untagged]) = "glstub_glGenAsyncMarkersSGIX" "glstub_glGenAsyncMarkersSGIX_nat" [@@noalloc]
 
 external glGenBuffers: int -> word_array -> unit = "glstub_glGenBuffers" "glstub_glGenBuffers"
 let glGenBuffers p0 p1 =
@@ -3975,7 +4170,15 @@ let r = glGenFencesNV p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glGenFragmentShadersATI: int -> int = "glstub_glGenFragmentShadersATI" "glstub_glGenFragmentShadersATI"
+external glGenFragmentShadersATI: (int [@untagged]) -> (int [@untagged]) = "glstub_glGenFragmentShadersATI" "glstub_glGenFragmentShadersATI_nat" [@@noalloc]
+
+external glGenFramebuffers: int -> word_array -> unit = "glstub_glGenFramebuffers" "glstub_glGenFramebuffers"
+let glGenFramebuffers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glGenFramebuffers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
 
 external glGenFramebuffersEXT: int -> word_array -> unit = "glstub_glGenFramebuffersEXT" "glstub_glGenFramebuffersEXT"
 let glGenFramebuffersEXT p0 p1 =
@@ -3984,7 +4187,7 @@ let r = glGenFramebuffersEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glGenLists: int -> int = "glstub_glGenLists" "glstub_glGenLists"
+external glGenLists: (int [@untagged]) -> (int [@untagged]) = "glstub_glGenLists" "glstub_glGenLists_nat" [@@noalloc]
 
 external glGenOcclusionQueriesNV: int -> word_array -> unit = "glstub_glGenOcclusionQueriesNV" "glstub_glGenOcclusionQueriesNV"
 let glGenOcclusionQueriesNV p0 p1 =
@@ -4026,6 +4229,14 @@ let _ = copy_word_array np1 p1 in
 r
 
 
+external glGenRenderbuffers: int -> word_array -> unit = "glstub_glGenRenderbuffers" "glstub_glGenRenderbuffers"
+let glGenRenderbuffers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glGenRenderbuffers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
+
 external glGenRenderbuffersEXT: int -> word_array -> unit = "glstub_glGenRenderbuffersEXT" "glstub_glGenRenderbuffersEXT"
 let glGenRenderbuffersEXT p0 p1 =
 let np1 = to_word_array p1 in
@@ -4033,7 +4244,15 @@ let r = glGenRenderbuffersEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glGenSymbolsEXT: int -> int -> int -> int -> int = "glstub_glGenSymbolsEXT" "glstub_glGenSymbolsEXT"
+
+external glGenSamplers: int -> word_array -> unit = "glstub_glGenSamplers" "glstub_glGenSamplers"
+let glGenSamplers p0 p1 =
+let np1 = to_word_array p1 in
+let r = glGenSamplers p0 np1 in
+let _ = copy_word_array np1 p1 in
+r
+
+external glGenSymbolsEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glGenSymbolsEXT" "glstub_glGenSymbolsEXT_nat" [@@noalloc]
 
 external glGenTextures: int -> word_array -> unit = "glstub_glGenTextures" "glstub_glGenTextures"
 let glGenTextures p0 p1 =
@@ -4066,8 +4285,9 @@ let r = glGenVertexArraysAPPLE p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glGenVertexShadersEXT: int -> int = "glstub_glGenVertexShadersEXT" "glstub_glGenVertexShadersEXT"
-external glGenerateMipmapEXT: int -> unit = "glstub_glGenerateMipmapEXT" "glstub_glGenerateMipmapEXT"
+external glGenVertexShadersEXT: (int [@untagged]) -> (int [@untagged]) = "glstub_glGenVertexShadersEXT" "glstub_glGenVertexShadersEXT_nat" [@@noalloc]
+external glGenerateMipmap: (int [@untagged]) -> unit = "glstub_glGenerateMipmap" "glstub_glGenerateMipmap_nat" [@@noalloc]
+external glGenerateMipmapEXT: (int [@untagged]) -> unit = "glstub_glGenerateMipmapEXT" "glstub_glGenerateMipmapEXT_nat" [@@noalloc]
 
 external glGetActiveAttrib: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveAttrib_byte" "glstub_glGetActiveAttrib"
 let glGetActiveAttrib p0 p1 p2 p3 p4 p5 p6 =
@@ -4351,7 +4571,7 @@ let _ = copy_float_array np1 p1 in
 r
 
 external glGetDoublev: int -> float array -> unit = "glstub_glGetDoublev" "glstub_glGetDoublev"
-external glGetError: unit -> int = "glstub_glGetError" "glstub_glGetError"
+external glGetError: unit -> (int [@untagged]) = "glstub_glGetError" "glstub_glGetError_nat" [@@noalloc]
 
 external glGetFenceivNV: int -> int -> word_array -> unit = "glstub_glGetFenceivNV" "glstub_glGetFenceivNV"
 let glGetFenceivNV p0 p1 p2 =
@@ -4465,7 +4685,7 @@ let r = glGetFramebufferAttachmentParameterivEXT p0 p1 p2 np3 in
 let _ = copy_word_array np3 p3 in
 r
 
-external glGetHandleARB: int -> int = "glstub_glGetHandleARB" "glstub_glGetHandleARB"
+external glGetHandleARB: (int [@untagged]) -> (int [@untagged]) = "glstub_glGetHandleARB" "glstub_glGetHandleARB_nat" [@@noalloc]
 external glGetHistogram: int -> bool -> int -> int -> 'a -> unit = "glstub_glGetHistogram" "glstub_glGetHistogram"
 external glGetHistogramEXT: int -> bool -> int -> int -> 'a -> unit = "glstub_glGetHistogramEXT" "glstub_glGetHistogramEXT"
 
@@ -4525,6 +4745,14 @@ let _ = copy_word_array np2 p2 in
 r
 
 
+external glGetInteger64v: int -> dword_array -> unit = "glstub_glGetInteger64v" "glstub_glGetInteger64v"
+let glGetInteger64v p0 p1 =
+let np1 = to_dword_array p1 in
+let r = glGetInteger64v p0 np1 in
+let _ = copy_dword_array np1 p1 in
+r
+
+
 external glGetIntegerIndexedvEXT: int -> int -> word_array -> unit = "glstub_glGetIntegerIndexedvEXT" "glstub_glGetIntegerIndexedvEXT"
 let glGetIntegerIndexedvEXT p0 p1 p2 =
 let np2 = to_word_array p2 in
@@ -4806,6 +5034,16 @@ let r = glGetPolygonStipple np0 in
 let _ = copy_ubyte_array np0 p0 in
 r
 
+
+external glGetProgramBinary: int -> int -> word_array -> word_array -> 'a -> unit = "glstub_glGetProgramBinary" "glstub_glGetProgramBinary"
+let glGetProgramBinary p0 p1 p2 p3 p4 =
+let np2 = to_word_array p2 in
+let np3 = to_word_array p3 in
+let r = glGetProgramBinary p0 p1 np2 np3 p4 in
+let _ = copy_word_array np2 p2 in
+let _ = copy_word_array np3 p3 in
+r
+
 external glGetProgramEnvParameterdvARB: int -> int -> float array -> unit = "glstub_glGetProgramEnvParameterdvARB" "glstub_glGetProgramEnvParameterdvARB"
 
 external glGetProgramEnvParameterfvARB: int -> int -> float_array -> unit = "glstub_glGetProgramEnvParameterfvARB" "glstub_glGetProgramEnvParameterfvARB"
@@ -4893,6 +5131,22 @@ let _ = copy_word_array np2 p2 in
 r
 
 
+external glGetQueryObjecti64v: int -> int -> dword_array -> unit = "glstub_glGetQueryObjecti64v" "glstub_glGetQueryObjecti64v"
+let glGetQueryObjecti64v p0 p1 p2 =
+let np2 = to_dword_array p2 in
+let r = glGetQueryObjecti64v p0 p1 np2 in
+let _ = copy_dword_array np2 p2 in
+r
+
+
+external glGetQueryObjecti64vEXT: int -> int -> dword_array -> unit = "glstub_glGetQueryObjecti64vEXT" "glstub_glGetQueryObjecti64vEXT"
+let glGetQueryObjecti64vEXT p0 p1 p2 =
+let np2 = to_dword_array p2 in
+let r = glGetQueryObjecti64vEXT p0 p1 np2 in
+let _ = copy_dword_array np2 p2 in
+r
+
+
 external glGetQueryObjectiv: int -> int -> word_array -> unit = "glstub_glGetQueryObjectiv" "glstub_glGetQueryObjectiv"
 let glGetQueryObjectiv p0 p1 p2 =
 let np2 = to_word_array p2 in
@@ -4909,6 +5163,22 @@ let _ = copy_word_array np2 p2 in
 r
 
 
+external glGetQueryObjectui64v: int -> int -> dword_array -> unit = "glstub_glGetQueryObjectui64v" "glstub_glGetQueryObjectui64v"
+let glGetQueryObjectui64v p0 p1 p2 =
+let np2 = to_dword_array p2 in
+let r = glGetQueryObjectui64v p0 p1 np2 in
+let _ = copy_dword_array np2 p2 in
+r
+
+
+external glGetQueryObjectui64vEXT: int -> int -> dword_array -> unit = "glstub_glGetQueryObjectui64vEXT" "glstub_glGetQueryObjectui64vEXT"
+let glGetQueryObjectui64vEXT p0 p1 p2 =
+let np2 = to_dword_array p2 in
+let r = glGetQueryObjectui64vEXT p0 p1 np2 in
+let _ = copy_dword_array np2 p2 in
+r
+
+
 external glGetQueryObjectuiv: int -> int -> word_array -> unit = "glstub_glGetQueryObjectuiv" "glstub_glGetQueryObjectuiv"
 let glGetQueryObjectuiv p0 p1 p2 =
 let np2 = to_word_array p2 in
@@ -4991,6 +5261,7 @@ let _ = copy_float_array np1 p1 in
 r
 
 external glGetString: int -> string = "glstub_glGetString" "glstub_glGetString"
+external glGetStringi: int -> int -> string = "glstub_glGetStringi" "glstub_glGetStringi"
 
 external glGetTexBumpParameterfvATI: int -> float_array -> unit = "glstub_glGetTexBumpParameterfvATI" "glstub_glGetTexBumpParameterfvATI"
 let glGetTexBumpParameterfvATI p0 p1 =
@@ -5114,10 +5385,11 @@ let r = glGetTransformFeedbackVaryingNV p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glGetUniformBufferSizeEXT: int -> int -> int = "glstub_glGetUniformBufferSizeEXT" "glstub_glGetUniformBufferSizeEXT"
+external glGetUniformBlockIndex: int -> string -> int = "glstub_glGetUniformBlockIndex" "glstub_glGetUniformBlockIndex"
+external glGetUniformBufferSizeEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glGetUniformBufferSizeEXT" "glstub_glGetUniformBufferSizeEXT_nat" [@@noalloc]
 external glGetUniformLocation: int -> string -> int = "glstub_glGetUniformLocation" "glstub_glGetUniformLocation"
 external glGetUniformLocationARB: int -> string -> int = "glstub_glGetUniformLocationARB" "glstub_glGetUniformLocationARB"
-external glGetUniformOffsetEXT: int -> int -> int = "glstub_glGetUniformOffsetEXT" "glstub_glGetUniformOffsetEXT"
+external glGetUniformOffsetEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) = "glstub_glGetUniformOffsetEXT" "glstub_glGetUniformOffsetEXT_nat" [@@noalloc]
 
 external glGetUniformfv: int -> int -> float_array -> unit = "glstub_glGetUniformfv" "glstub_glGetUniformfv"
 let glGetUniformfv p0 p1 p2 =
@@ -5288,18 +5560,18 @@ let r = glGetVertexAttribivNV p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glGlobalAlphaFactorbSUN: int -> unit = "glstub_glGlobalAlphaFactorbSUN" "glstub_glGlobalAlphaFactorbSUN"
-external glGlobalAlphaFactordSUN: float -> unit = "glstub_glGlobalAlphaFactordSUN" "glstub_glGlobalAlphaFactordSUN"
-external glGlobalAlphaFactorfSUN: float -> unit = "glstub_glGlobalAlphaFactorfSUN" "glstub_glGlobalAlphaFactorfSUN"
-external glGlobalAlphaFactoriSUN: int -> unit = "glstub_glGlobalAlphaFactoriSUN" "glstub_glGlobalAlphaFactoriSUN"
-external glGlobalAlphaFactorsSUN: int -> unit = "glstub_glGlobalAlphaFactorsSUN" "glstub_glGlobalAlphaFactorsSUN"
-external glGlobalAlphaFactorubSUN: int -> unit = "glstub_glGlobalAlphaFactorubSUN" "glstub_glGlobalAlphaFactorubSUN"
-external glGlobalAlphaFactoruiSUN: int -> unit = "glstub_glGlobalAlphaFactoruiSUN" "glstub_glGlobalAlphaFactoruiSUN"
-external glGlobalAlphaFactorusSUN: int -> unit = "glstub_glGlobalAlphaFactorusSUN" "glstub_glGlobalAlphaFactorusSUN"
-external glHint: int -> int -> unit = "glstub_glHint" "glstub_glHint"
-external glHistogram: int -> int -> int -> bool -> unit = "glstub_glHistogram" "glstub_glHistogram"
-external glHistogramEXT: int -> int -> int -> bool -> unit = "glstub_glHistogramEXT" "glstub_glHistogramEXT"
-external glImageTransformParameterfHP: int -> int -> float -> unit = "glstub_glImageTransformParameterfHP" "glstub_glImageTransformParameterfHP"
+external glGlobalAlphaFactorbSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactorbSUN" "glstub_glGlobalAlphaFactorbSUN_nat" [@@noalloc]
+external glGlobalAlphaFactordSUN: (float [@unboxed]) -> unit = "glstub_glGlobalAlphaFactordSUN" "glstub_glGlobalAlphaFactordSUN_nat" [@@noalloc]
+external glGlobalAlphaFactorfSUN: (float [@unboxed]) -> unit = "glstub_glGlobalAlphaFactorfSUN" "glstub_glGlobalAlphaFactorfSUN_nat" [@@noalloc]
+external glGlobalAlphaFactoriSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactoriSUN" "glstub_glGlobalAlphaFactoriSUN_nat" [@@noalloc]
+external glGlobalAlphaFactorsSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactorsSUN" "glstub_glGlobalAlphaFactorsSUN_nat" [@@noalloc]
+external glGlobalAlphaFactorubSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactorubSUN" "glstub_glGlobalAlphaFactorubSUN_nat" [@@noalloc]
+external glGlobalAlphaFactoruiSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactoruiSUN" "glstub_glGlobalAlphaFactoruiSUN_nat" [@@noalloc]
+external glGlobalAlphaFactorusSUN: (int [@untagged]) -> unit = "glstub_glGlobalAlphaFactorusSUN" "glstub_glGlobalAlphaFactorusSUN_nat" [@@noalloc]
+external glHint: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glHint" "glstub_glHint_nat" [@@noalloc]
+external glHistogram: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> unit = "glstub_glHistogram" "glstub_glHistogram_nat" [@@noalloc]
+external glHistogramEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> unit = "glstub_glHistogramEXT" "glstub_glHistogramEXT_nat" [@@noalloc]
+external glImageTransformParameterfHP: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glImageTransformParameterfHP" "glstub_glImageTransformParameterfHP_nat" [@@noalloc]
 
 external glImageTransformParameterfvHP: int -> int -> float_array -> unit = "glstub_glImageTransformParameterfvHP" "glstub_glImageTransformParameterfvHP"
 let glImageTransformParameterfvHP p0 p1 p2 =
@@ -5308,7 +5580,7 @@ let r = glImageTransformParameterfvHP p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glImageTransformParameteriHP: int -> int -> int -> unit = "glstub_glImageTransformParameteriHP" "glstub_glImageTransformParameteriHP"
+external glImageTransformParameteriHP: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glImageTransformParameteriHP" "glstub_glImageTransformParameteriHP_nat" [@@noalloc]
 
 external glImageTransformParameterivHP: int -> int -> word_array -> unit = "glstub_glImageTransformParameterivHP" "glstub_glImageTransformParameterivHP"
 let glImageTransformParameterivHP p0 p1 p2 =
@@ -5317,15 +5589,15 @@ let r = glImageTransformParameterivHP p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glIndexFuncEXT: int -> float -> unit = "glstub_glIndexFuncEXT" "glstub_glIndexFuncEXT"
-external glIndexMask: int -> unit = "glstub_glIndexMask" "glstub_glIndexMask"
-external glIndexMaterialEXT: int -> int -> unit = "glstub_glIndexMaterialEXT" "glstub_glIndexMaterialEXT"
+external glIndexFuncEXT: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glIndexFuncEXT" "glstub_glIndexFuncEXT_nat" [@@noalloc]
+external glIndexMask: (int [@untagged]) -> unit = "glstub_glIndexMask" "glstub_glIndexMask_nat" [@@noalloc]
+external glIndexMaterialEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glIndexMaterialEXT" "glstub_glIndexMaterialEXT_nat" [@@noalloc]
 external glIndexPointer: int -> int -> 'a -> unit = "glstub_glIndexPointer" "glstub_glIndexPointer"
 external glIndexPointerEXT: int -> int -> int -> 'a -> unit = "glstub_glIndexPointerEXT" "glstub_glIndexPointerEXT"
 external glIndexPointerListIBM: int -> int -> 'a -> int -> unit = "glstub_glIndexPointerListIBM" "glstub_glIndexPointerListIBM"
-external glIndexd: float -> unit = "glstub_glIndexd" "glstub_glIndexd"
+external glIndexd: (float [@unboxed]) -> unit = "glstub_glIndexd" "glstub_glIndexd_nat" [@@noalloc]
 external glIndexdv: float array -> unit = "glstub_glIndexdv" "glstub_glIndexdv"
-external glIndexf: float -> unit = "glstub_glIndexf" "glstub_glIndexf"
+external glIndexf: (float [@unboxed]) -> unit = "glstub_glIndexf" "glstub_glIndexf_nat" [@@noalloc]
 
 external glIndexfv: float_array -> unit = "glstub_glIndexfv" "glstub_glIndexfv"
 let glIndexfv p0 =
@@ -5333,7 +5605,7 @@ let np0 = to_float_array p0 in
 let r = glIndexfv np0 in
 r
 
-external glIndexi: int -> unit = "glstub_glIndexi" "glstub_glIndexi"
+external glIndexi: (int [@untagged]) -> unit = "glstub_glIndexi" "glstub_glIndexi_nat" [@@noalloc]
 
 external glIndexiv: word_array -> unit = "glstub_glIndexiv" "glstub_glIndexiv"
 let glIndexiv p0 =
@@ -5341,7 +5613,7 @@ let np0 = to_word_array p0 in
 let r = glIndexiv np0 in
 r
 
-external glIndexs: int -> unit = "glstub_glIndexs" "glstub_glIndexs"
+external glIndexs: (int [@untagged]) -> unit = "glstub_glIndexs" "glstub_glIndexs_nat" [@@noalloc]
 
 external glIndexsv: short_array -> unit = "glstub_glIndexsv" "glstub_glIndexsv"
 let glIndexsv p0 =
@@ -5349,7 +5621,7 @@ let np0 = to_short_array p0 in
 let r = glIndexsv np0 in
 r
 
-external glIndexub: int -> unit = "glstub_glIndexub" "glstub_glIndexub"
+external glIndexub: (int [@untagged]) -> unit = "glstub_glIndexub" "glstub_glIndexub_nat" [@@noalloc]
 
 external glIndexubv: ubyte_array -> unit = "glstub_glIndexubv" "glstub_glIndexubv"
 let glIndexubv p0 =
@@ -5357,34 +5629,35 @@ let np0 = to_ubyte_array p0 in
 let r = glIndexubv np0 in
 r
 
-external glInitNames: unit -> unit = "glstub_glInitNames" "glstub_glInitNames"
-external glInsertComponentEXT: int -> int -> int -> unit = "glstub_glInsertComponentEXT" "glstub_glInsertComponentEXT"
+external glInitNames: unit -> unit = "glstub_glInitNames" "glstub_glInitNames_nat" [@@noalloc]
+external glInsertComponentEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glInsertComponentEXT" "glstub_glInsertComponentEXT_nat" [@@noalloc]
 external glInterleavedArrays: int -> int -> 'a -> unit = "glstub_glInterleavedArrays" "glstub_glInterleavedArrays"
-external glIsAsyncMarkerSGIX: int -> bool = "glstub_glIsAsyncMarkerSGIX" "glstub_glIsAsyncMarkerSGIX"
-external glIsBuffer: int -> bool = "glstub_glIsBuffer" "glstub_glIsBuffer"
-external glIsBufferARB: int -> bool = "glstub_glIsBufferARB" "glstub_glIsBufferARB"
-external glIsEnabled: int -> bool = "glstub_glIsEnabled" "glstub_glIsEnabled"
-external glIsEnabledIndexedEXT: int -> int -> bool = "glstub_glIsEnabledIndexedEXT" "glstub_glIsEnabledIndexedEXT"
-external glIsFenceAPPLE: int -> bool = "glstub_glIsFenceAPPLE" "glstub_glIsFenceAPPLE"
-external glIsFenceNV: int -> bool = "glstub_glIsFenceNV" "glstub_glIsFenceNV"
-external glIsFramebufferEXT: int -> bool = "glstub_glIsFramebufferEXT" "glstub_glIsFramebufferEXT"
-external glIsList: int -> bool = "glstub_glIsList" "glstub_glIsList"
-external glIsObjectBufferATI: int -> bool = "glstub_glIsObjectBufferATI" "glstub_glIsObjectBufferATI"
-external glIsOcclusionQueryNV: int -> bool = "glstub_glIsOcclusionQueryNV" "glstub_glIsOcclusionQueryNV"
-external glIsProgram: int -> bool = "glstub_glIsProgram" "glstub_glIsProgram"
-external glIsProgramARB: int -> bool = "glstub_glIsProgramARB" "glstub_glIsProgramARB"
-external glIsProgramNV: int -> bool = "glstub_glIsProgramNV" "glstub_glIsProgramNV"
-external glIsQuery: int -> bool = "glstub_glIsQuery" "glstub_glIsQuery"
-external glIsQueryARB: int -> bool = "glstub_glIsQueryARB" "glstub_glIsQueryARB"
-external glIsRenderbufferEXT: int -> bool = "glstub_glIsRenderbufferEXT" "glstub_glIsRenderbufferEXT"
-external glIsShader: int -> bool = "glstub_glIsShader" "glstub_glIsShader"
-external glIsTexture: int -> bool = "glstub_glIsTexture" "glstub_glIsTexture"
-external glIsTextureEXT: int -> bool = "glstub_glIsTextureEXT" "glstub_glIsTextureEXT"
-external glIsVariantEnabledEXT: int -> int -> bool = "glstub_glIsVariantEnabledEXT" "glstub_glIsVariantEnabledEXT"
-external glIsVertexArray: int -> bool = "glstub_glIsVertexArray" "glstub_glIsVertexArray"
-external glIsVertexArrayAPPLE: int -> bool = "glstub_glIsVertexArrayAPPLE" "glstub_glIsVertexArrayAPPLE"
-external glLightEnviEXT: int -> int -> unit = "glstub_glLightEnviEXT" "glstub_glLightEnviEXT"
-external glLightModelf: int -> float -> unit = "glstub_glLightModelf" "glstub_glLightModelf"
+external glIsAsyncMarkerSGIX: (int [@untagged]) -> bool = "glstub_glIsAsyncMarkerSGIX" "glstub_glIsAsyncMarkerSGIX_nat" [@@noalloc]
+external glIsBuffer: (int [@untagged]) -> bool = "glstub_glIsBuffer" "glstub_glIsBuffer_nat" [@@noalloc]
+external glIsBufferARB: (int [@untagged]) -> bool = "glstub_glIsBufferARB" "glstub_glIsBufferARB_nat" [@@noalloc]
+external glIsEnabled: (int [@untagged]) -> bool = "glstub_glIsEnabled" "glstub_glIsEnabled_nat" [@@noalloc]
+external glIsEnabledIndexedEXT: (int [@untagged]) -> (int [@untagged]) -> bool = "glstub_glIsEnabledIndexedEXT" "glstub_glIsEnabledIndexedEXT_nat" [@@noalloc]
+external glIsFenceAPPLE: (int [@untagged]) -> bool = "glstub_glIsFenceAPPLE" "glstub_glIsFenceAPPLE_nat" [@@noalloc]
+external glIsFenceNV: (int [@untagged]) -> bool = "glstub_glIsFenceNV" "glstub_glIsFenceNV_nat" [@@noalloc]
+external glIsFramebufferEXT: (int [@untagged]) -> bool = "glstub_glIsFramebufferEXT" "glstub_glIsFramebufferEXT_nat" [@@noalloc]
+external glIsList: (int [@untagged]) -> bool = "glstub_glIsList" "glstub_glIsList_nat" [@@noalloc]
+external glIsObjectBufferATI: (int [@untagged]) -> bool = "glstub_glIsObjectBufferATI" "glstub_glIsObjectBufferATI_nat" [@@noalloc]
+external glIsOcclusionQueryNV: (int [@untagged]) -> bool = "glstub_glIsOcclusionQueryNV" "glstub_glIsOcclusionQueryNV_nat" [@@noalloc]
+external glIsProgram: (int [@untagged]) -> bool = "glstub_glIsProgram" "glstub_glIsProgram_nat" [@@noalloc]
+external glIsProgramARB: (int [@untagged]) -> bool = "glstub_glIsProgramARB" "glstub_glIsProgramARB_nat" [@@noalloc]
+external glIsProgramNV: (int [@untagged]) -> bool = "glstub_glIsProgramNV" "glstub_glIsProgramNV_nat" [@@noalloc]
+external glIsQuery: (int [@untagged]) -> bool = "glstub_glIsQuery" "glstub_glIsQuery_nat" [@@noalloc]
+external glIsQueryARB: (int [@untagged]) -> bool = "glstub_glIsQueryARB" "glstub_glIsQueryARB_nat" [@@noalloc]
+external glIsRenderbufferEXT: (int [@untagged]) -> bool = "glstub_glIsRenderbufferEXT" "glstub_glIsRenderbufferEXT_nat" [@@noalloc]
+external glIsShader: (int [@untagged]) -> bool = "glstub_glIsShader" "glstub_glIsShader_nat" [@@noalloc]
+external glIsSync: sync -> bool = "glstub_glIsSync" "glstub_glIsSync"
+external glIsTexture: (int [@untagged]) -> bool = "glstub_glIsTexture" "glstub_glIsTexture_nat" [@@noalloc]
+external glIsTextureEXT: (int [@untagged]) -> bool = "glstub_glIsTextureEXT" "glstub_glIsTextureEXT_nat" [@@noalloc]
+external glIsVariantEnabledEXT: (int [@untagged]) -> (int [@untagged]) -> bool = "glstub_glIsVariantEnabledEXT" "glstub_glIsVariantEnabledEXT_nat" [@@noalloc]
+external glIsVertexArray: (int [@untagged]) -> bool = "glstub_glIsVertexArray" "glstub_glIsVertexArray_nat" [@@noalloc]
+external glIsVertexArrayAPPLE: (int [@untagged]) -> bool = "glstub_glIsVertexArrayAPPLE" "glstub_glIsVertexArrayAPPLE_nat" [@@noalloc]
+external glLightEnviEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glLightEnviEXT" "glstub_glLightEnviEXT_nat" [@@noalloc]
+external glLightModelf: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glLightModelf" "glstub_glLightModelf_nat" [@@noalloc]
 
 external glLightModelfv: int -> float_array -> unit = "glstub_glLightModelfv" "glstub_glLightModelfv"
 let glLightModelfv p0 p1 =
@@ -5392,7 +5665,7 @@ let np1 = to_float_array p1 in
 let r = glLightModelfv p0 np1 in
 r
 
-external glLightModeli: int -> int -> unit = "glstub_glLightModeli" "glstub_glLightModeli"
+external glLightModeli: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glLightModeli" "glstub_glLightModeli_nat" [@@noalloc]
 
 external glLightModeliv: int -> word_array -> unit = "glstub_glLightModeliv" "glstub_glLightModeliv"
 let glLightModeliv p0 p1 =
@@ -5400,7 +5673,7 @@ let np1 = to_word_array p1 in
 let r = glLightModeliv p0 np1 in
 r
 
-external glLightf: int -> int -> float -> unit = "glstub_glLightf" "glstub_glLightf"
+external glLightf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glLightf" "glstub_glLightf_nat" [@@noalloc]
 
 external glLightfv: int -> int -> float_array -> unit = "glstub_glLightfv" "glstub_glLightfv"
 let glLightfv p0 p1 p2 =
@@ -5408,7 +5681,7 @@ let np2 = to_float_array p2 in
 let r = glLightfv p0 p1 np2 in
 r
 
-external glLighti: int -> int -> int -> unit = "glstub_glLighti" "glstub_glLighti"
+external glLighti: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glLighti" "glstub_glLighti_nat" [@@noalloc]
 
 external glLightiv: int -> int -> word_array -> unit = "glstub_glLightiv" "glstub_glLightiv"
 let glLightiv p0 p1 p2 =
@@ -5416,12 +5689,12 @@ let np2 = to_word_array p2 in
 let r = glLightiv p0 p1 np2 in
 r
 
-external glLineStipple: int -> int -> unit = "glstub_glLineStipple" "glstub_glLineStipple"
-external glLineWidth: float -> unit = "glstub_glLineWidth" "glstub_glLineWidth"
-external glLinkProgram: int -> unit = "glstub_glLinkProgram" "glstub_glLinkProgram"
-external glLinkProgramARB: int -> unit = "glstub_glLinkProgramARB" "glstub_glLinkProgramARB"
-external glListBase: int -> unit = "glstub_glListBase" "glstub_glListBase"
-external glLoadIdentity: unit -> unit = "glstub_glLoadIdentity" "glstub_glLoadIdentity"
+external glLineStipple: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glLineStipple" "glstub_glLineStipple_nat" [@@noalloc]
+external glLineWidth: (float [@unboxed]) -> unit = "glstub_glLineWidth" "glstub_glLineWidth_nat" [@@noalloc]
+external glLinkProgram: (int [@untagged]) -> unit = "glstub_glLinkProgram" "glstub_glLinkProgram_nat" [@@noalloc]
+external glLinkProgramARB: (int [@untagged]) -> unit = "glstub_glLinkProgramARB" "glstub_glLinkProgramARB_nat" [@@noalloc]
+external glListBase: (int [@untagged]) -> unit = "glstub_glListBase" "glstub_glListBase_nat" [@@noalloc]
+external glLoadIdentity: unit -> unit = "glstub_glLoadIdentity" "glstub_glLoadIdentity_nat" [@@noalloc]
 external glLoadMatrixd: float array -> unit = "glstub_glLoadMatrixd" "glstub_glLoadMatrixd"
 
 external glLoadMatrixf: float_array -> unit = "glstub_glLoadMatrixf" "glstub_glLoadMatrixf"
@@ -5430,7 +5703,7 @@ let np0 = to_float_array p0 in
 let r = glLoadMatrixf np0 in
 r
 
-external glLoadName: int -> unit = "glstub_glLoadName" "glstub_glLoadName"
+external glLoadName: (int [@untagged]) -> unit = "glstub_glLoadName" "glstub_glLoadName_nat" [@@noalloc]
 
 external glLoadProgramNV: int -> int -> int -> ubyte_array -> unit = "glstub_glLoadProgramNV" "glstub_glLoadProgramNV"
 let glLoadProgramNV p0 p1 p2 p3 =
@@ -5456,8 +5729,8 @@ let r = glLoadTransposeMatrixfARB np0 in
 let _ = copy_float_array np0 p0 in
 r
 
-external glLockArraysEXT: int -> int -> unit = "glstub_glLockArraysEXT" "glstub_glLockArraysEXT"
-external glLogicOp: int -> unit = "glstub_glLogicOp" "glstub_glLogicOp"
+external glLockArraysEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glLockArraysEXT" "glstub_glLockArraysEXT_nat" [@@noalloc]
+external glLogicOp: (int [@untagged]) -> unit = "glstub_glLogicOp" "glstub_glLogicOp_nat" [@@noalloc]
 external glMap1d: int -> float -> float -> int -> int -> float array -> unit = "glstub_glMap1d_byte" "glstub_glMap1d"
 
 external glMap1f: int -> float -> float -> int -> int -> float_array -> unit = "glstub_glMap1f_byte" "glstub_glMap1f"
@@ -5476,11 +5749,12 @@ r
 
 external glMapBuffer: int -> int -> 'a = "glstub_glMapBuffer" "glstub_glMapBuffer"
 external glMapBufferARB: int -> int -> 'a = "glstub_glMapBufferARB" "glstub_glMapBufferARB"
+external glMapBufferRange: int -> int -> int -> int -> 'a = "glstub_glMapBufferRange" "glstub_glMapBufferRange"
 external glMapControlPointsNV: int -> int -> int -> int -> int -> int -> int -> bool -> 'a -> unit = "glstub_glMapControlPointsNV_byte" "glstub_glMapControlPointsNV"
-external glMapGrid1d: int -> float -> float -> unit = "glstub_glMapGrid1d" "glstub_glMapGrid1d"
-external glMapGrid1f: int -> float -> float -> unit = "glstub_glMapGrid1f" "glstub_glMapGrid1f"
-external glMapGrid2d: int -> float -> float -> int -> float -> float -> unit = "glstub_glMapGrid2d_byte" "glstub_glMapGrid2d"
-external glMapGrid2f: int -> float -> float -> int -> float -> float -> unit = "glstub_glMapGrid2f_byte" "glstub_glMapGrid2f"
+external glMapGrid1d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMapGrid1d" "glstub_glMapGrid1d_nat" [@@noalloc]
+external glMapGrid1f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMapGrid1f" "glstub_glMapGrid1f_nat" [@@noalloc]
+external glMapGrid2d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMapGrid2d_byte" "glstub_glMapGrid2d_nat" [@@noalloc]
+external glMapGrid2f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMapGrid2f_byte" "glstub_glMapGrid2f_nat" [@@noalloc]
 external glMapObjectBufferATI: int -> 'a = "glstub_glMapObjectBufferATI" "glstub_glMapObjectBufferATI"
 
 external glMapParameterfvNV: int -> int -> float_array -> unit = "glstub_glMapParameterfvNV" "glstub_glMapParameterfvNV"
@@ -5498,7 +5772,7 @@ let r = glMapParameterivNV p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glMaterialf: int -> int -> float -> unit = "glstub_glMaterialf" "glstub_glMaterialf"
+external glMaterialf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glMaterialf" "glstub_glMaterialf_nat" [@@noalloc]
 
 external glMaterialfv: int -> int -> float_array -> unit = "glstub_glMaterialfv" "glstub_glMaterialfv"
 let glMaterialfv p0 p1 p2 =
@@ -5506,7 +5780,7 @@ let np2 = to_float_array p2 in
 let r = glMaterialfv p0 p1 np2 in
 r
 
-external glMateriali: int -> int -> int -> unit = "glstub_glMateriali" "glstub_glMateriali"
+external glMateriali: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMateriali" "glstub_glMateriali_nat" [@@noalloc]
 
 external glMaterialiv: int -> int -> word_array -> unit = "glstub_glMaterialiv" "glstub_glMaterialiv"
 let glMaterialiv p0 p1 p2 =
@@ -5539,9 +5813,11 @@ let r = glMatrixIndexusvARB p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glMatrixMode: int -> unit = "glstub_glMatrixMode" "glstub_glMatrixMode"
-external glMinmax: int -> int -> bool -> unit = "glstub_glMinmax" "glstub_glMinmax"
-external glMinmaxEXT: int -> int -> bool -> unit = "glstub_glMinmaxEXT" "glstub_glMinmaxEXT"
+external glMatrixMode: (int [@untagged]) -> unit = "glstub_glMatrixMode" "glstub_glMatrixMode_nat" [@@noalloc]
+external glMaxShaderCompilerThreadsARB: (int [@untagged]) -> unit = "glstub_glMaxShaderCompilerThreadsARB" "glstub_glMaxShaderCompilerThreadsARB_nat" [@@noalloc]
+external glMaxShaderCompilerThreadsKHR: (int [@untagged]) -> unit = "glstub_glMaxShaderCompilerThreadsKHR" "glstub_glMaxShaderCompilerThreadsKHR_nat" [@@noalloc]
+external glMinmax: (int [@untagged]) -> (int [@untagged]) -> bool -> unit = "glstub_glMinmax" "glstub_glMinmax_nat" [@@noalloc]
+external glMinmaxEXT: (int [@untagged]) -> (int [@untagged]) -> bool -> unit = "glstub_glMinmaxEXT" "glstub_glMinmaxEXT_nat" [@@noalloc]
 external glMultMatrixd: float array -> unit = "glstub_glMultMatrixd" "glstub_glMultMatrixd"
 
 external glMultMatrixf: float_array -> unit = "glstub_glMultMatrixf" "glstub_glMultMatrixf"
@@ -5587,6 +5863,7 @@ let _ = copy_word_array np1 p1 in
 let _ = copy_word_array np2 p2 in
 r
 
+external glMultiDrawArraysIndirect: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiDrawArraysIndirect" "glstub_glMultiDrawArraysIndirect_nat" [@@noalloc]
 
 external glMultiDrawElementArrayAPPLE: int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawElementArrayAPPLE" "glstub_glMultiDrawElementArrayAPPLE"
 let glMultiDrawElementArrayAPPLE p0 p1 p2 p3 =
@@ -5606,6 +5883,14 @@ let _ = copy_word_array np1 p1 in
 r
 
 
+external glMultiDrawElementsBaseVertex: int -> word_array -> int -> 'a -> int -> word_array -> unit = "glstub_glMultiDrawElementsBaseVertex_byte" "glstub_glMultiDrawElementsBaseVertex"
+let glMultiDrawElementsBaseVertex p0 p1 p2 p3 p4 p5 =
+let np1 = to_word_array p1 in
+let np5 = to_word_array p5 in
+let r = glMultiDrawElementsBaseVertex p0 np1 p2 p3 p4 np5 in
+r
+
+
 external glMultiDrawElementsEXT: int -> word_array -> int -> 'a -> int -> unit = "glstub_glMultiDrawElementsEXT" "glstub_glMultiDrawElementsEXT"
 let glMultiDrawElementsEXT p0 p1 p2 p3 p4 =
 let np1 = to_word_array p1 in
@@ -5613,6 +5898,7 @@ let r = glMultiDrawElementsEXT p0 np1 p2 p3 p4 in
 let _ = copy_word_array np1 p1 in
 r
 
+external glMultiDrawElementsIndirect: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiDrawElementsIndirect" "glstub_glMultiDrawElementsIndirect_nat" [@@noalloc]
 
 external glMultiDrawRangeElementArrayAPPLE: int -> int -> int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawRangeElementArrayAPPLE_byte" "glstub_glMultiDrawRangeElementArrayAPPLE"
 let glMultiDrawRangeElementArrayAPPLE p0 p1 p2 p3 p4 p5 =
@@ -5645,12 +5931,12 @@ let _ = copy_word_array np0 p0 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glMultiTexCoord1d: int -> float -> unit = "glstub_glMultiTexCoord1d" "glstub_glMultiTexCoord1d"
-external glMultiTexCoord1dARB: int -> float -> unit = "glstub_glMultiTexCoord1dARB" "glstub_glMultiTexCoord1dARB"
+external glMultiTexCoord1d: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord1d" "glstub_glMultiTexCoord1d_nat" [@@noalloc]
+external glMultiTexCoord1dARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord1dARB" "glstub_glMultiTexCoord1dARB_nat" [@@noalloc]
 external glMultiTexCoord1dv: int -> float array -> unit = "glstub_glMultiTexCoord1dv" "glstub_glMultiTexCoord1dv"
 external glMultiTexCoord1dvARB: int -> float array -> unit = "glstub_glMultiTexCoord1dvARB" "glstub_glMultiTexCoord1dvARB"
-external glMultiTexCoord1f: int -> float -> unit = "glstub_glMultiTexCoord1f" "glstub_glMultiTexCoord1f"
-external glMultiTexCoord1fARB: int -> float -> unit = "glstub_glMultiTexCoord1fARB" "glstub_glMultiTexCoord1fARB"
+external glMultiTexCoord1f: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord1f" "glstub_glMultiTexCoord1f_nat" [@@noalloc]
+external glMultiTexCoord1fARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord1fARB" "glstub_glMultiTexCoord1fARB_nat" [@@noalloc]
 
 external glMultiTexCoord1fv: int -> float_array -> unit = "glstub_glMultiTexCoord1fv" "glstub_glMultiTexCoord1fv"
 let glMultiTexCoord1fv p0 p1 =
@@ -5665,7 +5951,7 @@ let np1 = to_float_array p1 in
 let r = glMultiTexCoord1fvARB p0 np1 in
 r
 
-external glMultiTexCoord1hNV: int -> int -> unit = "glstub_glMultiTexCoord1hNV" "glstub_glMultiTexCoord1hNV"
+external glMultiTexCoord1hNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord1hNV" "glstub_glMultiTexCoord1hNV_nat" [@@noalloc]
 
 external glMultiTexCoord1hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord1hvNV" "glstub_glMultiTexCoord1hvNV"
 let glMultiTexCoord1hvNV p0 p1 =
@@ -5674,8 +5960,8 @@ let r = glMultiTexCoord1hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glMultiTexCoord1i: int -> int -> unit = "glstub_glMultiTexCoord1i" "glstub_glMultiTexCoord1i"
-external glMultiTexCoord1iARB: int -> int -> unit = "glstub_glMultiTexCoord1iARB" "glstub_glMultiTexCoord1iARB"
+external glMultiTexCoord1i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord1i" "glstub_glMultiTexCoord1i_nat" [@@noalloc]
+external glMultiTexCoord1iARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord1iARB" "glstub_glMultiTexCoord1iARB_nat" [@@noalloc]
 
 external glMultiTexCoord1iv: int -> word_array -> unit = "glstub_glMultiTexCoord1iv" "glstub_glMultiTexCoord1iv"
 let glMultiTexCoord1iv p0 p1 =
@@ -5690,8 +5976,8 @@ let np1 = to_word_array p1 in
 let r = glMultiTexCoord1ivARB p0 np1 in
 r
 
-external glMultiTexCoord1s: int -> int -> unit = "glstub_glMultiTexCoord1s" "glstub_glMultiTexCoord1s"
-external glMultiTexCoord1sARB: int -> int -> unit = "glstub_glMultiTexCoord1sARB" "glstub_glMultiTexCoord1sARB"
+external glMultiTexCoord1s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord1s" "glstub_glMultiTexCoord1s_nat" [@@noalloc]
+external glMultiTexCoord1sARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord1sARB" "glstub_glMultiTexCoord1sARB_nat" [@@noalloc]
 
 external glMultiTexCoord1sv: int -> short_array -> unit = "glstub_glMultiTexCoord1sv" "glstub_glMultiTexCoord1sv"
 let glMultiTexCoord1sv p0 p1 =
@@ -5706,12 +5992,12 @@ let np1 = to_short_array p1 in
 let r = glMultiTexCoord1svARB p0 np1 in
 r
 
-external glMultiTexCoord2d: int -> float -> float -> unit = "glstub_glMultiTexCoord2d" "glstub_glMultiTexCoord2d"
-external glMultiTexCoord2dARB: int -> float -> float -> unit = "glstub_glMultiTexCoord2dARB" "glstub_glMultiTexCoord2dARB"
+external glMultiTexCoord2d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord2d" "glstub_glMultiTexCoord2d_nat" [@@noalloc]
+external glMultiTexCoord2dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord2dARB" "glstub_glMultiTexCoord2dARB_nat" [@@noalloc]
 external glMultiTexCoord2dv: int -> float array -> unit = "glstub_glMultiTexCoord2dv" "glstub_glMultiTexCoord2dv"
 external glMultiTexCoord2dvARB: int -> float array -> unit = "glstub_glMultiTexCoord2dvARB" "glstub_glMultiTexCoord2dvARB"
-external glMultiTexCoord2f: int -> float -> float -> unit = "glstub_glMultiTexCoord2f" "glstub_glMultiTexCoord2f"
-external glMultiTexCoord2fARB: int -> float -> float -> unit = "glstub_glMultiTexCoord2fARB" "glstub_glMultiTexCoord2fARB"
+external glMultiTexCoord2f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord2f" "glstub_glMultiTexCoord2f_nat" [@@noalloc]
+external glMultiTexCoord2fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord2fARB" "glstub_glMultiTexCoord2fARB_nat" [@@noalloc]
 
 external glMultiTexCoord2fv: int -> float_array -> unit = "glstub_glMultiTexCoord2fv" "glstub_glMultiTexCoord2fv"
 let glMultiTexCoord2fv p0 p1 =
@@ -5726,7 +6012,7 @@ let np1 = to_float_array p1 in
 let r = glMultiTexCoord2fvARB p0 np1 in
 r
 
-external glMultiTexCoord2hNV: int -> int -> int -> unit = "glstub_glMultiTexCoord2hNV" "glstub_glMultiTexCoord2hNV"
+external glMultiTexCoord2hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord2hNV" "glstub_glMultiTexCoord2hNV_nat" [@@noalloc]
 
 external glMultiTexCoord2hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord2hvNV" "glstub_glMultiTexCoord2hvNV"
 let glMultiTexCoord2hvNV p0 p1 =
@@ -5735,8 +6021,8 @@ let r = glMultiTexCoord2hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glMultiTexCoord2i: int -> int -> int -> unit = "glstub_glMultiTexCoord2i" "glstub_glMultiTexCoord2i"
-external glMultiTexCoord2iARB: int -> int -> int -> unit = "glstub_glMultiTexCoord2iARB" "glstub_glMultiTexCoord2iARB"
+external glMultiTexCoord2i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord2i" "glstub_glMultiTexCoord2i_nat" [@@noalloc]
+external glMultiTexCoord2iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord2iARB" "glstub_glMultiTexCoord2iARB_nat" [@@noalloc]
 
 external glMultiTexCoord2iv: int -> word_array -> unit = "glstub_glMultiTexCoord2iv" "glstub_glMultiTexCoord2iv"
 let glMultiTexCoord2iv p0 p1 =
@@ -5751,8 +6037,8 @@ let np1 = to_word_array p1 in
 let r = glMultiTexCoord2ivARB p0 np1 in
 r
 
-external glMultiTexCoord2s: int -> int -> int -> unit = "glstub_glMultiTexCoord2s" "glstub_glMultiTexCoord2s"
-external glMultiTexCoord2sARB: int -> int -> int -> unit = "glstub_glMultiTexCoord2sARB" "glstub_glMultiTexCoord2sARB"
+external glMultiTexCoord2s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord2s" "glstub_glMultiTexCoord2s_nat" [@@noalloc]
+external glMultiTexCoord2sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord2sARB" "glstub_glMultiTexCoord2sARB_nat" [@@noalloc]
 
 external glMultiTexCoord2sv: int -> short_array -> unit = "glstub_glMultiTexCoord2sv" "glstub_glMultiTexCoord2sv"
 let glMultiTexCoord2sv p0 p1 =
@@ -5767,12 +6053,12 @@ let np1 = to_short_array p1 in
 let r = glMultiTexCoord2svARB p0 np1 in
 r
 
-external glMultiTexCoord3d: int -> float -> float -> float -> unit = "glstub_glMultiTexCoord3d" "glstub_glMultiTexCoord3d"
-external glMultiTexCoord3dARB: int -> float -> float -> float -> unit = "glstub_glMultiTexCoord3dARB" "glstub_glMultiTexCoord3dARB"
+external glMultiTexCoord3d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord3d" "glstub_glMultiTexCoord3d_nat" [@@noalloc]
+external glMultiTexCoord3dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord3dARB" "glstub_glMultiTexCoord3dARB_nat" [@@noalloc]
 external glMultiTexCoord3dv: int -> float array -> unit = "glstub_glMultiTexCoord3dv" "glstub_glMultiTexCoord3dv"
 external glMultiTexCoord3dvARB: int -> float array -> unit = "glstub_glMultiTexCoord3dvARB" "glstub_glMultiTexCoord3dvARB"
-external glMultiTexCoord3f: int -> float -> float -> float -> unit = "glstub_glMultiTexCoord3f" "glstub_glMultiTexCoord3f"
-external glMultiTexCoord3fARB: int -> float -> float -> float -> unit = "glstub_glMultiTexCoord3fARB" "glstub_glMultiTexCoord3fARB"
+external glMultiTexCoord3f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord3f" "glstub_glMultiTexCoord3f_nat" [@@noalloc]
+external glMultiTexCoord3fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord3fARB" "glstub_glMultiTexCoord3fARB_nat" [@@noalloc]
 
 external glMultiTexCoord3fv: int -> float_array -> unit = "glstub_glMultiTexCoord3fv" "glstub_glMultiTexCoord3fv"
 let glMultiTexCoord3fv p0 p1 =
@@ -5787,7 +6073,7 @@ let np1 = to_float_array p1 in
 let r = glMultiTexCoord3fvARB p0 np1 in
 r
 
-external glMultiTexCoord3hNV: int -> int -> int -> int -> unit = "glstub_glMultiTexCoord3hNV" "glstub_glMultiTexCoord3hNV"
+external glMultiTexCoord3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord3hNV" "glstub_glMultiTexCoord3hNV_nat" [@@noalloc]
 
 external glMultiTexCoord3hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord3hvNV" "glstub_glMultiTexCoord3hvNV"
 let glMultiTexCoord3hvNV p0 p1 =
@@ -5796,8 +6082,8 @@ let r = glMultiTexCoord3hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glMultiTexCoord3i: int -> int -> int -> int -> unit = "glstub_glMultiTexCoord3i" "glstub_glMultiTexCoord3i"
-external glMultiTexCoord3iARB: int -> int -> int -> int -> unit = "glstub_glMultiTexCoord3iARB" "glstub_glMultiTexCoord3iARB"
+external glMultiTexCoord3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord3i" "glstub_glMultiTexCoord3i_nat" [@@noalloc]
+external glMultiTexCoord3iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord3iARB" "glstub_glMultiTexCoord3iARB_nat" [@@noalloc]
 
 external glMultiTexCoord3iv: int -> word_array -> unit = "glstub_glMultiTexCoord3iv" "glstub_glMultiTexCoord3iv"
 let glMultiTexCoord3iv p0 p1 =
@@ -5812,8 +6098,8 @@ let np1 = to_word_array p1 in
 let r = glMultiTexCoord3ivARB p0 np1 in
 r
 
-external glMultiTexCoord3s: int -> int -> int -> int -> unit = "glstub_glMultiTexCoord3s" "glstub_glMultiTexCoord3s"
-external glMultiTexCoord3sARB: int -> int -> int -> int -> unit = "glstub_glMultiTexCoord3sARB" "glstub_glMultiTexCoord3sARB"
+external glMultiTexCoord3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord3s" "glstub_glMultiTexCoord3s_nat" [@@noalloc]
+external glMultiTexCoord3sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord3sARB" "glstub_glMultiTexCoord3sARB_nat" [@@noalloc]
 
 external glMultiTexCoord3sv: int -> short_array -> unit = "glstub_glMultiTexCoord3sv" "glstub_glMultiTexCoord3sv"
 let glMultiTexCoord3sv p0 p1 =
@@ -5828,12 +6114,12 @@ let np1 = to_short_array p1 in
 let r = glMultiTexCoord3svARB p0 np1 in
 r
 
-external glMultiTexCoord4d: int -> float -> float -> float -> float -> unit = "glstub_glMultiTexCoord4d" "glstub_glMultiTexCoord4d"
-external glMultiTexCoord4dARB: int -> float -> float -> float -> float -> unit = "glstub_glMultiTexCoord4dARB" "glstub_glMultiTexCoord4dARB"
+external glMultiTexCoord4d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord4d" "glstub_glMultiTexCoord4d_nat" [@@noalloc]
+external glMultiTexCoord4dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord4dARB" "glstub_glMultiTexCoord4dARB_nat" [@@noalloc]
 external glMultiTexCoord4dv: int -> float array -> unit = "glstub_glMultiTexCoord4dv" "glstub_glMultiTexCoord4dv"
 external glMultiTexCoord4dvARB: int -> float array -> unit = "glstub_glMultiTexCoord4dvARB" "glstub_glMultiTexCoord4dvARB"
-external glMultiTexCoord4f: int -> float -> float -> float -> float -> unit = "glstub_glMultiTexCoord4f" "glstub_glMultiTexCoord4f"
-external glMultiTexCoord4fARB: int -> float -> float -> float -> float -> unit = "glstub_glMultiTexCoord4fARB" "glstub_glMultiTexCoord4fARB"
+external glMultiTexCoord4f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord4f" "glstub_glMultiTexCoord4f_nat" [@@noalloc]
+external glMultiTexCoord4fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glMultiTexCoord4fARB" "glstub_glMultiTexCoord4fARB_nat" [@@noalloc]
 
 external glMultiTexCoord4fv: int -> float_array -> unit = "glstub_glMultiTexCoord4fv" "glstub_glMultiTexCoord4fv"
 let glMultiTexCoord4fv p0 p1 =
@@ -5848,7 +6134,7 @@ let np1 = to_float_array p1 in
 let r = glMultiTexCoord4fvARB p0 np1 in
 r
 
-external glMultiTexCoord4hNV: int -> int -> int -> int -> int -> unit = "glstub_glMultiTexCoord4hNV" "glstub_glMultiTexCoord4hNV"
+external glMultiTexCoord4hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord4hNV" "glstub_glMultiTexCoord4hNV_nat" [@@noalloc]
 
 external glMultiTexCoord4hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord4hvNV" "glstub_glMultiTexCoord4hvNV"
 let glMultiTexCoord4hvNV p0 p1 =
@@ -5857,8 +6143,8 @@ let r = glMultiTexCoord4hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glMultiTexCoord4i: int -> int -> int -> int -> int -> unit = "glstub_glMultiTexCoord4i" "glstub_glMultiTexCoord4i"
-external glMultiTexCoord4iARB: int -> int -> int -> int -> int -> unit = "glstub_glMultiTexCoord4iARB" "glstub_glMultiTexCoord4iARB"
+external glMultiTexCoord4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord4i" "glstub_glMultiTexCoord4i_nat" [@@noalloc]
+external glMultiTexCoord4iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord4iARB" "glstub_glMultiTexCoord4iARB_nat" [@@noalloc]
 
 external glMultiTexCoord4iv: int -> word_array -> unit = "glstub_glMultiTexCoord4iv" "glstub_glMultiTexCoord4iv"
 let glMultiTexCoord4iv p0 p1 =
@@ -5873,8 +6159,8 @@ let np1 = to_word_array p1 in
 let r = glMultiTexCoord4ivARB p0 np1 in
 r
 
-external glMultiTexCoord4s: int -> int -> int -> int -> int -> unit = "glstub_glMultiTexCoord4s" "glstub_glMultiTexCoord4s"
-external glMultiTexCoord4sARB: int -> int -> int -> int -> int -> unit = "glstub_glMultiTexCoord4sARB" "glstub_glMultiTexCoord4sARB"
+external glMultiTexCoord4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord4s" "glstub_glMultiTexCoord4s_nat" [@@noalloc]
+external glMultiTexCoord4sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glMultiTexCoord4sARB" "glstub_glMultiTexCoord4sARB_nat" [@@noalloc]
 
 external glMultiTexCoord4sv: int -> short_array -> unit = "glstub_glMultiTexCoord4sv" "glstub_glMultiTexCoord4sv"
 let glMultiTexCoord4sv p0 p1 =
@@ -5889,9 +6175,9 @@ let np1 = to_short_array p1 in
 let r = glMultiTexCoord4svARB p0 np1 in
 r
 
-external glNewList: int -> int -> unit = "glstub_glNewList" "glstub_glNewList"
+external glNewList: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNewList" "glstub_glNewList_nat" [@@noalloc]
 external glNewObjectBufferATI: int -> 'a -> int -> int = "glstub_glNewObjectBufferATI" "glstub_glNewObjectBufferATI"
-external glNormal3b: int -> int -> int -> unit = "glstub_glNormal3b" "glstub_glNormal3b"
+external glNormal3b: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormal3b" "glstub_glNormal3b_nat" [@@noalloc]
 
 external glNormal3bv: byte_array -> unit = "glstub_glNormal3bv" "glstub_glNormal3bv"
 let glNormal3bv p0 =
@@ -5899,10 +6185,10 @@ let np0 = to_byte_array p0 in
 let r = glNormal3bv np0 in
 r
 
-external glNormal3d: float -> float -> float -> unit = "glstub_glNormal3d" "glstub_glNormal3d"
+external glNormal3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glNormal3d" "glstub_glNormal3d_nat" [@@noalloc]
 external glNormal3dv: float array -> unit = "glstub_glNormal3dv" "glstub_glNormal3dv"
-external glNormal3f: float -> float -> float -> unit = "glstub_glNormal3f" "glstub_glNormal3f"
-external glNormal3fVertex3fSUN: float -> float -> float -> float -> float -> float -> unit = "glstub_glNormal3fVertex3fSUN_byte" "glstub_glNormal3fVertex3fSUN"
+external glNormal3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glNormal3f" "glstub_glNormal3f_nat" [@@noalloc]
+external glNormal3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glNormal3fVertex3fSUN_byte" "glstub_glNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glNormal3fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glNormal3fVertex3fvSUN" "glstub_glNormal3fVertex3fvSUN"
 let glNormal3fVertex3fvSUN p0 p1 =
@@ -5920,7 +6206,7 @@ let np0 = to_float_array p0 in
 let r = glNormal3fv np0 in
 r
 
-external glNormal3hNV: int -> int -> int -> unit = "glstub_glNormal3hNV" "glstub_glNormal3hNV"
+external glNormal3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormal3hNV" "glstub_glNormal3hNV_nat" [@@noalloc]
 
 external glNormal3hvNV: ushort_array -> unit = "glstub_glNormal3hvNV" "glstub_glNormal3hvNV"
 let glNormal3hvNV p0 =
@@ -5929,7 +6215,7 @@ let r = glNormal3hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glNormal3i: int -> int -> int -> unit = "glstub_glNormal3i" "glstub_glNormal3i"
+external glNormal3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormal3i" "glstub_glNormal3i_nat" [@@noalloc]
 
 external glNormal3iv: word_array -> unit = "glstub_glNormal3iv" "glstub_glNormal3iv"
 let glNormal3iv p0 =
@@ -5937,7 +6223,7 @@ let np0 = to_word_array p0 in
 let r = glNormal3iv np0 in
 r
 
-external glNormal3s: int -> int -> int -> unit = "glstub_glNormal3s" "glstub_glNormal3s"
+external glNormal3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormal3s" "glstub_glNormal3s_nat" [@@noalloc]
 
 external glNormal3sv: short_array -> unit = "glstub_glNormal3sv" "glstub_glNormal3sv"
 let glNormal3sv p0 =
@@ -5949,7 +6235,7 @@ external glNormalPointer: int -> int -> 'a -> unit = "glstub_glNormalPointer" "g
 external glNormalPointerEXT: int -> int -> int -> 'a -> unit = "glstub_glNormalPointerEXT" "glstub_glNormalPointerEXT"
 external glNormalPointerListIBM: int -> int -> 'a -> int -> unit = "glstub_glNormalPointerListIBM" "glstub_glNormalPointerListIBM"
 external glNormalPointervINTEL: int -> 'a -> unit = "glstub_glNormalPointervINTEL" "glstub_glNormalPointervINTEL"
-external glNormalStream3bATI: int -> int -> int -> int -> unit = "glstub_glNormalStream3bATI" "glstub_glNormalStream3bATI"
+external glNormalStream3bATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormalStream3bATI" "glstub_glNormalStream3bATI_nat" [@@noalloc]
 
 external glNormalStream3bvATI: int -> byte_array -> unit = "glstub_glNormalStream3bvATI" "glstub_glNormalStream3bvATI"
 let glNormalStream3bvATI p0 p1 =
@@ -5957,9 +6243,9 @@ let np1 = to_byte_array p1 in
 let r = glNormalStream3bvATI p0 np1 in
 r
 
-external glNormalStream3dATI: int -> float -> float -> float -> unit = "glstub_glNormalStream3dATI" "glstub_glNormalStream3dATI"
+external glNormalStream3dATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glNormalStream3dATI" "glstub_glNormalStream3dATI_nat" [@@noalloc]
 external glNormalStream3dvATI: int -> float array -> unit = "glstub_glNormalStream3dvATI" "glstub_glNormalStream3dvATI"
-external glNormalStream3fATI: int -> float -> float -> float -> unit = "glstub_glNormalStream3fATI" "glstub_glNormalStream3fATI"
+external glNormalStream3fATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glNormalStream3fATI" "glstub_glNormalStream3fATI_nat" [@@noalloc]
 
 external glNormalStream3fvATI: int -> float_array -> unit = "glstub_glNormalStream3fvATI" "glstub_glNormalStream3fvATI"
 let glNormalStream3fvATI p0 p1 =
@@ -5967,7 +6253,7 @@ let np1 = to_float_array p1 in
 let r = glNormalStream3fvATI p0 np1 in
 r
 
-external glNormalStream3iATI: int -> int -> int -> int -> unit = "glstub_glNormalStream3iATI" "glstub_glNormalStream3iATI"
+external glNormalStream3iATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormalStream3iATI" "glstub_glNormalStream3iATI_nat" [@@noalloc]
 
 external glNormalStream3ivATI: int -> word_array -> unit = "glstub_glNormalStream3ivATI" "glstub_glNormalStream3ivATI"
 let glNormalStream3ivATI p0 p1 =
@@ -5975,7 +6261,7 @@ let np1 = to_word_array p1 in
 let r = glNormalStream3ivATI p0 np1 in
 r
 
-external glNormalStream3sATI: int -> int -> int -> int -> unit = "glstub_glNormalStream3sATI" "glstub_glNormalStream3sATI"
+external glNormalStream3sATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glNormalStream3sATI" "glstub_glNormalStream3sATI_nat" [@@noalloc]
 
 external glNormalStream3svATI: int -> short_array -> unit = "glstub_glNormalStream3svATI" "glstub_glNormalStream3svATI"
 let glNormalStream3svATI p0 p1 =
@@ -5983,12 +6269,12 @@ let np1 = to_short_array p1 in
 let r = glNormalStream3svATI p0 np1 in
 r
 
-external glOrtho: float -> float -> float -> float -> float -> float -> unit = "glstub_glOrtho_byte" "glstub_glOrtho"
-external glOrthofOES: float -> float -> float -> float -> float -> float -> unit = "glstub_glOrthofOES_byte" "glstub_glOrthofOES"
-external glPNTrianglesfATI: int -> float -> unit = "glstub_glPNTrianglesfATI" "glstub_glPNTrianglesfATI"
-external glPNTrianglesiATI: int -> int -> unit = "glstub_glPNTrianglesiATI" "glstub_glPNTrianglesiATI"
-external glPassTexCoordATI: int -> int -> int -> unit = "glstub_glPassTexCoordATI" "glstub_glPassTexCoordATI"
-external glPassThrough: float -> unit = "glstub_glPassThrough" "glstub_glPassThrough"
+external glOrtho: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glOrtho_byte" "glstub_glOrtho_nat" [@@noalloc]
+external glOrthofOES: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glOrthofOES_byte" "glstub_glOrthofOES_nat" [@@noalloc]
+external glPNTrianglesfATI: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPNTrianglesfATI" "glstub_glPNTrianglesfATI_nat" [@@noalloc]
+external glPNTrianglesiATI: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPNTrianglesiATI" "glstub_glPNTrianglesiATI_nat" [@@noalloc]
+external glPassTexCoordATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPassTexCoordATI" "glstub_glPassTexCoordATI_nat" [@@noalloc]
+external glPassThrough: (float [@unboxed]) -> unit = "glstub_glPassThrough" "glstub_glPassThrough_nat" [@@noalloc]
 external glPixelDataRangeNV: int -> int -> 'a -> unit = "glstub_glPixelDataRangeNV" "glstub_glPixelDataRangeNV"
 
 external glPixelMapfv: int -> int -> float_array -> unit = "glstub_glPixelMapfv" "glstub_glPixelMapfv"
@@ -6011,12 +6297,12 @@ let np2 = to_ushort_array p2 in
 let r = glPixelMapusv p0 p1 np2 in
 r
 
-external glPixelStoref: int -> float -> unit = "glstub_glPixelStoref" "glstub_glPixelStoref"
-external glPixelStorei: int -> int -> unit = "glstub_glPixelStorei" "glstub_glPixelStorei"
-external glPixelTexGenSGIX: int -> unit = "glstub_glPixelTexGenSGIX" "glstub_glPixelTexGenSGIX"
-external glPixelTransferf: int -> float -> unit = "glstub_glPixelTransferf" "glstub_glPixelTransferf"
-external glPixelTransferi: int -> int -> unit = "glstub_glPixelTransferi" "glstub_glPixelTransferi"
-external glPixelTransformParameterfEXT: int -> int -> float -> unit = "glstub_glPixelTransformParameterfEXT" "glstub_glPixelTransformParameterfEXT"
+external glPixelStoref: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPixelStoref" "glstub_glPixelStoref_nat" [@@noalloc]
+external glPixelStorei: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPixelStorei" "glstub_glPixelStorei_nat" [@@noalloc]
+external glPixelTexGenSGIX: (int [@untagged]) -> unit = "glstub_glPixelTexGenSGIX" "glstub_glPixelTexGenSGIX_nat" [@@noalloc]
+external glPixelTransferf: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPixelTransferf" "glstub_glPixelTransferf_nat" [@@noalloc]
+external glPixelTransferi: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPixelTransferi" "glstub_glPixelTransferi_nat" [@@noalloc]
+external glPixelTransformParameterfEXT: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPixelTransformParameterfEXT" "glstub_glPixelTransformParameterfEXT_nat" [@@noalloc]
 
 external glPixelTransformParameterfvEXT: int -> int -> float_array -> unit = "glstub_glPixelTransformParameterfvEXT" "glstub_glPixelTransformParameterfvEXT"
 let glPixelTransformParameterfvEXT p0 p1 p2 =
@@ -6025,7 +6311,7 @@ let r = glPixelTransformParameterfvEXT p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glPixelTransformParameteriEXT: int -> int -> int -> unit = "glstub_glPixelTransformParameteriEXT" "glstub_glPixelTransformParameteriEXT"
+external glPixelTransformParameteriEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPixelTransformParameteriEXT" "glstub_glPixelTransformParameteriEXT_nat" [@@noalloc]
 
 external glPixelTransformParameterivEXT: int -> int -> word_array -> unit = "glstub_glPixelTransformParameterivEXT" "glstub_glPixelTransformParameterivEXT"
 let glPixelTransformParameterivEXT p0 p1 p2 =
@@ -6034,10 +6320,10 @@ let r = glPixelTransformParameterivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glPixelZoom: float -> float -> unit = "glstub_glPixelZoom" "glstub_glPixelZoom"
-external glPointParameterf: int -> float -> unit = "glstub_glPointParameterf" "glstub_glPointParameterf"
-external glPointParameterfARB: int -> float -> unit = "glstub_glPointParameterfARB" "glstub_glPointParameterfARB"
-external glPointParameterfEXT: int -> float -> unit = "glstub_glPointParameterfEXT" "glstub_glPointParameterfEXT"
+external glPixelZoom: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glPixelZoom" "glstub_glPixelZoom_nat" [@@noalloc]
+external glPointParameterf: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPointParameterf" "glstub_glPointParameterf_nat" [@@noalloc]
+external glPointParameterfARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPointParameterfARB" "glstub_glPointParameterfARB_nat" [@@noalloc]
+external glPointParameterfEXT: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glPointParameterfEXT" "glstub_glPointParameterfEXT_nat" [@@noalloc]
 
 external glPointParameterfv: int -> float_array -> unit = "glstub_glPointParameterfv" "glstub_glPointParameterfv"
 let glPointParameterfv p0 p1 =
@@ -6062,7 +6348,7 @@ let r = glPointParameterfvEXT p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glPointParameteriNV: int -> int -> unit = "glstub_glPointParameteriNV" "glstub_glPointParameteriNV"
+external glPointParameteriNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPointParameteriNV" "glstub_glPointParameteriNV_nat" [@@noalloc]
 
 external glPointParameterivNV: int -> word_array -> unit = "glstub_glPointParameterivNV" "glstub_glPointParameterivNV"
 let glPointParameterivNV p0 p1 =
@@ -6071,7 +6357,7 @@ let r = glPointParameterivNV p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glPointSize: float -> unit = "glstub_glPointSize" "glstub_glPointSize"
+external glPointSize: (float [@unboxed]) -> unit = "glstub_glPointSize" "glstub_glPointSize_nat" [@@noalloc]
 
 external glPollAsyncSGIX: word_array -> int = "glstub_glPollAsyncSGIX" "glstub_glPollAsyncSGIX"
 let glPollAsyncSGIX p0 =
@@ -6080,9 +6366,9 @@ let r = glPollAsyncSGIX np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glPolygonMode: int -> int -> unit = "glstub_glPolygonMode" "glstub_glPolygonMode"
-external glPolygonOffset: float -> float -> unit = "glstub_glPolygonOffset" "glstub_glPolygonOffset"
-external glPolygonOffsetEXT: float -> float -> unit = "glstub_glPolygonOffsetEXT" "glstub_glPolygonOffsetEXT"
+external glPolygonMode: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glPolygonMode" "glstub_glPolygonMode_nat" [@@noalloc]
+external glPolygonOffset: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glPolygonOffset" "glstub_glPolygonOffset_nat" [@@noalloc]
+external glPolygonOffsetEXT: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glPolygonOffsetEXT" "glstub_glPolygonOffsetEXT_nat" [@@noalloc]
 
 external glPolygonStipple: ubyte_array -> unit = "glstub_glPolygonStipple" "glstub_glPolygonStipple"
 let glPolygonStipple p0 =
@@ -6090,12 +6376,13 @@ let np0 = to_ubyte_array p0 in
 let r = glPolygonStipple np0 in
 r
 
-external glPopAttrib: unit -> unit = "glstub_glPopAttrib" "glstub_glPopAttrib"
-external glPopClientAttrib: unit -> unit = "glstub_glPopClientAttrib" "glstub_glPopClientAttrib"
-external glPopMatrix: unit -> unit = "glstub_glPopMatrix" "glstub_glPopMatrix"
-external glPopName: unit -> unit = "glstub_glPopName" "glstub_glPopName"
-external glPrimitiveRestartIndexNV: int -> unit = "glstub_glPrimitiveRestartIndexNV" "glstub_glPrimitiveRestartIndexNV"
-external glPrimitiveRestartNV: unit -> unit = "glstub_glPrimitiveRestartNV" "glstub_glPrimitiveRestartNV"
+external glPopAttrib: unit -> unit = "glstub_glPopAttrib" "glstub_glPopAttrib_nat" [@@noalloc]
+external glPopClientAttrib: unit -> unit = "glstub_glPopClientAttrib" "glstub_glPopClientAttrib_nat" [@@noalloc]
+external glPopMatrix: unit -> unit = "glstub_glPopMatrix" "glstub_glPopMatrix_nat" [@@noalloc]
+external glPopName: unit -> unit = "glstub_glPopName" "glstub_glPopName_nat" [@@noalloc]
+external glPrimitiveRestartIndex: (int [@untagged]) -> unit = "glstub_glPrimitiveRestartIndex" "glstub_glPrimitiveRestartIndex_nat" [@@noalloc]
+external glPrimitiveRestartIndexNV: (int [@untagged]) -> unit = "glstub_glPrimitiveRestartIndexNV" "glstub_glPrimitiveRestartIndexNV_nat" [@@noalloc]
+external glPrimitiveRestartNV: unit -> unit = "glstub_glPrimitiveRestartNV" "glstub_glPrimitiveRestartNV_nat" [@@noalloc]
 
 external glPrioritizeTextures: int -> word_array -> float_array -> unit = "glstub_glPrioritizeTextures" "glstub_glPrioritizeTextures"
 let glPrioritizeTextures p0 p1 p2 =
@@ -6114,6 +6401,7 @@ let _ = copy_word_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
+external glProgramBinary: int -> int -> 'a -> int -> unit = "glstub_glProgramBinary" "glstub_glProgramBinary"
 
 external glProgramBufferParametersIivNV: int -> int -> int -> int -> word_array -> unit = "glstub_glProgramBufferParametersIivNV" "glstub_glProgramBufferParametersIivNV"
 let glProgramBufferParametersIivNV p0 p1 p2 p3 p4 =
@@ -6138,9 +6426,9 @@ let r = glProgramBufferParametersfvNV p0 p1 p2 p3 np4 in
 let _ = copy_float_array np4 p4 in
 r
 
-external glProgramEnvParameter4dARB: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramEnvParameter4dARB_byte" "glstub_glProgramEnvParameter4dARB"
+external glProgramEnvParameter4dARB: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramEnvParameter4dARB_byte" "glstub_glProgramEnvParameter4dARB_nat" [@@noalloc]
 external glProgramEnvParameter4dvARB: int -> int -> float array -> unit = "glstub_glProgramEnvParameter4dvARB" "glstub_glProgramEnvParameter4dvARB"
-external glProgramEnvParameter4fARB: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramEnvParameter4fARB_byte" "glstub_glProgramEnvParameter4fARB"
+external glProgramEnvParameter4fARB: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramEnvParameter4fARB_byte" "glstub_glProgramEnvParameter4fARB_nat" [@@noalloc]
 
 external glProgramEnvParameter4fvARB: int -> int -> float_array -> unit = "glstub_glProgramEnvParameter4fvARB" "glstub_glProgramEnvParameter4fvARB"
 let glProgramEnvParameter4fvARB p0 p1 p2 =
@@ -6149,7 +6437,7 @@ let r = glProgramEnvParameter4fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glProgramEnvParameterI4iNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glProgramEnvParameterI4iNV_byte" "glstub_glProgramEnvParameterI4iNV"
+external glProgramEnvParameterI4iNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramEnvParameterI4iNV_byte" "glstub_glProgramEnvParameterI4iNV_nat" [@@noalloc]
 
 external glProgramEnvParameterI4ivNV: int -> int -> word_array -> unit = "glstub_glProgramEnvParameterI4ivNV" "glstub_glProgramEnvParameterI4ivNV"
 let glProgramEnvParameterI4ivNV p0 p1 p2 =
@@ -6158,7 +6446,7 @@ let r = glProgramEnvParameterI4ivNV p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glProgramEnvParameterI4uiNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glProgramEnvParameterI4uiNV_byte" "glstub_glProgramEnvParameterI4uiNV"
+external glProgramEnvParameterI4uiNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramEnvParameterI4uiNV_byte" "glstub_glProgramEnvParameterI4uiNV_nat" [@@noalloc]
 
 external glProgramEnvParameterI4uivNV: int -> int -> word_array -> unit = "glstub_glProgramEnvParameterI4uivNV" "glstub_glProgramEnvParameterI4uivNV"
 let glProgramEnvParameterI4uivNV p0 p1 p2 =
@@ -6191,9 +6479,9 @@ let r = glProgramEnvParametersI4uivNV p0 p1 p2 np3 in
 let _ = copy_word_array np3 p3 in
 r
 
-external glProgramLocalParameter4dARB: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramLocalParameter4dARB_byte" "glstub_glProgramLocalParameter4dARB"
+external glProgramLocalParameter4dARB: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramLocalParameter4dARB_byte" "glstub_glProgramLocalParameter4dARB_nat" [@@noalloc]
 external glProgramLocalParameter4dvARB: int -> int -> float array -> unit = "glstub_glProgramLocalParameter4dvARB" "glstub_glProgramLocalParameter4dvARB"
-external glProgramLocalParameter4fARB: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramLocalParameter4fARB_byte" "glstub_glProgramLocalParameter4fARB"
+external glProgramLocalParameter4fARB: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramLocalParameter4fARB_byte" "glstub_glProgramLocalParameter4fARB_nat" [@@noalloc]
 
 external glProgramLocalParameter4fvARB: int -> int -> float_array -> unit = "glstub_glProgramLocalParameter4fvARB" "glstub_glProgramLocalParameter4fvARB"
 let glProgramLocalParameter4fvARB p0 p1 p2 =
@@ -6202,7 +6490,7 @@ let r = glProgramLocalParameter4fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glProgramLocalParameterI4iNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glProgramLocalParameterI4iNV_byte" "glstub_glProgramLocalParameterI4iNV"
+external glProgramLocalParameterI4iNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramLocalParameterI4iNV_byte" "glstub_glProgramLocalParameterI4iNV_nat" [@@noalloc]
 
 external glProgramLocalParameterI4ivNV: int -> int -> word_array -> unit = "glstub_glProgramLocalParameterI4ivNV" "glstub_glProgramLocalParameterI4ivNV"
 let glProgramLocalParameterI4ivNV p0 p1 p2 =
@@ -6211,7 +6499,7 @@ let r = glProgramLocalParameterI4ivNV p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glProgramLocalParameterI4uiNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glProgramLocalParameterI4uiNV_byte" "glstub_glProgramLocalParameterI4uiNV"
+external glProgramLocalParameterI4uiNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramLocalParameterI4uiNV_byte" "glstub_glProgramLocalParameterI4uiNV_nat" [@@noalloc]
 
 external glProgramLocalParameterI4uivNV: int -> int -> word_array -> unit = "glstub_glProgramLocalParameterI4uivNV" "glstub_glProgramLocalParameterI4uivNV"
 let glProgramLocalParameterI4uivNV p0 p1 p2 =
@@ -6278,9 +6566,9 @@ let _ = copy_ubyte_array np2 p2 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glProgramParameter4dNV: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramParameter4dNV_byte" "glstub_glProgramParameter4dNV"
+external glProgramParameter4dNV: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramParameter4dNV_byte" "glstub_glProgramParameter4dNV_nat" [@@noalloc]
 external glProgramParameter4dvNV: int -> int -> float array -> unit = "glstub_glProgramParameter4dvNV" "glstub_glProgramParameter4dvNV"
-external glProgramParameter4fNV: int -> int -> float -> float -> float -> float -> unit = "glstub_glProgramParameter4fNV_byte" "glstub_glProgramParameter4fNV"
+external glProgramParameter4fNV: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glProgramParameter4fNV_byte" "glstub_glProgramParameter4fNV_nat" [@@noalloc]
 
 external glProgramParameter4fvNV: int -> int -> float_array -> unit = "glstub_glProgramParameter4fvNV" "glstub_glProgramParameter4fvNV"
 let glProgramParameter4fvNV p0 p1 p2 =
@@ -6289,7 +6577,8 @@ let r = glProgramParameter4fvNV p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glProgramParameteriEXT: int -> int -> int -> unit = "glstub_glProgramParameteriEXT" "glstub_glProgramParameteriEXT"
+external glProgramParameteri: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramParameteri" "glstub_glProgramParameteri_nat" [@@noalloc]
+external glProgramParameteriEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramParameteriEXT" "glstub_glProgramParameteriEXT_nat" [@@noalloc]
 external glProgramParameters4dvNV: int -> int -> int -> float array -> unit = "glstub_glProgramParameters4dvNV" "glstub_glProgramParameters4dvNV"
 
 external glProgramParameters4fvNV: int -> int -> int -> float_array -> unit = "glstub_glProgramParameters4fvNV" "glstub_glProgramParameters4fvNV"
@@ -6300,14 +6589,15 @@ let _ = copy_float_array np3 p3 in
 r
 
 external glProgramStringARB: int -> int -> int -> 'a -> unit = "glstub_glProgramStringARB" "glstub_glProgramStringARB"
-external glProgramVertexLimitNV: int -> int -> unit = "glstub_glProgramVertexLimitNV" "glstub_glProgramVertexLimitNV"
-external glPushAttrib: int -> unit = "glstub_glPushAttrib" "glstub_glPushAttrib"
-external glPushClientAttrib: int -> unit = "glstub_glPushClientAttrib" "glstub_glPushClientAttrib"
-external glPushMatrix: unit -> unit = "glstub_glPushMatrix" "glstub_glPushMatrix"
-external glPushName: int -> unit = "glstub_glPushName" "glstub_glPushName"
-external glRasterPos2d: float -> float -> unit = "glstub_glRasterPos2d" "glstub_glRasterPos2d"
+external glProgramVertexLimitNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glProgramVertexLimitNV" "glstub_glProgramVertexLimitNV_nat" [@@noalloc]
+external glPushAttrib: (int [@untagged]) -> unit = "glstub_glPushAttrib" "glstub_glPushAttrib_nat" [@@noalloc]
+external glPushClientAttrib: (int [@untagged]) -> unit = "glstub_glPushClientAttrib" "glstub_glPushClientAttrib_nat" [@@noalloc]
+external glPushMatrix: unit -> unit = "glstub_glPushMatrix" "glstub_glPushMatrix_nat" [@@noalloc]
+external glPushName: (int [@untagged]) -> unit = "glstub_glPushName" "glstub_glPushName_nat" [@@noalloc]
+external glQueryCounter: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glQueryCounter" "glstub_glQueryCounter_nat" [@@noalloc]
+external glRasterPos2d: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos2d" "glstub_glRasterPos2d_nat" [@@noalloc]
 external glRasterPos2dv: float array -> unit = "glstub_glRasterPos2dv" "glstub_glRasterPos2dv"
-external glRasterPos2f: float -> float -> unit = "glstub_glRasterPos2f" "glstub_glRasterPos2f"
+external glRasterPos2f: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos2f" "glstub_glRasterPos2f_nat" [@@noalloc]
 
 external glRasterPos2fv: float_array -> unit = "glstub_glRasterPos2fv" "glstub_glRasterPos2fv"
 let glRasterPos2fv p0 =
@@ -6315,7 +6605,7 @@ let np0 = to_float_array p0 in
 let r = glRasterPos2fv np0 in
 r
 
-external glRasterPos2i: int -> int -> unit = "glstub_glRasterPos2i" "glstub_glRasterPos2i"
+external glRasterPos2i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos2i" "glstub_glRasterPos2i_nat" [@@noalloc]
 
 external glRasterPos2iv: word_array -> unit = "glstub_glRasterPos2iv" "glstub_glRasterPos2iv"
 let glRasterPos2iv p0 =
@@ -6323,7 +6613,7 @@ let np0 = to_word_array p0 in
 let r = glRasterPos2iv np0 in
 r
 
-external glRasterPos2s: int -> int -> unit = "glstub_glRasterPos2s" "glstub_glRasterPos2s"
+external glRasterPos2s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos2s" "glstub_glRasterPos2s_nat" [@@noalloc]
 
 external glRasterPos2sv: short_array -> unit = "glstub_glRasterPos2sv" "glstub_glRasterPos2sv"
 let glRasterPos2sv p0 =
@@ -6331,9 +6621,9 @@ let np0 = to_short_array p0 in
 let r = glRasterPos2sv np0 in
 r
 
-external glRasterPos3d: float -> float -> float -> unit = "glstub_glRasterPos3d" "glstub_glRasterPos3d"
+external glRasterPos3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos3d" "glstub_glRasterPos3d_nat" [@@noalloc]
 external glRasterPos3dv: float array -> unit = "glstub_glRasterPos3dv" "glstub_glRasterPos3dv"
-external glRasterPos3f: float -> float -> float -> unit = "glstub_glRasterPos3f" "glstub_glRasterPos3f"
+external glRasterPos3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos3f" "glstub_glRasterPos3f_nat" [@@noalloc]
 
 external glRasterPos3fv: float_array -> unit = "glstub_glRasterPos3fv" "glstub_glRasterPos3fv"
 let glRasterPos3fv p0 =
@@ -6341,7 +6631,7 @@ let np0 = to_float_array p0 in
 let r = glRasterPos3fv np0 in
 r
 
-external glRasterPos3i: int -> int -> int -> unit = "glstub_glRasterPos3i" "glstub_glRasterPos3i"
+external glRasterPos3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos3i" "glstub_glRasterPos3i_nat" [@@noalloc]
 
 external glRasterPos3iv: word_array -> unit = "glstub_glRasterPos3iv" "glstub_glRasterPos3iv"
 let glRasterPos3iv p0 =
@@ -6349,7 +6639,7 @@ let np0 = to_word_array p0 in
 let r = glRasterPos3iv np0 in
 r
 
-external glRasterPos3s: int -> int -> int -> unit = "glstub_glRasterPos3s" "glstub_glRasterPos3s"
+external glRasterPos3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos3s" "glstub_glRasterPos3s_nat" [@@noalloc]
 
 external glRasterPos3sv: short_array -> unit = "glstub_glRasterPos3sv" "glstub_glRasterPos3sv"
 let glRasterPos3sv p0 =
@@ -6357,9 +6647,9 @@ let np0 = to_short_array p0 in
 let r = glRasterPos3sv np0 in
 r
 
-external glRasterPos4d: float -> float -> float -> float -> unit = "glstub_glRasterPos4d" "glstub_glRasterPos4d"
+external glRasterPos4d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos4d" "glstub_glRasterPos4d_nat" [@@noalloc]
 external glRasterPos4dv: float array -> unit = "glstub_glRasterPos4dv" "glstub_glRasterPos4dv"
-external glRasterPos4f: float -> float -> float -> float -> unit = "glstub_glRasterPos4f" "glstub_glRasterPos4f"
+external glRasterPos4f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRasterPos4f" "glstub_glRasterPos4f_nat" [@@noalloc]
 
 external glRasterPos4fv: float_array -> unit = "glstub_glRasterPos4fv" "glstub_glRasterPos4fv"
 let glRasterPos4fv p0 =
@@ -6367,7 +6657,7 @@ let np0 = to_float_array p0 in
 let r = glRasterPos4fv np0 in
 r
 
-external glRasterPos4i: int -> int -> int -> int -> unit = "glstub_glRasterPos4i" "glstub_glRasterPos4i"
+external glRasterPos4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos4i" "glstub_glRasterPos4i_nat" [@@noalloc]
 
 external glRasterPos4iv: word_array -> unit = "glstub_glRasterPos4iv" "glstub_glRasterPos4iv"
 let glRasterPos4iv p0 =
@@ -6375,7 +6665,7 @@ let np0 = to_word_array p0 in
 let r = glRasterPos4iv np0 in
 r
 
-external glRasterPos4s: int -> int -> int -> int -> unit = "glstub_glRasterPos4s" "glstub_glRasterPos4s"
+external glRasterPos4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRasterPos4s" "glstub_glRasterPos4s_nat" [@@noalloc]
 
 external glRasterPos4sv: short_array -> unit = "glstub_glRasterPos4sv" "glstub_glRasterPos4sv"
 let glRasterPos4sv p0 =
@@ -6383,12 +6673,12 @@ let np0 = to_short_array p0 in
 let r = glRasterPos4sv np0 in
 r
 
-external glReadBuffer: int -> unit = "glstub_glReadBuffer" "glstub_glReadBuffer"
+external glReadBuffer: (int [@untagged]) -> unit = "glstub_glReadBuffer" "glstub_glReadBuffer_nat" [@@noalloc]
 external glReadPixels: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glReadPixels_byte" "glstub_glReadPixels"
 external glReadVideoPixelsSUN: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glReadVideoPixelsSUN_byte" "glstub_glReadVideoPixelsSUN"
-external glRectd: float -> float -> float -> float -> unit = "glstub_glRectd" "glstub_glRectd"
+external glRectd: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRectd" "glstub_glRectd_nat" [@@noalloc]
 external glRectdv: float array -> float array -> unit = "glstub_glRectdv" "glstub_glRectdv"
-external glRectf: float -> float -> float -> float -> unit = "glstub_glRectf" "glstub_glRectf"
+external glRectf: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRectf" "glstub_glRectf_nat" [@@noalloc]
 
 external glRectfv: float_array -> float_array -> unit = "glstub_glRectfv" "glstub_glRectfv"
 let glRectfv p0 p1 =
@@ -6397,7 +6687,7 @@ let np1 = to_float_array p1 in
 let r = glRectfv np0 np1 in
 r
 
-external glRecti: int -> int -> int -> int -> unit = "glstub_glRecti" "glstub_glRecti"
+external glRecti: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRecti" "glstub_glRecti_nat" [@@noalloc]
 
 external glRectiv: word_array -> word_array -> unit = "glstub_glRectiv" "glstub_glRectiv"
 let glRectiv p0 p1 =
@@ -6406,7 +6696,7 @@ let np1 = to_word_array p1 in
 let r = glRectiv np0 np1 in
 r
 
-external glRects: int -> int -> int -> int -> unit = "glstub_glRects" "glstub_glRects"
+external glRects: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRects" "glstub_glRects_nat" [@@noalloc]
 
 external glRectsv: short_array -> short_array -> unit = "glstub_glRectsv" "glstub_glRectsv"
 let glRectsv p0 p1 =
@@ -6416,12 +6706,14 @@ let r = glRectsv np0 np1 in
 r
 
 external glReferencePlaneSGIX: float array -> unit = "glstub_glReferencePlaneSGIX" "glstub_glReferencePlaneSGIX"
-external glRenderMode: int -> int = "glstub_glRenderMode" "glstub_glRenderMode"
-external glRenderbufferStorageEXT: int -> int -> int -> int -> unit = "glstub_glRenderbufferStorageEXT" "glstub_glRenderbufferStorageEXT"
-external glRenderbufferStorageMultisampleCoverageNV: int -> int -> int -> int -> int -> int -> unit = "glstub_glRenderbufferStorageMultisampleCoverageNV_byte" "glstub_glRenderbufferStorageMultisampleCoverageNV"
-external glRenderbufferStorageMultisampleEXT: int -> int -> int -> int -> int -> unit = "glstub_glRenderbufferStorageMultisampleEXT" "glstub_glRenderbufferStorageMultisampleEXT"
+external glRenderMode: (int [@untagged]) -> (int [@untagged]) = "glstub_glRenderMode" "glstub_glRenderMode_nat" [@@noalloc]
+external glRenderbufferStorage: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRenderbufferStorage" "glstub_glRenderbufferStorage_nat" [@@noalloc]
+external glRenderbufferStorageEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRenderbufferStorageEXT" "glstub_glRenderbufferStorageEXT_nat" [@@noalloc]
+external glRenderbufferStorageMultisample: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRenderbufferStorageMultisample" "glstub_glRenderbufferStorageMultisample_nat" [@@noalloc]
+external glRenderbufferStorageMultisampleCoverageNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRenderbufferStorageMultisampleCoverageNV_byte" "glstub_glRenderbufferStorageMultisampleCoverageNV_nat" [@@noalloc]
+external glRenderbufferStorageMultisampleEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glRenderbufferStorageMultisampleEXT" "glstub_glRenderbufferStorageMultisampleEXT_nat" [@@noalloc]
 external glReplacementCodePointerSUN: int -> int -> 'a -> unit = "glstub_glReplacementCodePointerSUN" "glstub_glReplacementCodePointerSUN"
-external glReplacementCodeubSUN: int -> unit = "glstub_glReplacementCodeubSUN" "glstub_glReplacementCodeubSUN"
+external glReplacementCodeubSUN: (int [@untagged]) -> unit = "glstub_glReplacementCodeubSUN" "glstub_glReplacementCodeubSUN_nat" [@@noalloc]
 
 external glReplacementCodeubvSUN: ubyte_array -> unit = "glstub_glReplacementCodeubvSUN" "glstub_glReplacementCodeubvSUN"
 let glReplacementCodeubvSUN p0 =
@@ -6430,7 +6722,7 @@ let r = glReplacementCodeubvSUN np0 in
 let _ = copy_ubyte_array np0 p0 in
 r
 
-external glReplacementCodeuiColor3fVertex3fSUN: int -> float -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiColor3fVertex3fSUN_byte" "glstub_glReplacementCodeuiColor3fVertex3fSUN"
+external glReplacementCodeuiColor3fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiColor3fVertex3fSUN_byte" "glstub_glReplacementCodeuiColor3fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiColor3fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiColor3fVertex3fvSUN" "glstub_glReplacementCodeuiColor3fVertex3fvSUN"
 let glReplacementCodeuiColor3fVertex3fvSUN p0 p1 p2 =
@@ -6443,7 +6735,7 @@ let _ = copy_float_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glReplacementCodeuiColor4fNormal3fVertex3fSUN: int -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN"
+external glReplacementCodeuiColor4fNormal3fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiColor4fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN"
 let glReplacementCodeuiColor4fNormal3fVertex3fvSUN p0 p1 p2 p3 =
@@ -6458,7 +6750,7 @@ let _ = copy_float_array np2 p2 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glReplacementCodeuiColor4ubVertex3fSUN: int -> int -> int -> int -> int -> float -> float -> float -> unit = "glstub_glReplacementCodeuiColor4ubVertex3fSUN_byte" "glstub_glReplacementCodeuiColor4ubVertex3fSUN"
+external glReplacementCodeuiColor4ubVertex3fSUN: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiColor4ubVertex3fSUN_byte" "glstub_glReplacementCodeuiColor4ubVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiColor4ubVertex3fvSUN: word_array -> ubyte_array -> float_array -> unit = "glstub_glReplacementCodeuiColor4ubVertex3fvSUN" "glstub_glReplacementCodeuiColor4ubVertex3fvSUN"
 let glReplacementCodeuiColor4ubVertex3fvSUN p0 p1 p2 =
@@ -6471,7 +6763,7 @@ let _ = copy_ubyte_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glReplacementCodeuiNormal3fVertex3fSUN: int -> float -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiNormal3fVertex3fSUN"
+external glReplacementCodeuiNormal3fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiNormal3fVertex3fvSUN"
 let glReplacementCodeuiNormal3fVertex3fvSUN p0 p1 p2 =
@@ -6484,8 +6776,8 @@ let _ = copy_float_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glReplacementCodeuiSUN: int -> unit = "glstub_glReplacementCodeuiSUN" "glstub_glReplacementCodeuiSUN"
-external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN: int -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN"
+external glReplacementCodeuiSUN: (int [@untagged]) -> unit = "glstub_glReplacementCodeuiSUN" "glstub_glReplacementCodeuiSUN_nat" [@@noalloc]
+external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN"
 let glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN p0 p1 p2 p3 p4 =
@@ -6502,7 +6794,7 @@ let _ = copy_float_array np3 p3 in
 let _ = copy_float_array np4 p4 in
 r
 
-external glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN: int -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN"
+external glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN"
 let glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN p0 p1 p2 p3 =
@@ -6517,7 +6809,7 @@ let _ = copy_float_array np2 p2 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glReplacementCodeuiTexCoord2fVertex3fSUN: int -> float -> float -> float -> float -> float -> unit = "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN"
+external glReplacementCodeuiTexCoord2fVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN_byte" "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiTexCoord2fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN"
 let glReplacementCodeuiTexCoord2fVertex3fvSUN p0 p1 p2 =
@@ -6530,7 +6822,7 @@ let _ = copy_float_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glReplacementCodeuiVertex3fSUN: int -> float -> float -> float -> unit = "glstub_glReplacementCodeuiVertex3fSUN" "glstub_glReplacementCodeuiVertex3fSUN"
+external glReplacementCodeuiVertex3fSUN: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glReplacementCodeuiVertex3fSUN" "glstub_glReplacementCodeuiVertex3fSUN_nat" [@@noalloc]
 
 external glReplacementCodeuiVertex3fvSUN: word_array -> float_array -> unit = "glstub_glReplacementCodeuiVertex3fvSUN" "glstub_glReplacementCodeuiVertex3fvSUN"
 let glReplacementCodeuiVertex3fvSUN p0 p1 =
@@ -6549,7 +6841,7 @@ let r = glReplacementCodeuivSUN np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glReplacementCodeusSUN: int -> unit = "glstub_glReplacementCodeusSUN" "glstub_glReplacementCodeusSUN"
+external glReplacementCodeusSUN: (int [@untagged]) -> unit = "glstub_glReplacementCodeusSUN" "glstub_glReplacementCodeusSUN_nat" [@@noalloc]
 
 external glReplacementCodeusvSUN: ushort_array -> unit = "glstub_glReplacementCodeusvSUN" "glstub_glReplacementCodeusvSUN"
 let glReplacementCodeusvSUN p0 =
@@ -6566,25 +6858,27 @@ let r = glRequestResidentProgramsNV p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glResetHistogram: int -> unit = "glstub_glResetHistogram" "glstub_glResetHistogram"
-external glResetHistogramEXT: int -> unit = "glstub_glResetHistogramEXT" "glstub_glResetHistogramEXT"
-external glResetMinmax: int -> unit = "glstub_glResetMinmax" "glstub_glResetMinmax"
-external glResetMinmaxEXT: int -> unit = "glstub_glResetMinmaxEXT" "glstub_glResetMinmaxEXT"
-external glResizeBuffersMESA: unit -> unit = "glstub_glResizeBuffersMESA" "glstub_glResizeBuffersMESA"
-external glRotated: float -> float -> float -> float -> unit = "glstub_glRotated" "glstub_glRotated"
-external glRotatef: float -> float -> float -> float -> unit = "glstub_glRotatef" "glstub_glRotatef"
-external glSampleCoverage: float -> bool -> unit = "glstub_glSampleCoverage" "glstub_glSampleCoverage"
-external glSampleCoverageARB: float -> bool -> unit = "glstub_glSampleCoverageARB" "glstub_glSampleCoverageARB"
-external glSampleMapATI: int -> int -> int -> unit = "glstub_glSampleMapATI" "glstub_glSampleMapATI"
-external glSampleMaskEXT: float -> bool -> unit = "glstub_glSampleMaskEXT" "glstub_glSampleMaskEXT"
-external glSampleMaskSGIS: float -> bool -> unit = "glstub_glSampleMaskSGIS" "glstub_glSampleMaskSGIS"
-external glSamplePatternEXT: int -> unit = "glstub_glSamplePatternEXT" "glstub_glSamplePatternEXT"
-external glSamplePatternSGIS: int -> unit = "glstub_glSamplePatternSGIS" "glstub_glSamplePatternSGIS"
-external glScaled: float -> float -> float -> unit = "glstub_glScaled" "glstub_glScaled"
-external glScalef: float -> float -> float -> unit = "glstub_glScalef" "glstub_glScalef"
-external glScissor: int -> int -> int -> int -> unit = "glstub_glScissor" "glstub_glScissor"
-external glSecondaryColor3b: int -> int -> int -> unit = "glstub_glSecondaryColor3b" "glstub_glSecondaryColor3b"
-external glSecondaryColor3bEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3bEXT" "glstub_glSecondaryColor3bEXT"
+external glResetHistogram: (int [@untagged]) -> unit = "glstub_glResetHistogram" "glstub_glResetHistogram_nat" [@@noalloc]
+external glResetHistogramEXT: (int [@untagged]) -> unit = "glstub_glResetHistogramEXT" "glstub_glResetHistogramEXT_nat" [@@noalloc]
+external glResetMinmax: (int [@untagged]) -> unit = "glstub_glResetMinmax" "glstub_glResetMinmax_nat" [@@noalloc]
+external glResetMinmaxEXT: (int [@untagged]) -> unit = "glstub_glResetMinmaxEXT" "glstub_glResetMinmaxEXT_nat" [@@noalloc]
+external glResizeBuffersMESA: unit -> unit = "glstub_glResizeBuffersMESA" "glstub_glResizeBuffersMESA_nat" [@@noalloc]
+external glRotated: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRotated" "glstub_glRotated_nat" [@@noalloc]
+external glRotatef: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glRotatef" "glstub_glRotatef_nat" [@@noalloc]
+external glSampleCoverage: (float [@unboxed]) -> bool -> unit = "glstub_glSampleCoverage" "glstub_glSampleCoverage_nat" [@@noalloc]
+external glSampleCoverageARB: (float [@unboxed]) -> bool -> unit = "glstub_glSampleCoverageARB" "glstub_glSampleCoverageARB_nat" [@@noalloc]
+external glSampleMapATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSampleMapATI" "glstub_glSampleMapATI_nat" [@@noalloc]
+external glSampleMaskEXT: (float [@unboxed]) -> bool -> unit = "glstub_glSampleMaskEXT" "glstub_glSampleMaskEXT_nat" [@@noalloc]
+external glSampleMaskSGIS: (float [@unboxed]) -> bool -> unit = "glstub_glSampleMaskSGIS" "glstub_glSampleMaskSGIS_nat" [@@noalloc]
+external glSamplePatternEXT: (int [@untagged]) -> unit = "glstub_glSamplePatternEXT" "glstub_glSamplePatternEXT_nat" [@@noalloc]
+external glSamplePatternSGIS: (int [@untagged]) -> unit = "glstub_glSamplePatternSGIS" "glstub_glSamplePatternSGIS_nat" [@@noalloc]
+external glSamplerParameterf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glSamplerParameterf" "glstub_glSamplerParameterf_nat" [@@noalloc]
+external glSamplerParameteri: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSamplerParameteri" "glstub_glSamplerParameteri_nat" [@@noalloc]
+external glScaled: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glScaled" "glstub_glScaled_nat" [@@noalloc]
+external glScalef: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glScalef" "glstub_glScalef_nat" [@@noalloc]
+external glScissor: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glScissor" "glstub_glScissor_nat" [@@noalloc]
+external glSecondaryColor3b: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3b" "glstub_glSecondaryColor3b_nat" [@@noalloc]
+external glSecondaryColor3bEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3bEXT" "glstub_glSecondaryColor3bEXT_nat" [@@noalloc]
 
 external glSecondaryColor3bv: byte_array -> unit = "glstub_glSecondaryColor3bv" "glstub_glSecondaryColor3bv"
 let glSecondaryColor3bv p0 =
@@ -6599,12 +6893,12 @@ let np0 = to_byte_array p0 in
 let r = glSecondaryColor3bvEXT np0 in
 r
 
-external glSecondaryColor3d: float -> float -> float -> unit = "glstub_glSecondaryColor3d" "glstub_glSecondaryColor3d"
-external glSecondaryColor3dEXT: float -> float -> float -> unit = "glstub_glSecondaryColor3dEXT" "glstub_glSecondaryColor3dEXT"
+external glSecondaryColor3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glSecondaryColor3d" "glstub_glSecondaryColor3d_nat" [@@noalloc]
+external glSecondaryColor3dEXT: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glSecondaryColor3dEXT" "glstub_glSecondaryColor3dEXT_nat" [@@noalloc]
 external glSecondaryColor3dv: float array -> unit = "glstub_glSecondaryColor3dv" "glstub_glSecondaryColor3dv"
 external glSecondaryColor3dvEXT: float array -> unit = "glstub_glSecondaryColor3dvEXT" "glstub_glSecondaryColor3dvEXT"
-external glSecondaryColor3f: float -> float -> float -> unit = "glstub_glSecondaryColor3f" "glstub_glSecondaryColor3f"
-external glSecondaryColor3fEXT: float -> float -> float -> unit = "glstub_glSecondaryColor3fEXT" "glstub_glSecondaryColor3fEXT"
+external glSecondaryColor3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glSecondaryColor3f" "glstub_glSecondaryColor3f_nat" [@@noalloc]
+external glSecondaryColor3fEXT: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glSecondaryColor3fEXT" "glstub_glSecondaryColor3fEXT_nat" [@@noalloc]
 
 external glSecondaryColor3fv: float_array -> unit = "glstub_glSecondaryColor3fv" "glstub_glSecondaryColor3fv"
 let glSecondaryColor3fv p0 =
@@ -6619,7 +6913,7 @@ let np0 = to_float_array p0 in
 let r = glSecondaryColor3fvEXT np0 in
 r
 
-external glSecondaryColor3hNV: int -> int -> int -> unit = "glstub_glSecondaryColor3hNV" "glstub_glSecondaryColor3hNV"
+external glSecondaryColor3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3hNV" "glstub_glSecondaryColor3hNV_nat" [@@noalloc]
 
 external glSecondaryColor3hvNV: ushort_array -> unit = "glstub_glSecondaryColor3hvNV" "glstub_glSecondaryColor3hvNV"
 let glSecondaryColor3hvNV p0 =
@@ -6628,8 +6922,8 @@ let r = glSecondaryColor3hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glSecondaryColor3i: int -> int -> int -> unit = "glstub_glSecondaryColor3i" "glstub_glSecondaryColor3i"
-external glSecondaryColor3iEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3iEXT" "glstub_glSecondaryColor3iEXT"
+external glSecondaryColor3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3i" "glstub_glSecondaryColor3i_nat" [@@noalloc]
+external glSecondaryColor3iEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3iEXT" "glstub_glSecondaryColor3iEXT_nat" [@@noalloc]
 
 external glSecondaryColor3iv: word_array -> unit = "glstub_glSecondaryColor3iv" "glstub_glSecondaryColor3iv"
 let glSecondaryColor3iv p0 =
@@ -6644,8 +6938,8 @@ let np0 = to_word_array p0 in
 let r = glSecondaryColor3ivEXT np0 in
 r
 
-external glSecondaryColor3s: int -> int -> int -> unit = "glstub_glSecondaryColor3s" "glstub_glSecondaryColor3s"
-external glSecondaryColor3sEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3sEXT" "glstub_glSecondaryColor3sEXT"
+external glSecondaryColor3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3s" "glstub_glSecondaryColor3s_nat" [@@noalloc]
+external glSecondaryColor3sEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3sEXT" "glstub_glSecondaryColor3sEXT_nat" [@@noalloc]
 
 external glSecondaryColor3sv: short_array -> unit = "glstub_glSecondaryColor3sv" "glstub_glSecondaryColor3sv"
 let glSecondaryColor3sv p0 =
@@ -6660,8 +6954,8 @@ let np0 = to_short_array p0 in
 let r = glSecondaryColor3svEXT np0 in
 r
 
-external glSecondaryColor3ub: int -> int -> int -> unit = "glstub_glSecondaryColor3ub" "glstub_glSecondaryColor3ub"
-external glSecondaryColor3ubEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3ubEXT" "glstub_glSecondaryColor3ubEXT"
+external glSecondaryColor3ub: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3ub" "glstub_glSecondaryColor3ub_nat" [@@noalloc]
+external glSecondaryColor3ubEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3ubEXT" "glstub_glSecondaryColor3ubEXT_nat" [@@noalloc]
 
 external glSecondaryColor3ubv: ubyte_array -> unit = "glstub_glSecondaryColor3ubv" "glstub_glSecondaryColor3ubv"
 let glSecondaryColor3ubv p0 =
@@ -6676,8 +6970,8 @@ let np0 = to_ubyte_array p0 in
 let r = glSecondaryColor3ubvEXT np0 in
 r
 
-external glSecondaryColor3ui: int -> int -> int -> unit = "glstub_glSecondaryColor3ui" "glstub_glSecondaryColor3ui"
-external glSecondaryColor3uiEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3uiEXT" "glstub_glSecondaryColor3uiEXT"
+external glSecondaryColor3ui: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3ui" "glstub_glSecondaryColor3ui_nat" [@@noalloc]
+external glSecondaryColor3uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3uiEXT" "glstub_glSecondaryColor3uiEXT_nat" [@@noalloc]
 
 external glSecondaryColor3uiv: word_array -> unit = "glstub_glSecondaryColor3uiv" "glstub_glSecondaryColor3uiv"
 let glSecondaryColor3uiv p0 =
@@ -6692,8 +6986,8 @@ let np0 = to_word_array p0 in
 let r = glSecondaryColor3uivEXT np0 in
 r
 
-external glSecondaryColor3us: int -> int -> int -> unit = "glstub_glSecondaryColor3us" "glstub_glSecondaryColor3us"
-external glSecondaryColor3usEXT: int -> int -> int -> unit = "glstub_glSecondaryColor3usEXT" "glstub_glSecondaryColor3usEXT"
+external glSecondaryColor3us: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3us" "glstub_glSecondaryColor3us_nat" [@@noalloc]
+external glSecondaryColor3usEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSecondaryColor3usEXT" "glstub_glSecondaryColor3usEXT_nat" [@@noalloc]
 
 external glSecondaryColor3usv: ushort_array -> unit = "glstub_glSecondaryColor3usv" "glstub_glSecondaryColor3usv"
 let glSecondaryColor3usv p0 =
@@ -6721,8 +7015,8 @@ r
 
 external glSeparableFilter2D: int -> int -> int -> int -> int -> int -> 'a -> 'a -> unit = "glstub_glSeparableFilter2D_byte" "glstub_glSeparableFilter2D"
 external glSeparableFilter2DEXT: int -> int -> int -> int -> int -> int -> 'a -> 'a -> unit = "glstub_glSeparableFilter2DEXT_byte" "glstub_glSeparableFilter2DEXT"
-external glSetFenceAPPLE: int -> unit = "glstub_glSetFenceAPPLE" "glstub_glSetFenceAPPLE"
-external glSetFenceNV: int -> int -> unit = "glstub_glSetFenceNV" "glstub_glSetFenceNV"
+external glSetFenceAPPLE: (int [@untagged]) -> unit = "glstub_glSetFenceAPPLE" "glstub_glSetFenceAPPLE_nat" [@@noalloc]
+external glSetFenceNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSetFenceNV" "glstub_glSetFenceNV_nat" [@@noalloc]
 
 external glSetFragmentShaderConstantATI: int -> float_array -> unit = "glstub_glSetFragmentShaderConstantATI" "glstub_glSetFragmentShaderConstantATI"
 let glSetFragmentShaderConstantATI p0 p1 =
@@ -6733,10 +7027,10 @@ r
 
 external glSetInvariantEXT: int -> int -> 'a -> unit = "glstub_glSetInvariantEXT" "glstub_glSetInvariantEXT"
 external glSetLocalConstantEXT: int -> int -> 'a -> unit = "glstub_glSetLocalConstantEXT" "glstub_glSetLocalConstantEXT"
-external glShadeModel: int -> unit = "glstub_glShadeModel" "glstub_glShadeModel"
-external glShaderOp1EXT: int -> int -> int -> unit = "glstub_glShaderOp1EXT" "glstub_glShaderOp1EXT"
-external glShaderOp2EXT: int -> int -> int -> int -> unit = "glstub_glShaderOp2EXT" "glstub_glShaderOp2EXT"
-external glShaderOp3EXT: int -> int -> int -> int -> int -> unit = "glstub_glShaderOp3EXT" "glstub_glShaderOp3EXT"
+external glShadeModel: (int [@untagged]) -> unit = "glstub_glShadeModel" "glstub_glShadeModel_nat" [@@noalloc]
+external glShaderOp1EXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glShaderOp1EXT" "glstub_glShaderOp1EXT_nat" [@@noalloc]
+external glShaderOp2EXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glShaderOp2EXT" "glstub_glShaderOp2EXT_nat" [@@noalloc]
+external glShaderOp3EXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glShaderOp3EXT" "glstub_glShaderOp3EXT_nat" [@@noalloc]
 
 external glShaderSource: int -> int -> string array -> word_array -> unit = "glstub_glShaderSource" "glstub_glShaderSource"
 let glShaderSource p0 p1 p2 p3 =
@@ -6760,7 +7054,7 @@ let r = glSharpenTexFuncSGIS p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glSpriteParameterfSGIX: int -> float -> unit = "glstub_glSpriteParameterfSGIX" "glstub_glSpriteParameterfSGIX"
+external glSpriteParameterfSGIX: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glSpriteParameterfSGIX" "glstub_glSpriteParameterfSGIX_nat" [@@noalloc]
 
 external glSpriteParameterfvSGIX: int -> float_array -> unit = "glstub_glSpriteParameterfvSGIX" "glstub_glSpriteParameterfvSGIX"
 let glSpriteParameterfvSGIX p0 p1 =
@@ -6769,7 +7063,7 @@ let r = glSpriteParameterfvSGIX p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glSpriteParameteriSGIX: int -> int -> unit = "glstub_glSpriteParameteriSGIX" "glstub_glSpriteParameteriSGIX"
+external glSpriteParameteriSGIX: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSpriteParameteriSGIX" "glstub_glSpriteParameteriSGIX_nat" [@@noalloc]
 
 external glSpriteParameterivSGIX: int -> word_array -> unit = "glstub_glSpriteParameterivSGIX" "glstub_glSpriteParameterivSGIX"
 let glSpriteParameterivSGIX p0 p1 =
@@ -6778,23 +7072,24 @@ let r = glSpriteParameterivSGIX p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glStencilFunc: int -> int -> int -> unit = "glstub_glStencilFunc" "glstub_glStencilFunc"
-external glStencilFuncSeparate: int -> int -> int -> int -> unit = "glstub_glStencilFuncSeparate" "glstub_glStencilFuncSeparate"
-external glStencilFuncSeparateATI: int -> int -> int -> int -> unit = "glstub_glStencilFuncSeparateATI" "glstub_glStencilFuncSeparateATI"
-external glStencilMask: int -> unit = "glstub_glStencilMask" "glstub_glStencilMask"
-external glStencilMaskSeparate: int -> int -> unit = "glstub_glStencilMaskSeparate" "glstub_glStencilMaskSeparate"
-external glStencilOp: int -> int -> int -> unit = "glstub_glStencilOp" "glstub_glStencilOp"
-external glStencilOpSeparate: int -> int -> int -> int -> unit = "glstub_glStencilOpSeparate" "glstub_glStencilOpSeparate"
-external glStencilOpSeparateATI: int -> int -> int -> int -> unit = "glstub_glStencilOpSeparateATI" "glstub_glStencilOpSeparateATI"
+external glStencilFunc: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilFunc" "glstub_glStencilFunc_nat" [@@noalloc]
+external glStencilFuncSeparate: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilFuncSeparate" "glstub_glStencilFuncSeparate_nat" [@@noalloc]
+external glStencilFuncSeparateATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilFuncSeparateATI" "glstub_glStencilFuncSeparateATI_nat" [@@noalloc]
+external glStencilMask: (int [@untagged]) -> unit = "glstub_glStencilMask" "glstub_glStencilMask_nat" [@@noalloc]
+external glStencilMaskSeparate: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilMaskSeparate" "glstub_glStencilMaskSeparate_nat" [@@noalloc]
+external glStencilOp: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilOp" "glstub_glStencilOp_nat" [@@noalloc]
+external glStencilOpSeparate: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilOpSeparate" "glstub_glStencilOpSeparate_nat" [@@noalloc]
+external glStencilOpSeparateATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glStencilOpSeparateATI" "glstub_glStencilOpSeparateATI_nat" [@@noalloc]
 external glStringMarkerGREMEDY: int -> 'a -> unit = "glstub_glStringMarkerGREMEDY" "glstub_glStringMarkerGREMEDY"
-external glSwizzleEXT: int -> int -> int -> int -> int -> int -> unit = "glstub_glSwizzleEXT_byte" "glstub_glSwizzleEXT"
-external glTagSampleBufferSGIX: unit -> unit = "glstub_glTagSampleBufferSGIX" "glstub_glTagSampleBufferSGIX"
+external glSwizzleEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glSwizzleEXT_byte" "glstub_glSwizzleEXT_nat" [@@noalloc]
+external glTagSampleBufferSGIX: unit -> unit = "glstub_glTagSampleBufferSGIX" "glstub_glTagSampleBufferSGIX_nat" [@@noalloc]
 external glTangentPointerEXT: int -> int -> 'a -> unit = "glstub_glTangentPointerEXT" "glstub_glTangentPointerEXT"
-external glTbufferMask3DFX: int -> unit = "glstub_glTbufferMask3DFX" "glstub_glTbufferMask3DFX"
-external glTestFenceAPPLE: int -> bool = "glstub_glTestFenceAPPLE" "glstub_glTestFenceAPPLE"
-external glTestFenceNV: int -> bool = "glstub_glTestFenceNV" "glstub_glTestFenceNV"
-external glTestObjectAPPLE: int -> int -> bool = "glstub_glTestObjectAPPLE" "glstub_glTestObjectAPPLE"
-external glTexBufferEXT: int -> int -> int -> unit = "glstub_glTexBufferEXT" "glstub_glTexBufferEXT"
+external glTbufferMask3DFX: (int [@untagged]) -> unit = "glstub_glTbufferMask3DFX" "glstub_glTbufferMask3DFX_nat" [@@noalloc]
+external glTestFenceAPPLE: (int [@untagged]) -> bool = "glstub_glTestFenceAPPLE" "glstub_glTestFenceAPPLE_nat" [@@noalloc]
+external glTestFenceNV: (int [@untagged]) -> bool = "glstub_glTestFenceNV" "glstub_glTestFenceNV_nat" [@@noalloc]
+external glTestObjectAPPLE: (int [@untagged]) -> (int [@untagged]) -> bool = "glstub_glTestObjectAPPLE" "glstub_glTestObjectAPPLE_nat" [@@noalloc]
+external glTexBuffer: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexBuffer" "glstub_glTexBuffer_nat" [@@noalloc]
+external glTexBufferEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexBufferEXT" "glstub_glTexBufferEXT_nat" [@@noalloc]
 
 external glTexBumpParameterfvATI: int -> float_array -> unit = "glstub_glTexBumpParameterfvATI" "glstub_glTexBumpParameterfvATI"
 let glTexBumpParameterfvATI p0 p1 =
@@ -6811,9 +7106,9 @@ let r = glTexBumpParameterivATI p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glTexCoord1d: float -> unit = "glstub_glTexCoord1d" "glstub_glTexCoord1d"
+external glTexCoord1d: (float [@unboxed]) -> unit = "glstub_glTexCoord1d" "glstub_glTexCoord1d_nat" [@@noalloc]
 external glTexCoord1dv: float array -> unit = "glstub_glTexCoord1dv" "glstub_glTexCoord1dv"
-external glTexCoord1f: float -> unit = "glstub_glTexCoord1f" "glstub_glTexCoord1f"
+external glTexCoord1f: (float [@unboxed]) -> unit = "glstub_glTexCoord1f" "glstub_glTexCoord1f_nat" [@@noalloc]
 
 external glTexCoord1fv: float_array -> unit = "glstub_glTexCoord1fv" "glstub_glTexCoord1fv"
 let glTexCoord1fv p0 =
@@ -6821,7 +7116,7 @@ let np0 = to_float_array p0 in
 let r = glTexCoord1fv np0 in
 r
 
-external glTexCoord1hNV: int -> unit = "glstub_glTexCoord1hNV" "glstub_glTexCoord1hNV"
+external glTexCoord1hNV: (int [@untagged]) -> unit = "glstub_glTexCoord1hNV" "glstub_glTexCoord1hNV_nat" [@@noalloc]
 
 external glTexCoord1hvNV: ushort_array -> unit = "glstub_glTexCoord1hvNV" "glstub_glTexCoord1hvNV"
 let glTexCoord1hvNV p0 =
@@ -6830,7 +7125,7 @@ let r = glTexCoord1hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glTexCoord1i: int -> unit = "glstub_glTexCoord1i" "glstub_glTexCoord1i"
+external glTexCoord1i: (int [@untagged]) -> unit = "glstub_glTexCoord1i" "glstub_glTexCoord1i_nat" [@@noalloc]
 
 external glTexCoord1iv: word_array -> unit = "glstub_glTexCoord1iv" "glstub_glTexCoord1iv"
 let glTexCoord1iv p0 =
@@ -6838,7 +7133,7 @@ let np0 = to_word_array p0 in
 let r = glTexCoord1iv np0 in
 r
 
-external glTexCoord1s: int -> unit = "glstub_glTexCoord1s" "glstub_glTexCoord1s"
+external glTexCoord1s: (int [@untagged]) -> unit = "glstub_glTexCoord1s" "glstub_glTexCoord1s_nat" [@@noalloc]
 
 external glTexCoord1sv: short_array -> unit = "glstub_glTexCoord1sv" "glstub_glTexCoord1sv"
 let glTexCoord1sv p0 =
@@ -6846,10 +7141,10 @@ let np0 = to_short_array p0 in
 let r = glTexCoord1sv np0 in
 r
 
-external glTexCoord2d: float -> float -> unit = "glstub_glTexCoord2d" "glstub_glTexCoord2d"
+external glTexCoord2d: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2d" "glstub_glTexCoord2d_nat" [@@noalloc]
 external glTexCoord2dv: float array -> unit = "glstub_glTexCoord2dv" "glstub_glTexCoord2dv"
-external glTexCoord2f: float -> float -> unit = "glstub_glTexCoord2f" "glstub_glTexCoord2f"
-external glTexCoord2fColor3fVertex3fSUN: float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glTexCoord2fColor3fVertex3fSUN_byte" "glstub_glTexCoord2fColor3fVertex3fSUN"
+external glTexCoord2f: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2f" "glstub_glTexCoord2f_nat" [@@noalloc]
+external glTexCoord2fColor3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2fColor3fVertex3fSUN_byte" "glstub_glTexCoord2fColor3fVertex3fSUN_nat" [@@noalloc]
 
 external glTexCoord2fColor3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fColor3fVertex3fvSUN" "glstub_glTexCoord2fColor3fVertex3fvSUN"
 let glTexCoord2fColor3fVertex3fvSUN p0 p1 p2 =
@@ -6862,7 +7157,7 @@ let _ = copy_float_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glTexCoord2fColor4fNormal3fVertex3fSUN: float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN_byte" "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN"
+external glTexCoord2fColor4fNormal3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN_byte" "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glTexCoord2fColor4fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN" "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN"
 let glTexCoord2fColor4fNormal3fVertex3fvSUN p0 p1 p2 p3 =
@@ -6877,7 +7172,7 @@ let _ = copy_float_array np2 p2 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glTexCoord2fColor4ubVertex3fSUN: float -> float -> int -> int -> int -> int -> float -> float -> float -> unit = "glstub_glTexCoord2fColor4ubVertex3fSUN_byte" "glstub_glTexCoord2fColor4ubVertex3fSUN"
+external glTexCoord2fColor4ubVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2fColor4ubVertex3fSUN_byte" "glstub_glTexCoord2fColor4ubVertex3fSUN_nat" [@@noalloc]
 
 external glTexCoord2fColor4ubVertex3fvSUN: float_array -> ubyte_array -> float_array -> unit = "glstub_glTexCoord2fColor4ubVertex3fvSUN" "glstub_glTexCoord2fColor4ubVertex3fvSUN"
 let glTexCoord2fColor4ubVertex3fvSUN p0 p1 p2 =
@@ -6890,7 +7185,7 @@ let _ = copy_ubyte_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glTexCoord2fNormal3fVertex3fSUN: float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glTexCoord2fNormal3fVertex3fSUN_byte" "glstub_glTexCoord2fNormal3fVertex3fSUN"
+external glTexCoord2fNormal3fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2fNormal3fVertex3fSUN_byte" "glstub_glTexCoord2fNormal3fVertex3fSUN_nat" [@@noalloc]
 
 external glTexCoord2fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fNormal3fVertex3fvSUN" "glstub_glTexCoord2fNormal3fVertex3fvSUN"
 let glTexCoord2fNormal3fVertex3fvSUN p0 p1 p2 =
@@ -6903,7 +7198,7 @@ let _ = copy_float_array np1 p1 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glTexCoord2fVertex3fSUN: float -> float -> float -> float -> float -> unit = "glstub_glTexCoord2fVertex3fSUN" "glstub_glTexCoord2fVertex3fSUN"
+external glTexCoord2fVertex3fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord2fVertex3fSUN" "glstub_glTexCoord2fVertex3fSUN_nat" [@@noalloc]
 
 external glTexCoord2fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glTexCoord2fVertex3fvSUN" "glstub_glTexCoord2fVertex3fvSUN"
 let glTexCoord2fVertex3fvSUN p0 p1 =
@@ -6921,7 +7216,7 @@ let np0 = to_float_array p0 in
 let r = glTexCoord2fv np0 in
 r
 
-external glTexCoord2hNV: int -> int -> unit = "glstub_glTexCoord2hNV" "glstub_glTexCoord2hNV"
+external glTexCoord2hNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord2hNV" "glstub_glTexCoord2hNV_nat" [@@noalloc]
 
 external glTexCoord2hvNV: ushort_array -> unit = "glstub_glTexCoord2hvNV" "glstub_glTexCoord2hvNV"
 let glTexCoord2hvNV p0 =
@@ -6930,7 +7225,7 @@ let r = glTexCoord2hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glTexCoord2i: int -> int -> unit = "glstub_glTexCoord2i" "glstub_glTexCoord2i"
+external glTexCoord2i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord2i" "glstub_glTexCoord2i_nat" [@@noalloc]
 
 external glTexCoord2iv: word_array -> unit = "glstub_glTexCoord2iv" "glstub_glTexCoord2iv"
 let glTexCoord2iv p0 =
@@ -6938,7 +7233,7 @@ let np0 = to_word_array p0 in
 let r = glTexCoord2iv np0 in
 r
 
-external glTexCoord2s: int -> int -> unit = "glstub_glTexCoord2s" "glstub_glTexCoord2s"
+external glTexCoord2s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord2s" "glstub_glTexCoord2s_nat" [@@noalloc]
 
 external glTexCoord2sv: short_array -> unit = "glstub_glTexCoord2sv" "glstub_glTexCoord2sv"
 let glTexCoord2sv p0 =
@@ -6946,9 +7241,9 @@ let np0 = to_short_array p0 in
 let r = glTexCoord2sv np0 in
 r
 
-external glTexCoord3d: float -> float -> float -> unit = "glstub_glTexCoord3d" "glstub_glTexCoord3d"
+external glTexCoord3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord3d" "glstub_glTexCoord3d_nat" [@@noalloc]
 external glTexCoord3dv: float array -> unit = "glstub_glTexCoord3dv" "glstub_glTexCoord3dv"
-external glTexCoord3f: float -> float -> float -> unit = "glstub_glTexCoord3f" "glstub_glTexCoord3f"
+external glTexCoord3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord3f" "glstub_glTexCoord3f_nat" [@@noalloc]
 
 external glTexCoord3fv: float_array -> unit = "glstub_glTexCoord3fv" "glstub_glTexCoord3fv"
 let glTexCoord3fv p0 =
@@ -6956,7 +7251,7 @@ let np0 = to_float_array p0 in
 let r = glTexCoord3fv np0 in
 r
 
-external glTexCoord3hNV: int -> int -> int -> unit = "glstub_glTexCoord3hNV" "glstub_glTexCoord3hNV"
+external glTexCoord3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord3hNV" "glstub_glTexCoord3hNV_nat" [@@noalloc]
 
 external glTexCoord3hvNV: ushort_array -> unit = "glstub_glTexCoord3hvNV" "glstub_glTexCoord3hvNV"
 let glTexCoord3hvNV p0 =
@@ -6965,7 +7260,7 @@ let r = glTexCoord3hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glTexCoord3i: int -> int -> int -> unit = "glstub_glTexCoord3i" "glstub_glTexCoord3i"
+external glTexCoord3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord3i" "glstub_glTexCoord3i_nat" [@@noalloc]
 
 external glTexCoord3iv: word_array -> unit = "glstub_glTexCoord3iv" "glstub_glTexCoord3iv"
 let glTexCoord3iv p0 =
@@ -6973,7 +7268,7 @@ let np0 = to_word_array p0 in
 let r = glTexCoord3iv np0 in
 r
 
-external glTexCoord3s: int -> int -> int -> unit = "glstub_glTexCoord3s" "glstub_glTexCoord3s"
+external glTexCoord3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord3s" "glstub_glTexCoord3s_nat" [@@noalloc]
 
 external glTexCoord3sv: short_array -> unit = "glstub_glTexCoord3sv" "glstub_glTexCoord3sv"
 let glTexCoord3sv p0 =
@@ -6981,10 +7276,10 @@ let np0 = to_short_array p0 in
 let r = glTexCoord3sv np0 in
 r
 
-external glTexCoord4d: float -> float -> float -> float -> unit = "glstub_glTexCoord4d" "glstub_glTexCoord4d"
+external glTexCoord4d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord4d" "glstub_glTexCoord4d_nat" [@@noalloc]
 external glTexCoord4dv: float array -> unit = "glstub_glTexCoord4dv" "glstub_glTexCoord4dv"
-external glTexCoord4f: float -> float -> float -> float -> unit = "glstub_glTexCoord4f" "glstub_glTexCoord4f"
-external glTexCoord4fColor4fNormal3fVertex4fSUN: float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN_byte" "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN"
+external glTexCoord4f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord4f" "glstub_glTexCoord4f_nat" [@@noalloc]
+external glTexCoord4fColor4fNormal3fVertex4fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN_byte" "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN_nat" [@@noalloc]
 
 external glTexCoord4fColor4fNormal3fVertex4fvSUN: float_array -> float_array -> float_array -> float_array -> unit = "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN" "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN"
 let glTexCoord4fColor4fNormal3fVertex4fvSUN p0 p1 p2 p3 =
@@ -6999,7 +7294,7 @@ let _ = copy_float_array np2 p2 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glTexCoord4fVertex4fSUN: float -> float -> float -> float -> float -> float -> float -> float -> unit = "glstub_glTexCoord4fVertex4fSUN_byte" "glstub_glTexCoord4fVertex4fSUN"
+external glTexCoord4fVertex4fSUN: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexCoord4fVertex4fSUN_byte" "glstub_glTexCoord4fVertex4fSUN_nat" [@@noalloc]
 
 external glTexCoord4fVertex4fvSUN: float_array -> float_array -> unit = "glstub_glTexCoord4fVertex4fvSUN" "glstub_glTexCoord4fVertex4fvSUN"
 let glTexCoord4fVertex4fvSUN p0 p1 =
@@ -7017,7 +7312,7 @@ let np0 = to_float_array p0 in
 let r = glTexCoord4fv np0 in
 r
 
-external glTexCoord4hNV: int -> int -> int -> int -> unit = "glstub_glTexCoord4hNV" "glstub_glTexCoord4hNV"
+external glTexCoord4hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord4hNV" "glstub_glTexCoord4hNV_nat" [@@noalloc]
 
 external glTexCoord4hvNV: ushort_array -> unit = "glstub_glTexCoord4hvNV" "glstub_glTexCoord4hvNV"
 let glTexCoord4hvNV p0 =
@@ -7026,7 +7321,7 @@ let r = glTexCoord4hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glTexCoord4i: int -> int -> int -> int -> unit = "glstub_glTexCoord4i" "glstub_glTexCoord4i"
+external glTexCoord4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord4i" "glstub_glTexCoord4i_nat" [@@noalloc]
 
 external glTexCoord4iv: word_array -> unit = "glstub_glTexCoord4iv" "glstub_glTexCoord4iv"
 let glTexCoord4iv p0 =
@@ -7034,7 +7329,7 @@ let np0 = to_word_array p0 in
 let r = glTexCoord4iv np0 in
 r
 
-external glTexCoord4s: int -> int -> int -> int -> unit = "glstub_glTexCoord4s" "glstub_glTexCoord4s"
+external glTexCoord4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexCoord4s" "glstub_glTexCoord4s_nat" [@@noalloc]
 
 external glTexCoord4sv: short_array -> unit = "glstub_glTexCoord4sv" "glstub_glTexCoord4sv"
 let glTexCoord4sv p0 =
@@ -7046,7 +7341,7 @@ external glTexCoordPointer: int -> int -> int -> 'a -> unit = "glstub_glTexCoord
 external glTexCoordPointerEXT: int -> int -> int -> int -> 'a -> unit = "glstub_glTexCoordPointerEXT" "glstub_glTexCoordPointerEXT"
 external glTexCoordPointerListIBM: int -> int -> int -> 'a -> int -> unit = "glstub_glTexCoordPointerListIBM" "glstub_glTexCoordPointerListIBM"
 external glTexCoordPointervINTEL: int -> int -> 'a -> unit = "glstub_glTexCoordPointervINTEL" "glstub_glTexCoordPointervINTEL"
-external glTexEnvf: int -> int -> float -> unit = "glstub_glTexEnvf" "glstub_glTexEnvf"
+external glTexEnvf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glTexEnvf" "glstub_glTexEnvf_nat" [@@noalloc]
 
 external glTexEnvfv: int -> int -> float_array -> unit = "glstub_glTexEnvfv" "glstub_glTexEnvfv"
 let glTexEnvfv p0 p1 p2 =
@@ -7054,7 +7349,7 @@ let np2 = to_float_array p2 in
 let r = glTexEnvfv p0 p1 np2 in
 r
 
-external glTexEnvi: int -> int -> int -> unit = "glstub_glTexEnvi" "glstub_glTexEnvi"
+external glTexEnvi: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexEnvi" "glstub_glTexEnvi_nat" [@@noalloc]
 
 external glTexEnviv: int -> int -> word_array -> unit = "glstub_glTexEnviv" "glstub_glTexEnviv"
 let glTexEnviv p0 p1 p2 =
@@ -7070,9 +7365,9 @@ let r = glTexFilterFuncSGIS p0 p1 p2 np3 in
 let _ = copy_float_array np3 p3 in
 r
 
-external glTexGend: int -> int -> float -> unit = "glstub_glTexGend" "glstub_glTexGend"
+external glTexGend: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glTexGend" "glstub_glTexGend_nat" [@@noalloc]
 external glTexGendv: int -> int -> float array -> unit = "glstub_glTexGendv" "glstub_glTexGendv"
-external glTexGenf: int -> int -> float -> unit = "glstub_glTexGenf" "glstub_glTexGenf"
+external glTexGenf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glTexGenf" "glstub_glTexGenf_nat" [@@noalloc]
 
 external glTexGenfv: int -> int -> float_array -> unit = "glstub_glTexGenfv" "glstub_glTexGenfv"
 let glTexGenfv p0 p1 p2 =
@@ -7080,7 +7375,7 @@ let np2 = to_float_array p2 in
 let r = glTexGenfv p0 p1 np2 in
 r
 
-external glTexGeni: int -> int -> int -> unit = "glstub_glTexGeni" "glstub_glTexGeni"
+external glTexGeni: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexGeni" "glstub_glTexGeni_nat" [@@noalloc]
 
 external glTexGeniv: int -> int -> word_array -> unit = "glstub_glTexGeniv" "glstub_glTexGeniv"
 let glTexGeniv p0 p1 p2 =
@@ -7109,7 +7404,7 @@ let r = glTexParameterIuivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glTexParameterf: int -> int -> float -> unit = "glstub_glTexParameterf" "glstub_glTexParameterf"
+external glTexParameterf: (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glTexParameterf" "glstub_glTexParameterf_nat" [@@noalloc]
 
 external glTexParameterfv: int -> int -> float_array -> unit = "glstub_glTexParameterfv" "glstub_glTexParameterfv"
 let glTexParameterfv p0 p1 p2 =
@@ -7117,7 +7412,7 @@ let np2 = to_float_array p2 in
 let r = glTexParameterfv p0 p1 np2 in
 r
 
-external glTexParameteri: int -> int -> int -> unit = "glstub_glTexParameteri" "glstub_glTexParameteri"
+external glTexParameteri: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexParameteri" "glstub_glTexParameteri_nat" [@@noalloc]
 
 external glTexParameteriv: int -> int -> word_array -> unit = "glstub_glTexParameteriv" "glstub_glTexParameteriv"
 let glTexParameteriv p0 p1 p2 =
@@ -7125,8 +7420,9 @@ let np2 = to_word_array p2 in
 let r = glTexParameteriv p0 p1 np2 in
 r
 
-external glTexScissorFuncINTEL: int -> int -> int -> unit = "glstub_glTexScissorFuncINTEL" "glstub_glTexScissorFuncINTEL"
-external glTexScissorINTEL: int -> float -> float -> unit = "glstub_glTexScissorINTEL" "glstub_glTexScissorINTEL"
+external glTexScissorFuncINTEL: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexScissorFuncINTEL" "glstub_glTexScissorFuncINTEL_nat" [@@noalloc]
+external glTexScissorINTEL: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTexScissorINTEL" "glstub_glTexScissorINTEL_nat" [@@noalloc]
+external glTexStorage2D: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTexStorage2D" "glstub_glTexStorage2D_nat" [@@noalloc]
 external glTexSubImage1D: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage1D_byte" "glstub_glTexSubImage1D"
 external glTexSubImage1DEXT: int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage1DEXT_byte" "glstub_glTexSubImage1DEXT"
 external glTexSubImage2D: int -> int -> int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage2D_byte" "glstub_glTexSubImage2D"
@@ -7134,12 +7430,12 @@ external glTexSubImage2DEXT: int -> int -> int -> int -> int -> int -> int -> in
 external glTexSubImage3D: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage3D_byte" "glstub_glTexSubImage3D"
 external glTexSubImage3DEXT: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage3DEXT_byte" "glstub_glTexSubImage3DEXT"
 external glTexSubImage4DSGIS: int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> 'a -> unit = "glstub_glTexSubImage4DSGIS_byte" "glstub_glTexSubImage4DSGIS"
-external glTextureFogSGIX: int -> unit = "glstub_glTextureFogSGIX" "glstub_glTextureFogSGIX"
-external glTextureLightEXT: int -> unit = "glstub_glTextureLightEXT" "glstub_glTextureLightEXT"
-external glTextureMaterialEXT: int -> int -> unit = "glstub_glTextureMaterialEXT" "glstub_glTextureMaterialEXT"
-external glTextureNormalEXT: int -> unit = "glstub_glTextureNormalEXT" "glstub_glTextureNormalEXT"
+external glTextureFogSGIX: (int [@untagged]) -> unit = "glstub_glTextureFogSGIX" "glstub_glTextureFogSGIX_nat" [@@noalloc]
+external glTextureLightEXT: (int [@untagged]) -> unit = "glstub_glTextureLightEXT" "glstub_glTextureLightEXT_nat" [@@noalloc]
+external glTextureMaterialEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTextureMaterialEXT" "glstub_glTextureMaterialEXT_nat" [@@noalloc]
+external glTextureNormalEXT: (int [@untagged]) -> unit = "glstub_glTextureNormalEXT" "glstub_glTextureNormalEXT_nat" [@@noalloc]
 external glTextureRangeAPPLE: int -> int -> 'a -> unit = "glstub_glTextureRangeAPPLE" "glstub_glTextureRangeAPPLE"
-external glTrackMatrixNV: int -> int -> int -> int -> unit = "glstub_glTrackMatrixNV" "glstub_glTrackMatrixNV"
+external glTrackMatrixNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glTrackMatrixNV" "glstub_glTrackMatrixNV_nat" [@@noalloc]
 
 external glTransformFeedbackAttribsNV: int -> word_array -> int -> unit = "glstub_glTransformFeedbackAttribsNV" "glstub_glTransformFeedbackAttribsNV"
 let glTransformFeedbackAttribsNV p0 p1 p2 =
@@ -7156,10 +7452,10 @@ let r = glTransformFeedbackVaryingsNV p0 p1 np2 p3 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glTranslated: float -> float -> float -> unit = "glstub_glTranslated" "glstub_glTranslated"
-external glTranslatef: float -> float -> float -> unit = "glstub_glTranslatef" "glstub_glTranslatef"
-external glUniform1f: int -> float -> unit = "glstub_glUniform1f" "glstub_glUniform1f"
-external glUniform1fARB: int -> float -> unit = "glstub_glUniform1fARB" "glstub_glUniform1fARB"
+external glTranslated: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTranslated" "glstub_glTranslated_nat" [@@noalloc]
+external glTranslatef: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glTranslatef" "glstub_glTranslatef_nat" [@@noalloc]
+external glUniform1f: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glUniform1f" "glstub_glUniform1f_nat" [@@noalloc]
+external glUniform1fARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glUniform1fARB" "glstub_glUniform1fARB_nat" [@@noalloc]
 
 external glUniform1fv: int -> int -> float_array -> unit = "glstub_glUniform1fv" "glstub_glUniform1fv"
 let glUniform1fv p0 p1 p2 =
@@ -7175,8 +7471,8 @@ let r = glUniform1fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glUniform1i: int -> int -> unit = "glstub_glUniform1i" "glstub_glUniform1i"
-external glUniform1iARB: int -> int -> unit = "glstub_glUniform1iARB" "glstub_glUniform1iARB"
+external glUniform1i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform1i" "glstub_glUniform1i_nat" [@@noalloc]
+external glUniform1iARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform1iARB" "glstub_glUniform1iARB_nat" [@@noalloc]
 
 external glUniform1iv: int -> int -> word_array -> unit = "glstub_glUniform1iv" "glstub_glUniform1iv"
 let glUniform1iv p0 p1 p2 =
@@ -7192,7 +7488,7 @@ let r = glUniform1ivARB p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform1uiEXT: int -> int -> unit = "glstub_glUniform1uiEXT" "glstub_glUniform1uiEXT"
+external glUniform1uiEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform1uiEXT" "glstub_glUniform1uiEXT_nat" [@@noalloc]
 
 external glUniform1uivEXT: int -> int -> word_array -> unit = "glstub_glUniform1uivEXT" "glstub_glUniform1uivEXT"
 let glUniform1uivEXT p0 p1 p2 =
@@ -7201,8 +7497,8 @@ let r = glUniform1uivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform2f: int -> float -> float -> unit = "glstub_glUniform2f" "glstub_glUniform2f"
-external glUniform2fARB: int -> float -> float -> unit = "glstub_glUniform2fARB" "glstub_glUniform2fARB"
+external glUniform2f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform2f" "glstub_glUniform2f_nat" [@@noalloc]
+external glUniform2fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform2fARB" "glstub_glUniform2fARB_nat" [@@noalloc]
 
 external glUniform2fv: int -> int -> float_array -> unit = "glstub_glUniform2fv" "glstub_glUniform2fv"
 let glUniform2fv p0 p1 p2 =
@@ -7218,8 +7514,8 @@ let r = glUniform2fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glUniform2i: int -> int -> int -> unit = "glstub_glUniform2i" "glstub_glUniform2i"
-external glUniform2iARB: int -> int -> int -> unit = "glstub_glUniform2iARB" "glstub_glUniform2iARB"
+external glUniform2i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform2i" "glstub_glUniform2i_nat" [@@noalloc]
+external glUniform2iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform2iARB" "glstub_glUniform2iARB_nat" [@@noalloc]
 
 external glUniform2iv: int -> int -> word_array -> unit = "glstub_glUniform2iv" "glstub_glUniform2iv"
 let glUniform2iv p0 p1 p2 =
@@ -7235,7 +7531,7 @@ let r = glUniform2ivARB p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform2uiEXT: int -> int -> int -> unit = "glstub_glUniform2uiEXT" "glstub_glUniform2uiEXT"
+external glUniform2uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform2uiEXT" "glstub_glUniform2uiEXT_nat" [@@noalloc]
 
 external glUniform2uivEXT: int -> int -> word_array -> unit = "glstub_glUniform2uivEXT" "glstub_glUniform2uivEXT"
 let glUniform2uivEXT p0 p1 p2 =
@@ -7244,8 +7540,8 @@ let r = glUniform2uivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform3f: int -> float -> float -> float -> unit = "glstub_glUniform3f" "glstub_glUniform3f"
-external glUniform3fARB: int -> float -> float -> float -> unit = "glstub_glUniform3fARB" "glstub_glUniform3fARB"
+external glUniform3f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform3f" "glstub_glUniform3f_nat" [@@noalloc]
+external glUniform3fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform3fARB" "glstub_glUniform3fARB_nat" [@@noalloc]
 
 external glUniform3fv: int -> int -> float_array -> unit = "glstub_glUniform3fv" "glstub_glUniform3fv"
 let glUniform3fv p0 p1 p2 =
@@ -7261,8 +7557,8 @@ let r = glUniform3fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glUniform3i: int -> int -> int -> int -> unit = "glstub_glUniform3i" "glstub_glUniform3i"
-external glUniform3iARB: int -> int -> int -> int -> unit = "glstub_glUniform3iARB" "glstub_glUniform3iARB"
+external glUniform3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform3i" "glstub_glUniform3i_nat" [@@noalloc]
+external glUniform3iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform3iARB" "glstub_glUniform3iARB_nat" [@@noalloc]
 
 external glUniform3iv: int -> int -> word_array -> unit = "glstub_glUniform3iv" "glstub_glUniform3iv"
 let glUniform3iv p0 p1 p2 =
@@ -7278,7 +7574,7 @@ let r = glUniform3ivARB p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform3uiEXT: int -> int -> int -> int -> unit = "glstub_glUniform3uiEXT" "glstub_glUniform3uiEXT"
+external glUniform3uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform3uiEXT" "glstub_glUniform3uiEXT_nat" [@@noalloc]
 
 external glUniform3uivEXT: int -> int -> word_array -> unit = "glstub_glUniform3uivEXT" "glstub_glUniform3uivEXT"
 let glUniform3uivEXT p0 p1 p2 =
@@ -7287,8 +7583,8 @@ let r = glUniform3uivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform4f: int -> float -> float -> float -> float -> unit = "glstub_glUniform4f" "glstub_glUniform4f"
-external glUniform4fARB: int -> float -> float -> float -> float -> unit = "glstub_glUniform4fARB" "glstub_glUniform4fARB"
+external glUniform4f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform4f" "glstub_glUniform4f_nat" [@@noalloc]
+external glUniform4fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glUniform4fARB" "glstub_glUniform4fARB_nat" [@@noalloc]
 
 external glUniform4fv: int -> int -> float_array -> unit = "glstub_glUniform4fv" "glstub_glUniform4fv"
 let glUniform4fv p0 p1 p2 =
@@ -7304,8 +7600,8 @@ let r = glUniform4fvARB p0 p1 np2 in
 let _ = copy_float_array np2 p2 in
 r
 
-external glUniform4i: int -> int -> int -> int -> int -> unit = "glstub_glUniform4i" "glstub_glUniform4i"
-external glUniform4iARB: int -> int -> int -> int -> int -> unit = "glstub_glUniform4iARB" "glstub_glUniform4iARB"
+external glUniform4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform4i" "glstub_glUniform4i_nat" [@@noalloc]
+external glUniform4iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform4iARB" "glstub_glUniform4iARB_nat" [@@noalloc]
 
 external glUniform4iv: int -> int -> word_array -> unit = "glstub_glUniform4iv" "glstub_glUniform4iv"
 let glUniform4iv p0 p1 p2 =
@@ -7321,7 +7617,7 @@ let r = glUniform4ivARB p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniform4uiEXT: int -> int -> int -> int -> int -> unit = "glstub_glUniform4uiEXT" "glstub_glUniform4uiEXT"
+external glUniform4uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniform4uiEXT" "glstub_glUniform4uiEXT_nat" [@@noalloc]
 
 external glUniform4uivEXT: int -> int -> word_array -> unit = "glstub_glUniform4uivEXT" "glstub_glUniform4uivEXT"
 let glUniform4uivEXT p0 p1 p2 =
@@ -7330,7 +7626,8 @@ let r = glUniform4uivEXT p0 p1 np2 in
 let _ = copy_word_array np2 p2 in
 r
 
-external glUniformBufferEXT: int -> int -> int -> unit = "glstub_glUniformBufferEXT" "glstub_glUniformBufferEXT"
+external glUniformBlockBinding: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniformBlockBinding" "glstub_glUniformBlockBinding_nat" [@@noalloc]
+external glUniformBufferEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glUniformBufferEXT" "glstub_glUniformBufferEXT_nat" [@@noalloc]
 
 external glUniformMatrix2fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix2fv" "glstub_glUniformMatrix2fv"
 let glUniformMatrix2fv p0 p1 p2 p3 =
@@ -7418,16 +7715,16 @@ let np3 = to_float_array p3 in
 let r = glUniformMatrix4x3fv p0 p1 p2 np3 in
 r
 
-external glUnlockArraysEXT: unit -> unit = "glstub_glUnlockArraysEXT" "glstub_glUnlockArraysEXT"
-external glUnmapBuffer: int -> bool = "glstub_glUnmapBuffer" "glstub_glUnmapBuffer"
-external glUnmapBufferARB: int -> bool = "glstub_glUnmapBufferARB" "glstub_glUnmapBufferARB"
-external glUnmapObjectBufferATI: int -> unit = "glstub_glUnmapObjectBufferATI" "glstub_glUnmapObjectBufferATI"
+external glUnlockArraysEXT: unit -> unit = "glstub_glUnlockArraysEXT" "glstub_glUnlockArraysEXT_nat" [@@noalloc]
+external glUnmapBuffer: (int [@untagged]) -> bool = "glstub_glUnmapBuffer" "glstub_glUnmapBuffer_nat" [@@noalloc]
+external glUnmapBufferARB: (int [@untagged]) -> bool = "glstub_glUnmapBufferARB" "glstub_glUnmapBufferARB_nat" [@@noalloc]
+external glUnmapObjectBufferATI: (int [@untagged]) -> unit = "glstub_glUnmapObjectBufferATI" "glstub_glUnmapObjectBufferATI_nat" [@@noalloc]
 external glUpdateObjectBufferATI: int -> int -> int -> 'a -> int -> unit = "glstub_glUpdateObjectBufferATI" "glstub_glUpdateObjectBufferATI"
-external glUseProgram: int -> unit = "glstub_glUseProgram" "glstub_glUseProgram"
-external glUseProgramObjectARB: int -> unit = "glstub_glUseProgramObjectARB" "glstub_glUseProgramObjectARB"
-external glValidateProgram: int -> unit = "glstub_glValidateProgram" "glstub_glValidateProgram"
-external glValidateProgramARB: int -> unit = "glstub_glValidateProgramARB" "glstub_glValidateProgramARB"
-external glVariantArrayObjectATI: int -> int -> int -> int -> int -> unit = "glstub_glVariantArrayObjectATI" "glstub_glVariantArrayObjectATI"
+external glUseProgram: (int [@untagged]) -> unit = "glstub_glUseProgram" "glstub_glUseProgram_nat" [@@noalloc]
+external glUseProgramObjectARB: (int [@untagged]) -> unit = "glstub_glUseProgramObjectARB" "glstub_glUseProgramObjectARB_nat" [@@noalloc]
+external glValidateProgram: (int [@untagged]) -> unit = "glstub_glValidateProgram" "glstub_glValidateProgram_nat" [@@noalloc]
+external glValidateProgramARB: (int [@untagged]) -> unit = "glstub_glValidateProgramARB" "glstub_glValidateProgramARB_nat" [@@noalloc]
+external glVariantArrayObjectATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVariantArrayObjectATI" "glstub_glVariantArrayObjectATI_nat" [@@noalloc]
 external glVariantPointerEXT: int -> int -> int -> 'a -> unit = "glstub_glVariantPointerEXT" "glstub_glVariantPointerEXT"
 
 external glVariantbvEXT: int -> byte_array -> unit = "glstub_glVariantbvEXT" "glstub_glVariantbvEXT"
@@ -7486,9 +7783,9 @@ let r = glVariantusvEXT p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glVertex2d: float -> float -> unit = "glstub_glVertex2d" "glstub_glVertex2d"
+external glVertex2d: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex2d" "glstub_glVertex2d_nat" [@@noalloc]
 external glVertex2dv: float array -> unit = "glstub_glVertex2dv" "glstub_glVertex2dv"
-external glVertex2f: float -> float -> unit = "glstub_glVertex2f" "glstub_glVertex2f"
+external glVertex2f: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex2f" "glstub_glVertex2f_nat" [@@noalloc]
 
 external glVertex2fv: float_array -> unit = "glstub_glVertex2fv" "glstub_glVertex2fv"
 let glVertex2fv p0 =
@@ -7496,7 +7793,7 @@ let np0 = to_float_array p0 in
 let r = glVertex2fv np0 in
 r
 
-external glVertex2hNV: int -> int -> unit = "glstub_glVertex2hNV" "glstub_glVertex2hNV"
+external glVertex2hNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex2hNV" "glstub_glVertex2hNV_nat" [@@noalloc]
 
 external glVertex2hvNV: ushort_array -> unit = "glstub_glVertex2hvNV" "glstub_glVertex2hvNV"
 let glVertex2hvNV p0 =
@@ -7505,7 +7802,7 @@ let r = glVertex2hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glVertex2i: int -> int -> unit = "glstub_glVertex2i" "glstub_glVertex2i"
+external glVertex2i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex2i" "glstub_glVertex2i_nat" [@@noalloc]
 
 external glVertex2iv: word_array -> unit = "glstub_glVertex2iv" "glstub_glVertex2iv"
 let glVertex2iv p0 =
@@ -7513,7 +7810,7 @@ let np0 = to_word_array p0 in
 let r = glVertex2iv np0 in
 r
 
-external glVertex2s: int -> int -> unit = "glstub_glVertex2s" "glstub_glVertex2s"
+external glVertex2s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex2s" "glstub_glVertex2s_nat" [@@noalloc]
 
 external glVertex2sv: short_array -> unit = "glstub_glVertex2sv" "glstub_glVertex2sv"
 let glVertex2sv p0 =
@@ -7521,9 +7818,9 @@ let np0 = to_short_array p0 in
 let r = glVertex2sv np0 in
 r
 
-external glVertex3d: float -> float -> float -> unit = "glstub_glVertex3d" "glstub_glVertex3d"
+external glVertex3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex3d" "glstub_glVertex3d_nat" [@@noalloc]
 external glVertex3dv: float array -> unit = "glstub_glVertex3dv" "glstub_glVertex3dv"
-external glVertex3f: float -> float -> float -> unit = "glstub_glVertex3f" "glstub_glVertex3f"
+external glVertex3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex3f" "glstub_glVertex3f_nat" [@@noalloc]
 
 external glVertex3fv: float_array -> unit = "glstub_glVertex3fv" "glstub_glVertex3fv"
 let glVertex3fv p0 =
@@ -7531,7 +7828,7 @@ let np0 = to_float_array p0 in
 let r = glVertex3fv np0 in
 r
 
-external glVertex3hNV: int -> int -> int -> unit = "glstub_glVertex3hNV" "glstub_glVertex3hNV"
+external glVertex3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex3hNV" "glstub_glVertex3hNV_nat" [@@noalloc]
 
 external glVertex3hvNV: ushort_array -> unit = "glstub_glVertex3hvNV" "glstub_glVertex3hvNV"
 let glVertex3hvNV p0 =
@@ -7540,7 +7837,7 @@ let r = glVertex3hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glVertex3i: int -> int -> int -> unit = "glstub_glVertex3i" "glstub_glVertex3i"
+external glVertex3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex3i" "glstub_glVertex3i_nat" [@@noalloc]
 
 external glVertex3iv: word_array -> unit = "glstub_glVertex3iv" "glstub_glVertex3iv"
 let glVertex3iv p0 =
@@ -7548,7 +7845,7 @@ let np0 = to_word_array p0 in
 let r = glVertex3iv np0 in
 r
 
-external glVertex3s: int -> int -> int -> unit = "glstub_glVertex3s" "glstub_glVertex3s"
+external glVertex3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex3s" "glstub_glVertex3s_nat" [@@noalloc]
 
 external glVertex3sv: short_array -> unit = "glstub_glVertex3sv" "glstub_glVertex3sv"
 let glVertex3sv p0 =
@@ -7556,9 +7853,9 @@ let np0 = to_short_array p0 in
 let r = glVertex3sv np0 in
 r
 
-external glVertex4d: float -> float -> float -> float -> unit = "glstub_glVertex4d" "glstub_glVertex4d"
+external glVertex4d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex4d" "glstub_glVertex4d_nat" [@@noalloc]
 external glVertex4dv: float array -> unit = "glstub_glVertex4dv" "glstub_glVertex4dv"
-external glVertex4f: float -> float -> float -> float -> unit = "glstub_glVertex4f" "glstub_glVertex4f"
+external glVertex4f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertex4f" "glstub_glVertex4f_nat" [@@noalloc]
 
 external glVertex4fv: float_array -> unit = "glstub_glVertex4fv" "glstub_glVertex4fv"
 let glVertex4fv p0 =
@@ -7566,7 +7863,7 @@ let np0 = to_float_array p0 in
 let r = glVertex4fv np0 in
 r
 
-external glVertex4hNV: int -> int -> int -> int -> unit = "glstub_glVertex4hNV" "glstub_glVertex4hNV"
+external glVertex4hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex4hNV" "glstub_glVertex4hNV_nat" [@@noalloc]
 
 external glVertex4hvNV: ushort_array -> unit = "glstub_glVertex4hvNV" "glstub_glVertex4hvNV"
 let glVertex4hvNV p0 =
@@ -7575,7 +7872,7 @@ let r = glVertex4hvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glVertex4i: int -> int -> int -> int -> unit = "glstub_glVertex4i" "glstub_glVertex4i"
+external glVertex4i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex4i" "glstub_glVertex4i_nat" [@@noalloc]
 
 external glVertex4iv: word_array -> unit = "glstub_glVertex4iv" "glstub_glVertex4iv"
 let glVertex4iv p0 =
@@ -7583,7 +7880,7 @@ let np0 = to_word_array p0 in
 let r = glVertex4iv np0 in
 r
 
-external glVertex4s: int -> int -> int -> int -> unit = "glstub_glVertex4s" "glstub_glVertex4s"
+external glVertex4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertex4s" "glstub_glVertex4s_nat" [@@noalloc]
 
 external glVertex4sv: short_array -> unit = "glstub_glVertex4sv" "glstub_glVertex4sv"
 let glVertex4sv p0 =
@@ -7591,18 +7888,18 @@ let np0 = to_short_array p0 in
 let r = glVertex4sv np0 in
 r
 
-external glVertexArrayParameteriAPPLE: int -> int -> unit = "glstub_glVertexArrayParameteriAPPLE" "glstub_glVertexArrayParameteriAPPLE"
+external glVertexArrayParameteriAPPLE: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexArrayParameteriAPPLE" "glstub_glVertexArrayParameteriAPPLE_nat" [@@noalloc]
 external glVertexArrayRangeAPPLE: int -> 'a -> unit = "glstub_glVertexArrayRangeAPPLE" "glstub_glVertexArrayRangeAPPLE"
 external glVertexArrayRangeNV: int -> 'a -> unit = "glstub_glVertexArrayRangeNV" "glstub_glVertexArrayRangeNV"
-external glVertexAttrib1d: int -> float -> unit = "glstub_glVertexAttrib1d" "glstub_glVertexAttrib1d"
-external glVertexAttrib1dARB: int -> float -> unit = "glstub_glVertexAttrib1dARB" "glstub_glVertexAttrib1dARB"
-external glVertexAttrib1dNV: int -> float -> unit = "glstub_glVertexAttrib1dNV" "glstub_glVertexAttrib1dNV"
+external glVertexAttrib1d: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1d" "glstub_glVertexAttrib1d_nat" [@@noalloc]
+external glVertexAttrib1dARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1dARB" "glstub_glVertexAttrib1dARB_nat" [@@noalloc]
+external glVertexAttrib1dNV: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1dNV" "glstub_glVertexAttrib1dNV_nat" [@@noalloc]
 external glVertexAttrib1dv: int -> float array -> unit = "glstub_glVertexAttrib1dv" "glstub_glVertexAttrib1dv"
 external glVertexAttrib1dvARB: int -> float array -> unit = "glstub_glVertexAttrib1dvARB" "glstub_glVertexAttrib1dvARB"
 external glVertexAttrib1dvNV: int -> float array -> unit = "glstub_glVertexAttrib1dvNV" "glstub_glVertexAttrib1dvNV"
-external glVertexAttrib1f: int -> float -> unit = "glstub_glVertexAttrib1f" "glstub_glVertexAttrib1f"
-external glVertexAttrib1fARB: int -> float -> unit = "glstub_glVertexAttrib1fARB" "glstub_glVertexAttrib1fARB"
-external glVertexAttrib1fNV: int -> float -> unit = "glstub_glVertexAttrib1fNV" "glstub_glVertexAttrib1fNV"
+external glVertexAttrib1f: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1f" "glstub_glVertexAttrib1f_nat" [@@noalloc]
+external glVertexAttrib1fARB: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1fARB" "glstub_glVertexAttrib1fARB_nat" [@@noalloc]
+external glVertexAttrib1fNV: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib1fNV" "glstub_glVertexAttrib1fNV_nat" [@@noalloc]
 
 external glVertexAttrib1fv: int -> float_array -> unit = "glstub_glVertexAttrib1fv" "glstub_glVertexAttrib1fv"
 let glVertexAttrib1fv p0 p1 =
@@ -7626,7 +7923,7 @@ let r = glVertexAttrib1fvNV p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glVertexAttrib1hNV: int -> int -> unit = "glstub_glVertexAttrib1hNV" "glstub_glVertexAttrib1hNV"
+external glVertexAttrib1hNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib1hNV" "glstub_glVertexAttrib1hNV_nat" [@@noalloc]
 
 external glVertexAttrib1hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib1hvNV" "glstub_glVertexAttrib1hvNV"
 let glVertexAttrib1hvNV p0 p1 =
@@ -7635,9 +7932,9 @@ let r = glVertexAttrib1hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glVertexAttrib1s: int -> int -> unit = "glstub_glVertexAttrib1s" "glstub_glVertexAttrib1s"
-external glVertexAttrib1sARB: int -> int -> unit = "glstub_glVertexAttrib1sARB" "glstub_glVertexAttrib1sARB"
-external glVertexAttrib1sNV: int -> int -> unit = "glstub_glVertexAttrib1sNV" "glstub_glVertexAttrib1sNV"
+external glVertexAttrib1s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib1s" "glstub_glVertexAttrib1s_nat" [@@noalloc]
+external glVertexAttrib1sARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib1sARB" "glstub_glVertexAttrib1sARB_nat" [@@noalloc]
+external glVertexAttrib1sNV: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib1sNV" "glstub_glVertexAttrib1sNV_nat" [@@noalloc]
 
 external glVertexAttrib1sv: int -> short_array -> unit = "glstub_glVertexAttrib1sv" "glstub_glVertexAttrib1sv"
 let glVertexAttrib1sv p0 p1 =
@@ -7661,15 +7958,15 @@ let r = glVertexAttrib1svNV p0 np1 in
 let _ = copy_short_array np1 p1 in
 r
 
-external glVertexAttrib2d: int -> float -> float -> unit = "glstub_glVertexAttrib2d" "glstub_glVertexAttrib2d"
-external glVertexAttrib2dARB: int -> float -> float -> unit = "glstub_glVertexAttrib2dARB" "glstub_glVertexAttrib2dARB"
-external glVertexAttrib2dNV: int -> float -> float -> unit = "glstub_glVertexAttrib2dNV" "glstub_glVertexAttrib2dNV"
+external glVertexAttrib2d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2d" "glstub_glVertexAttrib2d_nat" [@@noalloc]
+external glVertexAttrib2dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2dARB" "glstub_glVertexAttrib2dARB_nat" [@@noalloc]
+external glVertexAttrib2dNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2dNV" "glstub_glVertexAttrib2dNV_nat" [@@noalloc]
 external glVertexAttrib2dv: int -> float array -> unit = "glstub_glVertexAttrib2dv" "glstub_glVertexAttrib2dv"
 external glVertexAttrib2dvARB: int -> float array -> unit = "glstub_glVertexAttrib2dvARB" "glstub_glVertexAttrib2dvARB"
 external glVertexAttrib2dvNV: int -> float array -> unit = "glstub_glVertexAttrib2dvNV" "glstub_glVertexAttrib2dvNV"
-external glVertexAttrib2f: int -> float -> float -> unit = "glstub_glVertexAttrib2f" "glstub_glVertexAttrib2f"
-external glVertexAttrib2fARB: int -> float -> float -> unit = "glstub_glVertexAttrib2fARB" "glstub_glVertexAttrib2fARB"
-external glVertexAttrib2fNV: int -> float -> float -> unit = "glstub_glVertexAttrib2fNV" "glstub_glVertexAttrib2fNV"
+external glVertexAttrib2f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2f" "glstub_glVertexAttrib2f_nat" [@@noalloc]
+external glVertexAttrib2fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2fARB" "glstub_glVertexAttrib2fARB_nat" [@@noalloc]
+external glVertexAttrib2fNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib2fNV" "glstub_glVertexAttrib2fNV_nat" [@@noalloc]
 
 external glVertexAttrib2fv: int -> float_array -> unit = "glstub_glVertexAttrib2fv" "glstub_glVertexAttrib2fv"
 let glVertexAttrib2fv p0 p1 =
@@ -7693,7 +7990,7 @@ let r = glVertexAttrib2fvNV p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glVertexAttrib2hNV: int -> int -> int -> unit = "glstub_glVertexAttrib2hNV" "glstub_glVertexAttrib2hNV"
+external glVertexAttrib2hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib2hNV" "glstub_glVertexAttrib2hNV_nat" [@@noalloc]
 
 external glVertexAttrib2hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib2hvNV" "glstub_glVertexAttrib2hvNV"
 let glVertexAttrib2hvNV p0 p1 =
@@ -7702,9 +7999,9 @@ let r = glVertexAttrib2hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glVertexAttrib2s: int -> int -> int -> unit = "glstub_glVertexAttrib2s" "glstub_glVertexAttrib2s"
-external glVertexAttrib2sARB: int -> int -> int -> unit = "glstub_glVertexAttrib2sARB" "glstub_glVertexAttrib2sARB"
-external glVertexAttrib2sNV: int -> int -> int -> unit = "glstub_glVertexAttrib2sNV" "glstub_glVertexAttrib2sNV"
+external glVertexAttrib2s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib2s" "glstub_glVertexAttrib2s_nat" [@@noalloc]
+external glVertexAttrib2sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib2sARB" "glstub_glVertexAttrib2sARB_nat" [@@noalloc]
+external glVertexAttrib2sNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib2sNV" "glstub_glVertexAttrib2sNV_nat" [@@noalloc]
 
 external glVertexAttrib2sv: int -> short_array -> unit = "glstub_glVertexAttrib2sv" "glstub_glVertexAttrib2sv"
 let glVertexAttrib2sv p0 p1 =
@@ -7728,15 +8025,15 @@ let r = glVertexAttrib2svNV p0 np1 in
 let _ = copy_short_array np1 p1 in
 r
 
-external glVertexAttrib3d: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3d" "glstub_glVertexAttrib3d"
-external glVertexAttrib3dARB: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3dARB" "glstub_glVertexAttrib3dARB"
-external glVertexAttrib3dNV: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3dNV" "glstub_glVertexAttrib3dNV"
+external glVertexAttrib3d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3d" "glstub_glVertexAttrib3d_nat" [@@noalloc]
+external glVertexAttrib3dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3dARB" "glstub_glVertexAttrib3dARB_nat" [@@noalloc]
+external glVertexAttrib3dNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3dNV" "glstub_glVertexAttrib3dNV_nat" [@@noalloc]
 external glVertexAttrib3dv: int -> float array -> unit = "glstub_glVertexAttrib3dv" "glstub_glVertexAttrib3dv"
 external glVertexAttrib3dvARB: int -> float array -> unit = "glstub_glVertexAttrib3dvARB" "glstub_glVertexAttrib3dvARB"
 external glVertexAttrib3dvNV: int -> float array -> unit = "glstub_glVertexAttrib3dvNV" "glstub_glVertexAttrib3dvNV"
-external glVertexAttrib3f: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3f" "glstub_glVertexAttrib3f"
-external glVertexAttrib3fARB: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3fARB" "glstub_glVertexAttrib3fARB"
-external glVertexAttrib3fNV: int -> float -> float -> float -> unit = "glstub_glVertexAttrib3fNV" "glstub_glVertexAttrib3fNV"
+external glVertexAttrib3f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3f" "glstub_glVertexAttrib3f_nat" [@@noalloc]
+external glVertexAttrib3fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3fARB" "glstub_glVertexAttrib3fARB_nat" [@@noalloc]
+external glVertexAttrib3fNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib3fNV" "glstub_glVertexAttrib3fNV_nat" [@@noalloc]
 
 external glVertexAttrib3fv: int -> float_array -> unit = "glstub_glVertexAttrib3fv" "glstub_glVertexAttrib3fv"
 let glVertexAttrib3fv p0 p1 =
@@ -7760,7 +8057,7 @@ let r = glVertexAttrib3fvNV p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glVertexAttrib3hNV: int -> int -> int -> int -> unit = "glstub_glVertexAttrib3hNV" "glstub_glVertexAttrib3hNV"
+external glVertexAttrib3hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib3hNV" "glstub_glVertexAttrib3hNV_nat" [@@noalloc]
 
 external glVertexAttrib3hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib3hvNV" "glstub_glVertexAttrib3hvNV"
 let glVertexAttrib3hvNV p0 p1 =
@@ -7769,9 +8066,9 @@ let r = glVertexAttrib3hvNV p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glVertexAttrib3s: int -> int -> int -> int -> unit = "glstub_glVertexAttrib3s" "glstub_glVertexAttrib3s"
-external glVertexAttrib3sARB: int -> int -> int -> int -> unit = "glstub_glVertexAttrib3sARB" "glstub_glVertexAttrib3sARB"
-external glVertexAttrib3sNV: int -> int -> int -> int -> unit = "glstub_glVertexAttrib3sNV" "glstub_glVertexAttrib3sNV"
+external glVertexAttrib3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib3s" "glstub_glVertexAttrib3s_nat" [@@noalloc]
+external glVertexAttrib3sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib3sARB" "glstub_glVertexAttrib3sARB_nat" [@@noalloc]
+external glVertexAttrib3sNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib3sNV" "glstub_glVertexAttrib3sNV_nat" [@@noalloc]
 
 external glVertexAttrib3sv: int -> short_array -> unit = "glstub_glVertexAttrib3sv" "glstub_glVertexAttrib3sv"
 let glVertexAttrib3sv p0 p1 =
@@ -7840,8 +8137,8 @@ let r = glVertexAttrib4NsvARB p0 np1 in
 let _ = copy_short_array np1 p1 in
 r
 
-external glVertexAttrib4Nub: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4Nub" "glstub_glVertexAttrib4Nub"
-external glVertexAttrib4NubARB: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4NubARB" "glstub_glVertexAttrib4NubARB"
+external glVertexAttrib4Nub: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4Nub" "glstub_glVertexAttrib4Nub_nat" [@@noalloc]
+external glVertexAttrib4NubARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4NubARB" "glstub_glVertexAttrib4NubARB_nat" [@@noalloc]
 
 external glVertexAttrib4Nubv: int -> ubyte_array -> unit = "glstub_glVertexAttrib4Nubv" "glstub_glVertexAttrib4Nubv"
 let glVertexAttrib4Nubv p0 p1 =
@@ -7902,15 +8199,15 @@ let r = glVertexAttrib4bvARB p0 np1 in
 let _ = copy_byte_array np1 p1 in
 r
 
-external glVertexAttrib4d: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4d" "glstub_glVertexAttrib4d"
-external glVertexAttrib4dARB: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4dARB" "glstub_glVertexAttrib4dARB"
-external glVertexAttrib4dNV: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4dNV" "glstub_glVertexAttrib4dNV"
+external glVertexAttrib4d: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4d" "glstub_glVertexAttrib4d_nat" [@@noalloc]
+external glVertexAttrib4dARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4dARB" "glstub_glVertexAttrib4dARB_nat" [@@noalloc]
+external glVertexAttrib4dNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4dNV" "glstub_glVertexAttrib4dNV_nat" [@@noalloc]
 external glVertexAttrib4dv: int -> float array -> unit = "glstub_glVertexAttrib4dv" "glstub_glVertexAttrib4dv"
 external glVertexAttrib4dvARB: int -> float array -> unit = "glstub_glVertexAttrib4dvARB" "glstub_glVertexAttrib4dvARB"
 external glVertexAttrib4dvNV: int -> float array -> unit = "glstub_glVertexAttrib4dvNV" "glstub_glVertexAttrib4dvNV"
-external glVertexAttrib4f: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4f" "glstub_glVertexAttrib4f"
-external glVertexAttrib4fARB: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4fARB" "glstub_glVertexAttrib4fARB"
-external glVertexAttrib4fNV: int -> float -> float -> float -> float -> unit = "glstub_glVertexAttrib4fNV" "glstub_glVertexAttrib4fNV"
+external glVertexAttrib4f: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4f" "glstub_glVertexAttrib4f_nat" [@@noalloc]
+external glVertexAttrib4fARB: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4fARB" "glstub_glVertexAttrib4fARB_nat" [@@noalloc]
+external glVertexAttrib4fNV: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexAttrib4fNV" "glstub_glVertexAttrib4fNV_nat" [@@noalloc]
 
 external glVertexAttrib4fv: int -> float_array -> unit = "glstub_glVertexAttrib4fv" "glstub_glVertexAttrib4fv"
 let glVertexAttrib4fv p0 p1 =
@@ -7934,7 +8231,7 @@ let r = glVertexAttrib4fvNV p0 np1 in
 let _ = copy_float_array np1 p1 in
 r
 
-external glVertexAttrib4hNV: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4hNV" "glstub_glVertexAttrib4hNV"
+external glVertexAttrib4hNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4hNV" "glstub_glVertexAttrib4hNV_nat" [@@noalloc]
 
 external glVertexAttrib4hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib4hvNV" "glstub_glVertexAttrib4hvNV"
 let glVertexAttrib4hvNV p0 p1 =
@@ -7958,9 +8255,9 @@ let r = glVertexAttrib4ivARB p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttrib4s: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4s" "glstub_glVertexAttrib4s"
-external glVertexAttrib4sARB: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4sARB" "glstub_glVertexAttrib4sARB"
-external glVertexAttrib4sNV: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4sNV" "glstub_glVertexAttrib4sNV"
+external glVertexAttrib4s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4s" "glstub_glVertexAttrib4s_nat" [@@noalloc]
+external glVertexAttrib4sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4sARB" "glstub_glVertexAttrib4sARB_nat" [@@noalloc]
+external glVertexAttrib4sNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4sNV" "glstub_glVertexAttrib4sNV_nat" [@@noalloc]
 
 external glVertexAttrib4sv: int -> short_array -> unit = "glstub_glVertexAttrib4sv" "glstub_glVertexAttrib4sv"
 let glVertexAttrib4sv p0 p1 =
@@ -7984,7 +8281,7 @@ let r = glVertexAttrib4svNV p0 np1 in
 let _ = copy_short_array np1 p1 in
 r
 
-external glVertexAttrib4ubNV: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttrib4ubNV" "glstub_glVertexAttrib4ubNV"
+external glVertexAttrib4ubNV: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttrib4ubNV" "glstub_glVertexAttrib4ubNV_nat" [@@noalloc]
 
 external glVertexAttrib4ubv: int -> ubyte_array -> unit = "glstub_glVertexAttrib4ubv" "glstub_glVertexAttrib4ubv"
 let glVertexAttrib4ubv p0 p1 =
@@ -8038,8 +8335,9 @@ let r = glVertexAttrib4usvARB p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glVertexAttribArrayObjectATI: int -> int -> int -> bool -> int -> int -> int -> unit = "glstub_glVertexAttribArrayObjectATI_byte" "glstub_glVertexAttribArrayObjectATI"
-external glVertexAttribI1iEXT: int -> int -> unit = "glstub_glVertexAttribI1iEXT" "glstub_glVertexAttribI1iEXT"
+external glVertexAttribArrayObjectATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribArrayObjectATI_byte" "glstub_glVertexAttribArrayObjectATI_nat" [@@noalloc]
+external glVertexAttribDivisor: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribDivisor" "glstub_glVertexAttribDivisor_nat" [@@noalloc]
+external glVertexAttribI1iEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI1iEXT" "glstub_glVertexAttribI1iEXT_nat" [@@noalloc]
 
 external glVertexAttribI1ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI1ivEXT" "glstub_glVertexAttribI1ivEXT"
 let glVertexAttribI1ivEXT p0 p1 =
@@ -8048,7 +8346,7 @@ let r = glVertexAttribI1ivEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttribI1uiEXT: int -> int -> unit = "glstub_glVertexAttribI1uiEXT" "glstub_glVertexAttribI1uiEXT"
+external glVertexAttribI1uiEXT: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI1uiEXT" "glstub_glVertexAttribI1uiEXT_nat" [@@noalloc]
 
 external glVertexAttribI1uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI1uivEXT" "glstub_glVertexAttribI1uivEXT"
 let glVertexAttribI1uivEXT p0 p1 =
@@ -8057,7 +8355,7 @@ let r = glVertexAttribI1uivEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttribI2iEXT: int -> int -> int -> unit = "glstub_glVertexAttribI2iEXT" "glstub_glVertexAttribI2iEXT"
+external glVertexAttribI2iEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI2iEXT" "glstub_glVertexAttribI2iEXT_nat" [@@noalloc]
 
 external glVertexAttribI2ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI2ivEXT" "glstub_glVertexAttribI2ivEXT"
 let glVertexAttribI2ivEXT p0 p1 =
@@ -8066,7 +8364,7 @@ let r = glVertexAttribI2ivEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttribI2uiEXT: int -> int -> int -> unit = "glstub_glVertexAttribI2uiEXT" "glstub_glVertexAttribI2uiEXT"
+external glVertexAttribI2uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI2uiEXT" "glstub_glVertexAttribI2uiEXT_nat" [@@noalloc]
 
 external glVertexAttribI2uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI2uivEXT" "glstub_glVertexAttribI2uivEXT"
 let glVertexAttribI2uivEXT p0 p1 =
@@ -8075,7 +8373,7 @@ let r = glVertexAttribI2uivEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttribI3iEXT: int -> int -> int -> int -> unit = "glstub_glVertexAttribI3iEXT" "glstub_glVertexAttribI3iEXT"
+external glVertexAttribI3iEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI3iEXT" "glstub_glVertexAttribI3iEXT_nat" [@@noalloc]
 
 external glVertexAttribI3ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI3ivEXT" "glstub_glVertexAttribI3ivEXT"
 let glVertexAttribI3ivEXT p0 p1 =
@@ -8084,7 +8382,7 @@ let r = glVertexAttribI3ivEXT p0 np1 in
 let _ = copy_word_array np1 p1 in
 r
 
-external glVertexAttribI3uiEXT: int -> int -> int -> int -> unit = "glstub_glVertexAttribI3uiEXT" "glstub_glVertexAttribI3uiEXT"
+external glVertexAttribI3uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI3uiEXT" "glstub_glVertexAttribI3uiEXT_nat" [@@noalloc]
 
 external glVertexAttribI3uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI3uivEXT" "glstub_glVertexAttribI3uivEXT"
 let glVertexAttribI3uivEXT p0 p1 =
@@ -8101,7 +8399,7 @@ let r = glVertexAttribI4bvEXT p0 np1 in
 let _ = copy_byte_array np1 p1 in
 r
 
-external glVertexAttribI4iEXT: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttribI4iEXT" "glstub_glVertexAttribI4iEXT"
+external glVertexAttribI4iEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI4iEXT" "glstub_glVertexAttribI4iEXT_nat" [@@noalloc]
 
 external glVertexAttribI4ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI4ivEXT" "glstub_glVertexAttribI4ivEXT"
 let glVertexAttribI4ivEXT p0 p1 =
@@ -8126,7 +8424,7 @@ let r = glVertexAttribI4ubvEXT p0 np1 in
 let _ = copy_ubyte_array np1 p1 in
 r
 
-external glVertexAttribI4uiEXT: int -> int -> int -> int -> int -> unit = "glstub_glVertexAttribI4uiEXT" "glstub_glVertexAttribI4uiEXT"
+external glVertexAttribI4uiEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribI4uiEXT" "glstub_glVertexAttribI4uiEXT_nat" [@@noalloc]
 
 external glVertexAttribI4uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI4uivEXT" "glstub_glVertexAttribI4uivEXT"
 let glVertexAttribI4uivEXT p0 p1 =
@@ -8143,8 +8441,9 @@ let r = glVertexAttribI4usvEXT p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
+external glVertexAttribIPointer: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribIPointer" "glstub_glVertexAttribIPointer_nat" [@@noalloc]
 external glVertexAttribIPointerEXT: int -> int -> int -> int -> 'a -> unit = "glstub_glVertexAttribIPointerEXT" "glstub_glVertexAttribIPointerEXT"
-external glVertexAttribPointer: int -> int -> int -> bool -> int -> int -> unit = "glstub_glVertexAttribPointer_byte" "glstub_glVertexAttribPointer"
+external glVertexAttribPointer: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexAttribPointer_byte" "glstub_glVertexAttribPointer_nat" [@@noalloc]
 external glVertexAttribPointerARB: int -> int -> int -> bool -> int -> 'a -> unit = "glstub_glVertexAttribPointerARB_byte" "glstub_glVertexAttribPointerARB"
 external glVertexAttribPointerNV: int -> int -> int -> int -> 'a -> unit = "glstub_glVertexAttribPointerNV" "glstub_glVertexAttribPointerNV"
 external glVertexAttribs1dvNV: int -> int -> float array -> unit = "glstub_glVertexAttribs1dvNV" "glstub_glVertexAttribs1dvNV"
@@ -8255,16 +8554,16 @@ let r = glVertexAttribs4ubvNV p0 p1 np2 in
 let _ = copy_ubyte_array np2 p2 in
 r
 
-external glVertexBlendARB: int -> unit = "glstub_glVertexBlendARB" "glstub_glVertexBlendARB"
-external glVertexBlendEnvfATI: int -> float -> unit = "glstub_glVertexBlendEnvfATI" "glstub_glVertexBlendEnvfATI"
-external glVertexBlendEnviATI: int -> int -> unit = "glstub_glVertexBlendEnviATI" "glstub_glVertexBlendEnviATI"
+external glVertexBlendARB: (int [@untagged]) -> unit = "glstub_glVertexBlendARB" "glstub_glVertexBlendARB_nat" [@@noalloc]
+external glVertexBlendEnvfATI: (int [@untagged]) -> (float [@unboxed]) -> unit = "glstub_glVertexBlendEnvfATI" "glstub_glVertexBlendEnvfATI_nat" [@@noalloc]
+external glVertexBlendEnviATI: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexBlendEnviATI" "glstub_glVertexBlendEnviATI_nat" [@@noalloc]
 external glVertexPointer: int -> int -> int -> 'a -> unit = "glstub_glVertexPointer" "glstub_glVertexPointer"
 external glVertexPointerEXT: int -> int -> int -> int -> 'a -> unit = "glstub_glVertexPointerEXT" "glstub_glVertexPointerEXT"
 external glVertexPointerListIBM: int -> int -> int -> 'a -> int -> unit = "glstub_glVertexPointerListIBM" "glstub_glVertexPointerListIBM"
 external glVertexPointervINTEL: int -> int -> 'a -> unit = "glstub_glVertexPointervINTEL" "glstub_glVertexPointervINTEL"
-external glVertexStream2dATI: int -> float -> float -> unit = "glstub_glVertexStream2dATI" "glstub_glVertexStream2dATI"
+external glVertexStream2dATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream2dATI" "glstub_glVertexStream2dATI_nat" [@@noalloc]
 external glVertexStream2dvATI: int -> float array -> unit = "glstub_glVertexStream2dvATI" "glstub_glVertexStream2dvATI"
-external glVertexStream2fATI: int -> float -> float -> unit = "glstub_glVertexStream2fATI" "glstub_glVertexStream2fATI"
+external glVertexStream2fATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream2fATI" "glstub_glVertexStream2fATI_nat" [@@noalloc]
 
 external glVertexStream2fvATI: int -> float_array -> unit = "glstub_glVertexStream2fvATI" "glstub_glVertexStream2fvATI"
 let glVertexStream2fvATI p0 p1 =
@@ -8272,7 +8571,7 @@ let np1 = to_float_array p1 in
 let r = glVertexStream2fvATI p0 np1 in
 r
 
-external glVertexStream2iATI: int -> int -> int -> unit = "glstub_glVertexStream2iATI" "glstub_glVertexStream2iATI"
+external glVertexStream2iATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream2iATI" "glstub_glVertexStream2iATI_nat" [@@noalloc]
 
 external glVertexStream2ivATI: int -> word_array -> unit = "glstub_glVertexStream2ivATI" "glstub_glVertexStream2ivATI"
 let glVertexStream2ivATI p0 p1 =
@@ -8280,7 +8579,7 @@ let np1 = to_word_array p1 in
 let r = glVertexStream2ivATI p0 np1 in
 r
 
-external glVertexStream2sATI: int -> int -> int -> unit = "glstub_glVertexStream2sATI" "glstub_glVertexStream2sATI"
+external glVertexStream2sATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream2sATI" "glstub_glVertexStream2sATI_nat" [@@noalloc]
 
 external glVertexStream2svATI: int -> short_array -> unit = "glstub_glVertexStream2svATI" "glstub_glVertexStream2svATI"
 let glVertexStream2svATI p0 p1 =
@@ -8288,9 +8587,9 @@ let np1 = to_short_array p1 in
 let r = glVertexStream2svATI p0 np1 in
 r
 
-external glVertexStream3dATI: int -> float -> float -> float -> unit = "glstub_glVertexStream3dATI" "glstub_glVertexStream3dATI"
+external glVertexStream3dATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream3dATI" "glstub_glVertexStream3dATI_nat" [@@noalloc]
 external glVertexStream3dvATI: int -> float array -> unit = "glstub_glVertexStream3dvATI" "glstub_glVertexStream3dvATI"
-external glVertexStream3fATI: int -> float -> float -> float -> unit = "glstub_glVertexStream3fATI" "glstub_glVertexStream3fATI"
+external glVertexStream3fATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream3fATI" "glstub_glVertexStream3fATI_nat" [@@noalloc]
 
 external glVertexStream3fvATI: int -> float_array -> unit = "glstub_glVertexStream3fvATI" "glstub_glVertexStream3fvATI"
 let glVertexStream3fvATI p0 p1 =
@@ -8298,7 +8597,7 @@ let np1 = to_float_array p1 in
 let r = glVertexStream3fvATI p0 np1 in
 r
 
-external glVertexStream3iATI: int -> int -> int -> int -> unit = "glstub_glVertexStream3iATI" "glstub_glVertexStream3iATI"
+external glVertexStream3iATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream3iATI" "glstub_glVertexStream3iATI_nat" [@@noalloc]
 
 external glVertexStream3ivATI: int -> word_array -> unit = "glstub_glVertexStream3ivATI" "glstub_glVertexStream3ivATI"
 let glVertexStream3ivATI p0 p1 =
@@ -8306,7 +8605,7 @@ let np1 = to_word_array p1 in
 let r = glVertexStream3ivATI p0 np1 in
 r
 
-external glVertexStream3sATI: int -> int -> int -> int -> unit = "glstub_glVertexStream3sATI" "glstub_glVertexStream3sATI"
+external glVertexStream3sATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream3sATI" "glstub_glVertexStream3sATI_nat" [@@noalloc]
 
 external glVertexStream3svATI: int -> short_array -> unit = "glstub_glVertexStream3svATI" "glstub_glVertexStream3svATI"
 let glVertexStream3svATI p0 p1 =
@@ -8314,9 +8613,9 @@ let np1 = to_short_array p1 in
 let r = glVertexStream3svATI p0 np1 in
 r
 
-external glVertexStream4dATI: int -> float -> float -> float -> float -> unit = "glstub_glVertexStream4dATI" "glstub_glVertexStream4dATI"
+external glVertexStream4dATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream4dATI" "glstub_glVertexStream4dATI_nat" [@@noalloc]
 external glVertexStream4dvATI: int -> float array -> unit = "glstub_glVertexStream4dvATI" "glstub_glVertexStream4dvATI"
-external glVertexStream4fATI: int -> float -> float -> float -> float -> unit = "glstub_glVertexStream4fATI" "glstub_glVertexStream4fATI"
+external glVertexStream4fATI: (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glVertexStream4fATI" "glstub_glVertexStream4fATI_nat" [@@noalloc]
 
 external glVertexStream4fvATI: int -> float_array -> unit = "glstub_glVertexStream4fvATI" "glstub_glVertexStream4fvATI"
 let glVertexStream4fvATI p0 p1 =
@@ -8324,7 +8623,7 @@ let np1 = to_float_array p1 in
 let r = glVertexStream4fvATI p0 np1 in
 r
 
-external glVertexStream4iATI: int -> int -> int -> int -> int -> unit = "glstub_glVertexStream4iATI" "glstub_glVertexStream4iATI"
+external glVertexStream4iATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream4iATI" "glstub_glVertexStream4iATI_nat" [@@noalloc]
 
 external glVertexStream4ivATI: int -> word_array -> unit = "glstub_glVertexStream4ivATI" "glstub_glVertexStream4ivATI"
 let glVertexStream4ivATI p0 p1 =
@@ -8332,7 +8631,7 @@ let np1 = to_word_array p1 in
 let r = glVertexStream4ivATI p0 np1 in
 r
 
-external glVertexStream4sATI: int -> int -> int -> int -> int -> unit = "glstub_glVertexStream4sATI" "glstub_glVertexStream4sATI"
+external glVertexStream4sATI: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glVertexStream4sATI" "glstub_glVertexStream4sATI_nat" [@@noalloc]
 
 external glVertexStream4svATI: int -> short_array -> unit = "glstub_glVertexStream4svATI" "glstub_glVertexStream4svATI"
 let glVertexStream4svATI p0 p1 =
@@ -8341,7 +8640,7 @@ let r = glVertexStream4svATI p0 np1 in
 r
 
 external glVertexWeightPointerEXT: int -> int -> int -> 'a -> unit = "glstub_glVertexWeightPointerEXT" "glstub_glVertexWeightPointerEXT"
-external glVertexWeightfEXT: float -> unit = "glstub_glVertexWeightfEXT" "glstub_glVertexWeightfEXT"
+external glVertexWeightfEXT: (float [@unboxed]) -> unit = "glstub_glVertexWeightfEXT" "glstub_glVertexWeightfEXT_nat" [@@noalloc]
 
 external glVertexWeightfvEXT: float_array -> unit = "glstub_glVertexWeightfvEXT" "glstub_glVertexWeightfvEXT"
 let glVertexWeightfvEXT p0 =
@@ -8350,7 +8649,7 @@ let r = glVertexWeightfvEXT np0 in
 let _ = copy_float_array np0 p0 in
 r
 
-external glVertexWeighthNV: int -> unit = "glstub_glVertexWeighthNV" "glstub_glVertexWeighthNV"
+external glVertexWeighthNV: (int [@untagged]) -> unit = "glstub_glVertexWeighthNV" "glstub_glVertexWeighthNV_nat" [@@noalloc]
 
 external glVertexWeighthvNV: ushort_array -> unit = "glstub_glVertexWeighthvNV" "glstub_glVertexWeighthvNV"
 let glVertexWeighthvNV p0 =
@@ -8359,7 +8658,8 @@ let r = glVertexWeighthvNV np0 in
 let _ = copy_ushort_array np0 p0 in
 r
 
-external glViewport: int -> int -> int -> int -> unit = "glstub_glViewport" "glstub_glViewport"
+external glViewport: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glViewport" "glstub_glViewport_nat" [@@noalloc]
+external glWaitSync: sync -> int -> int -> unit = "glstub_glWaitSync" "glstub_glWaitSync"
 external glWeightPointerARB: int -> int -> int -> 'a -> unit = "glstub_glWeightPointerARB" "glstub_glWeightPointerARB"
 
 external glWeightbvARB: int -> byte_array -> unit = "glstub_glWeightbvARB" "glstub_glWeightbvARB"
@@ -8418,15 +8718,15 @@ let r = glWeightusvARB p0 np1 in
 let _ = copy_ushort_array np1 p1 in
 r
 
-external glWindowPos2d: float -> float -> unit = "glstub_glWindowPos2d" "glstub_glWindowPos2d"
-external glWindowPos2dARB: float -> float -> unit = "glstub_glWindowPos2dARB" "glstub_glWindowPos2dARB"
-external glWindowPos2dMESA: float -> float -> unit = "glstub_glWindowPos2dMESA" "glstub_glWindowPos2dMESA"
+external glWindowPos2d: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2d" "glstub_glWindowPos2d_nat" [@@noalloc]
+external glWindowPos2dARB: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2dARB" "glstub_glWindowPos2dARB_nat" [@@noalloc]
+external glWindowPos2dMESA: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2dMESA" "glstub_glWindowPos2dMESA_nat" [@@noalloc]
 external glWindowPos2dv: float array -> unit = "glstub_glWindowPos2dv" "glstub_glWindowPos2dv"
 external glWindowPos2dvARB: float array -> unit = "glstub_glWindowPos2dvARB" "glstub_glWindowPos2dvARB"
 external glWindowPos2dvMESA: float array -> unit = "glstub_glWindowPos2dvMESA" "glstub_glWindowPos2dvMESA"
-external glWindowPos2f: float -> float -> unit = "glstub_glWindowPos2f" "glstub_glWindowPos2f"
-external glWindowPos2fARB: float -> float -> unit = "glstub_glWindowPos2fARB" "glstub_glWindowPos2fARB"
-external glWindowPos2fMESA: float -> float -> unit = "glstub_glWindowPos2fMESA" "glstub_glWindowPos2fMESA"
+external glWindowPos2f: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2f" "glstub_glWindowPos2f_nat" [@@noalloc]
+external glWindowPos2fARB: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2fARB" "glstub_glWindowPos2fARB_nat" [@@noalloc]
+external glWindowPos2fMESA: (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos2fMESA" "glstub_glWindowPos2fMESA_nat" [@@noalloc]
 
 external glWindowPos2fv: float_array -> unit = "glstub_glWindowPos2fv" "glstub_glWindowPos2fv"
 let glWindowPos2fv p0 =
@@ -8450,9 +8750,9 @@ let r = glWindowPos2fvMESA np0 in
 let _ = copy_float_array np0 p0 in
 r
 
-external glWindowPos2i: int -> int -> unit = "glstub_glWindowPos2i" "glstub_glWindowPos2i"
-external glWindowPos2iARB: int -> int -> unit = "glstub_glWindowPos2iARB" "glstub_glWindowPos2iARB"
-external glWindowPos2iMESA: int -> int -> unit = "glstub_glWindowPos2iMESA" "glstub_glWindowPos2iMESA"
+external glWindowPos2i: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2i" "glstub_glWindowPos2i_nat" [@@noalloc]
+external glWindowPos2iARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2iARB" "glstub_glWindowPos2iARB_nat" [@@noalloc]
+external glWindowPos2iMESA: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2iMESA" "glstub_glWindowPos2iMESA_nat" [@@noalloc]
 
 external glWindowPos2iv: word_array -> unit = "glstub_glWindowPos2iv" "glstub_glWindowPos2iv"
 let glWindowPos2iv p0 =
@@ -8476,9 +8776,9 @@ let r = glWindowPos2ivMESA np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glWindowPos2s: int -> int -> unit = "glstub_glWindowPos2s" "glstub_glWindowPos2s"
-external glWindowPos2sARB: int -> int -> unit = "glstub_glWindowPos2sARB" "glstub_glWindowPos2sARB"
-external glWindowPos2sMESA: int -> int -> unit = "glstub_glWindowPos2sMESA" "glstub_glWindowPos2sMESA"
+external glWindowPos2s: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2s" "glstub_glWindowPos2s_nat" [@@noalloc]
+external glWindowPos2sARB: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2sARB" "glstub_glWindowPos2sARB_nat" [@@noalloc]
+external glWindowPos2sMESA: (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos2sMESA" "glstub_glWindowPos2sMESA_nat" [@@noalloc]
 
 external glWindowPos2sv: short_array -> unit = "glstub_glWindowPos2sv" "glstub_glWindowPos2sv"
 let glWindowPos2sv p0 =
@@ -8502,15 +8802,15 @@ let r = glWindowPos2svMESA np0 in
 let _ = copy_short_array np0 p0 in
 r
 
-external glWindowPos3d: float -> float -> float -> unit = "glstub_glWindowPos3d" "glstub_glWindowPos3d"
-external glWindowPos3dARB: float -> float -> float -> unit = "glstub_glWindowPos3dARB" "glstub_glWindowPos3dARB"
-external glWindowPos3dMESA: float -> float -> float -> unit = "glstub_glWindowPos3dMESA" "glstub_glWindowPos3dMESA"
+external glWindowPos3d: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3d" "glstub_glWindowPos3d_nat" [@@noalloc]
+external glWindowPos3dARB: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3dARB" "glstub_glWindowPos3dARB_nat" [@@noalloc]
+external glWindowPos3dMESA: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3dMESA" "glstub_glWindowPos3dMESA_nat" [@@noalloc]
 external glWindowPos3dv: float array -> unit = "glstub_glWindowPos3dv" "glstub_glWindowPos3dv"
 external glWindowPos3dvARB: float array -> unit = "glstub_glWindowPos3dvARB" "glstub_glWindowPos3dvARB"
 external glWindowPos3dvMESA: float array -> unit = "glstub_glWindowPos3dvMESA" "glstub_glWindowPos3dvMESA"
-external glWindowPos3f: float -> float -> float -> unit = "glstub_glWindowPos3f" "glstub_glWindowPos3f"
-external glWindowPos3fARB: float -> float -> float -> unit = "glstub_glWindowPos3fARB" "glstub_glWindowPos3fARB"
-external glWindowPos3fMESA: float -> float -> float -> unit = "glstub_glWindowPos3fMESA" "glstub_glWindowPos3fMESA"
+external glWindowPos3f: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3f" "glstub_glWindowPos3f_nat" [@@noalloc]
+external glWindowPos3fARB: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3fARB" "glstub_glWindowPos3fARB_nat" [@@noalloc]
+external glWindowPos3fMESA: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos3fMESA" "glstub_glWindowPos3fMESA_nat" [@@noalloc]
 
 external glWindowPos3fv: float_array -> unit = "glstub_glWindowPos3fv" "glstub_glWindowPos3fv"
 let glWindowPos3fv p0 =
@@ -8534,9 +8834,9 @@ let r = glWindowPos3fvMESA np0 in
 let _ = copy_float_array np0 p0 in
 r
 
-external glWindowPos3i: int -> int -> int -> unit = "glstub_glWindowPos3i" "glstub_glWindowPos3i"
-external glWindowPos3iARB: int -> int -> int -> unit = "glstub_glWindowPos3iARB" "glstub_glWindowPos3iARB"
-external glWindowPos3iMESA: int -> int -> int -> unit = "glstub_glWindowPos3iMESA" "glstub_glWindowPos3iMESA"
+external glWindowPos3i: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3i" "glstub_glWindowPos3i_nat" [@@noalloc]
+external glWindowPos3iARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3iARB" "glstub_glWindowPos3iARB_nat" [@@noalloc]
+external glWindowPos3iMESA: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3iMESA" "glstub_glWindowPos3iMESA_nat" [@@noalloc]
 
 external glWindowPos3iv: word_array -> unit = "glstub_glWindowPos3iv" "glstub_glWindowPos3iv"
 let glWindowPos3iv p0 =
@@ -8560,9 +8860,9 @@ let r = glWindowPos3ivMESA np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glWindowPos3s: int -> int -> int -> unit = "glstub_glWindowPos3s" "glstub_glWindowPos3s"
-external glWindowPos3sARB: int -> int -> int -> unit = "glstub_glWindowPos3sARB" "glstub_glWindowPos3sARB"
-external glWindowPos3sMESA: int -> int -> int -> unit = "glstub_glWindowPos3sMESA" "glstub_glWindowPos3sMESA"
+external glWindowPos3s: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3s" "glstub_glWindowPos3s_nat" [@@noalloc]
+external glWindowPos3sARB: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3sARB" "glstub_glWindowPos3sARB_nat" [@@noalloc]
+external glWindowPos3sMESA: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos3sMESA" "glstub_glWindowPos3sMESA_nat" [@@noalloc]
 
 external glWindowPos3sv: short_array -> unit = "glstub_glWindowPos3sv" "glstub_glWindowPos3sv"
 let glWindowPos3sv p0 =
@@ -8586,9 +8886,9 @@ let r = glWindowPos3svMESA np0 in
 let _ = copy_short_array np0 p0 in
 r
 
-external glWindowPos4dMESA: float -> float -> float -> float -> unit = "glstub_glWindowPos4dMESA" "glstub_glWindowPos4dMESA"
+external glWindowPos4dMESA: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos4dMESA" "glstub_glWindowPos4dMESA_nat" [@@noalloc]
 external glWindowPos4dvMESA: float array -> unit = "glstub_glWindowPos4dvMESA" "glstub_glWindowPos4dvMESA"
-external glWindowPos4fMESA: float -> float -> float -> float -> unit = "glstub_glWindowPos4fMESA" "glstub_glWindowPos4fMESA"
+external glWindowPos4fMESA: (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_glWindowPos4fMESA" "glstub_glWindowPos4fMESA_nat" [@@noalloc]
 
 external glWindowPos4fvMESA: float_array -> unit = "glstub_glWindowPos4fvMESA" "glstub_glWindowPos4fvMESA"
 let glWindowPos4fvMESA p0 =
@@ -8597,7 +8897,7 @@ let r = glWindowPos4fvMESA np0 in
 let _ = copy_float_array np0 p0 in
 r
 
-external glWindowPos4iMESA: int -> int -> int -> int -> unit = "glstub_glWindowPos4iMESA" "glstub_glWindowPos4iMESA"
+external glWindowPos4iMESA: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos4iMESA" "glstub_glWindowPos4iMESA_nat" [@@noalloc]
 
 external glWindowPos4ivMESA: word_array -> unit = "glstub_glWindowPos4ivMESA" "glstub_glWindowPos4ivMESA"
 let glWindowPos4ivMESA p0 =
@@ -8606,7 +8906,7 @@ let r = glWindowPos4ivMESA np0 in
 let _ = copy_word_array np0 p0 in
 r
 
-external glWindowPos4sMESA: int -> int -> int -> int -> unit = "glstub_glWindowPos4sMESA" "glstub_glWindowPos4sMESA"
+external glWindowPos4sMESA: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWindowPos4sMESA" "glstub_glWindowPos4sMESA_nat" [@@noalloc]
 
 external glWindowPos4svMESA: short_array -> unit = "glstub_glWindowPos4svMESA" "glstub_glWindowPos4svMESA"
 let glWindowPos4svMESA p0 =
@@ -8615,5 +8915,8742 @@ let r = glWindowPos4svMESA np0 in
 let _ = copy_short_array np0 p0 in
 r
 
-external glWriteMaskEXT: int -> int -> int -> int -> int -> int -> unit = "glstub_glWriteMaskEXT_byte" "glstub_glWriteMaskEXT"
-external glewInit: unit -> int = "glstub_glewInit" "glstub_glewInit"
+external glWriteMaskEXT: (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit = "glstub_glWriteMaskEXT_byte" "glstub_glWriteMaskEXT_nat" [@@noalloc]
+
+module Direct = struct
+external glAreProgramsResidentNV: int -> word_array -> word_array -> bool = "glstub_glAreProgramsResidentNV" "glstub_glAreProgramsResidentNV"
+external glAreTexturesResident: int -> word_array -> word_array -> bool = "glstub_glAreTexturesResident" "glstub_glAreTexturesResident"
+external glAreTexturesResidentEXT: int -> word_array -> word_array -> bool = "glstub_glAreTexturesResidentEXT" "glstub_glAreTexturesResidentEXT"
+external glBitmap: int -> int -> float -> float -> float -> float -> ubyte_array -> unit = "glstub_glBitmap_byte" "glstub_glBitmap"
+external glClearBufferfv: int -> int -> float_array -> unit = "glstub_glClearBufferfv" "glstub_glClearBufferfv"
+external glClearBufferiv: int -> int -> word_array -> unit = "glstub_glClearBufferiv" "glstub_glClearBufferiv"
+external glClipPlanefOES: int -> float_array -> unit = "glstub_glClipPlanefOES" "glstub_glClipPlanefOES"
+external glColor3bv: byte_array -> unit = "glstub_glColor3bv" "glstub_glColor3bv"
+external glColor3fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glColor3fVertex3fvSUN" "glstub_glColor3fVertex3fvSUN"
+external glColor3fv: float_array -> unit = "glstub_glColor3fv" "glstub_glColor3fv"
+external glColor3hvNV: ushort_array -> unit = "glstub_glColor3hvNV" "glstub_glColor3hvNV"
+external glColor3iv: word_array -> unit = "glstub_glColor3iv" "glstub_glColor3iv"
+external glColor3sv: short_array -> unit = "glstub_glColor3sv" "glstub_glColor3sv"
+external glColor3ubv: ubyte_array -> unit = "glstub_glColor3ubv" "glstub_glColor3ubv"
+external glColor3uiv: word_array -> unit = "glstub_glColor3uiv" "glstub_glColor3uiv"
+external glColor3usv: ushort_array -> unit = "glstub_glColor3usv" "glstub_glColor3usv"
+external glColor4bv: byte_array -> unit = "glstub_glColor4bv" "glstub_glColor4bv"
+external glColor4fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glColor4fNormal3fVertex3fvSUN" "glstub_glColor4fNormal3fVertex3fvSUN"
+external glColor4fv: float_array -> unit = "glstub_glColor4fv" "glstub_glColor4fv"
+external glColor4hvNV: ushort_array -> unit = "glstub_glColor4hvNV" "glstub_glColor4hvNV"
+external glColor4iv: word_array -> unit = "glstub_glColor4iv" "glstub_glColor4iv"
+external glColor4sv: short_array -> unit = "glstub_glColor4sv" "glstub_glColor4sv"
+external glColor4ubVertex2fvSUN: ubyte_array -> float_array -> unit = "glstub_glColor4ubVertex2fvSUN" "glstub_glColor4ubVertex2fvSUN"
+external glColor4ubVertex3fvSUN: ubyte_array -> float_array -> unit = "glstub_glColor4ubVertex3fvSUN" "glstub_glColor4ubVertex3fvSUN"
+external glColor4ubv: ubyte_array -> unit = "glstub_glColor4ubv" "glstub_glColor4ubv"
+external glColor4uiv: word_array -> unit = "glstub_glColor4uiv" "glstub_glColor4uiv"
+external glColor4usv: ushort_array -> unit = "glstub_glColor4usv" "glstub_glColor4usv"
+external glColorTableParameterfv: int -> int -> float_array -> unit = "glstub_glColorTableParameterfv" "glstub_glColorTableParameterfv"
+external glColorTableParameterfvSGI: int -> int -> float_array -> unit = "glstub_glColorTableParameterfvSGI" "glstub_glColorTableParameterfvSGI"
+external glColorTableParameteriv: int -> int -> word_array -> unit = "glstub_glColorTableParameteriv" "glstub_glColorTableParameteriv"
+external glColorTableParameterivSGI: int -> int -> word_array -> unit = "glstub_glColorTableParameterivSGI" "glstub_glColorTableParameterivSGI"
+external glCombinerParameterfvNV: int -> float_array -> unit = "glstub_glCombinerParameterfvNV" "glstub_glCombinerParameterfvNV"
+external glCombinerParameterivNV: int -> word_array -> unit = "glstub_glCombinerParameterivNV" "glstub_glCombinerParameterivNV"
+external glCombinerStageParameterfvNV: int -> int -> float_array -> unit = "glstub_glCombinerStageParameterfvNV" "glstub_glCombinerStageParameterfvNV"
+external glConvolutionParameterfv: int -> int -> float_array -> unit = "glstub_glConvolutionParameterfv" "glstub_glConvolutionParameterfv"
+external glConvolutionParameterfvEXT: int -> int -> float_array -> unit = "glstub_glConvolutionParameterfvEXT" "glstub_glConvolutionParameterfvEXT"
+external glConvolutionParameteriv: int -> int -> word_array -> unit = "glstub_glConvolutionParameteriv" "glstub_glConvolutionParameteriv"
+external glConvolutionParameterivEXT: int -> int -> word_array -> unit = "glstub_glConvolutionParameterivEXT" "glstub_glConvolutionParameterivEXT"
+external glCullParameterfvEXT: int -> float_array -> unit = "glstub_glCullParameterfvEXT" "glstub_glCullParameterfvEXT"
+external glDeleteBuffers: int -> word_array -> unit = "glstub_glDeleteBuffers" "glstub_glDeleteBuffers"
+external glDeleteBuffersARB: int -> word_array -> unit = "glstub_glDeleteBuffersARB" "glstub_glDeleteBuffersARB"
+external glDeleteFencesAPPLE: int -> word_array -> unit = "glstub_glDeleteFencesAPPLE" "glstub_glDeleteFencesAPPLE"
+external glDeleteFencesNV: int -> word_array -> unit = "glstub_glDeleteFencesNV" "glstub_glDeleteFencesNV"
+external glDeleteFramebuffers: int -> word_array -> unit = "glstub_glDeleteFramebuffers" "glstub_glDeleteFramebuffers"
+external glDeleteFramebuffersEXT: int -> word_array -> unit = "glstub_glDeleteFramebuffersEXT" "glstub_glDeleteFramebuffersEXT"
+external glDeleteOcclusionQueriesNV: int -> word_array -> unit = "glstub_glDeleteOcclusionQueriesNV" "glstub_glDeleteOcclusionQueriesNV"
+external glDeleteProgramsARB: int -> word_array -> unit = "glstub_glDeleteProgramsARB" "glstub_glDeleteProgramsARB"
+external glDeleteProgramsNV: int -> word_array -> unit = "glstub_glDeleteProgramsNV" "glstub_glDeleteProgramsNV"
+external glDeleteQueries: int -> word_array -> unit = "glstub_glDeleteQueries" "glstub_glDeleteQueries"
+external glDeleteQueriesARB: int -> word_array -> unit = "glstub_glDeleteQueriesARB" "glstub_glDeleteQueriesARB"
+external glDeleteRenderbuffers: int -> word_array -> unit = "glstub_glDeleteRenderbuffers" "glstub_glDeleteRenderbuffers"
+external glDeleteRenderbuffersEXT: int -> word_array -> unit = "glstub_glDeleteRenderbuffersEXT" "glstub_glDeleteRenderbuffersEXT"
+external glDeleteSamplers: int -> word_array -> unit = "glstub_glDeleteSamplers" "glstub_glDeleteSamplers"
+external glDeleteTextures: int -> word_array -> unit = "glstub_glDeleteTextures" "glstub_glDeleteTextures"
+external glDeleteTexturesEXT: int -> word_array -> unit = "glstub_glDeleteTexturesEXT" "glstub_glDeleteTexturesEXT"
+external glDeleteVertexArrays: int -> word_array -> unit = "glstub_glDeleteVertexArrays" "glstub_glDeleteVertexArrays"
+external glDeleteVertexArraysAPPLE: int -> word_array -> unit = "glstub_glDeleteVertexArraysAPPLE" "glstub_glDeleteVertexArraysAPPLE"
+external glDetailTexFuncSGIS: int -> int -> float_array -> unit = "glstub_glDetailTexFuncSGIS" "glstub_glDetailTexFuncSGIS"
+external glDrawBuffers: int -> word_array -> unit = "glstub_glDrawBuffers" "glstub_glDrawBuffers"
+external glDrawBuffersARB: int -> word_array -> unit = "glstub_glDrawBuffersARB" "glstub_glDrawBuffersARB"
+external glDrawBuffersATI: int -> word_array -> unit = "glstub_glDrawBuffersATI" "glstub_glDrawBuffersATI"
+external glEdgeFlagPointerEXT: int -> int -> word_array -> unit = "glstub_glEdgeFlagPointerEXT" "glstub_glEdgeFlagPointerEXT"
+external glEdgeFlagv: word_array -> unit = "glstub_glEdgeFlagv" "glstub_glEdgeFlagv"
+external glEvalCoord1fv: float_array -> unit = "glstub_glEvalCoord1fv" "glstub_glEvalCoord1fv"
+external glEvalCoord2fv: float_array -> unit = "glstub_glEvalCoord2fv" "glstub_glEvalCoord2fv"
+external glExecuteProgramNV: int -> int -> float_array -> unit = "glstub_glExecuteProgramNV" "glstub_glExecuteProgramNV"
+external glFeedbackBuffer: int -> int -> float_array -> unit = "glstub_glFeedbackBuffer" "glstub_glFeedbackBuffer"
+external glFinishAsyncSGIX: word_array -> int = "glstub_glFinishAsyncSGIX" "glstub_glFinishAsyncSGIX"
+external glFogCoordfv: float_array -> unit = "glstub_glFogCoordfv" "glstub_glFogCoordfv"
+external glFogCoordfvEXT: float_array -> unit = "glstub_glFogCoordfvEXT" "glstub_glFogCoordfvEXT"
+external glFogCoordhvNV: ushort_array -> unit = "glstub_glFogCoordhvNV" "glstub_glFogCoordhvNV"
+external glFogFuncSGIS: int -> float_array -> unit = "glstub_glFogFuncSGIS" "glstub_glFogFuncSGIS"
+external glFogfv: int -> float_array -> unit = "glstub_glFogfv" "glstub_glFogfv"
+external glFogiv: int -> word_array -> unit = "glstub_glFogiv" "glstub_glFogiv"
+external glFragmentLightModelfvEXT: int -> float_array -> unit = "glstub_glFragmentLightModelfvEXT" "glstub_glFragmentLightModelfvEXT"
+external glFragmentLightModelfvSGIX: int -> float_array -> unit = "glstub_glFragmentLightModelfvSGIX" "glstub_glFragmentLightModelfvSGIX"
+external glFragmentLightModelivEXT: int -> word_array -> unit = "glstub_glFragmentLightModelivEXT" "glstub_glFragmentLightModelivEXT"
+external glFragmentLightModelivSGIX: int -> word_array -> unit = "glstub_glFragmentLightModelivSGIX" "glstub_glFragmentLightModelivSGIX"
+external glFragmentLightfvEXT: int -> int -> float_array -> unit = "glstub_glFragmentLightfvEXT" "glstub_glFragmentLightfvEXT"
+external glFragmentLightfvSGIX: int -> int -> float_array -> unit = "glstub_glFragmentLightfvSGIX" "glstub_glFragmentLightfvSGIX"
+external glFragmentLightivEXT: int -> int -> word_array -> unit = "glstub_glFragmentLightivEXT" "glstub_glFragmentLightivEXT"
+external glFragmentLightivSGIX: int -> int -> word_array -> unit = "glstub_glFragmentLightivSGIX" "glstub_glFragmentLightivSGIX"
+external glFragmentMaterialfvEXT: int -> int -> float_array -> unit = "glstub_glFragmentMaterialfvEXT" "glstub_glFragmentMaterialfvEXT"
+external glFragmentMaterialfvSGIX: int -> int -> float_array -> unit = "glstub_glFragmentMaterialfvSGIX" "glstub_glFragmentMaterialfvSGIX"
+external glFragmentMaterialivEXT: int -> int -> word_array -> unit = "glstub_glFragmentMaterialivEXT" "glstub_glFragmentMaterialivEXT"
+external glFragmentMaterialivSGIX: int -> int -> word_array -> unit = "glstub_glFragmentMaterialivSGIX" "glstub_glFragmentMaterialivSGIX"
+external glGenBuffers: int -> word_array -> unit = "glstub_glGenBuffers" "glstub_glGenBuffers"
+external glGenBuffersARB: int -> word_array -> unit = "glstub_glGenBuffersARB" "glstub_glGenBuffersARB"
+external glGenFencesAPPLE: int -> word_array -> unit = "glstub_glGenFencesAPPLE" "glstub_glGenFencesAPPLE"
+external glGenFencesNV: int -> word_array -> unit = "glstub_glGenFencesNV" "glstub_glGenFencesNV"
+external glGenFramebuffers: int -> word_array -> unit = "glstub_glGenFramebuffers" "glstub_glGenFramebuffers"
+external glGenFramebuffersEXT: int -> word_array -> unit = "glstub_glGenFramebuffersEXT" "glstub_glGenFramebuffersEXT"
+external glGenOcclusionQueriesNV: int -> word_array -> unit = "glstub_glGenOcclusionQueriesNV" "glstub_glGenOcclusionQueriesNV"
+external glGenProgramsARB: int -> word_array -> unit = "glstub_glGenProgramsARB" "glstub_glGenProgramsARB"
+external glGenProgramsNV: int -> word_array -> unit = "glstub_glGenProgramsNV" "glstub_glGenProgramsNV"
+external glGenQueries: int -> word_array -> unit = "glstub_glGenQueries" "glstub_glGenQueries"
+external glGenQueriesARB: int -> word_array -> unit = "glstub_glGenQueriesARB" "glstub_glGenQueriesARB"
+external glGenRenderbuffers: int -> word_array -> unit = "glstub_glGenRenderbuffers" "glstub_glGenRenderbuffers"
+external glGenRenderbuffersEXT: int -> word_array -> unit = "glstub_glGenRenderbuffersEXT" "glstub_glGenRenderbuffersEXT"
+external glGenSamplers: int -> word_array -> unit = "glstub_glGenSamplers" "glstub_glGenSamplers"
+external glGenTextures: int -> word_array -> unit = "glstub_glGenTextures" "glstub_glGenTextures"
+external glGenTexturesEXT: int -> word_array -> unit = "glstub_glGenTexturesEXT" "glstub_glGenTexturesEXT"
+external glGenVertexArrays: int -> word_array -> unit = "glstub_glGenVertexArrays" "glstub_glGenVertexArrays"
+external glGenVertexArraysAPPLE: int -> word_array -> unit = "glstub_glGenVertexArraysAPPLE" "glstub_glGenVertexArraysAPPLE"
+external glGetActiveAttrib: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveAttrib_byte" "glstub_glGetActiveAttrib"
+external glGetActiveAttribARB: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveAttribARB_byte" "glstub_glGetActiveAttribARB"
+external glGetActiveUniform: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveUniform_byte" "glstub_glGetActiveUniform"
+external glGetActiveUniformARB: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveUniformARB_byte" "glstub_glGetActiveUniformARB"
+external glGetActiveVaryingNV: int -> int -> int -> word_array -> word_array -> word_array -> string -> unit = "glstub_glGetActiveVaryingNV_byte" "glstub_glGetActiveVaryingNV"
+external glGetArrayObjectfvATI: int -> int -> float_array -> unit = "glstub_glGetArrayObjectfvATI" "glstub_glGetArrayObjectfvATI"
+external glGetArrayObjectivATI: int -> int -> word_array -> unit = "glstub_glGetArrayObjectivATI" "glstub_glGetArrayObjectivATI"
+external glGetAttachedObjectsARB: int -> int -> word_array -> word_array -> unit = "glstub_glGetAttachedObjectsARB" "glstub_glGetAttachedObjectsARB"
+external glGetAttachedShaders: int -> int -> word_array -> word_array -> unit = "glstub_glGetAttachedShaders" "glstub_glGetAttachedShaders"
+external glGetBooleanIndexedvEXT: int -> int -> word_array -> unit = "glstub_glGetBooleanIndexedvEXT" "glstub_glGetBooleanIndexedvEXT"
+external glGetBooleanv: int -> word_array -> unit = "glstub_glGetBooleanv" "glstub_glGetBooleanv"
+external glGetBufferParameteriv: int -> int -> word_array -> unit = "glstub_glGetBufferParameteriv" "glstub_glGetBufferParameteriv"
+external glGetBufferParameterivARB: int -> int -> word_array -> unit = "glstub_glGetBufferParameterivARB" "glstub_glGetBufferParameterivARB"
+external glGetClipPlanefOES: int -> float_array -> unit = "glstub_glGetClipPlanefOES" "glstub_glGetClipPlanefOES"
+external glGetColorTableParameterfv: int -> int -> float_array -> unit = "glstub_glGetColorTableParameterfv" "glstub_glGetColorTableParameterfv"
+external glGetColorTableParameterfvEXT: int -> int -> float_array -> unit = "glstub_glGetColorTableParameterfvEXT" "glstub_glGetColorTableParameterfvEXT"
+external glGetColorTableParameterfvSGI: int -> int -> float_array -> unit = "glstub_glGetColorTableParameterfvSGI" "glstub_glGetColorTableParameterfvSGI"
+external glGetColorTableParameteriv: int -> int -> word_array -> unit = "glstub_glGetColorTableParameteriv" "glstub_glGetColorTableParameteriv"
+external glGetColorTableParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetColorTableParameterivEXT" "glstub_glGetColorTableParameterivEXT"
+external glGetColorTableParameterivSGI: int -> int -> word_array -> unit = "glstub_glGetColorTableParameterivSGI" "glstub_glGetColorTableParameterivSGI"
+external glGetCombinerInputParameterfvNV: int -> int -> int -> int -> float_array -> unit = "glstub_glGetCombinerInputParameterfvNV" "glstub_glGetCombinerInputParameterfvNV"
+external glGetCombinerInputParameterivNV: int -> int -> int -> int -> word_array -> unit = "glstub_glGetCombinerInputParameterivNV" "glstub_glGetCombinerInputParameterivNV"
+external glGetCombinerOutputParameterfvNV: int -> int -> int -> float_array -> unit = "glstub_glGetCombinerOutputParameterfvNV" "glstub_glGetCombinerOutputParameterfvNV"
+external glGetCombinerOutputParameterivNV: int -> int -> int -> word_array -> unit = "glstub_glGetCombinerOutputParameterivNV" "glstub_glGetCombinerOutputParameterivNV"
+external glGetCombinerStageParameterfvNV: int -> int -> float_array -> unit = "glstub_glGetCombinerStageParameterfvNV" "glstub_glGetCombinerStageParameterfvNV"
+external glGetConvolutionParameterfv: int -> int -> float_array -> unit = "glstub_glGetConvolutionParameterfv" "glstub_glGetConvolutionParameterfv"
+external glGetConvolutionParameterfvEXT: int -> int -> float_array -> unit = "glstub_glGetConvolutionParameterfvEXT" "glstub_glGetConvolutionParameterfvEXT"
+external glGetConvolutionParameteriv: int -> int -> word_array -> unit = "glstub_glGetConvolutionParameteriv" "glstub_glGetConvolutionParameteriv"
+external glGetConvolutionParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetConvolutionParameterivEXT" "glstub_glGetConvolutionParameterivEXT"
+external glGetDetailTexFuncSGIS: int -> float_array -> unit = "glstub_glGetDetailTexFuncSGIS" "glstub_glGetDetailTexFuncSGIS"
+external glGetFenceivNV: int -> int -> word_array -> unit = "glstub_glGetFenceivNV" "glstub_glGetFenceivNV"
+external glGetFinalCombinerInputParameterfvNV: int -> int -> float_array -> unit = "glstub_glGetFinalCombinerInputParameterfvNV" "glstub_glGetFinalCombinerInputParameterfvNV"
+external glGetFinalCombinerInputParameterivNV: int -> int -> word_array -> unit = "glstub_glGetFinalCombinerInputParameterivNV" "glstub_glGetFinalCombinerInputParameterivNV"
+external glGetFloatv: int -> float_array -> unit = "glstub_glGetFloatv" "glstub_glGetFloatv"
+external glGetFogFuncSGIS: float_array -> unit = "glstub_glGetFogFuncSGIS" "glstub_glGetFogFuncSGIS"
+external glGetFragmentLightfvEXT: int -> int -> float_array -> unit = "glstub_glGetFragmentLightfvEXT" "glstub_glGetFragmentLightfvEXT"
+external glGetFragmentLightfvSGIX: int -> int -> float_array -> unit = "glstub_glGetFragmentLightfvSGIX" "glstub_glGetFragmentLightfvSGIX"
+external glGetFragmentLightivEXT: int -> int -> word_array -> unit = "glstub_glGetFragmentLightivEXT" "glstub_glGetFragmentLightivEXT"
+external glGetFragmentLightivSGIX: int -> int -> word_array -> unit = "glstub_glGetFragmentLightivSGIX" "glstub_glGetFragmentLightivSGIX"
+external glGetFragmentMaterialfvEXT: int -> int -> float_array -> unit = "glstub_glGetFragmentMaterialfvEXT" "glstub_glGetFragmentMaterialfvEXT"
+external glGetFragmentMaterialfvSGIX: int -> int -> float_array -> unit = "glstub_glGetFragmentMaterialfvSGIX" "glstub_glGetFragmentMaterialfvSGIX"
+external glGetFragmentMaterialivEXT: int -> int -> word_array -> unit = "glstub_glGetFragmentMaterialivEXT" "glstub_glGetFragmentMaterialivEXT"
+external glGetFragmentMaterialivSGIX: int -> int -> word_array -> unit = "glstub_glGetFragmentMaterialivSGIX" "glstub_glGetFragmentMaterialivSGIX"
+external glGetFramebufferAttachmentParameterivEXT: int -> int -> int -> word_array -> unit = "glstub_glGetFramebufferAttachmentParameterivEXT" "glstub_glGetFramebufferAttachmentParameterivEXT"
+external glGetHistogramParameterfv: int -> int -> float_array -> unit = "glstub_glGetHistogramParameterfv" "glstub_glGetHistogramParameterfv"
+external glGetHistogramParameterfvEXT: int -> int -> float_array -> unit = "glstub_glGetHistogramParameterfvEXT" "glstub_glGetHistogramParameterfvEXT"
+external glGetHistogramParameteriv: int -> int -> word_array -> unit = "glstub_glGetHistogramParameteriv" "glstub_glGetHistogramParameteriv"
+external glGetHistogramParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetHistogramParameterivEXT" "glstub_glGetHistogramParameterivEXT"
+external glGetImageTransformParameterfvHP: int -> int -> float_array -> unit = "glstub_glGetImageTransformParameterfvHP" "glstub_glGetImageTransformParameterfvHP"
+external glGetImageTransformParameterivHP: int -> int -> word_array -> unit = "glstub_glGetImageTransformParameterivHP" "glstub_glGetImageTransformParameterivHP"
+external glGetInfoLogARB: int -> int -> word_array -> string -> unit = "glstub_glGetInfoLogARB" "glstub_glGetInfoLogARB"
+external glGetInteger64v: int -> dword_array -> unit = "glstub_glGetInteger64v" "glstub_glGetInteger64v"
+external glGetIntegerIndexedvEXT: int -> int -> word_array -> unit = "glstub_glGetIntegerIndexedvEXT" "glstub_glGetIntegerIndexedvEXT"
+external glGetIntegerv: int -> word_array -> unit = "glstub_glGetIntegerv" "glstub_glGetIntegerv"
+external glGetInvariantBooleanvEXT: int -> int -> word_array -> unit = "glstub_glGetInvariantBooleanvEXT" "glstub_glGetInvariantBooleanvEXT"
+external glGetInvariantFloatvEXT: int -> int -> float_array -> unit = "glstub_glGetInvariantFloatvEXT" "glstub_glGetInvariantFloatvEXT"
+external glGetInvariantIntegervEXT: int -> int -> word_array -> unit = "glstub_glGetInvariantIntegervEXT" "glstub_glGetInvariantIntegervEXT"
+external glGetLightfv: int -> int -> float_array -> unit = "glstub_glGetLightfv" "glstub_glGetLightfv"
+external glGetLightiv: int -> int -> word_array -> unit = "glstub_glGetLightiv" "glstub_glGetLightiv"
+external glGetLocalConstantBooleanvEXT: int -> int -> word_array -> unit = "glstub_glGetLocalConstantBooleanvEXT" "glstub_glGetLocalConstantBooleanvEXT"
+external glGetLocalConstantFloatvEXT: int -> int -> float_array -> unit = "glstub_glGetLocalConstantFloatvEXT" "glstub_glGetLocalConstantFloatvEXT"
+external glGetLocalConstantIntegervEXT: int -> int -> word_array -> unit = "glstub_glGetLocalConstantIntegervEXT" "glstub_glGetLocalConstantIntegervEXT"
+external glGetMapAttribParameterfvNV: int -> int -> int -> float_array -> unit = "glstub_glGetMapAttribParameterfvNV" "glstub_glGetMapAttribParameterfvNV"
+external glGetMapAttribParameterivNV: int -> int -> int -> word_array -> unit = "glstub_glGetMapAttribParameterivNV" "glstub_glGetMapAttribParameterivNV"
+external glGetMapParameterfvNV: int -> int -> float_array -> unit = "glstub_glGetMapParameterfvNV" "glstub_glGetMapParameterfvNV"
+external glGetMapParameterivNV: int -> int -> word_array -> unit = "glstub_glGetMapParameterivNV" "glstub_glGetMapParameterivNV"
+external glGetMapfv: int -> int -> float_array -> unit = "glstub_glGetMapfv" "glstub_glGetMapfv"
+external glGetMapiv: int -> int -> word_array -> unit = "glstub_glGetMapiv" "glstub_glGetMapiv"
+external glGetMaterialfv: int -> int -> float_array -> unit = "glstub_glGetMaterialfv" "glstub_glGetMaterialfv"
+external glGetMaterialiv: int -> int -> word_array -> unit = "glstub_glGetMaterialiv" "glstub_glGetMaterialiv"
+external glGetMinmaxParameterfv: int -> int -> float_array -> unit = "glstub_glGetMinmaxParameterfv" "glstub_glGetMinmaxParameterfv"
+external glGetMinmaxParameterfvEXT: int -> int -> float_array -> unit = "glstub_glGetMinmaxParameterfvEXT" "glstub_glGetMinmaxParameterfvEXT"
+external glGetMinmaxParameteriv: int -> int -> word_array -> unit = "glstub_glGetMinmaxParameteriv" "glstub_glGetMinmaxParameteriv"
+external glGetMinmaxParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetMinmaxParameterivEXT" "glstub_glGetMinmaxParameterivEXT"
+external glGetObjectBufferfvATI: int -> int -> float_array -> unit = "glstub_glGetObjectBufferfvATI" "glstub_glGetObjectBufferfvATI"
+external glGetObjectBufferivATI: int -> int -> word_array -> unit = "glstub_glGetObjectBufferivATI" "glstub_glGetObjectBufferivATI"
+external glGetObjectParameterfvARB: int -> int -> float_array -> unit = "glstub_glGetObjectParameterfvARB" "glstub_glGetObjectParameterfvARB"
+external glGetObjectParameterivARB: int -> int -> word_array -> unit = "glstub_glGetObjectParameterivARB" "glstub_glGetObjectParameterivARB"
+external glGetOcclusionQueryivNV: int -> int -> word_array -> unit = "glstub_glGetOcclusionQueryivNV" "glstub_glGetOcclusionQueryivNV"
+external glGetOcclusionQueryuivNV: int -> int -> word_array -> unit = "glstub_glGetOcclusionQueryuivNV" "glstub_glGetOcclusionQueryuivNV"
+external glGetPixelMapfv: int -> float_array -> unit = "glstub_glGetPixelMapfv" "glstub_glGetPixelMapfv"
+external glGetPixelMapuiv: int -> word_array -> unit = "glstub_glGetPixelMapuiv" "glstub_glGetPixelMapuiv"
+external glGetPixelMapusv: int -> ushort_array -> unit = "glstub_glGetPixelMapusv" "glstub_glGetPixelMapusv"
+external glGetPixelTransformParameterfvEXT: int -> int -> float_array -> unit = "glstub_glGetPixelTransformParameterfvEXT" "glstub_glGetPixelTransformParameterfvEXT"
+external glGetPixelTransformParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetPixelTransformParameterivEXT" "glstub_glGetPixelTransformParameterivEXT"
+external glGetPolygonStipple: ubyte_array -> unit = "glstub_glGetPolygonStipple" "glstub_glGetPolygonStipple"
+external glGetProgramBinary: int -> int -> word_array -> word_array -> 'a -> unit = "glstub_glGetProgramBinary" "glstub_glGetProgramBinary"
+external glGetProgramEnvParameterfvARB: int -> int -> float_array -> unit = "glstub_glGetProgramEnvParameterfvARB" "glstub_glGetProgramEnvParameterfvARB"
+external glGetProgramInfoLog: int -> int -> word_array -> string -> unit = "glstub_glGetProgramInfoLog" "glstub_glGetProgramInfoLog"
+external glGetProgramLocalParameterfvARB: int -> int -> float_array -> unit = "glstub_glGetProgramLocalParameterfvARB" "glstub_glGetProgramLocalParameterfvARB"
+external glGetProgramNamedParameterdvNV: int -> int -> ubyte_array -> float array -> unit = "glstub_glGetProgramNamedParameterdvNV" "glstub_glGetProgramNamedParameterdvNV"
+external glGetProgramNamedParameterfvNV: int -> int -> ubyte_array -> float_array -> unit = "glstub_glGetProgramNamedParameterfvNV" "glstub_glGetProgramNamedParameterfvNV"
+external glGetProgramParameterfvNV: int -> int -> int -> float_array -> unit = "glstub_glGetProgramParameterfvNV" "glstub_glGetProgramParameterfvNV"
+external glGetProgramStringNV: int -> int -> ubyte_array -> unit = "glstub_glGetProgramStringNV" "glstub_glGetProgramStringNV"
+external glGetProgramiv: int -> int -> word_array -> unit = "glstub_glGetProgramiv" "glstub_glGetProgramiv"
+external glGetProgramivARB: int -> int -> word_array -> unit = "glstub_glGetProgramivARB" "glstub_glGetProgramivARB"
+external glGetProgramivNV: int -> int -> word_array -> unit = "glstub_glGetProgramivNV" "glstub_glGetProgramivNV"
+external glGetQueryObjecti64v: int -> int -> dword_array -> unit = "glstub_glGetQueryObjecti64v" "glstub_glGetQueryObjecti64v"
+external glGetQueryObjecti64vEXT: int -> int -> dword_array -> unit = "glstub_glGetQueryObjecti64vEXT" "glstub_glGetQueryObjecti64vEXT"
+external glGetQueryObjectiv: int -> int -> word_array -> unit = "glstub_glGetQueryObjectiv" "glstub_glGetQueryObjectiv"
+external glGetQueryObjectivARB: int -> int -> word_array -> unit = "glstub_glGetQueryObjectivARB" "glstub_glGetQueryObjectivARB"
+external glGetQueryObjectui64v: int -> int -> dword_array -> unit = "glstub_glGetQueryObjectui64v" "glstub_glGetQueryObjectui64v"
+external glGetQueryObjectui64vEXT: int -> int -> dword_array -> unit = "glstub_glGetQueryObjectui64vEXT" "glstub_glGetQueryObjectui64vEXT"
+external glGetQueryObjectuiv: int -> int -> word_array -> unit = "glstub_glGetQueryObjectuiv" "glstub_glGetQueryObjectuiv"
+external glGetQueryObjectuivARB: int -> int -> word_array -> unit = "glstub_glGetQueryObjectuivARB" "glstub_glGetQueryObjectuivARB"
+external glGetQueryiv: int -> int -> word_array -> unit = "glstub_glGetQueryiv" "glstub_glGetQueryiv"
+external glGetQueryivARB: int -> int -> word_array -> unit = "glstub_glGetQueryivARB" "glstub_glGetQueryivARB"
+external glGetRenderbufferParameterivEXT: int -> int -> word_array -> unit = "glstub_glGetRenderbufferParameterivEXT" "glstub_glGetRenderbufferParameterivEXT"
+external glGetShaderInfoLog: int -> int -> word_array -> string -> unit = "glstub_glGetShaderInfoLog" "glstub_glGetShaderInfoLog"
+external glGetShaderSource: int -> int -> word_array -> string -> unit = "glstub_glGetShaderSource" "glstub_glGetShaderSource"
+external glGetShaderSourceARB: int -> int -> word_array -> string -> unit = "glstub_glGetShaderSourceARB" "glstub_glGetShaderSourceARB"
+external glGetShaderiv: int -> int -> word_array -> unit = "glstub_glGetShaderiv" "glstub_glGetShaderiv"
+external glGetSharpenTexFuncSGIS: int -> float_array -> unit = "glstub_glGetSharpenTexFuncSGIS" "glstub_glGetSharpenTexFuncSGIS"
+external glGetTexBumpParameterfvATI: int -> float_array -> unit = "glstub_glGetTexBumpParameterfvATI" "glstub_glGetTexBumpParameterfvATI"
+external glGetTexBumpParameterivATI: int -> word_array -> unit = "glstub_glGetTexBumpParameterivATI" "glstub_glGetTexBumpParameterivATI"
+external glGetTexEnvfv: int -> int -> float_array -> unit = "glstub_glGetTexEnvfv" "glstub_glGetTexEnvfv"
+external glGetTexEnviv: int -> int -> word_array -> unit = "glstub_glGetTexEnviv" "glstub_glGetTexEnviv"
+external glGetTexFilterFuncSGIS: int -> int -> float_array -> unit = "glstub_glGetTexFilterFuncSGIS" "glstub_glGetTexFilterFuncSGIS"
+external glGetTexGenfv: int -> int -> float_array -> unit = "glstub_glGetTexGenfv" "glstub_glGetTexGenfv"
+external glGetTexGeniv: int -> int -> word_array -> unit = "glstub_glGetTexGeniv" "glstub_glGetTexGeniv"
+external glGetTexLevelParameterfv: int -> int -> int -> float_array -> unit = "glstub_glGetTexLevelParameterfv" "glstub_glGetTexLevelParameterfv"
+external glGetTexLevelParameteriv: int -> int -> int -> word_array -> unit = "glstub_glGetTexLevelParameteriv" "glstub_glGetTexLevelParameteriv"
+external glGetTexParameterIivEXT: int -> int -> word_array -> unit = "glstub_glGetTexParameterIivEXT" "glstub_glGetTexParameterIivEXT"
+external glGetTexParameterIuivEXT: int -> int -> word_array -> unit = "glstub_glGetTexParameterIuivEXT" "glstub_glGetTexParameterIuivEXT"
+external glGetTexParameterfv: int -> int -> float_array -> unit = "glstub_glGetTexParameterfv" "glstub_glGetTexParameterfv"
+external glGetTexParameteriv: int -> int -> word_array -> unit = "glstub_glGetTexParameteriv" "glstub_glGetTexParameteriv"
+external glGetTrackMatrixivNV: int -> int -> int -> word_array -> unit = "glstub_glGetTrackMatrixivNV" "glstub_glGetTrackMatrixivNV"
+external glGetTransformFeedbackVaryingNV: int -> int -> word_array -> unit = "glstub_glGetTransformFeedbackVaryingNV" "glstub_glGetTransformFeedbackVaryingNV"
+external glGetUniformfv: int -> int -> float_array -> unit = "glstub_glGetUniformfv" "glstub_glGetUniformfv"
+external glGetUniformfvARB: int -> int -> float_array -> unit = "glstub_glGetUniformfvARB" "glstub_glGetUniformfvARB"
+external glGetUniformiv: int -> int -> word_array -> unit = "glstub_glGetUniformiv" "glstub_glGetUniformiv"
+external glGetUniformivARB: int -> int -> word_array -> unit = "glstub_glGetUniformivARB" "glstub_glGetUniformivARB"
+external glGetUniformuivEXT: int -> int -> word_array -> unit = "glstub_glGetUniformuivEXT" "glstub_glGetUniformuivEXT"
+external glGetVariantArrayObjectfvATI: int -> int -> float_array -> unit = "glstub_glGetVariantArrayObjectfvATI" "glstub_glGetVariantArrayObjectfvATI"
+external glGetVariantArrayObjectivATI: int -> int -> word_array -> unit = "glstub_glGetVariantArrayObjectivATI" "glstub_glGetVariantArrayObjectivATI"
+external glGetVariantBooleanvEXT: int -> int -> word_array -> unit = "glstub_glGetVariantBooleanvEXT" "glstub_glGetVariantBooleanvEXT"
+external glGetVariantFloatvEXT: int -> int -> float_array -> unit = "glstub_glGetVariantFloatvEXT" "glstub_glGetVariantFloatvEXT"
+external glGetVariantIntegervEXT: int -> int -> word_array -> unit = "glstub_glGetVariantIntegervEXT" "glstub_glGetVariantIntegervEXT"
+external glGetVertexAttribArrayObjectfvATI: int -> int -> float_array -> unit = "glstub_glGetVertexAttribArrayObjectfvATI" "glstub_glGetVertexAttribArrayObjectfvATI"
+external glGetVertexAttribArrayObjectivATI: int -> int -> word_array -> unit = "glstub_glGetVertexAttribArrayObjectivATI" "glstub_glGetVertexAttribArrayObjectivATI"
+external glGetVertexAttribIivEXT: int -> int -> word_array -> unit = "glstub_glGetVertexAttribIivEXT" "glstub_glGetVertexAttribIivEXT"
+external glGetVertexAttribIuivEXT: int -> int -> word_array -> unit = "glstub_glGetVertexAttribIuivEXT" "glstub_glGetVertexAttribIuivEXT"
+external glGetVertexAttribfv: int -> int -> float_array -> unit = "glstub_glGetVertexAttribfv" "glstub_glGetVertexAttribfv"
+external glGetVertexAttribfvARB: int -> int -> float_array -> unit = "glstub_glGetVertexAttribfvARB" "glstub_glGetVertexAttribfvARB"
+external glGetVertexAttribfvNV: int -> int -> float_array -> unit = "glstub_glGetVertexAttribfvNV" "glstub_glGetVertexAttribfvNV"
+external glGetVertexAttribiv: int -> int -> word_array -> unit = "glstub_glGetVertexAttribiv" "glstub_glGetVertexAttribiv"
+external glGetVertexAttribivARB: int -> int -> word_array -> unit = "glstub_glGetVertexAttribivARB" "glstub_glGetVertexAttribivARB"
+external glGetVertexAttribivNV: int -> int -> word_array -> unit = "glstub_glGetVertexAttribivNV" "glstub_glGetVertexAttribivNV"
+external glImageTransformParameterfvHP: int -> int -> float_array -> unit = "glstub_glImageTransformParameterfvHP" "glstub_glImageTransformParameterfvHP"
+external glImageTransformParameterivHP: int -> int -> word_array -> unit = "glstub_glImageTransformParameterivHP" "glstub_glImageTransformParameterivHP"
+external glIndexfv: float_array -> unit = "glstub_glIndexfv" "glstub_glIndexfv"
+external glIndexiv: word_array -> unit = "glstub_glIndexiv" "glstub_glIndexiv"
+external glIndexsv: short_array -> unit = "glstub_glIndexsv" "glstub_glIndexsv"
+external glIndexubv: ubyte_array -> unit = "glstub_glIndexubv" "glstub_glIndexubv"
+external glLightModelfv: int -> float_array -> unit = "glstub_glLightModelfv" "glstub_glLightModelfv"
+external glLightModeliv: int -> word_array -> unit = "glstub_glLightModeliv" "glstub_glLightModeliv"
+external glLightfv: int -> int -> float_array -> unit = "glstub_glLightfv" "glstub_glLightfv"
+external glLightiv: int -> int -> word_array -> unit = "glstub_glLightiv" "glstub_glLightiv"
+external glLoadMatrixf: float_array -> unit = "glstub_glLoadMatrixf" "glstub_glLoadMatrixf"
+external glLoadProgramNV: int -> int -> int -> ubyte_array -> unit = "glstub_glLoadProgramNV" "glstub_glLoadProgramNV"
+external glLoadTransposeMatrixf: float_array -> unit = "glstub_glLoadTransposeMatrixf" "glstub_glLoadTransposeMatrixf"
+external glLoadTransposeMatrixfARB: float_array -> unit = "glstub_glLoadTransposeMatrixfARB" "glstub_glLoadTransposeMatrixfARB"
+external glMap1f: int -> float -> float -> int -> int -> float_array -> unit = "glstub_glMap1f_byte" "glstub_glMap1f"
+external glMap2f: int -> float -> float -> int -> int -> float -> float -> int -> int -> float_array -> unit = "glstub_glMap2f_byte" "glstub_glMap2f"
+external glMapParameterfvNV: int -> int -> float_array -> unit = "glstub_glMapParameterfvNV" "glstub_glMapParameterfvNV"
+external glMapParameterivNV: int -> int -> word_array -> unit = "glstub_glMapParameterivNV" "glstub_glMapParameterivNV"
+external glMaterialfv: int -> int -> float_array -> unit = "glstub_glMaterialfv" "glstub_glMaterialfv"
+external glMaterialiv: int -> int -> word_array -> unit = "glstub_glMaterialiv" "glstub_glMaterialiv"
+external glMatrixIndexubvARB: int -> ubyte_array -> unit = "glstub_glMatrixIndexubvARB" "glstub_glMatrixIndexubvARB"
+external glMatrixIndexuivARB: int -> word_array -> unit = "glstub_glMatrixIndexuivARB" "glstub_glMatrixIndexuivARB"
+external glMatrixIndexusvARB: int -> ushort_array -> unit = "glstub_glMatrixIndexusvARB" "glstub_glMatrixIndexusvARB"
+external glMultMatrixf: float_array -> unit = "glstub_glMultMatrixf" "glstub_glMultMatrixf"
+external glMultTransposeMatrixf: float_array -> unit = "glstub_glMultTransposeMatrixf" "glstub_glMultTransposeMatrixf"
+external glMultTransposeMatrixfARB: float_array -> unit = "glstub_glMultTransposeMatrixfARB" "glstub_glMultTransposeMatrixfARB"
+external glMultiDrawArrays: int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawArrays" "glstub_glMultiDrawArrays"
+external glMultiDrawArraysEXT: int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawArraysEXT" "glstub_glMultiDrawArraysEXT"
+external glMultiDrawElementArrayAPPLE: int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawElementArrayAPPLE" "glstub_glMultiDrawElementArrayAPPLE"
+external glMultiDrawElements: int -> word_array -> int -> 'a -> int -> unit = "glstub_glMultiDrawElements" "glstub_glMultiDrawElements"
+external glMultiDrawElementsBaseVertex: int -> word_array -> int -> 'a -> int -> word_array -> unit = "glstub_glMultiDrawElementsBaseVertex_byte" "glstub_glMultiDrawElementsBaseVertex"
+external glMultiDrawElementsEXT: int -> word_array -> int -> 'a -> int -> unit = "glstub_glMultiDrawElementsEXT" "glstub_glMultiDrawElementsEXT"
+external glMultiDrawRangeElementArrayAPPLE: int -> int -> int -> word_array -> word_array -> int -> unit = "glstub_glMultiDrawRangeElementArrayAPPLE_byte" "glstub_glMultiDrawRangeElementArrayAPPLE"
+external glMultiModeDrawArraysIBM: word_array -> word_array -> word_array -> int -> int -> unit = "glstub_glMultiModeDrawArraysIBM" "glstub_glMultiModeDrawArraysIBM"
+external glMultiModeDrawElementsIBM: word_array -> word_array -> int -> 'a -> int -> int -> unit = "glstub_glMultiModeDrawElementsIBM_byte" "glstub_glMultiModeDrawElementsIBM"
+external glMultiTexCoord1fv: int -> float_array -> unit = "glstub_glMultiTexCoord1fv" "glstub_glMultiTexCoord1fv"
+external glMultiTexCoord1fvARB: int -> float_array -> unit = "glstub_glMultiTexCoord1fvARB" "glstub_glMultiTexCoord1fvARB"
+external glMultiTexCoord1hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord1hvNV" "glstub_glMultiTexCoord1hvNV"
+external glMultiTexCoord1iv: int -> word_array -> unit = "glstub_glMultiTexCoord1iv" "glstub_glMultiTexCoord1iv"
+external glMultiTexCoord1ivARB: int -> word_array -> unit = "glstub_glMultiTexCoord1ivARB" "glstub_glMultiTexCoord1ivARB"
+external glMultiTexCoord1sv: int -> short_array -> unit = "glstub_glMultiTexCoord1sv" "glstub_glMultiTexCoord1sv"
+external glMultiTexCoord1svARB: int -> short_array -> unit = "glstub_glMultiTexCoord1svARB" "glstub_glMultiTexCoord1svARB"
+external glMultiTexCoord2fv: int -> float_array -> unit = "glstub_glMultiTexCoord2fv" "glstub_glMultiTexCoord2fv"
+external glMultiTexCoord2fvARB: int -> float_array -> unit = "glstub_glMultiTexCoord2fvARB" "glstub_glMultiTexCoord2fvARB"
+external glMultiTexCoord2hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord2hvNV" "glstub_glMultiTexCoord2hvNV"
+external glMultiTexCoord2iv: int -> word_array -> unit = "glstub_glMultiTexCoord2iv" "glstub_glMultiTexCoord2iv"
+external glMultiTexCoord2ivARB: int -> word_array -> unit = "glstub_glMultiTexCoord2ivARB" "glstub_glMultiTexCoord2ivARB"
+external glMultiTexCoord2sv: int -> short_array -> unit = "glstub_glMultiTexCoord2sv" "glstub_glMultiTexCoord2sv"
+external glMultiTexCoord2svARB: int -> short_array -> unit = "glstub_glMultiTexCoord2svARB" "glstub_glMultiTexCoord2svARB"
+external glMultiTexCoord3fv: int -> float_array -> unit = "glstub_glMultiTexCoord3fv" "glstub_glMultiTexCoord3fv"
+external glMultiTexCoord3fvARB: int -> float_array -> unit = "glstub_glMultiTexCoord3fvARB" "glstub_glMultiTexCoord3fvARB"
+external glMultiTexCoord3hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord3hvNV" "glstub_glMultiTexCoord3hvNV"
+external glMultiTexCoord3iv: int -> word_array -> unit = "glstub_glMultiTexCoord3iv" "glstub_glMultiTexCoord3iv"
+external glMultiTexCoord3ivARB: int -> word_array -> unit = "glstub_glMultiTexCoord3ivARB" "glstub_glMultiTexCoord3ivARB"
+external glMultiTexCoord3sv: int -> short_array -> unit = "glstub_glMultiTexCoord3sv" "glstub_glMultiTexCoord3sv"
+external glMultiTexCoord3svARB: int -> short_array -> unit = "glstub_glMultiTexCoord3svARB" "glstub_glMultiTexCoord3svARB"
+external glMultiTexCoord4fv: int -> float_array -> unit = "glstub_glMultiTexCoord4fv" "glstub_glMultiTexCoord4fv"
+external glMultiTexCoord4fvARB: int -> float_array -> unit = "glstub_glMultiTexCoord4fvARB" "glstub_glMultiTexCoord4fvARB"
+external glMultiTexCoord4hvNV: int -> ushort_array -> unit = "glstub_glMultiTexCoord4hvNV" "glstub_glMultiTexCoord4hvNV"
+external glMultiTexCoord4iv: int -> word_array -> unit = "glstub_glMultiTexCoord4iv" "glstub_glMultiTexCoord4iv"
+external glMultiTexCoord4ivARB: int -> word_array -> unit = "glstub_glMultiTexCoord4ivARB" "glstub_glMultiTexCoord4ivARB"
+external glMultiTexCoord4sv: int -> short_array -> unit = "glstub_glMultiTexCoord4sv" "glstub_glMultiTexCoord4sv"
+external glMultiTexCoord4svARB: int -> short_array -> unit = "glstub_glMultiTexCoord4svARB" "glstub_glMultiTexCoord4svARB"
+external glNormal3bv: byte_array -> unit = "glstub_glNormal3bv" "glstub_glNormal3bv"
+external glNormal3fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glNormal3fVertex3fvSUN" "glstub_glNormal3fVertex3fvSUN"
+external glNormal3fv: float_array -> unit = "glstub_glNormal3fv" "glstub_glNormal3fv"
+external glNormal3hvNV: ushort_array -> unit = "glstub_glNormal3hvNV" "glstub_glNormal3hvNV"
+external glNormal3iv: word_array -> unit = "glstub_glNormal3iv" "glstub_glNormal3iv"
+external glNormal3sv: short_array -> unit = "glstub_glNormal3sv" "glstub_glNormal3sv"
+external glNormalStream3bvATI: int -> byte_array -> unit = "glstub_glNormalStream3bvATI" "glstub_glNormalStream3bvATI"
+external glNormalStream3fvATI: int -> float_array -> unit = "glstub_glNormalStream3fvATI" "glstub_glNormalStream3fvATI"
+external glNormalStream3ivATI: int -> word_array -> unit = "glstub_glNormalStream3ivATI" "glstub_glNormalStream3ivATI"
+external glNormalStream3svATI: int -> short_array -> unit = "glstub_glNormalStream3svATI" "glstub_glNormalStream3svATI"
+external glPixelMapfv: int -> int -> float_array -> unit = "glstub_glPixelMapfv" "glstub_glPixelMapfv"
+external glPixelMapuiv: int -> int -> word_array -> unit = "glstub_glPixelMapuiv" "glstub_glPixelMapuiv"
+external glPixelMapusv: int -> int -> ushort_array -> unit = "glstub_glPixelMapusv" "glstub_glPixelMapusv"
+external glPixelTransformParameterfvEXT: int -> int -> float_array -> unit = "glstub_glPixelTransformParameterfvEXT" "glstub_glPixelTransformParameterfvEXT"
+external glPixelTransformParameterivEXT: int -> int -> word_array -> unit = "glstub_glPixelTransformParameterivEXT" "glstub_glPixelTransformParameterivEXT"
+external glPointParameterfv: int -> float_array -> unit = "glstub_glPointParameterfv" "glstub_glPointParameterfv"
+external glPointParameterfvARB: int -> float_array -> unit = "glstub_glPointParameterfvARB" "glstub_glPointParameterfvARB"
+external glPointParameterfvEXT: int -> float_array -> unit = "glstub_glPointParameterfvEXT" "glstub_glPointParameterfvEXT"
+external glPointParameterivNV: int -> word_array -> unit = "glstub_glPointParameterivNV" "glstub_glPointParameterivNV"
+external glPollAsyncSGIX: word_array -> int = "glstub_glPollAsyncSGIX" "glstub_glPollAsyncSGIX"
+external glPolygonStipple: ubyte_array -> unit = "glstub_glPolygonStipple" "glstub_glPolygonStipple"
+external glPrioritizeTextures: int -> word_array -> float_array -> unit = "glstub_glPrioritizeTextures" "glstub_glPrioritizeTextures"
+external glPrioritizeTexturesEXT: int -> word_array -> float_array -> unit = "glstub_glPrioritizeTexturesEXT" "glstub_glPrioritizeTexturesEXT"
+external glProgramBufferParametersIivNV: int -> int -> int -> int -> word_array -> unit = "glstub_glProgramBufferParametersIivNV" "glstub_glProgramBufferParametersIivNV"
+external glProgramBufferParametersIuivNV: int -> int -> int -> int -> word_array -> unit = "glstub_glProgramBufferParametersIuivNV" "glstub_glProgramBufferParametersIuivNV"
+external glProgramBufferParametersfvNV: int -> int -> int -> int -> float_array -> unit = "glstub_glProgramBufferParametersfvNV" "glstub_glProgramBufferParametersfvNV"
+external glProgramEnvParameter4fvARB: int -> int -> float_array -> unit = "glstub_glProgramEnvParameter4fvARB" "glstub_glProgramEnvParameter4fvARB"
+external glProgramEnvParameterI4ivNV: int -> int -> word_array -> unit = "glstub_glProgramEnvParameterI4ivNV" "glstub_glProgramEnvParameterI4ivNV"
+external glProgramEnvParameterI4uivNV: int -> int -> word_array -> unit = "glstub_glProgramEnvParameterI4uivNV" "glstub_glProgramEnvParameterI4uivNV"
+external glProgramEnvParameters4fvEXT: int -> int -> int -> float_array -> unit = "glstub_glProgramEnvParameters4fvEXT" "glstub_glProgramEnvParameters4fvEXT"
+external glProgramEnvParametersI4ivNV: int -> int -> int -> word_array -> unit = "glstub_glProgramEnvParametersI4ivNV" "glstub_glProgramEnvParametersI4ivNV"
+external glProgramEnvParametersI4uivNV: int -> int -> int -> word_array -> unit = "glstub_glProgramEnvParametersI4uivNV" "glstub_glProgramEnvParametersI4uivNV"
+external glProgramLocalParameter4fvARB: int -> int -> float_array -> unit = "glstub_glProgramLocalParameter4fvARB" "glstub_glProgramLocalParameter4fvARB"
+external glProgramLocalParameterI4ivNV: int -> int -> word_array -> unit = "glstub_glProgramLocalParameterI4ivNV" "glstub_glProgramLocalParameterI4ivNV"
+external glProgramLocalParameterI4uivNV: int -> int -> word_array -> unit = "glstub_glProgramLocalParameterI4uivNV" "glstub_glProgramLocalParameterI4uivNV"
+external glProgramLocalParameters4fvEXT: int -> int -> int -> float_array -> unit = "glstub_glProgramLocalParameters4fvEXT" "glstub_glProgramLocalParameters4fvEXT"
+external glProgramLocalParametersI4ivNV: int -> int -> int -> word_array -> unit = "glstub_glProgramLocalParametersI4ivNV" "glstub_glProgramLocalParametersI4ivNV"
+external glProgramLocalParametersI4uivNV: int -> int -> int -> word_array -> unit = "glstub_glProgramLocalParametersI4uivNV" "glstub_glProgramLocalParametersI4uivNV"
+external glProgramNamedParameter4dNV: int -> int -> ubyte_array -> float -> float -> float -> float -> unit = "glstub_glProgramNamedParameter4dNV_byte" "glstub_glProgramNamedParameter4dNV"
+external glProgramNamedParameter4dvNV: int -> int -> ubyte_array -> float array -> unit = "glstub_glProgramNamedParameter4dvNV" "glstub_glProgramNamedParameter4dvNV"
+external glProgramNamedParameter4fNV: int -> int -> ubyte_array -> float -> float -> float -> float -> unit = "glstub_glProgramNamedParameter4fNV_byte" "glstub_glProgramNamedParameter4fNV"
+external glProgramNamedParameter4fvNV: int -> int -> ubyte_array -> float_array -> unit = "glstub_glProgramNamedParameter4fvNV" "glstub_glProgramNamedParameter4fvNV"
+external glProgramParameter4fvNV: int -> int -> float_array -> unit = "glstub_glProgramParameter4fvNV" "glstub_glProgramParameter4fvNV"
+external glProgramParameters4fvNV: int -> int -> int -> float_array -> unit = "glstub_glProgramParameters4fvNV" "glstub_glProgramParameters4fvNV"
+external glRasterPos2fv: float_array -> unit = "glstub_glRasterPos2fv" "glstub_glRasterPos2fv"
+external glRasterPos2iv: word_array -> unit = "glstub_glRasterPos2iv" "glstub_glRasterPos2iv"
+external glRasterPos2sv: short_array -> unit = "glstub_glRasterPos2sv" "glstub_glRasterPos2sv"
+external glRasterPos3fv: float_array -> unit = "glstub_glRasterPos3fv" "glstub_glRasterPos3fv"
+external glRasterPos3iv: word_array -> unit = "glstub_glRasterPos3iv" "glstub_glRasterPos3iv"
+external glRasterPos3sv: short_array -> unit = "glstub_glRasterPos3sv" "glstub_glRasterPos3sv"
+external glRasterPos4fv: float_array -> unit = "glstub_glRasterPos4fv" "glstub_glRasterPos4fv"
+external glRasterPos4iv: word_array -> unit = "glstub_glRasterPos4iv" "glstub_glRasterPos4iv"
+external glRasterPos4sv: short_array -> unit = "glstub_glRasterPos4sv" "glstub_glRasterPos4sv"
+external glRectfv: float_array -> float_array -> unit = "glstub_glRectfv" "glstub_glRectfv"
+external glRectiv: word_array -> word_array -> unit = "glstub_glRectiv" "glstub_glRectiv"
+external glRectsv: short_array -> short_array -> unit = "glstub_glRectsv" "glstub_glRectsv"
+external glReplacementCodeubvSUN: ubyte_array -> unit = "glstub_glReplacementCodeubvSUN" "glstub_glReplacementCodeubvSUN"
+external glReplacementCodeuiColor3fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiColor3fVertex3fvSUN" "glstub_glReplacementCodeuiColor3fVertex3fvSUN"
+external glReplacementCodeuiColor4fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN"
+external glReplacementCodeuiColor4ubVertex3fvSUN: word_array -> ubyte_array -> float_array -> unit = "glstub_glReplacementCodeuiColor4ubVertex3fvSUN" "glstub_glReplacementCodeuiColor4ubVertex3fvSUN"
+external glReplacementCodeuiNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiNormal3fVertex3fvSUN"
+external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN"
+external glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN: word_array -> float_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN"
+external glReplacementCodeuiTexCoord2fVertex3fvSUN: word_array -> float_array -> float_array -> unit = "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN" "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN"
+external glReplacementCodeuiVertex3fvSUN: word_array -> float_array -> unit = "glstub_glReplacementCodeuiVertex3fvSUN" "glstub_glReplacementCodeuiVertex3fvSUN"
+external glReplacementCodeuivSUN: word_array -> unit = "glstub_glReplacementCodeuivSUN" "glstub_glReplacementCodeuivSUN"
+external glReplacementCodeusvSUN: ushort_array -> unit = "glstub_glReplacementCodeusvSUN" "glstub_glReplacementCodeusvSUN"
+external glRequestResidentProgramsNV: int -> word_array -> unit = "glstub_glRequestResidentProgramsNV" "glstub_glRequestResidentProgramsNV"
+external glSecondaryColor3bv: byte_array -> unit = "glstub_glSecondaryColor3bv" "glstub_glSecondaryColor3bv"
+external glSecondaryColor3bvEXT: byte_array -> unit = "glstub_glSecondaryColor3bvEXT" "glstub_glSecondaryColor3bvEXT"
+external glSecondaryColor3fv: float_array -> unit = "glstub_glSecondaryColor3fv" "glstub_glSecondaryColor3fv"
+external glSecondaryColor3fvEXT: float_array -> unit = "glstub_glSecondaryColor3fvEXT" "glstub_glSecondaryColor3fvEXT"
+external glSecondaryColor3hvNV: ushort_array -> unit = "glstub_glSecondaryColor3hvNV" "glstub_glSecondaryColor3hvNV"
+external glSecondaryColor3iv: word_array -> unit = "glstub_glSecondaryColor3iv" "glstub_glSecondaryColor3iv"
+external glSecondaryColor3ivEXT: word_array -> unit = "glstub_glSecondaryColor3ivEXT" "glstub_glSecondaryColor3ivEXT"
+external glSecondaryColor3sv: short_array -> unit = "glstub_glSecondaryColor3sv" "glstub_glSecondaryColor3sv"
+external glSecondaryColor3svEXT: short_array -> unit = "glstub_glSecondaryColor3svEXT" "glstub_glSecondaryColor3svEXT"
+external glSecondaryColor3ubv: ubyte_array -> unit = "glstub_glSecondaryColor3ubv" "glstub_glSecondaryColor3ubv"
+external glSecondaryColor3ubvEXT: ubyte_array -> unit = "glstub_glSecondaryColor3ubvEXT" "glstub_glSecondaryColor3ubvEXT"
+external glSecondaryColor3uiv: word_array -> unit = "glstub_glSecondaryColor3uiv" "glstub_glSecondaryColor3uiv"
+external glSecondaryColor3uivEXT: word_array -> unit = "glstub_glSecondaryColor3uivEXT" "glstub_glSecondaryColor3uivEXT"
+external glSecondaryColor3usv: ushort_array -> unit = "glstub_glSecondaryColor3usv" "glstub_glSecondaryColor3usv"
+external glSecondaryColor3usvEXT: ushort_array -> unit = "glstub_glSecondaryColor3usvEXT" "glstub_glSecondaryColor3usvEXT"
+external glSelectBuffer: int -> word_array -> unit = "glstub_glSelectBuffer" "glstub_glSelectBuffer"
+external glSetFragmentShaderConstantATI: int -> float_array -> unit = "glstub_glSetFragmentShaderConstantATI" "glstub_glSetFragmentShaderConstantATI"
+external glShaderSource: int -> int -> string array -> word_array -> unit = "glstub_glShaderSource" "glstub_glShaderSource"
+external glShaderSourceARB: int -> int -> string array -> word_array -> unit = "glstub_glShaderSourceARB" "glstub_glShaderSourceARB"
+external glSharpenTexFuncSGIS: int -> int -> float_array -> unit = "glstub_glSharpenTexFuncSGIS" "glstub_glSharpenTexFuncSGIS"
+external glSpriteParameterfvSGIX: int -> float_array -> unit = "glstub_glSpriteParameterfvSGIX" "glstub_glSpriteParameterfvSGIX"
+external glSpriteParameterivSGIX: int -> word_array -> unit = "glstub_glSpriteParameterivSGIX" "glstub_glSpriteParameterivSGIX"
+external glTexBumpParameterfvATI: int -> float_array -> unit = "glstub_glTexBumpParameterfvATI" "glstub_glTexBumpParameterfvATI"
+external glTexBumpParameterivATI: int -> word_array -> unit = "glstub_glTexBumpParameterivATI" "glstub_glTexBumpParameterivATI"
+external glTexCoord1fv: float_array -> unit = "glstub_glTexCoord1fv" "glstub_glTexCoord1fv"
+external glTexCoord1hvNV: ushort_array -> unit = "glstub_glTexCoord1hvNV" "glstub_glTexCoord1hvNV"
+external glTexCoord1iv: word_array -> unit = "glstub_glTexCoord1iv" "glstub_glTexCoord1iv"
+external glTexCoord1sv: short_array -> unit = "glstub_glTexCoord1sv" "glstub_glTexCoord1sv"
+external glTexCoord2fColor3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fColor3fVertex3fvSUN" "glstub_glTexCoord2fColor3fVertex3fvSUN"
+external glTexCoord2fColor4fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN" "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN"
+external glTexCoord2fColor4ubVertex3fvSUN: float_array -> ubyte_array -> float_array -> unit = "glstub_glTexCoord2fColor4ubVertex3fvSUN" "glstub_glTexCoord2fColor4ubVertex3fvSUN"
+external glTexCoord2fNormal3fVertex3fvSUN: float_array -> float_array -> float_array -> unit = "glstub_glTexCoord2fNormal3fVertex3fvSUN" "glstub_glTexCoord2fNormal3fVertex3fvSUN"
+external glTexCoord2fVertex3fvSUN: float_array -> float_array -> unit = "glstub_glTexCoord2fVertex3fvSUN" "glstub_glTexCoord2fVertex3fvSUN"
+external glTexCoord2fv: float_array -> unit = "glstub_glTexCoord2fv" "glstub_glTexCoord2fv"
+external glTexCoord2hvNV: ushort_array -> unit = "glstub_glTexCoord2hvNV" "glstub_glTexCoord2hvNV"
+external glTexCoord2iv: word_array -> unit = "glstub_glTexCoord2iv" "glstub_glTexCoord2iv"
+external glTexCoord2sv: short_array -> unit = "glstub_glTexCoord2sv" "glstub_glTexCoord2sv"
+external glTexCoord3fv: float_array -> unit = "glstub_glTexCoord3fv" "glstub_glTexCoord3fv"
+external glTexCoord3hvNV: ushort_array -> unit = "glstub_glTexCoord3hvNV" "glstub_glTexCoord3hvNV"
+external glTexCoord3iv: word_array -> unit = "glstub_glTexCoord3iv" "glstub_glTexCoord3iv"
+external glTexCoord3sv: short_array -> unit = "glstub_glTexCoord3sv" "glstub_glTexCoord3sv"
+external glTexCoord4fColor4fNormal3fVertex4fvSUN: float_array -> float_array -> float_array -> float_array -> unit = "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN" "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN"
+external glTexCoord4fVertex4fvSUN: float_array -> float_array -> unit = "glstub_glTexCoord4fVertex4fvSUN" "glstub_glTexCoord4fVertex4fvSUN"
+external glTexCoord4fv: float_array -> unit = "glstub_glTexCoord4fv" "glstub_glTexCoord4fv"
+external glTexCoord4hvNV: ushort_array -> unit = "glstub_glTexCoord4hvNV" "glstub_glTexCoord4hvNV"
+external glTexCoord4iv: word_array -> unit = "glstub_glTexCoord4iv" "glstub_glTexCoord4iv"
+external glTexCoord4sv: short_array -> unit = "glstub_glTexCoord4sv" "glstub_glTexCoord4sv"
+external glTexEnvfv: int -> int -> float_array -> unit = "glstub_glTexEnvfv" "glstub_glTexEnvfv"
+external glTexEnviv: int -> int -> word_array -> unit = "glstub_glTexEnviv" "glstub_glTexEnviv"
+external glTexFilterFuncSGIS: int -> int -> int -> float_array -> unit = "glstub_glTexFilterFuncSGIS" "glstub_glTexFilterFuncSGIS"
+external glTexGenfv: int -> int -> float_array -> unit = "glstub_glTexGenfv" "glstub_glTexGenfv"
+external glTexGeniv: int -> int -> word_array -> unit = "glstub_glTexGeniv" "glstub_glTexGeniv"
+external glTexParameterIivEXT: int -> int -> word_array -> unit = "glstub_glTexParameterIivEXT" "glstub_glTexParameterIivEXT"
+external glTexParameterIuivEXT: int -> int -> word_array -> unit = "glstub_glTexParameterIuivEXT" "glstub_glTexParameterIuivEXT"
+external glTexParameterfv: int -> int -> float_array -> unit = "glstub_glTexParameterfv" "glstub_glTexParameterfv"
+external glTexParameteriv: int -> int -> word_array -> unit = "glstub_glTexParameteriv" "glstub_glTexParameteriv"
+external glTransformFeedbackAttribsNV: int -> word_array -> int -> unit = "glstub_glTransformFeedbackAttribsNV" "glstub_glTransformFeedbackAttribsNV"
+external glTransformFeedbackVaryingsNV: int -> int -> word_array -> int -> unit = "glstub_glTransformFeedbackVaryingsNV" "glstub_glTransformFeedbackVaryingsNV"
+external glUniform1fv: int -> int -> float_array -> unit = "glstub_glUniform1fv" "glstub_glUniform1fv"
+external glUniform1fvARB: int -> int -> float_array -> unit = "glstub_glUniform1fvARB" "glstub_glUniform1fvARB"
+external glUniform1iv: int -> int -> word_array -> unit = "glstub_glUniform1iv" "glstub_glUniform1iv"
+external glUniform1ivARB: int -> int -> word_array -> unit = "glstub_glUniform1ivARB" "glstub_glUniform1ivARB"
+external glUniform1uivEXT: int -> int -> word_array -> unit = "glstub_glUniform1uivEXT" "glstub_glUniform1uivEXT"
+external glUniform2fv: int -> int -> float_array -> unit = "glstub_glUniform2fv" "glstub_glUniform2fv"
+external glUniform2fvARB: int -> int -> float_array -> unit = "glstub_glUniform2fvARB" "glstub_glUniform2fvARB"
+external glUniform2iv: int -> int -> word_array -> unit = "glstub_glUniform2iv" "glstub_glUniform2iv"
+external glUniform2ivARB: int -> int -> word_array -> unit = "glstub_glUniform2ivARB" "glstub_glUniform2ivARB"
+external glUniform2uivEXT: int -> int -> word_array -> unit = "glstub_glUniform2uivEXT" "glstub_glUniform2uivEXT"
+external glUniform3fv: int -> int -> float_array -> unit = "glstub_glUniform3fv" "glstub_glUniform3fv"
+external glUniform3fvARB: int -> int -> float_array -> unit = "glstub_glUniform3fvARB" "glstub_glUniform3fvARB"
+external glUniform3iv: int -> int -> word_array -> unit = "glstub_glUniform3iv" "glstub_glUniform3iv"
+external glUniform3ivARB: int -> int -> word_array -> unit = "glstub_glUniform3ivARB" "glstub_glUniform3ivARB"
+external glUniform3uivEXT: int -> int -> word_array -> unit = "glstub_glUniform3uivEXT" "glstub_glUniform3uivEXT"
+external glUniform4fv: int -> int -> float_array -> unit = "glstub_glUniform4fv" "glstub_glUniform4fv"
+external glUniform4fvARB: int -> int -> float_array -> unit = "glstub_glUniform4fvARB" "glstub_glUniform4fvARB"
+external glUniform4iv: int -> int -> word_array -> unit = "glstub_glUniform4iv" "glstub_glUniform4iv"
+external glUniform4ivARB: int -> int -> word_array -> unit = "glstub_glUniform4ivARB" "glstub_glUniform4ivARB"
+external glUniform4uivEXT: int -> int -> word_array -> unit = "glstub_glUniform4uivEXT" "glstub_glUniform4uivEXT"
+external glUniformMatrix2fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix2fv" "glstub_glUniformMatrix2fv"
+external glUniformMatrix2fvARB: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix2fvARB" "glstub_glUniformMatrix2fvARB"
+external glUniformMatrix2x3fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix2x3fv" "glstub_glUniformMatrix2x3fv"
+external glUniformMatrix2x4fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix2x4fv" "glstub_glUniformMatrix2x4fv"
+external glUniformMatrix3fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix3fv" "glstub_glUniformMatrix3fv"
+external glUniformMatrix3fvARB: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix3fvARB" "glstub_glUniformMatrix3fvARB"
+external glUniformMatrix3x2fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix3x2fv" "glstub_glUniformMatrix3x2fv"
+external glUniformMatrix3x4fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix3x4fv" "glstub_glUniformMatrix3x4fv"
+external glUniformMatrix4fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix4fv" "glstub_glUniformMatrix4fv"
+external glUniformMatrix4fvARB: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix4fvARB" "glstub_glUniformMatrix4fvARB"
+external glUniformMatrix4x2fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix4x2fv" "glstub_glUniformMatrix4x2fv"
+external glUniformMatrix4x3fv: int -> int -> bool -> float_array -> unit = "glstub_glUniformMatrix4x3fv" "glstub_glUniformMatrix4x3fv"
+external glVariantbvEXT: int -> byte_array -> unit = "glstub_glVariantbvEXT" "glstub_glVariantbvEXT"
+external glVariantfvEXT: int -> float_array -> unit = "glstub_glVariantfvEXT" "glstub_glVariantfvEXT"
+external glVariantivEXT: int -> word_array -> unit = "glstub_glVariantivEXT" "glstub_glVariantivEXT"
+external glVariantsvEXT: int -> short_array -> unit = "glstub_glVariantsvEXT" "glstub_glVariantsvEXT"
+external glVariantubvEXT: int -> ubyte_array -> unit = "glstub_glVariantubvEXT" "glstub_glVariantubvEXT"
+external glVariantuivEXT: int -> word_array -> unit = "glstub_glVariantuivEXT" "glstub_glVariantuivEXT"
+external glVariantusvEXT: int -> ushort_array -> unit = "glstub_glVariantusvEXT" "glstub_glVariantusvEXT"
+external glVertex2fv: float_array -> unit = "glstub_glVertex2fv" "glstub_glVertex2fv"
+external glVertex2hvNV: ushort_array -> unit = "glstub_glVertex2hvNV" "glstub_glVertex2hvNV"
+external glVertex2iv: word_array -> unit = "glstub_glVertex2iv" "glstub_glVertex2iv"
+external glVertex2sv: short_array -> unit = "glstub_glVertex2sv" "glstub_glVertex2sv"
+external glVertex3fv: float_array -> unit = "glstub_glVertex3fv" "glstub_glVertex3fv"
+external glVertex3hvNV: ushort_array -> unit = "glstub_glVertex3hvNV" "glstub_glVertex3hvNV"
+external glVertex3iv: word_array -> unit = "glstub_glVertex3iv" "glstub_glVertex3iv"
+external glVertex3sv: short_array -> unit = "glstub_glVertex3sv" "glstub_glVertex3sv"
+external glVertex4fv: float_array -> unit = "glstub_glVertex4fv" "glstub_glVertex4fv"
+external glVertex4hvNV: ushort_array -> unit = "glstub_glVertex4hvNV" "glstub_glVertex4hvNV"
+external glVertex4iv: word_array -> unit = "glstub_glVertex4iv" "glstub_glVertex4iv"
+external glVertex4sv: short_array -> unit = "glstub_glVertex4sv" "glstub_glVertex4sv"
+external glVertexAttrib1fv: int -> float_array -> unit = "glstub_glVertexAttrib1fv" "glstub_glVertexAttrib1fv"
+external glVertexAttrib1fvARB: int -> float_array -> unit = "glstub_glVertexAttrib1fvARB" "glstub_glVertexAttrib1fvARB"
+external glVertexAttrib1fvNV: int -> float_array -> unit = "glstub_glVertexAttrib1fvNV" "glstub_glVertexAttrib1fvNV"
+external glVertexAttrib1hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib1hvNV" "glstub_glVertexAttrib1hvNV"
+external glVertexAttrib1sv: int -> short_array -> unit = "glstub_glVertexAttrib1sv" "glstub_glVertexAttrib1sv"
+external glVertexAttrib1svARB: int -> short_array -> unit = "glstub_glVertexAttrib1svARB" "glstub_glVertexAttrib1svARB"
+external glVertexAttrib1svNV: int -> short_array -> unit = "glstub_glVertexAttrib1svNV" "glstub_glVertexAttrib1svNV"
+external glVertexAttrib2fv: int -> float_array -> unit = "glstub_glVertexAttrib2fv" "glstub_glVertexAttrib2fv"
+external glVertexAttrib2fvARB: int -> float_array -> unit = "glstub_glVertexAttrib2fvARB" "glstub_glVertexAttrib2fvARB"
+external glVertexAttrib2fvNV: int -> float_array -> unit = "glstub_glVertexAttrib2fvNV" "glstub_glVertexAttrib2fvNV"
+external glVertexAttrib2hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib2hvNV" "glstub_glVertexAttrib2hvNV"
+external glVertexAttrib2sv: int -> short_array -> unit = "glstub_glVertexAttrib2sv" "glstub_glVertexAttrib2sv"
+external glVertexAttrib2svARB: int -> short_array -> unit = "glstub_glVertexAttrib2svARB" "glstub_glVertexAttrib2svARB"
+external glVertexAttrib2svNV: int -> short_array -> unit = "glstub_glVertexAttrib2svNV" "glstub_glVertexAttrib2svNV"
+external glVertexAttrib3fv: int -> float_array -> unit = "glstub_glVertexAttrib3fv" "glstub_glVertexAttrib3fv"
+external glVertexAttrib3fvARB: int -> float_array -> unit = "glstub_glVertexAttrib3fvARB" "glstub_glVertexAttrib3fvARB"
+external glVertexAttrib3fvNV: int -> float_array -> unit = "glstub_glVertexAttrib3fvNV" "glstub_glVertexAttrib3fvNV"
+external glVertexAttrib3hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib3hvNV" "glstub_glVertexAttrib3hvNV"
+external glVertexAttrib3sv: int -> short_array -> unit = "glstub_glVertexAttrib3sv" "glstub_glVertexAttrib3sv"
+external glVertexAttrib3svARB: int -> short_array -> unit = "glstub_glVertexAttrib3svARB" "glstub_glVertexAttrib3svARB"
+external glVertexAttrib3svNV: int -> short_array -> unit = "glstub_glVertexAttrib3svNV" "glstub_glVertexAttrib3svNV"
+external glVertexAttrib4Nbv: int -> byte_array -> unit = "glstub_glVertexAttrib4Nbv" "glstub_glVertexAttrib4Nbv"
+external glVertexAttrib4NbvARB: int -> byte_array -> unit = "glstub_glVertexAttrib4NbvARB" "glstub_glVertexAttrib4NbvARB"
+external glVertexAttrib4Niv: int -> word_array -> unit = "glstub_glVertexAttrib4Niv" "glstub_glVertexAttrib4Niv"
+external glVertexAttrib4NivARB: int -> word_array -> unit = "glstub_glVertexAttrib4NivARB" "glstub_glVertexAttrib4NivARB"
+external glVertexAttrib4Nsv: int -> short_array -> unit = "glstub_glVertexAttrib4Nsv" "glstub_glVertexAttrib4Nsv"
+external glVertexAttrib4NsvARB: int -> short_array -> unit = "glstub_glVertexAttrib4NsvARB" "glstub_glVertexAttrib4NsvARB"
+external glVertexAttrib4Nubv: int -> ubyte_array -> unit = "glstub_glVertexAttrib4Nubv" "glstub_glVertexAttrib4Nubv"
+external glVertexAttrib4NubvARB: int -> ubyte_array -> unit = "glstub_glVertexAttrib4NubvARB" "glstub_glVertexAttrib4NubvARB"
+external glVertexAttrib4Nuiv: int -> word_array -> unit = "glstub_glVertexAttrib4Nuiv" "glstub_glVertexAttrib4Nuiv"
+external glVertexAttrib4NuivARB: int -> word_array -> unit = "glstub_glVertexAttrib4NuivARB" "glstub_glVertexAttrib4NuivARB"
+external glVertexAttrib4Nusv: int -> ushort_array -> unit = "glstub_glVertexAttrib4Nusv" "glstub_glVertexAttrib4Nusv"
+external glVertexAttrib4NusvARB: int -> ushort_array -> unit = "glstub_glVertexAttrib4NusvARB" "glstub_glVertexAttrib4NusvARB"
+external glVertexAttrib4bv: int -> byte_array -> unit = "glstub_glVertexAttrib4bv" "glstub_glVertexAttrib4bv"
+external glVertexAttrib4bvARB: int -> byte_array -> unit = "glstub_glVertexAttrib4bvARB" "glstub_glVertexAttrib4bvARB"
+external glVertexAttrib4fv: int -> float_array -> unit = "glstub_glVertexAttrib4fv" "glstub_glVertexAttrib4fv"
+external glVertexAttrib4fvARB: int -> float_array -> unit = "glstub_glVertexAttrib4fvARB" "glstub_glVertexAttrib4fvARB"
+external glVertexAttrib4fvNV: int -> float_array -> unit = "glstub_glVertexAttrib4fvNV" "glstub_glVertexAttrib4fvNV"
+external glVertexAttrib4hvNV: int -> ushort_array -> unit = "glstub_glVertexAttrib4hvNV" "glstub_glVertexAttrib4hvNV"
+external glVertexAttrib4iv: int -> word_array -> unit = "glstub_glVertexAttrib4iv" "glstub_glVertexAttrib4iv"
+external glVertexAttrib4ivARB: int -> word_array -> unit = "glstub_glVertexAttrib4ivARB" "glstub_glVertexAttrib4ivARB"
+external glVertexAttrib4sv: int -> short_array -> unit = "glstub_glVertexAttrib4sv" "glstub_glVertexAttrib4sv"
+external glVertexAttrib4svARB: int -> short_array -> unit = "glstub_glVertexAttrib4svARB" "glstub_glVertexAttrib4svARB"
+external glVertexAttrib4svNV: int -> short_array -> unit = "glstub_glVertexAttrib4svNV" "glstub_glVertexAttrib4svNV"
+external glVertexAttrib4ubv: int -> ubyte_array -> unit = "glstub_glVertexAttrib4ubv" "glstub_glVertexAttrib4ubv"
+external glVertexAttrib4ubvARB: int -> ubyte_array -> unit = "glstub_glVertexAttrib4ubvARB" "glstub_glVertexAttrib4ubvARB"
+external glVertexAttrib4ubvNV: int -> ubyte_array -> unit = "glstub_glVertexAttrib4ubvNV" "glstub_glVertexAttrib4ubvNV"
+external glVertexAttrib4uiv: int -> word_array -> unit = "glstub_glVertexAttrib4uiv" "glstub_glVertexAttrib4uiv"
+external glVertexAttrib4uivARB: int -> word_array -> unit = "glstub_glVertexAttrib4uivARB" "glstub_glVertexAttrib4uivARB"
+external glVertexAttrib4usv: int -> ushort_array -> unit = "glstub_glVertexAttrib4usv" "glstub_glVertexAttrib4usv"
+external glVertexAttrib4usvARB: int -> ushort_array -> unit = "glstub_glVertexAttrib4usvARB" "glstub_glVertexAttrib4usvARB"
+external glVertexAttribI1ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI1ivEXT" "glstub_glVertexAttribI1ivEXT"
+external glVertexAttribI1uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI1uivEXT" "glstub_glVertexAttribI1uivEXT"
+external glVertexAttribI2ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI2ivEXT" "glstub_glVertexAttribI2ivEXT"
+external glVertexAttribI2uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI2uivEXT" "glstub_glVertexAttribI2uivEXT"
+external glVertexAttribI3ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI3ivEXT" "glstub_glVertexAttribI3ivEXT"
+external glVertexAttribI3uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI3uivEXT" "glstub_glVertexAttribI3uivEXT"
+external glVertexAttribI4bvEXT: int -> byte_array -> unit = "glstub_glVertexAttribI4bvEXT" "glstub_glVertexAttribI4bvEXT"
+external glVertexAttribI4ivEXT: int -> word_array -> unit = "glstub_glVertexAttribI4ivEXT" "glstub_glVertexAttribI4ivEXT"
+external glVertexAttribI4svEXT: int -> short_array -> unit = "glstub_glVertexAttribI4svEXT" "glstub_glVertexAttribI4svEXT"
+external glVertexAttribI4ubvEXT: int -> ubyte_array -> unit = "glstub_glVertexAttribI4ubvEXT" "glstub_glVertexAttribI4ubvEXT"
+external glVertexAttribI4uivEXT: int -> word_array -> unit = "glstub_glVertexAttribI4uivEXT" "glstub_glVertexAttribI4uivEXT"
+external glVertexAttribI4usvEXT: int -> ushort_array -> unit = "glstub_glVertexAttribI4usvEXT" "glstub_glVertexAttribI4usvEXT"
+external glVertexAttribs1fvNV: int -> int -> float_array -> unit = "glstub_glVertexAttribs1fvNV" "glstub_glVertexAttribs1fvNV"
+external glVertexAttribs1hvNV: int -> int -> ushort_array -> unit = "glstub_glVertexAttribs1hvNV" "glstub_glVertexAttribs1hvNV"
+external glVertexAttribs1svNV: int -> int -> short_array -> unit = "glstub_glVertexAttribs1svNV" "glstub_glVertexAttribs1svNV"
+external glVertexAttribs2fvNV: int -> int -> float_array -> unit = "glstub_glVertexAttribs2fvNV" "glstub_glVertexAttribs2fvNV"
+external glVertexAttribs2hvNV: int -> int -> ushort_array -> unit = "glstub_glVertexAttribs2hvNV" "glstub_glVertexAttribs2hvNV"
+external glVertexAttribs2svNV: int -> int -> short_array -> unit = "glstub_glVertexAttribs2svNV" "glstub_glVertexAttribs2svNV"
+external glVertexAttribs3fvNV: int -> int -> float_array -> unit = "glstub_glVertexAttribs3fvNV" "glstub_glVertexAttribs3fvNV"
+external glVertexAttribs3hvNV: int -> int -> ushort_array -> unit = "glstub_glVertexAttribs3hvNV" "glstub_glVertexAttribs3hvNV"
+external glVertexAttribs3svNV: int -> int -> short_array -> unit = "glstub_glVertexAttribs3svNV" "glstub_glVertexAttribs3svNV"
+external glVertexAttribs4fvNV: int -> int -> float_array -> unit = "glstub_glVertexAttribs4fvNV" "glstub_glVertexAttribs4fvNV"
+external glVertexAttribs4hvNV: int -> int -> ushort_array -> unit = "glstub_glVertexAttribs4hvNV" "glstub_glVertexAttribs4hvNV"
+external glVertexAttribs4svNV: int -> int -> short_array -> unit = "glstub_glVertexAttribs4svNV" "glstub_glVertexAttribs4svNV"
+external glVertexAttribs4ubvNV: int -> int -> ubyte_array -> unit = "glstub_glVertexAttribs4ubvNV" "glstub_glVertexAttribs4ubvNV"
+external glVertexStream2fvATI: int -> float_array -> unit = "glstub_glVertexStream2fvATI" "glstub_glVertexStream2fvATI"
+external glVertexStream2ivATI: int -> word_array -> unit = "glstub_glVertexStream2ivATI" "glstub_glVertexStream2ivATI"
+external glVertexStream2svATI: int -> short_array -> unit = "glstub_glVertexStream2svATI" "glstub_glVertexStream2svATI"
+external glVertexStream3fvATI: int -> float_array -> unit = "glstub_glVertexStream3fvATI" "glstub_glVertexStream3fvATI"
+external glVertexStream3ivATI: int -> word_array -> unit = "glstub_glVertexStream3ivATI" "glstub_glVertexStream3ivATI"
+external glVertexStream3svATI: int -> short_array -> unit = "glstub_glVertexStream3svATI" "glstub_glVertexStream3svATI"
+external glVertexStream4fvATI: int -> float_array -> unit = "glstub_glVertexStream4fvATI" "glstub_glVertexStream4fvATI"
+external glVertexStream4ivATI: int -> word_array -> unit = "glstub_glVertexStream4ivATI" "glstub_glVertexStream4ivATI"
+external glVertexStream4svATI: int -> short_array -> unit = "glstub_glVertexStream4svATI" "glstub_glVertexStream4svATI"
+external glVertexWeightfvEXT: float_array -> unit = "glstub_glVertexWeightfvEXT" "glstub_glVertexWeightfvEXT"
+external glVertexWeighthvNV: ushort_array -> unit = "glstub_glVertexWeighthvNV" "glstub_glVertexWeighthvNV"
+external glWeightbvARB: int -> byte_array -> unit = "glstub_glWeightbvARB" "glstub_glWeightbvARB"
+external glWeightfvARB: int -> float_array -> unit = "glstub_glWeightfvARB" "glstub_glWeightfvARB"
+external glWeightivARB: int -> word_array -> unit = "glstub_glWeightivARB" "glstub_glWeightivARB"
+external glWeightsvARB: int -> short_array -> unit = "glstub_glWeightsvARB" "glstub_glWeightsvARB"
+external glWeightubvARB: int -> ubyte_array -> unit = "glstub_glWeightubvARB" "glstub_glWeightubvARB"
+external glWeightuivARB: int -> word_array -> unit = "glstub_glWeightuivARB" "glstub_glWeightuivARB"
+external glWeightusvARB: int -> ushort_array -> unit = "glstub_glWeightusvARB" "glstub_glWeightusvARB"
+external glWindowPos2fv: float_array -> unit = "glstub_glWindowPos2fv" "glstub_glWindowPos2fv"
+external glWindowPos2fvARB: float_array -> unit = "glstub_glWindowPos2fvARB" "glstub_glWindowPos2fvARB"
+external glWindowPos2fvMESA: float_array -> unit = "glstub_glWindowPos2fvMESA" "glstub_glWindowPos2fvMESA"
+external glWindowPos2iv: word_array -> unit = "glstub_glWindowPos2iv" "glstub_glWindowPos2iv"
+external glWindowPos2ivARB: word_array -> unit = "glstub_glWindowPos2ivARB" "glstub_glWindowPos2ivARB"
+external glWindowPos2ivMESA: word_array -> unit = "glstub_glWindowPos2ivMESA" "glstub_glWindowPos2ivMESA"
+external glWindowPos2sv: short_array -> unit = "glstub_glWindowPos2sv" "glstub_glWindowPos2sv"
+external glWindowPos2svARB: short_array -> unit = "glstub_glWindowPos2svARB" "glstub_glWindowPos2svARB"
+external glWindowPos2svMESA: short_array -> unit = "glstub_glWindowPos2svMESA" "glstub_glWindowPos2svMESA"
+external glWindowPos3fv: float_array -> unit = "glstub_glWindowPos3fv" "glstub_glWindowPos3fv"
+external glWindowPos3fvARB: float_array -> unit = "glstub_glWindowPos3fvARB" "glstub_glWindowPos3fvARB"
+external glWindowPos3fvMESA: float_array -> unit = "glstub_glWindowPos3fvMESA" "glstub_glWindowPos3fvMESA"
+external glWindowPos3iv: word_array -> unit = "glstub_glWindowPos3iv" "glstub_glWindowPos3iv"
+external glWindowPos3ivARB: word_array -> unit = "glstub_glWindowPos3ivARB" "glstub_glWindowPos3ivARB"
+external glWindowPos3ivMESA: word_array -> unit = "glstub_glWindowPos3ivMESA" "glstub_glWindowPos3ivMESA"
+external glWindowPos3sv: short_array -> unit = "glstub_glWindowPos3sv" "glstub_glWindowPos3sv"
+external glWindowPos3svARB: short_array -> unit = "glstub_glWindowPos3svARB" "glstub_glWindowPos3svARB"
+external glWindowPos3svMESA: short_array -> unit = "glstub_glWindowPos3svMESA" "glstub_glWindowPos3svMESA"
+external glWindowPos4fvMESA: float_array -> unit = "glstub_glWindowPos4fvMESA" "glstub_glWindowPos4fvMESA"
+external glWindowPos4ivMESA: word_array -> unit = "glstub_glWindowPos4ivMESA" "glstub_glWindowPos4ivMESA"
+external glWindowPos4svMESA: short_array -> unit = "glstub_glWindowPos4svMESA" "glstub_glWindowPos4svMESA"
+end
+
+module Cmdbuf = struct
+
+(** Command buffers.
+	Each encoder below has the name and arguments of the GL function it records,
+	preceded by the buffer: [Cmdbuf.glBindTexture b gl_texture_2d tex] appends the
+	opcode of glBindTexture followed by its two operands. All operands are stored
+	as doubles, which holds GL ints, enums and floats exactly. [execute] replays the
+	whole buffer with a single C call; a buffer may be executed any number of times,
+	so static scenes can be recorded once and resubmitted every frame.
+	Only functions with scalar arguments and no result can be recorded. *)
+type t = {
+	mutable data : double_array;
+	mutable len : int
+}
+
+(** Create an empty command buffer with room for n slots *)
+let create n = { data = make_double_array (max n 16); len = 0 }
+
+(** Discard all recorded commands, keeping the storage *)
+let clear b = b.len <- 0
+
+(** Number of slots in use *)
+let length b = b.len
+
+(** Grow the storage of b to at least n slots *)
+let grow b n =
+	let size = ref (max 16 (Bigarray.Array1.dim b.data)) in
+	while !size < n do size := 2 * !size done;
+	let d = make_double_array !size in
+	Bigarray.Array1.blit (Bigarray.Array1.sub b.data 0 b.len) (Bigarray.Array1.sub d 0 b.len);
+	b.data <- d
+
+(** Reserve n slots at the end of b and return the index of the first one *)
+let reserve b n =
+	let o = b.len in
+	if o + n > Bigarray.Array1.dim b.data then grow b (o + n);
+	b.len <- o + n;
+	o
+
+external execute' : double_array -> int -> unit = "glstub_cmdbuf_execute"
+
+(** Replay all commands recorded in b *)
+let execute b = execute' b.data b.len
+
+(** Opcode table: name and number of operands of every opcode *)
+let opcodes = [|
+("glAccum", 2);
+("glActiveStencilFaceEXT", 1);
+("glActiveTexture", 1);
+("glActiveTextureARB", 1);
+("glAddSwapHintRectWIN", 4);
+("glAlphaFragmentOp1ATI", 6);
+("glAlphaFragmentOp2ATI", 9);
+("glAlphaFragmentOp3ATI", 12);
+("glAlphaFunc", 2);
+("glApplyTextureEXT", 1);
+("glArrayElement", 1);
+("glArrayElementEXT", 1);
+("glArrayObjectATI", 6);
+("glAsyncMarkerSGIX", 1);
+("glAttachObjectARB", 2);
+("glAttachShader", 2);
+("glBegin", 1);
+("glBeginFragmentShaderATI", 0);
+("glBeginOcclusionQueryNV", 1);
+("glBeginQuery", 2);
+("glBeginQueryARB", 2);
+("glBeginSceneEXT", 0);
+("glBeginTransformFeedbackNV", 1);
+("glBeginVertexShaderEXT", 0);
+("glBindBuffer", 2);
+("glBindBufferARB", 2);
+("glBindBufferBase", 3);
+("glBindBufferBaseNV", 3);
+("glBindBufferOffsetNV", 4);
+("glBindBufferRange", 5);
+("glBindBufferRangeNV", 5);
+("glBindFragmentShaderATI", 1);
+("glBindFramebuffer", 2);
+("glBindFramebufferEXT", 2);
+("glBindProgramARB", 2);
+("glBindProgramNV", 2);
+("glBindRenderbuffer", 2);
+("glBindRenderbufferEXT", 2);
+("glBindSampler", 2);
+("glBindTexture", 2);
+("glBindTextureEXT", 2);
+("glBindVertexArray", 1);
+("glBindVertexArrayAPPLE", 1);
+("glBindVertexShaderEXT", 1);
+("glBlendColor", 4);
+("glBlendColorEXT", 4);
+("glBlendEquation", 1);
+("glBlendEquationEXT", 1);
+("glBlendEquationSeparate", 2);
+("glBlendEquationSeparateEXT", 2);
+("glBlendFunc", 2);
+("glBlendFuncSeparate", 4);
+("glBlendFuncSeparateEXT", 4);
+("glBlitFramebuffer", 10);
+("glBlitFramebufferEXT", 10);
+("glCallList", 1);
+("glClampColorARB", 2);
+("glClear", 1);
+("glClearAccum", 4);
+("glClearColor", 4);
+("glClearColorIiEXT", 4);
+("glClearColorIuiEXT", 4);
+("glClearDepth", 1);
+("glClearDepthdNV", 1);
+("glClearDepthfOES", 1);
+("glClearIndex", 1);
+("glClearStencil", 1);
+("glClientActiveTexture", 1);
+("glClientActiveTextureARB", 1);
+("glClientActiveVertexStreamATI", 1);
+("glColor3b", 3);
+("glColor3d", 3);
+("glColor3f", 3);
+("glColor3fVertex3fSUN", 6);
+("glColor3hNV", 3);
+("glColor3i", 3);
+("glColor3s", 3);
+("glColor3ub", 3);
+("glColor3ui", 3);
+("glColor3us", 3);
+("glColor4b", 4);
+("glColor4d", 4);
+("glColor4f", 4);
+("glColor4fNormal3fVertex3fSUN", 10);
+("glColor4hNV", 4);
+("glColor4i", 4);
+("glColor4s", 4);
+("glColor4ub", 4);
+("glColor4ubVertex2fSUN", 6);
+("glColor4ubVertex3fSUN", 7);
+("glColor4ui", 4);
+("glColor4us", 4);
+("glColorFragmentOp1ATI", 7);
+("glColorFragmentOp2ATI", 10);
+("glColorFragmentOp3ATI", 13);
+("glColorMask", 4);
+("glColorMaskIndexedEXT", 5);
+("glColorMaterial", 2);
+("glCombinerInputNV", 6);
+("glCombinerOutputNV", 10);
+("glCombinerParameterfNV", 2);
+("glCombinerParameteriNV", 2);
+("glCompileShader", 1);
+("glCompileShaderARB", 1);
+("glConvolutionParameterf", 3);
+("glConvolutionParameterfEXT", 3);
+("glConvolutionParameteri", 3);
+("glConvolutionParameteriEXT", 3);
+("glCopyBufferSubData", 5);
+("glCopyColorSubTable", 5);
+("glCopyColorSubTableEXT", 5);
+("glCopyColorTable", 5);
+("glCopyColorTableSGI", 5);
+("glCopyConvolutionFilter1D", 5);
+("glCopyConvolutionFilter1DEXT", 5);
+("glCopyConvolutionFilter2D", 6);
+("glCopyConvolutionFilter2DEXT", 6);
+("glCopyPixels", 5);
+("glCopyTexImage1D", 7);
+("glCopyTexImage1DEXT", 7);
+("glCopyTexImage2D", 8);
+("glCopyTexImage2DEXT", 8);
+("glCopyTexSubImage1D", 6);
+("glCopyTexSubImage1DEXT", 6);
+("glCopyTexSubImage2D", 8);
+("glCopyTexSubImage2DEXT", 8);
+("glCopyTexSubImage3D", 9);
+("glCopyTexSubImage3DEXT", 9);
+("glCullFace", 1);
+("glCurrentPaletteMatrixARB", 1);
+("glDeleteAsyncMarkersSGIX", 2);
+("glDeleteFragmentShaderATI", 1);
+("glDeleteLists", 2);
+("glDeleteObjectARB", 1);
+("glDeleteProgram", 1);
+("glDeleteShader", 1);
+("glDeleteVertexShaderEXT", 1);
+("glDepthBoundsEXT", 2);
+("glDepthBoundsdNV", 2);
+("glDepthFunc", 1);
+("glDepthMask", 1);
+("glDepthRange", 2);
+("glDepthRangedNV", 2);
+("glDepthRangefOES", 2);
+("glDetachObjectARB", 2);
+("glDetachShader", 2);
+("glDisable", 1);
+("glDisableClientState", 1);
+("glDisableIndexedEXT", 2);
+("glDisableVariantClientStateEXT", 1);
+("glDisableVertexAttribArray", 1);
+("glDisableVertexAttribArrayARB", 1);
+("glDrawArrays", 3);
+("glDrawArraysEXT", 3);
+("glDrawArraysIndirect", 2);
+("glDrawArraysInstanced", 4);
+("glDrawArraysInstancedBaseInstance", 5);
+("glDrawArraysInstancedEXT", 4);
+("glDrawBuffer", 1);
+("glDrawElementArrayAPPLE", 3);
+("glDrawElementArrayATI", 2);
+("glDrawElementsIndirect", 3);
+("glDrawRangeElementArrayAPPLE", 5);
+("glDrawRangeElementArrayATI", 4);
+("glEdgeFlag", 1);
+("glEnable", 1);
+("glEnableClientState", 1);
+("glEnableIndexedEXT", 2);
+("glEnableVariantClientStateEXT", 1);
+("glEnableVertexAttribArray", 1);
+("glEnableVertexAttribArrayARB", 1);
+("glEnd", 0);
+("glEndFragmentShaderATI", 0);
+("glEndList", 0);
+("glEndOcclusionQueryNV", 0);
+("glEndQuery", 1);
+("glEndQueryARB", 1);
+("glEndSceneEXT", 0);
+("glEndTransformFeedbackNV", 0);
+("glEndVertexShaderEXT", 0);
+("glEvalCoord1d", 1);
+("glEvalCoord1f", 1);
+("glEvalCoord2d", 2);
+("glEvalCoord2f", 2);
+("glEvalMapsNV", 2);
+("glEvalMesh1", 3);
+("glEvalMesh2", 5);
+("glEvalPoint1", 1);
+("glEvalPoint2", 2);
+("glExtractComponentEXT", 3);
+("glFinalCombinerInputNV", 4);
+("glFinish", 0);
+("glFinishFenceAPPLE", 1);
+("glFinishFenceNV", 1);
+("glFinishObjectAPPLE", 2);
+("glFinishTextureSUNX", 0);
+("glFlush", 0);
+("glFlushMappedBufferRange", 3);
+("glFlushPixelDataRangeNV", 1);
+("glFlushRasterSGIX", 0);
+("glFlushVertexArrayRangeNV", 0);
+("glFogCoordd", 1);
+("glFogCoorddEXT", 1);
+("glFogCoordf", 1);
+("glFogCoordfEXT", 1);
+("glFogCoordhNV", 1);
+("glFogf", 2);
+("glFogi", 2);
+("glFragmentColorMaterialEXT", 2);
+("glFragmentColorMaterialSGIX", 2);
+("glFragmentLightModelfEXT", 2);
+("glFragmentLightModelfSGIX", 2);
+("glFragmentLightModeliEXT", 2);
+("glFragmentLightModeliSGIX", 2);
+("glFragmentLightfEXT", 3);
+("glFragmentLightfSGIX", 3);
+("glFragmentLightiEXT", 3);
+("glFragmentLightiSGIX", 3);
+("glFragmentMaterialfEXT", 3);
+("glFragmentMaterialfSGIX", 3);
+("glFragmentMaterialiEXT", 3);
+("glFragmentMaterialiSGIX", 3);
+("glFrameZoomSGIX", 1);
+("glFramebufferRenderbuffer", 4);
+("glFramebufferRenderbufferEXT", 4);
+("glFramebufferTexture1DEXT", 5);
+("glFramebufferTexture2D", 5);
+("glFramebufferTexture2DEXT", 5);
+("glFramebufferTexture3DEXT", 6);
+("glFramebufferTextureEXT", 4);
+("glFramebufferTextureFaceEXT", 5);
+("glFramebufferTextureLayerEXT", 5);
+("glFreeObjectBufferATI", 1);
+("glFrontFace", 1);
+("glFrustum", 6);
+("glFrustumfOES", 6);
+("glGenerateMipmap", 1);
+("glGenerateMipmapEXT", 1);
+("glGlobalAlphaFactorbSUN", 1);
+("glGlobalAlphaFactordSUN", 1);
+("glGlobalAlphaFactorfSUN", 1);
+("glGlobalAlphaFactoriSUN", 1);
+("glGlobalAlphaFactorsSUN", 1);
+("glGlobalAlphaFactorubSUN", 1);
+("glGlobalAlphaFactoruiSUN", 1);
+("glGlobalAlphaFactorusSUN", 1);
+("glHint", 2);
+("glHistogram", 4);
+("glHistogramEXT", 4);
+("glImageTransformParameterfHP", 3);
+("glImageTransformParameteriHP", 3);
+("glIndexFuncEXT", 2);
+("glIndexMask", 1);
+("glIndexMaterialEXT", 2);
+("glIndexd", 1);
+("glIndexf", 1);
+("glIndexi", 1);
+("glIndexs", 1);
+("glIndexub", 1);
+("glInitNames", 0);
+("glInsertComponentEXT", 3);
+("glLightEnviEXT", 2);
+("glLightModelf", 2);
+("glLightModeli", 2);
+("glLightf", 3);
+("glLighti", 3);
+("glLineStipple", 2);
+("glLineWidth", 1);
+("glLinkProgram", 1);
+("glLinkProgramARB", 1);
+("glListBase", 1);
+("glLoadIdentity", 0);
+("glLoadName", 1);
+("glLockArraysEXT", 2);
+("glLogicOp", 1);
+("glMapGrid1d", 3);
+("glMapGrid1f", 3);
+("glMapGrid2d", 6);
+("glMapGrid2f", 6);
+("glMaterialf", 3);
+("glMateriali", 3);
+("glMatrixMode", 1);
+("glMaxShaderCompilerThreadsARB", 1);
+("glMaxShaderCompilerThreadsKHR", 1);
+("glMinmax", 3);
+("glMinmaxEXT", 3);
+("glMultiDrawArraysIndirect", 4);
+("glMultiDrawElementsIndirect", 5);
+("glMultiTexCoord1d", 2);
+("glMultiTexCoord1dARB", 2);
+("glMultiTexCoord1f", 2);
+("glMultiTexCoord1fARB", 2);
+("glMultiTexCoord1hNV", 2);
+("glMultiTexCoord1i", 2);
+("glMultiTexCoord1iARB", 2);
+("glMultiTexCoord1s", 2);
+("glMultiTexCoord1sARB", 2);
+("glMultiTexCoord2d", 3);
+("glMultiTexCoord2dARB", 3);
+("glMultiTexCoord2f", 3);
+("glMultiTexCoord2fARB", 3);
+("glMultiTexCoord2hNV", 3);
+("glMultiTexCoord2i", 3);
+("glMultiTexCoord2iARB", 3);
+("glMultiTexCoord2s", 3);
+("glMultiTexCoord2sARB", 3);
+("glMultiTexCoord3d", 4);
+("glMultiTexCoord3dARB", 4);
+("glMultiTexCoord3f", 4);
+("glMultiTexCoord3fARB", 4);
+("glMultiTexCoord3hNV", 4);
+("glMultiTexCoord3i", 4);
+("glMultiTexCoord3iARB", 4);
+("glMultiTexCoord3s", 4);
+("glMultiTexCoord3sARB", 4);
+("glMultiTexCoord4d", 5);
+("glMultiTexCoord4dARB", 5);
+("glMultiTexCoord4f", 5);
+("glMultiTexCoord4fARB", 5);
+("glMultiTexCoord4hNV", 5);
+("glMultiTexCoord4i", 5);
+("glMultiTexCoord4iARB", 5);
+("glMultiTexCoord4s", 5);
+("glMultiTexCoord4sARB", 5);
+("glNewList", 2);
+("glNormal3b", 3);
+("glNormal3d", 3);
+("glNormal3f", 3);
+("glNormal3fVertex3fSUN", 6);
+("glNormal3hNV", 3);
+("glNormal3i", 3);
+("glNormal3s", 3);
+("glNormalStream3bATI", 4);
+("glNormalStream3dATI", 4);
+("glNormalStream3fATI", 4);
+("glNormalStream3iATI", 4);
+("glNormalStream3sATI", 4);
+("glOrtho", 6);
+("glOrthofOES", 6);
+("glPNTrianglesfATI", 2);
+("glPNTrianglesiATI", 2);
+("glPassTexCoordATI", 3);
+("glPassThrough", 1);
+("glPixelStoref", 2);
+("glPixelStorei", 2);
+("glPixelTexGenSGIX", 1);
+("glPixelTransferf", 2);
+("glPixelTransferi", 2);
+("glPixelTransformParameterfEXT", 3);
+("glPixelTransformParameteriEXT", 3);
+("glPixelZoom", 2);
+("glPointParameterf", 2);
+("glPointParameterfARB", 2);
+("glPointParameterfEXT", 2);
+("glPointParameteriNV", 2);
+("glPointSize", 1);
+("glPolygonMode", 2);
+("glPolygonOffset", 2);
+("glPolygonOffsetEXT", 2);
+("glPopAttrib", 0);
+("glPopClientAttrib", 0);
+("glPopMatrix", 0);
+("glPopName", 0);
+("glPrimitiveRestartIndex", 1);
+("glPrimitiveRestartIndexNV", 1);
+("glPrimitiveRestartNV", 0);
+("glProgramEnvParameter4dARB", 6);
+("glProgramEnvParameter4fARB", 6);
+("glProgramEnvParameterI4iNV", 6);
+("glProgramEnvParameterI4uiNV", 6);
+("glProgramLocalParameter4dARB", 6);
+("glProgramLocalParameter4fARB", 6);
+("glProgramLocalParameterI4iNV", 6);
+("glProgramLocalParameterI4uiNV", 6);
+("glProgramParameter4dNV", 6);
+("glProgramParameter4fNV", 6);
+("glProgramParameteri", 3);
+("glProgramParameteriEXT", 3);
+("glProgramVertexLimitNV", 2);
+("glPushAttrib", 1);
+("glPushClientAttrib", 1);
+("glPushMatrix", 0);
+("glPushName", 1);
+("glQueryCounter", 2);
+("glRasterPos2d", 2);
+("glRasterPos2f", 2);
+("glRasterPos2i", 2);
+("glRasterPos2s", 2);
+("glRasterPos3d", 3);
+("glRasterPos3f", 3);
+("glRasterPos3i", 3);
+("glRasterPos3s", 3);
+("glRasterPos4d", 4);
+("glRasterPos4f", 4);
+("glRasterPos4i", 4);
+("glRasterPos4s", 4);
+("glReadBuffer", 1);
+("glRectd", 4);
+("glRectf", 4);
+("glRecti", 4);
+("glRects", 4);
+("glRenderbufferStorage", 4);
+("glRenderbufferStorageEXT", 4);
+("glRenderbufferStorageMultisample", 5);
+("glRenderbufferStorageMultisampleCoverageNV", 6);
+("glRenderbufferStorageMultisampleEXT", 5);
+("glReplacementCodeubSUN", 1);
+("glReplacementCodeuiColor3fVertex3fSUN", 7);
+("glReplacementCodeuiColor4fNormal3fVertex3fSUN", 11);
+("glReplacementCodeuiColor4ubVertex3fSUN", 8);
+("glReplacementCodeuiNormal3fVertex3fSUN", 7);
+("glReplacementCodeuiSUN", 1);
+("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN", 13);
+("glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN", 9);
+("glReplacementCodeuiTexCoord2fVertex3fSUN", 6);
+("glReplacementCodeuiVertex3fSUN", 4);
+("glReplacementCodeusSUN", 1);
+("glResetHistogram", 1);
+("glResetHistogramEXT", 1);
+("glResetMinmax", 1);
+("glResetMinmaxEXT", 1);
+("glResizeBuffersMESA", 0);
+("glRotated", 4);
+("glRotatef", 4);
+("glSampleCoverage", 2);
+("glSampleCoverageARB", 2);
+("glSampleMapATI", 3);
+("glSampleMaskEXT", 2);
+("glSampleMaskSGIS", 2);
+("glSamplePatternEXT", 1);
+("glSamplePatternSGIS", 1);
+("glSamplerParameterf", 3);
+("glSamplerParameteri", 3);
+("glScaled", 3);
+("glScalef", 3);
+("glScissor", 4);
+("glSecondaryColor3b", 3);
+("glSecondaryColor3bEXT", 3);
+("glSecondaryColor3d", 3);
+("glSecondaryColor3dEXT", 3);
+("glSecondaryColor3f", 3);
+("glSecondaryColor3fEXT", 3);
+("glSecondaryColor3hNV", 3);
+("glSecondaryColor3i", 3);
+("glSecondaryColor3iEXT", 3);
+("glSecondaryColor3s", 3);
+("glSecondaryColor3sEXT", 3);
+("glSecondaryColor3ub", 3);
+("glSecondaryColor3ubEXT", 3);
+("glSecondaryColor3ui", 3);
+("glSecondaryColor3uiEXT", 3);
+("glSecondaryColor3us", 3);
+("glSecondaryColor3usEXT", 3);
+("glSetFenceAPPLE", 1);
+("glSetFenceNV", 2);
+("glShadeModel", 1);
+("glShaderOp1EXT", 3);
+("glShaderOp2EXT", 4);
+("glShaderOp3EXT", 5);
+("glSpriteParameterfSGIX", 2);
+("glSpriteParameteriSGIX", 2);
+("glStencilFunc", 3);
+("glStencilFuncSeparate", 4);
+("glStencilFuncSeparateATI", 4);
+("glStencilMask", 1);
+("glStencilMaskSeparate", 2);
+("glStencilOp", 3);
+("glStencilOpSeparate", 4);
+("glStencilOpSeparateATI", 4);
+("glSwizzleEXT", 6);
+("glTagSampleBufferSGIX", 0);
+("glTbufferMask3DFX", 1);
+("glTexBuffer", 3);
+("glTexBufferEXT", 3);
+("glTexCoord1d", 1);
+("glTexCoord1f", 1);
+("glTexCoord1hNV", 1);
+("glTexCoord1i", 1);
+("glTexCoord1s", 1);
+("glTexCoord2d", 2);
+("glTexCoord2f", 2);
+("glTexCoord2fColor3fVertex3fSUN", 8);
+("glTexCoord2fColor4fNormal3fVertex3fSUN", 12);
+("glTexCoord2fColor4ubVertex3fSUN", 9);
+("glTexCoord2fNormal3fVertex3fSUN", 8);
+("glTexCoord2fVertex3fSUN", 5);
+("glTexCoord2hNV", 2);
+("glTexCoord2i", 2);
+("glTexCoord2s", 2);
+("glTexCoord3d", 3);
+("glTexCoord3f", 3);
+("glTexCoord3hNV", 3);
+("glTexCoord3i", 3);
+("glTexCoord3s", 3);
+("glTexCoord4d", 4);
+("glTexCoord4f", 4);
+("glTexCoord4fColor4fNormal3fVertex4fSUN", 15);
+("glTexCoord4fVertex4fSUN", 8);
+("glTexCoord4hNV", 4);
+("glTexCoord4i", 4);
+("glTexCoord4s", 4);
+("glTexEnvf", 3);
+("glTexEnvi", 3);
+("glTexGend", 3);
+("glTexGenf", 3);
+("glTexGeni", 3);
+("glTexParameterf", 3);
+("glTexParameteri", 3);
+("glTexScissorFuncINTEL", 3);
+("glTexScissorINTEL", 3);
+("glTexStorage2D", 5);
+("glTextureFogSGIX", 1);
+("glTextureLightEXT", 1);
+("glTextureMaterialEXT", 2);
+("glTextureNormalEXT", 1);
+("glTrackMatrixNV", 4);
+("glTranslated", 3);
+("glTranslatef", 3);
+("glUniform1f", 2);
+("glUniform1fARB", 2);
+("glUniform1i", 2);
+("glUniform1iARB", 2);
+("glUniform1uiEXT", 2);
+("glUniform2f", 3);
+("glUniform2fARB", 3);
+("glUniform2i", 3);
+("glUniform2iARB", 3);
+("glUniform2uiEXT", 3);
+("glUniform3f", 4);
+("glUniform3fARB", 4);
+("glUniform3i", 4);
+("glUniform3iARB", 4);
+("glUniform3uiEXT", 4);
+("glUniform4f", 5);
+("glUniform4fARB", 5);
+("glUniform4i", 5);
+("glUniform4iARB", 5);
+("glUniform4uiEXT", 5);
+("glUniformBlockBinding", 3);
+("glUniformBufferEXT", 3);
+("glUnlockArraysEXT", 0);
+("glUnmapObjectBufferATI", 1);
+("glUseProgram", 1);
+("glUseProgramObjectARB", 1);
+("glValidateProgram", 1);
+("glValidateProgramARB", 1);
+("glVariantArrayObjectATI", 5);
+("glVertex2d", 2);
+("glVertex2f", 2);
+("glVertex2hNV", 2);
+("glVertex2i", 2);
+("glVertex2s", 2);
+("glVertex3d", 3);
+("glVertex3f", 3);
+("glVertex3hNV", 3);
+("glVertex3i", 3);
+("glVertex3s", 3);
+("glVertex4d", 4);
+("glVertex4f", 4);
+("glVertex4hNV", 4);
+("glVertex4i", 4);
+("glVertex4s", 4);
+("glVertexArrayParameteriAPPLE", 2);
+("glVertexAttrib1d", 2);
+("glVertexAttrib1dARB", 2);
+("glVertexAttrib1dNV", 2);
+("glVertexAttrib1f", 2);
+("glVertexAttrib1fARB", 2);
+("glVertexAttrib1fNV", 2);
+("glVertexAttrib1hNV", 2);
+("glVertexAttrib1s", 2);
+("glVertexAttrib1sARB", 2);
+("glVertexAttrib1sNV", 2);
+("glVertexAttrib2d", 3);
+("glVertexAttrib2dARB", 3);
+("glVertexAttrib2dNV", 3);
+("glVertexAttrib2f", 3);
+("glVertexAttrib2fARB", 3);
+("glVertexAttrib2fNV", 3);
+("glVertexAttrib2hNV", 3);
+("glVertexAttrib2s", 3);
+("glVertexAttrib2sARB", 3);
+("glVertexAttrib2sNV", 3);
+("glVertexAttrib3d", 4);
+("glVertexAttrib3dARB", 4);
+("glVertexAttrib3dNV", 4);
+("glVertexAttrib3f", 4);
+("glVertexAttrib3fARB", 4);
+("glVertexAttrib3fNV", 4);
+("glVertexAttrib3hNV", 4);
+("glVertexAttrib3s", 4);
+("glVertexAttrib3sARB", 4);
+("glVertexAttrib3sNV", 4);
+("glVertexAttrib4Nub", 5);
+("glVertexAttrib4NubARB", 5);
+("glVertexAttrib4d", 5);
+("glVertexAttrib4dARB", 5);
+("glVertexAttrib4dNV", 5);
+("glVertexAttrib4f", 5);
+("glVertexAttrib4fARB", 5);
+("glVertexAttrib4fNV", 5);
+("glVertexAttrib4hNV", 5);
+("glVertexAttrib4s", 5);
+("glVertexAttrib4sARB", 5);
+("glVertexAttrib4sNV", 5);
+("glVertexAttrib4ubNV", 5);
+("glVertexAttribArrayObjectATI", 7);
+("glVertexAttribDivisor", 2);
+("glVertexAttribI1iEXT", 2);
+("glVertexAttribI1uiEXT", 2);
+("glVertexAttribI2iEXT", 3);
+("glVertexAttribI2uiEXT", 3);
+("glVertexAttribI3iEXT", 4);
+("glVertexAttribI3uiEXT", 4);
+("glVertexAttribI4iEXT", 5);
+("glVertexAttribI4uiEXT", 5);
+("glVertexAttribIPointer", 5);
+("glVertexAttribPointer", 6);
+("glVertexBlendARB", 1);
+("glVertexBlendEnvfATI", 2);
+("glVertexBlendEnviATI", 2);
+("glVertexStream2dATI", 3);
+("glVertexStream2fATI", 3);
+("glVertexStream2iATI", 3);
+("glVertexStream2sATI", 3);
+("glVertexStream3dATI", 4);
+("glVertexStream3fATI", 4);
+("glVertexStream3iATI", 4);
+("glVertexStream3sATI", 4);
+("glVertexStream4dATI", 5);
+("glVertexStream4fATI", 5);
+("glVertexStream4iATI", 5);
+("glVertexStream4sATI", 5);
+("glVertexWeightfEXT", 1);
+("glVertexWeighthNV", 1);
+("glViewport", 4);
+("glWindowPos2d", 2);
+("glWindowPos2dARB", 2);
+("glWindowPos2dMESA", 2);
+("glWindowPos2f", 2);
+("glWindowPos2fARB", 2);
+("glWindowPos2fMESA", 2);
+("glWindowPos2i", 2);
+("glWindowPos2iARB", 2);
+("glWindowPos2iMESA", 2);
+("glWindowPos2s", 2);
+("glWindowPos2sARB", 2);
+("glWindowPos2sMESA", 2);
+("glWindowPos3d", 3);
+("glWindowPos3dARB", 3);
+("glWindowPos3dMESA", 3);
+("glWindowPos3f", 3);
+("glWindowPos3fARB", 3);
+("glWindowPos3fMESA", 3);
+("glWindowPos3i", 3);
+("glWindowPos3iARB", 3);
+("glWindowPos3iMESA", 3);
+("glWindowPos3s", 3);
+("glWindowPos3sARB", 3);
+("glWindowPos3sMESA", 3);
+("glWindowPos4dMESA", 4);
+("glWindowPos4fMESA", 4);
+("glWindowPos4iMESA", 4);
+("glWindowPos4sMESA", 4);
+("glWriteMaskEXT", 6)
+|]
+
+let glAccum b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 0.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glActiveStencilFaceEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 1.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glActiveTexture b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 2.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glActiveTextureARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 3.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glAddSwapHintRectWIN b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 4.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glAlphaFragmentOp1ATI b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 5.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glAlphaFragmentOp2ATI b p0 p1 p2 p3 p4 p5 p6 p7 p8 =
+let o = reserve b 10 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 6.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+()
+let glAlphaFragmentOp3ATI b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 p11 =
+let o = reserve b 13 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 7.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+Bigarray.Array1.unsafe_set d (o + 10) (float_of_int p9);
+Bigarray.Array1.unsafe_set d (o + 11) (float_of_int p10);
+Bigarray.Array1.unsafe_set d (o + 12) (float_of_int p11);
+()
+let glAlphaFunc b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 8.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glApplyTextureEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 9.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glArrayElement b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 10.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glArrayElementEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 11.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glArrayObjectATI b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 12.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glAsyncMarkerSGIX b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 13.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glAttachObjectARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 14.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glAttachShader b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 15.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBegin b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 16.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBeginFragmentShaderATI b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 17.;
+()
+let glBeginOcclusionQueryNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 18.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBeginQuery b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 19.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBeginQueryARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 20.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBeginSceneEXT b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 21.;
+()
+let glBeginTransformFeedbackNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 22.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBeginVertexShaderEXT b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 23.;
+()
+let glBindBuffer b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 24.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindBufferARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 25.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindBufferBase b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 26.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glBindBufferBaseNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 27.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glBindBufferOffsetNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 28.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glBindBufferRange b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 29.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glBindBufferRangeNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 30.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glBindFragmentShaderATI b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 31.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBindFramebuffer b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 32.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindFramebufferEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 33.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindProgramARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 34.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindProgramNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 35.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindRenderbuffer b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 36.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindRenderbufferEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 37.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindSampler b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 38.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindTexture b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 39.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindTextureEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 40.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBindVertexArray b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 41.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBindVertexArrayAPPLE b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 42.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBindVertexShaderEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 43.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBlendColor b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 44.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glBlendColorEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 45.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glBlendEquation b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 46.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBlendEquationEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 47.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glBlendEquationSeparate b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 48.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBlendEquationSeparateEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 49.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBlendFunc b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 50.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glBlendFuncSeparate b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 51.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glBlendFuncSeparateEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 52.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glBlitFramebuffer b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 =
+let o = reserve b 11 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 53.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+Bigarray.Array1.unsafe_set d (o + 10) (float_of_int p9);
+()
+let glBlitFramebufferEXT b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 =
+let o = reserve b 11 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 54.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+Bigarray.Array1.unsafe_set d (o + 10) (float_of_int p9);
+()
+let glCallList b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 55.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glClampColorARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 56.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glClear b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 57.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glClearAccum b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 58.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glClearColor b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 59.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glClearColorIiEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 60.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glClearColorIuiEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 61.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glClearDepth b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 62.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glClearDepthdNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 63.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glClearDepthfOES b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 64.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glClearIndex b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 65.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glClearStencil b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 66.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glClientActiveTexture b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 67.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glClientActiveTextureARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 68.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glClientActiveVertexStreamATI b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 69.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glColor3b b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 70.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 71.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glColor3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 72.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glColor3fVertex3fSUN b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 73.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glColor3hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 74.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 75.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 76.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3ub b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 77.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3ui b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 78.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor3us b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 79.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glColor4b b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 80.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 81.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glColor4f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 82.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glColor4fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 =
+let o = reserve b 11 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 83.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+Bigarray.Array1.unsafe_set d (o + 10) p9;
+()
+let glColor4hNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 84.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 85.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 86.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4ub b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 87.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4ubVertex2fSUN b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 88.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glColor4ubVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 89.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+()
+let glColor4ui b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 90.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColor4us b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 91.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glColorFragmentOp1ATI b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 92.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+()
+let glColorFragmentOp2ATI b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 =
+let o = reserve b 11 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 93.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+Bigarray.Array1.unsafe_set d (o + 10) (float_of_int p9);
+()
+let glColorFragmentOp3ATI b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 p11 p12 =
+let o = reserve b 14 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 94.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+Bigarray.Array1.unsafe_set d (o + 10) (float_of_int p9);
+Bigarray.Array1.unsafe_set d (o + 11) (float_of_int p10);
+Bigarray.Array1.unsafe_set d (o + 12) (float_of_int p11);
+Bigarray.Array1.unsafe_set d (o + 13) (float_of_int p12);
+()
+let glColorMask b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 95.;
+Bigarray.Array1.unsafe_set d (o + 1) (if p0 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 3) (if p2 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+()
+let glColorMaskIndexedEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 96.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 3) (if p2 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 5) (if p4 then 1. else 0.);
+()
+let glColorMaterial b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 97.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glCombinerInputNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 98.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glCombinerOutputNV b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 =
+let o = reserve b 11 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 99.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (if p7 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 9) (if p8 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 10) (if p9 then 1. else 0.);
+()
+let glCombinerParameterfNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 100.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glCombinerParameteriNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 101.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glCompileShader b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 102.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glCompileShaderARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 103.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glConvolutionParameterf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 104.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glConvolutionParameterfEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 105.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glConvolutionParameteri b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 106.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glConvolutionParameteriEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 107.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glCopyBufferSubData b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 108.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyColorSubTable b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 109.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyColorSubTableEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 110.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyColorTable b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 111.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyColorTableSGI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 112.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyConvolutionFilter1D b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 113.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyConvolutionFilter1DEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 114.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyConvolutionFilter2D b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 115.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glCopyConvolutionFilter2DEXT b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 116.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glCopyPixels b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 117.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glCopyTexImage1D b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 118.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+()
+let glCopyTexImage1DEXT b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 119.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+()
+let glCopyTexImage2D b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 120.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+()
+let glCopyTexImage2DEXT b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 121.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+()
+let glCopyTexSubImage1D b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 122.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glCopyTexSubImage1DEXT b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 123.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glCopyTexSubImage2D b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 124.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+()
+let glCopyTexSubImage2DEXT b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 125.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+()
+let glCopyTexSubImage3D b p0 p1 p2 p3 p4 p5 p6 p7 p8 =
+let o = reserve b 10 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 126.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+()
+let glCopyTexSubImage3DEXT b p0 p1 p2 p3 p4 p5 p6 p7 p8 =
+let o = reserve b 10 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 127.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+Bigarray.Array1.unsafe_set d (o + 8) (float_of_int p7);
+Bigarray.Array1.unsafe_set d (o + 9) (float_of_int p8);
+()
+let glCullFace b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 128.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glCurrentPaletteMatrixARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 129.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDeleteAsyncMarkersSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 130.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDeleteFragmentShaderATI b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 131.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDeleteLists b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 132.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDeleteObjectARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 133.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDeleteProgram b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 134.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDeleteShader b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 135.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDeleteVertexShaderEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 136.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDepthBoundsEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 137.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glDepthBoundsdNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 138.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glDepthFunc b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 139.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDepthMask b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 140.;
+Bigarray.Array1.unsafe_set d (o + 1) (if p0 then 1. else 0.);
+()
+let glDepthRange b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 141.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glDepthRangedNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 142.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glDepthRangefOES b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 143.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glDetachObjectARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 144.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDetachShader b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 145.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDisable b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 146.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDisableClientState b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 147.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDisableIndexedEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 148.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDisableVariantClientStateEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 149.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDisableVertexAttribArray b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 150.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDisableVertexAttribArrayARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 151.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDrawArrays b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 152.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glDrawArraysEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 153.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glDrawArraysIndirect b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 154.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDrawArraysInstanced b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 155.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glDrawArraysInstancedBaseInstance b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 156.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glDrawArraysInstancedEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 157.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glDrawBuffer b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 158.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glDrawElementArrayAPPLE b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 159.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glDrawElementArrayATI b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 160.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glDrawElementsIndirect b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 161.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glDrawRangeElementArrayAPPLE b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 162.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glDrawRangeElementArrayATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 163.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glEdgeFlag b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 164.;
+Bigarray.Array1.unsafe_set d (o + 1) (if p0 then 1. else 0.);
+()
+let glEnable b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 165.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEnableClientState b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 166.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEnableIndexedEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 167.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glEnableVariantClientStateEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 168.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEnableVertexAttribArray b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 169.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEnableVertexAttribArrayARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 170.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEnd b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 171.;
+()
+let glEndFragmentShaderATI b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 172.;
+()
+let glEndList b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 173.;
+()
+let glEndOcclusionQueryNV b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 174.;
+()
+let glEndQuery b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 175.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEndQueryARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 176.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEndSceneEXT b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 177.;
+()
+let glEndTransformFeedbackNV b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 178.;
+()
+let glEndVertexShaderEXT b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 179.;
+()
+let glEvalCoord1d b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 180.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glEvalCoord1f b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 181.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glEvalCoord2d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 182.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glEvalCoord2f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 183.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glEvalMapsNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 184.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glEvalMesh1 b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 185.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glEvalMesh2 b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 186.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glEvalPoint1 b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 187.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glEvalPoint2 b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 188.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glExtractComponentEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 189.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFinalCombinerInputNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 190.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glFinish b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 191.;
+()
+let glFinishFenceAPPLE b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 192.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFinishFenceNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 193.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFinishObjectAPPLE b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 194.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFinishTextureSUNX b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 195.;
+()
+let glFlush b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 196.;
+()
+let glFlushMappedBufferRange b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 197.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFlushPixelDataRangeNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 198.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFlushRasterSGIX b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 199.;
+()
+let glFlushVertexArrayRangeNV b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 200.;
+()
+let glFogCoordd b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 201.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glFogCoorddEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 202.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glFogCoordf b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 203.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glFogCoordfEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 204.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glFogCoordhNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 205.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFogf b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 206.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glFogi b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 207.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFragmentColorMaterialEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 208.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFragmentColorMaterialSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 209.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFragmentLightModelfEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 210.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glFragmentLightModelfSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 211.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glFragmentLightModeliEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 212.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFragmentLightModeliSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 213.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glFragmentLightfEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 214.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glFragmentLightfSGIX b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 215.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glFragmentLightiEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 216.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFragmentLightiSGIX b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 217.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFragmentMaterialfEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 218.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glFragmentMaterialfSGIX b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 219.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glFragmentMaterialiEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 220.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFragmentMaterialiSGIX b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 221.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glFrameZoomSGIX b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 222.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFramebufferRenderbuffer b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 223.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glFramebufferRenderbufferEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 224.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glFramebufferTexture1DEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 225.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glFramebufferTexture2D b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 226.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glFramebufferTexture2DEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 227.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glFramebufferTexture3DEXT b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 228.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glFramebufferTextureEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 229.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glFramebufferTextureFaceEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 230.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glFramebufferTextureLayerEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 231.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glFreeObjectBufferATI b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 232.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFrontFace b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 233.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glFrustum b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 234.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glFrustumfOES b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 235.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glGenerateMipmap b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 236.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGenerateMipmapEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 237.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactorbSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 238.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactordSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 239.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glGlobalAlphaFactorfSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 240.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glGlobalAlphaFactoriSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 241.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactorsSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 242.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactorubSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 243.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactoruiSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 244.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glGlobalAlphaFactorusSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 245.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glHint b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 246.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glHistogram b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 247.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+()
+let glHistogramEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 248.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+()
+let glImageTransformParameterfHP b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 249.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glImageTransformParameteriHP b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 250.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glIndexFuncEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 251.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glIndexMask b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 252.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glIndexMaterialEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 253.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glIndexd b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 254.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glIndexf b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 255.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glIndexi b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 256.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glIndexs b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 257.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glIndexub b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 258.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glInitNames b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 259.;
+()
+let glInsertComponentEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 260.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glLightEnviEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 261.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glLightModelf b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 262.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glLightModeli b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 263.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glLightf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 264.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glLighti b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 265.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glLineStipple b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 266.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glLineWidth b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 267.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glLinkProgram b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 268.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glLinkProgramARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 269.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glListBase b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 270.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glLoadIdentity b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 271.;
+()
+let glLoadName b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 272.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glLockArraysEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 273.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glLogicOp b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 274.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glMapGrid1d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 275.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMapGrid1f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 276.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMapGrid2d b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 277.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glMapGrid2f b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 278.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glMaterialf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 279.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMateriali b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 280.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMatrixMode b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 281.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glMaxShaderCompilerThreadsARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 282.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glMaxShaderCompilerThreadsKHR b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 283.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glMinmax b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 284.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (if p2 then 1. else 0.);
+()
+let glMinmaxEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 285.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (if p2 then 1. else 0.);
+()
+let glMultiDrawArraysIndirect b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 286.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiDrawElementsIndirect b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 287.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glMultiTexCoord1d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 288.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glMultiTexCoord1dARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 289.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glMultiTexCoord1f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 290.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glMultiTexCoord1fARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 291.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glMultiTexCoord1hNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 292.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glMultiTexCoord1i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 293.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glMultiTexCoord1iARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 294.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glMultiTexCoord1s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 295.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glMultiTexCoord1sARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 296.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glMultiTexCoord2d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 297.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMultiTexCoord2dARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 298.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMultiTexCoord2f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 299.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMultiTexCoord2fARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 300.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glMultiTexCoord2hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 301.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMultiTexCoord2i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 302.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMultiTexCoord2iARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 303.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMultiTexCoord2s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 304.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMultiTexCoord2sARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 305.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glMultiTexCoord3d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 306.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glMultiTexCoord3dARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 307.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glMultiTexCoord3f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 308.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glMultiTexCoord3fARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 309.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glMultiTexCoord3hNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 310.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiTexCoord3i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 311.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiTexCoord3iARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 312.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiTexCoord3s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 313.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiTexCoord3sARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 314.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glMultiTexCoord4d b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 315.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glMultiTexCoord4dARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 316.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glMultiTexCoord4f b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 317.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glMultiTexCoord4fARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 318.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glMultiTexCoord4hNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 319.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glMultiTexCoord4i b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 320.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glMultiTexCoord4iARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 321.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glMultiTexCoord4s b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 322.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glMultiTexCoord4sARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 323.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glNewList b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 324.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glNormal3b b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 325.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glNormal3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 326.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glNormal3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 327.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 328.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glNormal3hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 329.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glNormal3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 330.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glNormal3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 331.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glNormalStream3bATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 332.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glNormalStream3dATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 333.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glNormalStream3fATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 334.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glNormalStream3iATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 335.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glNormalStream3sATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 336.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glOrtho b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 337.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glOrthofOES b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 338.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glPNTrianglesfATI b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 339.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPNTrianglesiATI b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 340.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPassTexCoordATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 341.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glPassThrough b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 342.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glPixelStoref b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 343.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPixelStorei b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 344.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPixelTexGenSGIX b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 345.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glPixelTransferf b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 346.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPixelTransferi b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 347.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPixelTransformParameterfEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 348.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glPixelTransformParameteriEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 349.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glPixelZoom b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 350.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPointParameterf b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 351.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPointParameterfARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 352.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPointParameterfEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 353.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPointParameteriNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 354.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPointSize b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 355.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glPolygonMode b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 356.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPolygonOffset b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 357.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPolygonOffsetEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 358.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glPopAttrib b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 359.;
+()
+let glPopClientAttrib b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 360.;
+()
+let glPopMatrix b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 361.;
+()
+let glPopName b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 362.;
+()
+let glPrimitiveRestartIndex b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 363.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glPrimitiveRestartIndexNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 364.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glPrimitiveRestartNV b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 365.;
+()
+let glProgramEnvParameter4dARB b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 366.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramEnvParameter4fARB b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 367.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramEnvParameterI4iNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 368.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glProgramEnvParameterI4uiNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 369.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glProgramLocalParameter4dARB b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 370.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramLocalParameter4fARB b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 371.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramLocalParameterI4iNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 372.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glProgramLocalParameterI4uiNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 373.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glProgramParameter4dNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 374.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramParameter4fNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 375.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glProgramParameteri b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 376.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glProgramParameteriEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 377.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glProgramVertexLimitNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 378.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glPushAttrib b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 379.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glPushClientAttrib b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 380.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glPushMatrix b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 381.;
+()
+let glPushName b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 382.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glQueryCounter b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 383.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glRasterPos2d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 384.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glRasterPos2f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 385.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glRasterPos2i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 386.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glRasterPos2s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 387.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glRasterPos3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 388.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glRasterPos3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 389.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glRasterPos3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 390.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glRasterPos3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 391.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glRasterPos4d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 392.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glRasterPos4f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 393.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glRasterPos4i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 394.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glRasterPos4s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 395.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glReadBuffer b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 396.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glRectd b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 397.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glRectf b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 398.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glRecti b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 399.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glRects b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 400.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glRenderbufferStorage b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 401.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glRenderbufferStorageEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 402.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glRenderbufferStorageMultisample b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 403.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glRenderbufferStorageMultisampleCoverageNV b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 404.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glRenderbufferStorageMultisampleEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 405.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glReplacementCodeubSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 406.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glReplacementCodeuiColor3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 407.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+()
+let glReplacementCodeuiColor4fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 =
+let o = reserve b 12 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 408.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+Bigarray.Array1.unsafe_set d (o + 10) p9;
+Bigarray.Array1.unsafe_set d (o + 11) p10;
+()
+let glReplacementCodeuiColor4ubVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 409.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+()
+let glReplacementCodeuiNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 410.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+()
+let glReplacementCodeuiSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 411.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 p11 p12 =
+let o = reserve b 14 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 412.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+Bigarray.Array1.unsafe_set d (o + 10) p9;
+Bigarray.Array1.unsafe_set d (o + 11) p10;
+Bigarray.Array1.unsafe_set d (o + 12) p11;
+Bigarray.Array1.unsafe_set d (o + 13) p12;
+()
+let glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 =
+let o = reserve b 10 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 413.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+()
+let glReplacementCodeuiTexCoord2fVertex3fSUN b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 414.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+()
+let glReplacementCodeuiVertex3fSUN b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 415.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glReplacementCodeusSUN b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 416.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glResetHistogram b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 417.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glResetHistogramEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 418.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glResetMinmax b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 419.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glResetMinmaxEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 420.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glResizeBuffersMESA b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 421.;
+()
+let glRotated b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 422.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glRotatef b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 423.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glSampleCoverage b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 424.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+()
+let glSampleCoverageARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 425.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+()
+let glSampleMapATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 426.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSampleMaskEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 427.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+()
+let glSampleMaskSGIS b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 428.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) (if p1 then 1. else 0.);
+()
+let glSamplePatternEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 429.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glSamplePatternSGIS b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 430.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glSamplerParameterf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 431.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glSamplerParameteri b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 432.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glScaled b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 433.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glScalef b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 434.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glScissor b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 435.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glSecondaryColor3b b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 436.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3bEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 437.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 438.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glSecondaryColor3dEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 439.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glSecondaryColor3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 440.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glSecondaryColor3fEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 441.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glSecondaryColor3hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 442.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 443.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3iEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 444.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 445.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3sEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 446.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3ub b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 447.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3ubEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 448.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3ui b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 449.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3uiEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 450.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3us b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 451.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSecondaryColor3usEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 452.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glSetFenceAPPLE b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 453.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glSetFenceNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 454.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glShadeModel b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 455.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glShaderOp1EXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 456.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glShaderOp2EXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 457.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glShaderOp3EXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 458.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glSpriteParameterfSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 459.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glSpriteParameteriSGIX b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 460.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glStencilFunc b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 461.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glStencilFuncSeparate b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 462.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glStencilFuncSeparateATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 463.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glStencilMask b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 464.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glStencilMaskSeparate b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 465.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glStencilOp b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 466.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glStencilOpSeparate b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 467.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glStencilOpSeparateATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 468.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glSwizzleEXT b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 469.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glTagSampleBufferSGIX b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 470.;
+()
+let glTbufferMask3DFX b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 471.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTexBuffer b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 472.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexBufferEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 473.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexCoord1d b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 474.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glTexCoord1f b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 475.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glTexCoord1hNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 476.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTexCoord1i b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 477.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTexCoord1s b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 478.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTexCoord2d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 479.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glTexCoord2f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 480.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glTexCoord2fColor3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 481.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+()
+let glTexCoord2fColor4fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 p11 =
+let o = reserve b 13 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 482.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+Bigarray.Array1.unsafe_set d (o + 10) p9;
+Bigarray.Array1.unsafe_set d (o + 11) p10;
+Bigarray.Array1.unsafe_set d (o + 12) p11;
+()
+let glTexCoord2fColor4ubVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 =
+let o = reserve b 10 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 483.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+()
+let glTexCoord2fNormal3fVertex3fSUN b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 484.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+()
+let glTexCoord2fVertex3fSUN b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 485.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glTexCoord2hNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 486.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glTexCoord2i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 487.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glTexCoord2s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 488.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glTexCoord3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 489.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexCoord3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 490.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexCoord3hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 491.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexCoord3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 492.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexCoord3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 493.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexCoord4d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 494.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glTexCoord4f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 495.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glTexCoord4fColor4fNormal3fVertex4fSUN b p0 p1 p2 p3 p4 p5 p6 p7 p8 p9 p10 p11 p12 p13 p14 =
+let o = reserve b 16 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 496.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+Bigarray.Array1.unsafe_set d (o + 9) p8;
+Bigarray.Array1.unsafe_set d (o + 10) p9;
+Bigarray.Array1.unsafe_set d (o + 11) p10;
+Bigarray.Array1.unsafe_set d (o + 12) p11;
+Bigarray.Array1.unsafe_set d (o + 13) p12;
+Bigarray.Array1.unsafe_set d (o + 14) p13;
+Bigarray.Array1.unsafe_set d (o + 15) p14;
+()
+let glTexCoord4fVertex4fSUN b p0 p1 p2 p3 p4 p5 p6 p7 =
+let o = reserve b 9 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 497.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+Bigarray.Array1.unsafe_set d (o + 6) p5;
+Bigarray.Array1.unsafe_set d (o + 7) p6;
+Bigarray.Array1.unsafe_set d (o + 8) p7;
+()
+let glTexCoord4hNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 498.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glTexCoord4i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 499.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glTexCoord4s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 500.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glTexEnvf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 501.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexEnvi b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 502.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexGend b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 503.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexGenf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 504.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexGeni b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 505.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexParameterf b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 506.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexParameteri b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 507.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexScissorFuncINTEL b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 508.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glTexScissorINTEL b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 509.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTexStorage2D b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 510.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glTextureFogSGIX b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 511.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTextureLightEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 512.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTextureMaterialEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 513.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glTextureNormalEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 514.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glTrackMatrixNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 515.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glTranslated b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 516.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glTranslatef b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 517.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glUniform1f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 518.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glUniform1fARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 519.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glUniform1i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 520.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glUniform1iARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 521.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glUniform1uiEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 522.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glUniform2f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 523.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glUniform2fARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 524.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glUniform2i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 525.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glUniform2iARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 526.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glUniform2uiEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 527.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glUniform3f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 528.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glUniform3fARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 529.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glUniform3i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 530.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glUniform3iARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 531.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glUniform3uiEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 532.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glUniform4f b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 533.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glUniform4fARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 534.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glUniform4i b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 535.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glUniform4iARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 536.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glUniform4uiEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 537.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glUniformBlockBinding b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 538.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glUniformBufferEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 539.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glUnlockArraysEXT b =
+let o = reserve b 1 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 540.;
+()
+let glUnmapObjectBufferATI b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 541.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glUseProgram b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 542.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glUseProgramObjectARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 543.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glValidateProgram b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 544.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glValidateProgramARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 545.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glVariantArrayObjectATI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 546.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertex2d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 547.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertex2f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 548.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertex2hNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 549.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertex2i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 550.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertex2s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 551.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertex3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 552.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertex3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 553.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertex3hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 554.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertex3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 555.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertex3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 556.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertex4d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 557.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertex4f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 558.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertex4hNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 559.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertex4i b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 560.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertex4s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 561.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexArrayParameteriAPPLE b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 562.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttrib1d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 563.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1dARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 564.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1dNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 565.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 566.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1fARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 567.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1fNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 568.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexAttrib1hNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 569.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttrib1s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 570.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttrib1sARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 571.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttrib1sNV b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 572.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttrib2d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 573.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2dARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 574.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2dNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 575.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 576.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2fARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 577.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2fNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 578.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexAttrib2hNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 579.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttrib2s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 580.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttrib2sARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 581.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttrib2sNV b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 582.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttrib3d b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 583.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3dARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 584.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3dNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 585.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3f b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 586.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3fARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 587.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3fNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 588.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexAttrib3hNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 589.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttrib3s b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 590.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttrib3sARB b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 591.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttrib3sNV b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 592.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttrib4Nub b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 593.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4NubARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 594.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4d b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 595.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4dARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 596.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4dNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 597.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4f b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 598.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4fARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 599.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4fNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 600.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexAttrib4hNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 601.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4s b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 602.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4sARB b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 603.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4sNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 604.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttrib4ubNV b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 605.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttribArrayObjectATI b p0 p1 p2 p3 p4 p5 p6 =
+let o = reserve b 8 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 606.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+Bigarray.Array1.unsafe_set d (o + 7) (float_of_int p6);
+()
+let glVertexAttribDivisor b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 607.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttribI1iEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 608.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttribI1uiEXT b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 609.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexAttribI2iEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 610.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttribI2uiEXT b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 611.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexAttribI3iEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 612.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttribI3uiEXT b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 613.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexAttribI4iEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 614.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttribI4uiEXT b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 615.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttribIPointer b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 616.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexAttribPointer b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 617.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (if p3 then 1. else 0.);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+let glVertexBlendARB b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 618.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glVertexBlendEnvfATI b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 619.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glVertexBlendEnviATI b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 620.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glVertexStream2dATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 621.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexStream2fATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 622.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glVertexStream2iATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 623.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexStream2sATI b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 624.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glVertexStream3dATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 625.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexStream3fATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 626.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glVertexStream3iATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 627.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexStream3sATI b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 628.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glVertexStream4dATI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 629.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexStream4fATI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 630.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+Bigarray.Array1.unsafe_set d (o + 5) p4;
+()
+let glVertexStream4iATI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 631.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexStream4sATI b p0 p1 p2 p3 p4 =
+let o = reserve b 6 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 632.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+()
+let glVertexWeightfEXT b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 633.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+()
+let glVertexWeighthNV b p0 =
+let o = reserve b 2 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 634.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+()
+let glViewport b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 635.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glWindowPos2d b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 636.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2dARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 637.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2dMESA b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 638.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2f b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 639.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2fARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 640.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2fMESA b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 641.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+()
+let glWindowPos2i b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 642.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos2iARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 643.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos2iMESA b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 644.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos2s b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 645.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos2sARB b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 646.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos2sMESA b p0 p1 =
+let o = reserve b 3 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 647.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+()
+let glWindowPos3d b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 648.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3dARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 649.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3dMESA b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 650.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3f b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 651.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3fARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 652.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3fMESA b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 653.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+()
+let glWindowPos3i b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 654.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos3iARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 655.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos3iMESA b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 656.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos3s b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 657.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos3sARB b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 658.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos3sMESA b p0 p1 p2 =
+let o = reserve b 4 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 659.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+()
+let glWindowPos4dMESA b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 660.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glWindowPos4fMESA b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 661.;
+Bigarray.Array1.unsafe_set d (o + 1) p0;
+Bigarray.Array1.unsafe_set d (o + 2) p1;
+Bigarray.Array1.unsafe_set d (o + 3) p2;
+Bigarray.Array1.unsafe_set d (o + 4) p3;
+()
+let glWindowPos4iMESA b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 662.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glWindowPos4sMESA b p0 p1 p2 p3 =
+let o = reserve b 5 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 663.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+()
+let glWriteMaskEXT b p0 p1 p2 p3 p4 p5 =
+let o = reserve b 7 in
+let d = b.data in
+Bigarray.Array1.unsafe_set d o 664.;
+Bigarray.Array1.unsafe_set d (o + 1) (float_of_int p0);
+Bigarray.Array1.unsafe_set d (o + 2) (float_of_int p1);
+Bigarray.Array1.unsafe_set d (o + 3) (float_of_int p2);
+Bigarray.Array1.unsafe_set d (o + 4) (float_of_int p3);
+Bigarray.Array1.unsafe_set d (o + 5) (float_of_int p4);
+Bigarray.Array1.unsafe_set d (o + 6) (float_of_int p5);
+()
+end
+
+(* Helpers built on the bindings above, shared by the modules below *)
+
+(** Seconds elapsed on a monotonic clock, from an unspecified origin *)
+external monotonic_clock : unit -> float = "glstub_monotonic_clock"
+
+(** Major version of the OpenGL context, from [glGetString gl_version]; 0 if it can not be read *)
+let gl_major_version () =
+	let v = glGetString gl_version in
+	let rec digits i n =
+		if i < String.length v && v.[i] >= '0' && v.[i] <= '9' then digits (i + 1) (10 * n + Char.code v.[i] - 48) else n
+	in
+	digits 0 0
+
+(** Test whether the current context advertises an extension. OpenGL 3 and later contexts are asked for each
+	extension with [glGetStringi], since core profiles do not return the list through [glGetString]. *)
+let has_extension name =
+	if gl_major_version () >= 3 then begin
+		let n = [| 0 |] in
+		glGetIntegerv gl_num_extensions n;
+		let rec find i = i < n.(0) && (glGetStringi gl_extensions i = name || find (i + 1)) in
+		find 0
+	end else begin
+		let exts = glGetString gl_extensions in
+		let n = String.length name and l = String.length exts in
+		let rec at i =
+			(i + n <= l) &&
+			(((i = 0 || exts.[i - 1] = ' ') && String.sub exts i n = name && (i + n = l || exts.[i + n] = ' ')) || at (i + 1))
+		in
+		at 0
+	end
+
+(** [status get o pname] tests a boolean parameter of a shader or program, e.g.
+	[status glGetShaderiv s gl_compile_status] *)
+let status get o pname =
+	let a = [| 0 |] in
+	get o pname a;
+	a.(0) <> 0
+
+(** [info_log get get_log o] is the info log of a shader or program, e.g.
+	[info_log glGetProgramiv glGetProgramInfoLog p] *)
+let info_log get get_log o =
+	let n = [| 0 |] in
+	get o gl_info_log_length n;
+	let len = [| 0 |] and s = String.make (max n.(0) 1) ' ' in
+	get_log o (String.length s) len s;
+	String.sub s 0 len.(0)
+
+module Cached = struct
+
+(** Cached state changes.
+	The functions below have the names and arguments of the GL functions they replace, but skip
+	the call when the value it sets is already current, e.g. binding the texture that is already bound.
+	The known values are kept in a [state], one per OpenGL context: use [make_current] when switching
+	contexts. Everything starts out unknown, so the first call always reaches OpenGL.
+	Only changes made through this module are seen: call [invalidate] after changing the same state
+	through the plain bindings or any other library. *)
+type state = {
+	mutable active_texture : int;
+	mutable program : int;
+	mutable vertex_array : int;
+	mutable blend_src : int;
+	mutable blend_dst : int;
+	textures : (int, int) Hashtbl.t;
+	buffers : (int, int) Hashtbl.t;
+	capabilities : (int, int) Hashtbl.t;
+	mutable issued : int;
+	mutable elided : int
+}
+
+(** Create a state with everything unknown *)
+let create () = {
+	active_texture = -1;
+	program = -1;
+	vertex_array = -1;
+	blend_src = -1;
+	blend_dst = -1;
+	textures = Hashtbl.create 16;
+	buffers = Hashtbl.create 8;
+	capabilities = Hashtbl.create 16;
+	issued = 0;
+	elided = 0
+}
+
+let current = ref (create ())
+
+(** Use state s for the calls that follow; s should belong to the current OpenGL context *)
+let make_current s = current := s
+
+(** The state in use *)
+let get_current () = !current
+
+(** Forget everything known about the current context *)
+let invalidate () =
+	let s = !current in
+	s.active_texture <- -1;
+	s.program <- -1;
+	s.vertex_array <- -1;
+	s.blend_src <- -1;
+	s.blend_dst <- -1;
+	Hashtbl.clear s.textures;
+	Hashtbl.clear s.buffers;
+	Hashtbl.clear s.capabilities
+
+(** Number of calls passed on to OpenGL and number of calls dropped, for the current state *)
+let issued () = (!current).issued
+let elided () = (!current).elided
+let reset_counters () =
+	(!current).issued <- 0;
+	(!current).elided <- 0
+
+let find h k = try Hashtbl.find h k with Not_found -> -1
+
+(* Run f unless the known value is already v, then remember v *)
+let change s known v set f =
+	if (known : int) = v then
+		s.elided <- s.elided + 1
+	else begin
+		s.issued <- s.issued + 1;
+		set v;
+		f ()
+	end
+
+(* The active texture unit, asked of OpenGL while it is unknown *)
+let active_unit s =
+	if s.active_texture < 0 then begin
+		let a = [| 0 |] in
+		glGetIntegerv gl_active_texture a;
+		s.active_texture <- a.(0)
+	end;
+	s.active_texture
+
+(* Texture bindings and texture enables belong to the active texture unit *)
+let unit_key s k = ((active_unit s) lsl 16) lor k
+
+let is_texture_capability c =
+	c = gl_texture_1d || c = gl_texture_2d || c = gl_texture_3d || c = gl_texture_cube_map ||
+	c = gl_texture_rectangle_arb || (c >= gl_texture_gen_s && c <= gl_texture_gen_q)
+
+let capability_key s c = if is_texture_capability c then unit_key s c else c
+
+(* Reset the bindings in h that refer to one of the deleted names to 0 *)
+let unbind h names =
+	let keys = Hashtbl.fold (fun k v l -> if Array.mem v names then k :: l else l) h [] in
+	List.iter (fun k -> Hashtbl.replace h k 0) keys
+
+let glActiveTexture t =
+	let s = !current in
+	change s s.active_texture t (fun v -> s.active_texture <- v) (fun () -> glActiveTexture t)
+
+let glBindTexture target tex =
+	let s = !current in
+	let k = unit_key s target in
+	change s (find s.textures k) tex (Hashtbl.replace s.textures k) (fun () -> glBindTexture target tex)
+
+let glBindBuffer target buf =
+	let s = !current in
+	change s (find s.buffers target) buf (Hashtbl.replace s.buffers target) (fun () -> glBindBuffer target buf)
+
+let glBindVertexArray a =
+	let s = !current in
+	change s s.vertex_array a
+		(fun v -> s.vertex_array <- v; Hashtbl.remove s.buffers gl_element_array_buffer)
+		(fun () -> glBindVertexArray a)
+
+let glUseProgram p =
+	let s = !current in
+	change s s.program p (fun v -> s.program <- v) (fun () -> glUseProgram p)
+
+let set_capability c b f =
+	let s = !current in
+	let k = capability_key s c in
+	change s (find s.capabilities k) b (Hashtbl.replace s.capabilities k) (fun () -> f c)
+
+let glEnable c = set_capability c 1 glEnable
+let glDisable c = set_capability c 0 glDisable
+
+let glBlendFunc src dst =
+	let s = !current in
+	change s (if s.blend_src = src then s.blend_dst else -1) dst
+		(fun v -> s.blend_src <- src; s.blend_dst <- v)
+		(fun () -> glBlendFunc src dst)
+
+let glBlendFuncSeparate srgb drgb salpha dalpha =
+	let s = !current in
+	s.issued <- s.issued + 1;
+	s.blend_src <- -1;
+	s.blend_dst <- -1;
+	glBlendFuncSeparate srgb drgb salpha dalpha
+
+(** Deleting bound objects reverts their bindings to 0 *)
+let glDeleteTextures n names =
+	glDeleteTextures n names;
+	unbind (!current).textures (Array.sub names 0 n)
+
+let glDeleteBuffers n names =
+	glDeleteBuffers n names;
+	unbind (!current).buffers (Array.sub names 0 n)
+
+let glDeleteVertexArrays n names =
+	glDeleteVertexArrays n names;
+	let s = !current in
+	if Array.mem s.vertex_array (Array.sub names 0 n) then begin
+		s.vertex_array <- 0;
+		Hashtbl.remove s.buffers gl_element_array_buffer
+	end
+
+(** A deleted program may stay in use until another one is, and its name be given to a new program, so the
+	program in use becomes unknown *)
+let glDeleteProgram p =
+	glDeleteProgram p;
+	let s = !current in
+	if s.program = p then s.program <- -1
+
+(** Popping attributes restores state behind the cache's back *)
+let glPopAttrib () =
+	invalidate ();
+	glPopAttrib ()
+
+let glPopClientAttrib () =
+	invalidate ();
+	glPopClientAttrib ()
+
+end
+
+module Mapped = struct
+
+(** Mapped buffer objects.
+	[glMapBuffer target access kind] maps the buffer bound to target and returns a Bigarray of the given kind
+	that aliases the mapping: [Mapped.glMapBuffer gl_array_buffer gl_write_only Bigarray.float32] is a
+	[float_array] covering the whole buffer, and values stored in it go straight into the buffer, without the
+	intermediate copy of [glBufferData]. [glMapBufferRange] maps part of a buffer (offset and length in bytes).
+	A view is valid until the buffer is unmapped with [glUnmapBuffer] from this module, which shrinks every view
+	of that buffer to length 0 so that further accesses raise [Invalid_argument] instead of touching unmapped memory.
+	Views are tracked per buffer object, found through the binding of the target; for a target whose binding is
+	not known here, they are tracked per target. Sub-arrays of a view are not tracked and must not be used after
+	unmapping, nor may [unsafe_get]/[unsafe_set]. *)
+external map_buffer : int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_map_buffer"
+external map_buffer_range : int -> int -> int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_map_buffer_range"
+external unmap_view : ('a, 'b, 'c) Bigarray.Array1.t -> unit = "glstub_unmap_view"
+
+(* Invalidation functions of the views of every mapped buffer, by buffer name (or minus the target) *)
+let views : (int, unit -> unit) Hashtbl.t = Hashtbl.create 4
+
+(* Buffer targets and the parameters that query their bindings *)
+let bindings = [
+	(gl_array_buffer, gl_array_buffer_binding);
+	(gl_element_array_buffer, gl_element_array_buffer_binding);
+	(gl_pixel_pack_buffer, gl_pixel_pack_buffer_binding);
+	(gl_pixel_unpack_buffer, gl_pixel_unpack_buffer_binding);
+	(gl_copy_read_buffer, gl_copy_read_buffer);
+	(gl_copy_write_buffer, gl_copy_write_buffer);
+	(gl_texture_buffer, gl_texture_buffer);
+	(gl_transform_feedback_buffer_nv, gl_transform_feedback_buffer_binding_nv);
+	(gl_draw_indirect_buffer, gl_draw_indirect_buffer_binding);
+	(gl_uniform_buffer, gl_uniform_buffer_binding);
+	(gl_shader_storage_buffer, gl_shader_storage_buffer_binding);
+	(gl_atomic_counter_buffer, gl_atomic_counter_buffer_binding);
+	(gl_dispatch_indirect_buffer, gl_dispatch_indirect_buffer_binding);
+	(gl_query_buffer, gl_query_buffer_binding)
+]
+
+let buffer target =
+	match (try Some (List.assoc target bindings) with Not_found -> None) with
+	| Some pname ->
+		let a = [| 0 |] in
+		glGetIntegerv pname a;
+		a.(0)
+	| None -> - target
+
+let track target a =
+	Hashtbl.add views (buffer target) (fun () -> unmap_view a);
+	a
+
+let glMapBuffer target access kind = track target (map_buffer target access kind)
+let glMapBufferRange target offset length access kind = track target (map_buffer_range target offset length access kind)
+
+(** Unmap the buffer bound to target and invalidate its views *)
+let glUnmapBuffer target =
+	let b = buffer target in
+	List.iter (fun f -> f ()) (Hashtbl.find_all views b);
+	while Hashtbl.mem views b do Hashtbl.remove views b done;
+	glUnmapBuffer target
+
+end
+
+module Arena = struct
+
+(** Client array arenas.
+	The arrays given to [glVertexPointer] and the other gl*Pointer functions are read by OpenGL when drawing,
+	after the call has returned, so they must neither move nor be freed in between. An arena hands out
+	Bigarray slices of memory allocated outside the Ocaml heap: [alloc a Bigarray.float32 n] returns a
+	[float_array] of n elements, aligned on 16 bytes, which can be filled and passed to the gl*Pointer functions.
+	[reset] recycles all slices at once, typically at the start of every frame, so steady-state use allocates
+	no memory. Slices must not be used after the [reset] or [destroy] that recycles them.
+	An arena that runs out of room allocates a larger chunk, and keeps only that one at the next [reset]; the
+	chunks it retires are freed at the [reset] after that, so that pointers OpenGL still holds into them stay
+	valid until the arrays are set again.
+	[destroy] frees the memory at once; an arena dropped without it frees its memory when it is collected, and
+	since slices do not keep their arena alive, the arena must stay reachable as long as its slices are used. *)
+type t = {
+	mutable chunks : ubyte_array list;
+	mutable retired : ubyte_array list;
+	mutable used : int
+}
+
+external alloc_chunk : int -> ubyte_array = "glstub_arena_alloc"
+external free_chunk : ubyte_array -> unit = "glstub_arena_free"
+external slice : ubyte_array -> int -> int -> ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t = "glstub_arena_slice"
+
+let alignment = 16
+
+(** Free the memory of the arena; it can not be used afterwards *)
+let destroy a =
+	List.iter free_chunk a.chunks;
+	List.iter free_chunk a.retired;
+	a.chunks <- [];
+	a.retired <- [];
+	a.used <- 0
+
+(** Create an arena of size bytes *)
+let create size =
+	let a = { chunks = [alloc_chunk (max size alignment)]; retired = []; used = 0 } in
+	Gc.finalise destroy a;
+	a
+
+(** Allocate a slice of n elements of the given kind *)
+let alloc a kind n =
+	let bytes = n * Bigarray.kind_size_in_bytes kind in
+	let chunk = List.hd a.chunks in
+	let offset = (a.used + alignment - 1) land (lnot (alignment - 1)) in
+	if offset + bytes <= Bigarray.Array1.dim chunk then begin
+		a.used <- offset + bytes;
+		slice chunk offset n kind
+	end else begin
+		let c = alloc_chunk (max bytes (2 * Bigarray.Array1.dim chunk)) in
+		a.chunks <- c :: a.chunks;
+		a.used <- bytes;
+		slice c 0 n kind
+	end
+
+(** Recycle all slices *)
+let reset a =
+	List.iter free_chunk a.retired;
+	(match a.chunks with
+	| c :: rest -> a.retired <- rest; a.chunks <- [c]
+	| [] -> a.retired <- []);
+	a.used <- 0
+
+(** Bytes in use and bytes available in the current chunk *)
+let used a = a.used
+let capacity a = match a.chunks with c :: _ -> Bigarray.Array1.dim c | [] -> 0
+
+end
+
+module Readback = struct
+
+(** Asynchronous framebuffer readback.
+	[read r x y w h format typ] starts copying a block of the framebuffer into the next pixel pack buffer of
+	the ring r, like [glReadPixels], but returns at once with a ticket instead of waiting for the GPU.
+	Call [end_frame] once per frame: after [latency] frames (2 by default) the transfer has normally completed,
+	[ready] becomes true and [fetch] copies the pixels out without stalling. Fetching earlier is allowed, but waits.
+	A ticket stays valid until its buffer is reused, [slots] reads later; [fetch] raises [Invalid_argument] for
+	tickets that are no longer valid. Rows are tightly packed and bottom-up, as OpenGL returns them;
+	[fetch_rows] copies them top-down into an image with a row pitch instead, e.g. a locked SDL surface with
+	[Readback.fetch_rows r t (Sdl.Video.surface_pixels s) (Sdl.Video.surface_pitch s)].
+	Requires OpenGL 2.1 or ARB_pixel_buffer_object. *)
+type ticket = {
+	slot : int;
+	serial : int;
+	frame : int;
+	rows : int;
+	row_bytes : int
+}
+
+type t = {
+	buffers : int array;
+	sizes : int array;
+	serials : int array;
+	latency : int;
+	mutable next : int;
+	mutable frames : int
+}
+
+external copy_rows : ubyte_array -> ubyte_array -> int -> int -> int -> bool -> unit = "glstub_copy_rows_byte" "glstub_copy_rows"
+
+(** Create a ring of pixel pack buffers *)
+let create ?(slots = 3) ?(latency = 2) () =
+	let buffers = Array.make slots 0 in
+	glGenBuffers slots buffers;
+	{ buffers = buffers; sizes = Array.make slots 0; serials = Array.make slots (-1); latency = latency; next = 0; frames = 0 }
+
+(** Delete the buffers of r *)
+let destroy r = glDeleteBuffers (Array.length r.buffers) r.buffers
+
+(** Size in bytes of a pixel of the given format and type *)
+let pixel_size format typ =
+	let components =
+		if format = gl_rgba || format = gl_bgra then 4
+		else if format = gl_rgb || format = gl_bgr then 3
+		else if format = gl_luminance_alpha then 2
+		else 1
+	in
+	if typ = gl_unsigned_byte || typ = gl_byte then components
+	else if typ = gl_unsigned_short || typ = gl_short then 2 * components
+	else if typ = gl_unsigned_int_8_8_8_8 || typ = gl_unsigned_int_8_8_8_8_rev || typ = gl_unsigned_int_10_10_10_2 ||
+		typ = gl_unsigned_int_2_10_10_10_rev then 4
+	else if typ = gl_unsigned_short_5_6_5 || typ = gl_unsigned_short_4_4_4_4 || typ = gl_unsigned_short_5_5_5_1 ||
+		typ = gl_unsigned_short_5_6_5_rev || typ = gl_unsigned_short_4_4_4_4_rev || typ = gl_unsigned_short_1_5_5_5_rev then 2
+	else if typ = gl_unsigned_byte_3_3_2 || typ = gl_unsigned_byte_2_3_3_rev then 1
+	else 4 * components
+
+(** Start reading a block of the framebuffer *)
+let read r x y w h format typ =
+	let slot = r.next mod (Array.length r.buffers) in
+	let row_bytes = w * (pixel_size format typ) in
+	glBindBuffer gl_pixel_pack_buffer r.buffers.(slot);
+	if r.sizes.(slot) < row_bytes * h then begin
+		glBufferData gl_pixel_pack_buffer (row_bytes * h) 0 gl_stream_read;
+		r.sizes.(slot) <- row_bytes * h
+	end;
+	let alignment = [| 0 |] in
+	glGetIntegerv gl_pack_alignment alignment;
+	glPixelStorei gl_pack_alignment 1;
+	glReadPixels x y w h format typ 0;
+	glPixelStorei gl_pack_alignment alignment.(0);
+	glBindBuffer gl_pixel_pack_buffer 0;
+	r.serials.(slot) <- r.next;
+	r.next <- r.next + 1;
+	{ slot = slot; serial = r.serials.(slot); frame = r.frames; rows = h; row_bytes = row_bytes }
+
+(** Mark the end of a frame *)
+let end_frame r = r.frames <- r.frames + 1
+
+(** Test whether the pixels of t can be fetched without waiting, and whether t is still valid *)
+let ready r t = r.frames - t.frame >= r.latency
+let valid r t = r.serials.(t.slot) = t.serial
+
+(** Size in bytes of the pixels of t *)
+let size t = t.rows * t.row_bytes
+
+let with_mapping r t f =
+	if not (valid r t) then invalid_argument "Readback: ticket is no longer valid";
+	glBindBuffer gl_pixel_pack_buffer r.buffers.(t.slot);
+	let m = Mapped.glMapBuffer gl_pixel_pack_buffer gl_read_only Bigarray.int8_unsigned in
+	let finish () =
+		ignore (Mapped.glUnmapBuffer gl_pixel_pack_buffer);
+		glBindBuffer gl_pixel_pack_buffer 0
+	in
+	(try f m with e -> finish (); raise e);
+	finish ()
+
+(** Copy the pixels of t into dst, which must hold at least [size t] bytes *)
+let fetch r t dst =
+	with_mapping r t (fun m -> copy_rows m dst t.rows t.row_bytes t.row_bytes false)
+
+(** Copy the pixels of t into a fresh ubyte_array *)
+let get r t =
+	let a = Bigarray.Array1.create Bigarray.int8_unsigned Bigarray.c_layout (size t) in
+	fetch r t a;
+	a
+
+(** Copy the pixels of t top-down into pixels, with rows pitch bytes apart *)
+let fetch_rows r t pixels pitch =
+	with_mapping r t (fun m -> copy_rows m pixels t.rows t.row_bytes pitch true)
+
+end
+
+module Texture_stream = struct
+
+(** Streaming textures.
+	A streaming texture owns a ring of pixel unpack buffers for updating the whole of a texture every frame, as for
+	video or software-rendered layers. [begin_update s] returns a [ubyte_array] that maps the next buffer of the
+	ring: the caller writes the new image into it (tightly packed rows, bottom-up, in the format and type given to
+	[create]). [end_update s] unmaps it and issues a [glTexSubImage2D] that sources from the buffer, so the copy into
+	the texture happens asynchronously on the GPU instead of synchronising with the driver. Each buffer is orphaned
+	before it is mapped, so writing never waits for a transfer that is still in progress.
+	The view returned by [begin_update] is invalid after [end_update], or after [cancel_update], which unmaps the
+	buffer without uploading it. [end_update] leaves the texture bound to its
+	target on the active texture unit. Requires OpenGL 2.1 or ARB_pixel_buffer_object. *)
+type t = {
+	texture : int;
+	target : int;
+	width : int;
+	height : int;
+	format : int;
+	typ : int;
+	bytes : int;
+	buffers : int array;
+	mutable next : int;
+	mutable mapped : bool
+}
+
+(** Create a streaming texture that updates level 0 of texture (of size width x height) on target *)
+let create ?(slots = 2) ?(target = gl_texture_2d) texture width height format typ =
+	let buffers = Array.make slots 0 in
+	glGenBuffers slots buffers;
+	{ texture = texture; target = target; width = width; height = height; format = format; typ = typ;
+	bytes = width * height * (Readback.pixel_size format typ); buffers = buffers; next = 0; mapped = false }
+
+(** Delete the buffers of s; the texture itself is left alone *)
+let destroy s = glDeleteBuffers (Array.length s.buffers) s.buffers
+
+(** Map the next buffer of s for writing the new image *)
+let begin_update s =
+	if s.mapped then invalid_argument "Texture_stream.begin_update: update already in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	glBufferData gl_pixel_unpack_buffer s.bytes 0 gl_stream_draw;
+	let v = Mapped.glMapBuffer gl_pixel_unpack_buffer gl_write_only Bigarray.int8_unsigned in
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- true;
+	v
+
+(** Unmap the buffer and upload it into the texture *)
+let end_update s =
+	if not s.mapped then invalid_argument "Texture_stream.end_update: no update in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	ignore (Mapped.glUnmapBuffer gl_pixel_unpack_buffer);
+	glBindTexture s.target s.texture;
+	let alignment = [| 0 |] in
+	glGetIntegerv gl_unpack_alignment alignment;
+	glPixelStorei gl_unpack_alignment 1;
+	glTexSubImage2D s.target 0 0 0 s.width s.height s.format s.typ 0;
+	glPixelStorei gl_unpack_alignment alignment.(0);
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- false;
+	s.next <- (s.next + 1) mod (Array.length s.buffers)
+
+(** Unmap the buffer without uploading it, leaving the texture as it was *)
+let cancel_update s =
+	if not s.mapped then invalid_argument "Texture_stream.cancel_update: no update in progress";
+	glBindBuffer gl_pixel_unpack_buffer s.buffers.(s.next);
+	ignore (Mapped.glUnmapBuffer gl_pixel_unpack_buffer);
+	glBindBuffer gl_pixel_unpack_buffer 0;
+	s.mapped <- false
+
+(** Write a new image with f and upload it; if f raises, nothing is uploaded *)
+let update s f =
+	let v = begin_update s in
+	(try f v with e -> cancel_update s; raise e);
+	end_update s
+
+end
+
+module Gpu_profiler = struct
+
+(** GPU profiler.
+	[begin_scope p "shadows"] and [end_scope p] bracket a part of a frame whose GPU time is measured with timer
+	queries. Results are collected by [end_frame], called once per frame, which only reads the queries that have
+	completed, so it never waits for the GPU: a scope shows up in [report] a few frames after it was issued.
+	[report] gives, for every scope name, the number of samples and the minimum, average and maximum time in
+	milliseconds. With ARB_timer_query scopes may nest; with only EXT_timer_query a scope opened inside another
+	one is not measured. Without timer queries (e.g. on a software renderer) every function does nothing
+	and [report] stays empty; [available] tells which is the case. *)
+type scope = {
+	mutable count : int;
+	mutable total : float;
+	mutable min : float;
+	mutable max : float
+}
+
+type sample = {
+	name : string;
+	first : int;
+	last : int
+}
+
+type t = {
+	mutable support : int;
+	mutable free : int list;
+	mutable open_scopes : (string * int) list;
+	pending : sample Queue.t;
+	scopes : (string, scope) Hashtbl.t;
+	word : word_array;
+	dword : dword_array
+}
+
+(** Create a profiler. Nothing is asked of OpenGL until the first scope *)
+let create () = {
+	support = -1;
+	free = [];
+	open_scopes = [];
+	pending = Queue.create ();
+	scopes = Hashtbl.create 16;
+	word = make_word_array 1;
+	dword = make_dword_array 1
+}
+
+(* 0: no timer queries, 1: elapsed time queries only, 2: timestamps *)
+let support p =
+	if p.support < 0 then
+		p.support <-
+			if has_extension "GL_ARB_timer_query" then 2
+			else if has_extension "GL_EXT_timer_query" then 1
+			else 0;
+	p.support
+
+(** Test whether timer queries are available *)
+let available p = support p > 0
+
+(* Take a query object from the pool *)
+let query p =
+	if p.free = [] then begin
+		let a = Array.make 16 0 in
+		glGenQueries 16 a;
+		p.free <- Array.to_list a
+	end;
+	let q = List.hd p.free in
+	p.free <- List.tl p.free;
+	q
+
+(** Start measuring a scope *)
+let begin_scope p name =
+	match support p with
+	| 2 ->
+		let q = query p in
+		glQueryCounter q gl_timestamp;
+		p.open_scopes <- (name, q) :: p.open_scopes
+	| 1 when p.open_scopes = [] ->
+		let q = query p in
+		glBeginQuery gl_time_elapsed_ext q;
+		p.open_scopes <- [(name, q)]
+	| 1 -> p.open_scopes <- (name, -1) :: p.open_scopes
+	| _ -> ()
+
+(** Stop measuring the innermost scope *)
+let end_scope p =
+	match p.open_scopes with
+	| [] -> if support p > 0 then invalid_argument "Gpu_profiler.end_scope: no scope is open"
+	| (name, q) :: rest ->
+		p.open_scopes <- rest;
+		if q >= 0 then
+			if p.support = 2 then begin
+				let q' = query p in
+				glQueryCounter q' gl_timestamp;
+				Queue.add { name = name; first = q; last = q' } p.pending
+			end else begin
+				glEndQuery gl_time_elapsed_ext;
+				Queue.add { name = name; first = q; last = -1 } p.pending
+			end
+
+(** Measure the GPU time of f () as a scope *)
+let scope p name f =
+	begin_scope p name;
+	let r = (try f () with e -> end_scope p; raise e) in
+	end_scope p;
+	r
+
+let result_available p q =
+	Direct.glGetQueryObjectiv q gl_query_result_available p.word;
+	p.word.{0} <> 0l
+
+let result p q =
+	if p.support = 2 then
+		Direct.glGetQueryObjectui64v q gl_query_result p.dword
+	else
+		Direct.glGetQueryObjectui64vEXT q gl_query_result p.dword;
+	Int64.to_float p.dword.{0}
+
+let record p name ns =
+	let ms = ns /. 1e6 in
+	let s =
+		try Hashtbl.find p.scopes name with Not_found ->
+			let s = { count = 0; total = 0.; min = infinity; max = 0. } in
+			Hashtbl.add p.scopes name s;
+			s
+	in
+	s.count <- s.count + 1;
+	s.total <- s.total +. ms;
+	if ms < s.min then s.min <- ms;
+	if ms > s.max then s.max <- ms
+
+(** Collect the results of all completed scopes, without waiting for the others *)
+let end_frame p =
+	let rec collect () =
+		if not (Queue.is_empty p.pending) then begin
+			let s = Queue.peek p.pending in
+			if result_available p (if s.last >= 0 then s.last else s.first) then begin
+				ignore (Queue.pop p.pending);
+				if s.last >= 0 then begin
+					record p s.name (result p s.last -. result p s.first);
+					p.free <- s.last :: p.free
+				end else
+					record p s.name (result p s.first);
+				p.free <- s.first :: p.free;
+				collect ()
+			end
+		end
+	in
+	collect ()
+
+(** Statistics of every scope: name, number of samples, and minimum, average and maximum milliseconds *)
+let report p =
+	List.sort compare
+		(Hashtbl.fold (fun name s l -> (name, s.count, s.min, s.total /. float_of_int s.count, s.max) :: l) p.scopes [])
+
+(** Forget the statistics collected so far *)
+let reset p = Hashtbl.clear p.scopes
+
+(** Delete the query objects of p *)
+let destroy p =
+	Queue.iter (fun s -> p.free <- s.first :: (if s.last >= 0 then s.last :: p.free else p.free)) p.pending;
+	Queue.clear p.pending;
+	glDeleteQueries (List.length p.free) (Array.of_list p.free);
+	p.free <- []
+
+end
+
+module Stats = struct
+
+(** Call statistics.
+	When glcaml_stub.c is compiled with GLCAML_PROFILE defined ([make GLCAML_PROFILE=1]), every stub counts its
+	calls and the time spent in it, including the conversion of its arguments. [snapshot ()] returns the name,
+	number of calls and total seconds of every function called since the last [reset ()], most expensive first.
+	In a normal build nothing is counted, [enabled ()] is false and [snapshot ()] is empty. *)
+external enabled : unit -> bool = "glstub_stats_enabled"
+external snapshot' : unit -> (string * int * float) array = "glstub_stats_snapshot"
+external reset : unit -> unit = "glstub_stats_reset"
+
+let snapshot () =
+	let a = snapshot' () in
+	Array.stable_sort (fun (_, _, t) (_, _, t') -> compare t' t) a;
+	a
+
+end
+
+module Batch = struct
+
+(** Multi-draw batches.
+	[multi_draw_arrays] and [multi_draw_elements] are typed versions of [Direct.glMultiDrawArrays] and
+	[Direct.glMultiDrawElements]: first vertices and counts are [word_array]s, and element offsets are an [int_array]
+	of byte offsets into the bound element array buffer (its elements have the size of a pointer). All of them are
+	handed to OpenGL as they are, without any copy.
+	A batch collects the ranges of many meshes stored in the same buffers: [add b start count] appends one range,
+	and [flush_arrays] or [flush_elements] draws all of them with a single call and empties the batch. For
+	[flush_arrays] start is the first vertex of a range, for [flush_elements] the byte offset of its first index.
+	The storage is kept and grows as needed, so a batch that is refilled every frame allocates nothing. *)
+type t = {
+	mutable first : word_array;
+	mutable offsets : int_array;
+	mutable count : word_array;
+	mutable length : int
+}
+
+let check name n a =
+	if n < 0 || n > Bigarray.Array1.dim a then invalid_argument (name ^ ": array too short")
+
+(** Draw the n vertex ranges starting at first.{i} with count.{i} vertices *)
+let multi_draw_arrays mode (first : word_array) (count : word_array) n =
+	check "Batch.multi_draw_arrays" n first;
+	check "Batch.multi_draw_arrays" n count;
+	Direct.glMultiDrawArrays mode first count n
+
+(** Draw the n ranges of count.{i} indices of type typ starting at byte offset offsets.{i} *)
+let multi_draw_elements mode (count : word_array) typ (offsets : int_array) n =
+	check "Batch.multi_draw_elements" n count;
+	check "Batch.multi_draw_elements" n offsets;
+	Direct.glMultiDrawElements mode count typ offsets n
+
+(** Create an empty batch with room for n ranges *)
+let create n =
+	let n = max n 16 in
+	{ first = make_word_array n; offsets = make_int_array n; count = make_word_array n; length = 0 }
+
+(** Number of ranges in b *)
+let length b = b.length
+
+(** Discard all ranges, keeping the storage *)
+let clear b = b.length <- 0
+
+let grow b =
+	let n = 2 * Bigarray.Array1.dim b.count in
+	let copy make a =
+		let a' = make n in
+		Bigarray.Array1.blit (Bigarray.Array1.sub a 0 b.length) (Bigarray.Array1.sub a' 0 b.length);
+		a'
+	in
+	b.first <- copy make_word_array b.first;
+	b.offsets <- copy make_int_array b.offsets;
+	b.count <- copy make_word_array b.count
+
+(** Append the range of count vertices or indices beginning at start *)
+let add b start count =
+	if b.length = Bigarray.Array1.dim b.count then grow b;
+	let i = b.length in
+	Bigarray.Array1.unsafe_set b.first i (Int32.of_int start);
+	Bigarray.Array1.unsafe_set b.offsets i start;
+	Bigarray.Array1.unsafe_set b.count i (Int32.of_int count);
+	b.length <- i + 1
+
+(** Draw all ranges as vertex ranges with glMultiDrawArrays, and empty b *)
+let flush_arrays b mode =
+	if b.length > 0 then multi_draw_arrays mode b.first b.count b.length;
+	b.length <- 0
+
+(** Draw all ranges as index ranges of type typ with glMultiDrawElements, and empty b *)
+let flush_elements b mode typ =
+	if b.length > 0 then multi_draw_elements mode b.count typ b.offsets b.length;
+	b.length <- 0
+
+end
+
+module Mat4 = struct
+
+(** 4x4 matrices.
+	A matrix is a [float_array] of 16 single-precision floats in column-major order, which is what
+	[Direct.glUniformMatrix4fv] and [Direct.glLoadMatrixf] take, so it reaches OpenGL without any conversion.
+	Products, inversion, projections and the batch operations are computed in C, using SSE or NEON when the C
+	compiler targets them; every function writes its result into a matrix given as first argument and allocates
+	nothing. Angles are in degrees, as for [glRotatef] and [gluPerspective].
+	A [stack] replaces the fixed-function matrix stack: [push], [pop], [translate], [rotate]... act on its top
+	matrix, and [top s] can be passed directly to [uniform] or [Direct.glUniformMatrix4fv].
+	Batches of n matrices are [float_matrix]es of n rows of 16 floats. *)
+type t = float_array
+
+(** [mul r a b] sets r to the product a * b; r may be a or b *)
+external mul : t -> t -> t -> unit = "glstub_mat4_mul"
+
+(** [invert r a] sets r to the inverse of a, or returns false and leaves r unchanged if a is singular *)
+external invert : t -> t -> bool = "glstub_mat4_invert"
+
+(** [perspective m fovy aspect znear zfar] sets m to a perspective projection *)
+external perspective : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+	= "glstub_mat4_perspective" "glstub_mat4_perspective_nat"
+
+(** [ortho m left right bottom top znear zfar] sets m to an orthographic projection *)
+external ortho : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) ->
+	(float [@unboxed]) -> (float [@unboxed]) -> unit = "glstub_mat4_ortho_byte" "glstub_mat4_ortho_nat"
+
+(** [look_at m eyex eyey eyez centerx centery centerz upx upy upz] sets m to a viewing transformation *)
+external look_at : t -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) ->
+	(float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+	= "glstub_mat4_look_at_byte" "glstub_mat4_look_at_nat"
+
+(** [mul_batch dst m src n] sets the first n rows of dst to m times the rows of src *)
+external mul_batch : float_matrix -> t -> float_matrix -> int -> unit = "glstub_mat4_mul_batch"
+
+(** [transform_points dst m src n] transforms the n points (x, y, z, w) packed in src into dst *)
+external transform_points : float_array -> t -> float_array -> int -> unit = "glstub_mat4_transform_points"
+
+(** Set m to the identity *)
+let identity (m : t) =
+	Bigarray.Array1.fill m 0.;
+	m.{0} <- 1.; m.{5} <- 1.; m.{10} <- 1.; m.{15} <- 1.
+
+(** A new identity matrix *)
+let create () =
+	let m = make_float_array 16 in
+	identity m;
+	m
+
+(** Copy src into dst *)
+let copy (dst : t) (src : t) = Bigarray.Array1.blit src dst
+
+(** Set m to its transpose *)
+let transpose (m : t) =
+	for i = 0 to 3 do
+		for j = i + 1 to 3 do
+			let x = m.{4 * i + j} in
+			m.{4 * i + j} <- m.{4 * j + i};
+			m.{4 * j + i} <- x
+		done
+	done
+
+(** Set m to a translation *)
+let translation m x y z =
+	identity m;
+	m.{12} <- x; m.{13} <- y; m.{14} <- z
+
+(** Set m to a scaling *)
+let scaling m x y z =
+	identity m;
+	m.{0} <- x; m.{5} <- y; m.{10} <- z
+
+(** Set m to a rotation of angle degrees around the axis (x, y, z), as glRotatef *)
+let rotation m angle x y z =
+	let l = sqrt (x *. x +. y *. y +. z *. z) in
+	let x, y, z = if l > 0. then x /. l, y /. l, z /. l else 0., 0., 1. in
+	let a = angle *. 3.14159265358979323846 /. 180. in
+	let c = cos a and s = sin a in
+	let d = 1. -. c in
+	identity m;
+	m.{0} <- x *. x *. d +. c;
+	m.{1} <- y *. x *. d +. z *. s;
+	m.{2} <- x *. z *. d -. y *. s;
+	m.{4} <- x *. y *. d -. z *. s;
+	m.{5} <- y *. y *. d +. c;
+	m.{6} <- y *. z *. d +. x *. s;
+	m.{8} <- x *. z *. d +. y *. s;
+	m.{9} <- y *. z *. d -. x *. s;
+	m.{10} <- z *. z *. d +. c
+
+(** Pass m to the uniform at location loc of the current program *)
+let uniform loc (m : t) = Direct.glUniformMatrix4fv loc 1 false m
+
+(** Replace the current fixed-function matrix with m *)
+let load (m : t) = Direct.glLoadMatrixf m
+
+type stack = {
+	mutable depth : int;
+	levels : t array;
+	scratch : t
+}
+
+(** A matrix stack of at most n levels, holding the identity *)
+let stack n = { depth = 0; levels = Array.init (max n 1) (fun _ -> create ()); scratch = create () }
+
+(** The matrix on top of s; it changes with every operation on s *)
+let top s = s.levels.(s.depth)
+
+(** Push a copy of the top matrix *)
+let push s =
+	if s.depth + 1 >= Array.length s.levels then invalid_argument "Mat4.push: stack overflow";
+	copy s.levels.(s.depth + 1) (top s);
+	s.depth <- s.depth + 1
+
+(** Pop the top matrix *)
+let pop s =
+	if s.depth = 0 then invalid_argument "Mat4.pop: stack underflow";
+	s.depth <- s.depth - 1
+
+(** Replace the top matrix with the identity or with m *)
+let load_identity s = identity (top s)
+let load_matrix s m = copy (top s) m
+
+(** Multiply the top matrix by m on the right, as glMultMatrixf *)
+let mult s m = mul (top s) (top s) m
+
+(** Multiply the top matrix by a translation, a scaling or a rotation, as glTranslatef, glScalef and glRotatef *)
+let translate s x y z = translation s.scratch x y z; mult s s.scratch
+let scale s x y z = scaling s.scratch x y z; mult s s.scratch
+let rotate s angle x y z = rotation s.scratch angle x y z; mult s s.scratch
+
+end
+
+module Recorder = struct
+
+(** Immediate-mode recorder.
+	The functions below have the names and arguments of [glBegin], [glEnd], [glVertex3f], [glColor3f], [glNormal3f],
+	[glTexCoord2f] and their variants. Outside of [record] they call OpenGL as usual. Inside [record f], the
+	vertices emitted between [glBegin] and [glEnd] are captured instead, with the current color, normal and texture
+	coordinate, into an interleaved array that is uploaded to a buffer object when f returns. The resulting [mesh]
+	is drawn with [draw], which sets up vertex arrays and issues one multi-draw per run of primitives of the same
+	mode, so a legacy scene recorded once is redrawn every frame at the cost of a handful of calls.
+	Only the geometry is recorded: any other GL call made by f, such as a [glRotatef] or a [glBindTexture], takes
+	effect once during the recording. [draw] uses the fixed-function vertex arrays, binds [gl_array_buffer] behind the
+	back of [Cached], and leaves the current color, normal and texture coordinate undefined. *)
+type mesh = {
+	vbo : int;
+	vertices : int;
+	colors : bool;
+	normals : bool;
+	texcoords : bool;
+	groups : (int * word_array * word_array * int) list
+}
+
+type recording = {
+	mutable data : float_array;
+	mutable len : int;
+	current : float_array;
+	mutable mode : int;
+	mutable first : int;
+	mutable ranges : (int * int * int) list;
+	mutable has_colors : bool;
+	mutable has_normals : bool;
+	mutable has_texcoords : bool
+}
+
+(* Interleaved vertex: position (4 floats), color (4), normal (3), texture coordinate (2) *)
+let vertex_size = 13
+let stride = 4 * vertex_size
+
+let recording = ref None
+
+let new_recording () =
+	let current = make_float_array 9 in
+	Bigarray.Array1.fill current 0.;
+	current.{0} <- 1.; current.{1} <- 1.; current.{2} <- 1.; current.{3} <- 1.; current.{6} <- 1.;
+	{ data = make_float_array (256 * vertex_size); len = 0; current = current; mode = -1; first = 0; ranges = [];
+	  has_colors = false; has_normals = false; has_texcoords = false }
+
+let grow r =
+	let d = make_float_array (2 * Bigarray.Array1.dim r.data) in
+	Bigarray.Array1.blit (Bigarray.Array1.sub r.data 0 r.len) (Bigarray.Array1.sub d 0 r.len);
+	r.data <- d
+
+let emit r x y z w =
+	if r.mode < 0 then invalid_argument "Recorder: vertex outside glBegin/glEnd";
+	if r.len + vertex_size > Bigarray.Array1.dim r.data then grow r;
+	let d = r.data and o = r.len in
+	d.{o} <- x; d.{o + 1} <- y; d.{o + 2} <- z; d.{o + 3} <- w;
+	for i = 0 to 8 do d.{o + 4 + i} <- r.current.{i} done;
+	r.len <- o + vertex_size
+
+(* Number of vertices of one primitive of the independent primitive modes, which can be merged across glBegin/glEnd *)
+let primitive_size mode =
+	if mode = gl_points then 1
+	else if mode = gl_lines then 2
+	else if mode = gl_triangles then 3
+	else if mode = gl_quads then 4
+	else 0
+
+let glBegin mode =
+	match !recording with
+	| None -> glBegin mode
+	| Some r ->
+		if r.mode >= 0 then invalid_argument "Recorder.glBegin: already inside glBegin/glEnd";
+		r.mode <- mode;
+		r.first <- r.len / vertex_size
+
+let glEnd () =
+	match !recording with
+	| None -> glEnd ()
+	| Some r ->
+		if r.mode < 0 then invalid_argument "Recorder.glEnd: no glBegin";
+		let count = r.len / vertex_size - r.first in
+		let k = primitive_size r.mode in
+		let count = if k > 0 then count - count mod k else count in
+		(match r.ranges with
+		| (mode, first, n) :: rest when mode = r.mode && k > 0 && first + n = r.first ->
+			r.ranges <- (mode, first, n + count) :: rest
+		| l -> if count > 0 then r.ranges <- (r.mode, r.first, count) :: l);
+		r.mode <- -1
+
+let set_color r red green blue alpha =
+	r.has_colors <- true;
+	r.current.{0} <- red; r.current.{1} <- green; r.current.{2} <- blue; r.current.{3} <- alpha
+
+let set_normal r x y z =
+	r.has_normals <- true;
+	r.current.{4} <- x; r.current.{5} <- y; r.current.{6} <- z
+
+let set_texcoord r s t =
+	r.has_texcoords <- true;
+	r.current.{7} <- s; r.current.{8} <- t
+
+let glVertex2f x y = match !recording with None -> glVertex2f x y | Some r -> emit r x y 0. 1.
+let glVertex2d x y = match !recording with None -> glVertex2d x y | Some r -> emit r x y 0. 1.
+let glVertex2i x y = match !recording with None -> glVertex2i x y | Some r -> emit r (float x) (float y) 0. 1.
+let glVertex2iv v = match !recording with None -> glVertex2iv v | Some r -> emit r (float v.(0)) (float v.(1)) 0. 1.
+let glVertex3f x y z = match !recording with None -> glVertex3f x y z | Some r -> emit r x y z 1.
+let glVertex3d x y z = match !recording with None -> glVertex3d x y z | Some r -> emit r x y z 1.
+let glVertex3i x y z = match !recording with None -> glVertex3i x y z | Some r -> emit r (float x) (float y) (float z) 1.
+let glVertex3fv v = match !recording with None -> glVertex3fv v | Some r -> emit r v.(0) v.(1) v.(2) 1.
+let glVertex4f x y z w = match !recording with None -> glVertex4f x y z w | Some r -> emit r x y z w
+let glVertex4d x y z w = match !recording with None -> glVertex4d x y z w | Some r -> emit r x y z w
+
+let glColor3f red green blue = match !recording with None -> glColor3f red green blue | Some r -> set_color r red green blue 1.
+let glColor3d red green blue = match !recording with None -> glColor3d red green blue | Some r -> set_color r red green blue 1.
+let glColor4f red green blue alpha =
+	match !recording with None -> glColor4f red green blue alpha | Some r -> set_color r red green blue alpha
+let glColor4d red green blue alpha =
+	match !recording with None -> glColor4d red green blue alpha | Some r -> set_color r red green blue alpha
+let glColor3ub red green blue =
+	match !recording with
+	| None -> glColor3ub red green blue
+	| Some r -> set_color r (float red /. 255.) (float green /. 255.) (float blue /. 255.) 1.
+let glColor4ub red green blue alpha =
+	match !recording with
+	| None -> glColor4ub red green blue alpha
+	| Some r -> set_color r (float red /. 255.) (float green /. 255.) (float blue /. 255.) (float alpha /. 255.)
+
+let glNormal3f x y z = match !recording with None -> glNormal3f x y z | Some r -> set_normal r x y z
+let glNormal3d x y z = match !recording with None -> glNormal3d x y z | Some r -> set_normal r x y z
+
+let glTexCoord2f s t = match !recording with None -> glTexCoord2f s t | Some r -> set_texcoord r s t
+let glTexCoord2d s t = match !recording with None -> glTexCoord2d s t | Some r -> set_texcoord r s t
+
+(* Turn the ranges, recorded last first, into runs of the same mode *)
+let make_groups ranges : (int * word_array * word_array * int) list =
+	let group mode l =
+		let n = List.length l in
+		let first = make_word_array n and count = make_word_array n in
+		List.iteri (fun i (f, c) -> first.{i} <- Int32.of_int f; count.{i} <- Int32.of_int c) l;
+		(mode, first, count, n)
+	in
+	let rec runs acc = function
+		| [] -> acc
+		| (mode, f, c) :: rest ->
+			(match acc with
+			| (m, l) :: acc' when m = mode -> runs ((m, (f, c) :: l) :: acc') rest
+			| _ -> runs ((mode, [(f, c)]) :: acc) rest)
+	in
+	List.map (fun (mode, l) -> group mode l) (runs [] ranges)
+
+(** Record the geometry drawn by f into a mesh *)
+let record f =
+	let r = new_recording () in
+	let saved = !recording in
+	recording := Some r;
+	(try f () with e -> recording := saved; raise e);
+	recording := saved;
+	if r.mode >= 0 then invalid_argument "Recorder.record: glBegin without glEnd";
+	let a = [| 0 |] in
+	glGenBuffers 1 a;
+	glBindBuffer gl_array_buffer a.(0);
+	glBufferData gl_array_buffer (4 * r.len) (Bigarray.Array1.sub r.data 0 (max r.len 1)) gl_static_draw;
+	glBindBuffer gl_array_buffer 0;
+	{ vbo = a.(0); vertices = r.len / vertex_size; colors = r.has_colors; normals = r.has_normals;
+	  texcoords = r.has_texcoords; groups = make_groups r.ranges }
+
+(** Number of vertices of a mesh *)
+let vertices m = m.vertices
+
+(** Draw a mesh *)
+let draw m =
+	glPushClientAttrib gl_client_vertex_array_bit;
+	glBindBuffer gl_array_buffer m.vbo;
+	glEnableClientState gl_vertex_array;
+	glVertexPointer 4 gl_float stride 0;
+	if m.colors then begin
+		glEnableClientState gl_color_array;
+		glColorPointer 4 gl_float stride 16
+	end;
+	if m.normals then begin
+		glEnableClientState gl_normal_array;
+		glNormalPointer gl_float stride 32
+	end;
+	if m.texcoords then begin
+		glEnableClientState gl_texture_coord_array;
+		glTexCoordPointer 2 gl_float stride 44
+	end;
+	List.iter (fun (mode, first, count, n) -> Batch.multi_draw_arrays mode first count n) m.groups;
+	glBindBuffer gl_array_buffer 0;
+	glPopClientAttrib ()
+
+(** Delete the buffer object of a mesh; it can not be drawn afterwards *)
+let delete m = glDeleteBuffers 1 [| m.vbo |]
+
+end
+
+module Program_cache = struct
+
+(** Program binary cache.
+	[program c sources] builds a shader program from a list of (shader type, source) pairs and stores the linked
+	program in the directory of c with [glGetProgramBinary]. Later runs load it with [glProgramBinary] instead of
+	compiling the sources again. Files are named after a digest of the sources, of the setup key and of the vendor,
+	renderer and version strings of OpenGL, so a driver update simply misses the cache. A binary rejected by the driver is
+	replaced by compiling the sources. Without ARB_get_program_binary (or OpenGL 4.1) every program is compiled.
+	Compile and link errors raise [Failure] with the info log. *)
+type t = {
+	dir : string;
+	mutable support : int;
+	mutable driver : string;
+	mutable hits : int;
+	mutable misses : int
+}
+
+(** Create a cache storing its files in the existing directory dir. Nothing is asked of OpenGL until the first program *)
+let create dir = {
+	dir = dir;
+	support = -1;
+	driver = "";
+	hits = 0;
+	misses = 0
+}
+
+(** Number of programs loaded from the cache and number of programs compiled *)
+let hits c = c.hits
+let misses c = c.misses
+
+(* 0: no program binaries, 1: program binaries *)
+let support c =
+	if c.support < 0 then begin
+		c.support <-
+			(try
+				preload ["glGetProgramBinary"; "glProgramBinary"; "glProgramParameteri"];
+				let n = [| 0 |] in
+				glGetIntegerv gl_num_program_binary_formats n;
+				if n.(0) > 0 then 1 else 0
+			with Failure _ | Gl_error _ -> 0);
+		c.driver <- String.concat "\n" (List.map glGetString [gl_vendor; gl_renderer; gl_version])
+	end;
+	c.support
+
+(** Test whether programs can be cached with the current context *)
+let available c = support c > 0
+
+(* Compile and link the sources *)
+let compile c setup sources =
+	let p = glCreateProgram () in
+	let shader (kind, src) =
+		let s = glCreateShader kind in
+		shader_source s [| src |];
+		glCompileShader s;
+		if not (status glGetShaderiv s gl_compile_status) then begin
+			let log = info_log glGetShaderiv glGetShaderInfoLog s in
+			glDeleteShader s;
+			glDeleteProgram p;
+			failwith ("Program_cache: " ^ log)
+		end;
+		glAttachShader p s;
+		s
+	in
+	let shaders = List.map shader sources in
+	setup p;
+	if c.support > 0 then glProgramParameteri p gl_program_binary_retrievable_hint 1;
+	glLinkProgram p;
+	List.iter (fun s -> glDetachShader p s; glDeleteShader s) shaders;
+	if not (status glGetProgramiv p gl_link_status) then begin
+		let log = info_log glGetProgramiv glGetProgramInfoLog p in
+		glDeleteProgram p;
+		failwith ("Program_cache: " ^ log)
+	end;
+	p
+
+let path c key sources =
+	let key = String.concat "\000" (c.driver :: key :: List.map (fun (kind, src) -> string_of_int kind ^ "\000" ^ src) sources) in
+	Filename.concat c.dir (Digest.to_hex (Digest.string key) ^ ".bin")
+
+(* A cache file holds the binary format followed by the binary *)
+let read_binary path =
+	try
+		let ic = open_in_bin path in
+		let r =
+			try
+				let format = input_binary_int ic in
+				Some (format, really_input_string ic (in_channel_length ic - 4))
+			with End_of_file -> None
+		in
+		close_in ic;
+		r
+	with Sys_error _ -> None
+
+let write_binary path p =
+	let n = [| 0 |] in
+	glGetProgramiv p gl_program_binary_length n;
+	if n.(0) > 0 then begin
+		let b = make_ubyte_array n.(0) and len = [| 0 |] and format = [| 0 |] in
+		glGetProgramBinary p n.(0) len format b;
+		let tmp = path ^ ".tmp" in
+		try
+			let oc = open_out_bin tmp in
+			output_binary_int oc format.(0);
+			output_string oc (String.sub (to_string b) 0 len.(0));
+			close_out oc;
+			Sys.rename tmp path
+		with Sys_error _ -> ()
+	end
+
+(* Load a binary, or return None if the driver rejects it *)
+let load format binary =
+	let p = glCreateProgram () in
+	let ok =
+		try
+			glProgramBinary p format binary (String.length binary);
+			status glGetProgramiv p gl_link_status
+		with Gl_error _ -> false
+	in
+	if ok then Some p else (glDeleteProgram p; None)
+
+(** Build a program from (shader type, source) pairs, e.g. [[(gl_vertex_shader, vs); (gl_fragment_shader, fs)]].
+	setup is called with the program before it is linked, e.g. for [glBindAttribLocation]; its effect is part of the
+	stored binary, so it is not called when the program comes from the cache. key names what setup does, e.g. the
+	attribute locations it binds, and goes into the digest: programs built from the same sources with different
+	setups must be given different keys, or they share a cache file *)
+let program c ?(setup = fun _ -> ()) ?(key = "") sources =
+	if support c = 0 then compile c setup sources else begin
+		let path = path c key sources in
+		let cached =
+			match read_binary path with
+			| Some (format, binary) -> load format binary
+			| None -> None
+		in
+		match cached with
+		| Some p ->
+			c.hits <- c.hits + 1;
+			p
+		| None ->
+			c.misses <- c.misses + 1;
+			let p = compile c setup sources in
+			write_binary path p;
+			p
+	end
+
+end
+
+module Shader_compiler = struct
+
+(** Asynchronous shader compilation.
+	[submit q sources] queues a program built from (shader type, source) pairs and returns a job, and [update q],
+	called once per frame, moves the jobs along without waiting for the driver. With KHR_parallel_shader_compile
+	(or the ARB version) all submitted shaders are handed to the driver at once, which compiles and links them on
+	its own threads, and [update] only polls [gl_completion_status_khr]. Without it, [update] compiles and links
+	waiting programs one after the other until the time budget of q is spent, so the work is spread over frames.
+	[result job] is [Pending] until the program is linked. *)
+type result =
+	| Pending
+	| Ready of int
+	| Failed of string
+
+type job = {
+	sources : (int * string) list;
+	setup : int -> unit;
+	mutable shaders : int array;
+	mutable program : int;
+	mutable result : result
+}
+
+type t = {
+	mutable support : int;
+	budget : float;
+	waiting : job Queue.t;
+	mutable compiling : job list;
+	mutable linking : job list
+}
+
+(** Create a scheduler. budget is the time in seconds [update] may spend compiling when the driver cannot
+	compile in parallel *)
+let create ?(budget = 0.004) () = {
+	support = -1;
+	budget = budget;
+	waiting = Queue.create ();
+	compiling = [];
+	linking = []
+}
+
+(* 0: compile on this thread, 1: the driver compiles in parallel *)
+let support q =
+	if q.support < 0 then
+		q.support <-
+			if has_extension "GL_KHR_parallel_shader_compile" ||
+				has_extension "GL_ARB_parallel_shader_compile" then 1 else 0;
+	q.support
+
+(** Test whether the driver compiles shaders in parallel *)
+let available q = support q > 0
+
+(** The state of a job *)
+let result job = job.result
+
+(** Number of jobs that are not finished yet *)
+let pending q = Queue.length q.waiting + List.length q.compiling + List.length q.linking
+
+let fail job log =
+	Array.iter glDeleteShader job.shaders;
+	if job.program <> 0 then glDeleteProgram job.program;
+	job.shaders <- [||];
+	job.program <- 0;
+	job.result <- Failed log
+
+(* Create the shaders of the jobs and compile all of them in one call *)
+let compile jobs =
+	List.iter (fun job -> job.shaders <- Array.of_list (List.map (fun (kind, _) -> glCreateShader kind) job.sources)) jobs;
+	compile_shaders
+		(Array.concat (List.map (fun job -> job.shaders) jobs))
+		(Array.of_list (List.concat (List.map (fun job -> List.map (fun (_, src) -> [| src |]) job.sources) jobs)))
+
+(* Link the program of a compiled job; the link may still be running when this returns *)
+let link job =
+	let failed = List.filter (fun s -> not (status glGetShaderiv s gl_compile_status)) (Array.to_list job.shaders) in
+	match failed with
+	| s :: _ -> fail job (info_log glGetShaderiv glGetShaderInfoLog s)
+	| [] ->
+		let p = glCreateProgram () in
+		job.program <- p;
+		Array.iter (glAttachShader p) job.shaders;
+		job.setup p;
+		glLinkProgram p;
+		Array.iter (fun s -> glDetachShader p s; glDeleteShader s) job.shaders;
+		job.shaders <- [||]
+
+let finish job =
+	if job.result = Pending then
+		if status glGetProgramiv job.program gl_link_status then
+			job.result <- Ready job.program
+		else
+			fail job (info_log glGetProgramiv glGetProgramInfoLog job.program)
+
+let linked q job =
+	if job.result = Pending then q.linking <- job :: q.linking
+
+(** Queue programs built from lists of (shader type, source) pairs. With parallel compilation the shaders of
+	all of them are passed to the driver in a single call. setup is called with each program before it is linked *)
+let submit_all q ?(setup = fun _ -> ()) programs =
+	let jobs = List.map (fun sources -> { sources = sources; setup = setup; shaders = [||]; program = 0; result = Pending }) programs in
+	if support q > 0 then begin
+		compile jobs;
+		q.compiling <- List.rev_append jobs q.compiling
+	end else
+		List.iter (fun job -> Queue.add job q.waiting) jobs;
+	jobs
+
+(** Queue one program *)
+let submit q ?setup sources = List.hd (submit_all q ?setup [sources])
+
+(* Compile and link a job, waiting for the driver *)
+let build job =
+	compile [job];
+	link job;
+	finish job
+
+(** Move the jobs along: finish those the driver is done with, or compile waiting ones until the budget is spent *)
+let update q =
+	if support q > 0 then begin
+		let complete get o = status get o gl_completion_status_khr in
+		let linking, finished = List.partition (fun job -> not (complete glGetProgramiv job.program)) q.linking in
+		q.linking <- linking;
+		List.iter finish finished;
+		let compiling, compiled =
+			List.partition (fun job -> not (Array.for_all (complete glGetShaderiv) job.shaders)) q.compiling in
+		q.compiling <- compiling;
+		List.iter (fun job -> link job; linked q job) compiled
+	end else begin
+		let stop = monotonic_clock () +. q.budget in
+		while not (Queue.is_empty q.waiting) && monotonic_clock () < stop do
+			build (Queue.pop q.waiting)
+		done
+	end
+
+(** Finish every job now, waiting for the driver *)
+let flush q =
+	List.iter (fun job -> link job; linked q job) (List.rev q.compiling);
+	q.compiling <- [];
+	List.iter finish q.linking;
+	q.linking <- [];
+	Queue.iter build q.waiting;
+	Queue.clear q.waiting
+
+end
+
+module Fence = struct
+
+(** Fences.
+	[insert ()] puts a fence into the command stream, and [wait f] blocks until the GPU has passed it, with the Ocaml
+	runtime lock released so that other threads keep running meanwhile; [signaled f] tests without waiting.
+	A [ring] keeps one fence per region of a ring buffer, so that a region is only overwritten once the GPU has
+	finished reading it: [acquire r] waits for the next region and returns its index, and [release r i] fences
+	region i after the commands that read it have been issued. Fences must be deleted with [delete]. *)
+type t = sync
+
+external client_wait : sync -> int -> int -> int = "glstub_fence_wait"
+
+(** Fence the commands issued so far *)
+let insert () = glFenceSync gl_sync_gpu_commands_complete 0
+
+(** Test whether the GPU has passed the fence, without waiting *)
+let signaled f =
+	let r = glClientWaitSync f 0 0 in
+	r = gl_already_signaled || r = gl_condition_satisfied
+
+(** Wait until the GPU has passed the fence or timeout nanoseconds have elapsed (by default no time limit),
+	flushing the commands first. Returns [false] on timeout *)
+let wait ?(timeout = max_int) f =
+	let r = client_wait f gl_sync_flush_commands_bit timeout in
+	if r = gl_wait_failed then failwith "Fence.wait: glClientWaitSync failed";
+	r <> gl_timeout_expired
+
+let delete f = glDeleteSync f
+
+type ring = {
+	fences : t option array;
+	mutable next : int
+}
+
+(** Create a ring of n regions *)
+let ring n = {
+	fences = Array.make n None;
+	next = 0
+}
+
+(** Wait until the GPU is done with the next region, and return its index *)
+let acquire r =
+	let i = r.next in
+	(match r.fences.(i) with
+	| Some f ->
+		ignore (wait f);
+		delete f;
+		r.fences.(i) <- None
+	| None -> ());
+	r.next <- (i + 1) mod Array.length r.fences;
+	i
+
+(** Fence region i of the ring *)
+let release r i =
+	(match r.fences.(i) with
+	| Some f -> delete f
+	| None -> ());
+	r.fences.(i) <- Some (insert ())
+
+(** Delete the fences of the ring *)
+let destroy r =
+	Array.iteri (fun i f ->
+		(match f with
+		| Some f -> delete f
+		| None -> ());
+		r.fences.(i) <- None) r.fences
+
+end
+
+module Render_target = struct
+
+(** Render target pool.
+	A render target is a framebuffer object with a colour attachment (a texture, or a renderbuffer when it is
+	multisampled) and an optional depth renderbuffer. [acquire p w h format] returns a free target of that size,
+	internal format, depth format and number of samples, and [release p t] gives it back to the pool, so that later
+	passes and frames reuse it instead of creating new textures. [transient p ...] acquires a target that is released
+	by [end_frame]; free targets left unused for more than [keep] frames are deleted there. Creating a target
+	changes the texture and renderbuffer bindings (call [Cached.invalidate] when using [Cached]) and restores the
+	framebuffer binding. Colour formats may be normalised, float or integer formats, e.g. [gl_rgba32ui_ext]. *)
+type target = {
+	framebuffer : int;
+	color : int;
+	depth : int;
+	width : int;
+	height : int;
+	format : int;
+	depth_format : int;
+	samples : int;
+	mutable released : int
+}
+
+type t = {
+	free : (int * int * int * int * int, target list) Hashtbl.t;
+	mutable transients : target list;
+	mutable frame : int;
+	keep : int;
+	mutable created : int;
+	mutable reused : int
+}
+
+(** Create a pool. keep is the number of frames a free target is kept for *)
+let create ?(keep = 60) () = {
+	free = Hashtbl.create 16;
+	transients = [];
+	frame = 0;
+	keep = keep;
+	created = 0;
+	reused = 0
+}
+
+(** Number of targets created and number of acquisitions served by a free target *)
+let created p = p.created
+let reused p = p.reused
+
+let key t = (t.width, t.height, t.format, t.depth_format, t.samples)
+
+let get pname =
+	let a = [| 0 |] in
+	glGetIntegerv pname a;
+	a.(0)
+
+let gen f =
+	let a = [| 0 |] in
+	f 1 a;
+	a.(0)
+
+let delete t =
+	glDeleteFramebuffers 1 [| t.framebuffer |];
+	if t.samples > 0 then glDeleteRenderbuffers 1 [| t.color |] else glDeleteTextures 1 [| t.color |];
+	if t.depth <> 0 then glDeleteRenderbuffers 1 [| t.depth |]
+
+let renderbuffer samples format width height =
+	let rb = gen glGenRenderbuffers in
+	glBindRenderbuffer gl_renderbuffer rb;
+	if samples > 0 then
+		glRenderbufferStorageMultisample gl_renderbuffer samples format width height
+	else
+		glRenderbufferStorage gl_renderbuffer format width height;
+	rb
+
+(* Format and type of the pixels of an internal format, which glTexImage2D needs even without data:
+	integer formats take the *_INTEGER formats, depth formats the depth formats, float formats floats *)
+let pixel_format internal =
+	let components =
+		if List.mem internal [gl_r8; gl_r16; gl_r16f; gl_r32f] then 1
+		else if List.mem internal [gl_rg8; gl_rg16; gl_rg16f; gl_rg32f] then 2
+		else if List.mem internal [gl_rgb8; gl_srgb8; gl_rgb16; gl_rgb16f; gl_rgb32f; gl_r11f_g11f_b10f_ext; gl_rgb9_e5_ext] then 3
+		else 4
+	in
+	if List.mem internal [gl_depth_component16; gl_depth_component24; gl_depth_component32; gl_depth_component32f] then
+		(gl_depth_component, gl_float)
+	else if internal = gl_depth24_stencil8 then
+		(gl_depth_stencil, gl_unsigned_int_24_8)
+	else if internal = gl_depth32f_stencil8 then
+		(gl_depth_stencil, gl_float_32_unsigned_int_24_8_rev_nv)
+	else if internal >= 0x8231 && internal <= 0x823c then
+		(* GL_R8I to GL_RG32UI: signed formats have odd values *)
+		((if internal <= 0x8236 then gl_red_integer_ext else gl_rg_integer), if internal land 1 = 1 then gl_int else gl_unsigned_int)
+	else if internal >= gl_rgba32ui_ext && internal <= gl_rgb8i_ext then
+		(* GL_RGBA32UI to GL_RGB8I, in groups of six starting with RGBA and RGB *)
+		((if (internal - gl_rgba32ui_ext) mod 6 = 1 then gl_rgb_integer_ext else gl_rgba_integer_ext),
+			if internal >= gl_rgba32i_ext then gl_int else gl_unsigned_int)
+	else if internal = 0x906f then
+		(* GL_RGB10_A2UI *)
+		(gl_rgba_integer_ext, gl_unsigned_int_2_10_10_10_rev)
+	else
+		let format = List.nth [gl_red; gl_rg; gl_rgb; gl_rgba] (components - 1) in
+		let float = List.mem internal
+			[gl_r16f; gl_rg16f; gl_rgb16f; gl_rgba16f; gl_r32f; gl_rg32f; gl_rgb32f; gl_rgba32f; gl_r11f_g11f_b10f_ext; gl_rgb9_e5_ext]
+		in
+		(format, if float then gl_float else gl_unsigned_byte)
+
+let make width height format depth_format samples =
+	let bound = get gl_framebuffer_binding in
+	let fb = gen glGenFramebuffers in
+	glBindFramebuffer gl_framebuffer fb;
+	let color =
+		if samples > 0 then begin
+			let rb = renderbuffer samples format width height in
+			glFramebufferRenderbuffer gl_framebuffer gl_color_attachment0 gl_renderbuffer rb;
+			rb
+		end else begin
+			let tex = gen glGenTextures in
+			glBindTexture gl_texture_2d tex;
+			let pixels, typ = pixel_format format in
+			glTexImage2D gl_texture_2d 0 format width height 0 pixels typ 0;
+			(* Integer textures can not be sampled with linear filtering *)
+			let filter = if typ = gl_int || typ = gl_unsigned_int || pixels = gl_rgba_integer_ext then gl_nearest else gl_linear in
+			glTexParameteri gl_texture_2d gl_texture_min_filter filter;
+			glTexParameteri gl_texture_2d gl_texture_mag_filter filter;
+			glTexParameteri gl_texture_2d gl_texture_wrap_s gl_clamp_to_edge;
+			glTexParameteri gl_texture_2d gl_texture_wrap_t gl_clamp_to_edge;
+			glFramebufferTexture2D gl_framebuffer gl_color_attachment0 gl_texture_2d tex 0;
+			tex
+		end
+	in
+	let depth =
+		if depth_format = 0 then 0 else begin
+			let rb = renderbuffer samples depth_format width height in
+			let attachment =
+				if depth_format = gl_depth24_stencil8 || depth_format = gl_depth32f_stencil8 then gl_depth_stencil_attachment
+				else gl_depth_attachment
+			in
+			glFramebufferRenderbuffer gl_framebuffer attachment gl_renderbuffer rb;
+			rb
+		end
+	in
+	let status = glCheckFramebufferStatus gl_framebuffer in
+	glBindFramebuffer gl_framebuffer bound;
+	let t = {
+		framebuffer = fb; color = color; depth = depth; width = width; height = height;
+		format = format; depth_format = depth_format; samples = samples; released = 0
+	} in
+	if status <> gl_framebuffer_complete then begin
+		delete t;
+		failwith (Printf.sprintf "Render_target: incomplete framebuffer (0x%x)" status)
+	end;
+	t
+
+(** Take a target of the given size and internal format from the pool, or create one. depth is the internal format
+	of the depth buffer, 0 (the default) for none; samples is the number of samples, 0 (the default) for a target
+	whose colour can be read as a texture *)
+let acquire p ?(depth = 0) ?(samples = 0) width height format =
+	let k = (width, height, format, depth, samples) in
+	match (try Hashtbl.find p.free k with Not_found -> []) with
+	| t :: rest ->
+		if rest = [] then Hashtbl.remove p.free k else Hashtbl.replace p.free k rest;
+		p.reused <- p.reused + 1;
+		t
+	| [] ->
+		p.created <- p.created + 1;
+		make width height format depth samples
+
+(** Give a target back to the pool *)
+let release p t =
+	let k = key t in
+	t.released <- p.frame;
+	Hashtbl.replace p.free k (t :: (try Hashtbl.find p.free k with Not_found -> []))
+
+(** Acquire a target for the rest of the frame *)
+let transient p ?depth ?samples width height format =
+	let t = acquire p ?depth ?samples width height format in
+	p.transients <- t :: p.transients;
+	t
+
+(** Release the transient targets, and delete the targets that have been free for more than [keep] frames *)
+let end_frame p =
+	List.iter (release p) p.transients;
+	p.transients <- [];
+	p.frame <- p.frame + 1;
+	Hashtbl.filter_map_inplace (fun _ l ->
+		let l, old = List.partition (fun t -> p.frame - t.released <= p.keep) l in
+		List.iter delete old;
+		if l = [] then None else Some l) p.free
+
+(** Draw into a target *)
+let bind t =
+	glBindFramebuffer gl_framebuffer t.framebuffer;
+	glViewport 0 0 t.width t.height
+
+(** The texture holding the colour of a target that is not multisampled *)
+let texture t =
+	if t.samples > 0 then invalid_argument "Render_target.texture: multisampled target";
+	t.color
+
+(** Copy the colour of src, e.g. a multisampled target, into dst, which has the same size *)
+let resolve src dst =
+	let bound = get gl_framebuffer_binding in
+	glBindFramebuffer gl_read_framebuffer src.framebuffer;
+	glBindFramebuffer gl_draw_framebuffer dst.framebuffer;
+	glBlitFramebuffer 0 0 src.width src.height 0 0 dst.width dst.height gl_color_buffer_bit gl_nearest;
+	glBindFramebuffer gl_framebuffer bound
+
+(** Delete every target of the pool; acquired targets must be deleted with [delete] *)
+let destroy p =
+	List.iter (release p) p.transients;
+	p.transients <- [];
+	Hashtbl.iter (fun _ l -> List.iter delete l) p.free;
+	Hashtbl.reset p.free
+
+end
+
+module Handle = struct
+
+(** Garbage-collected object handles.
+	A handle owns the name of a texture, buffer, program or other GL object, and deletes it when the handle is
+	collected: the finalizer queues the name, and the queue is emptied by [collect], which this module registers
+	with the Ocaml runtime so that [Win.swap_buffers] and [Sdl.swap_buffers] call it after every swap, on the
+	thread that owns the context. Programs that swap buffers some other way must call [collect] once per frame.
+	[delete] deletes an object at once. Each handle carries an estimated size in bytes, given when it is created
+	and updated with [set_bytes] after allocating storage; both are reported to the GC, so that handles of large
+	objects are collected sooner. [live] and [bytes] count the objects of each kind that have not been deleted
+	yet, including those whose deletion function is missing: [delete] raises [Failure] for them, and [check_error]
+	does for the ones [collect] could not delete. *)
+type t
+
+(** Object kinds, in the order glcaml_stub.c expects them *)
+type kind =
+	| Texture
+	| Buffer
+	| Renderbuffer
+	| Framebuffer
+	| Program
+	| Shader
+	| Vertex_array
+	| Query
+	| Sampler
+
+(** [wrap kind name bytes] takes ownership of an existing object *)
+external wrap : kind -> int -> int -> t = "glstub_handle_wrap"
+
+(** The name of the object; raises [Invalid_argument] once it has been deleted *)
+external name : t -> int = "glstub_handle_name"
+
+(** Set the estimated size of the object, e.g. after [glBufferData] or [glTexImage2D] *)
+external set_bytes : t -> int -> unit = "glstub_handle_set_bytes"
+
+(** Delete the object now *)
+external delete : t -> unit = "glstub_handle_delete"
+
+(** Delete the objects of the handles collected so far. The context must be current *)
+external collect : unit -> unit = "glstub_handle_collect"
+let _ = Callback.register "Glcaml.Handle.collect" collect
+
+(** Number and estimated bytes of the objects of a kind that have not been deleted *)
+external live : kind -> int = "glstub_handle_live"
+external bytes : kind -> int = "glstub_handle_bytes"
+
+let kinds = [Texture; Buffer; Renderbuffer; Framebuffer; Program; Shader; Vertex_array; Query; Sampler]
+
+(** Live count and estimated bytes of every kind *)
+let stats () = List.map (fun k -> (k, live k, bytes k)) kinds
+
+let gen kind f bytes =
+	let a = [| 0 |] in
+	f 1 a;
+	wrap kind a.(0) bytes
+
+(** Create an object of each kind, with an optional size estimate *)
+let texture ?(bytes = 0) () = gen Texture glGenTextures bytes
+let buffer ?(bytes = 0) () = gen Buffer glGenBuffers bytes
+let renderbuffer ?(bytes = 0) () = gen Renderbuffer glGenRenderbuffers bytes
+let framebuffer () = gen Framebuffer glGenFramebuffers 0
+let vertex_array () = gen Vertex_array glGenVertexArrays 0
+let query () = gen Query glGenQueries 0
+let sampler () = gen Sampler glGenSamplers 0
+let program () = wrap Program (glCreateProgram ()) 0
+let shader kind = wrap Shader (glCreateShader kind) 0
+
+end
+
+module Residency = struct
+
+(** Texture residency.
+	A manager keeps the textures it knows within a budget of bytes. [use m tex] returns the texture name to bind,
+	reloading the texture if it was evicted, and marks it as used in the current frame. When the textures exceed
+	the budget, the least recently used ones are evicted: a texture added with [add_reload] is deleted and its
+	load function is called again on its next use; one added with [add_cached] is read back into a Bigarray in
+	main memory first and uploaded again from there, as RGBA8 with linear filtering and, if it had them, mipmaps.
+	Textures used in the current frame are never evicted, so the budget may be exceeded until [end_frame].
+	[hit_rate] gives the fraction of uses that found the texture resident; first loads count as misses.
+	Loads and readbacks change the [gl_texture_2d] binding. *)
+type source =
+	| Reload of (unit -> int * int)
+	| Cached of int * int * bool
+
+(* Resident textures form a doubly linked list from the most recently used (newest) to the least recently used
+	(oldest), so that marking a texture as used and evicting the oldest one are constant time *)
+type texture = {
+	source : source;
+	mutable name : int;
+	mutable bytes : int;
+	mutable last_used : int;
+	mutable pixels : ubyte_array;
+	mutable newer : texture option;
+	mutable older : texture option
+}
+
+type t = {
+	mutable budget : int;
+	mutable used : int;
+	mutable frame : int;
+	mutable newest : texture option;
+	mutable oldest : texture option;
+	mutable hits : int;
+	mutable misses : int;
+	mutable evictions : int
+}
+
+(** Create a manager with a budget in bytes *)
+let create budget = {
+	budget = budget;
+	used = 0;
+	frame = 0;
+	newest = None;
+	oldest = None;
+	hits = 0;
+	misses = 0;
+	evictions = 0
+}
+
+let set_budget m budget = m.budget <- budget
+
+(** Bytes of the resident textures *)
+let used m = m.used
+
+(** Number of uses that found the texture resident, of uses that loaded it, and of evictions *)
+let hits m = m.hits
+let misses m = m.misses
+let evictions m = m.evictions
+
+let hit_rate m = if m.hits + m.misses = 0 then 1. else float_of_int m.hits /. float_of_int (m.hits + m.misses)
+
+let reset_counters m =
+	m.hits <- 0;
+	m.misses <- 0;
+	m.evictions <- 0
+
+(** The name of a texture, 0 while it is evicted *)
+let name tex = tex.name
+
+let no_pixels = make_ubyte_array 0
+
+let unlink m tex =
+	(match tex.newer with Some t -> t.older <- tex.older | None -> m.newest <- tex.older);
+	(match tex.older with Some t -> t.newer <- tex.newer | None -> m.oldest <- tex.newer);
+	tex.newer <- None;
+	tex.older <- None
+
+let push m tex =
+	tex.older <- m.newest;
+	(match m.newest with Some t -> t.newer <- Some tex | None -> m.oldest <- Some tex);
+	m.newest <- Some tex
+
+let add m source name bytes =
+	let tex = { source = source; name = name; bytes = bytes; last_used = m.frame; pixels = no_pixels; newer = None; older = None } in
+	if name <> 0 then begin
+		push m tex;
+		m.used <- m.used + bytes
+	end;
+	tex
+
+(** Add a texture created by load, which returns its name and size in bytes. It is loaded on first use *)
+let add_reload m load = add m (Reload load) 0 0
+
+(** Add an existing RGBA texture of the given size, kept in main memory while it is evicted *)
+let add_cached m ?(mipmap = false) width height name =
+	add m (Cached (width, height, mipmap)) name (width * height * 4 * (if mipmap then 4 else 3) / 3)
+
+let unload m tex =
+	glDeleteTextures 1 [| tex.name |];
+	tex.name <- 0;
+	unlink m tex;
+	m.used <- m.used - tex.bytes
+
+let evict m tex =
+	(match tex.source with
+	| Cached (width, height, _) ->
+		tex.pixels <- make_ubyte_array (width * height * 4);
+		glBindTexture gl_texture_2d tex.name;
+		glGetTexImage gl_texture_2d 0 gl_rgba gl_unsigned_byte tex.pixels
+	| Reload _ -> ());
+	unload m tex;
+	m.evictions <- m.evictions + 1
+
+let load m tex =
+	(match tex.source with
+	| Reload f ->
+		let name, bytes = f () in
+		tex.name <- name;
+		tex.bytes <- bytes
+	| Cached (width, height, mipmap) ->
+		if Bigarray.Array1.dim tex.pixels = 0 then invalid_argument "Residency.use: the texture has been removed";
+		let a = [| 0 |] in
+		glGenTextures 1 a;
+		glBindTexture gl_texture_2d a.(0);
+		glTexImage2D gl_texture_2d 0 gl_rgba8 width height 0 gl_rgba gl_unsigned_byte tex.pixels;
+		glTexParameteri gl_texture_2d gl_texture_mag_filter gl_linear;
+		if mipmap then begin
+			glTexParameteri gl_texture_2d gl_texture_min_filter gl_linear_mipmap_linear;
+			glGenerateMipmap gl_texture_2d
+		end else
+			glTexParameteri gl_texture_2d gl_texture_min_filter gl_linear;
+		tex.name <- a.(0);
+		tex.pixels <- no_pixels);
+	push m tex;
+	m.used <- m.used + tex.bytes
+
+(* Evict least recently used textures, except those used in this frame, until needed more bytes fit *)
+let rec make_room m needed =
+	if m.used + needed > m.budget then
+		match m.oldest with
+		| Some tex when tex.last_used < m.frame ->
+			evict m tex;
+			make_room m needed
+		| _ -> ()
+
+(** The name of a texture, loading it if needed, and mark it as used in this frame *)
+let use m tex =
+	tex.last_used <- m.frame;
+	if tex.name <> 0 then begin
+		m.hits <- m.hits + 1;
+		match m.newest with
+		| Some t when t == tex -> ()
+		| _ ->
+			unlink m tex;
+			push m tex
+	end else begin
+		m.misses <- m.misses + 1;
+		make_room m tex.bytes;
+		load m tex;
+		make_room m 0
+	end;
+	tex.name
+
+(** Bind a texture, loading it if needed *)
+let bind m target tex = glBindTexture target (use m tex)
+
+(** Start a new frame, evicting textures if the budget is exceeded *)
+let end_frame m =
+	m.frame <- m.frame + 1;
+	make_room m 0
+
+(** Delete a texture and forget it *)
+let remove m tex =
+	if tex.name <> 0 then unload m tex;
+	tex.pixels <- no_pixels
+
+end
+
+module Render_queue = struct
+
+(** Render queue.
+	Draws are submitted in any order with [add q ~pass ~program ~texture ~depth payload] and replayed by
+	[execute q draw], which sorts them by pass, program, texture and depth (front to back, depth from 0. to 1.),
+	binds each program and texture once per run of draws that share it, and calls [draw payload] for every draw.
+	The sort is a radix sort in C over 64-bit keys; only the low 12 bits of program and texture names go into the
+	keys, so names beyond 4095 may interleave, which costs extra binds but never binds the wrong object. Passes
+	range from 0 to 15 and a queue holds up to 2^20 draws. The storage is kept and grows as needed, so a queue
+	that is refilled every frame allocates nothing. *)
+type t = {
+	mutable draws : word_array;
+	mutable payloads : int array;
+	mutable keys : dword_array;
+	mutable order : word_array;
+	mutable length : int;
+	mutable program_binds : int;
+	mutable texture_binds : int
+}
+
+external sort' : word_array -> int -> dword_array -> word_array -> unit = "glstub_render_queue_sort"
+
+let max_length = 1 lsl 20
+
+(** Create an empty queue with room for n draws *)
+let create n =
+	let n = min (max n 16) max_length in
+	{
+		draws = make_word_array (4 * n);
+		payloads = Array.make n 0;
+		keys = make_dword_array (2 * n);
+		order = make_word_array n;
+		length = 0;
+		program_binds = 0;
+		texture_binds = 0
+	}
+
+(** Number of draws in q *)
+let length q = q.length
+
+(** Discard all draws, keeping the storage *)
+let clear q = q.length <- 0
+
+(** Number of glUseProgram and glBindTexture calls made by the last [execute] *)
+let program_binds q = q.program_binds
+let texture_binds q = q.texture_binds
+
+let grow q =
+	if q.length >= max_length then invalid_argument "Render_queue.add: too many draws";
+	let n = min (2 * Array.length q.payloads) max_length in
+	let draws = make_word_array (4 * n) in
+	Bigarray.Array1.blit (Bigarray.Array1.sub q.draws 0 (4 * q.length)) (Bigarray.Array1.sub draws 0 (4 * q.length));
+	q.draws <- draws;
+	q.payloads <- Array.append q.payloads (Array.make (n - q.length) 0);
+	q.keys <- make_dword_array (2 * n);
+	q.order <- make_word_array n
+
+(** Queue a draw; raises [Invalid_argument] if pass is not between 0 and 15 *)
+let add q ~pass ~program ~texture ~depth payload =
+	if pass < 0 || pass > 15 then invalid_argument "Render_queue.add: pass out of 0..15";
+	if q.length = Array.length q.payloads then grow q;
+	let i = q.length in
+	let o = 4 * i in
+	let d = if depth <= 0. then 0 else if depth >= 1. then 0xffff else truncate (depth *. 65535.) in
+	Bigarray.Array1.unsafe_set q.draws o (Int32.of_int pass);
+	Bigarray.Array1.unsafe_set q.draws (o + 1) (Int32.of_int program);
+	Bigarray.Array1.unsafe_set q.draws (o + 2) (Int32.of_int texture);
+	Bigarray.Array1.unsafe_set q.draws (o + 3) (Int32.of_int d);
+	q.payloads.(i) <- payload;
+	q.length <- i + 1
+
+(** Sort the draws; [sorted q k] is then the payload of the k-th draw *)
+let sort q = sort' q.draws q.length q.keys q.order
+
+let sorted q k = q.payloads.(Int32.to_int q.order.{k})
+
+(** Sort and replay the draws, binding programs and textures (on [gl_texture_2d]) as needed. pass is called when
+	a new pass begins, before its first draw, e.g. to bind its render target *)
+let execute q ?(pass = fun _ -> ()) draw =
+	sort q;
+	q.program_binds <- 0;
+	q.texture_binds <- 0;
+	let current_pass = ref (-1) and program = ref (-1) and texture = ref (-1) in
+	for k = 0 to q.length - 1 do
+		let i = Int32.to_int (Bigarray.Array1.unsafe_get q.order k) in
+		let o = 4 * i in
+		let p = Int32.to_int (Bigarray.Array1.unsafe_get q.draws o) in
+		if p <> !current_pass then begin
+			current_pass := p;
+			program := -1;
+			texture := -1;
+			pass p
+		end;
+		let prog = Int32.to_int (Bigarray.Array1.unsafe_get q.draws (o + 1)) in
+		if prog <> !program then begin
+			program := prog;
+			q.program_binds <- q.program_binds + 1;
+			glUseProgram prog
+		end;
+		let tex = Int32.to_int (Bigarray.Array1.unsafe_get q.draws (o + 2)) in
+		if tex <> !texture then begin
+			texture := tex;
+			q.texture_binds <- q.texture_binds + 1;
+			glBindTexture gl_texture_2d tex
+		end;
+		draw q.payloads.(i)
+	done
+
+end
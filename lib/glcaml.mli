@@ -73,22 +73,131 @@ The parameters are translated according to the following table:
 - GLboolean** 	-> word_matrix
 - GLsizei*   	-> int array
 - GLenum*    	-> int array
+- GLint64*   	-> int array
+- GLuint64*   	-> int array
+- GLint64    	-> int
+- GLuint64    	-> int
+- GLsync    	-> sync
 
 
+The OpenGL 3.x and 4.x entry points for instancing, base vertices, multi-draw, indirect draws, sync objects and
+samplers are included. Sync objects returned by [glFenceSync] have the abstract type [sync], and [GLuint64] timeouts
+are ints counting nanoseconds. The [indirect] argument of [glDrawArraysIndirect], [glMultiDrawElementsIndirect] and
+the like is a byte offset into the buffer bound to [gl_draw_indirect_buffer], so these functions only take scalars.
+
 Void pointers are represented by the polymorphic type ['a], but in the FFI only strings, Bigarrays, or foreign-function interface bindings to C arrays 
 are actually processed properly (such as [SDLCaml.surface_pixels] which returns in essence a pointer to an array containing the bitmap contents).
 Passing other types will most likely result in a segfault. 
+The gl*Pointer functions (and [glInterleavedArrays]) are the exception: OpenGL keeps the pointer and reads the array
+when drawing, after the garbage collector may have moved a string or freed a Bigarray, so they only accept integer offsets
+into a bound buffer object and Bigarrays whose memory the garbage collector does not own, and raise [Invalid_argument]
+otherwise. The submodule [Arena] provides reusable client arrays allocated outside the Ocaml heap for them.
 
 There is one function ([glEdgeFlagPointerListIBM]) which requires an array of arrays of Booleans. The array of array of GLbooleans is in GLCaml
 in this single instance represented by a 2-dimensional Bigarray of 32-bit integers, so manual conversion from and to bools need to take place.
 All other conversions are handled automatically by GLCaml.
 
+The automatic conversions allocate a fresh Bigarray and copy the Ocaml array into it on every call, and copy mutable
+parameters back afterwards. For code that calls such functions every frame, the submodule [Direct] contains the
+unconverted bindings of every function that takes array arguments: they accept the Bigarray types listed in the table
+above ([word_array], [float_array], [ubyte_array], ...) as-is and write results straight into them, so preallocated
+buffers can be reused without any allocation or copying. [Direct] can be opened after [Glcaml] to replace the
+converting bindings, e.g. [Direct.glUniformMatrix4fv loc 1 false m] with [m : float_array].
+[shader_source] and [compile_shaders] pass string arrays to [glShaderSource] with the lengths of the strings,
+without converting anything; [compile_shaders] sets the sources of many shaders and compiles them in one call.
+
 The parameter conversion convention means that a lot of the OpenGL functions are superfluous in GLCaml, since they have the same Ocaml signature
 despite having different C signatures. [glVertex2i] and [glVertex2s], for instance, take int and short arguments respectively in C, but both take native 
 integers in Ocaml. Likewise [glVertex2f] (single-precision floats) and [glVertex2d] (double precision floats) both translate to having double precision float arguments
 in the Ocaml bindings. This also means that precision may be lost or overflow may occur when using integer arguments for an OpenGL function that
 uses 8-bit or 16-bit integers; likewise when using Ocaml floats for OpenGL functions using single-precision floats.
 
+Functions that take and return only scalars ([int], [float], [bool], [unit]) are declared [[@@noalloc]], with
+[float] arguments [[@unboxed]] and [int] arguments [[@untagged]]. In native code they call straight into a C stub that
+receives raw doubles and integers, skipping the boxing and the GC root registration of the bytecode stubs.
+This requires Ocaml 4.03 or higher.
+
+The same scalar functions can also be recorded into a command buffer (submodule [Cmdbuf]) instead of being called:
+[Cmdbuf.glEnable b gl_blend] appends an opcode and its operands to a growable Bigarray, and [Cmdbuf.execute b]
+replays everything recorded in [b] with a single call into C. Buffers are kept until cleared, so they can be
+resubmitted every frame.
+
+Redundant state changes can be filtered out with the submodule [Cached], which shadows [glBindTexture], [glBindBuffer],
+[glUseProgram], [glEnable], [glDisable], [glBlendFunc] and a few related functions, remembers the values they set for each
+context, and drops calls that would set a value that is already current. [Cached.elided ()] counts the dropped calls.
+
+Buffer objects can be filled without an intermediate copy through the submodule [Mapped], whose [glMapBuffer] and
+[glMapBufferRange] return a Bigarray (e.g. a [float_array]) aliasing the mapped buffer memory. Views are invalidated
+by [Mapped.glUnmapBuffer].
+
+The submodule [Readback] reads the framebuffer asynchronously: [Readback.read] queues a [glReadPixels] into a ring of
+pixel pack buffers and returns a ticket, whose pixels can be fetched a few frames later without stalling, either as a
+Bigarray or straight into an image with a row pitch such as an SDL surface.
+
+Textures that change every frame can be updated through the submodule [Texture_stream], which writes each new image
+into a mapped pixel unpack buffer and uploads it with an asynchronous [glTexSubImage2D].
+
+GPU time can be measured with the submodule [Gpu_profiler]: [begin_scope]/[end_scope] bracket named parts of a frame,
+timed with ARB_timer_query or EXT_timer_query, and [report] gives the minimum, average and maximum time of each scope.
+Results are read back a few frames late so as not to stall; without timer queries the profiler does nothing.
+
+When [glcaml_stub.c] is compiled with [GLCAML_PROFILE] defined, every binding counts its calls and the CPU time spent
+in it; the submodule [Stats] reports and resets these counters.
+
+Many meshes stored in the same buffers can be drawn with one call through the submodule [Batch]: [Batch.add] appends
+the range of one mesh, and [Batch.flush_arrays] or [Batch.flush_elements] hands all ranges to [glMultiDrawArrays] or
+[glMultiDrawElements] as Bigarrays, without copying them.
+
+Matrices for [glUniformMatrix4fv] can be built with the submodule [Mat4]: 4x4 matrices are [float_array]s in
+column-major order, multiplied, inverted and projected in C, and [Mat4.stack] gives a matrix stack in the style of
+the fixed-function one whose top is passed to OpenGL without conversion.
+
+Legacy [glBegin]/[glEnd] drawing code can be sped up with the submodule [Recorder], whose versions of [glBegin],
+[glVertex3f], [glColor3f] and the like call OpenGL as usual, except inside [Recorder.record f]: there the geometry
+drawn by f is captured into a buffer object, and the returned mesh is redrawn with [Recorder.draw] in a few calls.
+
+Shader programs can be stored on disk with the submodule [Program_cache]: [Program_cache.program] compiles and
+links the sources once, saves the result with [glGetProgramBinary], and loads it with [glProgramBinary] on later
+runs, as long as the sources, the key of the setup function and the OpenGL driver are unchanged.
+
+Many programs can be built without blocking the first frames through the submodule [Shader_compiler]:
+[Shader_compiler.submit] queues a program and [Shader_compiler.update], called once per frame, finishes the ones
+that are ready. With KHR_parallel_shader_compile the driver compiles them on its own threads; otherwise a few are
+compiled in every frame, within a time budget.
+
+The CPU and the GPU can be kept apart with the submodule [Fence]: [Fence.insert] fences the commands issued so
+far and [Fence.wait] waits for the GPU to pass the fence, releasing the Ocaml runtime lock while it waits.
+[Fence.ring] tells when each region of a ring buffer may be overwritten, without [glFinish].
+
+Render-to-texture passes can share framebuffer objects through the submodule [Render_target], a pool of targets
+keyed by size, format and number of samples: [Render_target.acquire] and [Render_target.release] (or
+[Render_target.transient], released at the end of the frame) recycle the same textures and renderbuffers from pass
+to pass and from frame to frame, so steady-state frames create none.
+
+GL objects can be owned by the garbage collector through the submodule [Handle]: a handle deletes its texture,
+buffer, program or other object once it is collected, at the next [Win.swap_buffers] or [Sdl.swap_buffers] (or
+[Handle.collect]), and [Handle.stats] counts the live objects and their estimated bytes of each kind.
+
+Scenes with more textures than video memory can use the submodule [Residency], which keeps textures within a
+budget of bytes by evicting the least recently used ones, either to a copy in main memory or to a reload function,
+and reloads them on their next [Residency.use]. [Residency.hit_rate] tells how often textures were resident.
+
+Draws can be reordered to save state changes with the submodule [Render_queue]: [Render_queue.add] queues a draw
+with its pass, program, texture and depth, and [Render_queue.execute] sorts the queue with a radix sort in C and
+replays it, binding each program and texture once per run of draws that use it.
+
+Every binding can check for OpenGL errors: when [glcaml_stub.c] is compiled with [GLCAML_CHECKED] defined, each call
+is followed by [glGetError], and an error raises [Gl_error] with a message naming the function and its arguments.
+Arrays that are too short for the call, such as fewer than [16 * count] floats for [glUniformMatrix4fv], raise
+[Invalid_argument] before reaching OpenGL. The [[@@noalloc]] bindings cannot raise, so they keep their error until
+the next call of another binding or of [check_error]. Without [GLCAML_CHECKED] none of this is compiled in, and
+[check_error] can be called at chosen points instead.
+
+OpenGL functions are looked up in the OpenGL library the first time they are called, and the result is cached,
+so only the functions a program uses are ever resolved; no GLEW or other initialisation is needed. If a function
+is not available, calling it raises [Failure] in bytecode, while the [[@@noalloc]] native bindings cannot raise:
+they do nothing, return 0 or [false], and the [Failure] is raised by the next call of [check_error]. Use [preload] to resolve functions up front and check that they exist.
+
 Note that most OpenGL implementations use single-precision floating point internally, even if the call is made with an API function using doubles.
 OpenGL 3.0, due to be released in 2008, will only support single precision floating point.
 
@@ -129,6 +238,7 @@ type float_matrix =
     (float, Bigarray.float32_elt, Bigarray.c_layout) Bigarray.Array2.t
 type double_matrix =
     (float, Bigarray.float64_elt, Bigarray.c_layout) Bigarray.Array2.t
+type sync
 val make_byte_array :
   int -> (int, Bigarray.int8_signed_elt, Bigarray.c_layout) Bigarray.Array1.t
 val make_ubyte_array :
@@ -221,6 +331,13 @@ val bool_of_int : int -> bool
 val bool_to_int_array : bool array -> int array
 val int_to_bool_array : int array -> bool array
 val copy_to_bool_array : int array -> bool array -> unit array
+external preload : string list -> unit = "glstub_preload"
+val glewInit : unit -> int
+exception Gl_error of string * int
+external check_error : unit -> unit = "glstub_check_error"
+external shader_source : int -> string array -> unit = "glstub_shader_source"
+external compile_shaders : int array -> string array array -> unit
+  = "glstub_compile_shaders"
 val gl_constant_color : int
 val gl_one_minus_constant_color : int
 val gl_constant_alpha : int
@@ -3055,273 +3172,560 @@ val gl_compressed_srgb : int
 val gl_compressed_srgb_alpha : int
 val gl_compressed_sluminance : int
 val gl_compressed_sluminance_alpha : int
-external glAccum : int -> float -> unit = "glstub_glAccum" "glstub_glAccum"
-external glActiveStencilFaceEXT : int -> unit
-  = "glstub_glActiveStencilFaceEXT" "glstub_glActiveStencilFaceEXT"
-external glActiveTexture : int -> unit = "glstub_glActiveTexture"
-  "glstub_glActiveTexture"
-external glActiveTextureARB : int -> unit = "glstub_glActiveTextureARB"
-  "glstub_glActiveTextureARB"
+val gl_map_read_bit : int
+val gl_map_write_bit : int
+val gl_map_invalidate_range_bit : int
+val gl_map_invalidate_buffer_bit : int
+val gl_map_flush_explicit_bit : int
+val gl_map_unsynchronized_bit : int
+val gl_time_elapsed_ext : int
+val gl_time_elapsed : int
+val gl_timestamp : int
+val gl_major_version : int
+val gl_minor_version : int
+val gl_num_extensions : int
+val gl_context_flags : int
+val gl_rgba32f : int
+val gl_rgb32f : int
+val gl_rgba16f : int
+val gl_rgb16f : int
+val gl_half_float : int
+val gl_rg : int
+val gl_rg_integer : int
+val gl_r8 : int
+val gl_r16 : int
+val gl_rg8 : int
+val gl_rg16 : int
+val gl_r16f : int
+val gl_r32f : int
+val gl_rg16f : int
+val gl_rg32f : int
+val gl_depth_component32f : int
+val gl_depth32f_stencil8 : int
+val gl_depth_stencil : int
+val gl_unsigned_int_24_8 : int
+val gl_depth24_stencil8 : int
+val gl_framebuffer : int
+val gl_read_framebuffer : int
+val gl_draw_framebuffer : int
+val gl_renderbuffer : int
+val gl_framebuffer_complete : int
+val gl_framebuffer_binding : int
+val gl_draw_framebuffer_binding : int
+val gl_read_framebuffer_binding : int
+val gl_renderbuffer_binding : int
+val gl_color_attachment0 : int
+val gl_color_attachment1 : int
+val gl_color_attachment2 : int
+val gl_color_attachment3 : int
+val gl_depth_attachment : int
+val gl_stencil_attachment : int
+val gl_depth_stencil_attachment : int
+val gl_max_samples : int
+val gl_vertex_array_binding : int
+val gl_copy_read_buffer : int
+val gl_copy_write_buffer : int
+val gl_uniform_buffer : int
+val gl_uniform_buffer_binding : int
+val gl_texture_buffer : int
+val gl_primitive_restart : int
+val gl_primitive_restart_index : int
+val gl_context_core_profile_bit : int
+val gl_context_compatibility_profile_bit : int
+val gl_context_profile_mask : int
+val gl_program_point_size : int
+val gl_texture_2d_multisample : int
+val gl_max_server_wait_timeout : int
+val gl_object_type : int
+val gl_sync_condition : int
+val gl_sync_status : int
+val gl_sync_flags : int
+val gl_sync_fence : int
+val gl_sync_gpu_commands_complete : int
+val gl_unsignaled : int
+val gl_signaled : int
+val gl_already_signaled : int
+val gl_timeout_expired : int
+val gl_condition_satisfied : int
+val gl_wait_failed : int
+val gl_sync_flush_commands_bit : int
+val gl_vertex_attrib_array_divisor : int
+val gl_sampler_binding : int
+val gl_any_samples_passed : int
+val gl_draw_indirect_buffer : int
+val gl_draw_indirect_buffer_binding : int
+val gl_atomic_counter_buffer : int
+val gl_atomic_counter_buffer_binding : int
+val gl_shader_storage_buffer : int
+val gl_shader_storage_buffer_binding : int
+val gl_dispatch_indirect_buffer : int
+val gl_dispatch_indirect_buffer_binding : int
+val gl_query_buffer : int
+val gl_query_buffer_binding : int
+val gl_map_persistent_bit : int
+val gl_map_coherent_bit : int
+val gl_dynamic_storage_bit : int
+val gl_client_storage_bit : int
+val gl_program_binary_retrievable_hint : int
+val gl_program_binary_length : int
+val gl_num_program_binary_formats : int
+val gl_program_binary_formats : int
+val gl_max_shader_compiler_threads_khr : int
+val gl_completion_status_khr : int
+val gl_max_shader_compiler_threads_arb : int
+val gl_completion_status_arb : int
+external glAccum : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glAccum" "glstub_glAccum_nat" [@@noalloc]
+external glActiveStencilFaceEXT : (int [@untagged]) -> unit
+  = "glstub_glActiveStencilFaceEXT" "glstub_glActiveStencilFaceEXT_nat"
+  [@@noalloc]
+external glActiveTexture : (int [@untagged]) -> unit
+  = "glstub_glActiveTexture" "glstub_glActiveTexture_nat" [@@noalloc]
+external glActiveTextureARB : (int [@untagged]) -> unit
+  = "glstub_glActiveTextureARB" "glstub_glActiveTextureARB_nat" [@@noalloc]
 external glActiveVaryingNV : int -> string -> unit
   = "glstub_glActiveVaryingNV" "glstub_glActiveVaryingNV"
-external glAddSwapHintRectWIN : int -> int -> int -> int -> unit
-  = "glstub_glAddSwapHintRectWIN" "glstub_glAddSwapHintRectWIN"
+external glAddSwapHintRectWIN :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAddSwapHintRectWIN" "glstub_glAddSwapHintRectWIN_nat"
+  [@@noalloc]
 external glAlphaFragmentOp1ATI :
-  int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glAlphaFragmentOp1ATI_byte" "glstub_glAlphaFragmentOp1ATI"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAlphaFragmentOp1ATI_byte" "glstub_glAlphaFragmentOp1ATI_nat"
+  [@@noalloc]
 external glAlphaFragmentOp2ATI :
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glAlphaFragmentOp2ATI_byte" "glstub_glAlphaFragmentOp2ATI"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAlphaFragmentOp2ATI_byte" "glstub_glAlphaFragmentOp2ATI_nat"
+  [@@noalloc]
 external glAlphaFragmentOp3ATI :
-  int ->
-  int ->
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glAlphaFragmentOp3ATI_byte" "glstub_glAlphaFragmentOp3ATI"
-external glAlphaFunc : int -> float -> unit = "glstub_glAlphaFunc"
-  "glstub_glAlphaFunc"
-external glApplyTextureEXT : int -> unit = "glstub_glApplyTextureEXT"
-  "glstub_glApplyTextureEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAlphaFragmentOp3ATI_byte" "glstub_glAlphaFragmentOp3ATI_nat"
+  [@@noalloc]
+external glAlphaFunc : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glAlphaFunc" "glstub_glAlphaFunc_nat" [@@noalloc]
+external glApplyTextureEXT : (int [@untagged]) -> unit
+  = "glstub_glApplyTextureEXT" "glstub_glApplyTextureEXT_nat" [@@noalloc]
 val glAreProgramsResidentNV : int -> int array -> bool array -> bool
 val glAreTexturesResident : int -> int array -> bool array -> bool
 val glAreTexturesResidentEXT : int -> int array -> bool array -> bool
-external glArrayElement : int -> unit = "glstub_glArrayElement"
-  "glstub_glArrayElement"
-external glArrayElementEXT : int -> unit = "glstub_glArrayElementEXT"
-  "glstub_glArrayElementEXT"
-external glArrayObjectATI : int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glArrayObjectATI_byte" "glstub_glArrayObjectATI"
-external glAsyncMarkerSGIX : int -> unit = "glstub_glAsyncMarkerSGIX"
-  "glstub_glAsyncMarkerSGIX"
-external glAttachObjectARB : int -> int -> unit = "glstub_glAttachObjectARB"
-  "glstub_glAttachObjectARB"
-external glAttachShader : int -> int -> unit = "glstub_glAttachShader"
-  "glstub_glAttachShader"
-external glBegin : int -> unit = "glstub_glBegin" "glstub_glBegin"
+external glArrayElement : (int [@untagged]) -> unit = "glstub_glArrayElement"
+  "glstub_glArrayElement_nat" [@@noalloc]
+external glArrayElementEXT : (int [@untagged]) -> unit
+  = "glstub_glArrayElementEXT" "glstub_glArrayElementEXT_nat" [@@noalloc]
+external glArrayObjectATI :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glArrayObjectATI_byte" "glstub_glArrayObjectATI_nat" [@@noalloc]
+external glAsyncMarkerSGIX : (int [@untagged]) -> unit
+  = "glstub_glAsyncMarkerSGIX" "glstub_glAsyncMarkerSGIX_nat" [@@noalloc]
+external glAttachObjectARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAttachObjectARB" "glstub_glAttachObjectARB_nat" [@@noalloc]
+external glAttachShader : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glAttachShader" "glstub_glAttachShader_nat" [@@noalloc]
+external glBegin : (int [@untagged]) -> unit = "glstub_glBegin"
+  "glstub_glBegin_nat" [@@noalloc]
 external glBeginFragmentShaderATI : unit -> unit
-  = "glstub_glBeginFragmentShaderATI" "glstub_glBeginFragmentShaderATI"
-external glBeginOcclusionQueryNV : int -> unit
-  = "glstub_glBeginOcclusionQueryNV" "glstub_glBeginOcclusionQueryNV"
-external glBeginQuery : int -> int -> unit = "glstub_glBeginQuery"
-  "glstub_glBeginQuery"
-external glBeginQueryARB : int -> int -> unit = "glstub_glBeginQueryARB"
-  "glstub_glBeginQueryARB"
+  = "glstub_glBeginFragmentShaderATI" "glstub_glBeginFragmentShaderATI_nat"
+  [@@noalloc]
+external glBeginOcclusionQueryNV : (int [@untagged]) -> unit
+  = "glstub_glBeginOcclusionQueryNV" "glstub_glBeginOcclusionQueryNV_nat"
+  [@@noalloc]
+external glBeginQuery : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBeginQuery" "glstub_glBeginQuery_nat" [@@noalloc]
+external glBeginQueryARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBeginQueryARB" "glstub_glBeginQueryARB_nat" [@@noalloc]
 external glBeginSceneEXT : unit -> unit = "glstub_glBeginSceneEXT"
-  "glstub_glBeginSceneEXT"
-external glBeginTransformFeedbackNV : int -> unit
-  = "glstub_glBeginTransformFeedbackNV" "glstub_glBeginTransformFeedbackNV"
+  "glstub_glBeginSceneEXT_nat" [@@noalloc]
+external glBeginTransformFeedbackNV : (int [@untagged]) -> unit
+  = "glstub_glBeginTransformFeedbackNV"
+  "glstub_glBeginTransformFeedbackNV_nat" [@@noalloc]
 external glBeginVertexShaderEXT : unit -> unit
-  = "glstub_glBeginVertexShaderEXT" "glstub_glBeginVertexShaderEXT"
+  = "glstub_glBeginVertexShaderEXT" "glstub_glBeginVertexShaderEXT_nat"
+  [@@noalloc]
 external glBindAttribLocation : int -> int -> string -> unit
   = "glstub_glBindAttribLocation" "glstub_glBindAttribLocation"
 external glBindAttribLocationARB : int -> int -> string -> unit
   = "glstub_glBindAttribLocationARB" "glstub_glBindAttribLocationARB"
-external glBindBuffer : int -> int -> unit = "glstub_glBindBuffer"
-  "glstub_glBindBuffer"
-external glBindBufferARB : int -> int -> unit = "glstub_glBindBufferARB"
-  "glstub_glBindBufferARB"
-external glBindBufferBaseNV : int -> int -> int -> unit
-  = "glstub_glBindBufferBaseNV" "glstub_glBindBufferBaseNV"
-external glBindBufferOffsetNV : int -> int -> int -> int -> unit
-  = "glstub_glBindBufferOffsetNV" "glstub_glBindBufferOffsetNV"
-external glBindBufferRangeNV : int -> int -> int -> int -> int -> unit
-  = "glstub_glBindBufferRangeNV" "glstub_glBindBufferRangeNV"
+external glBindBuffer : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBuffer" "glstub_glBindBuffer_nat" [@@noalloc]
+external glBindBufferARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferARB" "glstub_glBindBufferARB_nat" [@@noalloc]
+external glBindBufferBase :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferBase" "glstub_glBindBufferBase_nat" [@@noalloc]
+external glBindBufferBaseNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferBaseNV" "glstub_glBindBufferBaseNV_nat" [@@noalloc]
+external glBindBufferOffsetNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferOffsetNV" "glstub_glBindBufferOffsetNV_nat"
+  [@@noalloc]
+external glBindBufferRange :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferRange" "glstub_glBindBufferRange_nat" [@@noalloc]
+external glBindBufferRangeNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindBufferRangeNV" "glstub_glBindBufferRangeNV_nat" [@@noalloc]
 external glBindFragDataLocationEXT : int -> int -> string -> unit
   = "glstub_glBindFragDataLocationEXT" "glstub_glBindFragDataLocationEXT"
-external glBindFragmentShaderATI : int -> unit
-  = "glstub_glBindFragmentShaderATI" "glstub_glBindFragmentShaderATI"
-external glBindFramebufferEXT : int -> int -> unit
-  = "glstub_glBindFramebufferEXT" "glstub_glBindFramebufferEXT"
+external glBindFragmentShaderATI : (int [@untagged]) -> unit
+  = "glstub_glBindFragmentShaderATI" "glstub_glBindFragmentShaderATI_nat"
+  [@@noalloc]
+external glBindFramebuffer : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindFramebuffer" "glstub_glBindFramebuffer_nat" [@@noalloc]
+external glBindFramebufferEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindFramebufferEXT" "glstub_glBindFramebufferEXT_nat"
+  [@@noalloc]
 external glBindLightParameterEXT : int -> int -> int
-  = "glstub_glBindLightParameterEXT" "glstub_glBindLightParameterEXT"
+  = "glstub_glBindLightParameterEXT" "glstub_glBindLightParameterEXT_nat"
+  [@@noalloc] [@@untagged]
 external glBindMaterialParameterEXT : int -> int -> int
-  = "glstub_glBindMaterialParameterEXT" "glstub_glBindMaterialParameterEXT"
+  = "glstub_glBindMaterialParameterEXT"
+  "glstub_glBindMaterialParameterEXT_nat" [@@noalloc] [@@untagged]
 external glBindParameterEXT : int -> int = "glstub_glBindParameterEXT"
-  "glstub_glBindParameterEXT"
-external glBindProgramARB : int -> int -> unit = "glstub_glBindProgramARB"
-  "glstub_glBindProgramARB"
-external glBindProgramNV : int -> int -> unit = "glstub_glBindProgramNV"
-  "glstub_glBindProgramNV"
-external glBindRenderbufferEXT : int -> int -> unit
-  = "glstub_glBindRenderbufferEXT" "glstub_glBindRenderbufferEXT"
+  "glstub_glBindParameterEXT_nat" [@@noalloc] [@@untagged]
+external glBindProgramARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindProgramARB" "glstub_glBindProgramARB_nat" [@@noalloc]
+external glBindProgramNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindProgramNV" "glstub_glBindProgramNV_nat" [@@noalloc]
+external glBindRenderbuffer : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindRenderbuffer" "glstub_glBindRenderbuffer_nat" [@@noalloc]
+external glBindRenderbufferEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindRenderbufferEXT" "glstub_glBindRenderbufferEXT_nat"
+  [@@noalloc]
+external glBindSampler : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindSampler" "glstub_glBindSampler_nat" [@@noalloc]
 external glBindTexGenParameterEXT : int -> int -> int -> int
-  = "glstub_glBindTexGenParameterEXT" "glstub_glBindTexGenParameterEXT"
-external glBindTexture : int -> int -> unit = "glstub_glBindTexture"
-  "glstub_glBindTexture"
-external glBindTextureEXT : int -> int -> unit = "glstub_glBindTextureEXT"
-  "glstub_glBindTextureEXT"
+  = "glstub_glBindTexGenParameterEXT" "glstub_glBindTexGenParameterEXT_nat"
+  [@@noalloc] [@@untagged]
+external glBindTexture : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindTexture" "glstub_glBindTexture_nat" [@@noalloc]
+external glBindTextureEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBindTextureEXT" "glstub_glBindTextureEXT_nat" [@@noalloc]
 external glBindTextureUnitParameterEXT : int -> int -> int
   = "glstub_glBindTextureUnitParameterEXT"
-  "glstub_glBindTextureUnitParameterEXT"
-external glBindVertexArray : int -> unit = "glstub_glBindVertexArray"
-  "glstub_glBindVertexArray"
-external glBindVertexArrayAPPLE : int -> unit
-  = "glstub_glBindVertexArrayAPPLE" "glstub_glBindVertexArrayAPPLE"
-external glBindVertexShaderEXT : int -> unit = "glstub_glBindVertexShaderEXT"
-  "glstub_glBindVertexShaderEXT"
+  "glstub_glBindTextureUnitParameterEXT_nat" [@@noalloc] [@@untagged]
+external glBindVertexArray : (int [@untagged]) -> unit
+  = "glstub_glBindVertexArray" "glstub_glBindVertexArray_nat" [@@noalloc]
+external glBindVertexArrayAPPLE : (int [@untagged]) -> unit
+  = "glstub_glBindVertexArrayAPPLE" "glstub_glBindVertexArrayAPPLE_nat"
+  [@@noalloc]
+external glBindVertexShaderEXT : (int [@untagged]) -> unit
+  = "glstub_glBindVertexShaderEXT" "glstub_glBindVertexShaderEXT_nat"
+  [@@noalloc]
 external glBinormalPointerEXT : int -> int -> 'a -> unit
   = "glstub_glBinormalPointerEXT" "glstub_glBinormalPointerEXT"
 val glBitmap :
   int -> int -> float -> float -> float -> float -> int array -> unit
-external glBlendColor : float -> float -> float -> float -> unit
-  = "glstub_glBlendColor" "glstub_glBlendColor"
-external glBlendColorEXT : float -> float -> float -> float -> unit
-  = "glstub_glBlendColorEXT" "glstub_glBlendColorEXT"
-external glBlendEquation : int -> unit = "glstub_glBlendEquation"
-  "glstub_glBlendEquation"
-external glBlendEquationEXT : int -> unit = "glstub_glBlendEquationEXT"
-  "glstub_glBlendEquationEXT"
-external glBlendEquationSeparate : int -> int -> unit
-  = "glstub_glBlendEquationSeparate" "glstub_glBlendEquationSeparate"
-external glBlendEquationSeparateEXT : int -> int -> unit
-  = "glstub_glBlendEquationSeparateEXT" "glstub_glBlendEquationSeparateEXT"
-external glBlendFunc : int -> int -> unit = "glstub_glBlendFunc"
-  "glstub_glBlendFunc"
-external glBlendFuncSeparate : int -> int -> int -> int -> unit
-  = "glstub_glBlendFuncSeparate" "glstub_glBlendFuncSeparate"
-external glBlendFuncSeparateEXT : int -> int -> int -> int -> unit
-  = "glstub_glBlendFuncSeparateEXT" "glstub_glBlendFuncSeparateEXT"
+external glBlendColor :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glBlendColor" "glstub_glBlendColor_nat" [@@noalloc]
+external glBlendColorEXT :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glBlendColorEXT" "glstub_glBlendColorEXT_nat" [@@noalloc]
+external glBlendEquation : (int [@untagged]) -> unit
+  = "glstub_glBlendEquation" "glstub_glBlendEquation_nat" [@@noalloc]
+external glBlendEquationEXT : (int [@untagged]) -> unit
+  = "glstub_glBlendEquationEXT" "glstub_glBlendEquationEXT_nat" [@@noalloc]
+external glBlendEquationSeparate :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlendEquationSeparate" "glstub_glBlendEquationSeparate_nat"
+  [@@noalloc]
+external glBlendEquationSeparateEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlendEquationSeparateEXT"
+  "glstub_glBlendEquationSeparateEXT_nat" [@@noalloc]
+external glBlendFunc : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlendFunc" "glstub_glBlendFunc_nat" [@@noalloc]
+external glBlendFuncSeparate :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlendFuncSeparate" "glstub_glBlendFuncSeparate_nat" [@@noalloc]
+external glBlendFuncSeparateEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlendFuncSeparateEXT" "glstub_glBlendFuncSeparateEXT_nat"
+  [@@noalloc]
+external glBlitFramebuffer :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlitFramebuffer_byte" "glstub_glBlitFramebuffer_nat"
+  [@@noalloc]
 external glBlitFramebufferEXT :
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glBlitFramebufferEXT_byte" "glstub_glBlitFramebufferEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glBlitFramebufferEXT_byte" "glstub_glBlitFramebufferEXT_nat"
+  [@@noalloc]
 external glBufferData : int -> int -> 'a -> int -> unit
   = "glstub_glBufferData" "glstub_glBufferData"
 external glBufferDataARB : int -> int -> 'a -> int -> unit
   = "glstub_glBufferDataARB" "glstub_glBufferDataARB"
+external glBufferStorage : int -> int -> 'a -> int -> unit
+  = "glstub_glBufferStorage" "glstub_glBufferStorage"
 external glBufferSubData : int -> int -> int -> 'a -> unit
   = "glstub_glBufferSubData" "glstub_glBufferSubData"
 external glBufferSubDataARB : int -> int -> int -> 'a -> unit
   = "glstub_glBufferSubDataARB" "glstub_glBufferSubDataARB"
-external glCallList : int -> unit = "glstub_glCallList" "glstub_glCallList"
+external glCallList : (int [@untagged]) -> unit = "glstub_glCallList"
+  "glstub_glCallList_nat" [@@noalloc]
 external glCallLists : int -> int -> 'a -> unit = "glstub_glCallLists"
   "glstub_glCallLists"
+external glCheckFramebufferStatus : int -> int
+  = "glstub_glCheckFramebufferStatus" "glstub_glCheckFramebufferStatus_nat"
+  [@@noalloc] [@@untagged]
 external glCheckFramebufferStatusEXT : int -> int
-  = "glstub_glCheckFramebufferStatusEXT" "glstub_glCheckFramebufferStatusEXT"
-external glClampColorARB : int -> int -> unit = "glstub_glClampColorARB"
-  "glstub_glClampColorARB"
-external glClear : int -> unit = "glstub_glClear" "glstub_glClear"
-external glClearAccum : float -> float -> float -> float -> unit
-  = "glstub_glClearAccum" "glstub_glClearAccum"
-external glClearColor : float -> float -> float -> float -> unit
-  = "glstub_glClearColor" "glstub_glClearColor"
-external glClearColorIiEXT : int -> int -> int -> int -> unit
-  = "glstub_glClearColorIiEXT" "glstub_glClearColorIiEXT"
-external glClearColorIuiEXT : int -> int -> int -> int -> unit
-  = "glstub_glClearColorIuiEXT" "glstub_glClearColorIuiEXT"
-external glClearDepth : float -> unit = "glstub_glClearDepth"
-  "glstub_glClearDepth"
-external glClearDepthdNV : float -> unit = "glstub_glClearDepthdNV"
-  "glstub_glClearDepthdNV"
-external glClearDepthfOES : float -> unit = "glstub_glClearDepthfOES"
-  "glstub_glClearDepthfOES"
-external glClearIndex : float -> unit = "glstub_glClearIndex"
-  "glstub_glClearIndex"
-external glClearStencil : int -> unit = "glstub_glClearStencil"
-  "glstub_glClearStencil"
-external glClientActiveTexture : int -> unit = "glstub_glClientActiveTexture"
-  "glstub_glClientActiveTexture"
-external glClientActiveTextureARB : int -> unit
-  = "glstub_glClientActiveTextureARB" "glstub_glClientActiveTextureARB"
-external glClientActiveVertexStreamATI : int -> unit
+  = "glstub_glCheckFramebufferStatusEXT"
+  "glstub_glCheckFramebufferStatusEXT_nat" [@@noalloc] [@@untagged]
+external glClampColorARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glClampColorARB" "glstub_glClampColorARB_nat" [@@noalloc]
+external glClear : (int [@untagged]) -> unit = "glstub_glClear"
+  "glstub_glClear_nat" [@@noalloc]
+external glClearAccum :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glClearAccum" "glstub_glClearAccum_nat" [@@noalloc]
+val glClearBufferfv : int -> int -> float array -> unit
+val glClearBufferiv : int -> int -> int array -> unit
+external glClearColor :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glClearColor" "glstub_glClearColor_nat" [@@noalloc]
+external glClearColorIiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glClearColorIiEXT" "glstub_glClearColorIiEXT_nat" [@@noalloc]
+external glClearColorIuiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glClearColorIuiEXT" "glstub_glClearColorIuiEXT_nat" [@@noalloc]
+external glClearDepth : (float [@unboxed]) -> unit = "glstub_glClearDepth"
+  "glstub_glClearDepth_nat" [@@noalloc]
+external glClearDepthdNV : (float [@unboxed]) -> unit
+  = "glstub_glClearDepthdNV" "glstub_glClearDepthdNV_nat" [@@noalloc]
+external glClearDepthfOES : (float [@unboxed]) -> unit
+  = "glstub_glClearDepthfOES" "glstub_glClearDepthfOES_nat" [@@noalloc]
+external glClearIndex : (float [@unboxed]) -> unit = "glstub_glClearIndex"
+  "glstub_glClearIndex_nat" [@@noalloc]
+external glClearStencil : (int [@untagged]) -> unit = "glstub_glClearStencil"
+  "glstub_glClearStencil_nat" [@@noalloc]
+external glClientActiveTexture : (int [@untagged]) -> unit
+  = "glstub_glClientActiveTexture" "glstub_glClientActiveTexture_nat"
+  [@@noalloc]
+external glClientActiveTextureARB : (int [@untagged]) -> unit
+  = "glstub_glClientActiveTextureARB" "glstub_glClientActiveTextureARB_nat"
+  [@@noalloc]
+external glClientActiveVertexStreamATI : (int [@untagged]) -> unit
   = "glstub_glClientActiveVertexStreamATI"
-  "glstub_glClientActiveVertexStreamATI"
+  "glstub_glClientActiveVertexStreamATI_nat" [@@noalloc]
+external glClientWaitSync : sync -> int -> int -> int
+  = "glstub_glClientWaitSync" "glstub_glClientWaitSync"
 external glClipPlane : int -> float array -> unit = "glstub_glClipPlane"
   "glstub_glClipPlane"
 val glClipPlanefOES : int -> float array -> unit
-external glColor3b : int -> int -> int -> unit = "glstub_glColor3b"
-  "glstub_glColor3b"
+external glColor3b :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3b" "glstub_glColor3b_nat" [@@noalloc]
 val glColor3bv : int array -> unit
-external glColor3d : float -> float -> float -> unit = "glstub_glColor3d"
-  "glstub_glColor3d"
+external glColor3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor3d" "glstub_glColor3d_nat" [@@noalloc]
 external glColor3dv : float array -> unit = "glstub_glColor3dv"
   "glstub_glColor3dv"
-external glColor3f : float -> float -> float -> unit = "glstub_glColor3f"
-  "glstub_glColor3f"
+external glColor3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor3f" "glstub_glColor3f_nat" [@@noalloc]
 external glColor3fVertex3fSUN :
-  float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glColor3fVertex3fSUN_byte" "glstub_glColor3fVertex3fSUN"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor3fVertex3fSUN_byte" "glstub_glColor3fVertex3fSUN_nat"
+  [@@noalloc]
 val glColor3fVertex3fvSUN : float array -> float array -> unit
 val glColor3fv : float array -> unit
-external glColor3hNV : int -> int -> int -> unit = "glstub_glColor3hNV"
-  "glstub_glColor3hNV"
+external glColor3hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3hNV" "glstub_glColor3hNV_nat" [@@noalloc]
 val glColor3hvNV : int array -> unit
-external glColor3i : int -> int -> int -> unit = "glstub_glColor3i"
-  "glstub_glColor3i"
+external glColor3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3i" "glstub_glColor3i_nat" [@@noalloc]
 val glColor3iv : int array -> unit
-external glColor3s : int -> int -> int -> unit = "glstub_glColor3s"
-  "glstub_glColor3s"
+external glColor3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3s" "glstub_glColor3s_nat" [@@noalloc]
 val glColor3sv : int array -> unit
-external glColor3ub : int -> int -> int -> unit = "glstub_glColor3ub"
-  "glstub_glColor3ub"
+external glColor3ub :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3ub" "glstub_glColor3ub_nat" [@@noalloc]
 val glColor3ubv : int array -> unit
-external glColor3ui : int -> int -> int -> unit = "glstub_glColor3ui"
-  "glstub_glColor3ui"
+external glColor3ui :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3ui" "glstub_glColor3ui_nat" [@@noalloc]
 val glColor3uiv : int array -> unit
-external glColor3us : int -> int -> int -> unit = "glstub_glColor3us"
-  "glstub_glColor3us"
+external glColor3us :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor3us" "glstub_glColor3us_nat" [@@noalloc]
 val glColor3usv : int array -> unit
-external glColor4b : int -> int -> int -> int -> unit = "glstub_glColor4b"
-  "glstub_glColor4b"
+external glColor4b :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4b" "glstub_glColor4b_nat" [@@noalloc]
 val glColor4bv : int array -> unit
-external glColor4d : float -> float -> float -> float -> unit
-  = "glstub_glColor4d" "glstub_glColor4d"
+external glColor4d :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor4d" "glstub_glColor4d_nat" [@@noalloc]
 external glColor4dv : float array -> unit = "glstub_glColor4dv"
   "glstub_glColor4dv"
-external glColor4f : float -> float -> float -> float -> unit
-  = "glstub_glColor4f" "glstub_glColor4f"
+external glColor4f :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor4f" "glstub_glColor4f_nat" [@@noalloc]
 external glColor4fNormal3fVertex3fSUN :
-  float ->
-  float ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glColor4fNormal3fVertex3fSUN_byte"
-  "glstub_glColor4fNormal3fVertex3fSUN"
+  "glstub_glColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 val glColor4fNormal3fVertex3fvSUN :
   float array -> float array -> float array -> unit
 val glColor4fv : float array -> unit
-external glColor4hNV : int -> int -> int -> int -> unit
-  = "glstub_glColor4hNV" "glstub_glColor4hNV"
+external glColor4hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4hNV" "glstub_glColor4hNV_nat" [@@noalloc]
 val glColor4hvNV : int array -> unit
-external glColor4i : int -> int -> int -> int -> unit = "glstub_glColor4i"
-  "glstub_glColor4i"
+external glColor4i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4i" "glstub_glColor4i_nat" [@@noalloc]
 val glColor4iv : int array -> unit
-external glColor4s : int -> int -> int -> int -> unit = "glstub_glColor4s"
-  "glstub_glColor4s"
+external glColor4s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4s" "glstub_glColor4s_nat" [@@noalloc]
 val glColor4sv : int array -> unit
-external glColor4ub : int -> int -> int -> int -> unit = "glstub_glColor4ub"
-  "glstub_glColor4ub"
+external glColor4ub :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4ub" "glstub_glColor4ub_nat" [@@noalloc]
 external glColor4ubVertex2fSUN :
-  int -> int -> int -> int -> float -> float -> unit
-  = "glstub_glColor4ubVertex2fSUN_byte" "glstub_glColor4ubVertex2fSUN"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor4ubVertex2fSUN_byte" "glstub_glColor4ubVertex2fSUN_nat"
+  [@@noalloc]
 val glColor4ubVertex2fvSUN : int array -> float array -> unit
 external glColor4ubVertex3fSUN :
-  int -> int -> int -> int -> float -> float -> float -> unit
-  = "glstub_glColor4ubVertex3fSUN_byte" "glstub_glColor4ubVertex3fSUN"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glColor4ubVertex3fSUN_byte" "glstub_glColor4ubVertex3fSUN_nat"
+  [@@noalloc]
 val glColor4ubVertex3fvSUN : int array -> float array -> unit
 val glColor4ubv : int array -> unit
-external glColor4ui : int -> int -> int -> int -> unit = "glstub_glColor4ui"
-  "glstub_glColor4ui"
+external glColor4ui :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4ui" "glstub_glColor4ui_nat" [@@noalloc]
 val glColor4uiv : int array -> unit
-external glColor4us : int -> int -> int -> int -> unit = "glstub_glColor4us"
-  "glstub_glColor4us"
+external glColor4us :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColor4us" "glstub_glColor4us_nat" [@@noalloc]
 val glColor4usv : int array -> unit
 external glColorFragmentOp1ATI :
-  int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glColorFragmentOp1ATI_byte" "glstub_glColorFragmentOp1ATI"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColorFragmentOp1ATI_byte" "glstub_glColorFragmentOp1ATI_nat"
+  [@@noalloc]
 external glColorFragmentOp2ATI :
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glColorFragmentOp2ATI_byte" "glstub_glColorFragmentOp2ATI"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColorFragmentOp2ATI_byte" "glstub_glColorFragmentOp2ATI_nat"
+  [@@noalloc]
 external glColorFragmentOp3ATI :
-  int ->
-  int ->
-  int ->
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glColorFragmentOp3ATI_byte" "glstub_glColorFragmentOp3ATI"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColorFragmentOp3ATI_byte" "glstub_glColorFragmentOp3ATI_nat"
+  [@@noalloc]
 external glColorMask : bool -> bool -> bool -> bool -> unit
-  = "glstub_glColorMask" "glstub_glColorMask"
-external glColorMaskIndexedEXT : int -> bool -> bool -> bool -> bool -> unit
-  = "glstub_glColorMaskIndexedEXT" "glstub_glColorMaskIndexedEXT"
-external glColorMaterial : int -> int -> unit = "glstub_glColorMaterial"
-  "glstub_glColorMaterial"
+  = "glstub_glColorMask" "glstub_glColorMask_nat" [@@noalloc]
+external glColorMaskIndexedEXT :
+  (int [@untagged]) -> bool -> bool -> bool -> bool -> unit
+  = "glstub_glColorMaskIndexedEXT" "glstub_glColorMaskIndexedEXT_nat"
+  [@@noalloc]
+external glColorMaterial : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glColorMaterial" "glstub_glColorMaterial_nat" [@@noalloc]
 external glColorPointer : int -> int -> int -> 'a -> unit
   = "glstub_glColorPointer" "glstub_glColorPointer"
 external glColorPointerEXT : int -> int -> int -> int -> 'a -> unit
@@ -3344,23 +3748,37 @@ val glColorTableParameteriv : int -> int -> int array -> unit
 val glColorTableParameterivSGI : int -> int -> int array -> unit
 external glColorTableSGI : int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glColorTableSGI_byte" "glstub_glColorTableSGI"
-external glCombinerInputNV : int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCombinerInputNV_byte" "glstub_glCombinerInputNV"
+external glCombinerInputNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCombinerInputNV_byte" "glstub_glCombinerInputNV_nat"
+  [@@noalloc]
 external glCombinerOutputNV :
-  int ->
-  int -> int -> int -> int -> int -> int -> bool -> bool -> bool -> unit
-  = "glstub_glCombinerOutputNV_byte" "glstub_glCombinerOutputNV"
-external glCombinerParameterfNV : int -> float -> unit
-  = "glstub_glCombinerParameterfNV" "glstub_glCombinerParameterfNV"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> bool -> bool -> bool -> unit
+  = "glstub_glCombinerOutputNV_byte" "glstub_glCombinerOutputNV_nat"
+  [@@noalloc]
+external glCombinerParameterfNV :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glCombinerParameterfNV" "glstub_glCombinerParameterfNV_nat"
+  [@@noalloc]
 val glCombinerParameterfvNV : int -> float array -> unit
-external glCombinerParameteriNV : int -> int -> unit
-  = "glstub_glCombinerParameteriNV" "glstub_glCombinerParameteriNV"
+external glCombinerParameteriNV :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCombinerParameteriNV" "glstub_glCombinerParameteriNV_nat"
+  [@@noalloc]
 val glCombinerParameterivNV : int -> int array -> unit
 val glCombinerStageParameterfvNV : int -> int -> float array -> unit
-external glCompileShader : int -> unit = "glstub_glCompileShader"
-  "glstub_glCompileShader"
-external glCompileShaderARB : int -> unit = "glstub_glCompileShaderARB"
-  "glstub_glCompileShaderARB"
+external glCompileShader : (int [@untagged]) -> unit
+  = "glstub_glCompileShader" "glstub_glCompileShader_nat" [@@noalloc]
+external glCompileShaderARB : (int [@untagged]) -> unit
+  = "glstub_glCompileShaderARB" "glstub_glCompileShaderARB_nat" [@@noalloc]
 external glCompressedTexImage1D :
   int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glCompressedTexImage1D_byte" "glstub_glCompressedTexImage1D"
@@ -3420,179 +3838,345 @@ external glConvolutionFilter2D :
 external glConvolutionFilter2DEXT :
   int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glConvolutionFilter2DEXT_byte" "glstub_glConvolutionFilter2DEXT"
-external glConvolutionParameterf : int -> int -> float -> unit
-  = "glstub_glConvolutionParameterf" "glstub_glConvolutionParameterf"
-external glConvolutionParameterfEXT : int -> int -> float -> unit
-  = "glstub_glConvolutionParameterfEXT" "glstub_glConvolutionParameterfEXT"
+external glConvolutionParameterf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glConvolutionParameterf" "glstub_glConvolutionParameterf_nat"
+  [@@noalloc]
+external glConvolutionParameterfEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glConvolutionParameterfEXT"
+  "glstub_glConvolutionParameterfEXT_nat" [@@noalloc]
 val glConvolutionParameterfv : int -> int -> float array -> unit
 val glConvolutionParameterfvEXT : int -> int -> float array -> unit
-external glConvolutionParameteri : int -> int -> int -> unit
-  = "glstub_glConvolutionParameteri" "glstub_glConvolutionParameteri"
-external glConvolutionParameteriEXT : int -> int -> int -> unit
-  = "glstub_glConvolutionParameteriEXT" "glstub_glConvolutionParameteriEXT"
+external glConvolutionParameteri :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glConvolutionParameteri" "glstub_glConvolutionParameteri_nat"
+  [@@noalloc]
+external glConvolutionParameteriEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glConvolutionParameteriEXT"
+  "glstub_glConvolutionParameteriEXT_nat" [@@noalloc]
 val glConvolutionParameteriv : int -> int -> int array -> unit
 val glConvolutionParameterivEXT : int -> int -> int array -> unit
-external glCopyColorSubTable : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyColorSubTable" "glstub_glCopyColorSubTable"
-external glCopyColorSubTableEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyColorSubTableEXT" "glstub_glCopyColorSubTableEXT"
-external glCopyColorTable : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyColorTable" "glstub_glCopyColorTable"
-external glCopyColorTableSGI : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyColorTableSGI" "glstub_glCopyColorTableSGI"
-external glCopyConvolutionFilter1D : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyConvolutionFilter1D" "glstub_glCopyConvolutionFilter1D"
+external glCopyBufferSubData :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyBufferSubData" "glstub_glCopyBufferSubData_nat" [@@noalloc]
+external glCopyColorSubTable :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyColorSubTable" "glstub_glCopyColorSubTable_nat" [@@noalloc]
+external glCopyColorSubTableEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyColorSubTableEXT" "glstub_glCopyColorSubTableEXT_nat"
+  [@@noalloc]
+external glCopyColorTable :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyColorTable" "glstub_glCopyColorTable_nat" [@@noalloc]
+external glCopyColorTableSGI :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyColorTableSGI" "glstub_glCopyColorTableSGI_nat" [@@noalloc]
+external glCopyConvolutionFilter1D :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyConvolutionFilter1D" "glstub_glCopyConvolutionFilter1D_nat"
+  [@@noalloc]
 external glCopyConvolutionFilter1DEXT :
-  int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glCopyConvolutionFilter1DEXT"
-  "glstub_glCopyConvolutionFilter1DEXT"
+  "glstub_glCopyConvolutionFilter1DEXT_nat" [@@noalloc]
 external glCopyConvolutionFilter2D :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glCopyConvolutionFilter2D_byte"
-  "glstub_glCopyConvolutionFilter2D"
+  "glstub_glCopyConvolutionFilter2D_nat" [@@noalloc]
 external glCopyConvolutionFilter2DEXT :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glCopyConvolutionFilter2DEXT_byte"
-  "glstub_glCopyConvolutionFilter2DEXT"
-external glCopyPixels : int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyPixels" "glstub_glCopyPixels"
+  "glstub_glCopyConvolutionFilter2DEXT_nat" [@@noalloc]
+external glCopyPixels :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyPixels" "glstub_glCopyPixels_nat" [@@noalloc]
 external glCopyTexImage1D :
-  int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexImage1D_byte" "glstub_glCopyTexImage1D"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexImage1D_byte" "glstub_glCopyTexImage1D_nat" [@@noalloc]
 external glCopyTexImage1DEXT :
-  int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexImage1DEXT_byte" "glstub_glCopyTexImage1DEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexImage1DEXT_byte" "glstub_glCopyTexImage1DEXT_nat"
+  [@@noalloc]
 external glCopyTexImage2D :
-  int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexImage2D_byte" "glstub_glCopyTexImage2D"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexImage2D_byte" "glstub_glCopyTexImage2D_nat" [@@noalloc]
 external glCopyTexImage2DEXT :
-  int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexImage2DEXT_byte" "glstub_glCopyTexImage2DEXT"
-external glCopyTexSubImage1D : int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage1D_byte" "glstub_glCopyTexSubImage1D"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexImage2DEXT_byte" "glstub_glCopyTexImage2DEXT_nat"
+  [@@noalloc]
+external glCopyTexSubImage1D :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage1D_byte" "glstub_glCopyTexSubImage1D_nat"
+  [@@noalloc]
 external glCopyTexSubImage1DEXT :
-  int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage1DEXT_byte" "glstub_glCopyTexSubImage1DEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage1DEXT_byte" "glstub_glCopyTexSubImage1DEXT_nat"
+  [@@noalloc]
 external glCopyTexSubImage2D :
-  int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage2D_byte" "glstub_glCopyTexSubImage2D"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage2D_byte" "glstub_glCopyTexSubImage2D_nat"
+  [@@noalloc]
 external glCopyTexSubImage2DEXT :
-  int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage2DEXT_byte" "glstub_glCopyTexSubImage2DEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage2DEXT_byte" "glstub_glCopyTexSubImage2DEXT_nat"
+  [@@noalloc]
 external glCopyTexSubImage3D :
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage3D_byte" "glstub_glCopyTexSubImage3D"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage3D_byte" "glstub_glCopyTexSubImage3D_nat"
+  [@@noalloc]
 external glCopyTexSubImage3DEXT :
-  int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glCopyTexSubImage3DEXT_byte" "glstub_glCopyTexSubImage3DEXT"
-external glCreateProgram : unit -> int = "glstub_glCreateProgram"
-  "glstub_glCreateProgram"
-external glCreateProgramObjectARB : unit -> int
-  = "glstub_glCreateProgramObjectARB" "glstub_glCreateProgramObjectARB"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glCopyTexSubImage3DEXT_byte" "glstub_glCopyTexSubImage3DEXT_nat"
+  [@@noalloc]
+external glCreateProgram : unit -> (int [@untagged])
+  = "glstub_glCreateProgram" "glstub_glCreateProgram_nat" [@@noalloc]
+external glCreateProgramObjectARB : unit -> (int [@untagged])
+  = "glstub_glCreateProgramObjectARB" "glstub_glCreateProgramObjectARB_nat"
+  [@@noalloc]
 external glCreateShader : int -> int = "glstub_glCreateShader"
-  "glstub_glCreateShader"
+  "glstub_glCreateShader_nat" [@@noalloc] [@@untagged]
 external glCreateShaderObjectARB : int -> int
-  = "glstub_glCreateShaderObjectARB" "glstub_glCreateShaderObjectARB"
-external glCullFace : int -> unit = "glstub_glCullFace" "glstub_glCullFace"
+  = "glstub_glCreateShaderObjectARB" "glstub_glCreateShaderObjectARB_nat"
+  [@@noalloc] [@@untagged]
+external glCullFace : (int [@untagged]) -> unit = "glstub_glCullFace"
+  "glstub_glCullFace_nat" [@@noalloc]
 external glCullParameterdvEXT : int -> float array -> unit
   = "glstub_glCullParameterdvEXT" "glstub_glCullParameterdvEXT"
 val glCullParameterfvEXT : int -> float array -> unit
-external glCurrentPaletteMatrixARB : int -> unit
-  = "glstub_glCurrentPaletteMatrixARB" "glstub_glCurrentPaletteMatrixARB"
-external glDeleteAsyncMarkersSGIX : int -> int -> unit
-  = "glstub_glDeleteAsyncMarkersSGIX" "glstub_glDeleteAsyncMarkersSGIX"
+external glCurrentPaletteMatrixARB : (int [@untagged]) -> unit
+  = "glstub_glCurrentPaletteMatrixARB" "glstub_glCurrentPaletteMatrixARB_nat"
+  [@@noalloc]
+external glDeleteAsyncMarkersSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDeleteAsyncMarkersSGIX" "glstub_glDeleteAsyncMarkersSGIX_nat"
+  [@@noalloc]
 val glDeleteBuffers : int -> int array -> unit
 val glDeleteBuffersARB : int -> int array -> unit
 val glDeleteFencesAPPLE : int -> int array -> unit
 val glDeleteFencesNV : int -> int array -> unit
-external glDeleteFragmentShaderATI : int -> unit
-  = "glstub_glDeleteFragmentShaderATI" "glstub_glDeleteFragmentShaderATI"
+external glDeleteFragmentShaderATI : (int [@untagged]) -> unit
+  = "glstub_glDeleteFragmentShaderATI" "glstub_glDeleteFragmentShaderATI_nat"
+  [@@noalloc]
+val glDeleteFramebuffers : int -> int array -> unit
 val glDeleteFramebuffersEXT : int -> int array -> unit
-external glDeleteLists : int -> int -> unit = "glstub_glDeleteLists"
-  "glstub_glDeleteLists"
-external glDeleteObjectARB : int -> unit = "glstub_glDeleteObjectARB"
-  "glstub_glDeleteObjectARB"
+external glDeleteLists : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDeleteLists" "glstub_glDeleteLists_nat" [@@noalloc]
+external glDeleteObjectARB : (int [@untagged]) -> unit
+  = "glstub_glDeleteObjectARB" "glstub_glDeleteObjectARB_nat" [@@noalloc]
 val glDeleteOcclusionQueriesNV : int -> int array -> unit
-external glDeleteProgram : int -> unit = "glstub_glDeleteProgram"
-  "glstub_glDeleteProgram"
+external glDeleteProgram : (int [@untagged]) -> unit
+  = "glstub_glDeleteProgram" "glstub_glDeleteProgram_nat" [@@noalloc]
 val glDeleteProgramsARB : int -> int array -> unit
 val glDeleteProgramsNV : int -> int array -> unit
 val glDeleteQueries : int -> int array -> unit
 val glDeleteQueriesARB : int -> int array -> unit
+val glDeleteRenderbuffers : int -> int array -> unit
 val glDeleteRenderbuffersEXT : int -> int array -> unit
-external glDeleteShader : int -> unit = "glstub_glDeleteShader"
-  "glstub_glDeleteShader"
+val glDeleteSamplers : int -> int array -> unit
+external glDeleteShader : (int [@untagged]) -> unit = "glstub_glDeleteShader"
+  "glstub_glDeleteShader_nat" [@@noalloc]
+external glDeleteSync : sync -> unit = "glstub_glDeleteSync"
+  "glstub_glDeleteSync"
 val glDeleteTextures : int -> int array -> unit
 val glDeleteTexturesEXT : int -> int array -> unit
 val glDeleteVertexArrays : int -> int array -> unit
 val glDeleteVertexArraysAPPLE : int -> int array -> unit
-external glDeleteVertexShaderEXT : int -> unit
-  = "glstub_glDeleteVertexShaderEXT" "glstub_glDeleteVertexShaderEXT"
-external glDepthBoundsEXT : float -> float -> unit
-  = "glstub_glDepthBoundsEXT" "glstub_glDepthBoundsEXT"
-external glDepthBoundsdNV : float -> float -> unit
-  = "glstub_glDepthBoundsdNV" "glstub_glDepthBoundsdNV"
-external glDepthFunc : int -> unit = "glstub_glDepthFunc"
-  "glstub_glDepthFunc"
+external glDeleteVertexShaderEXT : (int [@untagged]) -> unit
+  = "glstub_glDeleteVertexShaderEXT" "glstub_glDeleteVertexShaderEXT_nat"
+  [@@noalloc]
+external glDepthBoundsEXT : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glDepthBoundsEXT" "glstub_glDepthBoundsEXT_nat" [@@noalloc]
+external glDepthBoundsdNV : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glDepthBoundsdNV" "glstub_glDepthBoundsdNV_nat" [@@noalloc]
+external glDepthFunc : (int [@untagged]) -> unit = "glstub_glDepthFunc"
+  "glstub_glDepthFunc_nat" [@@noalloc]
 external glDepthMask : bool -> unit = "glstub_glDepthMask"
-  "glstub_glDepthMask"
-external glDepthRange : float -> float -> unit = "glstub_glDepthRange"
-  "glstub_glDepthRange"
-external glDepthRangedNV : float -> float -> unit = "glstub_glDepthRangedNV"
-  "glstub_glDepthRangedNV"
-external glDepthRangefOES : float -> float -> unit
-  = "glstub_glDepthRangefOES" "glstub_glDepthRangefOES"
-external glDetachObjectARB : int -> int -> unit = "glstub_glDetachObjectARB"
-  "glstub_glDetachObjectARB"
-external glDetachShader : int -> int -> unit = "glstub_glDetachShader"
-  "glstub_glDetachShader"
+  "glstub_glDepthMask_nat" [@@noalloc]
+external glDepthRange : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glDepthRange" "glstub_glDepthRange_nat" [@@noalloc]
+external glDepthRangedNV : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glDepthRangedNV" "glstub_glDepthRangedNV_nat" [@@noalloc]
+external glDepthRangefOES : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glDepthRangefOES" "glstub_glDepthRangefOES_nat" [@@noalloc]
+external glDetachObjectARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDetachObjectARB" "glstub_glDetachObjectARB_nat" [@@noalloc]
+external glDetachShader : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDetachShader" "glstub_glDetachShader_nat" [@@noalloc]
 val glDetailTexFuncSGIS : int -> int -> float array -> unit
-external glDisable : int -> unit = "glstub_glDisable" "glstub_glDisable"
-external glDisableClientState : int -> unit = "glstub_glDisableClientState"
-  "glstub_glDisableClientState"
-external glDisableIndexedEXT : int -> int -> unit
-  = "glstub_glDisableIndexedEXT" "glstub_glDisableIndexedEXT"
-external glDisableVariantClientStateEXT : int -> unit
+external glDisable : (int [@untagged]) -> unit = "glstub_glDisable"
+  "glstub_glDisable_nat" [@@noalloc]
+external glDisableClientState : (int [@untagged]) -> unit
+  = "glstub_glDisableClientState" "glstub_glDisableClientState_nat"
+  [@@noalloc]
+external glDisableIndexedEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDisableIndexedEXT" "glstub_glDisableIndexedEXT_nat" [@@noalloc]
+external glDisableVariantClientStateEXT : (int [@untagged]) -> unit
   = "glstub_glDisableVariantClientStateEXT"
-  "glstub_glDisableVariantClientStateEXT"
-external glDisableVertexAttribArray : int -> unit
-  = "glstub_glDisableVertexAttribArray" "glstub_glDisableVertexAttribArray"
-external glDisableVertexAttribArrayARB : int -> unit
+  "glstub_glDisableVariantClientStateEXT_nat" [@@noalloc]
+external glDisableVertexAttribArray : (int [@untagged]) -> unit
+  = "glstub_glDisableVertexAttribArray"
+  "glstub_glDisableVertexAttribArray_nat" [@@noalloc]
+external glDisableVertexAttribArrayARB : (int [@untagged]) -> unit
   = "glstub_glDisableVertexAttribArrayARB"
-  "glstub_glDisableVertexAttribArrayARB"
-external glDrawArrays : int -> int -> int -> unit = "glstub_glDrawArrays"
-  "glstub_glDrawArrays"
-external glDrawArraysEXT : int -> int -> int -> unit
-  = "glstub_glDrawArraysEXT" "glstub_glDrawArraysEXT"
-external glDrawArraysInstancedEXT : int -> int -> int -> int -> unit
-  = "glstub_glDrawArraysInstancedEXT" "glstub_glDrawArraysInstancedEXT"
-external glDrawBuffer : int -> unit = "glstub_glDrawBuffer"
-  "glstub_glDrawBuffer"
+  "glstub_glDisableVertexAttribArrayARB_nat" [@@noalloc]
+external glDrawArrays :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArrays" "glstub_glDrawArrays_nat" [@@noalloc]
+external glDrawArraysEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArraysEXT" "glstub_glDrawArraysEXT_nat" [@@noalloc]
+external glDrawArraysIndirect :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArraysIndirect" "glstub_glDrawArraysIndirect_nat"
+  [@@noalloc]
+external glDrawArraysInstanced :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArraysInstanced" "glstub_glDrawArraysInstanced_nat"
+  [@@noalloc]
+external glDrawArraysInstancedBaseInstance :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArraysInstancedBaseInstance"
+  "glstub_glDrawArraysInstancedBaseInstance_nat" [@@noalloc]
+external glDrawArraysInstancedEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawArraysInstancedEXT" "glstub_glDrawArraysInstancedEXT_nat"
+  [@@noalloc]
+external glDrawBuffer : (int [@untagged]) -> unit = "glstub_glDrawBuffer"
+  "glstub_glDrawBuffer_nat" [@@noalloc]
 val glDrawBuffers : int -> int array -> unit
 val glDrawBuffersARB : int -> int array -> unit
 val glDrawBuffersATI : int -> int array -> unit
-external glDrawElementArrayAPPLE : int -> int -> int -> unit
-  = "glstub_glDrawElementArrayAPPLE" "glstub_glDrawElementArrayAPPLE"
-external glDrawElementArrayATI : int -> int -> unit
-  = "glstub_glDrawElementArrayATI" "glstub_glDrawElementArrayATI"
+external glDrawElementArrayAPPLE :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawElementArrayAPPLE" "glstub_glDrawElementArrayAPPLE_nat"
+  [@@noalloc]
+external glDrawElementArrayATI :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawElementArrayATI" "glstub_glDrawElementArrayATI_nat"
+  [@@noalloc]
 external glDrawElements : int -> int -> int -> 'a -> unit
   = "glstub_glDrawElements" "glstub_glDrawElements"
+external glDrawElementsBaseVertex : int -> int -> int -> 'a -> int -> unit
+  = "glstub_glDrawElementsBaseVertex" "glstub_glDrawElementsBaseVertex"
+external glDrawElementsIndirect :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawElementsIndirect" "glstub_glDrawElementsIndirect_nat"
+  [@@noalloc]
+external glDrawElementsInstanced : int -> int -> int -> 'a -> int -> unit
+  = "glstub_glDrawElementsInstanced" "glstub_glDrawElementsInstanced"
+external glDrawElementsInstancedBaseInstance :
+  int -> int -> int -> 'a -> int -> int -> unit
+  = "glstub_glDrawElementsInstancedBaseInstance_byte"
+  "glstub_glDrawElementsInstancedBaseInstance"
+external glDrawElementsInstancedBaseVertex :
+  int -> int -> int -> 'a -> int -> int -> unit
+  = "glstub_glDrawElementsInstancedBaseVertex_byte"
+  "glstub_glDrawElementsInstancedBaseVertex"
+external glDrawElementsInstancedBaseVertexBaseInstance :
+  int -> int -> int -> 'a -> int -> int -> int -> unit
+  = "glstub_glDrawElementsInstancedBaseVertexBaseInstance_byte"
+  "glstub_glDrawElementsInstancedBaseVertexBaseInstance"
 external glDrawElementsInstancedEXT : int -> int -> int -> 'a -> int -> unit
   = "glstub_glDrawElementsInstancedEXT" "glstub_glDrawElementsInstancedEXT"
 external glDrawPixels : int -> int -> int -> int -> 'a -> unit
   = "glstub_glDrawPixels" "glstub_glDrawPixels"
 external glDrawRangeElementArrayAPPLE :
-  int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glDrawRangeElementArrayAPPLE"
-  "glstub_glDrawRangeElementArrayAPPLE"
-external glDrawRangeElementArrayATI : int -> int -> int -> int -> unit
-  = "glstub_glDrawRangeElementArrayATI" "glstub_glDrawRangeElementArrayATI"
+  "glstub_glDrawRangeElementArrayAPPLE_nat" [@@noalloc]
+external glDrawRangeElementArrayATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glDrawRangeElementArrayATI"
+  "glstub_glDrawRangeElementArrayATI_nat" [@@noalloc]
 external glDrawRangeElements : int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glDrawRangeElements_byte" "glstub_glDrawRangeElements"
+external glDrawRangeElementsBaseVertex :
+  int -> int -> int -> int -> int -> 'a -> int -> unit
+  = "glstub_glDrawRangeElementsBaseVertex_byte"
+  "glstub_glDrawRangeElementsBaseVertex"
 external glDrawRangeElementsEXT :
   int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glDrawRangeElementsEXT_byte" "glstub_glDrawRangeElementsEXT"
-external glEdgeFlag : bool -> unit = "glstub_glEdgeFlag" "glstub_glEdgeFlag"
+external glEdgeFlag : bool -> unit = "glstub_glEdgeFlag"
+  "glstub_glEdgeFlag_nat" [@@noalloc]
 external glEdgeFlagPointer : int -> 'a -> unit = "glstub_glEdgeFlagPointer"
   "glstub_glEdgeFlagPointer"
 val glEdgeFlagPointerEXT : int -> int -> bool array -> unit
@@ -3603,210 +4187,311 @@ external glElementPointerAPPLE : int -> 'a -> unit
   = "glstub_glElementPointerAPPLE" "glstub_glElementPointerAPPLE"
 external glElementPointerATI : int -> 'a -> unit
   = "glstub_glElementPointerATI" "glstub_glElementPointerATI"
-external glEnable : int -> unit = "glstub_glEnable" "glstub_glEnable"
-external glEnableClientState : int -> unit = "glstub_glEnableClientState"
-  "glstub_glEnableClientState"
-external glEnableIndexedEXT : int -> int -> unit
-  = "glstub_glEnableIndexedEXT" "glstub_glEnableIndexedEXT"
-external glEnableVariantClientStateEXT : int -> unit
+external glEnable : (int [@untagged]) -> unit = "glstub_glEnable"
+  "glstub_glEnable_nat" [@@noalloc]
+external glEnableClientState : (int [@untagged]) -> unit
+  = "glstub_glEnableClientState" "glstub_glEnableClientState_nat" [@@noalloc]
+external glEnableIndexedEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glEnableIndexedEXT" "glstub_glEnableIndexedEXT_nat" [@@noalloc]
+external glEnableVariantClientStateEXT : (int [@untagged]) -> unit
   = "glstub_glEnableVariantClientStateEXT"
-  "glstub_glEnableVariantClientStateEXT"
-external glEnableVertexAttribArray : int -> unit
-  = "glstub_glEnableVertexAttribArray" "glstub_glEnableVertexAttribArray"
-external glEnableVertexAttribArrayARB : int -> unit
+  "glstub_glEnableVariantClientStateEXT_nat" [@@noalloc]
+external glEnableVertexAttribArray : (int [@untagged]) -> unit
+  = "glstub_glEnableVertexAttribArray" "glstub_glEnableVertexAttribArray_nat"
+  [@@noalloc]
+external glEnableVertexAttribArrayARB : (int [@untagged]) -> unit
   = "glstub_glEnableVertexAttribArrayARB"
-  "glstub_glEnableVertexAttribArrayARB"
-external glEnd : unit -> unit = "glstub_glEnd" "glstub_glEnd"
+  "glstub_glEnableVertexAttribArrayARB_nat" [@@noalloc]
+external glEnd : unit -> unit = "glstub_glEnd" "glstub_glEnd_nat" [@@noalloc]
 external glEndFragmentShaderATI : unit -> unit
-  = "glstub_glEndFragmentShaderATI" "glstub_glEndFragmentShaderATI"
-external glEndList : unit -> unit = "glstub_glEndList" "glstub_glEndList"
+  = "glstub_glEndFragmentShaderATI" "glstub_glEndFragmentShaderATI_nat"
+  [@@noalloc]
+external glEndList : unit -> unit = "glstub_glEndList" "glstub_glEndList_nat"
+  [@@noalloc]
 external glEndOcclusionQueryNV : unit -> unit
-  = "glstub_glEndOcclusionQueryNV" "glstub_glEndOcclusionQueryNV"
-external glEndQuery : int -> unit = "glstub_glEndQuery" "glstub_glEndQuery"
-external glEndQueryARB : int -> unit = "glstub_glEndQueryARB"
-  "glstub_glEndQueryARB"
+  = "glstub_glEndOcclusionQueryNV" "glstub_glEndOcclusionQueryNV_nat"
+  [@@noalloc]
+external glEndQuery : (int [@untagged]) -> unit = "glstub_glEndQuery"
+  "glstub_glEndQuery_nat" [@@noalloc]
+external glEndQueryARB : (int [@untagged]) -> unit = "glstub_glEndQueryARB"
+  "glstub_glEndQueryARB_nat" [@@noalloc]
 external glEndSceneEXT : unit -> unit = "glstub_glEndSceneEXT"
-  "glstub_glEndSceneEXT"
+  "glstub_glEndSceneEXT_nat" [@@noalloc]
 external glEndTransformFeedbackNV : unit -> unit
-  = "glstub_glEndTransformFeedbackNV" "glstub_glEndTransformFeedbackNV"
+  = "glstub_glEndTransformFeedbackNV" "glstub_glEndTransformFeedbackNV_nat"
+  [@@noalloc]
 external glEndVertexShaderEXT : unit -> unit = "glstub_glEndVertexShaderEXT"
-  "glstub_glEndVertexShaderEXT"
-external glEvalCoord1d : float -> unit = "glstub_glEvalCoord1d"
-  "glstub_glEvalCoord1d"
+  "glstub_glEndVertexShaderEXT_nat" [@@noalloc]
+external glEvalCoord1d : (float [@unboxed]) -> unit = "glstub_glEvalCoord1d"
+  "glstub_glEvalCoord1d_nat" [@@noalloc]
 external glEvalCoord1dv : float array -> unit = "glstub_glEvalCoord1dv"
   "glstub_glEvalCoord1dv"
-external glEvalCoord1f : float -> unit = "glstub_glEvalCoord1f"
-  "glstub_glEvalCoord1f"
+external glEvalCoord1f : (float [@unboxed]) -> unit = "glstub_glEvalCoord1f"
+  "glstub_glEvalCoord1f_nat" [@@noalloc]
 val glEvalCoord1fv : float array -> unit
-external glEvalCoord2d : float -> float -> unit = "glstub_glEvalCoord2d"
-  "glstub_glEvalCoord2d"
+external glEvalCoord2d : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glEvalCoord2d" "glstub_glEvalCoord2d_nat" [@@noalloc]
 external glEvalCoord2dv : float array -> unit = "glstub_glEvalCoord2dv"
   "glstub_glEvalCoord2dv"
-external glEvalCoord2f : float -> float -> unit = "glstub_glEvalCoord2f"
-  "glstub_glEvalCoord2f"
+external glEvalCoord2f : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glEvalCoord2f" "glstub_glEvalCoord2f_nat" [@@noalloc]
 val glEvalCoord2fv : float array -> unit
-external glEvalMapsNV : int -> int -> unit = "glstub_glEvalMapsNV"
-  "glstub_glEvalMapsNV"
-external glEvalMesh1 : int -> int -> int -> unit = "glstub_glEvalMesh1"
-  "glstub_glEvalMesh1"
-external glEvalMesh2 : int -> int -> int -> int -> int -> unit
-  = "glstub_glEvalMesh2" "glstub_glEvalMesh2"
-external glEvalPoint1 : int -> unit = "glstub_glEvalPoint1"
-  "glstub_glEvalPoint1"
-external glEvalPoint2 : int -> int -> unit = "glstub_glEvalPoint2"
-  "glstub_glEvalPoint2"
+external glEvalMapsNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glEvalMapsNV" "glstub_glEvalMapsNV_nat" [@@noalloc]
+external glEvalMesh1 :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glEvalMesh1" "glstub_glEvalMesh1_nat" [@@noalloc]
+external glEvalMesh2 :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glEvalMesh2" "glstub_glEvalMesh2_nat" [@@noalloc]
+external glEvalPoint1 : (int [@untagged]) -> unit = "glstub_glEvalPoint1"
+  "glstub_glEvalPoint1_nat" [@@noalloc]
+external glEvalPoint2 : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glEvalPoint2" "glstub_glEvalPoint2_nat" [@@noalloc]
 val glExecuteProgramNV : int -> int -> float array -> unit
-external glExtractComponentEXT : int -> int -> int -> unit
-  = "glstub_glExtractComponentEXT" "glstub_glExtractComponentEXT"
+external glExtractComponentEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glExtractComponentEXT" "glstub_glExtractComponentEXT_nat"
+  [@@noalloc]
 val glFeedbackBuffer : int -> int -> float array -> unit
-external glFinalCombinerInputNV : int -> int -> int -> int -> unit
-  = "glstub_glFinalCombinerInputNV" "glstub_glFinalCombinerInputNV"
-external glFinish : unit -> unit = "glstub_glFinish" "glstub_glFinish"
+external glFenceSync : int -> int -> sync = "glstub_glFenceSync"
+  "glstub_glFenceSync"
+external glFinalCombinerInputNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFinalCombinerInputNV" "glstub_glFinalCombinerInputNV_nat"
+  [@@noalloc]
+external glFinish : unit -> unit = "glstub_glFinish" "glstub_glFinish_nat"
+  [@@noalloc]
 val glFinishAsyncSGIX : int array -> int
-external glFinishFenceAPPLE : int -> unit = "glstub_glFinishFenceAPPLE"
-  "glstub_glFinishFenceAPPLE"
-external glFinishFenceNV : int -> unit = "glstub_glFinishFenceNV"
-  "glstub_glFinishFenceNV"
-external glFinishObjectAPPLE : int -> int -> unit
-  = "glstub_glFinishObjectAPPLE" "glstub_glFinishObjectAPPLE"
+external glFinishFenceAPPLE : (int [@untagged]) -> unit
+  = "glstub_glFinishFenceAPPLE" "glstub_glFinishFenceAPPLE_nat" [@@noalloc]
+external glFinishFenceNV : (int [@untagged]) -> unit
+  = "glstub_glFinishFenceNV" "glstub_glFinishFenceNV_nat" [@@noalloc]
+external glFinishObjectAPPLE : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFinishObjectAPPLE" "glstub_glFinishObjectAPPLE_nat" [@@noalloc]
 external glFinishTextureSUNX : unit -> unit = "glstub_glFinishTextureSUNX"
-  "glstub_glFinishTextureSUNX"
-external glFlush : unit -> unit = "glstub_glFlush" "glstub_glFlush"
-external glFlushPixelDataRangeNV : int -> unit
-  = "glstub_glFlushPixelDataRangeNV" "glstub_glFlushPixelDataRangeNV"
+  "glstub_glFinishTextureSUNX_nat" [@@noalloc]
+external glFlush : unit -> unit = "glstub_glFlush" "glstub_glFlush_nat"
+  [@@noalloc]
+external glFlushMappedBufferRange :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFlushMappedBufferRange" "glstub_glFlushMappedBufferRange_nat"
+  [@@noalloc]
+external glFlushPixelDataRangeNV : (int [@untagged]) -> unit
+  = "glstub_glFlushPixelDataRangeNV" "glstub_glFlushPixelDataRangeNV_nat"
+  [@@noalloc]
 external glFlushRasterSGIX : unit -> unit = "glstub_glFlushRasterSGIX"
-  "glstub_glFlushRasterSGIX"
+  "glstub_glFlushRasterSGIX_nat" [@@noalloc]
 external glFlushVertexArrayRangeAPPLE : int -> 'a -> unit
   = "glstub_glFlushVertexArrayRangeAPPLE"
   "glstub_glFlushVertexArrayRangeAPPLE"
 external glFlushVertexArrayRangeNV : unit -> unit
-  = "glstub_glFlushVertexArrayRangeNV" "glstub_glFlushVertexArrayRangeNV"
+  = "glstub_glFlushVertexArrayRangeNV" "glstub_glFlushVertexArrayRangeNV_nat"
+  [@@noalloc]
 external glFogCoordPointer : int -> int -> 'a -> unit
   = "glstub_glFogCoordPointer" "glstub_glFogCoordPointer"
 external glFogCoordPointerEXT : int -> int -> 'a -> unit
   = "glstub_glFogCoordPointerEXT" "glstub_glFogCoordPointerEXT"
 external glFogCoordPointerListIBM : int -> int -> 'a -> int -> unit
   = "glstub_glFogCoordPointerListIBM" "glstub_glFogCoordPointerListIBM"
-external glFogCoordd : float -> unit = "glstub_glFogCoordd"
-  "glstub_glFogCoordd"
-external glFogCoorddEXT : float -> unit = "glstub_glFogCoorddEXT"
-  "glstub_glFogCoorddEXT"
+external glFogCoordd : (float [@unboxed]) -> unit = "glstub_glFogCoordd"
+  "glstub_glFogCoordd_nat" [@@noalloc]
+external glFogCoorddEXT : (float [@unboxed]) -> unit
+  = "glstub_glFogCoorddEXT" "glstub_glFogCoorddEXT_nat" [@@noalloc]
 external glFogCoorddv : float array -> unit = "glstub_glFogCoorddv"
   "glstub_glFogCoorddv"
 external glFogCoorddvEXT : float array -> unit = "glstub_glFogCoorddvEXT"
   "glstub_glFogCoorddvEXT"
-external glFogCoordf : float -> unit = "glstub_glFogCoordf"
-  "glstub_glFogCoordf"
-external glFogCoordfEXT : float -> unit = "glstub_glFogCoordfEXT"
-  "glstub_glFogCoordfEXT"
+external glFogCoordf : (float [@unboxed]) -> unit = "glstub_glFogCoordf"
+  "glstub_glFogCoordf_nat" [@@noalloc]
+external glFogCoordfEXT : (float [@unboxed]) -> unit
+  = "glstub_glFogCoordfEXT" "glstub_glFogCoordfEXT_nat" [@@noalloc]
 val glFogCoordfv : float array -> unit
 val glFogCoordfvEXT : float array -> unit
-external glFogCoordhNV : int -> unit = "glstub_glFogCoordhNV"
-  "glstub_glFogCoordhNV"
+external glFogCoordhNV : (int [@untagged]) -> unit = "glstub_glFogCoordhNV"
+  "glstub_glFogCoordhNV_nat" [@@noalloc]
 val glFogCoordhvNV : int array -> unit
 val glFogFuncSGIS : int -> float array -> unit
-external glFogf : int -> float -> unit = "glstub_glFogf" "glstub_glFogf"
+external glFogf : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFogf" "glstub_glFogf_nat" [@@noalloc]
 val glFogfv : int -> float array -> unit
-external glFogi : int -> int -> unit = "glstub_glFogi" "glstub_glFogi"
+external glFogi : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFogi" "glstub_glFogi_nat" [@@noalloc]
 val glFogiv : int -> int array -> unit
-external glFragmentColorMaterialEXT : int -> int -> unit
-  = "glstub_glFragmentColorMaterialEXT" "glstub_glFragmentColorMaterialEXT"
-external glFragmentColorMaterialSGIX : int -> int -> unit
-  = "glstub_glFragmentColorMaterialSGIX" "glstub_glFragmentColorMaterialSGIX"
-external glFragmentLightModelfEXT : int -> float -> unit
-  = "glstub_glFragmentLightModelfEXT" "glstub_glFragmentLightModelfEXT"
-external glFragmentLightModelfSGIX : int -> float -> unit
-  = "glstub_glFragmentLightModelfSGIX" "glstub_glFragmentLightModelfSGIX"
+external glFragmentColorMaterialEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentColorMaterialEXT"
+  "glstub_glFragmentColorMaterialEXT_nat" [@@noalloc]
+external glFragmentColorMaterialSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentColorMaterialSGIX"
+  "glstub_glFragmentColorMaterialSGIX_nat" [@@noalloc]
+external glFragmentLightModelfEXT :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentLightModelfEXT" "glstub_glFragmentLightModelfEXT_nat"
+  [@@noalloc]
+external glFragmentLightModelfSGIX :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentLightModelfSGIX" "glstub_glFragmentLightModelfSGIX_nat"
+  [@@noalloc]
 val glFragmentLightModelfvEXT : int -> float array -> unit
 val glFragmentLightModelfvSGIX : int -> float array -> unit
-external glFragmentLightModeliEXT : int -> int -> unit
-  = "glstub_glFragmentLightModeliEXT" "glstub_glFragmentLightModeliEXT"
-external glFragmentLightModeliSGIX : int -> int -> unit
-  = "glstub_glFragmentLightModeliSGIX" "glstub_glFragmentLightModeliSGIX"
+external glFragmentLightModeliEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentLightModeliEXT" "glstub_glFragmentLightModeliEXT_nat"
+  [@@noalloc]
+external glFragmentLightModeliSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentLightModeliSGIX" "glstub_glFragmentLightModeliSGIX_nat"
+  [@@noalloc]
 val glFragmentLightModelivEXT : int -> int array -> unit
 val glFragmentLightModelivSGIX : int -> int array -> unit
-external glFragmentLightfEXT : int -> int -> float -> unit
-  = "glstub_glFragmentLightfEXT" "glstub_glFragmentLightfEXT"
-external glFragmentLightfSGIX : int -> int -> float -> unit
-  = "glstub_glFragmentLightfSGIX" "glstub_glFragmentLightfSGIX"
+external glFragmentLightfEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentLightfEXT" "glstub_glFragmentLightfEXT_nat" [@@noalloc]
+external glFragmentLightfSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentLightfSGIX" "glstub_glFragmentLightfSGIX_nat"
+  [@@noalloc]
 val glFragmentLightfvEXT : int -> int -> float array -> unit
 val glFragmentLightfvSGIX : int -> int -> float array -> unit
-external glFragmentLightiEXT : int -> int -> int -> unit
-  = "glstub_glFragmentLightiEXT" "glstub_glFragmentLightiEXT"
-external glFragmentLightiSGIX : int -> int -> int -> unit
-  = "glstub_glFragmentLightiSGIX" "glstub_glFragmentLightiSGIX"
+external glFragmentLightiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentLightiEXT" "glstub_glFragmentLightiEXT_nat" [@@noalloc]
+external glFragmentLightiSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentLightiSGIX" "glstub_glFragmentLightiSGIX_nat"
+  [@@noalloc]
 val glFragmentLightivEXT : int -> int -> int array -> unit
 val glFragmentLightivSGIX : int -> int -> int array -> unit
-external glFragmentMaterialfEXT : int -> int -> float -> unit
-  = "glstub_glFragmentMaterialfEXT" "glstub_glFragmentMaterialfEXT"
-external glFragmentMaterialfSGIX : int -> int -> float -> unit
-  = "glstub_glFragmentMaterialfSGIX" "glstub_glFragmentMaterialfSGIX"
+external glFragmentMaterialfEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentMaterialfEXT" "glstub_glFragmentMaterialfEXT_nat"
+  [@@noalloc]
+external glFragmentMaterialfSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glFragmentMaterialfSGIX" "glstub_glFragmentMaterialfSGIX_nat"
+  [@@noalloc]
 val glFragmentMaterialfvEXT : int -> int -> float array -> unit
 val glFragmentMaterialfvSGIX : int -> int -> float array -> unit
-external glFragmentMaterialiEXT : int -> int -> int -> unit
-  = "glstub_glFragmentMaterialiEXT" "glstub_glFragmentMaterialiEXT"
-external glFragmentMaterialiSGIX : int -> int -> int -> unit
-  = "glstub_glFragmentMaterialiSGIX" "glstub_glFragmentMaterialiSGIX"
+external glFragmentMaterialiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentMaterialiEXT" "glstub_glFragmentMaterialiEXT_nat"
+  [@@noalloc]
+external glFragmentMaterialiSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFragmentMaterialiSGIX" "glstub_glFragmentMaterialiSGIX_nat"
+  [@@noalloc]
 val glFragmentMaterialivEXT : int -> int -> int array -> unit
 val glFragmentMaterialivSGIX : int -> int -> int array -> unit
-external glFrameZoomSGIX : int -> unit = "glstub_glFrameZoomSGIX"
-  "glstub_glFrameZoomSGIX"
-external glFramebufferRenderbufferEXT : int -> int -> int -> int -> unit
+external glFrameZoomSGIX : (int [@untagged]) -> unit
+  = "glstub_glFrameZoomSGIX" "glstub_glFrameZoomSGIX_nat" [@@noalloc]
+external glFramebufferRenderbuffer :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferRenderbuffer" "glstub_glFramebufferRenderbuffer_nat"
+  [@@noalloc]
+external glFramebufferRenderbufferEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glFramebufferRenderbufferEXT"
-  "glstub_glFramebufferRenderbufferEXT"
-external glFramebufferTexture1DEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glFramebufferTexture1DEXT" "glstub_glFramebufferTexture1DEXT"
-external glFramebufferTexture2DEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glFramebufferTexture2DEXT" "glstub_glFramebufferTexture2DEXT"
+  "glstub_glFramebufferRenderbufferEXT_nat" [@@noalloc]
+external glFramebufferTexture1DEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferTexture1DEXT" "glstub_glFramebufferTexture1DEXT_nat"
+  [@@noalloc]
+external glFramebufferTexture2D :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferTexture2D" "glstub_glFramebufferTexture2D_nat"
+  [@@noalloc]
+external glFramebufferTexture2DEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferTexture2DEXT" "glstub_glFramebufferTexture2DEXT_nat"
+  [@@noalloc]
 external glFramebufferTexture3DEXT :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glFramebufferTexture3DEXT_byte"
-  "glstub_glFramebufferTexture3DEXT"
-external glFramebufferTextureEXT : int -> int -> int -> int -> unit
-  = "glstub_glFramebufferTextureEXT" "glstub_glFramebufferTextureEXT"
+  "glstub_glFramebufferTexture3DEXT_nat" [@@noalloc]
+external glFramebufferTextureEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferTextureEXT" "glstub_glFramebufferTextureEXT_nat"
+  [@@noalloc]
 external glFramebufferTextureFaceEXT :
-  int -> int -> int -> int -> int -> unit
-  = "glstub_glFramebufferTextureFaceEXT" "glstub_glFramebufferTextureFaceEXT"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glFramebufferTextureFaceEXT"
+  "glstub_glFramebufferTextureFaceEXT_nat" [@@noalloc]
 external glFramebufferTextureLayerEXT :
-  int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glFramebufferTextureLayerEXT"
-  "glstub_glFramebufferTextureLayerEXT"
-external glFreeObjectBufferATI : int -> unit = "glstub_glFreeObjectBufferATI"
-  "glstub_glFreeObjectBufferATI"
-external glFrontFace : int -> unit = "glstub_glFrontFace"
-  "glstub_glFrontFace"
+  "glstub_glFramebufferTextureLayerEXT_nat" [@@noalloc]
+external glFreeObjectBufferATI : (int [@untagged]) -> unit
+  = "glstub_glFreeObjectBufferATI" "glstub_glFreeObjectBufferATI_nat"
+  [@@noalloc]
+external glFrontFace : (int [@untagged]) -> unit = "glstub_glFrontFace"
+  "glstub_glFrontFace_nat" [@@noalloc]
 external glFrustum :
-  float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glFrustum_byte" "glstub_glFrustum"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glFrustum_byte" "glstub_glFrustum_nat" [@@noalloc]
 external glFrustumfOES :
-  float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glFrustumfOES_byte" "glstub_glFrustumfOES"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glFrustumfOES_byte" "glstub_glFrustumfOES_nat" [@@noalloc]
 external glGenAsyncMarkersSGIX : int -> int = "glstub_glGenAsyncMarkersSGIX"
-  "glstub_glGenAsyncMarkersSGIX"
+  "glstub_glGenAsyncMarkersSGIX_nat" [@@noalloc] [@@untagged]
 val glGenBuffers : int -> int array -> unit
 val glGenBuffersARB : int -> int array -> unit
 val glGenFencesAPPLE : int -> int array -> unit
 val glGenFencesNV : int -> int array -> unit
 external glGenFragmentShadersATI : int -> int
-  = "glstub_glGenFragmentShadersATI" "glstub_glGenFragmentShadersATI"
+  = "glstub_glGenFragmentShadersATI" "glstub_glGenFragmentShadersATI_nat"
+  [@@noalloc] [@@untagged]
+val glGenFramebuffers : int -> int array -> unit
 val glGenFramebuffersEXT : int -> int array -> unit
-external glGenLists : int -> int = "glstub_glGenLists" "glstub_glGenLists"
+external glGenLists : int -> int = "glstub_glGenLists"
+  "glstub_glGenLists_nat" [@@noalloc] [@@untagged]
 val glGenOcclusionQueriesNV : int -> int array -> unit
 val glGenProgramsARB : int -> int array -> unit
 val glGenProgramsNV : int -> int array -> unit
 val glGenQueries : int -> int array -> unit
 val glGenQueriesARB : int -> int array -> unit
+val glGenRenderbuffers : int -> int array -> unit
 val glGenRenderbuffersEXT : int -> int array -> unit
+val glGenSamplers : int -> int array -> unit
 external glGenSymbolsEXT : int -> int -> int -> int -> int
-  = "glstub_glGenSymbolsEXT" "glstub_glGenSymbolsEXT"
+  = "glstub_glGenSymbolsEXT" "glstub_glGenSymbolsEXT_nat" [@@noalloc]
+  [@@untagged]
 val glGenTextures : int -> int array -> unit
 val glGenTexturesEXT : int -> int array -> unit
 val glGenVertexArrays : int -> int array -> unit
 val glGenVertexArraysAPPLE : int -> int array -> unit
 external glGenVertexShadersEXT : int -> int = "glstub_glGenVertexShadersEXT"
-  "glstub_glGenVertexShadersEXT"
-external glGenerateMipmapEXT : int -> unit = "glstub_glGenerateMipmapEXT"
-  "glstub_glGenerateMipmapEXT"
+  "glstub_glGenVertexShadersEXT_nat" [@@noalloc] [@@untagged]
+external glGenerateMipmap : (int [@untagged]) -> unit
+  = "glstub_glGenerateMipmap" "glstub_glGenerateMipmap_nat" [@@noalloc]
+external glGenerateMipmapEXT : (int [@untagged]) -> unit
+  = "glstub_glGenerateMipmapEXT" "glstub_glGenerateMipmapEXT_nat" [@@noalloc]
 val glGetActiveAttrib :
   int -> int -> int -> int array -> int array -> int array -> string -> unit
 val glGetActiveAttribARB :
@@ -3875,7 +4560,8 @@ val glGetConvolutionParameterivEXT : int -> int -> int array -> unit
 val glGetDetailTexFuncSGIS : int -> float array -> unit
 external glGetDoublev : int -> float array -> unit = "glstub_glGetDoublev"
   "glstub_glGetDoublev"
-external glGetError : unit -> int = "glstub_glGetError" "glstub_glGetError"
+external glGetError : unit -> (int [@untagged]) = "glstub_glGetError"
+  "glstub_glGetError_nat" [@@noalloc]
 val glGetFenceivNV : int -> int -> int array -> unit
 val glGetFinalCombinerInputParameterfvNV : int -> int -> float array -> unit
 val glGetFinalCombinerInputParameterivNV : int -> int -> int array -> unit
@@ -3894,7 +4580,7 @@ val glGetFragmentMaterialivSGIX : int -> int -> int array -> unit
 val glGetFramebufferAttachmentParameterivEXT :
   int -> int -> int -> int array -> unit
 external glGetHandleARB : int -> int = "glstub_glGetHandleARB"
-  "glstub_glGetHandleARB"
+  "glstub_glGetHandleARB_nat" [@@noalloc] [@@untagged]
 external glGetHistogram : int -> bool -> int -> int -> 'a -> unit
   = "glstub_glGetHistogram" "glstub_glGetHistogram"
 external glGetHistogramEXT : int -> bool -> int -> int -> 'a -> unit
@@ -3906,6 +4592,7 @@ val glGetHistogramParameterivEXT : int -> int -> int array -> unit
 val glGetImageTransformParameterfvHP : int -> int -> float array -> unit
 val glGetImageTransformParameterivHP : int -> int -> int array -> unit
 val glGetInfoLogARB : int -> int -> int array -> string -> unit
+val glGetInteger64v : int -> int array -> unit
 val glGetIntegerIndexedvEXT : int -> int -> int array -> unit
 val glGetIntegerv : int -> int array -> unit
 val glGetInvariantBooleanvEXT : int -> int -> bool array -> unit
@@ -3953,6 +4640,7 @@ external glGetPointerv : int -> 'a -> unit = "glstub_glGetPointerv"
 external glGetPointervEXT : int -> 'a -> unit = "glstub_glGetPointervEXT"
   "glstub_glGetPointervEXT"
 val glGetPolygonStipple : int array -> unit
+val glGetProgramBinary : int -> int -> int array -> int array -> 'a -> unit
 external glGetProgramEnvParameterdvARB : int -> int -> float array -> unit
   = "glstub_glGetProgramEnvParameterdvARB"
   "glstub_glGetProgramEnvParameterdvARB"
@@ -3975,8 +4663,12 @@ val glGetProgramStringNV : int -> int -> int array -> unit
 val glGetProgramiv : int -> int -> int array -> unit
 val glGetProgramivARB : int -> int -> int array -> unit
 val glGetProgramivNV : int -> int -> int array -> unit
+val glGetQueryObjecti64v : int -> int -> int array -> unit
+val glGetQueryObjecti64vEXT : int -> int -> int array -> unit
 val glGetQueryObjectiv : int -> int -> int array -> unit
 val glGetQueryObjectivARB : int -> int -> int array -> unit
+val glGetQueryObjectui64v : int -> int -> int array -> unit
+val glGetQueryObjectui64vEXT : int -> int -> int array -> unit
 val glGetQueryObjectuiv : int -> int -> int array -> unit
 val glGetQueryObjectuivARB : int -> int -> int array -> unit
 val glGetQueryiv : int -> int -> int array -> unit
@@ -3994,6 +4686,8 @@ val glGetShaderiv : int -> int -> int array -> unit
 val glGetSharpenTexFuncSGIS : int -> float array -> unit
 external glGetString : int -> string = "glstub_glGetString"
   "glstub_glGetString"
+external glGetStringi : int -> int -> string = "glstub_glGetStringi"
+  "glstub_glGetStringi"
 val glGetTexBumpParameterfvATI : int -> float array -> unit
 val glGetTexBumpParameterivATI : int -> int array -> unit
 val glGetTexEnvfv : int -> int -> float array -> unit
@@ -4016,14 +4710,18 @@ val glGetTexParameterfv : int -> int -> float array -> unit
 val glGetTexParameteriv : int -> int -> int array -> unit
 val glGetTrackMatrixivNV : int -> int -> int -> int array -> unit
 val glGetTransformFeedbackVaryingNV : int -> int -> int array -> unit
+external glGetUniformBlockIndex : int -> string -> int
+  = "glstub_glGetUniformBlockIndex" "glstub_glGetUniformBlockIndex"
 external glGetUniformBufferSizeEXT : int -> int -> int
-  = "glstub_glGetUniformBufferSizeEXT" "glstub_glGetUniformBufferSizeEXT"
+  = "glstub_glGetUniformBufferSizeEXT" "glstub_glGetUniformBufferSizeEXT_nat"
+  [@@noalloc] [@@untagged]
 external glGetUniformLocation : int -> string -> int
   = "glstub_glGetUniformLocation" "glstub_glGetUniformLocation"
 external glGetUniformLocationARB : int -> string -> int
   = "glstub_glGetUniformLocationARB" "glstub_glGetUniformLocationARB"
 external glGetUniformOffsetEXT : int -> int -> int
-  = "glstub_glGetUniformOffsetEXT" "glstub_glGetUniformOffsetEXT"
+  = "glstub_glGetUniformOffsetEXT" "glstub_glGetUniformOffsetEXT_nat"
+  [@@noalloc] [@@untagged]
 val glGetUniformfv : int -> int -> float array -> unit
 val glGetUniformfvARB : int -> int -> float array -> unit
 val glGetUniformiv : int -> int -> int array -> unit
@@ -4061,135 +4759,170 @@ val glGetVertexAttribfvNV : int -> int -> float array -> unit
 val glGetVertexAttribiv : int -> int -> int array -> unit
 val glGetVertexAttribivARB : int -> int -> int array -> unit
 val glGetVertexAttribivNV : int -> int -> int array -> unit
-external glGlobalAlphaFactorbSUN : int -> unit
-  = "glstub_glGlobalAlphaFactorbSUN" "glstub_glGlobalAlphaFactorbSUN"
-external glGlobalAlphaFactordSUN : float -> unit
-  = "glstub_glGlobalAlphaFactordSUN" "glstub_glGlobalAlphaFactordSUN"
-external glGlobalAlphaFactorfSUN : float -> unit
-  = "glstub_glGlobalAlphaFactorfSUN" "glstub_glGlobalAlphaFactorfSUN"
-external glGlobalAlphaFactoriSUN : int -> unit
-  = "glstub_glGlobalAlphaFactoriSUN" "glstub_glGlobalAlphaFactoriSUN"
-external glGlobalAlphaFactorsSUN : int -> unit
-  = "glstub_glGlobalAlphaFactorsSUN" "glstub_glGlobalAlphaFactorsSUN"
-external glGlobalAlphaFactorubSUN : int -> unit
-  = "glstub_glGlobalAlphaFactorubSUN" "glstub_glGlobalAlphaFactorubSUN"
-external glGlobalAlphaFactoruiSUN : int -> unit
-  = "glstub_glGlobalAlphaFactoruiSUN" "glstub_glGlobalAlphaFactoruiSUN"
-external glGlobalAlphaFactorusSUN : int -> unit
-  = "glstub_glGlobalAlphaFactorusSUN" "glstub_glGlobalAlphaFactorusSUN"
-external glHint : int -> int -> unit = "glstub_glHint" "glstub_glHint"
-external glHistogram : int -> int -> int -> bool -> unit
-  = "glstub_glHistogram" "glstub_glHistogram"
-external glHistogramEXT : int -> int -> int -> bool -> unit
-  = "glstub_glHistogramEXT" "glstub_glHistogramEXT"
-external glImageTransformParameterfHP : int -> int -> float -> unit
+external glGlobalAlphaFactorbSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactorbSUN" "glstub_glGlobalAlphaFactorbSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactordSUN : (float [@unboxed]) -> unit
+  = "glstub_glGlobalAlphaFactordSUN" "glstub_glGlobalAlphaFactordSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactorfSUN : (float [@unboxed]) -> unit
+  = "glstub_glGlobalAlphaFactorfSUN" "glstub_glGlobalAlphaFactorfSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactoriSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactoriSUN" "glstub_glGlobalAlphaFactoriSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactorsSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactorsSUN" "glstub_glGlobalAlphaFactorsSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactorubSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactorubSUN" "glstub_glGlobalAlphaFactorubSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactoruiSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactoruiSUN" "glstub_glGlobalAlphaFactoruiSUN_nat"
+  [@@noalloc]
+external glGlobalAlphaFactorusSUN : (int [@untagged]) -> unit
+  = "glstub_glGlobalAlphaFactorusSUN" "glstub_glGlobalAlphaFactorusSUN_nat"
+  [@@noalloc]
+external glHint : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glHint" "glstub_glHint_nat" [@@noalloc]
+external glHistogram :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> unit
+  = "glstub_glHistogram" "glstub_glHistogram_nat" [@@noalloc]
+external glHistogramEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> bool -> unit
+  = "glstub_glHistogramEXT" "glstub_glHistogramEXT_nat" [@@noalloc]
+external glImageTransformParameterfHP :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
   = "glstub_glImageTransformParameterfHP"
-  "glstub_glImageTransformParameterfHP"
+  "glstub_glImageTransformParameterfHP_nat" [@@noalloc]
 val glImageTransformParameterfvHP : int -> int -> float array -> unit
-external glImageTransformParameteriHP : int -> int -> int -> unit
+external glImageTransformParameteriHP :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glImageTransformParameteriHP"
-  "glstub_glImageTransformParameteriHP"
+  "glstub_glImageTransformParameteriHP_nat" [@@noalloc]
 val glImageTransformParameterivHP : int -> int -> int array -> unit
-external glIndexFuncEXT : int -> float -> unit = "glstub_glIndexFuncEXT"
-  "glstub_glIndexFuncEXT"
-external glIndexMask : int -> unit = "glstub_glIndexMask"
-  "glstub_glIndexMask"
-external glIndexMaterialEXT : int -> int -> unit
-  = "glstub_glIndexMaterialEXT" "glstub_glIndexMaterialEXT"
+external glIndexFuncEXT : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glIndexFuncEXT" "glstub_glIndexFuncEXT_nat" [@@noalloc]
+external glIndexMask : (int [@untagged]) -> unit = "glstub_glIndexMask"
+  "glstub_glIndexMask_nat" [@@noalloc]
+external glIndexMaterialEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glIndexMaterialEXT" "glstub_glIndexMaterialEXT_nat" [@@noalloc]
 external glIndexPointer : int -> int -> 'a -> unit = "glstub_glIndexPointer"
   "glstub_glIndexPointer"
 external glIndexPointerEXT : int -> int -> int -> 'a -> unit
   = "glstub_glIndexPointerEXT" "glstub_glIndexPointerEXT"
 external glIndexPointerListIBM : int -> int -> 'a -> int -> unit
   = "glstub_glIndexPointerListIBM" "glstub_glIndexPointerListIBM"
-external glIndexd : float -> unit = "glstub_glIndexd" "glstub_glIndexd"
+external glIndexd : (float [@unboxed]) -> unit = "glstub_glIndexd"
+  "glstub_glIndexd_nat" [@@noalloc]
 external glIndexdv : float array -> unit = "glstub_glIndexdv"
   "glstub_glIndexdv"
-external glIndexf : float -> unit = "glstub_glIndexf" "glstub_glIndexf"
+external glIndexf : (float [@unboxed]) -> unit = "glstub_glIndexf"
+  "glstub_glIndexf_nat" [@@noalloc]
 val glIndexfv : float array -> unit
-external glIndexi : int -> unit = "glstub_glIndexi" "glstub_glIndexi"
+external glIndexi : (int [@untagged]) -> unit = "glstub_glIndexi"
+  "glstub_glIndexi_nat" [@@noalloc]
 val glIndexiv : int array -> unit
-external glIndexs : int -> unit = "glstub_glIndexs" "glstub_glIndexs"
+external glIndexs : (int [@untagged]) -> unit = "glstub_glIndexs"
+  "glstub_glIndexs_nat" [@@noalloc]
 val glIndexsv : int array -> unit
-external glIndexub : int -> unit = "glstub_glIndexub" "glstub_glIndexub"
+external glIndexub : (int [@untagged]) -> unit = "glstub_glIndexub"
+  "glstub_glIndexub_nat" [@@noalloc]
 val glIndexubv : int array -> unit
 external glInitNames : unit -> unit = "glstub_glInitNames"
-  "glstub_glInitNames"
-external glInsertComponentEXT : int -> int -> int -> unit
-  = "glstub_glInsertComponentEXT" "glstub_glInsertComponentEXT"
+  "glstub_glInitNames_nat" [@@noalloc]
+external glInsertComponentEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glInsertComponentEXT" "glstub_glInsertComponentEXT_nat"
+  [@@noalloc]
 external glInterleavedArrays : int -> int -> 'a -> unit
   = "glstub_glInterleavedArrays" "glstub_glInterleavedArrays"
-external glIsAsyncMarkerSGIX : int -> bool = "glstub_glIsAsyncMarkerSGIX"
-  "glstub_glIsAsyncMarkerSGIX"
-external glIsBuffer : int -> bool = "glstub_glIsBuffer" "glstub_glIsBuffer"
-external glIsBufferARB : int -> bool = "glstub_glIsBufferARB"
-  "glstub_glIsBufferARB"
-external glIsEnabled : int -> bool = "glstub_glIsEnabled"
-  "glstub_glIsEnabled"
-external glIsEnabledIndexedEXT : int -> int -> bool
-  = "glstub_glIsEnabledIndexedEXT" "glstub_glIsEnabledIndexedEXT"
-external glIsFenceAPPLE : int -> bool = "glstub_glIsFenceAPPLE"
-  "glstub_glIsFenceAPPLE"
-external glIsFenceNV : int -> bool = "glstub_glIsFenceNV"
-  "glstub_glIsFenceNV"
-external glIsFramebufferEXT : int -> bool = "glstub_glIsFramebufferEXT"
-  "glstub_glIsFramebufferEXT"
-external glIsList : int -> bool = "glstub_glIsList" "glstub_glIsList"
-external glIsObjectBufferATI : int -> bool = "glstub_glIsObjectBufferATI"
-  "glstub_glIsObjectBufferATI"
-external glIsOcclusionQueryNV : int -> bool = "glstub_glIsOcclusionQueryNV"
-  "glstub_glIsOcclusionQueryNV"
-external glIsProgram : int -> bool = "glstub_glIsProgram"
-  "glstub_glIsProgram"
-external glIsProgramARB : int -> bool = "glstub_glIsProgramARB"
-  "glstub_glIsProgramARB"
-external glIsProgramNV : int -> bool = "glstub_glIsProgramNV"
-  "glstub_glIsProgramNV"
-external glIsQuery : int -> bool = "glstub_glIsQuery" "glstub_glIsQuery"
-external glIsQueryARB : int -> bool = "glstub_glIsQueryARB"
-  "glstub_glIsQueryARB"
-external glIsRenderbufferEXT : int -> bool = "glstub_glIsRenderbufferEXT"
-  "glstub_glIsRenderbufferEXT"
-external glIsShader : int -> bool = "glstub_glIsShader" "glstub_glIsShader"
-external glIsTexture : int -> bool = "glstub_glIsTexture"
-  "glstub_glIsTexture"
-external glIsTextureEXT : int -> bool = "glstub_glIsTextureEXT"
-  "glstub_glIsTextureEXT"
-external glIsVariantEnabledEXT : int -> int -> bool
-  = "glstub_glIsVariantEnabledEXT" "glstub_glIsVariantEnabledEXT"
-external glIsVertexArray : int -> bool = "glstub_glIsVertexArray"
-  "glstub_glIsVertexArray"
-external glIsVertexArrayAPPLE : int -> bool = "glstub_glIsVertexArrayAPPLE"
-  "glstub_glIsVertexArrayAPPLE"
-external glLightEnviEXT : int -> int -> unit = "glstub_glLightEnviEXT"
-  "glstub_glLightEnviEXT"
-external glLightModelf : int -> float -> unit = "glstub_glLightModelf"
-  "glstub_glLightModelf"
+external glIsAsyncMarkerSGIX : (int [@untagged]) -> bool
+  = "glstub_glIsAsyncMarkerSGIX" "glstub_glIsAsyncMarkerSGIX_nat" [@@noalloc]
+external glIsBuffer : (int [@untagged]) -> bool = "glstub_glIsBuffer"
+  "glstub_glIsBuffer_nat" [@@noalloc]
+external glIsBufferARB : (int [@untagged]) -> bool = "glstub_glIsBufferARB"
+  "glstub_glIsBufferARB_nat" [@@noalloc]
+external glIsEnabled : (int [@untagged]) -> bool = "glstub_glIsEnabled"
+  "glstub_glIsEnabled_nat" [@@noalloc]
+external glIsEnabledIndexedEXT :
+  (int [@untagged]) -> (int [@untagged]) -> bool
+  = "glstub_glIsEnabledIndexedEXT" "glstub_glIsEnabledIndexedEXT_nat"
+  [@@noalloc]
+external glIsFenceAPPLE : (int [@untagged]) -> bool = "glstub_glIsFenceAPPLE"
+  "glstub_glIsFenceAPPLE_nat" [@@noalloc]
+external glIsFenceNV : (int [@untagged]) -> bool = "glstub_glIsFenceNV"
+  "glstub_glIsFenceNV_nat" [@@noalloc]
+external glIsFramebufferEXT : (int [@untagged]) -> bool
+  = "glstub_glIsFramebufferEXT" "glstub_glIsFramebufferEXT_nat" [@@noalloc]
+external glIsList : (int [@untagged]) -> bool = "glstub_glIsList"
+  "glstub_glIsList_nat" [@@noalloc]
+external glIsObjectBufferATI : (int [@untagged]) -> bool
+  = "glstub_glIsObjectBufferATI" "glstub_glIsObjectBufferATI_nat" [@@noalloc]
+external glIsOcclusionQueryNV : (int [@untagged]) -> bool
+  = "glstub_glIsOcclusionQueryNV" "glstub_glIsOcclusionQueryNV_nat"
+  [@@noalloc]
+external glIsProgram : (int [@untagged]) -> bool = "glstub_glIsProgram"
+  "glstub_glIsProgram_nat" [@@noalloc]
+external glIsProgramARB : (int [@untagged]) -> bool = "glstub_glIsProgramARB"
+  "glstub_glIsProgramARB_nat" [@@noalloc]
+external glIsProgramNV : (int [@untagged]) -> bool = "glstub_glIsProgramNV"
+  "glstub_glIsProgramNV_nat" [@@noalloc]
+external glIsQuery : (int [@untagged]) -> bool = "glstub_glIsQuery"
+  "glstub_glIsQuery_nat" [@@noalloc]
+external glIsQueryARB : (int [@untagged]) -> bool = "glstub_glIsQueryARB"
+  "glstub_glIsQueryARB_nat" [@@noalloc]
+external glIsRenderbufferEXT : (int [@untagged]) -> bool
+  = "glstub_glIsRenderbufferEXT" "glstub_glIsRenderbufferEXT_nat" [@@noalloc]
+external glIsShader : (int [@untagged]) -> bool = "glstub_glIsShader"
+  "glstub_glIsShader_nat" [@@noalloc]
+external glIsSync : sync -> bool = "glstub_glIsSync" "glstub_glIsSync"
+external glIsTexture : (int [@untagged]) -> bool = "glstub_glIsTexture"
+  "glstub_glIsTexture_nat" [@@noalloc]
+external glIsTextureEXT : (int [@untagged]) -> bool = "glstub_glIsTextureEXT"
+  "glstub_glIsTextureEXT_nat" [@@noalloc]
+external glIsVariantEnabledEXT :
+  (int [@untagged]) -> (int [@untagged]) -> bool
+  = "glstub_glIsVariantEnabledEXT" "glstub_glIsVariantEnabledEXT_nat"
+  [@@noalloc]
+external glIsVertexArray : (int [@untagged]) -> bool
+  = "glstub_glIsVertexArray" "glstub_glIsVertexArray_nat" [@@noalloc]
+external glIsVertexArrayAPPLE : (int [@untagged]) -> bool
+  = "glstub_glIsVertexArrayAPPLE" "glstub_glIsVertexArrayAPPLE_nat"
+  [@@noalloc]
+external glLightEnviEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glLightEnviEXT" "glstub_glLightEnviEXT_nat" [@@noalloc]
+external glLightModelf : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glLightModelf" "glstub_glLightModelf_nat" [@@noalloc]
 val glLightModelfv : int -> float array -> unit
-external glLightModeli : int -> int -> unit = "glstub_glLightModeli"
-  "glstub_glLightModeli"
+external glLightModeli : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glLightModeli" "glstub_glLightModeli_nat" [@@noalloc]
 val glLightModeliv : int -> int array -> unit
-external glLightf : int -> int -> float -> unit = "glstub_glLightf"
-  "glstub_glLightf"
+external glLightf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glLightf" "glstub_glLightf_nat" [@@noalloc]
 val glLightfv : int -> int -> float array -> unit
-external glLighti : int -> int -> int -> unit = "glstub_glLighti"
-  "glstub_glLighti"
+external glLighti :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glLighti" "glstub_glLighti_nat" [@@noalloc]
 val glLightiv : int -> int -> int array -> unit
-external glLineStipple : int -> int -> unit = "glstub_glLineStipple"
-  "glstub_glLineStipple"
-external glLineWidth : float -> unit = "glstub_glLineWidth"
-  "glstub_glLineWidth"
-external glLinkProgram : int -> unit = "glstub_glLinkProgram"
-  "glstub_glLinkProgram"
-external glLinkProgramARB : int -> unit = "glstub_glLinkProgramARB"
-  "glstub_glLinkProgramARB"
-external glListBase : int -> unit = "glstub_glListBase" "glstub_glListBase"
+external glLineStipple : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glLineStipple" "glstub_glLineStipple_nat" [@@noalloc]
+external glLineWidth : (float [@unboxed]) -> unit = "glstub_glLineWidth"
+  "glstub_glLineWidth_nat" [@@noalloc]
+external glLinkProgram : (int [@untagged]) -> unit = "glstub_glLinkProgram"
+  "glstub_glLinkProgram_nat" [@@noalloc]
+external glLinkProgramARB : (int [@untagged]) -> unit
+  = "glstub_glLinkProgramARB" "glstub_glLinkProgramARB_nat" [@@noalloc]
+external glListBase : (int [@untagged]) -> unit = "glstub_glListBase"
+  "glstub_glListBase_nat" [@@noalloc]
 external glLoadIdentity : unit -> unit = "glstub_glLoadIdentity"
-  "glstub_glLoadIdentity"
+  "glstub_glLoadIdentity_nat" [@@noalloc]
 external glLoadMatrixd : float array -> unit = "glstub_glLoadMatrixd"
   "glstub_glLoadMatrixd"
 val glLoadMatrixf : float array -> unit
-external glLoadName : int -> unit = "glstub_glLoadName" "glstub_glLoadName"
+external glLoadName : (int [@untagged]) -> unit = "glstub_glLoadName"
+  "glstub_glLoadName_nat" [@@noalloc]
 val glLoadProgramNV : int -> int -> int -> int array -> unit
 external glLoadTransposeMatrixd : float array -> unit
   = "glstub_glLoadTransposeMatrixd" "glstub_glLoadTransposeMatrixd"
@@ -4197,9 +4930,10 @@ external glLoadTransposeMatrixdARB : float array -> unit
   = "glstub_glLoadTransposeMatrixdARB" "glstub_glLoadTransposeMatrixdARB"
 val glLoadTransposeMatrixf : float array -> unit
 val glLoadTransposeMatrixfARB : float array -> unit
-external glLockArraysEXT : int -> int -> unit = "glstub_glLockArraysEXT"
-  "glstub_glLockArraysEXT"
-external glLogicOp : int -> unit = "glstub_glLogicOp" "glstub_glLogicOp"
+external glLockArraysEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glLockArraysEXT" "glstub_glLockArraysEXT_nat" [@@noalloc]
+external glLogicOp : (int [@untagged]) -> unit = "glstub_glLogicOp"
+  "glstub_glLogicOp_nat" [@@noalloc]
 external glMap1d : int -> float -> float -> int -> int -> float array -> unit
   = "glstub_glMap1d_byte" "glstub_glMap1d"
 val glMap1f : int -> float -> float -> int -> int -> float array -> unit
@@ -4216,38 +4950,58 @@ external glMapBuffer : int -> int -> 'a = "glstub_glMapBuffer"
   "glstub_glMapBuffer"
 external glMapBufferARB : int -> int -> 'a = "glstub_glMapBufferARB"
   "glstub_glMapBufferARB"
+external glMapBufferRange : int -> int -> int -> int -> 'a
+  = "glstub_glMapBufferRange" "glstub_glMapBufferRange"
 external glMapControlPointsNV :
   int -> int -> int -> int -> int -> int -> int -> bool -> 'a -> unit
   = "glstub_glMapControlPointsNV_byte" "glstub_glMapControlPointsNV"
-external glMapGrid1d : int -> float -> float -> unit = "glstub_glMapGrid1d"
-  "glstub_glMapGrid1d"
-external glMapGrid1f : int -> float -> float -> unit = "glstub_glMapGrid1f"
-  "glstub_glMapGrid1f"
-external glMapGrid2d : int -> float -> float -> int -> float -> float -> unit
-  = "glstub_glMapGrid2d_byte" "glstub_glMapGrid2d"
-external glMapGrid2f : int -> float -> float -> int -> float -> float -> unit
-  = "glstub_glMapGrid2f_byte" "glstub_glMapGrid2f"
+external glMapGrid1d :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMapGrid1d" "glstub_glMapGrid1d_nat" [@@noalloc]
+external glMapGrid1f :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMapGrid1f" "glstub_glMapGrid1f_nat" [@@noalloc]
+external glMapGrid2d :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMapGrid2d_byte" "glstub_glMapGrid2d_nat" [@@noalloc]
+external glMapGrid2f :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMapGrid2f_byte" "glstub_glMapGrid2f_nat" [@@noalloc]
 external glMapObjectBufferATI : int -> 'a = "glstub_glMapObjectBufferATI"
   "glstub_glMapObjectBufferATI"
 val glMapParameterfvNV : int -> int -> float array -> unit
 val glMapParameterivNV : int -> int -> int array -> unit
-external glMaterialf : int -> int -> float -> unit = "glstub_glMaterialf"
-  "glstub_glMaterialf"
+external glMaterialf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glMaterialf" "glstub_glMaterialf_nat" [@@noalloc]
 val glMaterialfv : int -> int -> float array -> unit
-external glMateriali : int -> int -> int -> unit = "glstub_glMateriali"
-  "glstub_glMateriali"
+external glMateriali :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMateriali" "glstub_glMateriali_nat" [@@noalloc]
 val glMaterialiv : int -> int -> int array -> unit
 external glMatrixIndexPointerARB : int -> int -> int -> 'a -> unit
   = "glstub_glMatrixIndexPointerARB" "glstub_glMatrixIndexPointerARB"
 val glMatrixIndexubvARB : int -> int array -> unit
 val glMatrixIndexuivARB : int -> int array -> unit
 val glMatrixIndexusvARB : int -> int array -> unit
-external glMatrixMode : int -> unit = "glstub_glMatrixMode"
-  "glstub_glMatrixMode"
-external glMinmax : int -> int -> bool -> unit = "glstub_glMinmax"
-  "glstub_glMinmax"
-external glMinmaxEXT : int -> int -> bool -> unit = "glstub_glMinmaxEXT"
-  "glstub_glMinmaxEXT"
+external glMatrixMode : (int [@untagged]) -> unit = "glstub_glMatrixMode"
+  "glstub_glMatrixMode_nat" [@@noalloc]
+external glMaxShaderCompilerThreadsARB : (int [@untagged]) -> unit
+  = "glstub_glMaxShaderCompilerThreadsARB"
+  "glstub_glMaxShaderCompilerThreadsARB_nat" [@@noalloc]
+external glMaxShaderCompilerThreadsKHR : (int [@untagged]) -> unit
+  = "glstub_glMaxShaderCompilerThreadsKHR"
+  "glstub_glMaxShaderCompilerThreadsKHR_nat" [@@noalloc]
+external glMinmax : (int [@untagged]) -> (int [@untagged]) -> bool -> unit
+  = "glstub_glMinmax" "glstub_glMinmax_nat" [@@noalloc]
+external glMinmaxEXT : (int [@untagged]) -> (int [@untagged]) -> bool -> unit
+  = "glstub_glMinmaxEXT" "glstub_glMinmaxEXT_nat" [@@noalloc]
 external glMultMatrixd : float array -> unit = "glstub_glMultMatrixd"
   "glstub_glMultMatrixd"
 val glMultMatrixf : float array -> unit
@@ -4259,160 +5013,255 @@ val glMultTransposeMatrixf : float array -> unit
 val glMultTransposeMatrixfARB : float array -> unit
 val glMultiDrawArrays : int -> int array -> int array -> int -> unit
 val glMultiDrawArraysEXT : int -> int array -> int array -> int -> unit
+external glMultiDrawArraysIndirect :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiDrawArraysIndirect" "glstub_glMultiDrawArraysIndirect_nat"
+  [@@noalloc]
 val glMultiDrawElementArrayAPPLE :
   int -> int array -> int array -> int -> unit
 val glMultiDrawElements : int -> int array -> int -> 'a -> int -> unit
+val glMultiDrawElementsBaseVertex :
+  int -> int array -> int -> 'a -> int -> int array -> unit
 val glMultiDrawElementsEXT : int -> int array -> int -> 'a -> int -> unit
+external glMultiDrawElementsIndirect :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiDrawElementsIndirect"
+  "glstub_glMultiDrawElementsIndirect_nat" [@@noalloc]
 val glMultiDrawRangeElementArrayAPPLE :
   int -> int -> int -> int array -> int array -> int -> unit
 val glMultiModeDrawArraysIBM :
   int array -> int array -> int array -> int -> int -> unit
 val glMultiModeDrawElementsIBM :
   int array -> int array -> int -> 'a -> int -> int -> unit
-external glMultiTexCoord1d : int -> float -> unit
-  = "glstub_glMultiTexCoord1d" "glstub_glMultiTexCoord1d"
-external glMultiTexCoord1dARB : int -> float -> unit
-  = "glstub_glMultiTexCoord1dARB" "glstub_glMultiTexCoord1dARB"
+external glMultiTexCoord1d : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord1d" "glstub_glMultiTexCoord1d_nat" [@@noalloc]
+external glMultiTexCoord1dARB :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord1dARB" "glstub_glMultiTexCoord1dARB_nat"
+  [@@noalloc]
 external glMultiTexCoord1dv : int -> float array -> unit
   = "glstub_glMultiTexCoord1dv" "glstub_glMultiTexCoord1dv"
 external glMultiTexCoord1dvARB : int -> float array -> unit
   = "glstub_glMultiTexCoord1dvARB" "glstub_glMultiTexCoord1dvARB"
-external glMultiTexCoord1f : int -> float -> unit
-  = "glstub_glMultiTexCoord1f" "glstub_glMultiTexCoord1f"
-external glMultiTexCoord1fARB : int -> float -> unit
-  = "glstub_glMultiTexCoord1fARB" "glstub_glMultiTexCoord1fARB"
+external glMultiTexCoord1f : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord1f" "glstub_glMultiTexCoord1f_nat" [@@noalloc]
+external glMultiTexCoord1fARB :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord1fARB" "glstub_glMultiTexCoord1fARB_nat"
+  [@@noalloc]
 val glMultiTexCoord1fv : int -> float array -> unit
 val glMultiTexCoord1fvARB : int -> float array -> unit
-external glMultiTexCoord1hNV : int -> int -> unit
-  = "glstub_glMultiTexCoord1hNV" "glstub_glMultiTexCoord1hNV"
+external glMultiTexCoord1hNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord1hNV" "glstub_glMultiTexCoord1hNV_nat" [@@noalloc]
 val glMultiTexCoord1hvNV : int -> int array -> unit
-external glMultiTexCoord1i : int -> int -> unit = "glstub_glMultiTexCoord1i"
-  "glstub_glMultiTexCoord1i"
-external glMultiTexCoord1iARB : int -> int -> unit
-  = "glstub_glMultiTexCoord1iARB" "glstub_glMultiTexCoord1iARB"
+external glMultiTexCoord1i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord1i" "glstub_glMultiTexCoord1i_nat" [@@noalloc]
+external glMultiTexCoord1iARB :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord1iARB" "glstub_glMultiTexCoord1iARB_nat"
+  [@@noalloc]
 val glMultiTexCoord1iv : int -> int array -> unit
 val glMultiTexCoord1ivARB : int -> int array -> unit
-external glMultiTexCoord1s : int -> int -> unit = "glstub_glMultiTexCoord1s"
-  "glstub_glMultiTexCoord1s"
-external glMultiTexCoord1sARB : int -> int -> unit
-  = "glstub_glMultiTexCoord1sARB" "glstub_glMultiTexCoord1sARB"
+external glMultiTexCoord1s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord1s" "glstub_glMultiTexCoord1s_nat" [@@noalloc]
+external glMultiTexCoord1sARB :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord1sARB" "glstub_glMultiTexCoord1sARB_nat"
+  [@@noalloc]
 val glMultiTexCoord1sv : int -> int array -> unit
 val glMultiTexCoord1svARB : int -> int array -> unit
-external glMultiTexCoord2d : int -> float -> float -> unit
-  = "glstub_glMultiTexCoord2d" "glstub_glMultiTexCoord2d"
-external glMultiTexCoord2dARB : int -> float -> float -> unit
-  = "glstub_glMultiTexCoord2dARB" "glstub_glMultiTexCoord2dARB"
+external glMultiTexCoord2d :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord2d" "glstub_glMultiTexCoord2d_nat" [@@noalloc]
+external glMultiTexCoord2dARB :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord2dARB" "glstub_glMultiTexCoord2dARB_nat"
+  [@@noalloc]
 external glMultiTexCoord2dv : int -> float array -> unit
   = "glstub_glMultiTexCoord2dv" "glstub_glMultiTexCoord2dv"
 external glMultiTexCoord2dvARB : int -> float array -> unit
   = "glstub_glMultiTexCoord2dvARB" "glstub_glMultiTexCoord2dvARB"
-external glMultiTexCoord2f : int -> float -> float -> unit
-  = "glstub_glMultiTexCoord2f" "glstub_glMultiTexCoord2f"
-external glMultiTexCoord2fARB : int -> float -> float -> unit
-  = "glstub_glMultiTexCoord2fARB" "glstub_glMultiTexCoord2fARB"
+external glMultiTexCoord2f :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord2f" "glstub_glMultiTexCoord2f_nat" [@@noalloc]
+external glMultiTexCoord2fARB :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord2fARB" "glstub_glMultiTexCoord2fARB_nat"
+  [@@noalloc]
 val glMultiTexCoord2fv : int -> float array -> unit
 val glMultiTexCoord2fvARB : int -> float array -> unit
-external glMultiTexCoord2hNV : int -> int -> int -> unit
-  = "glstub_glMultiTexCoord2hNV" "glstub_glMultiTexCoord2hNV"
+external glMultiTexCoord2hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord2hNV" "glstub_glMultiTexCoord2hNV_nat" [@@noalloc]
 val glMultiTexCoord2hvNV : int -> int array -> unit
-external glMultiTexCoord2i : int -> int -> int -> unit
-  = "glstub_glMultiTexCoord2i" "glstub_glMultiTexCoord2i"
-external glMultiTexCoord2iARB : int -> int -> int -> unit
-  = "glstub_glMultiTexCoord2iARB" "glstub_glMultiTexCoord2iARB"
+external glMultiTexCoord2i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord2i" "glstub_glMultiTexCoord2i_nat" [@@noalloc]
+external glMultiTexCoord2iARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord2iARB" "glstub_glMultiTexCoord2iARB_nat"
+  [@@noalloc]
 val glMultiTexCoord2iv : int -> int array -> unit
 val glMultiTexCoord2ivARB : int -> int array -> unit
-external glMultiTexCoord2s : int -> int -> int -> unit
-  = "glstub_glMultiTexCoord2s" "glstub_glMultiTexCoord2s"
-external glMultiTexCoord2sARB : int -> int -> int -> unit
-  = "glstub_glMultiTexCoord2sARB" "glstub_glMultiTexCoord2sARB"
+external glMultiTexCoord2s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord2s" "glstub_glMultiTexCoord2s_nat" [@@noalloc]
+external glMultiTexCoord2sARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord2sARB" "glstub_glMultiTexCoord2sARB_nat"
+  [@@noalloc]
 val glMultiTexCoord2sv : int -> int array -> unit
 val glMultiTexCoord2svARB : int -> int array -> unit
-external glMultiTexCoord3d : int -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord3d" "glstub_glMultiTexCoord3d"
-external glMultiTexCoord3dARB : int -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord3dARB" "glstub_glMultiTexCoord3dARB"
+external glMultiTexCoord3d :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord3d" "glstub_glMultiTexCoord3d_nat" [@@noalloc]
+external glMultiTexCoord3dARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord3dARB" "glstub_glMultiTexCoord3dARB_nat"
+  [@@noalloc]
 external glMultiTexCoord3dv : int -> float array -> unit
   = "glstub_glMultiTexCoord3dv" "glstub_glMultiTexCoord3dv"
 external glMultiTexCoord3dvARB : int -> float array -> unit
   = "glstub_glMultiTexCoord3dvARB" "glstub_glMultiTexCoord3dvARB"
-external glMultiTexCoord3f : int -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord3f" "glstub_glMultiTexCoord3f"
-external glMultiTexCoord3fARB : int -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord3fARB" "glstub_glMultiTexCoord3fARB"
+external glMultiTexCoord3f :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord3f" "glstub_glMultiTexCoord3f_nat" [@@noalloc]
+external glMultiTexCoord3fARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord3fARB" "glstub_glMultiTexCoord3fARB_nat"
+  [@@noalloc]
 val glMultiTexCoord3fv : int -> float array -> unit
 val glMultiTexCoord3fvARB : int -> float array -> unit
-external glMultiTexCoord3hNV : int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord3hNV" "glstub_glMultiTexCoord3hNV"
+external glMultiTexCoord3hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord3hNV" "glstub_glMultiTexCoord3hNV_nat" [@@noalloc]
 val glMultiTexCoord3hvNV : int -> int array -> unit
-external glMultiTexCoord3i : int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord3i" "glstub_glMultiTexCoord3i"
-external glMultiTexCoord3iARB : int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord3iARB" "glstub_glMultiTexCoord3iARB"
+external glMultiTexCoord3i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord3i" "glstub_glMultiTexCoord3i_nat" [@@noalloc]
+external glMultiTexCoord3iARB :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord3iARB" "glstub_glMultiTexCoord3iARB_nat"
+  [@@noalloc]
 val glMultiTexCoord3iv : int -> int array -> unit
 val glMultiTexCoord3ivARB : int -> int array -> unit
-external glMultiTexCoord3s : int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord3s" "glstub_glMultiTexCoord3s"
-external glMultiTexCoord3sARB : int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord3sARB" "glstub_glMultiTexCoord3sARB"
+external glMultiTexCoord3s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord3s" "glstub_glMultiTexCoord3s_nat" [@@noalloc]
+external glMultiTexCoord3sARB :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord3sARB" "glstub_glMultiTexCoord3sARB_nat"
+  [@@noalloc]
 val glMultiTexCoord3sv : int -> int array -> unit
 val glMultiTexCoord3svARB : int -> int array -> unit
-external glMultiTexCoord4d : int -> float -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord4d" "glstub_glMultiTexCoord4d"
+external glMultiTexCoord4d :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord4d" "glstub_glMultiTexCoord4d_nat" [@@noalloc]
 external glMultiTexCoord4dARB :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord4dARB" "glstub_glMultiTexCoord4dARB"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord4dARB" "glstub_glMultiTexCoord4dARB_nat"
+  [@@noalloc]
 external glMultiTexCoord4dv : int -> float array -> unit
   = "glstub_glMultiTexCoord4dv" "glstub_glMultiTexCoord4dv"
 external glMultiTexCoord4dvARB : int -> float array -> unit
   = "glstub_glMultiTexCoord4dvARB" "glstub_glMultiTexCoord4dvARB"
-external glMultiTexCoord4f : int -> float -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord4f" "glstub_glMultiTexCoord4f"
+external glMultiTexCoord4f :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord4f" "glstub_glMultiTexCoord4f_nat" [@@noalloc]
 external glMultiTexCoord4fARB :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glMultiTexCoord4fARB" "glstub_glMultiTexCoord4fARB"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glMultiTexCoord4fARB" "glstub_glMultiTexCoord4fARB_nat"
+  [@@noalloc]
 val glMultiTexCoord4fv : int -> float array -> unit
 val glMultiTexCoord4fvARB : int -> float array -> unit
-external glMultiTexCoord4hNV : int -> int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord4hNV" "glstub_glMultiTexCoord4hNV"
+external glMultiTexCoord4hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord4hNV" "glstub_glMultiTexCoord4hNV_nat" [@@noalloc]
 val glMultiTexCoord4hvNV : int -> int array -> unit
-external glMultiTexCoord4i : int -> int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord4i" "glstub_glMultiTexCoord4i"
-external glMultiTexCoord4iARB : int -> int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord4iARB" "glstub_glMultiTexCoord4iARB"
+external glMultiTexCoord4i :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord4i" "glstub_glMultiTexCoord4i_nat" [@@noalloc]
+external glMultiTexCoord4iARB :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord4iARB" "glstub_glMultiTexCoord4iARB_nat"
+  [@@noalloc]
 val glMultiTexCoord4iv : int -> int array -> unit
 val glMultiTexCoord4ivARB : int -> int array -> unit
-external glMultiTexCoord4s : int -> int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord4s" "glstub_glMultiTexCoord4s"
-external glMultiTexCoord4sARB : int -> int -> int -> int -> int -> unit
-  = "glstub_glMultiTexCoord4sARB" "glstub_glMultiTexCoord4sARB"
+external glMultiTexCoord4s :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord4s" "glstub_glMultiTexCoord4s_nat" [@@noalloc]
+external glMultiTexCoord4sARB :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glMultiTexCoord4sARB" "glstub_glMultiTexCoord4sARB_nat"
+  [@@noalloc]
 val glMultiTexCoord4sv : int -> int array -> unit
 val glMultiTexCoord4svARB : int -> int array -> unit
-external glNewList : int -> int -> unit = "glstub_glNewList"
-  "glstub_glNewList"
+external glNewList : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNewList" "glstub_glNewList_nat" [@@noalloc]
 external glNewObjectBufferATI : int -> 'a -> int -> int
   = "glstub_glNewObjectBufferATI" "glstub_glNewObjectBufferATI"
-external glNormal3b : int -> int -> int -> unit = "glstub_glNormal3b"
-  "glstub_glNormal3b"
+external glNormal3b :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormal3b" "glstub_glNormal3b_nat" [@@noalloc]
 val glNormal3bv : int array -> unit
-external glNormal3d : float -> float -> float -> unit = "glstub_glNormal3d"
-  "glstub_glNormal3d"
+external glNormal3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glNormal3d" "glstub_glNormal3d_nat" [@@noalloc]
 external glNormal3dv : float array -> unit = "glstub_glNormal3dv"
   "glstub_glNormal3dv"
-external glNormal3f : float -> float -> float -> unit = "glstub_glNormal3f"
-  "glstub_glNormal3f"
+external glNormal3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glNormal3f" "glstub_glNormal3f_nat" [@@noalloc]
 external glNormal3fVertex3fSUN :
-  float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glNormal3fVertex3fSUN_byte" "glstub_glNormal3fVertex3fSUN"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glNormal3fVertex3fSUN_byte" "glstub_glNormal3fVertex3fSUN_nat"
+  [@@noalloc]
 val glNormal3fVertex3fvSUN : float array -> float array -> unit
 val glNormal3fv : float array -> unit
-external glNormal3hNV : int -> int -> int -> unit = "glstub_glNormal3hNV"
-  "glstub_glNormal3hNV"
+external glNormal3hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormal3hNV" "glstub_glNormal3hNV_nat" [@@noalloc]
 val glNormal3hvNV : int array -> unit
-external glNormal3i : int -> int -> int -> unit = "glstub_glNormal3i"
-  "glstub_glNormal3i"
+external glNormal3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormal3i" "glstub_glNormal3i_nat" [@@noalloc]
 val glNormal3iv : int array -> unit
-external glNormal3s : int -> int -> int -> unit = "glstub_glNormal3s"
-  "glstub_glNormal3s"
+external glNormal3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormal3s" "glstub_glNormal3s_nat" [@@noalloc]
 val glNormal3sv : int array -> unit
 external glNormalPointer : int -> int -> 'a -> unit
   = "glstub_glNormalPointer" "glstub_glNormalPointer"
@@ -4422,95 +5271,127 @@ external glNormalPointerListIBM : int -> int -> 'a -> int -> unit
   = "glstub_glNormalPointerListIBM" "glstub_glNormalPointerListIBM"
 external glNormalPointervINTEL : int -> 'a -> unit
   = "glstub_glNormalPointervINTEL" "glstub_glNormalPointervINTEL"
-external glNormalStream3bATI : int -> int -> int -> int -> unit
-  = "glstub_glNormalStream3bATI" "glstub_glNormalStream3bATI"
+external glNormalStream3bATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormalStream3bATI" "glstub_glNormalStream3bATI_nat" [@@noalloc]
 val glNormalStream3bvATI : int -> int array -> unit
-external glNormalStream3dATI : int -> float -> float -> float -> unit
-  = "glstub_glNormalStream3dATI" "glstub_glNormalStream3dATI"
+external glNormalStream3dATI :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glNormalStream3dATI" "glstub_glNormalStream3dATI_nat" [@@noalloc]
 external glNormalStream3dvATI : int -> float array -> unit
   = "glstub_glNormalStream3dvATI" "glstub_glNormalStream3dvATI"
-external glNormalStream3fATI : int -> float -> float -> float -> unit
-  = "glstub_glNormalStream3fATI" "glstub_glNormalStream3fATI"
+external glNormalStream3fATI :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glNormalStream3fATI" "glstub_glNormalStream3fATI_nat" [@@noalloc]
 val glNormalStream3fvATI : int -> float array -> unit
-external glNormalStream3iATI : int -> int -> int -> int -> unit
-  = "glstub_glNormalStream3iATI" "glstub_glNormalStream3iATI"
+external glNormalStream3iATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormalStream3iATI" "glstub_glNormalStream3iATI_nat" [@@noalloc]
 val glNormalStream3ivATI : int -> int array -> unit
-external glNormalStream3sATI : int -> int -> int -> int -> unit
-  = "glstub_glNormalStream3sATI" "glstub_glNormalStream3sATI"
+external glNormalStream3sATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glNormalStream3sATI" "glstub_glNormalStream3sATI_nat" [@@noalloc]
 val glNormalStream3svATI : int -> int array -> unit
-external glOrtho : float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glOrtho_byte" "glstub_glOrtho"
+external glOrtho :
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glOrtho_byte" "glstub_glOrtho_nat" [@@noalloc]
 external glOrthofOES :
-  float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glOrthofOES_byte" "glstub_glOrthofOES"
-external glPNTrianglesfATI : int -> float -> unit
-  = "glstub_glPNTrianglesfATI" "glstub_glPNTrianglesfATI"
-external glPNTrianglesiATI : int -> int -> unit = "glstub_glPNTrianglesiATI"
-  "glstub_glPNTrianglesiATI"
-external glPassTexCoordATI : int -> int -> int -> unit
-  = "glstub_glPassTexCoordATI" "glstub_glPassTexCoordATI"
-external glPassThrough : float -> unit = "glstub_glPassThrough"
-  "glstub_glPassThrough"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glOrthofOES_byte" "glstub_glOrthofOES_nat" [@@noalloc]
+external glPNTrianglesfATI : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPNTrianglesfATI" "glstub_glPNTrianglesfATI_nat" [@@noalloc]
+external glPNTrianglesiATI : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPNTrianglesiATI" "glstub_glPNTrianglesiATI_nat" [@@noalloc]
+external glPassTexCoordATI :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPassTexCoordATI" "glstub_glPassTexCoordATI_nat" [@@noalloc]
+external glPassThrough : (float [@unboxed]) -> unit = "glstub_glPassThrough"
+  "glstub_glPassThrough_nat" [@@noalloc]
 external glPixelDataRangeNV : int -> int -> 'a -> unit
   = "glstub_glPixelDataRangeNV" "glstub_glPixelDataRangeNV"
 val glPixelMapfv : int -> int -> float array -> unit
 val glPixelMapuiv : int -> int -> int array -> unit
 val glPixelMapusv : int -> int -> int array -> unit
-external glPixelStoref : int -> float -> unit = "glstub_glPixelStoref"
-  "glstub_glPixelStoref"
-external glPixelStorei : int -> int -> unit = "glstub_glPixelStorei"
-  "glstub_glPixelStorei"
-external glPixelTexGenSGIX : int -> unit = "glstub_glPixelTexGenSGIX"
-  "glstub_glPixelTexGenSGIX"
-external glPixelTransferf : int -> float -> unit = "glstub_glPixelTransferf"
-  "glstub_glPixelTransferf"
-external glPixelTransferi : int -> int -> unit = "glstub_glPixelTransferi"
-  "glstub_glPixelTransferi"
-external glPixelTransformParameterfEXT : int -> int -> float -> unit
+external glPixelStoref : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPixelStoref" "glstub_glPixelStoref_nat" [@@noalloc]
+external glPixelStorei : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPixelStorei" "glstub_glPixelStorei_nat" [@@noalloc]
+external glPixelTexGenSGIX : (int [@untagged]) -> unit
+  = "glstub_glPixelTexGenSGIX" "glstub_glPixelTexGenSGIX_nat" [@@noalloc]
+external glPixelTransferf : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPixelTransferf" "glstub_glPixelTransferf_nat" [@@noalloc]
+external glPixelTransferi : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPixelTransferi" "glstub_glPixelTransferi_nat" [@@noalloc]
+external glPixelTransformParameterfEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
   = "glstub_glPixelTransformParameterfEXT"
-  "glstub_glPixelTransformParameterfEXT"
+  "glstub_glPixelTransformParameterfEXT_nat" [@@noalloc]
 val glPixelTransformParameterfvEXT : int -> int -> float array -> unit
-external glPixelTransformParameteriEXT : int -> int -> int -> unit
+external glPixelTransformParameteriEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glPixelTransformParameteriEXT"
-  "glstub_glPixelTransformParameteriEXT"
+  "glstub_glPixelTransformParameteriEXT_nat" [@@noalloc]
 val glPixelTransformParameterivEXT : int -> int -> int array -> unit
-external glPixelZoom : float -> float -> unit = "glstub_glPixelZoom"
-  "glstub_glPixelZoom"
-external glPointParameterf : int -> float -> unit
-  = "glstub_glPointParameterf" "glstub_glPointParameterf"
-external glPointParameterfARB : int -> float -> unit
-  = "glstub_glPointParameterfARB" "glstub_glPointParameterfARB"
-external glPointParameterfEXT : int -> float -> unit
-  = "glstub_glPointParameterfEXT" "glstub_glPointParameterfEXT"
+external glPixelZoom : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glPixelZoom" "glstub_glPixelZoom_nat" [@@noalloc]
+external glPointParameterf : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPointParameterf" "glstub_glPointParameterf_nat" [@@noalloc]
+external glPointParameterfARB :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPointParameterfARB" "glstub_glPointParameterfARB_nat"
+  [@@noalloc]
+external glPointParameterfEXT :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glPointParameterfEXT" "glstub_glPointParameterfEXT_nat"
+  [@@noalloc]
 val glPointParameterfv : int -> float array -> unit
 val glPointParameterfvARB : int -> float array -> unit
 val glPointParameterfvEXT : int -> float array -> unit
-external glPointParameteriNV : int -> int -> unit
-  = "glstub_glPointParameteriNV" "glstub_glPointParameteriNV"
+external glPointParameteriNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPointParameteriNV" "glstub_glPointParameteriNV_nat" [@@noalloc]
 val glPointParameterivNV : int -> int array -> unit
-external glPointSize : float -> unit = "glstub_glPointSize"
-  "glstub_glPointSize"
+external glPointSize : (float [@unboxed]) -> unit = "glstub_glPointSize"
+  "glstub_glPointSize_nat" [@@noalloc]
 val glPollAsyncSGIX : int array -> int
-external glPolygonMode : int -> int -> unit = "glstub_glPolygonMode"
-  "glstub_glPolygonMode"
-external glPolygonOffset : float -> float -> unit = "glstub_glPolygonOffset"
-  "glstub_glPolygonOffset"
-external glPolygonOffsetEXT : float -> float -> unit
-  = "glstub_glPolygonOffsetEXT" "glstub_glPolygonOffsetEXT"
+external glPolygonMode : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glPolygonMode" "glstub_glPolygonMode_nat" [@@noalloc]
+external glPolygonOffset : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glPolygonOffset" "glstub_glPolygonOffset_nat" [@@noalloc]
+external glPolygonOffsetEXT :
+  (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glPolygonOffsetEXT" "glstub_glPolygonOffsetEXT_nat" [@@noalloc]
 val glPolygonStipple : int array -> unit
 external glPopAttrib : unit -> unit = "glstub_glPopAttrib"
-  "glstub_glPopAttrib"
+  "glstub_glPopAttrib_nat" [@@noalloc]
 external glPopClientAttrib : unit -> unit = "glstub_glPopClientAttrib"
-  "glstub_glPopClientAttrib"
+  "glstub_glPopClientAttrib_nat" [@@noalloc]
 external glPopMatrix : unit -> unit = "glstub_glPopMatrix"
-  "glstub_glPopMatrix"
-external glPopName : unit -> unit = "glstub_glPopName" "glstub_glPopName"
-external glPrimitiveRestartIndexNV : int -> unit
-  = "glstub_glPrimitiveRestartIndexNV" "glstub_glPrimitiveRestartIndexNV"
+  "glstub_glPopMatrix_nat" [@@noalloc]
+external glPopName : unit -> unit = "glstub_glPopName" "glstub_glPopName_nat"
+  [@@noalloc]
+external glPrimitiveRestartIndex : (int [@untagged]) -> unit
+  = "glstub_glPrimitiveRestartIndex" "glstub_glPrimitiveRestartIndex_nat"
+  [@@noalloc]
+external glPrimitiveRestartIndexNV : (int [@untagged]) -> unit
+  = "glstub_glPrimitiveRestartIndexNV" "glstub_glPrimitiveRestartIndexNV_nat"
+  [@@noalloc]
 external glPrimitiveRestartNV : unit -> unit = "glstub_glPrimitiveRestartNV"
-  "glstub_glPrimitiveRestartNV"
+  "glstub_glPrimitiveRestartNV_nat" [@@noalloc]
 val glPrioritizeTextures : int -> int array -> float array -> unit
 val glPrioritizeTexturesEXT : int -> int array -> float array -> unit
+external glProgramBinary : int -> int -> 'a -> int -> unit
+  = "glstub_glProgramBinary" "glstub_glProgramBinary"
 val glProgramBufferParametersIivNV :
   int -> int -> int -> int -> int array -> unit
 val glProgramBufferParametersIuivNV :
@@ -4518,50 +5399,74 @@ val glProgramBufferParametersIuivNV :
 val glProgramBufferParametersfvNV :
   int -> int -> int -> int -> float array -> unit
 external glProgramEnvParameter4dARB :
-  int -> int -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glProgramEnvParameter4dARB_byte"
-  "glstub_glProgramEnvParameter4dARB"
+  "glstub_glProgramEnvParameter4dARB_nat" [@@noalloc]
 external glProgramEnvParameter4dvARB : int -> int -> float array -> unit
   = "glstub_glProgramEnvParameter4dvARB" "glstub_glProgramEnvParameter4dvARB"
 external glProgramEnvParameter4fARB :
-  int -> int -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glProgramEnvParameter4fARB_byte"
-  "glstub_glProgramEnvParameter4fARB"
+  "glstub_glProgramEnvParameter4fARB_nat" [@@noalloc]
 val glProgramEnvParameter4fvARB : int -> int -> float array -> unit
 external glProgramEnvParameterI4iNV :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glProgramEnvParameterI4iNV_byte"
-  "glstub_glProgramEnvParameterI4iNV"
+  "glstub_glProgramEnvParameterI4iNV_nat" [@@noalloc]
 val glProgramEnvParameterI4ivNV : int -> int -> int array -> unit
 external glProgramEnvParameterI4uiNV :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glProgramEnvParameterI4uiNV_byte"
-  "glstub_glProgramEnvParameterI4uiNV"
+  "glstub_glProgramEnvParameterI4uiNV_nat" [@@noalloc]
 val glProgramEnvParameterI4uivNV : int -> int -> int array -> unit
 val glProgramEnvParameters4fvEXT : int -> int -> int -> float array -> unit
 val glProgramEnvParametersI4ivNV : int -> int -> int -> int array -> unit
 val glProgramEnvParametersI4uivNV : int -> int -> int -> int array -> unit
 external glProgramLocalParameter4dARB :
-  int -> int -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glProgramLocalParameter4dARB_byte"
-  "glstub_glProgramLocalParameter4dARB"
+  "glstub_glProgramLocalParameter4dARB_nat" [@@noalloc]
 external glProgramLocalParameter4dvARB : int -> int -> float array -> unit
   = "glstub_glProgramLocalParameter4dvARB"
   "glstub_glProgramLocalParameter4dvARB"
 external glProgramLocalParameter4fARB :
-  int -> int -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glProgramLocalParameter4fARB_byte"
-  "glstub_glProgramLocalParameter4fARB"
+  "glstub_glProgramLocalParameter4fARB_nat" [@@noalloc]
 val glProgramLocalParameter4fvARB : int -> int -> float array -> unit
 external glProgramLocalParameterI4iNV :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glProgramLocalParameterI4iNV_byte"
-  "glstub_glProgramLocalParameterI4iNV"
+  "glstub_glProgramLocalParameterI4iNV_nat" [@@noalloc]
 val glProgramLocalParameterI4ivNV : int -> int -> int array -> unit
 external glProgramLocalParameterI4uiNV :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glProgramLocalParameterI4uiNV_byte"
-  "glstub_glProgramLocalParameterI4uiNV"
+  "glstub_glProgramLocalParameterI4uiNV_nat" [@@noalloc]
 val glProgramLocalParameterI4uivNV : int -> int -> int array -> unit
 val glProgramLocalParameters4fvEXT : int -> int -> int -> float array -> unit
 val glProgramLocalParametersI4ivNV : int -> int -> int -> int array -> unit
@@ -4575,260 +5480,391 @@ val glProgramNamedParameter4fNV :
 val glProgramNamedParameter4fvNV :
   int -> int -> int array -> float array -> unit
 external glProgramParameter4dNV :
-  int -> int -> float -> float -> float -> float -> unit
-  = "glstub_glProgramParameter4dNV_byte" "glstub_glProgramParameter4dNV"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glProgramParameter4dNV_byte" "glstub_glProgramParameter4dNV_nat"
+  [@@noalloc]
 external glProgramParameter4dvNV : int -> int -> float array -> unit
   = "glstub_glProgramParameter4dvNV" "glstub_glProgramParameter4dvNV"
 external glProgramParameter4fNV :
-  int -> int -> float -> float -> float -> float -> unit
-  = "glstub_glProgramParameter4fNV_byte" "glstub_glProgramParameter4fNV"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glProgramParameter4fNV_byte" "glstub_glProgramParameter4fNV_nat"
+  [@@noalloc]
 val glProgramParameter4fvNV : int -> int -> float array -> unit
-external glProgramParameteriEXT : int -> int -> int -> unit
-  = "glstub_glProgramParameteriEXT" "glstub_glProgramParameteriEXT"
+external glProgramParameteri :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glProgramParameteri" "glstub_glProgramParameteri_nat" [@@noalloc]
+external glProgramParameteriEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glProgramParameteriEXT" "glstub_glProgramParameteriEXT_nat"
+  [@@noalloc]
 external glProgramParameters4dvNV : int -> int -> int -> float array -> unit
   = "glstub_glProgramParameters4dvNV" "glstub_glProgramParameters4dvNV"
 val glProgramParameters4fvNV : int -> int -> int -> float array -> unit
 external glProgramStringARB : int -> int -> int -> 'a -> unit
   = "glstub_glProgramStringARB" "glstub_glProgramStringARB"
-external glProgramVertexLimitNV : int -> int -> unit
-  = "glstub_glProgramVertexLimitNV" "glstub_glProgramVertexLimitNV"
-external glPushAttrib : int -> unit = "glstub_glPushAttrib"
-  "glstub_glPushAttrib"
-external glPushClientAttrib : int -> unit = "glstub_glPushClientAttrib"
-  "glstub_glPushClientAttrib"
+external glProgramVertexLimitNV :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glProgramVertexLimitNV" "glstub_glProgramVertexLimitNV_nat"
+  [@@noalloc]
+external glPushAttrib : (int [@untagged]) -> unit = "glstub_glPushAttrib"
+  "glstub_glPushAttrib_nat" [@@noalloc]
+external glPushClientAttrib : (int [@untagged]) -> unit
+  = "glstub_glPushClientAttrib" "glstub_glPushClientAttrib_nat" [@@noalloc]
 external glPushMatrix : unit -> unit = "glstub_glPushMatrix"
-  "glstub_glPushMatrix"
-external glPushName : int -> unit = "glstub_glPushName" "glstub_glPushName"
-external glRasterPos2d : float -> float -> unit = "glstub_glRasterPos2d"
-  "glstub_glRasterPos2d"
+  "glstub_glPushMatrix_nat" [@@noalloc]
+external glPushName : (int [@untagged]) -> unit = "glstub_glPushName"
+  "glstub_glPushName_nat" [@@noalloc]
+external glQueryCounter : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glQueryCounter" "glstub_glQueryCounter_nat" [@@noalloc]
+external glRasterPos2d : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos2d" "glstub_glRasterPos2d_nat" [@@noalloc]
 external glRasterPos2dv : float array -> unit = "glstub_glRasterPos2dv"
   "glstub_glRasterPos2dv"
-external glRasterPos2f : float -> float -> unit = "glstub_glRasterPos2f"
-  "glstub_glRasterPos2f"
+external glRasterPos2f : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos2f" "glstub_glRasterPos2f_nat" [@@noalloc]
 val glRasterPos2fv : float array -> unit
-external glRasterPos2i : int -> int -> unit = "glstub_glRasterPos2i"
-  "glstub_glRasterPos2i"
+external glRasterPos2i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos2i" "glstub_glRasterPos2i_nat" [@@noalloc]
 val glRasterPos2iv : int array -> unit
-external glRasterPos2s : int -> int -> unit = "glstub_glRasterPos2s"
-  "glstub_glRasterPos2s"
+external glRasterPos2s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos2s" "glstub_glRasterPos2s_nat" [@@noalloc]
 val glRasterPos2sv : int array -> unit
-external glRasterPos3d : float -> float -> float -> unit
-  = "glstub_glRasterPos3d" "glstub_glRasterPos3d"
+external glRasterPos3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos3d" "glstub_glRasterPos3d_nat" [@@noalloc]
 external glRasterPos3dv : float array -> unit = "glstub_glRasterPos3dv"
   "glstub_glRasterPos3dv"
-external glRasterPos3f : float -> float -> float -> unit
-  = "glstub_glRasterPos3f" "glstub_glRasterPos3f"
+external glRasterPos3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos3f" "glstub_glRasterPos3f_nat" [@@noalloc]
 val glRasterPos3fv : float array -> unit
-external glRasterPos3i : int -> int -> int -> unit = "glstub_glRasterPos3i"
-  "glstub_glRasterPos3i"
+external glRasterPos3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos3i" "glstub_glRasterPos3i_nat" [@@noalloc]
 val glRasterPos3iv : int array -> unit
-external glRasterPos3s : int -> int -> int -> unit = "glstub_glRasterPos3s"
-  "glstub_glRasterPos3s"
+external glRasterPos3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos3s" "glstub_glRasterPos3s_nat" [@@noalloc]
 val glRasterPos3sv : int array -> unit
-external glRasterPos4d : float -> float -> float -> float -> unit
-  = "glstub_glRasterPos4d" "glstub_glRasterPos4d"
+external glRasterPos4d :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos4d" "glstub_glRasterPos4d_nat" [@@noalloc]
 external glRasterPos4dv : float array -> unit = "glstub_glRasterPos4dv"
   "glstub_glRasterPos4dv"
-external glRasterPos4f : float -> float -> float -> float -> unit
-  = "glstub_glRasterPos4f" "glstub_glRasterPos4f"
+external glRasterPos4f :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRasterPos4f" "glstub_glRasterPos4f_nat" [@@noalloc]
 val glRasterPos4fv : float array -> unit
-external glRasterPos4i : int -> int -> int -> int -> unit
-  = "glstub_glRasterPos4i" "glstub_glRasterPos4i"
+external glRasterPos4i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos4i" "glstub_glRasterPos4i_nat" [@@noalloc]
 val glRasterPos4iv : int array -> unit
-external glRasterPos4s : int -> int -> int -> int -> unit
-  = "glstub_glRasterPos4s" "glstub_glRasterPos4s"
+external glRasterPos4s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRasterPos4s" "glstub_glRasterPos4s_nat" [@@noalloc]
 val glRasterPos4sv : int array -> unit
-external glReadBuffer : int -> unit = "glstub_glReadBuffer"
-  "glstub_glReadBuffer"
+external glReadBuffer : (int [@untagged]) -> unit = "glstub_glReadBuffer"
+  "glstub_glReadBuffer_nat" [@@noalloc]
 external glReadPixels : int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glReadPixels_byte" "glstub_glReadPixels"
 external glReadVideoPixelsSUN :
   int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glReadVideoPixelsSUN_byte" "glstub_glReadVideoPixelsSUN"
-external glRectd : float -> float -> float -> float -> unit
-  = "glstub_glRectd" "glstub_glRectd"
+external glRectd :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRectd" "glstub_glRectd_nat" [@@noalloc]
 external glRectdv : float array -> float array -> unit = "glstub_glRectdv"
   "glstub_glRectdv"
-external glRectf : float -> float -> float -> float -> unit
-  = "glstub_glRectf" "glstub_glRectf"
+external glRectf :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRectf" "glstub_glRectf_nat" [@@noalloc]
 val glRectfv : float array -> float array -> unit
-external glRecti : int -> int -> int -> int -> unit = "glstub_glRecti"
-  "glstub_glRecti"
+external glRecti :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRecti" "glstub_glRecti_nat" [@@noalloc]
 val glRectiv : int array -> int array -> unit
-external glRects : int -> int -> int -> int -> unit = "glstub_glRects"
-  "glstub_glRects"
+external glRects :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRects" "glstub_glRects_nat" [@@noalloc]
 val glRectsv : int array -> int array -> unit
 external glReferencePlaneSGIX : float array -> unit
   = "glstub_glReferencePlaneSGIX" "glstub_glReferencePlaneSGIX"
 external glRenderMode : int -> int = "glstub_glRenderMode"
-  "glstub_glRenderMode"
-external glRenderbufferStorageEXT : int -> int -> int -> int -> unit
-  = "glstub_glRenderbufferStorageEXT" "glstub_glRenderbufferStorageEXT"
+  "glstub_glRenderMode_nat" [@@noalloc] [@@untagged]
+external glRenderbufferStorage :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRenderbufferStorage" "glstub_glRenderbufferStorage_nat"
+  [@@noalloc]
+external glRenderbufferStorageEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRenderbufferStorageEXT" "glstub_glRenderbufferStorageEXT_nat"
+  [@@noalloc]
+external glRenderbufferStorageMultisample :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glRenderbufferStorageMultisample"
+  "glstub_glRenderbufferStorageMultisample_nat" [@@noalloc]
 external glRenderbufferStorageMultisampleCoverageNV :
-  int -> int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glRenderbufferStorageMultisampleCoverageNV_byte"
-  "glstub_glRenderbufferStorageMultisampleCoverageNV"
+  "glstub_glRenderbufferStorageMultisampleCoverageNV_nat" [@@noalloc]
 external glRenderbufferStorageMultisampleEXT :
-  int -> int -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glRenderbufferStorageMultisampleEXT"
-  "glstub_glRenderbufferStorageMultisampleEXT"
+  "glstub_glRenderbufferStorageMultisampleEXT_nat" [@@noalloc]
 external glReplacementCodePointerSUN : int -> int -> 'a -> unit
   = "glstub_glReplacementCodePointerSUN" "glstub_glReplacementCodePointerSUN"
-external glReplacementCodeubSUN : int -> unit
-  = "glstub_glReplacementCodeubSUN" "glstub_glReplacementCodeubSUN"
+external glReplacementCodeubSUN : (int [@untagged]) -> unit
+  = "glstub_glReplacementCodeubSUN" "glstub_glReplacementCodeubSUN_nat"
+  [@@noalloc]
 val glReplacementCodeubvSUN : int array -> unit
 external glReplacementCodeuiColor3fVertex3fSUN :
-  int -> float -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiColor3fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiColor3fVertex3fSUN"
+  "glstub_glReplacementCodeuiColor3fVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiColor3fVertex3fvSUN :
   int array -> float array -> float array -> unit
 external glReplacementCodeuiColor4fNormal3fVertex3fSUN :
-  int ->
-  float ->
-  float ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN"
+  "glstub_glReplacementCodeuiColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiColor4fNormal3fVertex3fvSUN :
   int array -> float array -> float array -> float array -> unit
 external glReplacementCodeuiColor4ubVertex3fSUN :
-  int -> int -> int -> int -> int -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiColor4ubVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiColor4ubVertex3fSUN"
+  "glstub_glReplacementCodeuiColor4ubVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiColor4ubVertex3fvSUN :
   int array -> int array -> float array -> unit
 external glReplacementCodeuiNormal3fVertex3fSUN :
-  int -> float -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiNormal3fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiNormal3fVertex3fSUN"
+  "glstub_glReplacementCodeuiNormal3fVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiNormal3fVertex3fvSUN :
   int array -> float array -> float array -> unit
-external glReplacementCodeuiSUN : int -> unit
-  = "glstub_glReplacementCodeuiSUN" "glstub_glReplacementCodeuiSUN"
+external glReplacementCodeuiSUN : (int [@untagged]) -> unit
+  = "glstub_glReplacementCodeuiSUN" "glstub_glReplacementCodeuiSUN_nat"
+  [@@noalloc]
 external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN :
-  int ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN"
+  "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_nat"
+  [@@noalloc]
 val glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN :
   int array ->
   float array -> float array -> float array -> float array -> unit
 external glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN :
-  int ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN"
+  "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN :
   int array -> float array -> float array -> float array -> unit
 external glReplacementCodeuiTexCoord2fVertex3fSUN :
-  int -> float -> float -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN_byte"
-  "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN"
+  "glstub_glReplacementCodeuiTexCoord2fVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiTexCoord2fVertex3fvSUN :
   int array -> float array -> float array -> unit
 external glReplacementCodeuiVertex3fSUN :
-  int -> float -> float -> float -> unit
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glReplacementCodeuiVertex3fSUN"
-  "glstub_glReplacementCodeuiVertex3fSUN"
+  "glstub_glReplacementCodeuiVertex3fSUN_nat" [@@noalloc]
 val glReplacementCodeuiVertex3fvSUN : int array -> float array -> unit
 val glReplacementCodeuivSUN : int array -> unit
-external glReplacementCodeusSUN : int -> unit
-  = "glstub_glReplacementCodeusSUN" "glstub_glReplacementCodeusSUN"
+external glReplacementCodeusSUN : (int [@untagged]) -> unit
+  = "glstub_glReplacementCodeusSUN" "glstub_glReplacementCodeusSUN_nat"
+  [@@noalloc]
 val glReplacementCodeusvSUN : int array -> unit
 val glRequestResidentProgramsNV : int -> int array -> unit
-external glResetHistogram : int -> unit = "glstub_glResetHistogram"
-  "glstub_glResetHistogram"
-external glResetHistogramEXT : int -> unit = "glstub_glResetHistogramEXT"
-  "glstub_glResetHistogramEXT"
-external glResetMinmax : int -> unit = "glstub_glResetMinmax"
-  "glstub_glResetMinmax"
-external glResetMinmaxEXT : int -> unit = "glstub_glResetMinmaxEXT"
-  "glstub_glResetMinmaxEXT"
+external glResetHistogram : (int [@untagged]) -> unit
+  = "glstub_glResetHistogram" "glstub_glResetHistogram_nat" [@@noalloc]
+external glResetHistogramEXT : (int [@untagged]) -> unit
+  = "glstub_glResetHistogramEXT" "glstub_glResetHistogramEXT_nat" [@@noalloc]
+external glResetMinmax : (int [@untagged]) -> unit = "glstub_glResetMinmax"
+  "glstub_glResetMinmax_nat" [@@noalloc]
+external glResetMinmaxEXT : (int [@untagged]) -> unit
+  = "glstub_glResetMinmaxEXT" "glstub_glResetMinmaxEXT_nat" [@@noalloc]
 external glResizeBuffersMESA : unit -> unit = "glstub_glResizeBuffersMESA"
-  "glstub_glResizeBuffersMESA"
-external glRotated : float -> float -> float -> float -> unit
-  = "glstub_glRotated" "glstub_glRotated"
-external glRotatef : float -> float -> float -> float -> unit
-  = "glstub_glRotatef" "glstub_glRotatef"
-external glSampleCoverage : float -> bool -> unit = "glstub_glSampleCoverage"
-  "glstub_glSampleCoverage"
-external glSampleCoverageARB : float -> bool -> unit
-  = "glstub_glSampleCoverageARB" "glstub_glSampleCoverageARB"
-external glSampleMapATI : int -> int -> int -> unit = "glstub_glSampleMapATI"
-  "glstub_glSampleMapATI"
-external glSampleMaskEXT : float -> bool -> unit = "glstub_glSampleMaskEXT"
-  "glstub_glSampleMaskEXT"
-external glSampleMaskSGIS : float -> bool -> unit = "glstub_glSampleMaskSGIS"
-  "glstub_glSampleMaskSGIS"
-external glSamplePatternEXT : int -> unit = "glstub_glSamplePatternEXT"
-  "glstub_glSamplePatternEXT"
-external glSamplePatternSGIS : int -> unit = "glstub_glSamplePatternSGIS"
-  "glstub_glSamplePatternSGIS"
-external glScaled : float -> float -> float -> unit = "glstub_glScaled"
-  "glstub_glScaled"
-external glScalef : float -> float -> float -> unit = "glstub_glScalef"
-  "glstub_glScalef"
-external glScissor : int -> int -> int -> int -> unit = "glstub_glScissor"
-  "glstub_glScissor"
-external glSecondaryColor3b : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3b" "glstub_glSecondaryColor3b"
-external glSecondaryColor3bEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3bEXT" "glstub_glSecondaryColor3bEXT"
+  "glstub_glResizeBuffersMESA_nat" [@@noalloc]
+external glRotated :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRotated" "glstub_glRotated_nat" [@@noalloc]
+external glRotatef :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glRotatef" "glstub_glRotatef_nat" [@@noalloc]
+external glSampleCoverage : (float [@unboxed]) -> bool -> unit
+  = "glstub_glSampleCoverage" "glstub_glSampleCoverage_nat" [@@noalloc]
+external glSampleCoverageARB : (float [@unboxed]) -> bool -> unit
+  = "glstub_glSampleCoverageARB" "glstub_glSampleCoverageARB_nat" [@@noalloc]
+external glSampleMapATI :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSampleMapATI" "glstub_glSampleMapATI_nat" [@@noalloc]
+external glSampleMaskEXT : (float [@unboxed]) -> bool -> unit
+  = "glstub_glSampleMaskEXT" "glstub_glSampleMaskEXT_nat" [@@noalloc]
+external glSampleMaskSGIS : (float [@unboxed]) -> bool -> unit
+  = "glstub_glSampleMaskSGIS" "glstub_glSampleMaskSGIS_nat" [@@noalloc]
+external glSamplePatternEXT : (int [@untagged]) -> unit
+  = "glstub_glSamplePatternEXT" "glstub_glSamplePatternEXT_nat" [@@noalloc]
+external glSamplePatternSGIS : (int [@untagged]) -> unit
+  = "glstub_glSamplePatternSGIS" "glstub_glSamplePatternSGIS_nat" [@@noalloc]
+external glSamplerParameterf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glSamplerParameterf" "glstub_glSamplerParameterf_nat" [@@noalloc]
+external glSamplerParameteri :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSamplerParameteri" "glstub_glSamplerParameteri_nat" [@@noalloc]
+external glScaled :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glScaled" "glstub_glScaled_nat" [@@noalloc]
+external glScalef :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glScalef" "glstub_glScalef_nat" [@@noalloc]
+external glScissor :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glScissor" "glstub_glScissor_nat" [@@noalloc]
+external glSecondaryColor3b :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3b" "glstub_glSecondaryColor3b_nat" [@@noalloc]
+external glSecondaryColor3bEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3bEXT" "glstub_glSecondaryColor3bEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3bv : int array -> unit
 val glSecondaryColor3bvEXT : int array -> unit
-external glSecondaryColor3d : float -> float -> float -> unit
-  = "glstub_glSecondaryColor3d" "glstub_glSecondaryColor3d"
-external glSecondaryColor3dEXT : float -> float -> float -> unit
-  = "glstub_glSecondaryColor3dEXT" "glstub_glSecondaryColor3dEXT"
+external glSecondaryColor3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glSecondaryColor3d" "glstub_glSecondaryColor3d_nat" [@@noalloc]
+external glSecondaryColor3dEXT :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glSecondaryColor3dEXT" "glstub_glSecondaryColor3dEXT_nat"
+  [@@noalloc]
 external glSecondaryColor3dv : float array -> unit
   = "glstub_glSecondaryColor3dv" "glstub_glSecondaryColor3dv"
 external glSecondaryColor3dvEXT : float array -> unit
   = "glstub_glSecondaryColor3dvEXT" "glstub_glSecondaryColor3dvEXT"
-external glSecondaryColor3f : float -> float -> float -> unit
-  = "glstub_glSecondaryColor3f" "glstub_glSecondaryColor3f"
-external glSecondaryColor3fEXT : float -> float -> float -> unit
-  = "glstub_glSecondaryColor3fEXT" "glstub_glSecondaryColor3fEXT"
+external glSecondaryColor3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glSecondaryColor3f" "glstub_glSecondaryColor3f_nat" [@@noalloc]
+external glSecondaryColor3fEXT :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glSecondaryColor3fEXT" "glstub_glSecondaryColor3fEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3fv : float array -> unit
 val glSecondaryColor3fvEXT : float array -> unit
-external glSecondaryColor3hNV : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3hNV" "glstub_glSecondaryColor3hNV"
+external glSecondaryColor3hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3hNV" "glstub_glSecondaryColor3hNV_nat"
+  [@@noalloc]
 val glSecondaryColor3hvNV : int array -> unit
-external glSecondaryColor3i : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3i" "glstub_glSecondaryColor3i"
-external glSecondaryColor3iEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3iEXT" "glstub_glSecondaryColor3iEXT"
+external glSecondaryColor3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3i" "glstub_glSecondaryColor3i_nat" [@@noalloc]
+external glSecondaryColor3iEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3iEXT" "glstub_glSecondaryColor3iEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3iv : int array -> unit
 val glSecondaryColor3ivEXT : int array -> unit
-external glSecondaryColor3s : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3s" "glstub_glSecondaryColor3s"
-external glSecondaryColor3sEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3sEXT" "glstub_glSecondaryColor3sEXT"
+external glSecondaryColor3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3s" "glstub_glSecondaryColor3s_nat" [@@noalloc]
+external glSecondaryColor3sEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3sEXT" "glstub_glSecondaryColor3sEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3sv : int array -> unit
 val glSecondaryColor3svEXT : int array -> unit
-external glSecondaryColor3ub : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3ub" "glstub_glSecondaryColor3ub"
-external glSecondaryColor3ubEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3ubEXT" "glstub_glSecondaryColor3ubEXT"
+external glSecondaryColor3ub :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3ub" "glstub_glSecondaryColor3ub_nat" [@@noalloc]
+external glSecondaryColor3ubEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3ubEXT" "glstub_glSecondaryColor3ubEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3ubv : int array -> unit
 val glSecondaryColor3ubvEXT : int array -> unit
-external glSecondaryColor3ui : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3ui" "glstub_glSecondaryColor3ui"
-external glSecondaryColor3uiEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3uiEXT" "glstub_glSecondaryColor3uiEXT"
+external glSecondaryColor3ui :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3ui" "glstub_glSecondaryColor3ui_nat" [@@noalloc]
+external glSecondaryColor3uiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3uiEXT" "glstub_glSecondaryColor3uiEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3uiv : int array -> unit
 val glSecondaryColor3uivEXT : int array -> unit
-external glSecondaryColor3us : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3us" "glstub_glSecondaryColor3us"
-external glSecondaryColor3usEXT : int -> int -> int -> unit
-  = "glstub_glSecondaryColor3usEXT" "glstub_glSecondaryColor3usEXT"
+external glSecondaryColor3us :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3us" "glstub_glSecondaryColor3us_nat" [@@noalloc]
+external glSecondaryColor3usEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSecondaryColor3usEXT" "glstub_glSecondaryColor3usEXT_nat"
+  [@@noalloc]
 val glSecondaryColor3usv : int array -> unit
 val glSecondaryColor3usvEXT : int array -> unit
 external glSecondaryColorPointer : int -> int -> int -> 'a -> unit
@@ -4846,186 +5882,264 @@ external glSeparableFilter2D :
 external glSeparableFilter2DEXT :
   int -> int -> int -> int -> int -> int -> 'a -> 'a -> unit
   = "glstub_glSeparableFilter2DEXT_byte" "glstub_glSeparableFilter2DEXT"
-external glSetFenceAPPLE : int -> unit = "glstub_glSetFenceAPPLE"
-  "glstub_glSetFenceAPPLE"
-external glSetFenceNV : int -> int -> unit = "glstub_glSetFenceNV"
-  "glstub_glSetFenceNV"
+external glSetFenceAPPLE : (int [@untagged]) -> unit
+  = "glstub_glSetFenceAPPLE" "glstub_glSetFenceAPPLE_nat" [@@noalloc]
+external glSetFenceNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSetFenceNV" "glstub_glSetFenceNV_nat" [@@noalloc]
 val glSetFragmentShaderConstantATI : int -> float array -> unit
 external glSetInvariantEXT : int -> int -> 'a -> unit
   = "glstub_glSetInvariantEXT" "glstub_glSetInvariantEXT"
 external glSetLocalConstantEXT : int -> int -> 'a -> unit
   = "glstub_glSetLocalConstantEXT" "glstub_glSetLocalConstantEXT"
-external glShadeModel : int -> unit = "glstub_glShadeModel"
-  "glstub_glShadeModel"
-external glShaderOp1EXT : int -> int -> int -> unit = "glstub_glShaderOp1EXT"
-  "glstub_glShaderOp1EXT"
-external glShaderOp2EXT : int -> int -> int -> int -> unit
-  = "glstub_glShaderOp2EXT" "glstub_glShaderOp2EXT"
-external glShaderOp3EXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glShaderOp3EXT" "glstub_glShaderOp3EXT"
+external glShadeModel : (int [@untagged]) -> unit = "glstub_glShadeModel"
+  "glstub_glShadeModel_nat" [@@noalloc]
+external glShaderOp1EXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glShaderOp1EXT" "glstub_glShaderOp1EXT_nat" [@@noalloc]
+external glShaderOp2EXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glShaderOp2EXT" "glstub_glShaderOp2EXT_nat" [@@noalloc]
+external glShaderOp3EXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glShaderOp3EXT" "glstub_glShaderOp3EXT_nat" [@@noalloc]
 val glShaderSource : int -> int -> string array -> int array -> unit
 val glShaderSourceARB : int -> int -> string array -> int array -> unit
 val glSharpenTexFuncSGIS : int -> int -> float array -> unit
-external glSpriteParameterfSGIX : int -> float -> unit
-  = "glstub_glSpriteParameterfSGIX" "glstub_glSpriteParameterfSGIX"
+external glSpriteParameterfSGIX :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glSpriteParameterfSGIX" "glstub_glSpriteParameterfSGIX_nat"
+  [@@noalloc]
 val glSpriteParameterfvSGIX : int -> float array -> unit
-external glSpriteParameteriSGIX : int -> int -> unit
-  = "glstub_glSpriteParameteriSGIX" "glstub_glSpriteParameteriSGIX"
+external glSpriteParameteriSGIX :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSpriteParameteriSGIX" "glstub_glSpriteParameteriSGIX_nat"
+  [@@noalloc]
 val glSpriteParameterivSGIX : int -> int array -> unit
-external glStencilFunc : int -> int -> int -> unit = "glstub_glStencilFunc"
-  "glstub_glStencilFunc"
-external glStencilFuncSeparate : int -> int -> int -> int -> unit
-  = "glstub_glStencilFuncSeparate" "glstub_glStencilFuncSeparate"
-external glStencilFuncSeparateATI : int -> int -> int -> int -> unit
-  = "glstub_glStencilFuncSeparateATI" "glstub_glStencilFuncSeparateATI"
-external glStencilMask : int -> unit = "glstub_glStencilMask"
-  "glstub_glStencilMask"
-external glStencilMaskSeparate : int -> int -> unit
-  = "glstub_glStencilMaskSeparate" "glstub_glStencilMaskSeparate"
-external glStencilOp : int -> int -> int -> unit = "glstub_glStencilOp"
-  "glstub_glStencilOp"
-external glStencilOpSeparate : int -> int -> int -> int -> unit
-  = "glstub_glStencilOpSeparate" "glstub_glStencilOpSeparate"
-external glStencilOpSeparateATI : int -> int -> int -> int -> unit
-  = "glstub_glStencilOpSeparateATI" "glstub_glStencilOpSeparateATI"
+external glStencilFunc :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilFunc" "glstub_glStencilFunc_nat" [@@noalloc]
+external glStencilFuncSeparate :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilFuncSeparate" "glstub_glStencilFuncSeparate_nat"
+  [@@noalloc]
+external glStencilFuncSeparateATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilFuncSeparateATI" "glstub_glStencilFuncSeparateATI_nat"
+  [@@noalloc]
+external glStencilMask : (int [@untagged]) -> unit = "glstub_glStencilMask"
+  "glstub_glStencilMask_nat" [@@noalloc]
+external glStencilMaskSeparate :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilMaskSeparate" "glstub_glStencilMaskSeparate_nat"
+  [@@noalloc]
+external glStencilOp :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilOp" "glstub_glStencilOp_nat" [@@noalloc]
+external glStencilOpSeparate :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilOpSeparate" "glstub_glStencilOpSeparate_nat" [@@noalloc]
+external glStencilOpSeparateATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glStencilOpSeparateATI" "glstub_glStencilOpSeparateATI_nat"
+  [@@noalloc]
 external glStringMarkerGREMEDY : int -> 'a -> unit
   = "glstub_glStringMarkerGREMEDY" "glstub_glStringMarkerGREMEDY"
-external glSwizzleEXT : int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glSwizzleEXT_byte" "glstub_glSwizzleEXT"
+external glSwizzleEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glSwizzleEXT_byte" "glstub_glSwizzleEXT_nat" [@@noalloc]
 external glTagSampleBufferSGIX : unit -> unit
-  = "glstub_glTagSampleBufferSGIX" "glstub_glTagSampleBufferSGIX"
+  = "glstub_glTagSampleBufferSGIX" "glstub_glTagSampleBufferSGIX_nat"
+  [@@noalloc]
 external glTangentPointerEXT : int -> int -> 'a -> unit
   = "glstub_glTangentPointerEXT" "glstub_glTangentPointerEXT"
-external glTbufferMask3DFX : int -> unit = "glstub_glTbufferMask3DFX"
-  "glstub_glTbufferMask3DFX"
-external glTestFenceAPPLE : int -> bool = "glstub_glTestFenceAPPLE"
-  "glstub_glTestFenceAPPLE"
-external glTestFenceNV : int -> bool = "glstub_glTestFenceNV"
-  "glstub_glTestFenceNV"
-external glTestObjectAPPLE : int -> int -> bool = "glstub_glTestObjectAPPLE"
-  "glstub_glTestObjectAPPLE"
-external glTexBufferEXT : int -> int -> int -> unit = "glstub_glTexBufferEXT"
-  "glstub_glTexBufferEXT"
+external glTbufferMask3DFX : (int [@untagged]) -> unit
+  = "glstub_glTbufferMask3DFX" "glstub_glTbufferMask3DFX_nat" [@@noalloc]
+external glTestFenceAPPLE : (int [@untagged]) -> bool
+  = "glstub_glTestFenceAPPLE" "glstub_glTestFenceAPPLE_nat" [@@noalloc]
+external glTestFenceNV : (int [@untagged]) -> bool = "glstub_glTestFenceNV"
+  "glstub_glTestFenceNV_nat" [@@noalloc]
+external glTestObjectAPPLE : (int [@untagged]) -> (int [@untagged]) -> bool
+  = "glstub_glTestObjectAPPLE" "glstub_glTestObjectAPPLE_nat" [@@noalloc]
+external glTexBuffer :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexBuffer" "glstub_glTexBuffer_nat" [@@noalloc]
+external glTexBufferEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexBufferEXT" "glstub_glTexBufferEXT_nat" [@@noalloc]
 val glTexBumpParameterfvATI : int -> float array -> unit
 val glTexBumpParameterivATI : int -> int array -> unit
-external glTexCoord1d : float -> unit = "glstub_glTexCoord1d"
-  "glstub_glTexCoord1d"
+external glTexCoord1d : (float [@unboxed]) -> unit = "glstub_glTexCoord1d"
+  "glstub_glTexCoord1d_nat" [@@noalloc]
 external glTexCoord1dv : float array -> unit = "glstub_glTexCoord1dv"
   "glstub_glTexCoord1dv"
-external glTexCoord1f : float -> unit = "glstub_glTexCoord1f"
-  "glstub_glTexCoord1f"
+external glTexCoord1f : (float [@unboxed]) -> unit = "glstub_glTexCoord1f"
+  "glstub_glTexCoord1f_nat" [@@noalloc]
 val glTexCoord1fv : float array -> unit
-external glTexCoord1hNV : int -> unit = "glstub_glTexCoord1hNV"
-  "glstub_glTexCoord1hNV"
+external glTexCoord1hNV : (int [@untagged]) -> unit = "glstub_glTexCoord1hNV"
+  "glstub_glTexCoord1hNV_nat" [@@noalloc]
 val glTexCoord1hvNV : int array -> unit
-external glTexCoord1i : int -> unit = "glstub_glTexCoord1i"
-  "glstub_glTexCoord1i"
+external glTexCoord1i : (int [@untagged]) -> unit = "glstub_glTexCoord1i"
+  "glstub_glTexCoord1i_nat" [@@noalloc]
 val glTexCoord1iv : int array -> unit
-external glTexCoord1s : int -> unit = "glstub_glTexCoord1s"
-  "glstub_glTexCoord1s"
+external glTexCoord1s : (int [@untagged]) -> unit = "glstub_glTexCoord1s"
+  "glstub_glTexCoord1s_nat" [@@noalloc]
 val glTexCoord1sv : int array -> unit
-external glTexCoord2d : float -> float -> unit = "glstub_glTexCoord2d"
-  "glstub_glTexCoord2d"
+external glTexCoord2d : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord2d" "glstub_glTexCoord2d_nat" [@@noalloc]
 external glTexCoord2dv : float array -> unit = "glstub_glTexCoord2dv"
   "glstub_glTexCoord2dv"
-external glTexCoord2f : float -> float -> unit = "glstub_glTexCoord2f"
-  "glstub_glTexCoord2f"
+external glTexCoord2f : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord2f" "glstub_glTexCoord2f_nat" [@@noalloc]
 external glTexCoord2fColor3fVertex3fSUN :
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glTexCoord2fColor3fVertex3fSUN_byte"
-  "glstub_glTexCoord2fColor3fVertex3fSUN"
+  "glstub_glTexCoord2fColor3fVertex3fSUN_nat" [@@noalloc]
 val glTexCoord2fColor3fVertex3fvSUN :
   float array -> float array -> float array -> unit
 external glTexCoord2fColor4fNormal3fVertex3fSUN :
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN_byte"
-  "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN"
+  "glstub_glTexCoord2fColor4fNormal3fVertex3fSUN_nat" [@@noalloc]
 val glTexCoord2fColor4fNormal3fVertex3fvSUN :
   float array -> float array -> float array -> float array -> unit
 external glTexCoord2fColor4ubVertex3fSUN :
-  float ->
-  float -> int -> int -> int -> int -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glTexCoord2fColor4ubVertex3fSUN_byte"
-  "glstub_glTexCoord2fColor4ubVertex3fSUN"
+  "glstub_glTexCoord2fColor4ubVertex3fSUN_nat" [@@noalloc]
 val glTexCoord2fColor4ubVertex3fvSUN :
   float array -> int array -> float array -> unit
 external glTexCoord2fNormal3fVertex3fSUN :
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glTexCoord2fNormal3fVertex3fSUN_byte"
-  "glstub_glTexCoord2fNormal3fVertex3fSUN"
+  "glstub_glTexCoord2fNormal3fVertex3fSUN_nat" [@@noalloc]
 val glTexCoord2fNormal3fVertex3fvSUN :
   float array -> float array -> float array -> unit
 external glTexCoord2fVertex3fSUN :
-  float -> float -> float -> float -> float -> unit
-  = "glstub_glTexCoord2fVertex3fSUN" "glstub_glTexCoord2fVertex3fSUN"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord2fVertex3fSUN" "glstub_glTexCoord2fVertex3fSUN_nat"
+  [@@noalloc]
 val glTexCoord2fVertex3fvSUN : float array -> float array -> unit
 val glTexCoord2fv : float array -> unit
-external glTexCoord2hNV : int -> int -> unit = "glstub_glTexCoord2hNV"
-  "glstub_glTexCoord2hNV"
+external glTexCoord2hNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord2hNV" "glstub_glTexCoord2hNV_nat" [@@noalloc]
 val glTexCoord2hvNV : int array -> unit
-external glTexCoord2i : int -> int -> unit = "glstub_glTexCoord2i"
-  "glstub_glTexCoord2i"
+external glTexCoord2i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord2i" "glstub_glTexCoord2i_nat" [@@noalloc]
 val glTexCoord2iv : int array -> unit
-external glTexCoord2s : int -> int -> unit = "glstub_glTexCoord2s"
-  "glstub_glTexCoord2s"
+external glTexCoord2s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord2s" "glstub_glTexCoord2s_nat" [@@noalloc]
 val glTexCoord2sv : int array -> unit
-external glTexCoord3d : float -> float -> float -> unit
-  = "glstub_glTexCoord3d" "glstub_glTexCoord3d"
+external glTexCoord3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord3d" "glstub_glTexCoord3d_nat" [@@noalloc]
 external glTexCoord3dv : float array -> unit = "glstub_glTexCoord3dv"
   "glstub_glTexCoord3dv"
-external glTexCoord3f : float -> float -> float -> unit
-  = "glstub_glTexCoord3f" "glstub_glTexCoord3f"
+external glTexCoord3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord3f" "glstub_glTexCoord3f_nat" [@@noalloc]
 val glTexCoord3fv : float array -> unit
-external glTexCoord3hNV : int -> int -> int -> unit = "glstub_glTexCoord3hNV"
-  "glstub_glTexCoord3hNV"
+external glTexCoord3hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord3hNV" "glstub_glTexCoord3hNV_nat" [@@noalloc]
 val glTexCoord3hvNV : int array -> unit
-external glTexCoord3i : int -> int -> int -> unit = "glstub_glTexCoord3i"
-  "glstub_glTexCoord3i"
+external glTexCoord3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord3i" "glstub_glTexCoord3i_nat" [@@noalloc]
 val glTexCoord3iv : int array -> unit
-external glTexCoord3s : int -> int -> int -> unit = "glstub_glTexCoord3s"
-  "glstub_glTexCoord3s"
+external glTexCoord3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord3s" "glstub_glTexCoord3s_nat" [@@noalloc]
 val glTexCoord3sv : int array -> unit
-external glTexCoord4d : float -> float -> float -> float -> unit
-  = "glstub_glTexCoord4d" "glstub_glTexCoord4d"
+external glTexCoord4d :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord4d" "glstub_glTexCoord4d_nat" [@@noalloc]
 external glTexCoord4dv : float array -> unit = "glstub_glTexCoord4dv"
   "glstub_glTexCoord4dv"
-external glTexCoord4f : float -> float -> float -> float -> unit
-  = "glstub_glTexCoord4f" "glstub_glTexCoord4f"
+external glTexCoord4f :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord4f" "glstub_glTexCoord4f_nat" [@@noalloc]
 external glTexCoord4fColor4fNormal3fVertex4fSUN :
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
   = "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN_byte"
-  "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN"
+  "glstub_glTexCoord4fColor4fNormal3fVertex4fSUN_nat" [@@noalloc]
 val glTexCoord4fColor4fNormal3fVertex4fvSUN :
   float array -> float array -> float array -> float array -> unit
 external glTexCoord4fVertex4fSUN :
-  float ->
-  float -> float -> float -> float -> float -> float -> float -> unit
-  = "glstub_glTexCoord4fVertex4fSUN_byte" "glstub_glTexCoord4fVertex4fSUN"
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexCoord4fVertex4fSUN_byte"
+  "glstub_glTexCoord4fVertex4fSUN_nat" [@@noalloc]
 val glTexCoord4fVertex4fvSUN : float array -> float array -> unit
 val glTexCoord4fv : float array -> unit
-external glTexCoord4hNV : int -> int -> int -> int -> unit
-  = "glstub_glTexCoord4hNV" "glstub_glTexCoord4hNV"
+external glTexCoord4hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord4hNV" "glstub_glTexCoord4hNV_nat" [@@noalloc]
 val glTexCoord4hvNV : int array -> unit
-external glTexCoord4i : int -> int -> int -> int -> unit
-  = "glstub_glTexCoord4i" "glstub_glTexCoord4i"
+external glTexCoord4i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord4i" "glstub_glTexCoord4i_nat" [@@noalloc]
 val glTexCoord4iv : int array -> unit
-external glTexCoord4s : int -> int -> int -> int -> unit
-  = "glstub_glTexCoord4s" "glstub_glTexCoord4s"
+external glTexCoord4s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexCoord4s" "glstub_glTexCoord4s_nat" [@@noalloc]
 val glTexCoord4sv : int array -> unit
 external glTexCoordPointer : int -> int -> int -> 'a -> unit
   = "glstub_glTexCoordPointer" "glstub_glTexCoordPointer"
@@ -5035,22 +6149,27 @@ external glTexCoordPointerListIBM : int -> int -> int -> 'a -> int -> unit
   = "glstub_glTexCoordPointerListIBM" "glstub_glTexCoordPointerListIBM"
 external glTexCoordPointervINTEL : int -> int -> 'a -> unit
   = "glstub_glTexCoordPointervINTEL" "glstub_glTexCoordPointervINTEL"
-external glTexEnvf : int -> int -> float -> unit = "glstub_glTexEnvf"
-  "glstub_glTexEnvf"
+external glTexEnvf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexEnvf" "glstub_glTexEnvf_nat" [@@noalloc]
 val glTexEnvfv : int -> int -> float array -> unit
-external glTexEnvi : int -> int -> int -> unit = "glstub_glTexEnvi"
-  "glstub_glTexEnvi"
+external glTexEnvi :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexEnvi" "glstub_glTexEnvi_nat" [@@noalloc]
 val glTexEnviv : int -> int -> int array -> unit
 val glTexFilterFuncSGIS : int -> int -> int -> float array -> unit
-external glTexGend : int -> int -> float -> unit = "glstub_glTexGend"
-  "glstub_glTexGend"
+external glTexGend :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexGend" "glstub_glTexGend_nat" [@@noalloc]
 external glTexGendv : int -> int -> float array -> unit = "glstub_glTexGendv"
   "glstub_glTexGendv"
-external glTexGenf : int -> int -> float -> unit = "glstub_glTexGenf"
-  "glstub_glTexGenf"
+external glTexGenf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexGenf" "glstub_glTexGenf_nat" [@@noalloc]
 val glTexGenfv : int -> int -> float array -> unit
-external glTexGeni : int -> int -> int -> unit = "glstub_glTexGeni"
-  "glstub_glTexGeni"
+external glTexGeni :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexGeni" "glstub_glTexGeni_nat" [@@noalloc]
 val glTexGeniv : int -> int -> int array -> unit
 external glTexImage1D :
   int -> int -> int -> int -> int -> int -> int -> 'a -> unit
@@ -5070,16 +6189,26 @@ external glTexImage4DSGIS :
   = "glstub_glTexImage4DSGIS_byte" "glstub_glTexImage4DSGIS"
 val glTexParameterIivEXT : int -> int -> int array -> unit
 val glTexParameterIuivEXT : int -> int -> int array -> unit
-external glTexParameterf : int -> int -> float -> unit
-  = "glstub_glTexParameterf" "glstub_glTexParameterf"
+external glTexParameterf :
+  (int [@untagged]) -> (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexParameterf" "glstub_glTexParameterf_nat" [@@noalloc]
 val glTexParameterfv : int -> int -> float array -> unit
-external glTexParameteri : int -> int -> int -> unit
-  = "glstub_glTexParameteri" "glstub_glTexParameteri"
+external glTexParameteri :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexParameteri" "glstub_glTexParameteri_nat" [@@noalloc]
 val glTexParameteriv : int -> int -> int array -> unit
-external glTexScissorFuncINTEL : int -> int -> int -> unit
-  = "glstub_glTexScissorFuncINTEL" "glstub_glTexScissorFuncINTEL"
-external glTexScissorINTEL : int -> float -> float -> unit
-  = "glstub_glTexScissorINTEL" "glstub_glTexScissorINTEL"
+external glTexScissorFuncINTEL :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexScissorFuncINTEL" "glstub_glTexScissorFuncINTEL_nat"
+  [@@noalloc]
+external glTexScissorINTEL :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTexScissorINTEL" "glstub_glTexScissorINTEL_nat" [@@noalloc]
+external glTexStorage2D :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTexStorage2D" "glstub_glTexStorage2D_nat" [@@noalloc]
 external glTexSubImage1D :
   int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glTexSubImage1D_byte" "glstub_glTexSubImage1D"
@@ -5106,86 +6235,127 @@ external glTexSubImage4DSGIS :
   int ->
   int -> int -> int -> int -> int -> int -> int -> int -> int -> 'a -> unit
   = "glstub_glTexSubImage4DSGIS_byte" "glstub_glTexSubImage4DSGIS"
-external glTextureFogSGIX : int -> unit = "glstub_glTextureFogSGIX"
-  "glstub_glTextureFogSGIX"
-external glTextureLightEXT : int -> unit = "glstub_glTextureLightEXT"
-  "glstub_glTextureLightEXT"
-external glTextureMaterialEXT : int -> int -> unit
-  = "glstub_glTextureMaterialEXT" "glstub_glTextureMaterialEXT"
-external glTextureNormalEXT : int -> unit = "glstub_glTextureNormalEXT"
-  "glstub_glTextureNormalEXT"
+external glTextureFogSGIX : (int [@untagged]) -> unit
+  = "glstub_glTextureFogSGIX" "glstub_glTextureFogSGIX_nat" [@@noalloc]
+external glTextureLightEXT : (int [@untagged]) -> unit
+  = "glstub_glTextureLightEXT" "glstub_glTextureLightEXT_nat" [@@noalloc]
+external glTextureMaterialEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTextureMaterialEXT" "glstub_glTextureMaterialEXT_nat"
+  [@@noalloc]
+external glTextureNormalEXT : (int [@untagged]) -> unit
+  = "glstub_glTextureNormalEXT" "glstub_glTextureNormalEXT_nat" [@@noalloc]
 external glTextureRangeAPPLE : int -> int -> 'a -> unit
   = "glstub_glTextureRangeAPPLE" "glstub_glTextureRangeAPPLE"
-external glTrackMatrixNV : int -> int -> int -> int -> unit
-  = "glstub_glTrackMatrixNV" "glstub_glTrackMatrixNV"
+external glTrackMatrixNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glTrackMatrixNV" "glstub_glTrackMatrixNV_nat" [@@noalloc]
 val glTransformFeedbackAttribsNV : int -> int array -> int -> unit
 val glTransformFeedbackVaryingsNV : int -> int -> int array -> int -> unit
-external glTranslated : float -> float -> float -> unit
-  = "glstub_glTranslated" "glstub_glTranslated"
-external glTranslatef : float -> float -> float -> unit
-  = "glstub_glTranslatef" "glstub_glTranslatef"
-external glUniform1f : int -> float -> unit = "glstub_glUniform1f"
-  "glstub_glUniform1f"
-external glUniform1fARB : int -> float -> unit = "glstub_glUniform1fARB"
-  "glstub_glUniform1fARB"
+external glTranslated :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTranslated" "glstub_glTranslated_nat" [@@noalloc]
+external glTranslatef :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glTranslatef" "glstub_glTranslatef_nat" [@@noalloc]
+external glUniform1f : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform1f" "glstub_glUniform1f_nat" [@@noalloc]
+external glUniform1fARB : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform1fARB" "glstub_glUniform1fARB_nat" [@@noalloc]
 val glUniform1fv : int -> int -> float array -> unit
 val glUniform1fvARB : int -> int -> float array -> unit
-external glUniform1i : int -> int -> unit = "glstub_glUniform1i"
-  "glstub_glUniform1i"
-external glUniform1iARB : int -> int -> unit = "glstub_glUniform1iARB"
-  "glstub_glUniform1iARB"
+external glUniform1i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform1i" "glstub_glUniform1i_nat" [@@noalloc]
+external glUniform1iARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform1iARB" "glstub_glUniform1iARB_nat" [@@noalloc]
 val glUniform1iv : int -> int -> int array -> unit
 val glUniform1ivARB : int -> int -> int array -> unit
-external glUniform1uiEXT : int -> int -> unit = "glstub_glUniform1uiEXT"
-  "glstub_glUniform1uiEXT"
+external glUniform1uiEXT : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform1uiEXT" "glstub_glUniform1uiEXT_nat" [@@noalloc]
 val glUniform1uivEXT : int -> int -> int array -> unit
-external glUniform2f : int -> float -> float -> unit = "glstub_glUniform2f"
-  "glstub_glUniform2f"
-external glUniform2fARB : int -> float -> float -> unit
-  = "glstub_glUniform2fARB" "glstub_glUniform2fARB"
+external glUniform2f :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform2f" "glstub_glUniform2f_nat" [@@noalloc]
+external glUniform2fARB :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform2fARB" "glstub_glUniform2fARB_nat" [@@noalloc]
 val glUniform2fv : int -> int -> float array -> unit
 val glUniform2fvARB : int -> int -> float array -> unit
-external glUniform2i : int -> int -> int -> unit = "glstub_glUniform2i"
-  "glstub_glUniform2i"
-external glUniform2iARB : int -> int -> int -> unit = "glstub_glUniform2iARB"
-  "glstub_glUniform2iARB"
+external glUniform2i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform2i" "glstub_glUniform2i_nat" [@@noalloc]
+external glUniform2iARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform2iARB" "glstub_glUniform2iARB_nat" [@@noalloc]
 val glUniform2iv : int -> int -> int array -> unit
 val glUniform2ivARB : int -> int -> int array -> unit
-external glUniform2uiEXT : int -> int -> int -> unit
-  = "glstub_glUniform2uiEXT" "glstub_glUniform2uiEXT"
+external glUniform2uiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform2uiEXT" "glstub_glUniform2uiEXT_nat" [@@noalloc]
 val glUniform2uivEXT : int -> int -> int array -> unit
-external glUniform3f : int -> float -> float -> float -> unit
-  = "glstub_glUniform3f" "glstub_glUniform3f"
-external glUniform3fARB : int -> float -> float -> float -> unit
-  = "glstub_glUniform3fARB" "glstub_glUniform3fARB"
+external glUniform3f :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform3f" "glstub_glUniform3f_nat" [@@noalloc]
+external glUniform3fARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform3fARB" "glstub_glUniform3fARB_nat" [@@noalloc]
 val glUniform3fv : int -> int -> float array -> unit
 val glUniform3fvARB : int -> int -> float array -> unit
-external glUniform3i : int -> int -> int -> int -> unit
-  = "glstub_glUniform3i" "glstub_glUniform3i"
-external glUniform3iARB : int -> int -> int -> int -> unit
-  = "glstub_glUniform3iARB" "glstub_glUniform3iARB"
+external glUniform3i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform3i" "glstub_glUniform3i_nat" [@@noalloc]
+external glUniform3iARB :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform3iARB" "glstub_glUniform3iARB_nat" [@@noalloc]
 val glUniform3iv : int -> int -> int array -> unit
 val glUniform3ivARB : int -> int -> int array -> unit
-external glUniform3uiEXT : int -> int -> int -> int -> unit
-  = "glstub_glUniform3uiEXT" "glstub_glUniform3uiEXT"
+external glUniform3uiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform3uiEXT" "glstub_glUniform3uiEXT_nat" [@@noalloc]
 val glUniform3uivEXT : int -> int -> int array -> unit
-external glUniform4f : int -> float -> float -> float -> float -> unit
-  = "glstub_glUniform4f" "glstub_glUniform4f"
-external glUniform4fARB : int -> float -> float -> float -> float -> unit
-  = "glstub_glUniform4fARB" "glstub_glUniform4fARB"
+external glUniform4f :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform4f" "glstub_glUniform4f_nat" [@@noalloc]
+external glUniform4fARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glUniform4fARB" "glstub_glUniform4fARB_nat" [@@noalloc]
 val glUniform4fv : int -> int -> float array -> unit
 val glUniform4fvARB : int -> int -> float array -> unit
-external glUniform4i : int -> int -> int -> int -> int -> unit
-  = "glstub_glUniform4i" "glstub_glUniform4i"
-external glUniform4iARB : int -> int -> int -> int -> int -> unit
-  = "glstub_glUniform4iARB" "glstub_glUniform4iARB"
+external glUniform4i :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform4i" "glstub_glUniform4i_nat" [@@noalloc]
+external glUniform4iARB :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform4iARB" "glstub_glUniform4iARB_nat" [@@noalloc]
 val glUniform4iv : int -> int -> int array -> unit
 val glUniform4ivARB : int -> int -> int array -> unit
-external glUniform4uiEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glUniform4uiEXT" "glstub_glUniform4uiEXT"
+external glUniform4uiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniform4uiEXT" "glstub_glUniform4uiEXT_nat" [@@noalloc]
 val glUniform4uivEXT : int -> int -> int array -> unit
-external glUniformBufferEXT : int -> int -> int -> unit
-  = "glstub_glUniformBufferEXT" "glstub_glUniformBufferEXT"
+external glUniformBlockBinding :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniformBlockBinding" "glstub_glUniformBlockBinding_nat"
+  [@@noalloc]
+external glUniformBufferEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glUniformBufferEXT" "glstub_glUniformBufferEXT_nat" [@@noalloc]
 val glUniformMatrix2fv : int -> int -> bool -> float array -> unit
 val glUniformMatrix2fvARB : int -> int -> bool -> float array -> unit
 val glUniformMatrix2x3fv : int -> int -> bool -> float array -> unit
@@ -5199,25 +6369,32 @@ val glUniformMatrix4fvARB : int -> int -> bool -> float array -> unit
 val glUniformMatrix4x2fv : int -> int -> bool -> float array -> unit
 val glUniformMatrix4x3fv : int -> int -> bool -> float array -> unit
 external glUnlockArraysEXT : unit -> unit = "glstub_glUnlockArraysEXT"
-  "glstub_glUnlockArraysEXT"
-external glUnmapBuffer : int -> bool = "glstub_glUnmapBuffer"
-  "glstub_glUnmapBuffer"
-external glUnmapBufferARB : int -> bool = "glstub_glUnmapBufferARB"
-  "glstub_glUnmapBufferARB"
-external glUnmapObjectBufferATI : int -> unit
-  = "glstub_glUnmapObjectBufferATI" "glstub_glUnmapObjectBufferATI"
+  "glstub_glUnlockArraysEXT_nat" [@@noalloc]
+external glUnmapBuffer : (int [@untagged]) -> bool = "glstub_glUnmapBuffer"
+  "glstub_glUnmapBuffer_nat" [@@noalloc]
+external glUnmapBufferARB : (int [@untagged]) -> bool
+  = "glstub_glUnmapBufferARB" "glstub_glUnmapBufferARB_nat" [@@noalloc]
+external glUnmapObjectBufferATI : (int [@untagged]) -> unit
+  = "glstub_glUnmapObjectBufferATI" "glstub_glUnmapObjectBufferATI_nat"
+  [@@noalloc]
 external glUpdateObjectBufferATI : int -> int -> int -> 'a -> int -> unit
   = "glstub_glUpdateObjectBufferATI" "glstub_glUpdateObjectBufferATI"
-external glUseProgram : int -> unit = "glstub_glUseProgram"
-  "glstub_glUseProgram"
-external glUseProgramObjectARB : int -> unit = "glstub_glUseProgramObjectARB"
-  "glstub_glUseProgramObjectARB"
-external glValidateProgram : int -> unit = "glstub_glValidateProgram"
-  "glstub_glValidateProgram"
-external glValidateProgramARB : int -> unit = "glstub_glValidateProgramARB"
-  "glstub_glValidateProgramARB"
-external glVariantArrayObjectATI : int -> int -> int -> int -> int -> unit
-  = "glstub_glVariantArrayObjectATI" "glstub_glVariantArrayObjectATI"
+external glUseProgram : (int [@untagged]) -> unit = "glstub_glUseProgram"
+  "glstub_glUseProgram_nat" [@@noalloc]
+external glUseProgramObjectARB : (int [@untagged]) -> unit
+  = "glstub_glUseProgramObjectARB" "glstub_glUseProgramObjectARB_nat"
+  [@@noalloc]
+external glValidateProgram : (int [@untagged]) -> unit
+  = "glstub_glValidateProgram" "glstub_glValidateProgram_nat" [@@noalloc]
+external glValidateProgramARB : (int [@untagged]) -> unit
+  = "glstub_glValidateProgramARB" "glstub_glValidateProgramARB_nat"
+  [@@noalloc]
+external glVariantArrayObjectATI :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVariantArrayObjectATI" "glstub_glVariantArrayObjectATI_nat"
+  [@@noalloc]
 external glVariantPointerEXT : int -> int -> int -> 'a -> unit
   = "glstub_glVariantPointerEXT" "glstub_glVariantPointerEXT"
 val glVariantbvEXT : int -> int array -> unit
@@ -5229,157 +6406,205 @@ val glVariantsvEXT : int -> int array -> unit
 val glVariantubvEXT : int -> int array -> unit
 val glVariantuivEXT : int -> int array -> unit
 val glVariantusvEXT : int -> int array -> unit
-external glVertex2d : float -> float -> unit = "glstub_glVertex2d"
-  "glstub_glVertex2d"
+external glVertex2d : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex2d" "glstub_glVertex2d_nat" [@@noalloc]
 external glVertex2dv : float array -> unit = "glstub_glVertex2dv"
   "glstub_glVertex2dv"
-external glVertex2f : float -> float -> unit = "glstub_glVertex2f"
-  "glstub_glVertex2f"
+external glVertex2f : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex2f" "glstub_glVertex2f_nat" [@@noalloc]
 val glVertex2fv : float array -> unit
-external glVertex2hNV : int -> int -> unit = "glstub_glVertex2hNV"
-  "glstub_glVertex2hNV"
+external glVertex2hNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex2hNV" "glstub_glVertex2hNV_nat" [@@noalloc]
 val glVertex2hvNV : int array -> unit
-external glVertex2i : int -> int -> unit = "glstub_glVertex2i"
-  "glstub_glVertex2i"
+external glVertex2i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex2i" "glstub_glVertex2i_nat" [@@noalloc]
 val glVertex2iv : int array -> unit
-external glVertex2s : int -> int -> unit = "glstub_glVertex2s"
-  "glstub_glVertex2s"
+external glVertex2s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex2s" "glstub_glVertex2s_nat" [@@noalloc]
 val glVertex2sv : int array -> unit
-external glVertex3d : float -> float -> float -> unit = "glstub_glVertex3d"
-  "glstub_glVertex3d"
+external glVertex3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex3d" "glstub_glVertex3d_nat" [@@noalloc]
 external glVertex3dv : float array -> unit = "glstub_glVertex3dv"
   "glstub_glVertex3dv"
-external glVertex3f : float -> float -> float -> unit = "glstub_glVertex3f"
-  "glstub_glVertex3f"
+external glVertex3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex3f" "glstub_glVertex3f_nat" [@@noalloc]
 val glVertex3fv : float array -> unit
-external glVertex3hNV : int -> int -> int -> unit = "glstub_glVertex3hNV"
-  "glstub_glVertex3hNV"
+external glVertex3hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex3hNV" "glstub_glVertex3hNV_nat" [@@noalloc]
 val glVertex3hvNV : int array -> unit
-external glVertex3i : int -> int -> int -> unit = "glstub_glVertex3i"
-  "glstub_glVertex3i"
+external glVertex3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex3i" "glstub_glVertex3i_nat" [@@noalloc]
 val glVertex3iv : int array -> unit
-external glVertex3s : int -> int -> int -> unit = "glstub_glVertex3s"
-  "glstub_glVertex3s"
+external glVertex3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex3s" "glstub_glVertex3s_nat" [@@noalloc]
 val glVertex3sv : int array -> unit
-external glVertex4d : float -> float -> float -> float -> unit
-  = "glstub_glVertex4d" "glstub_glVertex4d"
+external glVertex4d :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex4d" "glstub_glVertex4d_nat" [@@noalloc]
 external glVertex4dv : float array -> unit = "glstub_glVertex4dv"
   "glstub_glVertex4dv"
-external glVertex4f : float -> float -> float -> float -> unit
-  = "glstub_glVertex4f" "glstub_glVertex4f"
+external glVertex4f :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertex4f" "glstub_glVertex4f_nat" [@@noalloc]
 val glVertex4fv : float array -> unit
-external glVertex4hNV : int -> int -> int -> int -> unit
-  = "glstub_glVertex4hNV" "glstub_glVertex4hNV"
+external glVertex4hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex4hNV" "glstub_glVertex4hNV_nat" [@@noalloc]
 val glVertex4hvNV : int array -> unit
-external glVertex4i : int -> int -> int -> int -> unit = "glstub_glVertex4i"
-  "glstub_glVertex4i"
+external glVertex4i :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex4i" "glstub_glVertex4i_nat" [@@noalloc]
 val glVertex4iv : int array -> unit
-external glVertex4s : int -> int -> int -> int -> unit = "glstub_glVertex4s"
-  "glstub_glVertex4s"
+external glVertex4s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertex4s" "glstub_glVertex4s_nat" [@@noalloc]
 val glVertex4sv : int array -> unit
-external glVertexArrayParameteriAPPLE : int -> int -> unit
+external glVertexArrayParameteriAPPLE :
+  (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glVertexArrayParameteriAPPLE"
-  "glstub_glVertexArrayParameteriAPPLE"
+  "glstub_glVertexArrayParameteriAPPLE_nat" [@@noalloc]
 external glVertexArrayRangeAPPLE : int -> 'a -> unit
   = "glstub_glVertexArrayRangeAPPLE" "glstub_glVertexArrayRangeAPPLE"
 external glVertexArrayRangeNV : int -> 'a -> unit
   = "glstub_glVertexArrayRangeNV" "glstub_glVertexArrayRangeNV"
-external glVertexAttrib1d : int -> float -> unit = "glstub_glVertexAttrib1d"
-  "glstub_glVertexAttrib1d"
-external glVertexAttrib1dARB : int -> float -> unit
-  = "glstub_glVertexAttrib1dARB" "glstub_glVertexAttrib1dARB"
-external glVertexAttrib1dNV : int -> float -> unit
-  = "glstub_glVertexAttrib1dNV" "glstub_glVertexAttrib1dNV"
+external glVertexAttrib1d : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1d" "glstub_glVertexAttrib1d_nat" [@@noalloc]
+external glVertexAttrib1dARB :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1dARB" "glstub_glVertexAttrib1dARB_nat" [@@noalloc]
+external glVertexAttrib1dNV : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1dNV" "glstub_glVertexAttrib1dNV_nat" [@@noalloc]
 external glVertexAttrib1dv : int -> float array -> unit
   = "glstub_glVertexAttrib1dv" "glstub_glVertexAttrib1dv"
 external glVertexAttrib1dvARB : int -> float array -> unit
   = "glstub_glVertexAttrib1dvARB" "glstub_glVertexAttrib1dvARB"
 external glVertexAttrib1dvNV : int -> float array -> unit
   = "glstub_glVertexAttrib1dvNV" "glstub_glVertexAttrib1dvNV"
-external glVertexAttrib1f : int -> float -> unit = "glstub_glVertexAttrib1f"
-  "glstub_glVertexAttrib1f"
-external glVertexAttrib1fARB : int -> float -> unit
-  = "glstub_glVertexAttrib1fARB" "glstub_glVertexAttrib1fARB"
-external glVertexAttrib1fNV : int -> float -> unit
-  = "glstub_glVertexAttrib1fNV" "glstub_glVertexAttrib1fNV"
+external glVertexAttrib1f : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1f" "glstub_glVertexAttrib1f_nat" [@@noalloc]
+external glVertexAttrib1fARB :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1fARB" "glstub_glVertexAttrib1fARB_nat" [@@noalloc]
+external glVertexAttrib1fNV : (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib1fNV" "glstub_glVertexAttrib1fNV_nat" [@@noalloc]
 val glVertexAttrib1fv : int -> float array -> unit
 val glVertexAttrib1fvARB : int -> float array -> unit
 val glVertexAttrib1fvNV : int -> float array -> unit
-external glVertexAttrib1hNV : int -> int -> unit
-  = "glstub_glVertexAttrib1hNV" "glstub_glVertexAttrib1hNV"
+external glVertexAttrib1hNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib1hNV" "glstub_glVertexAttrib1hNV_nat" [@@noalloc]
 val glVertexAttrib1hvNV : int -> int array -> unit
-external glVertexAttrib1s : int -> int -> unit = "glstub_glVertexAttrib1s"
-  "glstub_glVertexAttrib1s"
-external glVertexAttrib1sARB : int -> int -> unit
-  = "glstub_glVertexAttrib1sARB" "glstub_glVertexAttrib1sARB"
-external glVertexAttrib1sNV : int -> int -> unit
-  = "glstub_glVertexAttrib1sNV" "glstub_glVertexAttrib1sNV"
+external glVertexAttrib1s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib1s" "glstub_glVertexAttrib1s_nat" [@@noalloc]
+external glVertexAttrib1sARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib1sARB" "glstub_glVertexAttrib1sARB_nat" [@@noalloc]
+external glVertexAttrib1sNV : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib1sNV" "glstub_glVertexAttrib1sNV_nat" [@@noalloc]
 val glVertexAttrib1sv : int -> int array -> unit
 val glVertexAttrib1svARB : int -> int array -> unit
 val glVertexAttrib1svNV : int -> int array -> unit
-external glVertexAttrib2d : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2d" "glstub_glVertexAttrib2d"
-external glVertexAttrib2dARB : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2dARB" "glstub_glVertexAttrib2dARB"
-external glVertexAttrib2dNV : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2dNV" "glstub_glVertexAttrib2dNV"
+external glVertexAttrib2d :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2d" "glstub_glVertexAttrib2d_nat" [@@noalloc]
+external glVertexAttrib2dARB :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2dARB" "glstub_glVertexAttrib2dARB_nat" [@@noalloc]
+external glVertexAttrib2dNV :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2dNV" "glstub_glVertexAttrib2dNV_nat" [@@noalloc]
 external glVertexAttrib2dv : int -> float array -> unit
   = "glstub_glVertexAttrib2dv" "glstub_glVertexAttrib2dv"
 external glVertexAttrib2dvARB : int -> float array -> unit
   = "glstub_glVertexAttrib2dvARB" "glstub_glVertexAttrib2dvARB"
 external glVertexAttrib2dvNV : int -> float array -> unit
   = "glstub_glVertexAttrib2dvNV" "glstub_glVertexAttrib2dvNV"
-external glVertexAttrib2f : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2f" "glstub_glVertexAttrib2f"
-external glVertexAttrib2fARB : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2fARB" "glstub_glVertexAttrib2fARB"
-external glVertexAttrib2fNV : int -> float -> float -> unit
-  = "glstub_glVertexAttrib2fNV" "glstub_glVertexAttrib2fNV"
+external glVertexAttrib2f :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2f" "glstub_glVertexAttrib2f_nat" [@@noalloc]
+external glVertexAttrib2fARB :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2fARB" "glstub_glVertexAttrib2fARB_nat" [@@noalloc]
+external glVertexAttrib2fNV :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib2fNV" "glstub_glVertexAttrib2fNV_nat" [@@noalloc]
 val glVertexAttrib2fv : int -> float array -> unit
 val glVertexAttrib2fvARB : int -> float array -> unit
 val glVertexAttrib2fvNV : int -> float array -> unit
-external glVertexAttrib2hNV : int -> int -> int -> unit
-  = "glstub_glVertexAttrib2hNV" "glstub_glVertexAttrib2hNV"
+external glVertexAttrib2hNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib2hNV" "glstub_glVertexAttrib2hNV_nat" [@@noalloc]
 val glVertexAttrib2hvNV : int -> int array -> unit
-external glVertexAttrib2s : int -> int -> int -> unit
-  = "glstub_glVertexAttrib2s" "glstub_glVertexAttrib2s"
-external glVertexAttrib2sARB : int -> int -> int -> unit
-  = "glstub_glVertexAttrib2sARB" "glstub_glVertexAttrib2sARB"
-external glVertexAttrib2sNV : int -> int -> int -> unit
-  = "glstub_glVertexAttrib2sNV" "glstub_glVertexAttrib2sNV"
+external glVertexAttrib2s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib2s" "glstub_glVertexAttrib2s_nat" [@@noalloc]
+external glVertexAttrib2sARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib2sARB" "glstub_glVertexAttrib2sARB_nat" [@@noalloc]
+external glVertexAttrib2sNV :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib2sNV" "glstub_glVertexAttrib2sNV_nat" [@@noalloc]
 val glVertexAttrib2sv : int -> int array -> unit
 val glVertexAttrib2svARB : int -> int array -> unit
 val glVertexAttrib2svNV : int -> int array -> unit
-external glVertexAttrib3d : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3d" "glstub_glVertexAttrib3d"
-external glVertexAttrib3dARB : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3dARB" "glstub_glVertexAttrib3dARB"
-external glVertexAttrib3dNV : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3dNV" "glstub_glVertexAttrib3dNV"
+external glVertexAttrib3d :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3d" "glstub_glVertexAttrib3d_nat" [@@noalloc]
+external glVertexAttrib3dARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3dARB" "glstub_glVertexAttrib3dARB_nat" [@@noalloc]
+external glVertexAttrib3dNV :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3dNV" "glstub_glVertexAttrib3dNV_nat" [@@noalloc]
 external glVertexAttrib3dv : int -> float array -> unit
   = "glstub_glVertexAttrib3dv" "glstub_glVertexAttrib3dv"
 external glVertexAttrib3dvARB : int -> float array -> unit
   = "glstub_glVertexAttrib3dvARB" "glstub_glVertexAttrib3dvARB"
 external glVertexAttrib3dvNV : int -> float array -> unit
   = "glstub_glVertexAttrib3dvNV" "glstub_glVertexAttrib3dvNV"
-external glVertexAttrib3f : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3f" "glstub_glVertexAttrib3f"
-external glVertexAttrib3fARB : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3fARB" "glstub_glVertexAttrib3fARB"
-external glVertexAttrib3fNV : int -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib3fNV" "glstub_glVertexAttrib3fNV"
+external glVertexAttrib3f :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3f" "glstub_glVertexAttrib3f_nat" [@@noalloc]
+external glVertexAttrib3fARB :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3fARB" "glstub_glVertexAttrib3fARB_nat" [@@noalloc]
+external glVertexAttrib3fNV :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib3fNV" "glstub_glVertexAttrib3fNV_nat" [@@noalloc]
 val glVertexAttrib3fv : int -> float array -> unit
 val glVertexAttrib3fvARB : int -> float array -> unit
 val glVertexAttrib3fvNV : int -> float array -> unit
-external glVertexAttrib3hNV : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib3hNV" "glstub_glVertexAttrib3hNV"
+external glVertexAttrib3hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib3hNV" "glstub_glVertexAttrib3hNV_nat" [@@noalloc]
 val glVertexAttrib3hvNV : int -> int array -> unit
-external glVertexAttrib3s : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib3s" "glstub_glVertexAttrib3s"
-external glVertexAttrib3sARB : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib3sARB" "glstub_glVertexAttrib3sARB"
-external glVertexAttrib3sNV : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib3sNV" "glstub_glVertexAttrib3sNV"
+external glVertexAttrib3s :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib3s" "glstub_glVertexAttrib3s_nat" [@@noalloc]
+external glVertexAttrib3sARB :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib3sARB" "glstub_glVertexAttrib3sARB_nat" [@@noalloc]
+external glVertexAttrib3sNV :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib3sNV" "glstub_glVertexAttrib3sNV_nat" [@@noalloc]
 val glVertexAttrib3sv : int -> int array -> unit
 val glVertexAttrib3svARB : int -> int array -> unit
 val glVertexAttrib3svNV : int -> int array -> unit
@@ -5389,10 +6614,17 @@ val glVertexAttrib4Niv : int -> int array -> unit
 val glVertexAttrib4NivARB : int -> int array -> unit
 val glVertexAttrib4Nsv : int -> int array -> unit
 val glVertexAttrib4NsvARB : int -> int array -> unit
-external glVertexAttrib4Nub : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4Nub" "glstub_glVertexAttrib4Nub"
-external glVertexAttrib4NubARB : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4NubARB" "glstub_glVertexAttrib4NubARB"
+external glVertexAttrib4Nub :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4Nub" "glstub_glVertexAttrib4Nub_nat" [@@noalloc]
+external glVertexAttrib4NubARB :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4NubARB" "glstub_glVertexAttrib4NubARB_nat"
+  [@@noalloc]
 val glVertexAttrib4Nubv : int -> int array -> unit
 val glVertexAttrib4NubvARB : int -> int array -> unit
 val glVertexAttrib4Nuiv : int -> int array -> unit
@@ -5401,45 +6633,76 @@ val glVertexAttrib4Nusv : int -> int array -> unit
 val glVertexAttrib4NusvARB : int -> int array -> unit
 val glVertexAttrib4bv : int -> int array -> unit
 val glVertexAttrib4bvARB : int -> int array -> unit
-external glVertexAttrib4d : int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4d" "glstub_glVertexAttrib4d"
+external glVertexAttrib4d :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4d" "glstub_glVertexAttrib4d_nat" [@@noalloc]
 external glVertexAttrib4dARB :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4dARB" "glstub_glVertexAttrib4dARB"
-external glVertexAttrib4dNV : int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4dNV" "glstub_glVertexAttrib4dNV"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4dARB" "glstub_glVertexAttrib4dARB_nat" [@@noalloc]
+external glVertexAttrib4dNV :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4dNV" "glstub_glVertexAttrib4dNV_nat" [@@noalloc]
 external glVertexAttrib4dv : int -> float array -> unit
   = "glstub_glVertexAttrib4dv" "glstub_glVertexAttrib4dv"
 external glVertexAttrib4dvARB : int -> float array -> unit
   = "glstub_glVertexAttrib4dvARB" "glstub_glVertexAttrib4dvARB"
 external glVertexAttrib4dvNV : int -> float array -> unit
   = "glstub_glVertexAttrib4dvNV" "glstub_glVertexAttrib4dvNV"
-external glVertexAttrib4f : int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4f" "glstub_glVertexAttrib4f"
+external glVertexAttrib4f :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4f" "glstub_glVertexAttrib4f_nat" [@@noalloc]
 external glVertexAttrib4fARB :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4fARB" "glstub_glVertexAttrib4fARB"
-external glVertexAttrib4fNV : int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexAttrib4fNV" "glstub_glVertexAttrib4fNV"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4fARB" "glstub_glVertexAttrib4fARB_nat" [@@noalloc]
+external glVertexAttrib4fNV :
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexAttrib4fNV" "glstub_glVertexAttrib4fNV_nat" [@@noalloc]
 val glVertexAttrib4fv : int -> float array -> unit
 val glVertexAttrib4fvARB : int -> float array -> unit
 val glVertexAttrib4fvNV : int -> float array -> unit
-external glVertexAttrib4hNV : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4hNV" "glstub_glVertexAttrib4hNV"
+external glVertexAttrib4hNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4hNV" "glstub_glVertexAttrib4hNV_nat" [@@noalloc]
 val glVertexAttrib4hvNV : int -> int array -> unit
 val glVertexAttrib4iv : int -> int array -> unit
 val glVertexAttrib4ivARB : int -> int array -> unit
-external glVertexAttrib4s : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4s" "glstub_glVertexAttrib4s"
-external glVertexAttrib4sARB : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4sARB" "glstub_glVertexAttrib4sARB"
-external glVertexAttrib4sNV : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4sNV" "glstub_glVertexAttrib4sNV"
+external glVertexAttrib4s :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4s" "glstub_glVertexAttrib4s_nat" [@@noalloc]
+external glVertexAttrib4sARB :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4sARB" "glstub_glVertexAttrib4sARB_nat" [@@noalloc]
+external glVertexAttrib4sNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4sNV" "glstub_glVertexAttrib4sNV_nat" [@@noalloc]
 val glVertexAttrib4sv : int -> int array -> unit
 val glVertexAttrib4svARB : int -> int array -> unit
 val glVertexAttrib4svNV : int -> int array -> unit
-external glVertexAttrib4ubNV : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttrib4ubNV" "glstub_glVertexAttrib4ubNV"
+external glVertexAttrib4ubNV :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttrib4ubNV" "glstub_glVertexAttrib4ubNV_nat" [@@noalloc]
 val glVertexAttrib4ubv : int -> int array -> unit
 val glVertexAttrib4ubvARB : int -> int array -> unit
 val glVertexAttrib4ubvNV : int -> int array -> unit
@@ -5448,42 +6711,80 @@ val glVertexAttrib4uivARB : int -> int array -> unit
 val glVertexAttrib4usv : int -> int array -> unit
 val glVertexAttrib4usvARB : int -> int array -> unit
 external glVertexAttribArrayObjectATI :
-  int -> int -> int -> bool -> int -> int -> int -> unit
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  bool -> (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
   = "glstub_glVertexAttribArrayObjectATI_byte"
-  "glstub_glVertexAttribArrayObjectATI"
-external glVertexAttribI1iEXT : int -> int -> unit
-  = "glstub_glVertexAttribI1iEXT" "glstub_glVertexAttribI1iEXT"
+  "glstub_glVertexAttribArrayObjectATI_nat" [@@noalloc]
+external glVertexAttribDivisor :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribDivisor" "glstub_glVertexAttribDivisor_nat"
+  [@@noalloc]
+external glVertexAttribI1iEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI1iEXT" "glstub_glVertexAttribI1iEXT_nat"
+  [@@noalloc]
 val glVertexAttribI1ivEXT : int -> int array -> unit
-external glVertexAttribI1uiEXT : int -> int -> unit
-  = "glstub_glVertexAttribI1uiEXT" "glstub_glVertexAttribI1uiEXT"
+external glVertexAttribI1uiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI1uiEXT" "glstub_glVertexAttribI1uiEXT_nat"
+  [@@noalloc]
 val glVertexAttribI1uivEXT : int -> int array -> unit
-external glVertexAttribI2iEXT : int -> int -> int -> unit
-  = "glstub_glVertexAttribI2iEXT" "glstub_glVertexAttribI2iEXT"
+external glVertexAttribI2iEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI2iEXT" "glstub_glVertexAttribI2iEXT_nat"
+  [@@noalloc]
 val glVertexAttribI2ivEXT : int -> int array -> unit
-external glVertexAttribI2uiEXT : int -> int -> int -> unit
-  = "glstub_glVertexAttribI2uiEXT" "glstub_glVertexAttribI2uiEXT"
+external glVertexAttribI2uiEXT :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI2uiEXT" "glstub_glVertexAttribI2uiEXT_nat"
+  [@@noalloc]
 val glVertexAttribI2uivEXT : int -> int array -> unit
-external glVertexAttribI3iEXT : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttribI3iEXT" "glstub_glVertexAttribI3iEXT"
+external glVertexAttribI3iEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI3iEXT" "glstub_glVertexAttribI3iEXT_nat"
+  [@@noalloc]
 val glVertexAttribI3ivEXT : int -> int array -> unit
-external glVertexAttribI3uiEXT : int -> int -> int -> int -> unit
-  = "glstub_glVertexAttribI3uiEXT" "glstub_glVertexAttribI3uiEXT"
+external glVertexAttribI3uiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI3uiEXT" "glstub_glVertexAttribI3uiEXT_nat"
+  [@@noalloc]
 val glVertexAttribI3uivEXT : int -> int array -> unit
 val glVertexAttribI4bvEXT : int -> int array -> unit
-external glVertexAttribI4iEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttribI4iEXT" "glstub_glVertexAttribI4iEXT"
+external glVertexAttribI4iEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI4iEXT" "glstub_glVertexAttribI4iEXT_nat"
+  [@@noalloc]
 val glVertexAttribI4ivEXT : int -> int array -> unit
 val glVertexAttribI4svEXT : int -> int array -> unit
 val glVertexAttribI4ubvEXT : int -> int array -> unit
-external glVertexAttribI4uiEXT : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexAttribI4uiEXT" "glstub_glVertexAttribI4uiEXT"
+external glVertexAttribI4uiEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribI4uiEXT" "glstub_glVertexAttribI4uiEXT_nat"
+  [@@noalloc]
 val glVertexAttribI4uivEXT : int -> int array -> unit
 val glVertexAttribI4usvEXT : int -> int array -> unit
+external glVertexAttribIPointer :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribIPointer" "glstub_glVertexAttribIPointer_nat"
+  [@@noalloc]
 external glVertexAttribIPointerEXT : int -> int -> int -> int -> 'a -> unit
   = "glstub_glVertexAttribIPointerEXT" "glstub_glVertexAttribIPointerEXT"
 external glVertexAttribPointer :
-  int -> int -> int -> bool -> int -> int -> unit
-  = "glstub_glVertexAttribPointer_byte" "glstub_glVertexAttribPointer"
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> bool -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexAttribPointer_byte" "glstub_glVertexAttribPointer_nat"
+  [@@noalloc]
 external glVertexAttribPointerARB :
   int -> int -> int -> bool -> int -> 'a -> unit
   = "glstub_glVertexAttribPointerARB_byte" "glstub_glVertexAttribPointerARB"
@@ -5510,12 +6811,16 @@ val glVertexAttribs4fvNV : int -> int -> float array -> unit
 val glVertexAttribs4hvNV : int -> int -> int array -> unit
 val glVertexAttribs4svNV : int -> int -> int array -> unit
 val glVertexAttribs4ubvNV : int -> int -> int array -> unit
-external glVertexBlendARB : int -> unit = "glstub_glVertexBlendARB"
-  "glstub_glVertexBlendARB"
-external glVertexBlendEnvfATI : int -> float -> unit
-  = "glstub_glVertexBlendEnvfATI" "glstub_glVertexBlendEnvfATI"
-external glVertexBlendEnviATI : int -> int -> unit
-  = "glstub_glVertexBlendEnviATI" "glstub_glVertexBlendEnviATI"
+external glVertexBlendARB : (int [@untagged]) -> unit
+  = "glstub_glVertexBlendARB" "glstub_glVertexBlendARB_nat" [@@noalloc]
+external glVertexBlendEnvfATI :
+  (int [@untagged]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexBlendEnvfATI" "glstub_glVertexBlendEnvfATI_nat"
+  [@@noalloc]
+external glVertexBlendEnviATI :
+  (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexBlendEnviATI" "glstub_glVertexBlendEnviATI_nat"
+  [@@noalloc]
 external glVertexPointer : int -> int -> int -> 'a -> unit
   = "glstub_glVertexPointer" "glstub_glVertexPointer"
 external glVertexPointerEXT : int -> int -> int -> int -> 'a -> unit
@@ -5524,57 +6829,83 @@ external glVertexPointerListIBM : int -> int -> int -> 'a -> int -> unit
   = "glstub_glVertexPointerListIBM" "glstub_glVertexPointerListIBM"
 external glVertexPointervINTEL : int -> int -> 'a -> unit
   = "glstub_glVertexPointervINTEL" "glstub_glVertexPointervINTEL"
-external glVertexStream2dATI : int -> float -> float -> unit
-  = "glstub_glVertexStream2dATI" "glstub_glVertexStream2dATI"
+external glVertexStream2dATI :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream2dATI" "glstub_glVertexStream2dATI_nat" [@@noalloc]
 external glVertexStream2dvATI : int -> float array -> unit
   = "glstub_glVertexStream2dvATI" "glstub_glVertexStream2dvATI"
-external glVertexStream2fATI : int -> float -> float -> unit
-  = "glstub_glVertexStream2fATI" "glstub_glVertexStream2fATI"
+external glVertexStream2fATI :
+  (int [@untagged]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream2fATI" "glstub_glVertexStream2fATI_nat" [@@noalloc]
 val glVertexStream2fvATI : int -> float array -> unit
-external glVertexStream2iATI : int -> int -> int -> unit
-  = "glstub_glVertexStream2iATI" "glstub_glVertexStream2iATI"
+external glVertexStream2iATI :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream2iATI" "glstub_glVertexStream2iATI_nat" [@@noalloc]
 val glVertexStream2ivATI : int -> int array -> unit
-external glVertexStream2sATI : int -> int -> int -> unit
-  = "glstub_glVertexStream2sATI" "glstub_glVertexStream2sATI"
+external glVertexStream2sATI :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream2sATI" "glstub_glVertexStream2sATI_nat" [@@noalloc]
 val glVertexStream2svATI : int -> int array -> unit
-external glVertexStream3dATI : int -> float -> float -> float -> unit
-  = "glstub_glVertexStream3dATI" "glstub_glVertexStream3dATI"
+external glVertexStream3dATI :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream3dATI" "glstub_glVertexStream3dATI_nat" [@@noalloc]
 external glVertexStream3dvATI : int -> float array -> unit
   = "glstub_glVertexStream3dvATI" "glstub_glVertexStream3dvATI"
-external glVertexStream3fATI : int -> float -> float -> float -> unit
-  = "glstub_glVertexStream3fATI" "glstub_glVertexStream3fATI"
+external glVertexStream3fATI :
+  (int [@untagged]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream3fATI" "glstub_glVertexStream3fATI_nat" [@@noalloc]
 val glVertexStream3fvATI : int -> float array -> unit
-external glVertexStream3iATI : int -> int -> int -> int -> unit
-  = "glstub_glVertexStream3iATI" "glstub_glVertexStream3iATI"
+external glVertexStream3iATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream3iATI" "glstub_glVertexStream3iATI_nat" [@@noalloc]
 val glVertexStream3ivATI : int -> int array -> unit
-external glVertexStream3sATI : int -> int -> int -> int -> unit
-  = "glstub_glVertexStream3sATI" "glstub_glVertexStream3sATI"
+external glVertexStream3sATI :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream3sATI" "glstub_glVertexStream3sATI_nat" [@@noalloc]
 val glVertexStream3svATI : int -> int array -> unit
 external glVertexStream4dATI :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexStream4dATI" "glstub_glVertexStream4dATI"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream4dATI" "glstub_glVertexStream4dATI_nat" [@@noalloc]
 external glVertexStream4dvATI : int -> float array -> unit
   = "glstub_glVertexStream4dvATI" "glstub_glVertexStream4dvATI"
 external glVertexStream4fATI :
-  int -> float -> float -> float -> float -> unit
-  = "glstub_glVertexStream4fATI" "glstub_glVertexStream4fATI"
+  (int [@untagged]) ->
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glVertexStream4fATI" "glstub_glVertexStream4fATI_nat" [@@noalloc]
 val glVertexStream4fvATI : int -> float array -> unit
-external glVertexStream4iATI : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexStream4iATI" "glstub_glVertexStream4iATI"
+external glVertexStream4iATI :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream4iATI" "glstub_glVertexStream4iATI_nat" [@@noalloc]
 val glVertexStream4ivATI : int -> int array -> unit
-external glVertexStream4sATI : int -> int -> int -> int -> int -> unit
-  = "glstub_glVertexStream4sATI" "glstub_glVertexStream4sATI"
+external glVertexStream4sATI :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glVertexStream4sATI" "glstub_glVertexStream4sATI_nat" [@@noalloc]
 val glVertexStream4svATI : int -> int array -> unit
 external glVertexWeightPointerEXT : int -> int -> int -> 'a -> unit
   = "glstub_glVertexWeightPointerEXT" "glstub_glVertexWeightPointerEXT"
-external glVertexWeightfEXT : float -> unit = "glstub_glVertexWeightfEXT"
-  "glstub_glVertexWeightfEXT"
+external glVertexWeightfEXT : (float [@unboxed]) -> unit
+  = "glstub_glVertexWeightfEXT" "glstub_glVertexWeightfEXT_nat" [@@noalloc]
 val glVertexWeightfvEXT : float array -> unit
-external glVertexWeighthNV : int -> unit = "glstub_glVertexWeighthNV"
-  "glstub_glVertexWeighthNV"
+external glVertexWeighthNV : (int [@untagged]) -> unit
+  = "glstub_glVertexWeighthNV" "glstub_glVertexWeighthNV_nat" [@@noalloc]
 val glVertexWeighthvNV : int array -> unit
-external glViewport : int -> int -> int -> int -> unit = "glstub_glViewport"
-  "glstub_glViewport"
+external glViewport :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glViewport" "glstub_glViewport_nat" [@@noalloc]
+external glWaitSync : sync -> int -> int -> unit = "glstub_glWaitSync"
+  "glstub_glWaitSync"
 external glWeightPointerARB : int -> int -> int -> 'a -> unit
   = "glstub_glWeightPointerARB" "glstub_glWeightPointerARB"
 val glWeightbvARB : int -> int array -> unit
@@ -5586,97 +6917,2936 @@ val glWeightsvARB : int -> int array -> unit
 val glWeightubvARB : int -> int array -> unit
 val glWeightuivARB : int -> int array -> unit
 val glWeightusvARB : int -> int array -> unit
-external glWindowPos2d : float -> float -> unit = "glstub_glWindowPos2d"
-  "glstub_glWindowPos2d"
-external glWindowPos2dARB : float -> float -> unit
-  = "glstub_glWindowPos2dARB" "glstub_glWindowPos2dARB"
-external glWindowPos2dMESA : float -> float -> unit
-  = "glstub_glWindowPos2dMESA" "glstub_glWindowPos2dMESA"
+external glWindowPos2d : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2d" "glstub_glWindowPos2d_nat" [@@noalloc]
+external glWindowPos2dARB : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2dARB" "glstub_glWindowPos2dARB_nat" [@@noalloc]
+external glWindowPos2dMESA : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2dMESA" "glstub_glWindowPos2dMESA_nat" [@@noalloc]
 external glWindowPos2dv : float array -> unit = "glstub_glWindowPos2dv"
   "glstub_glWindowPos2dv"
 external glWindowPos2dvARB : float array -> unit = "glstub_glWindowPos2dvARB"
   "glstub_glWindowPos2dvARB"
 external glWindowPos2dvMESA : float array -> unit
   = "glstub_glWindowPos2dvMESA" "glstub_glWindowPos2dvMESA"
-external glWindowPos2f : float -> float -> unit = "glstub_glWindowPos2f"
-  "glstub_glWindowPos2f"
-external glWindowPos2fARB : float -> float -> unit
-  = "glstub_glWindowPos2fARB" "glstub_glWindowPos2fARB"
-external glWindowPos2fMESA : float -> float -> unit
-  = "glstub_glWindowPos2fMESA" "glstub_glWindowPos2fMESA"
+external glWindowPos2f : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2f" "glstub_glWindowPos2f_nat" [@@noalloc]
+external glWindowPos2fARB : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2fARB" "glstub_glWindowPos2fARB_nat" [@@noalloc]
+external glWindowPos2fMESA : (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos2fMESA" "glstub_glWindowPos2fMESA_nat" [@@noalloc]
 val glWindowPos2fv : float array -> unit
 val glWindowPos2fvARB : float array -> unit
 val glWindowPos2fvMESA : float array -> unit
-external glWindowPos2i : int -> int -> unit = "glstub_glWindowPos2i"
-  "glstub_glWindowPos2i"
-external glWindowPos2iARB : int -> int -> unit = "glstub_glWindowPos2iARB"
-  "glstub_glWindowPos2iARB"
-external glWindowPos2iMESA : int -> int -> unit = "glstub_glWindowPos2iMESA"
-  "glstub_glWindowPos2iMESA"
+external glWindowPos2i : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2i" "glstub_glWindowPos2i_nat" [@@noalloc]
+external glWindowPos2iARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2iARB" "glstub_glWindowPos2iARB_nat" [@@noalloc]
+external glWindowPos2iMESA : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2iMESA" "glstub_glWindowPos2iMESA_nat" [@@noalloc]
 val glWindowPos2iv : int array -> unit
 val glWindowPos2ivARB : int array -> unit
 val glWindowPos2ivMESA : int array -> unit
-external glWindowPos2s : int -> int -> unit = "glstub_glWindowPos2s"
-  "glstub_glWindowPos2s"
-external glWindowPos2sARB : int -> int -> unit = "glstub_glWindowPos2sARB"
-  "glstub_glWindowPos2sARB"
-external glWindowPos2sMESA : int -> int -> unit = "glstub_glWindowPos2sMESA"
-  "glstub_glWindowPos2sMESA"
+external glWindowPos2s : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2s" "glstub_glWindowPos2s_nat" [@@noalloc]
+external glWindowPos2sARB : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2sARB" "glstub_glWindowPos2sARB_nat" [@@noalloc]
+external glWindowPos2sMESA : (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos2sMESA" "glstub_glWindowPos2sMESA_nat" [@@noalloc]
 val glWindowPos2sv : int array -> unit
 val glWindowPos2svARB : int array -> unit
 val glWindowPos2svMESA : int array -> unit
-external glWindowPos3d : float -> float -> float -> unit
-  = "glstub_glWindowPos3d" "glstub_glWindowPos3d"
-external glWindowPos3dARB : float -> float -> float -> unit
-  = "glstub_glWindowPos3dARB" "glstub_glWindowPos3dARB"
-external glWindowPos3dMESA : float -> float -> float -> unit
-  = "glstub_glWindowPos3dMESA" "glstub_glWindowPos3dMESA"
+external glWindowPos3d :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3d" "glstub_glWindowPos3d_nat" [@@noalloc]
+external glWindowPos3dARB :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3dARB" "glstub_glWindowPos3dARB_nat" [@@noalloc]
+external glWindowPos3dMESA :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3dMESA" "glstub_glWindowPos3dMESA_nat" [@@noalloc]
 external glWindowPos3dv : float array -> unit = "glstub_glWindowPos3dv"
   "glstub_glWindowPos3dv"
 external glWindowPos3dvARB : float array -> unit = "glstub_glWindowPos3dvARB"
   "glstub_glWindowPos3dvARB"
 external glWindowPos3dvMESA : float array -> unit
   = "glstub_glWindowPos3dvMESA" "glstub_glWindowPos3dvMESA"
-external glWindowPos3f : float -> float -> float -> unit
-  = "glstub_glWindowPos3f" "glstub_glWindowPos3f"
-external glWindowPos3fARB : float -> float -> float -> unit
-  = "glstub_glWindowPos3fARB" "glstub_glWindowPos3fARB"
-external glWindowPos3fMESA : float -> float -> float -> unit
-  = "glstub_glWindowPos3fMESA" "glstub_glWindowPos3fMESA"
+external glWindowPos3f :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3f" "glstub_glWindowPos3f_nat" [@@noalloc]
+external glWindowPos3fARB :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3fARB" "glstub_glWindowPos3fARB_nat" [@@noalloc]
+external glWindowPos3fMESA :
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos3fMESA" "glstub_glWindowPos3fMESA_nat" [@@noalloc]
 val glWindowPos3fv : float array -> unit
 val glWindowPos3fvARB : float array -> unit
 val glWindowPos3fvMESA : float array -> unit
-external glWindowPos3i : int -> int -> int -> unit = "glstub_glWindowPos3i"
-  "glstub_glWindowPos3i"
-external glWindowPos3iARB : int -> int -> int -> unit
-  = "glstub_glWindowPos3iARB" "glstub_glWindowPos3iARB"
-external glWindowPos3iMESA : int -> int -> int -> unit
-  = "glstub_glWindowPos3iMESA" "glstub_glWindowPos3iMESA"
+external glWindowPos3i :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3i" "glstub_glWindowPos3i_nat" [@@noalloc]
+external glWindowPos3iARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3iARB" "glstub_glWindowPos3iARB_nat" [@@noalloc]
+external glWindowPos3iMESA :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3iMESA" "glstub_glWindowPos3iMESA_nat" [@@noalloc]
 val glWindowPos3iv : int array -> unit
 val glWindowPos3ivARB : int array -> unit
 val glWindowPos3ivMESA : int array -> unit
-external glWindowPos3s : int -> int -> int -> unit = "glstub_glWindowPos3s"
-  "glstub_glWindowPos3s"
-external glWindowPos3sARB : int -> int -> int -> unit
-  = "glstub_glWindowPos3sARB" "glstub_glWindowPos3sARB"
-external glWindowPos3sMESA : int -> int -> int -> unit
-  = "glstub_glWindowPos3sMESA" "glstub_glWindowPos3sMESA"
+external glWindowPos3s :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3s" "glstub_glWindowPos3s_nat" [@@noalloc]
+external glWindowPos3sARB :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3sARB" "glstub_glWindowPos3sARB_nat" [@@noalloc]
+external glWindowPos3sMESA :
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos3sMESA" "glstub_glWindowPos3sMESA_nat" [@@noalloc]
 val glWindowPos3sv : int array -> unit
 val glWindowPos3svARB : int array -> unit
 val glWindowPos3svMESA : int array -> unit
-external glWindowPos4dMESA : float -> float -> float -> float -> unit
-  = "glstub_glWindowPos4dMESA" "glstub_glWindowPos4dMESA"
+external glWindowPos4dMESA :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos4dMESA" "glstub_glWindowPos4dMESA_nat" [@@noalloc]
 external glWindowPos4dvMESA : float array -> unit
   = "glstub_glWindowPos4dvMESA" "glstub_glWindowPos4dvMESA"
-external glWindowPos4fMESA : float -> float -> float -> float -> unit
-  = "glstub_glWindowPos4fMESA" "glstub_glWindowPos4fMESA"
+external glWindowPos4fMESA :
+  (float [@unboxed]) ->
+  (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+  = "glstub_glWindowPos4fMESA" "glstub_glWindowPos4fMESA_nat" [@@noalloc]
 val glWindowPos4fvMESA : float array -> unit
-external glWindowPos4iMESA : int -> int -> int -> int -> unit
-  = "glstub_glWindowPos4iMESA" "glstub_glWindowPos4iMESA"
+external glWindowPos4iMESA :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos4iMESA" "glstub_glWindowPos4iMESA_nat" [@@noalloc]
 val glWindowPos4ivMESA : int array -> unit
-external glWindowPos4sMESA : int -> int -> int -> int -> unit
-  = "glstub_glWindowPos4sMESA" "glstub_glWindowPos4sMESA"
+external glWindowPos4sMESA :
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWindowPos4sMESA" "glstub_glWindowPos4sMESA_nat" [@@noalloc]
 val glWindowPos4svMESA : int array -> unit
-external glWriteMaskEXT : int -> int -> int -> int -> int -> int -> unit
-  = "glstub_glWriteMaskEXT_byte" "glstub_glWriteMaskEXT"
-external glewInit : unit -> int = "glstub_glewInit" "glstub_glewInit"
+external glWriteMaskEXT :
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) ->
+  (int [@untagged]) -> (int [@untagged]) -> (int [@untagged]) -> unit
+  = "glstub_glWriteMaskEXT_byte" "glstub_glWriteMaskEXT_nat" [@@noalloc]
+module Direct :
+  sig
+    external glAreProgramsResidentNV :
+      int -> word_array -> word_array -> bool
+      = "glstub_glAreProgramsResidentNV" "glstub_glAreProgramsResidentNV"
+    external glAreTexturesResident : int -> word_array -> word_array -> bool
+      = "glstub_glAreTexturesResident" "glstub_glAreTexturesResident"
+    external glAreTexturesResidentEXT :
+      int -> word_array -> word_array -> bool
+      = "glstub_glAreTexturesResidentEXT" "glstub_glAreTexturesResidentEXT"
+    external glBitmap :
+      int -> int -> float -> float -> float -> float -> ubyte_array -> unit
+      = "glstub_glBitmap_byte" "glstub_glBitmap"
+    external glClearBufferfv : int -> int -> float_array -> unit
+      = "glstub_glClearBufferfv" "glstub_glClearBufferfv"
+    external glClearBufferiv : int -> int -> word_array -> unit
+      = "glstub_glClearBufferiv" "glstub_glClearBufferiv"
+    external glClipPlanefOES : int -> float_array -> unit
+      = "glstub_glClipPlanefOES" "glstub_glClipPlanefOES"
+    external glColor3bv : byte_array -> unit = "glstub_glColor3bv"
+      "glstub_glColor3bv"
+    external glColor3fVertex3fvSUN : float_array -> float_array -> unit
+      = "glstub_glColor3fVertex3fvSUN" "glstub_glColor3fVertex3fvSUN"
+    external glColor3fv : float_array -> unit = "glstub_glColor3fv"
+      "glstub_glColor3fv"
+    external glColor3hvNV : ushort_array -> unit = "glstub_glColor3hvNV"
+      "glstub_glColor3hvNV"
+    external glColor3iv : word_array -> unit = "glstub_glColor3iv"
+      "glstub_glColor3iv"
+    external glColor3sv : short_array -> unit = "glstub_glColor3sv"
+      "glstub_glColor3sv"
+    external glColor3ubv : ubyte_array -> unit = "glstub_glColor3ubv"
+      "glstub_glColor3ubv"
+    external glColor3uiv : word_array -> unit = "glstub_glColor3uiv"
+      "glstub_glColor3uiv"
+    external glColor3usv : ushort_array -> unit = "glstub_glColor3usv"
+      "glstub_glColor3usv"
+    external glColor4bv : byte_array -> unit = "glstub_glColor4bv"
+      "glstub_glColor4bv"
+    external glColor4fNormal3fVertex3fvSUN :
+      float_array -> float_array -> float_array -> unit
+      = "glstub_glColor4fNormal3fVertex3fvSUN"
+      "glstub_glColor4fNormal3fVertex3fvSUN"
+    external glColor4fv : float_array -> unit = "glstub_glColor4fv"
+      "glstub_glColor4fv"
+    external glColor4hvNV : ushort_array -> unit = "glstub_glColor4hvNV"
+      "glstub_glColor4hvNV"
+    external glColor4iv : word_array -> unit = "glstub_glColor4iv"
+      "glstub_glColor4iv"
+    external glColor4sv : short_array -> unit = "glstub_glColor4sv"
+      "glstub_glColor4sv"
+    external glColor4ubVertex2fvSUN : ubyte_array -> float_array -> unit
+      = "glstub_glColor4ubVertex2fvSUN" "glstub_glColor4ubVertex2fvSUN"
+    external glColor4ubVertex3fvSUN : ubyte_array -> float_array -> unit
+      = "glstub_glColor4ubVertex3fvSUN" "glstub_glColor4ubVertex3fvSUN"
+    external glColor4ubv : ubyte_array -> unit = "glstub_glColor4ubv"
+      "glstub_glColor4ubv"
+    external glColor4uiv : word_array -> unit = "glstub_glColor4uiv"
+      "glstub_glColor4uiv"
+    external glColor4usv : ushort_array -> unit = "glstub_glColor4usv"
+      "glstub_glColor4usv"
+    external glColorTableParameterfv : int -> int -> float_array -> unit
+      = "glstub_glColorTableParameterfv" "glstub_glColorTableParameterfv"
+    external glColorTableParameterfvSGI : int -> int -> float_array -> unit
+      = "glstub_glColorTableParameterfvSGI"
+      "glstub_glColorTableParameterfvSGI"
+    external glColorTableParameteriv : int -> int -> word_array -> unit
+      = "glstub_glColorTableParameteriv" "glstub_glColorTableParameteriv"
+    external glColorTableParameterivSGI : int -> int -> word_array -> unit
+      = "glstub_glColorTableParameterivSGI"
+      "glstub_glColorTableParameterivSGI"
+    external glCombinerParameterfvNV : int -> float_array -> unit
+      = "glstub_glCombinerParameterfvNV" "glstub_glCombinerParameterfvNV"
+    external glCombinerParameterivNV : int -> word_array -> unit
+      = "glstub_glCombinerParameterivNV" "glstub_glCombinerParameterivNV"
+    external glCombinerStageParameterfvNV : int -> int -> float_array -> unit
+      = "glstub_glCombinerStageParameterfvNV"
+      "glstub_glCombinerStageParameterfvNV"
+    external glConvolutionParameterfv : int -> int -> float_array -> unit
+      = "glstub_glConvolutionParameterfv" "glstub_glConvolutionParameterfv"
+    external glConvolutionParameterfvEXT : int -> int -> float_array -> unit
+      = "glstub_glConvolutionParameterfvEXT"
+      "glstub_glConvolutionParameterfvEXT"
+    external glConvolutionParameteriv : int -> int -> word_array -> unit
+      = "glstub_glConvolutionParameteriv" "glstub_glConvolutionParameteriv"
+    external glConvolutionParameterivEXT : int -> int -> word_array -> unit
+      = "glstub_glConvolutionParameterivEXT"
+      "glstub_glConvolutionParameterivEXT"
+    external glCullParameterfvEXT : int -> float_array -> unit
+      = "glstub_glCullParameterfvEXT" "glstub_glCullParameterfvEXT"
+    external glDeleteBuffers : int -> word_array -> unit
+      = "glstub_glDeleteBuffers" "glstub_glDeleteBuffers"
+    external glDeleteBuffersARB : int -> word_array -> unit
+      = "glstub_glDeleteBuffersARB" "glstub_glDeleteBuffersARB"
+    external glDeleteFencesAPPLE : int -> word_array -> unit
+      = "glstub_glDeleteFencesAPPLE" "glstub_glDeleteFencesAPPLE"
+    external glDeleteFencesNV : int -> word_array -> unit
+      = "glstub_glDeleteFencesNV" "glstub_glDeleteFencesNV"
+    external glDeleteFramebuffers : int -> word_array -> unit
+      = "glstub_glDeleteFramebuffers" "glstub_glDeleteFramebuffers"
+    external glDeleteFramebuffersEXT : int -> word_array -> unit
+      = "glstub_glDeleteFramebuffersEXT" "glstub_glDeleteFramebuffersEXT"
+    external glDeleteOcclusionQueriesNV : int -> word_array -> unit
+      = "glstub_glDeleteOcclusionQueriesNV"
+      "glstub_glDeleteOcclusionQueriesNV"
+    external glDeleteProgramsARB : int -> word_array -> unit
+      = "glstub_glDeleteProgramsARB" "glstub_glDeleteProgramsARB"
+    external glDeleteProgramsNV : int -> word_array -> unit
+      = "glstub_glDeleteProgramsNV" "glstub_glDeleteProgramsNV"
+    external glDeleteQueries : int -> word_array -> unit
+      = "glstub_glDeleteQueries" "glstub_glDeleteQueries"
+    external glDeleteQueriesARB : int -> word_array -> unit
+      = "glstub_glDeleteQueriesARB" "glstub_glDeleteQueriesARB"
+    external glDeleteRenderbuffers : int -> word_array -> unit
+      = "glstub_glDeleteRenderbuffers" "glstub_glDeleteRenderbuffers"
+    external glDeleteRenderbuffersEXT : int -> word_array -> unit
+      = "glstub_glDeleteRenderbuffersEXT" "glstub_glDeleteRenderbuffersEXT"
+    external glDeleteSamplers : int -> word_array -> unit
+      = "glstub_glDeleteSamplers" "glstub_glDeleteSamplers"
+    external glDeleteTextures : int -> word_array -> unit
+      = "glstub_glDeleteTextures" "glstub_glDeleteTextures"
+    external glDeleteTexturesEXT : int -> word_array -> unit
+      = "glstub_glDeleteTexturesEXT" "glstub_glDeleteTexturesEXT"
+    external glDeleteVertexArrays : int -> word_array -> unit
+      = "glstub_glDeleteVertexArrays" "glstub_glDeleteVertexArrays"
+    external glDeleteVertexArraysAPPLE : int -> word_array -> unit
+      = "glstub_glDeleteVertexArraysAPPLE" "glstub_glDeleteVertexArraysAPPLE"
+    external glDetailTexFuncSGIS : int -> int -> float_array -> unit
+      = "glstub_glDetailTexFuncSGIS" "glstub_glDetailTexFuncSGIS"
+    external glDrawBuffers : int -> word_array -> unit
+      = "glstub_glDrawBuffers" "glstub_glDrawBuffers"
+    external glDrawBuffersARB : int -> word_array -> unit
+      = "glstub_glDrawBuffersARB" "glstub_glDrawBuffersARB"
+    external glDrawBuffersATI : int -> word_array -> unit
+      = "glstub_glDrawBuffersATI" "glstub_glDrawBuffersATI"
+    external glEdgeFlagPointerEXT : int -> int -> word_array -> unit
+      = "glstub_glEdgeFlagPointerEXT" "glstub_glEdgeFlagPointerEXT"
+    external glEdgeFlagv : word_array -> unit = "glstub_glEdgeFlagv"
+      "glstub_glEdgeFlagv"
+    external glEvalCoord1fv : float_array -> unit = "glstub_glEvalCoord1fv"
+      "glstub_glEvalCoord1fv"
+    external glEvalCoord2fv : float_array -> unit = "glstub_glEvalCoord2fv"
+      "glstub_glEvalCoord2fv"
+    external glExecuteProgramNV : int -> int -> float_array -> unit
+      = "glstub_glExecuteProgramNV" "glstub_glExecuteProgramNV"
+    external glFeedbackBuffer : int -> int -> float_array -> unit
+      = "glstub_glFeedbackBuffer" "glstub_glFeedbackBuffer"
+    external glFinishAsyncSGIX : word_array -> int
+      = "glstub_glFinishAsyncSGIX" "glstub_glFinishAsyncSGIX"
+    external glFogCoordfv : float_array -> unit = "glstub_glFogCoordfv"
+      "glstub_glFogCoordfv"
+    external glFogCoordfvEXT : float_array -> unit = "glstub_glFogCoordfvEXT"
+      "glstub_glFogCoordfvEXT"
+    external glFogCoordhvNV : ushort_array -> unit = "glstub_glFogCoordhvNV"
+      "glstub_glFogCoordhvNV"
+    external glFogFuncSGIS : int -> float_array -> unit
+      = "glstub_glFogFuncSGIS" "glstub_glFogFuncSGIS"
+    external glFogfv : int -> float_array -> unit = "glstub_glFogfv"
+      "glstub_glFogfv"
+    external glFogiv : int -> word_array -> unit = "glstub_glFogiv"
+      "glstub_glFogiv"
+    external glFragmentLightModelfvEXT : int -> float_array -> unit
+      = "glstub_glFragmentLightModelfvEXT" "glstub_glFragmentLightModelfvEXT"
+    external glFragmentLightModelfvSGIX : int -> float_array -> unit
+      = "glstub_glFragmentLightModelfvSGIX"
+      "glstub_glFragmentLightModelfvSGIX"
+    external glFragmentLightModelivEXT : int -> word_array -> unit
+      = "glstub_glFragmentLightModelivEXT" "glstub_glFragmentLightModelivEXT"
+    external glFragmentLightModelivSGIX : int -> word_array -> unit
+      = "glstub_glFragmentLightModelivSGIX"
+      "glstub_glFragmentLightModelivSGIX"
+    external glFragmentLightfvEXT : int -> int -> float_array -> unit
+      = "glstub_glFragmentLightfvEXT" "glstub_glFragmentLightfvEXT"
+    external glFragmentLightfvSGIX : int -> int -> float_array -> unit
+      = "glstub_glFragmentLightfvSGIX" "glstub_glFragmentLightfvSGIX"
+    external glFragmentLightivEXT : int -> int -> word_array -> unit
+      = "glstub_glFragmentLightivEXT" "glstub_glFragmentLightivEXT"
+    external glFragmentLightivSGIX : int -> int -> word_array -> unit
+      = "glstub_glFragmentLightivSGIX" "glstub_glFragmentLightivSGIX"
+    external glFragmentMaterialfvEXT : int -> int -> float_array -> unit
+      = "glstub_glFragmentMaterialfvEXT" "glstub_glFragmentMaterialfvEXT"
+    external glFragmentMaterialfvSGIX : int -> int -> float_array -> unit
+      = "glstub_glFragmentMaterialfvSGIX" "glstub_glFragmentMaterialfvSGIX"
+    external glFragmentMaterialivEXT : int -> int -> word_array -> unit
+      = "glstub_glFragmentMaterialivEXT" "glstub_glFragmentMaterialivEXT"
+    external glFragmentMaterialivSGIX : int -> int -> word_array -> unit
+      = "glstub_glFragmentMaterialivSGIX" "glstub_glFragmentMaterialivSGIX"
+    external glGenBuffers : int -> word_array -> unit = "glstub_glGenBuffers"
+      "glstub_glGenBuffers"
+    external glGenBuffersARB : int -> word_array -> unit
+      = "glstub_glGenBuffersARB" "glstub_glGenBuffersARB"
+    external glGenFencesAPPLE : int -> word_array -> unit
+      = "glstub_glGenFencesAPPLE" "glstub_glGenFencesAPPLE"
+    external glGenFencesNV : int -> word_array -> unit
+      = "glstub_glGenFencesNV" "glstub_glGenFencesNV"
+    external glGenFramebuffers : int -> word_array -> unit
+      = "glstub_glGenFramebuffers" "glstub_glGenFramebuffers"
+    external glGenFramebuffersEXT : int -> word_array -> unit
+      = "glstub_glGenFramebuffersEXT" "glstub_glGenFramebuffersEXT"
+    external glGenOcclusionQueriesNV : int -> word_array -> unit
+      = "glstub_glGenOcclusionQueriesNV" "glstub_glGenOcclusionQueriesNV"
+    external glGenProgramsARB : int -> word_array -> unit
+      = "glstub_glGenProgramsARB" "glstub_glGenProgramsARB"
+    external glGenProgramsNV : int -> word_array -> unit
+      = "glstub_glGenProgramsNV" "glstub_glGenProgramsNV"
+    external glGenQueries : int -> word_array -> unit = "glstub_glGenQueries"
+      "glstub_glGenQueries"
+    external glGenQueriesARB : int -> word_array -> unit
+      = "glstub_glGenQueriesARB" "glstub_glGenQueriesARB"
+    external glGenRenderbuffers : int -> word_array -> unit
+      = "glstub_glGenRenderbuffers" "glstub_glGenRenderbuffers"
+    external glGenRenderbuffersEXT : int -> word_array -> unit
+      = "glstub_glGenRenderbuffersEXT" "glstub_glGenRenderbuffersEXT"
+    external glGenSamplers : int -> word_array -> unit
+      = "glstub_glGenSamplers" "glstub_glGenSamplers"
+    external glGenTextures : int -> word_array -> unit
+      = "glstub_glGenTextures" "glstub_glGenTextures"
+    external glGenTexturesEXT : int -> word_array -> unit
+      = "glstub_glGenTexturesEXT" "glstub_glGenTexturesEXT"
+    external glGenVertexArrays : int -> word_array -> unit
+      = "glstub_glGenVertexArrays" "glstub_glGenVertexArrays"
+    external glGenVertexArraysAPPLE : int -> word_array -> unit
+      = "glstub_glGenVertexArraysAPPLE" "glstub_glGenVertexArraysAPPLE"
+    external glGetActiveAttrib :
+      int ->
+      int -> int -> word_array -> word_array -> word_array -> string -> unit
+      = "glstub_glGetActiveAttrib_byte" "glstub_glGetActiveAttrib"
+    external glGetActiveAttribARB :
+      int ->
+      int -> int -> word_array -> word_array -> word_array -> string -> unit
+      = "glstub_glGetActiveAttribARB_byte" "glstub_glGetActiveAttribARB"
+    external glGetActiveUniform :
+      int ->
+      int -> int -> word_array -> word_array -> word_array -> string -> unit
+      = "glstub_glGetActiveUniform_byte" "glstub_glGetActiveUniform"
+    external glGetActiveUniformARB :
+      int ->
+      int -> int -> word_array -> word_array -> word_array -> string -> unit
+      = "glstub_glGetActiveUniformARB_byte" "glstub_glGetActiveUniformARB"
+    external glGetActiveVaryingNV :
+      int ->
+      int -> int -> word_array -> word_array -> word_array -> string -> unit
+      = "glstub_glGetActiveVaryingNV_byte" "glstub_glGetActiveVaryingNV"
+    external glGetArrayObjectfvATI : int -> int -> float_array -> unit
+      = "glstub_glGetArrayObjectfvATI" "glstub_glGetArrayObjectfvATI"
+    external glGetArrayObjectivATI : int -> int -> word_array -> unit
+      = "glstub_glGetArrayObjectivATI" "glstub_glGetArrayObjectivATI"
+    external glGetAttachedObjectsARB :
+      int -> int -> word_array -> word_array -> unit
+      = "glstub_glGetAttachedObjectsARB" "glstub_glGetAttachedObjectsARB"
+    external glGetAttachedShaders :
+      int -> int -> word_array -> word_array -> unit
+      = "glstub_glGetAttachedShaders" "glstub_glGetAttachedShaders"
+    external glGetBooleanIndexedvEXT : int -> int -> word_array -> unit
+      = "glstub_glGetBooleanIndexedvEXT" "glstub_glGetBooleanIndexedvEXT"
+    external glGetBooleanv : int -> word_array -> unit
+      = "glstub_glGetBooleanv" "glstub_glGetBooleanv"
+    external glGetBufferParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetBufferParameteriv" "glstub_glGetBufferParameteriv"
+    external glGetBufferParameterivARB : int -> int -> word_array -> unit
+      = "glstub_glGetBufferParameterivARB" "glstub_glGetBufferParameterivARB"
+    external glGetClipPlanefOES : int -> float_array -> unit
+      = "glstub_glGetClipPlanefOES" "glstub_glGetClipPlanefOES"
+    external glGetColorTableParameterfv : int -> int -> float_array -> unit
+      = "glstub_glGetColorTableParameterfv"
+      "glstub_glGetColorTableParameterfv"
+    external glGetColorTableParameterfvEXT :
+      int -> int -> float_array -> unit
+      = "glstub_glGetColorTableParameterfvEXT"
+      "glstub_glGetColorTableParameterfvEXT"
+    external glGetColorTableParameterfvSGI :
+      int -> int -> float_array -> unit
+      = "glstub_glGetColorTableParameterfvSGI"
+      "glstub_glGetColorTableParameterfvSGI"
+    external glGetColorTableParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetColorTableParameteriv"
+      "glstub_glGetColorTableParameteriv"
+    external glGetColorTableParameterivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetColorTableParameterivEXT"
+      "glstub_glGetColorTableParameterivEXT"
+    external glGetColorTableParameterivSGI : int -> int -> word_array -> unit
+      = "glstub_glGetColorTableParameterivSGI"
+      "glstub_glGetColorTableParameterivSGI"
+    external glGetCombinerInputParameterfvNV :
+      int -> int -> int -> int -> float_array -> unit
+      = "glstub_glGetCombinerInputParameterfvNV"
+      "glstub_glGetCombinerInputParameterfvNV"
+    external glGetCombinerInputParameterivNV :
+      int -> int -> int -> int -> word_array -> unit
+      = "glstub_glGetCombinerInputParameterivNV"
+      "glstub_glGetCombinerInputParameterivNV"
+    external glGetCombinerOutputParameterfvNV :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glGetCombinerOutputParameterfvNV"
+      "glstub_glGetCombinerOutputParameterfvNV"
+    external glGetCombinerOutputParameterivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glGetCombinerOutputParameterivNV"
+      "glstub_glGetCombinerOutputParameterivNV"
+    external glGetCombinerStageParameterfvNV :
+      int -> int -> float_array -> unit
+      = "glstub_glGetCombinerStageParameterfvNV"
+      "glstub_glGetCombinerStageParameterfvNV"
+    external glGetConvolutionParameterfv : int -> int -> float_array -> unit
+      = "glstub_glGetConvolutionParameterfv"
+      "glstub_glGetConvolutionParameterfv"
+    external glGetConvolutionParameterfvEXT :
+      int -> int -> float_array -> unit
+      = "glstub_glGetConvolutionParameterfvEXT"
+      "glstub_glGetConvolutionParameterfvEXT"
+    external glGetConvolutionParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetConvolutionParameteriv"
+      "glstub_glGetConvolutionParameteriv"
+    external glGetConvolutionParameterivEXT :
+      int -> int -> word_array -> unit
+      = "glstub_glGetConvolutionParameterivEXT"
+      "glstub_glGetConvolutionParameterivEXT"
+    external glGetDetailTexFuncSGIS : int -> float_array -> unit
+      = "glstub_glGetDetailTexFuncSGIS" "glstub_glGetDetailTexFuncSGIS"
+    external glGetFenceivNV : int -> int -> word_array -> unit
+      = "glstub_glGetFenceivNV" "glstub_glGetFenceivNV"
+    external glGetFinalCombinerInputParameterfvNV :
+      int -> int -> float_array -> unit
+      = "glstub_glGetFinalCombinerInputParameterfvNV"
+      "glstub_glGetFinalCombinerInputParameterfvNV"
+    external glGetFinalCombinerInputParameterivNV :
+      int -> int -> word_array -> unit
+      = "glstub_glGetFinalCombinerInputParameterivNV"
+      "glstub_glGetFinalCombinerInputParameterivNV"
+    external glGetFloatv : int -> float_array -> unit = "glstub_glGetFloatv"
+      "glstub_glGetFloatv"
+    external glGetFogFuncSGIS : float_array -> unit
+      = "glstub_glGetFogFuncSGIS" "glstub_glGetFogFuncSGIS"
+    external glGetFragmentLightfvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetFragmentLightfvEXT" "glstub_glGetFragmentLightfvEXT"
+    external glGetFragmentLightfvSGIX : int -> int -> float_array -> unit
+      = "glstub_glGetFragmentLightfvSGIX" "glstub_glGetFragmentLightfvSGIX"
+    external glGetFragmentLightivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetFragmentLightivEXT" "glstub_glGetFragmentLightivEXT"
+    external glGetFragmentLightivSGIX : int -> int -> word_array -> unit
+      = "glstub_glGetFragmentLightivSGIX" "glstub_glGetFragmentLightivSGIX"
+    external glGetFragmentMaterialfvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetFragmentMaterialfvEXT"
+      "glstub_glGetFragmentMaterialfvEXT"
+    external glGetFragmentMaterialfvSGIX : int -> int -> float_array -> unit
+      = "glstub_glGetFragmentMaterialfvSGIX"
+      "glstub_glGetFragmentMaterialfvSGIX"
+    external glGetFragmentMaterialivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetFragmentMaterialivEXT"
+      "glstub_glGetFragmentMaterialivEXT"
+    external glGetFragmentMaterialivSGIX : int -> int -> word_array -> unit
+      = "glstub_glGetFragmentMaterialivSGIX"
+      "glstub_glGetFragmentMaterialivSGIX"
+    external glGetFramebufferAttachmentParameterivEXT :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glGetFramebufferAttachmentParameterivEXT"
+      "glstub_glGetFramebufferAttachmentParameterivEXT"
+    external glGetHistogramParameterfv : int -> int -> float_array -> unit
+      = "glstub_glGetHistogramParameterfv" "glstub_glGetHistogramParameterfv"
+    external glGetHistogramParameterfvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetHistogramParameterfvEXT"
+      "glstub_glGetHistogramParameterfvEXT"
+    external glGetHistogramParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetHistogramParameteriv" "glstub_glGetHistogramParameteriv"
+    external glGetHistogramParameterivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetHistogramParameterivEXT"
+      "glstub_glGetHistogramParameterivEXT"
+    external glGetImageTransformParameterfvHP :
+      int -> int -> float_array -> unit
+      = "glstub_glGetImageTransformParameterfvHP"
+      "glstub_glGetImageTransformParameterfvHP"
+    external glGetImageTransformParameterivHP :
+      int -> int -> word_array -> unit
+      = "glstub_glGetImageTransformParameterivHP"
+      "glstub_glGetImageTransformParameterivHP"
+    external glGetInfoLogARB : int -> int -> word_array -> string -> unit
+      = "glstub_glGetInfoLogARB" "glstub_glGetInfoLogARB"
+    external glGetInteger64v : int -> dword_array -> unit
+      = "glstub_glGetInteger64v" "glstub_glGetInteger64v"
+    external glGetIntegerIndexedvEXT : int -> int -> word_array -> unit
+      = "glstub_glGetIntegerIndexedvEXT" "glstub_glGetIntegerIndexedvEXT"
+    external glGetIntegerv : int -> word_array -> unit
+      = "glstub_glGetIntegerv" "glstub_glGetIntegerv"
+    external glGetInvariantBooleanvEXT : int -> int -> word_array -> unit
+      = "glstub_glGetInvariantBooleanvEXT" "glstub_glGetInvariantBooleanvEXT"
+    external glGetInvariantFloatvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetInvariantFloatvEXT" "glstub_glGetInvariantFloatvEXT"
+    external glGetInvariantIntegervEXT : int -> int -> word_array -> unit
+      = "glstub_glGetInvariantIntegervEXT" "glstub_glGetInvariantIntegervEXT"
+    external glGetLightfv : int -> int -> float_array -> unit
+      = "glstub_glGetLightfv" "glstub_glGetLightfv"
+    external glGetLightiv : int -> int -> word_array -> unit
+      = "glstub_glGetLightiv" "glstub_glGetLightiv"
+    external glGetLocalConstantBooleanvEXT : int -> int -> word_array -> unit
+      = "glstub_glGetLocalConstantBooleanvEXT"
+      "glstub_glGetLocalConstantBooleanvEXT"
+    external glGetLocalConstantFloatvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetLocalConstantFloatvEXT"
+      "glstub_glGetLocalConstantFloatvEXT"
+    external glGetLocalConstantIntegervEXT : int -> int -> word_array -> unit
+      = "glstub_glGetLocalConstantIntegervEXT"
+      "glstub_glGetLocalConstantIntegervEXT"
+    external glGetMapAttribParameterfvNV :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glGetMapAttribParameterfvNV"
+      "glstub_glGetMapAttribParameterfvNV"
+    external glGetMapAttribParameterivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glGetMapAttribParameterivNV"
+      "glstub_glGetMapAttribParameterivNV"
+    external glGetMapParameterfvNV : int -> int -> float_array -> unit
+      = "glstub_glGetMapParameterfvNV" "glstub_glGetMapParameterfvNV"
+    external glGetMapParameterivNV : int -> int -> word_array -> unit
+      = "glstub_glGetMapParameterivNV" "glstub_glGetMapParameterivNV"
+    external glGetMapfv : int -> int -> float_array -> unit
+      = "glstub_glGetMapfv" "glstub_glGetMapfv"
+    external glGetMapiv : int -> int -> word_array -> unit
+      = "glstub_glGetMapiv" "glstub_glGetMapiv"
+    external glGetMaterialfv : int -> int -> float_array -> unit
+      = "glstub_glGetMaterialfv" "glstub_glGetMaterialfv"
+    external glGetMaterialiv : int -> int -> word_array -> unit
+      = "glstub_glGetMaterialiv" "glstub_glGetMaterialiv"
+    external glGetMinmaxParameterfv : int -> int -> float_array -> unit
+      = "glstub_glGetMinmaxParameterfv" "glstub_glGetMinmaxParameterfv"
+    external glGetMinmaxParameterfvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetMinmaxParameterfvEXT" "glstub_glGetMinmaxParameterfvEXT"
+    external glGetMinmaxParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetMinmaxParameteriv" "glstub_glGetMinmaxParameteriv"
+    external glGetMinmaxParameterivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetMinmaxParameterivEXT" "glstub_glGetMinmaxParameterivEXT"
+    external glGetObjectBufferfvATI : int -> int -> float_array -> unit
+      = "glstub_glGetObjectBufferfvATI" "glstub_glGetObjectBufferfvATI"
+    external glGetObjectBufferivATI : int -> int -> word_array -> unit
+      = "glstub_glGetObjectBufferivATI" "glstub_glGetObjectBufferivATI"
+    external glGetObjectParameterfvARB : int -> int -> float_array -> unit
+      = "glstub_glGetObjectParameterfvARB" "glstub_glGetObjectParameterfvARB"
+    external glGetObjectParameterivARB : int -> int -> word_array -> unit
+      = "glstub_glGetObjectParameterivARB" "glstub_glGetObjectParameterivARB"
+    external glGetOcclusionQueryivNV : int -> int -> word_array -> unit
+      = "glstub_glGetOcclusionQueryivNV" "glstub_glGetOcclusionQueryivNV"
+    external glGetOcclusionQueryuivNV : int -> int -> word_array -> unit
+      = "glstub_glGetOcclusionQueryuivNV" "glstub_glGetOcclusionQueryuivNV"
+    external glGetPixelMapfv : int -> float_array -> unit
+      = "glstub_glGetPixelMapfv" "glstub_glGetPixelMapfv"
+    external glGetPixelMapuiv : int -> word_array -> unit
+      = "glstub_glGetPixelMapuiv" "glstub_glGetPixelMapuiv"
+    external glGetPixelMapusv : int -> ushort_array -> unit
+      = "glstub_glGetPixelMapusv" "glstub_glGetPixelMapusv"
+    external glGetPixelTransformParameterfvEXT :
+      int -> int -> float_array -> unit
+      = "glstub_glGetPixelTransformParameterfvEXT"
+      "glstub_glGetPixelTransformParameterfvEXT"
+    external glGetPixelTransformParameterivEXT :
+      int -> int -> word_array -> unit
+      = "glstub_glGetPixelTransformParameterivEXT"
+      "glstub_glGetPixelTransformParameterivEXT"
+    external glGetPolygonStipple : ubyte_array -> unit
+      = "glstub_glGetPolygonStipple" "glstub_glGetPolygonStipple"
+    external glGetProgramBinary :
+      int -> int -> word_array -> word_array -> 'a -> unit
+      = "glstub_glGetProgramBinary" "glstub_glGetProgramBinary"
+    external glGetProgramEnvParameterfvARB :
+      int -> int -> float_array -> unit
+      = "glstub_glGetProgramEnvParameterfvARB"
+      "glstub_glGetProgramEnvParameterfvARB"
+    external glGetProgramInfoLog : int -> int -> word_array -> string -> unit
+      = "glstub_glGetProgramInfoLog" "glstub_glGetProgramInfoLog"
+    external glGetProgramLocalParameterfvARB :
+      int -> int -> float_array -> unit
+      = "glstub_glGetProgramLocalParameterfvARB"
+      "glstub_glGetProgramLocalParameterfvARB"
+    external glGetProgramNamedParameterdvNV :
+      int -> int -> ubyte_array -> float array -> unit
+      = "glstub_glGetProgramNamedParameterdvNV"
+      "glstub_glGetProgramNamedParameterdvNV"
+    external glGetProgramNamedParameterfvNV :
+      int -> int -> ubyte_array -> float_array -> unit
+      = "glstub_glGetProgramNamedParameterfvNV"
+      "glstub_glGetProgramNamedParameterfvNV"
+    external glGetProgramParameterfvNV :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glGetProgramParameterfvNV" "glstub_glGetProgramParameterfvNV"
+    external glGetProgramStringNV : int -> int -> ubyte_array -> unit
+      = "glstub_glGetProgramStringNV" "glstub_glGetProgramStringNV"
+    external glGetProgramiv : int -> int -> word_array -> unit
+      = "glstub_glGetProgramiv" "glstub_glGetProgramiv"
+    external glGetProgramivARB : int -> int -> word_array -> unit
+      = "glstub_glGetProgramivARB" "glstub_glGetProgramivARB"
+    external glGetProgramivNV : int -> int -> word_array -> unit
+      = "glstub_glGetProgramivNV" "glstub_glGetProgramivNV"
+    external glGetQueryObjecti64v : int -> int -> dword_array -> unit
+      = "glstub_glGetQueryObjecti64v" "glstub_glGetQueryObjecti64v"
+    external glGetQueryObjecti64vEXT : int -> int -> dword_array -> unit
+      = "glstub_glGetQueryObjecti64vEXT" "glstub_glGetQueryObjecti64vEXT"
+    external glGetQueryObjectiv : int -> int -> word_array -> unit
+      = "glstub_glGetQueryObjectiv" "glstub_glGetQueryObjectiv"
+    external glGetQueryObjectivARB : int -> int -> word_array -> unit
+      = "glstub_glGetQueryObjectivARB" "glstub_glGetQueryObjectivARB"
+    external glGetQueryObjectui64v : int -> int -> dword_array -> unit
+      = "glstub_glGetQueryObjectui64v" "glstub_glGetQueryObjectui64v"
+    external glGetQueryObjectui64vEXT : int -> int -> dword_array -> unit
+      = "glstub_glGetQueryObjectui64vEXT" "glstub_glGetQueryObjectui64vEXT"
+    external glGetQueryObjectuiv : int -> int -> word_array -> unit
+      = "glstub_glGetQueryObjectuiv" "glstub_glGetQueryObjectuiv"
+    external glGetQueryObjectuivARB : int -> int -> word_array -> unit
+      = "glstub_glGetQueryObjectuivARB" "glstub_glGetQueryObjectuivARB"
+    external glGetQueryiv : int -> int -> word_array -> unit
+      = "glstub_glGetQueryiv" "glstub_glGetQueryiv"
+    external glGetQueryivARB : int -> int -> word_array -> unit
+      = "glstub_glGetQueryivARB" "glstub_glGetQueryivARB"
+    external glGetRenderbufferParameterivEXT :
+      int -> int -> word_array -> unit
+      = "glstub_glGetRenderbufferParameterivEXT"
+      "glstub_glGetRenderbufferParameterivEXT"
+    external glGetShaderInfoLog : int -> int -> word_array -> string -> unit
+      = "glstub_glGetShaderInfoLog" "glstub_glGetShaderInfoLog"
+    external glGetShaderSource : int -> int -> word_array -> string -> unit
+      = "glstub_glGetShaderSource" "glstub_glGetShaderSource"
+    external glGetShaderSourceARB :
+      int -> int -> word_array -> string -> unit
+      = "glstub_glGetShaderSourceARB" "glstub_glGetShaderSourceARB"
+    external glGetShaderiv : int -> int -> word_array -> unit
+      = "glstub_glGetShaderiv" "glstub_glGetShaderiv"
+    external glGetSharpenTexFuncSGIS : int -> float_array -> unit
+      = "glstub_glGetSharpenTexFuncSGIS" "glstub_glGetSharpenTexFuncSGIS"
+    external glGetTexBumpParameterfvATI : int -> float_array -> unit
+      = "glstub_glGetTexBumpParameterfvATI"
+      "glstub_glGetTexBumpParameterfvATI"
+    external glGetTexBumpParameterivATI : int -> word_array -> unit
+      = "glstub_glGetTexBumpParameterivATI"
+      "glstub_glGetTexBumpParameterivATI"
+    external glGetTexEnvfv : int -> int -> float_array -> unit
+      = "glstub_glGetTexEnvfv" "glstub_glGetTexEnvfv"
+    external glGetTexEnviv : int -> int -> word_array -> unit
+      = "glstub_glGetTexEnviv" "glstub_glGetTexEnviv"
+    external glGetTexFilterFuncSGIS : int -> int -> float_array -> unit
+      = "glstub_glGetTexFilterFuncSGIS" "glstub_glGetTexFilterFuncSGIS"
+    external glGetTexGenfv : int -> int -> float_array -> unit
+      = "glstub_glGetTexGenfv" "glstub_glGetTexGenfv"
+    external glGetTexGeniv : int -> int -> word_array -> unit
+      = "glstub_glGetTexGeniv" "glstub_glGetTexGeniv"
+    external glGetTexLevelParameterfv :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glGetTexLevelParameterfv" "glstub_glGetTexLevelParameterfv"
+    external glGetTexLevelParameteriv :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glGetTexLevelParameteriv" "glstub_glGetTexLevelParameteriv"
+    external glGetTexParameterIivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetTexParameterIivEXT" "glstub_glGetTexParameterIivEXT"
+    external glGetTexParameterIuivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetTexParameterIuivEXT" "glstub_glGetTexParameterIuivEXT"
+    external glGetTexParameterfv : int -> int -> float_array -> unit
+      = "glstub_glGetTexParameterfv" "glstub_glGetTexParameterfv"
+    external glGetTexParameteriv : int -> int -> word_array -> unit
+      = "glstub_glGetTexParameteriv" "glstub_glGetTexParameteriv"
+    external glGetTrackMatrixivNV : int -> int -> int -> word_array -> unit
+      = "glstub_glGetTrackMatrixivNV" "glstub_glGetTrackMatrixivNV"
+    external glGetTransformFeedbackVaryingNV :
+      int -> int -> word_array -> unit
+      = "glstub_glGetTransformFeedbackVaryingNV"
+      "glstub_glGetTransformFeedbackVaryingNV"
+    external glGetUniformfv : int -> int -> float_array -> unit
+      = "glstub_glGetUniformfv" "glstub_glGetUniformfv"
+    external glGetUniformfvARB : int -> int -> float_array -> unit
+      = "glstub_glGetUniformfvARB" "glstub_glGetUniformfvARB"
+    external glGetUniformiv : int -> int -> word_array -> unit
+      = "glstub_glGetUniformiv" "glstub_glGetUniformiv"
+    external glGetUniformivARB : int -> int -> word_array -> unit
+      = "glstub_glGetUniformivARB" "glstub_glGetUniformivARB"
+    external glGetUniformuivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetUniformuivEXT" "glstub_glGetUniformuivEXT"
+    external glGetVariantArrayObjectfvATI : int -> int -> float_array -> unit
+      = "glstub_glGetVariantArrayObjectfvATI"
+      "glstub_glGetVariantArrayObjectfvATI"
+    external glGetVariantArrayObjectivATI : int -> int -> word_array -> unit
+      = "glstub_glGetVariantArrayObjectivATI"
+      "glstub_glGetVariantArrayObjectivATI"
+    external glGetVariantBooleanvEXT : int -> int -> word_array -> unit
+      = "glstub_glGetVariantBooleanvEXT" "glstub_glGetVariantBooleanvEXT"
+    external glGetVariantFloatvEXT : int -> int -> float_array -> unit
+      = "glstub_glGetVariantFloatvEXT" "glstub_glGetVariantFloatvEXT"
+    external glGetVariantIntegervEXT : int -> int -> word_array -> unit
+      = "glstub_glGetVariantIntegervEXT" "glstub_glGetVariantIntegervEXT"
+    external glGetVertexAttribArrayObjectfvATI :
+      int -> int -> float_array -> unit
+      = "glstub_glGetVertexAttribArrayObjectfvATI"
+      "glstub_glGetVertexAttribArrayObjectfvATI"
+    external glGetVertexAttribArrayObjectivATI :
+      int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribArrayObjectivATI"
+      "glstub_glGetVertexAttribArrayObjectivATI"
+    external glGetVertexAttribIivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribIivEXT" "glstub_glGetVertexAttribIivEXT"
+    external glGetVertexAttribIuivEXT : int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribIuivEXT" "glstub_glGetVertexAttribIuivEXT"
+    external glGetVertexAttribfv : int -> int -> float_array -> unit
+      = "glstub_glGetVertexAttribfv" "glstub_glGetVertexAttribfv"
+    external glGetVertexAttribfvARB : int -> int -> float_array -> unit
+      = "glstub_glGetVertexAttribfvARB" "glstub_glGetVertexAttribfvARB"
+    external glGetVertexAttribfvNV : int -> int -> float_array -> unit
+      = "glstub_glGetVertexAttribfvNV" "glstub_glGetVertexAttribfvNV"
+    external glGetVertexAttribiv : int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribiv" "glstub_glGetVertexAttribiv"
+    external glGetVertexAttribivARB : int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribivARB" "glstub_glGetVertexAttribivARB"
+    external glGetVertexAttribivNV : int -> int -> word_array -> unit
+      = "glstub_glGetVertexAttribivNV" "glstub_glGetVertexAttribivNV"
+    external glImageTransformParameterfvHP :
+      int -> int -> float_array -> unit
+      = "glstub_glImageTransformParameterfvHP"
+      "glstub_glImageTransformParameterfvHP"
+    external glImageTransformParameterivHP : int -> int -> word_array -> unit
+      = "glstub_glImageTransformParameterivHP"
+      "glstub_glImageTransformParameterivHP"
+    external glIndexfv : float_array -> unit = "glstub_glIndexfv"
+      "glstub_glIndexfv"
+    external glIndexiv : word_array -> unit = "glstub_glIndexiv"
+      "glstub_glIndexiv"
+    external glIndexsv : short_array -> unit = "glstub_glIndexsv"
+      "glstub_glIndexsv"
+    external glIndexubv : ubyte_array -> unit = "glstub_glIndexubv"
+      "glstub_glIndexubv"
+    external glLightModelfv : int -> float_array -> unit
+      = "glstub_glLightModelfv" "glstub_glLightModelfv"
+    external glLightModeliv : int -> word_array -> unit
+      = "glstub_glLightModeliv" "glstub_glLightModeliv"
+    external glLightfv : int -> int -> float_array -> unit
+      = "glstub_glLightfv" "glstub_glLightfv"
+    external glLightiv : int -> int -> word_array -> unit
+      = "glstub_glLightiv" "glstub_glLightiv"
+    external glLoadMatrixf : float_array -> unit = "glstub_glLoadMatrixf"
+      "glstub_glLoadMatrixf"
+    external glLoadProgramNV : int -> int -> int -> ubyte_array -> unit
+      = "glstub_glLoadProgramNV" "glstub_glLoadProgramNV"
+    external glLoadTransposeMatrixf : float_array -> unit
+      = "glstub_glLoadTransposeMatrixf" "glstub_glLoadTransposeMatrixf"
+    external glLoadTransposeMatrixfARB : float_array -> unit
+      = "glstub_glLoadTransposeMatrixfARB" "glstub_glLoadTransposeMatrixfARB"
+    external glMap1f :
+      int -> float -> float -> int -> int -> float_array -> unit
+      = "glstub_glMap1f_byte" "glstub_glMap1f"
+    external glMap2f :
+      int ->
+      float ->
+      float ->
+      int -> int -> float -> float -> int -> int -> float_array -> unit
+      = "glstub_glMap2f_byte" "glstub_glMap2f"
+    external glMapParameterfvNV : int -> int -> float_array -> unit
+      = "glstub_glMapParameterfvNV" "glstub_glMapParameterfvNV"
+    external glMapParameterivNV : int -> int -> word_array -> unit
+      = "glstub_glMapParameterivNV" "glstub_glMapParameterivNV"
+    external glMaterialfv : int -> int -> float_array -> unit
+      = "glstub_glMaterialfv" "glstub_glMaterialfv"
+    external glMaterialiv : int -> int -> word_array -> unit
+      = "glstub_glMaterialiv" "glstub_glMaterialiv"
+    external glMatrixIndexubvARB : int -> ubyte_array -> unit
+      = "glstub_glMatrixIndexubvARB" "glstub_glMatrixIndexubvARB"
+    external glMatrixIndexuivARB : int -> word_array -> unit
+      = "glstub_glMatrixIndexuivARB" "glstub_glMatrixIndexuivARB"
+    external glMatrixIndexusvARB : int -> ushort_array -> unit
+      = "glstub_glMatrixIndexusvARB" "glstub_glMatrixIndexusvARB"
+    external glMultMatrixf : float_array -> unit = "glstub_glMultMatrixf"
+      "glstub_glMultMatrixf"
+    external glMultTransposeMatrixf : float_array -> unit
+      = "glstub_glMultTransposeMatrixf" "glstub_glMultTransposeMatrixf"
+    external glMultTransposeMatrixfARB : float_array -> unit
+      = "glstub_glMultTransposeMatrixfARB" "glstub_glMultTransposeMatrixfARB"
+    external glMultiDrawArrays :
+      int -> word_array -> word_array -> int -> unit
+      = "glstub_glMultiDrawArrays" "glstub_glMultiDrawArrays"
+    external glMultiDrawArraysEXT :
+      int -> word_array -> word_array -> int -> unit
+      = "glstub_glMultiDrawArraysEXT" "glstub_glMultiDrawArraysEXT"
+    external glMultiDrawElementArrayAPPLE :
+      int -> word_array -> word_array -> int -> unit
+      = "glstub_glMultiDrawElementArrayAPPLE"
+      "glstub_glMultiDrawElementArrayAPPLE"
+    external glMultiDrawElements :
+      int -> word_array -> int -> 'a -> int -> unit
+      = "glstub_glMultiDrawElements" "glstub_glMultiDrawElements"
+    external glMultiDrawElementsBaseVertex :
+      int -> word_array -> int -> 'a -> int -> word_array -> unit
+      = "glstub_glMultiDrawElementsBaseVertex_byte"
+      "glstub_glMultiDrawElementsBaseVertex"
+    external glMultiDrawElementsEXT :
+      int -> word_array -> int -> 'a -> int -> unit
+      = "glstub_glMultiDrawElementsEXT" "glstub_glMultiDrawElementsEXT"
+    external glMultiDrawRangeElementArrayAPPLE :
+      int -> int -> int -> word_array -> word_array -> int -> unit
+      = "glstub_glMultiDrawRangeElementArrayAPPLE_byte"
+      "glstub_glMultiDrawRangeElementArrayAPPLE"
+    external glMultiModeDrawArraysIBM :
+      word_array -> word_array -> word_array -> int -> int -> unit
+      = "glstub_glMultiModeDrawArraysIBM" "glstub_glMultiModeDrawArraysIBM"
+    external glMultiModeDrawElementsIBM :
+      word_array -> word_array -> int -> 'a -> int -> int -> unit
+      = "glstub_glMultiModeDrawElementsIBM_byte"
+      "glstub_glMultiModeDrawElementsIBM"
+    external glMultiTexCoord1fv : int -> float_array -> unit
+      = "glstub_glMultiTexCoord1fv" "glstub_glMultiTexCoord1fv"
+    external glMultiTexCoord1fvARB : int -> float_array -> unit
+      = "glstub_glMultiTexCoord1fvARB" "glstub_glMultiTexCoord1fvARB"
+    external glMultiTexCoord1hvNV : int -> ushort_array -> unit
+      = "glstub_glMultiTexCoord1hvNV" "glstub_glMultiTexCoord1hvNV"
+    external glMultiTexCoord1iv : int -> word_array -> unit
+      = "glstub_glMultiTexCoord1iv" "glstub_glMultiTexCoord1iv"
+    external glMultiTexCoord1ivARB : int -> word_array -> unit
+      = "glstub_glMultiTexCoord1ivARB" "glstub_glMultiTexCoord1ivARB"
+    external glMultiTexCoord1sv : int -> short_array -> unit
+      = "glstub_glMultiTexCoord1sv" "glstub_glMultiTexCoord1sv"
+    external glMultiTexCoord1svARB : int -> short_array -> unit
+      = "glstub_glMultiTexCoord1svARB" "glstub_glMultiTexCoord1svARB"
+    external glMultiTexCoord2fv : int -> float_array -> unit
+      = "glstub_glMultiTexCoord2fv" "glstub_glMultiTexCoord2fv"
+    external glMultiTexCoord2fvARB : int -> float_array -> unit
+      = "glstub_glMultiTexCoord2fvARB" "glstub_glMultiTexCoord2fvARB"
+    external glMultiTexCoord2hvNV : int -> ushort_array -> unit
+      = "glstub_glMultiTexCoord2hvNV" "glstub_glMultiTexCoord2hvNV"
+    external glMultiTexCoord2iv : int -> word_array -> unit
+      = "glstub_glMultiTexCoord2iv" "glstub_glMultiTexCoord2iv"
+    external glMultiTexCoord2ivARB : int -> word_array -> unit
+      = "glstub_glMultiTexCoord2ivARB" "glstub_glMultiTexCoord2ivARB"
+    external glMultiTexCoord2sv : int -> short_array -> unit
+      = "glstub_glMultiTexCoord2sv" "glstub_glMultiTexCoord2sv"
+    external glMultiTexCoord2svARB : int -> short_array -> unit
+      = "glstub_glMultiTexCoord2svARB" "glstub_glMultiTexCoord2svARB"
+    external glMultiTexCoord3fv : int -> float_array -> unit
+      = "glstub_glMultiTexCoord3fv" "glstub_glMultiTexCoord3fv"
+    external glMultiTexCoord3fvARB : int -> float_array -> unit
+      = "glstub_glMultiTexCoord3fvARB" "glstub_glMultiTexCoord3fvARB"
+    external glMultiTexCoord3hvNV : int -> ushort_array -> unit
+      = "glstub_glMultiTexCoord3hvNV" "glstub_glMultiTexCoord3hvNV"
+    external glMultiTexCoord3iv : int -> word_array -> unit
+      = "glstub_glMultiTexCoord3iv" "glstub_glMultiTexCoord3iv"
+    external glMultiTexCoord3ivARB : int -> word_array -> unit
+      = "glstub_glMultiTexCoord3ivARB" "glstub_glMultiTexCoord3ivARB"
+    external glMultiTexCoord3sv : int -> short_array -> unit
+      = "glstub_glMultiTexCoord3sv" "glstub_glMultiTexCoord3sv"
+    external glMultiTexCoord3svARB : int -> short_array -> unit
+      = "glstub_glMultiTexCoord3svARB" "glstub_glMultiTexCoord3svARB"
+    external glMultiTexCoord4fv : int -> float_array -> unit
+      = "glstub_glMultiTexCoord4fv" "glstub_glMultiTexCoord4fv"
+    external glMultiTexCoord4fvARB : int -> float_array -> unit
+      = "glstub_glMultiTexCoord4fvARB" "glstub_glMultiTexCoord4fvARB"
+    external glMultiTexCoord4hvNV : int -> ushort_array -> unit
+      = "glstub_glMultiTexCoord4hvNV" "glstub_glMultiTexCoord4hvNV"
+    external glMultiTexCoord4iv : int -> word_array -> unit
+      = "glstub_glMultiTexCoord4iv" "glstub_glMultiTexCoord4iv"
+    external glMultiTexCoord4ivARB : int -> word_array -> unit
+      = "glstub_glMultiTexCoord4ivARB" "glstub_glMultiTexCoord4ivARB"
+    external glMultiTexCoord4sv : int -> short_array -> unit
+      = "glstub_glMultiTexCoord4sv" "glstub_glMultiTexCoord4sv"
+    external glMultiTexCoord4svARB : int -> short_array -> unit
+      = "glstub_glMultiTexCoord4svARB" "glstub_glMultiTexCoord4svARB"
+    external glNormal3bv : byte_array -> unit = "glstub_glNormal3bv"
+      "glstub_glNormal3bv"
+    external glNormal3fVertex3fvSUN : float_array -> float_array -> unit
+      = "glstub_glNormal3fVertex3fvSUN" "glstub_glNormal3fVertex3fvSUN"
+    external glNormal3fv : float_array -> unit = "glstub_glNormal3fv"
+      "glstub_glNormal3fv"
+    external glNormal3hvNV : ushort_array -> unit = "glstub_glNormal3hvNV"
+      "glstub_glNormal3hvNV"
+    external glNormal3iv : word_array -> unit = "glstub_glNormal3iv"
+      "glstub_glNormal3iv"
+    external glNormal3sv : short_array -> unit = "glstub_glNormal3sv"
+      "glstub_glNormal3sv"
+    external glNormalStream3bvATI : int -> byte_array -> unit
+      = "glstub_glNormalStream3bvATI" "glstub_glNormalStream3bvATI"
+    external glNormalStream3fvATI : int -> float_array -> unit
+      = "glstub_glNormalStream3fvATI" "glstub_glNormalStream3fvATI"
+    external glNormalStream3ivATI : int -> word_array -> unit
+      = "glstub_glNormalStream3ivATI" "glstub_glNormalStream3ivATI"
+    external glNormalStream3svATI : int -> short_array -> unit
+      = "glstub_glNormalStream3svATI" "glstub_glNormalStream3svATI"
+    external glPixelMapfv : int -> int -> float_array -> unit
+      = "glstub_glPixelMapfv" "glstub_glPixelMapfv"
+    external glPixelMapuiv : int -> int -> word_array -> unit
+      = "glstub_glPixelMapuiv" "glstub_glPixelMapuiv"
+    external glPixelMapusv : int -> int -> ushort_array -> unit
+      = "glstub_glPixelMapusv" "glstub_glPixelMapusv"
+    external glPixelTransformParameterfvEXT :
+      int -> int -> float_array -> unit
+      = "glstub_glPixelTransformParameterfvEXT"
+      "glstub_glPixelTransformParameterfvEXT"
+    external glPixelTransformParameterivEXT :
+      int -> int -> word_array -> unit
+      = "glstub_glPixelTransformParameterivEXT"
+      "glstub_glPixelTransformParameterivEXT"
+    external glPointParameterfv : int -> float_array -> unit
+      = "glstub_glPointParameterfv" "glstub_glPointParameterfv"
+    external glPointParameterfvARB : int -> float_array -> unit
+      = "glstub_glPointParameterfvARB" "glstub_glPointParameterfvARB"
+    external glPointParameterfvEXT : int -> float_array -> unit
+      = "glstub_glPointParameterfvEXT" "glstub_glPointParameterfvEXT"
+    external glPointParameterivNV : int -> word_array -> unit
+      = "glstub_glPointParameterivNV" "glstub_glPointParameterivNV"
+    external glPollAsyncSGIX : word_array -> int = "glstub_glPollAsyncSGIX"
+      "glstub_glPollAsyncSGIX"
+    external glPolygonStipple : ubyte_array -> unit
+      = "glstub_glPolygonStipple" "glstub_glPolygonStipple"
+    external glPrioritizeTextures : int -> word_array -> float_array -> unit
+      = "glstub_glPrioritizeTextures" "glstub_glPrioritizeTextures"
+    external glPrioritizeTexturesEXT :
+      int -> word_array -> float_array -> unit
+      = "glstub_glPrioritizeTexturesEXT" "glstub_glPrioritizeTexturesEXT"
+    external glProgramBufferParametersIivNV :
+      int -> int -> int -> int -> word_array -> unit
+      = "glstub_glProgramBufferParametersIivNV"
+      "glstub_glProgramBufferParametersIivNV"
+    external glProgramBufferParametersIuivNV :
+      int -> int -> int -> int -> word_array -> unit
+      = "glstub_glProgramBufferParametersIuivNV"
+      "glstub_glProgramBufferParametersIuivNV"
+    external glProgramBufferParametersfvNV :
+      int -> int -> int -> int -> float_array -> unit
+      = "glstub_glProgramBufferParametersfvNV"
+      "glstub_glProgramBufferParametersfvNV"
+    external glProgramEnvParameter4fvARB : int -> int -> float_array -> unit
+      = "glstub_glProgramEnvParameter4fvARB"
+      "glstub_glProgramEnvParameter4fvARB"
+    external glProgramEnvParameterI4ivNV : int -> int -> word_array -> unit
+      = "glstub_glProgramEnvParameterI4ivNV"
+      "glstub_glProgramEnvParameterI4ivNV"
+    external glProgramEnvParameterI4uivNV : int -> int -> word_array -> unit
+      = "glstub_glProgramEnvParameterI4uivNV"
+      "glstub_glProgramEnvParameterI4uivNV"
+    external glProgramEnvParameters4fvEXT :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glProgramEnvParameters4fvEXT"
+      "glstub_glProgramEnvParameters4fvEXT"
+    external glProgramEnvParametersI4ivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glProgramEnvParametersI4ivNV"
+      "glstub_glProgramEnvParametersI4ivNV"
+    external glProgramEnvParametersI4uivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glProgramEnvParametersI4uivNV"
+      "glstub_glProgramEnvParametersI4uivNV"
+    external glProgramLocalParameter4fvARB :
+      int -> int -> float_array -> unit
+      = "glstub_glProgramLocalParameter4fvARB"
+      "glstub_glProgramLocalParameter4fvARB"
+    external glProgramLocalParameterI4ivNV : int -> int -> word_array -> unit
+      = "glstub_glProgramLocalParameterI4ivNV"
+      "glstub_glProgramLocalParameterI4ivNV"
+    external glProgramLocalParameterI4uivNV :
+      int -> int -> word_array -> unit
+      = "glstub_glProgramLocalParameterI4uivNV"
+      "glstub_glProgramLocalParameterI4uivNV"
+    external glProgramLocalParameters4fvEXT :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glProgramLocalParameters4fvEXT"
+      "glstub_glProgramLocalParameters4fvEXT"
+    external glProgramLocalParametersI4ivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glProgramLocalParametersI4ivNV"
+      "glstub_glProgramLocalParametersI4ivNV"
+    external glProgramLocalParametersI4uivNV :
+      int -> int -> int -> word_array -> unit
+      = "glstub_glProgramLocalParametersI4uivNV"
+      "glstub_glProgramLocalParametersI4uivNV"
+    external glProgramNamedParameter4dNV :
+      int -> int -> ubyte_array -> float -> float -> float -> float -> unit
+      = "glstub_glProgramNamedParameter4dNV_byte"
+      "glstub_glProgramNamedParameter4dNV"
+    external glProgramNamedParameter4dvNV :
+      int -> int -> ubyte_array -> float array -> unit
+      = "glstub_glProgramNamedParameter4dvNV"
+      "glstub_glProgramNamedParameter4dvNV"
+    external glProgramNamedParameter4fNV :
+      int -> int -> ubyte_array -> float -> float -> float -> float -> unit
+      = "glstub_glProgramNamedParameter4fNV_byte"
+      "glstub_glProgramNamedParameter4fNV"
+    external glProgramNamedParameter4fvNV :
+      int -> int -> ubyte_array -> float_array -> unit
+      = "glstub_glProgramNamedParameter4fvNV"
+      "glstub_glProgramNamedParameter4fvNV"
+    external glProgramParameter4fvNV : int -> int -> float_array -> unit
+      = "glstub_glProgramParameter4fvNV" "glstub_glProgramParameter4fvNV"
+    external glProgramParameters4fvNV :
+      int -> int -> int -> float_array -> unit
+      = "glstub_glProgramParameters4fvNV" "glstub_glProgramParameters4fvNV"
+    external glRasterPos2fv : float_array -> unit = "glstub_glRasterPos2fv"
+      "glstub_glRasterPos2fv"
+    external glRasterPos2iv : word_array -> unit = "glstub_glRasterPos2iv"
+      "glstub_glRasterPos2iv"
+    external glRasterPos2sv : short_array -> unit = "glstub_glRasterPos2sv"
+      "glstub_glRasterPos2sv"
+    external glRasterPos3fv : float_array -> unit = "glstub_glRasterPos3fv"
+      "glstub_glRasterPos3fv"
+    external glRasterPos3iv : word_array -> unit = "glstub_glRasterPos3iv"
+      "glstub_glRasterPos3iv"
+    external glRasterPos3sv : short_array -> unit = "glstub_glRasterPos3sv"
+      "glstub_glRasterPos3sv"
+    external glRasterPos4fv : float_array -> unit = "glstub_glRasterPos4fv"
+      "glstub_glRasterPos4fv"
+    external glRasterPos4iv : word_array -> unit = "glstub_glRasterPos4iv"
+      "glstub_glRasterPos4iv"
+    external glRasterPos4sv : short_array -> unit = "glstub_glRasterPos4sv"
+      "glstub_glRasterPos4sv"
+    external glRectfv : float_array -> float_array -> unit
+      = "glstub_glRectfv" "glstub_glRectfv"
+    external glRectiv : word_array -> word_array -> unit = "glstub_glRectiv"
+      "glstub_glRectiv"
+    external glRectsv : short_array -> short_array -> unit
+      = "glstub_glRectsv" "glstub_glRectsv"
+    external glReplacementCodeubvSUN : ubyte_array -> unit
+      = "glstub_glReplacementCodeubvSUN" "glstub_glReplacementCodeubvSUN"
+    external glReplacementCodeuiColor3fVertex3fvSUN :
+      word_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiColor3fVertex3fvSUN"
+      "glstub_glReplacementCodeuiColor3fVertex3fvSUN"
+    external glReplacementCodeuiColor4fNormal3fVertex3fvSUN :
+      word_array -> float_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN"
+      "glstub_glReplacementCodeuiColor4fNormal3fVertex3fvSUN"
+    external glReplacementCodeuiColor4ubVertex3fvSUN :
+      word_array -> ubyte_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiColor4ubVertex3fvSUN"
+      "glstub_glReplacementCodeuiColor4ubVertex3fvSUN"
+    external glReplacementCodeuiNormal3fVertex3fvSUN :
+      word_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiNormal3fVertex3fvSUN"
+      "glstub_glReplacementCodeuiNormal3fVertex3fvSUN"
+    external glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN :
+      word_array ->
+      float_array -> float_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN"
+      "glstub_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN"
+    external glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN :
+      word_array -> float_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN"
+      "glstub_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN"
+    external glReplacementCodeuiTexCoord2fVertex3fvSUN :
+      word_array -> float_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN"
+      "glstub_glReplacementCodeuiTexCoord2fVertex3fvSUN"
+    external glReplacementCodeuiVertex3fvSUN :
+      word_array -> float_array -> unit
+      = "glstub_glReplacementCodeuiVertex3fvSUN"
+      "glstub_glReplacementCodeuiVertex3fvSUN"
+    external glReplacementCodeuivSUN : word_array -> unit
+      = "glstub_glReplacementCodeuivSUN" "glstub_glReplacementCodeuivSUN"
+    external glReplacementCodeusvSUN : ushort_array -> unit
+      = "glstub_glReplacementCodeusvSUN" "glstub_glReplacementCodeusvSUN"
+    external glRequestResidentProgramsNV : int -> word_array -> unit
+      = "glstub_glRequestResidentProgramsNV"
+      "glstub_glRequestResidentProgramsNV"
+    external glSecondaryColor3bv : byte_array -> unit
+      = "glstub_glSecondaryColor3bv" "glstub_glSecondaryColor3bv"
+    external glSecondaryColor3bvEXT : byte_array -> unit
+      = "glstub_glSecondaryColor3bvEXT" "glstub_glSecondaryColor3bvEXT"
+    external glSecondaryColor3fv : float_array -> unit
+      = "glstub_glSecondaryColor3fv" "glstub_glSecondaryColor3fv"
+    external glSecondaryColor3fvEXT : float_array -> unit
+      = "glstub_glSecondaryColor3fvEXT" "glstub_glSecondaryColor3fvEXT"
+    external glSecondaryColor3hvNV : ushort_array -> unit
+      = "glstub_glSecondaryColor3hvNV" "glstub_glSecondaryColor3hvNV"
+    external glSecondaryColor3iv : word_array -> unit
+      = "glstub_glSecondaryColor3iv" "glstub_glSecondaryColor3iv"
+    external glSecondaryColor3ivEXT : word_array -> unit
+      = "glstub_glSecondaryColor3ivEXT" "glstub_glSecondaryColor3ivEXT"
+    external glSecondaryColor3sv : short_array -> unit
+      = "glstub_glSecondaryColor3sv" "glstub_glSecondaryColor3sv"
+    external glSecondaryColor3svEXT : short_array -> unit
+      = "glstub_glSecondaryColor3svEXT" "glstub_glSecondaryColor3svEXT"
+    external glSecondaryColor3ubv : ubyte_array -> unit
+      = "glstub_glSecondaryColor3ubv" "glstub_glSecondaryColor3ubv"
+    external glSecondaryColor3ubvEXT : ubyte_array -> unit
+      = "glstub_glSecondaryColor3ubvEXT" "glstub_glSecondaryColor3ubvEXT"
+    external glSecondaryColor3uiv : word_array -> unit
+      = "glstub_glSecondaryColor3uiv" "glstub_glSecondaryColor3uiv"
+    external glSecondaryColor3uivEXT : word_array -> unit
+      = "glstub_glSecondaryColor3uivEXT" "glstub_glSecondaryColor3uivEXT"
+    external glSecondaryColor3usv : ushort_array -> unit
+      = "glstub_glSecondaryColor3usv" "glstub_glSecondaryColor3usv"
+    external glSecondaryColor3usvEXT : ushort_array -> unit
+      = "glstub_glSecondaryColor3usvEXT" "glstub_glSecondaryColor3usvEXT"
+    external glSelectBuffer : int -> word_array -> unit
+      = "glstub_glSelectBuffer" "glstub_glSelectBuffer"
+    external glSetFragmentShaderConstantATI : int -> float_array -> unit
+      = "glstub_glSetFragmentShaderConstantATI"
+      "glstub_glSetFragmentShaderConstantATI"
+    external glShaderSource :
+      int -> int -> string array -> word_array -> unit
+      = "glstub_glShaderSource" "glstub_glShaderSource"
+    external glShaderSourceARB :
+      int -> int -> string array -> word_array -> unit
+      = "glstub_glShaderSourceARB" "glstub_glShaderSourceARB"
+    external glSharpenTexFuncSGIS : int -> int -> float_array -> unit
+      = "glstub_glSharpenTexFuncSGIS" "glstub_glSharpenTexFuncSGIS"
+    external glSpriteParameterfvSGIX : int -> float_array -> unit
+      = "glstub_glSpriteParameterfvSGIX" "glstub_glSpriteParameterfvSGIX"
+    external glSpriteParameterivSGIX : int -> word_array -> unit
+      = "glstub_glSpriteParameterivSGIX" "glstub_glSpriteParameterivSGIX"
+    external glTexBumpParameterfvATI : int -> float_array -> unit
+      = "glstub_glTexBumpParameterfvATI" "glstub_glTexBumpParameterfvATI"
+    external glTexBumpParameterivATI : int -> word_array -> unit
+      = "glstub_glTexBumpParameterivATI" "glstub_glTexBumpParameterivATI"
+    external glTexCoord1fv : float_array -> unit = "glstub_glTexCoord1fv"
+      "glstub_glTexCoord1fv"
+    external glTexCoord1hvNV : ushort_array -> unit
+      = "glstub_glTexCoord1hvNV" "glstub_glTexCoord1hvNV"
+    external glTexCoord1iv : word_array -> unit = "glstub_glTexCoord1iv"
+      "glstub_glTexCoord1iv"
+    external glTexCoord1sv : short_array -> unit = "glstub_glTexCoord1sv"
+      "glstub_glTexCoord1sv"
+    external glTexCoord2fColor3fVertex3fvSUN :
+      float_array -> float_array -> float_array -> unit
+      = "glstub_glTexCoord2fColor3fVertex3fvSUN"
+      "glstub_glTexCoord2fColor3fVertex3fvSUN"
+    external glTexCoord2fColor4fNormal3fVertex3fvSUN :
+      float_array -> float_array -> float_array -> float_array -> unit
+      = "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN"
+      "glstub_glTexCoord2fColor4fNormal3fVertex3fvSUN"
+    external glTexCoord2fColor4ubVertex3fvSUN :
+      float_array -> ubyte_array -> float_array -> unit
+      = "glstub_glTexCoord2fColor4ubVertex3fvSUN"
+      "glstub_glTexCoord2fColor4ubVertex3fvSUN"
+    external glTexCoord2fNormal3fVertex3fvSUN :
+      float_array -> float_array -> float_array -> unit
+      = "glstub_glTexCoord2fNormal3fVertex3fvSUN"
+      "glstub_glTexCoord2fNormal3fVertex3fvSUN"
+    external glTexCoord2fVertex3fvSUN : float_array -> float_array -> unit
+      = "glstub_glTexCoord2fVertex3fvSUN" "glstub_glTexCoord2fVertex3fvSUN"
+    external glTexCoord2fv : float_array -> unit = "glstub_glTexCoord2fv"
+      "glstub_glTexCoord2fv"
+    external glTexCoord2hvNV : ushort_array -> unit
+      = "glstub_glTexCoord2hvNV" "glstub_glTexCoord2hvNV"
+    external glTexCoord2iv : word_array -> unit = "glstub_glTexCoord2iv"
+      "glstub_glTexCoord2iv"
+    external glTexCoord2sv : short_array -> unit = "glstub_glTexCoord2sv"
+      "glstub_glTexCoord2sv"
+    external glTexCoord3fv : float_array -> unit = "glstub_glTexCoord3fv"
+      "glstub_glTexCoord3fv"
+    external glTexCoord3hvNV : ushort_array -> unit
+      = "glstub_glTexCoord3hvNV" "glstub_glTexCoord3hvNV"
+    external glTexCoord3iv : word_array -> unit = "glstub_glTexCoord3iv"
+      "glstub_glTexCoord3iv"
+    external glTexCoord3sv : short_array -> unit = "glstub_glTexCoord3sv"
+      "glstub_glTexCoord3sv"
+    external glTexCoord4fColor4fNormal3fVertex4fvSUN :
+      float_array -> float_array -> float_array -> float_array -> unit
+      = "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN"
+      "glstub_glTexCoord4fColor4fNormal3fVertex4fvSUN"
+    external glTexCoord4fVertex4fvSUN : float_array -> float_array -> unit
+      = "glstub_glTexCoord4fVertex4fvSUN" "glstub_glTexCoord4fVertex4fvSUN"
+    external glTexCoord4fv : float_array -> unit = "glstub_glTexCoord4fv"
+      "glstub_glTexCoord4fv"
+    external glTexCoord4hvNV : ushort_array -> unit
+      = "glstub_glTexCoord4hvNV" "glstub_glTexCoord4hvNV"
+    external glTexCoord4iv : word_array -> unit = "glstub_glTexCoord4iv"
+      "glstub_glTexCoord4iv"
+    external glTexCoord4sv : short_array -> unit = "glstub_glTexCoord4sv"
+      "glstub_glTexCoord4sv"
+    external glTexEnvfv : int -> int -> float_array -> unit
+      = "glstub_glTexEnvfv" "glstub_glTexEnvfv"
+    external glTexEnviv : int -> int -> word_array -> unit
+      = "glstub_glTexEnviv" "glstub_glTexEnviv"
+    external glTexFilterFuncSGIS : int -> int -> int -> float_array -> unit
+      = "glstub_glTexFilterFuncSGIS" "glstub_glTexFilterFuncSGIS"
+    external glTexGenfv : int -> int -> float_array -> unit
+      = "glstub_glTexGenfv" "glstub_glTexGenfv"
+    external glTexGeniv : int -> int -> word_array -> unit
+      = "glstub_glTexGeniv" "glstub_glTexGeniv"
+    external glTexParameterIivEXT : int -> int -> word_array -> unit
+      = "glstub_glTexParameterIivEXT" "glstub_glTexParameterIivEXT"
+    external glTexParameterIuivEXT : int -> int -> word_array -> unit
+      = "glstub_glTexParameterIuivEXT" "glstub_glTexParameterIuivEXT"
+    external glTexParameterfv : int -> int -> float_array -> unit
+      = "glstub_glTexParameterfv" "glstub_glTexParameterfv"
+    external glTexParameteriv : int -> int -> word_array -> unit
+      = "glstub_glTexParameteriv" "glstub_glTexParameteriv"
+    external glTransformFeedbackAttribsNV : int -> word_array -> int -> unit
+      = "glstub_glTransformFeedbackAttribsNV"
+      "glstub_glTransformFeedbackAttribsNV"
+    external glTransformFeedbackVaryingsNV :
+      int -> int -> word_array -> int -> unit
+      = "glstub_glTransformFeedbackVaryingsNV"
+      "glstub_glTransformFeedbackVaryingsNV"
+    external glUniform1fv : int -> int -> float_array -> unit
+      = "glstub_glUniform1fv" "glstub_glUniform1fv"
+    external glUniform1fvARB : int -> int -> float_array -> unit
+      = "glstub_glUniform1fvARB" "glstub_glUniform1fvARB"
+    external glUniform1iv : int -> int -> word_array -> unit
+      = "glstub_glUniform1iv" "glstub_glUniform1iv"
+    external glUniform1ivARB : int -> int -> word_array -> unit
+      = "glstub_glUniform1ivARB" "glstub_glUniform1ivARB"
+    external glUniform1uivEXT : int -> int -> word_array -> unit
+      = "glstub_glUniform1uivEXT" "glstub_glUniform1uivEXT"
+    external glUniform2fv : int -> int -> float_array -> unit
+      = "glstub_glUniform2fv" "glstub_glUniform2fv"
+    external glUniform2fvARB : int -> int -> float_array -> unit
+      = "glstub_glUniform2fvARB" "glstub_glUniform2fvARB"
+    external glUniform2iv : int -> int -> word_array -> unit
+      = "glstub_glUniform2iv" "glstub_glUniform2iv"
+    external glUniform2ivARB : int -> int -> word_array -> unit
+      = "glstub_glUniform2ivARB" "glstub_glUniform2ivARB"
+    external glUniform2uivEXT : int -> int -> word_array -> unit
+      = "glstub_glUniform2uivEXT" "glstub_glUniform2uivEXT"
+    external glUniform3fv : int -> int -> float_array -> unit
+      = "glstub_glUniform3fv" "glstub_glUniform3fv"
+    external glUniform3fvARB : int -> int -> float_array -> unit
+      = "glstub_glUniform3fvARB" "glstub_glUniform3fvARB"
+    external glUniform3iv : int -> int -> word_array -> unit
+      = "glstub_glUniform3iv" "glstub_glUniform3iv"
+    external glUniform3ivARB : int -> int -> word_array -> unit
+      = "glstub_glUniform3ivARB" "glstub_glUniform3ivARB"
+    external glUniform3uivEXT : int -> int -> word_array -> unit
+      = "glstub_glUniform3uivEXT" "glstub_glUniform3uivEXT"
+    external glUniform4fv : int -> int -> float_array -> unit
+      = "glstub_glUniform4fv" "glstub_glUniform4fv"
+    external glUniform4fvARB : int -> int -> float_array -> unit
+      = "glstub_glUniform4fvARB" "glstub_glUniform4fvARB"
+    external glUniform4iv : int -> int -> word_array -> unit
+      = "glstub_glUniform4iv" "glstub_glUniform4iv"
+    external glUniform4ivARB : int -> int -> word_array -> unit
+      = "glstub_glUniform4ivARB" "glstub_glUniform4ivARB"
+    external glUniform4uivEXT : int -> int -> word_array -> unit
+      = "glstub_glUniform4uivEXT" "glstub_glUniform4uivEXT"
+    external glUniformMatrix2fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix2fv" "glstub_glUniformMatrix2fv"
+    external glUniformMatrix2fvARB :
+      int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix2fvARB" "glstub_glUniformMatrix2fvARB"
+    external glUniformMatrix2x3fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix2x3fv" "glstub_glUniformMatrix2x3fv"
+    external glUniformMatrix2x4fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix2x4fv" "glstub_glUniformMatrix2x4fv"
+    external glUniformMatrix3fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix3fv" "glstub_glUniformMatrix3fv"
+    external glUniformMatrix3fvARB :
+      int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix3fvARB" "glstub_glUniformMatrix3fvARB"
+    external glUniformMatrix3x2fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix3x2fv" "glstub_glUniformMatrix3x2fv"
+    external glUniformMatrix3x4fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix3x4fv" "glstub_glUniformMatrix3x4fv"
+    external glUniformMatrix4fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix4fv" "glstub_glUniformMatrix4fv"
+    external glUniformMatrix4fvARB :
+      int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix4fvARB" "glstub_glUniformMatrix4fvARB"
+    external glUniformMatrix4x2fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix4x2fv" "glstub_glUniformMatrix4x2fv"
+    external glUniformMatrix4x3fv : int -> int -> bool -> float_array -> unit
+      = "glstub_glUniformMatrix4x3fv" "glstub_glUniformMatrix4x3fv"
+    external glVariantbvEXT : int -> byte_array -> unit
+      = "glstub_glVariantbvEXT" "glstub_glVariantbvEXT"
+    external glVariantfvEXT : int -> float_array -> unit
+      = "glstub_glVariantfvEXT" "glstub_glVariantfvEXT"
+    external glVariantivEXT : int -> word_array -> unit
+      = "glstub_glVariantivEXT" "glstub_glVariantivEXT"
+    external glVariantsvEXT : int -> short_array -> unit
+      = "glstub_glVariantsvEXT" "glstub_glVariantsvEXT"
+    external glVariantubvEXT : int -> ubyte_array -> unit
+      = "glstub_glVariantubvEXT" "glstub_glVariantubvEXT"
+    external glVariantuivEXT : int -> word_array -> unit
+      = "glstub_glVariantuivEXT" "glstub_glVariantuivEXT"
+    external glVariantusvEXT : int -> ushort_array -> unit
+      = "glstub_glVariantusvEXT" "glstub_glVariantusvEXT"
+    external glVertex2fv : float_array -> unit = "glstub_glVertex2fv"
+      "glstub_glVertex2fv"
+    external glVertex2hvNV : ushort_array -> unit = "glstub_glVertex2hvNV"
+      "glstub_glVertex2hvNV"
+    external glVertex2iv : word_array -> unit = "glstub_glVertex2iv"
+      "glstub_glVertex2iv"
+    external glVertex2sv : short_array -> unit = "glstub_glVertex2sv"
+      "glstub_glVertex2sv"
+    external glVertex3fv : float_array -> unit = "glstub_glVertex3fv"
+      "glstub_glVertex3fv"
+    external glVertex3hvNV : ushort_array -> unit = "glstub_glVertex3hvNV"
+      "glstub_glVertex3hvNV"
+    external glVertex3iv : word_array -> unit = "glstub_glVertex3iv"
+      "glstub_glVertex3iv"
+    external glVertex3sv : short_array -> unit = "glstub_glVertex3sv"
+      "glstub_glVertex3sv"
+    external glVertex4fv : float_array -> unit = "glstub_glVertex4fv"
+      "glstub_glVertex4fv"
+    external glVertex4hvNV : ushort_array -> unit = "glstub_glVertex4hvNV"
+      "glstub_glVertex4hvNV"
+    external glVertex4iv : word_array -> unit = "glstub_glVertex4iv"
+      "glstub_glVertex4iv"
+    external glVertex4sv : short_array -> unit = "glstub_glVertex4sv"
+      "glstub_glVertex4sv"
+    external glVertexAttrib1fv : int -> float_array -> unit
+      = "glstub_glVertexAttrib1fv" "glstub_glVertexAttrib1fv"
+    external glVertexAttrib1fvARB : int -> float_array -> unit
+      = "glstub_glVertexAttrib1fvARB" "glstub_glVertexAttrib1fvARB"
+    external glVertexAttrib1fvNV : int -> float_array -> unit
+      = "glstub_glVertexAttrib1fvNV" "glstub_glVertexAttrib1fvNV"
+    external glVertexAttrib1hvNV : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib1hvNV" "glstub_glVertexAttrib1hvNV"
+    external glVertexAttrib1sv : int -> short_array -> unit
+      = "glstub_glVertexAttrib1sv" "glstub_glVertexAttrib1sv"
+    external glVertexAttrib1svARB : int -> short_array -> unit
+      = "glstub_glVertexAttrib1svARB" "glstub_glVertexAttrib1svARB"
+    external glVertexAttrib1svNV : int -> short_array -> unit
+      = "glstub_glVertexAttrib1svNV" "glstub_glVertexAttrib1svNV"
+    external glVertexAttrib2fv : int -> float_array -> unit
+      = "glstub_glVertexAttrib2fv" "glstub_glVertexAttrib2fv"
+    external glVertexAttrib2fvARB : int -> float_array -> unit
+      = "glstub_glVertexAttrib2fvARB" "glstub_glVertexAttrib2fvARB"
+    external glVertexAttrib2fvNV : int -> float_array -> unit
+      = "glstub_glVertexAttrib2fvNV" "glstub_glVertexAttrib2fvNV"
+    external glVertexAttrib2hvNV : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib2hvNV" "glstub_glVertexAttrib2hvNV"
+    external glVertexAttrib2sv : int -> short_array -> unit
+      = "glstub_glVertexAttrib2sv" "glstub_glVertexAttrib2sv"
+    external glVertexAttrib2svARB : int -> short_array -> unit
+      = "glstub_glVertexAttrib2svARB" "glstub_glVertexAttrib2svARB"
+    external glVertexAttrib2svNV : int -> short_array -> unit
+      = "glstub_glVertexAttrib2svNV" "glstub_glVertexAttrib2svNV"
+    external glVertexAttrib3fv : int -> float_array -> unit
+      = "glstub_glVertexAttrib3fv" "glstub_glVertexAttrib3fv"
+    external glVertexAttrib3fvARB : int -> float_array -> unit
+      = "glstub_glVertexAttrib3fvARB" "glstub_glVertexAttrib3fvARB"
+    external glVertexAttrib3fvNV : int -> float_array -> unit
+      = "glstub_glVertexAttrib3fvNV" "glstub_glVertexAttrib3fvNV"
+    external glVertexAttrib3hvNV : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib3hvNV" "glstub_glVertexAttrib3hvNV"
+    external glVertexAttrib3sv : int -> short_array -> unit
+      = "glstub_glVertexAttrib3sv" "glstub_glVertexAttrib3sv"
+    external glVertexAttrib3svARB : int -> short_array -> unit
+      = "glstub_glVertexAttrib3svARB" "glstub_glVertexAttrib3svARB"
+    external glVertexAttrib3svNV : int -> short_array -> unit
+      = "glstub_glVertexAttrib3svNV" "glstub_glVertexAttrib3svNV"
+    external glVertexAttrib4Nbv : int -> byte_array -> unit
+      = "glstub_glVertexAttrib4Nbv" "glstub_glVertexAttrib4Nbv"
+    external glVertexAttrib4NbvARB : int -> byte_array -> unit
+      = "glstub_glVertexAttrib4NbvARB" "glstub_glVertexAttrib4NbvARB"
+    external glVertexAttrib4Niv : int -> word_array -> unit
+      = "glstub_glVertexAttrib4Niv" "glstub_glVertexAttrib4Niv"
+    external glVertexAttrib4NivARB : int -> word_array -> unit
+      = "glstub_glVertexAttrib4NivARB" "glstub_glVertexAttrib4NivARB"
+    external glVertexAttrib4Nsv : int -> short_array -> unit
+      = "glstub_glVertexAttrib4Nsv" "glstub_glVertexAttrib4Nsv"
+    external glVertexAttrib4NsvARB : int -> short_array -> unit
+      = "glstub_glVertexAttrib4NsvARB" "glstub_glVertexAttrib4NsvARB"
+    external glVertexAttrib4Nubv : int -> ubyte_array -> unit
+      = "glstub_glVertexAttrib4Nubv" "glstub_glVertexAttrib4Nubv"
+    external glVertexAttrib4NubvARB : int -> ubyte_array -> unit
+      = "glstub_glVertexAttrib4NubvARB" "glstub_glVertexAttrib4NubvARB"
+    external glVertexAttrib4Nuiv : int -> word_array -> unit
+      = "glstub_glVertexAttrib4Nuiv" "glstub_glVertexAttrib4Nuiv"
+    external glVertexAttrib4NuivARB : int -> word_array -> unit
+      = "glstub_glVertexAttrib4NuivARB" "glstub_glVertexAttrib4NuivARB"
+    external glVertexAttrib4Nusv : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib4Nusv" "glstub_glVertexAttrib4Nusv"
+    external glVertexAttrib4NusvARB : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib4NusvARB" "glstub_glVertexAttrib4NusvARB"
+    external glVertexAttrib4bv : int -> byte_array -> unit
+      = "glstub_glVertexAttrib4bv" "glstub_glVertexAttrib4bv"
+    external glVertexAttrib4bvARB : int -> byte_array -> unit
+      = "glstub_glVertexAttrib4bvARB" "glstub_glVertexAttrib4bvARB"
+    external glVertexAttrib4fv : int -> float_array -> unit
+      = "glstub_glVertexAttrib4fv" "glstub_glVertexAttrib4fv"
+    external glVertexAttrib4fvARB : int -> float_array -> unit
+      = "glstub_glVertexAttrib4fvARB" "glstub_glVertexAttrib4fvARB"
+    external glVertexAttrib4fvNV : int -> float_array -> unit
+      = "glstub_glVertexAttrib4fvNV" "glstub_glVertexAttrib4fvNV"
+    external glVertexAttrib4hvNV : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib4hvNV" "glstub_glVertexAttrib4hvNV"
+    external glVertexAttrib4iv : int -> word_array -> unit
+      = "glstub_glVertexAttrib4iv" "glstub_glVertexAttrib4iv"
+    external glVertexAttrib4ivARB : int -> word_array -> unit
+      = "glstub_glVertexAttrib4ivARB" "glstub_glVertexAttrib4ivARB"
+    external glVertexAttrib4sv : int -> short_array -> unit
+      = "glstub_glVertexAttrib4sv" "glstub_glVertexAttrib4sv"
+    external glVertexAttrib4svARB : int -> short_array -> unit
+      = "glstub_glVertexAttrib4svARB" "glstub_glVertexAttrib4svARB"
+    external glVertexAttrib4svNV : int -> short_array -> unit
+      = "glstub_glVertexAttrib4svNV" "glstub_glVertexAttrib4svNV"
+    external glVertexAttrib4ubv : int -> ubyte_array -> unit
+      = "glstub_glVertexAttrib4ubv" "glstub_glVertexAttrib4ubv"
+    external glVertexAttrib4ubvARB : int -> ubyte_array -> unit
+      = "glstub_glVertexAttrib4ubvARB" "glstub_glVertexAttrib4ubvARB"
+    external glVertexAttrib4ubvNV : int -> ubyte_array -> unit
+      = "glstub_glVertexAttrib4ubvNV" "glstub_glVertexAttrib4ubvNV"
+    external glVertexAttrib4uiv : int -> word_array -> unit
+      = "glstub_glVertexAttrib4uiv" "glstub_glVertexAttrib4uiv"
+    external glVertexAttrib4uivARB : int -> word_array -> unit
+      = "glstub_glVertexAttrib4uivARB" "glstub_glVertexAttrib4uivARB"
+    external glVertexAttrib4usv : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib4usv" "glstub_glVertexAttrib4usv"
+    external glVertexAttrib4usvARB : int -> ushort_array -> unit
+      = "glstub_glVertexAttrib4usvARB" "glstub_glVertexAttrib4usvARB"
+    external glVertexAttribI1ivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI1ivEXT" "glstub_glVertexAttribI1ivEXT"
+    external glVertexAttribI1uivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI1uivEXT" "glstub_glVertexAttribI1uivEXT"
+    external glVertexAttribI2ivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI2ivEXT" "glstub_glVertexAttribI2ivEXT"
+    external glVertexAttribI2uivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI2uivEXT" "glstub_glVertexAttribI2uivEXT"
+    external glVertexAttribI3ivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI3ivEXT" "glstub_glVertexAttribI3ivEXT"
+    external glVertexAttribI3uivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI3uivEXT" "glstub_glVertexAttribI3uivEXT"
+    external glVertexAttribI4bvEXT : int -> byte_array -> unit
+      = "glstub_glVertexAttribI4bvEXT" "glstub_glVertexAttribI4bvEXT"
+    external glVertexAttribI4ivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI4ivEXT" "glstub_glVertexAttribI4ivEXT"
+    external glVertexAttribI4svEXT : int -> short_array -> unit
+      = "glstub_glVertexAttribI4svEXT" "glstub_glVertexAttribI4svEXT"
+    external glVertexAttribI4ubvEXT : int -> ubyte_array -> unit
+      = "glstub_glVertexAttribI4ubvEXT" "glstub_glVertexAttribI4ubvEXT"
+    external glVertexAttribI4uivEXT : int -> word_array -> unit
+      = "glstub_glVertexAttribI4uivEXT" "glstub_glVertexAttribI4uivEXT"
+    external glVertexAttribI4usvEXT : int -> ushort_array -> unit
+      = "glstub_glVertexAttribI4usvEXT" "glstub_glVertexAttribI4usvEXT"
+    external glVertexAttribs1fvNV : int -> int -> float_array -> unit
+      = "glstub_glVertexAttribs1fvNV" "glstub_glVertexAttribs1fvNV"
+    external glVertexAttribs1hvNV : int -> int -> ushort_array -> unit
+      = "glstub_glVertexAttribs1hvNV" "glstub_glVertexAttribs1hvNV"
+    external glVertexAttribs1svNV : int -> int -> short_array -> unit
+      = "glstub_glVertexAttribs1svNV" "glstub_glVertexAttribs1svNV"
+    external glVertexAttribs2fvNV : int -> int -> float_array -> unit
+      = "glstub_glVertexAttribs2fvNV" "glstub_glVertexAttribs2fvNV"
+    external glVertexAttribs2hvNV : int -> int -> ushort_array -> unit
+      = "glstub_glVertexAttribs2hvNV" "glstub_glVertexAttribs2hvNV"
+    external glVertexAttribs2svNV : int -> int -> short_array -> unit
+      = "glstub_glVertexAttribs2svNV" "glstub_glVertexAttribs2svNV"
+    external glVertexAttribs3fvNV : int -> int -> float_array -> unit
+      = "glstub_glVertexAttribs3fvNV" "glstub_glVertexAttribs3fvNV"
+    external glVertexAttribs3hvNV : int -> int -> ushort_array -> unit
+      = "glstub_glVertexAttribs3hvNV" "glstub_glVertexAttribs3hvNV"
+    external glVertexAttribs3svNV : int -> int -> short_array -> unit
+      = "glstub_glVertexAttribs3svNV" "glstub_glVertexAttribs3svNV"
+    external glVertexAttribs4fvNV : int -> int -> float_array -> unit
+      = "glstub_glVertexAttribs4fvNV" "glstub_glVertexAttribs4fvNV"
+    external glVertexAttribs4hvNV : int -> int -> ushort_array -> unit
+      = "glstub_glVertexAttribs4hvNV" "glstub_glVertexAttribs4hvNV"
+    external glVertexAttribs4svNV : int -> int -> short_array -> unit
+      = "glstub_glVertexAttribs4svNV" "glstub_glVertexAttribs4svNV"
+    external glVertexAttribs4ubvNV : int -> int -> ubyte_array -> unit
+      = "glstub_glVertexAttribs4ubvNV" "glstub_glVertexAttribs4ubvNV"
+    external glVertexStream2fvATI : int -> float_array -> unit
+      = "glstub_glVertexStream2fvATI" "glstub_glVertexStream2fvATI"
+    external glVertexStream2ivATI : int -> word_array -> unit
+      = "glstub_glVertexStream2ivATI" "glstub_glVertexStream2ivATI"
+    external glVertexStream2svATI : int -> short_array -> unit
+      = "glstub_glVertexStream2svATI" "glstub_glVertexStream2svATI"
+    external glVertexStream3fvATI : int -> float_array -> unit
+      = "glstub_glVertexStream3fvATI" "glstub_glVertexStream3fvATI"
+    external glVertexStream3ivATI : int -> word_array -> unit
+      = "glstub_glVertexStream3ivATI" "glstub_glVertexStream3ivATI"
+    external glVertexStream3svATI : int -> short_array -> unit
+      = "glstub_glVertexStream3svATI" "glstub_glVertexStream3svATI"
+    external glVertexStream4fvATI : int -> float_array -> unit
+      = "glstub_glVertexStream4fvATI" "glstub_glVertexStream4fvATI"
+    external glVertexStream4ivATI : int -> word_array -> unit
+      = "glstub_glVertexStream4ivATI" "glstub_glVertexStream4ivATI"
+    external glVertexStream4svATI : int -> short_array -> unit
+      = "glstub_glVertexStream4svATI" "glstub_glVertexStream4svATI"
+    external glVertexWeightfvEXT : float_array -> unit
+      = "glstub_glVertexWeightfvEXT" "glstub_glVertexWeightfvEXT"
+    external glVertexWeighthvNV : ushort_array -> unit
+      = "glstub_glVertexWeighthvNV" "glstub_glVertexWeighthvNV"
+    external glWeightbvARB : int -> byte_array -> unit
+      = "glstub_glWeightbvARB" "glstub_glWeightbvARB"
+    external glWeightfvARB : int -> float_array -> unit
+      = "glstub_glWeightfvARB" "glstub_glWeightfvARB"
+    external glWeightivARB : int -> word_array -> unit
+      = "glstub_glWeightivARB" "glstub_glWeightivARB"
+    external glWeightsvARB : int -> short_array -> unit
+      = "glstub_glWeightsvARB" "glstub_glWeightsvARB"
+    external glWeightubvARB : int -> ubyte_array -> unit
+      = "glstub_glWeightubvARB" "glstub_glWeightubvARB"
+    external glWeightuivARB : int -> word_array -> unit
+      = "glstub_glWeightuivARB" "glstub_glWeightuivARB"
+    external glWeightusvARB : int -> ushort_array -> unit
+      = "glstub_glWeightusvARB" "glstub_glWeightusvARB"
+    external glWindowPos2fv : float_array -> unit = "glstub_glWindowPos2fv"
+      "glstub_glWindowPos2fv"
+    external glWindowPos2fvARB : float_array -> unit
+      = "glstub_glWindowPos2fvARB" "glstub_glWindowPos2fvARB"
+    external glWindowPos2fvMESA : float_array -> unit
+      = "glstub_glWindowPos2fvMESA" "glstub_glWindowPos2fvMESA"
+    external glWindowPos2iv : word_array -> unit = "glstub_glWindowPos2iv"
+      "glstub_glWindowPos2iv"
+    external glWindowPos2ivARB : word_array -> unit
+      = "glstub_glWindowPos2ivARB" "glstub_glWindowPos2ivARB"
+    external glWindowPos2ivMESA : word_array -> unit
+      = "glstub_glWindowPos2ivMESA" "glstub_glWindowPos2ivMESA"
+    external glWindowPos2sv : short_array -> unit = "glstub_glWindowPos2sv"
+      "glstub_glWindowPos2sv"
+    external glWindowPos2svARB : short_array -> unit
+      = "glstub_glWindowPos2svARB" "glstub_glWindowPos2svARB"
+    external glWindowPos2svMESA : short_array -> unit
+      = "glstub_glWindowPos2svMESA" "glstub_glWindowPos2svMESA"
+    external glWindowPos3fv : float_array -> unit = "glstub_glWindowPos3fv"
+      "glstub_glWindowPos3fv"
+    external glWindowPos3fvARB : float_array -> unit
+      = "glstub_glWindowPos3fvARB" "glstub_glWindowPos3fvARB"
+    external glWindowPos3fvMESA : float_array -> unit
+      = "glstub_glWindowPos3fvMESA" "glstub_glWindowPos3fvMESA"
+    external glWindowPos3iv : word_array -> unit = "glstub_glWindowPos3iv"
+      "glstub_glWindowPos3iv"
+    external glWindowPos3ivARB : word_array -> unit
+      = "glstub_glWindowPos3ivARB" "glstub_glWindowPos3ivARB"
+    external glWindowPos3ivMESA : word_array -> unit
+      = "glstub_glWindowPos3ivMESA" "glstub_glWindowPos3ivMESA"
+    external glWindowPos3sv : short_array -> unit = "glstub_glWindowPos3sv"
+      "glstub_glWindowPos3sv"
+    external glWindowPos3svARB : short_array -> unit
+      = "glstub_glWindowPos3svARB" "glstub_glWindowPos3svARB"
+    external glWindowPos3svMESA : short_array -> unit
+      = "glstub_glWindowPos3svMESA" "glstub_glWindowPos3svMESA"
+    external glWindowPos4fvMESA : float_array -> unit
+      = "glstub_glWindowPos4fvMESA" "glstub_glWindowPos4fvMESA"
+    external glWindowPos4ivMESA : word_array -> unit
+      = "glstub_glWindowPos4ivMESA" "glstub_glWindowPos4ivMESA"
+    external glWindowPos4svMESA : short_array -> unit
+      = "glstub_glWindowPos4svMESA" "glstub_glWindowPos4svMESA"
+  end
+module Cmdbuf :
+  sig
+    type t = { mutable data : double_array; mutable len : int; }
+    val create : int -> t
+    val clear : t -> unit
+    val length : t -> int
+    val grow : t -> int -> unit
+    val reserve : t -> int -> int
+    external execute' : double_array -> int -> unit = "glstub_cmdbuf_execute"
+    val execute : t -> unit
+    val opcodes : (string * int) array
+    val glAccum : t -> int -> float -> unit
+    val glActiveStencilFaceEXT : t -> int -> unit
+    val glActiveTexture : t -> int -> unit
+    val glActiveTextureARB : t -> int -> unit
+    val glAddSwapHintRectWIN : t -> int -> int -> int -> int -> unit
+    val glAlphaFragmentOp1ATI :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glAlphaFragmentOp2ATI :
+      t ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glAlphaFragmentOp3ATI :
+      t ->
+      int ->
+      int ->
+      int ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glAlphaFunc : t -> int -> float -> unit
+    val glApplyTextureEXT : t -> int -> unit
+    val glArrayElement : t -> int -> unit
+    val glArrayElementEXT : t -> int -> unit
+    val glArrayObjectATI :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glAsyncMarkerSGIX : t -> int -> unit
+    val glAttachObjectARB : t -> int -> int -> unit
+    val glAttachShader : t -> int -> int -> unit
+    val glBegin : t -> int -> unit
+    val glBeginFragmentShaderATI : t -> unit
+    val glBeginOcclusionQueryNV : t -> int -> unit
+    val glBeginQuery : t -> int -> int -> unit
+    val glBeginQueryARB : t -> int -> int -> unit
+    val glBeginSceneEXT : t -> unit
+    val glBeginTransformFeedbackNV : t -> int -> unit
+    val glBeginVertexShaderEXT : t -> unit
+    val glBindBuffer : t -> int -> int -> unit
+    val glBindBufferARB : t -> int -> int -> unit
+    val glBindBufferBase : t -> int -> int -> int -> unit
+    val glBindBufferBaseNV : t -> int -> int -> int -> unit
+    val glBindBufferOffsetNV : t -> int -> int -> int -> int -> unit
+    val glBindBufferRange : t -> int -> int -> int -> int -> int -> unit
+    val glBindBufferRangeNV : t -> int -> int -> int -> int -> int -> unit
+    val glBindFragmentShaderATI : t -> int -> unit
+    val glBindFramebuffer : t -> int -> int -> unit
+    val glBindFramebufferEXT : t -> int -> int -> unit
+    val glBindProgramARB : t -> int -> int -> unit
+    val glBindProgramNV : t -> int -> int -> unit
+    val glBindRenderbuffer : t -> int -> int -> unit
+    val glBindRenderbufferEXT : t -> int -> int -> unit
+    val glBindSampler : t -> int -> int -> unit
+    val glBindTexture : t -> int -> int -> unit
+    val glBindTextureEXT : t -> int -> int -> unit
+    val glBindVertexArray : t -> int -> unit
+    val glBindVertexArrayAPPLE : t -> int -> unit
+    val glBindVertexShaderEXT : t -> int -> unit
+    val glBlendColor : t -> float -> float -> float -> float -> unit
+    val glBlendColorEXT : t -> float -> float -> float -> float -> unit
+    val glBlendEquation : t -> int -> unit
+    val glBlendEquationEXT : t -> int -> unit
+    val glBlendEquationSeparate : t -> int -> int -> unit
+    val glBlendEquationSeparateEXT : t -> int -> int -> unit
+    val glBlendFunc : t -> int -> int -> unit
+    val glBlendFuncSeparate : t -> int -> int -> int -> int -> unit
+    val glBlendFuncSeparateEXT : t -> int -> int -> int -> int -> unit
+    val glBlitFramebuffer :
+      t ->
+      int ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glBlitFramebufferEXT :
+      t ->
+      int ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCallList : t -> int -> unit
+    val glClampColorARB : t -> int -> int -> unit
+    val glClear : t -> int -> unit
+    val glClearAccum : t -> float -> float -> float -> float -> unit
+    val glClearColor : t -> float -> float -> float -> float -> unit
+    val glClearColorIiEXT : t -> int -> int -> int -> int -> unit
+    val glClearColorIuiEXT : t -> int -> int -> int -> int -> unit
+    val glClearDepth : t -> float -> unit
+    val glClearDepthdNV : t -> float -> unit
+    val glClearDepthfOES : t -> float -> unit
+    val glClearIndex : t -> float -> unit
+    val glClearStencil : t -> int -> unit
+    val glClientActiveTexture : t -> int -> unit
+    val glClientActiveTextureARB : t -> int -> unit
+    val glClientActiveVertexStreamATI : t -> int -> unit
+    val glColor3b : t -> int -> int -> int -> unit
+    val glColor3d : t -> float -> float -> float -> unit
+    val glColor3f : t -> float -> float -> float -> unit
+    val glColor3fVertex3fSUN :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glColor3hNV : t -> int -> int -> int -> unit
+    val glColor3i : t -> int -> int -> int -> unit
+    val glColor3s : t -> int -> int -> int -> unit
+    val glColor3ub : t -> int -> int -> int -> unit
+    val glColor3ui : t -> int -> int -> int -> unit
+    val glColor3us : t -> int -> int -> int -> unit
+    val glColor4b : t -> int -> int -> int -> int -> unit
+    val glColor4d : t -> float -> float -> float -> float -> unit
+    val glColor4f : t -> float -> float -> float -> float -> unit
+    val glColor4fNormal3fVertex3fSUN :
+      t ->
+      float ->
+      float ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glColor4hNV : t -> int -> int -> int -> int -> unit
+    val glColor4i : t -> int -> int -> int -> int -> unit
+    val glColor4s : t -> int -> int -> int -> int -> unit
+    val glColor4ub : t -> int -> int -> int -> int -> unit
+    val glColor4ubVertex2fSUN :
+      t -> int -> int -> int -> int -> float -> float -> unit
+    val glColor4ubVertex3fSUN :
+      t -> int -> int -> int -> int -> float -> float -> float -> unit
+    val glColor4ui : t -> int -> int -> int -> int -> unit
+    val glColor4us : t -> int -> int -> int -> int -> unit
+    val glColorFragmentOp1ATI :
+      t -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glColorFragmentOp2ATI :
+      t ->
+      int ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glColorFragmentOp3ATI :
+      t ->
+      int ->
+      int ->
+      int ->
+      int ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glColorMask : t -> bool -> bool -> bool -> bool -> unit
+    val glColorMaskIndexedEXT :
+      t -> int -> bool -> bool -> bool -> bool -> unit
+    val glColorMaterial : t -> int -> int -> unit
+    val glCombinerInputNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glCombinerOutputNV :
+      t ->
+      int ->
+      int -> int -> int -> int -> int -> int -> bool -> bool -> bool -> unit
+    val glCombinerParameterfNV : t -> int -> float -> unit
+    val glCombinerParameteriNV : t -> int -> int -> unit
+    val glCompileShader : t -> int -> unit
+    val glCompileShaderARB : t -> int -> unit
+    val glConvolutionParameterf : t -> int -> int -> float -> unit
+    val glConvolutionParameterfEXT : t -> int -> int -> float -> unit
+    val glConvolutionParameteri : t -> int -> int -> int -> unit
+    val glConvolutionParameteriEXT : t -> int -> int -> int -> unit
+    val glCopyBufferSubData : t -> int -> int -> int -> int -> int -> unit
+    val glCopyColorSubTable : t -> int -> int -> int -> int -> int -> unit
+    val glCopyColorSubTableEXT : t -> int -> int -> int -> int -> int -> unit
+    val glCopyColorTable : t -> int -> int -> int -> int -> int -> unit
+    val glCopyColorTableSGI : t -> int -> int -> int -> int -> int -> unit
+    val glCopyConvolutionFilter1D :
+      t -> int -> int -> int -> int -> int -> unit
+    val glCopyConvolutionFilter1DEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glCopyConvolutionFilter2D :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyConvolutionFilter2DEXT :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyPixels : t -> int -> int -> int -> int -> int -> unit
+    val glCopyTexImage1D :
+      t -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexImage1DEXT :
+      t -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexImage2D :
+      t -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexImage2DEXT :
+      t -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage1D :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage1DEXT :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage2D :
+      t -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage2DEXT :
+      t -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage3D :
+      t ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCopyTexSubImage3DEXT :
+      t ->
+      int -> int -> int -> int -> int -> int -> int -> int -> int -> unit
+    val glCullFace : t -> int -> unit
+    val glCurrentPaletteMatrixARB : t -> int -> unit
+    val glDeleteAsyncMarkersSGIX : t -> int -> int -> unit
+    val glDeleteFragmentShaderATI : t -> int -> unit
+    val glDeleteLists : t -> int -> int -> unit
+    val glDeleteObjectARB : t -> int -> unit
+    val glDeleteProgram : t -> int -> unit
+    val glDeleteShader : t -> int -> unit
+    val glDeleteVertexShaderEXT : t -> int -> unit
+    val glDepthBoundsEXT : t -> float -> float -> unit
+    val glDepthBoundsdNV : t -> float -> float -> unit
+    val glDepthFunc : t -> int -> unit
+    val glDepthMask : t -> bool -> unit
+    val glDepthRange : t -> float -> float -> unit
+    val glDepthRangedNV : t -> float -> float -> unit
+    val glDepthRangefOES : t -> float -> float -> unit
+    val glDetachObjectARB : t -> int -> int -> unit
+    val glDetachShader : t -> int -> int -> unit
+    val glDisable : t -> int -> unit
+    val glDisableClientState : t -> int -> unit
+    val glDisableIndexedEXT : t -> int -> int -> unit
+    val glDisableVariantClientStateEXT : t -> int -> unit
+    val glDisableVertexAttribArray : t -> int -> unit
+    val glDisableVertexAttribArrayARB : t -> int -> unit
+    val glDrawArrays : t -> int -> int -> int -> unit
+    val glDrawArraysEXT : t -> int -> int -> int -> unit
+    val glDrawArraysIndirect : t -> int -> int -> unit
+    val glDrawArraysInstanced : t -> int -> int -> int -> int -> unit
+    val glDrawArraysInstancedBaseInstance :
+      t -> int -> int -> int -> int -> int -> unit
+    val glDrawArraysInstancedEXT : t -> int -> int -> int -> int -> unit
+    val glDrawBuffer : t -> int -> unit
+    val glDrawElementArrayAPPLE : t -> int -> int -> int -> unit
+    val glDrawElementArrayATI : t -> int -> int -> unit
+    val glDrawElementsIndirect : t -> int -> int -> int -> unit
+    val glDrawRangeElementArrayAPPLE :
+      t -> int -> int -> int -> int -> int -> unit
+    val glDrawRangeElementArrayATI : t -> int -> int -> int -> int -> unit
+    val glEdgeFlag : t -> bool -> unit
+    val glEnable : t -> int -> unit
+    val glEnableClientState : t -> int -> unit
+    val glEnableIndexedEXT : t -> int -> int -> unit
+    val glEnableVariantClientStateEXT : t -> int -> unit
+    val glEnableVertexAttribArray : t -> int -> unit
+    val glEnableVertexAttribArrayARB : t -> int -> unit
+    val glEnd : t -> unit
+    val glEndFragmentShaderATI : t -> unit
+    val glEndList : t -> unit
+    val glEndOcclusionQueryNV : t -> unit
+    val glEndQuery : t -> int -> unit
+    val glEndQueryARB : t -> int -> unit
+    val glEndSceneEXT : t -> unit
+    val glEndTransformFeedbackNV : t -> unit
+    val glEndVertexShaderEXT : t -> unit
+    val glEvalCoord1d : t -> float -> unit
+    val glEvalCoord1f : t -> float -> unit
+    val glEvalCoord2d : t -> float -> float -> unit
+    val glEvalCoord2f : t -> float -> float -> unit
+    val glEvalMapsNV : t -> int -> int -> unit
+    val glEvalMesh1 : t -> int -> int -> int -> unit
+    val glEvalMesh2 : t -> int -> int -> int -> int -> int -> unit
+    val glEvalPoint1 : t -> int -> unit
+    val glEvalPoint2 : t -> int -> int -> unit
+    val glExtractComponentEXT : t -> int -> int -> int -> unit
+    val glFinalCombinerInputNV : t -> int -> int -> int -> int -> unit
+    val glFinish : t -> unit
+    val glFinishFenceAPPLE : t -> int -> unit
+    val glFinishFenceNV : t -> int -> unit
+    val glFinishObjectAPPLE : t -> int -> int -> unit
+    val glFinishTextureSUNX : t -> unit
+    val glFlush : t -> unit
+    val glFlushMappedBufferRange : t -> int -> int -> int -> unit
+    val glFlushPixelDataRangeNV : t -> int -> unit
+    val glFlushRasterSGIX : t -> unit
+    val glFlushVertexArrayRangeNV : t -> unit
+    val glFogCoordd : t -> float -> unit
+    val glFogCoorddEXT : t -> float -> unit
+    val glFogCoordf : t -> float -> unit
+    val glFogCoordfEXT : t -> float -> unit
+    val glFogCoordhNV : t -> int -> unit
+    val glFogf : t -> int -> float -> unit
+    val glFogi : t -> int -> int -> unit
+    val glFragmentColorMaterialEXT : t -> int -> int -> unit
+    val glFragmentColorMaterialSGIX : t -> int -> int -> unit
+    val glFragmentLightModelfEXT : t -> int -> float -> unit
+    val glFragmentLightModelfSGIX : t -> int -> float -> unit
+    val glFragmentLightModeliEXT : t -> int -> int -> unit
+    val glFragmentLightModeliSGIX : t -> int -> int -> unit
+    val glFragmentLightfEXT : t -> int -> int -> float -> unit
+    val glFragmentLightfSGIX : t -> int -> int -> float -> unit
+    val glFragmentLightiEXT : t -> int -> int -> int -> unit
+    val glFragmentLightiSGIX : t -> int -> int -> int -> unit
+    val glFragmentMaterialfEXT : t -> int -> int -> float -> unit
+    val glFragmentMaterialfSGIX : t -> int -> int -> float -> unit
+    val glFragmentMaterialiEXT : t -> int -> int -> int -> unit
+    val glFragmentMaterialiSGIX : t -> int -> int -> int -> unit
+    val glFrameZoomSGIX : t -> int -> unit
+    val glFramebufferRenderbuffer : t -> int -> int -> int -> int -> unit
+    val glFramebufferRenderbufferEXT : t -> int -> int -> int -> int -> unit
+    val glFramebufferTexture1DEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glFramebufferTexture2D : t -> int -> int -> int -> int -> int -> unit
+    val glFramebufferTexture2DEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glFramebufferTexture3DEXT :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glFramebufferTextureEXT : t -> int -> int -> int -> int -> unit
+    val glFramebufferTextureFaceEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glFramebufferTextureLayerEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glFreeObjectBufferATI : t -> int -> unit
+    val glFrontFace : t -> int -> unit
+    val glFrustum :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glFrustumfOES :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glGenerateMipmap : t -> int -> unit
+    val glGenerateMipmapEXT : t -> int -> unit
+    val glGlobalAlphaFactorbSUN : t -> int -> unit
+    val glGlobalAlphaFactordSUN : t -> float -> unit
+    val glGlobalAlphaFactorfSUN : t -> float -> unit
+    val glGlobalAlphaFactoriSUN : t -> int -> unit
+    val glGlobalAlphaFactorsSUN : t -> int -> unit
+    val glGlobalAlphaFactorubSUN : t -> int -> unit
+    val glGlobalAlphaFactoruiSUN : t -> int -> unit
+    val glGlobalAlphaFactorusSUN : t -> int -> unit
+    val glHint : t -> int -> int -> unit
+    val glHistogram : t -> int -> int -> int -> bool -> unit
+    val glHistogramEXT : t -> int -> int -> int -> bool -> unit
+    val glImageTransformParameterfHP : t -> int -> int -> float -> unit
+    val glImageTransformParameteriHP : t -> int -> int -> int -> unit
+    val glIndexFuncEXT : t -> int -> float -> unit
+    val glIndexMask : t -> int -> unit
+    val glIndexMaterialEXT : t -> int -> int -> unit
+    val glIndexd : t -> float -> unit
+    val glIndexf : t -> float -> unit
+    val glIndexi : t -> int -> unit
+    val glIndexs : t -> int -> unit
+    val glIndexub : t -> int -> unit
+    val glInitNames : t -> unit
+    val glInsertComponentEXT : t -> int -> int -> int -> unit
+    val glLightEnviEXT : t -> int -> int -> unit
+    val glLightModelf : t -> int -> float -> unit
+    val glLightModeli : t -> int -> int -> unit
+    val glLightf : t -> int -> int -> float -> unit
+    val glLighti : t -> int -> int -> int -> unit
+    val glLineStipple : t -> int -> int -> unit
+    val glLineWidth : t -> float -> unit
+    val glLinkProgram : t -> int -> unit
+    val glLinkProgramARB : t -> int -> unit
+    val glListBase : t -> int -> unit
+    val glLoadIdentity : t -> unit
+    val glLoadName : t -> int -> unit
+    val glLockArraysEXT : t -> int -> int -> unit
+    val glLogicOp : t -> int -> unit
+    val glMapGrid1d : t -> int -> float -> float -> unit
+    val glMapGrid1f : t -> int -> float -> float -> unit
+    val glMapGrid2d :
+      t -> int -> float -> float -> int -> float -> float -> unit
+    val glMapGrid2f :
+      t -> int -> float -> float -> int -> float -> float -> unit
+    val glMaterialf : t -> int -> int -> float -> unit
+    val glMateriali : t -> int -> int -> int -> unit
+    val glMatrixMode : t -> int -> unit
+    val glMaxShaderCompilerThreadsARB : t -> int -> unit
+    val glMaxShaderCompilerThreadsKHR : t -> int -> unit
+    val glMinmax : t -> int -> int -> bool -> unit
+    val glMinmaxEXT : t -> int -> int -> bool -> unit
+    val glMultiDrawArraysIndirect : t -> int -> int -> int -> int -> unit
+    val glMultiDrawElementsIndirect :
+      t -> int -> int -> int -> int -> int -> unit
+    val glMultiTexCoord1d : t -> int -> float -> unit
+    val glMultiTexCoord1dARB : t -> int -> float -> unit
+    val glMultiTexCoord1f : t -> int -> float -> unit
+    val glMultiTexCoord1fARB : t -> int -> float -> unit
+    val glMultiTexCoord1hNV : t -> int -> int -> unit
+    val glMultiTexCoord1i : t -> int -> int -> unit
+    val glMultiTexCoord1iARB : t -> int -> int -> unit
+    val glMultiTexCoord1s : t -> int -> int -> unit
+    val glMultiTexCoord1sARB : t -> int -> int -> unit
+    val glMultiTexCoord2d : t -> int -> float -> float -> unit
+    val glMultiTexCoord2dARB : t -> int -> float -> float -> unit
+    val glMultiTexCoord2f : t -> int -> float -> float -> unit
+    val glMultiTexCoord2fARB : t -> int -> float -> float -> unit
+    val glMultiTexCoord2hNV : t -> int -> int -> int -> unit
+    val glMultiTexCoord2i : t -> int -> int -> int -> unit
+    val glMultiTexCoord2iARB : t -> int -> int -> int -> unit
+    val glMultiTexCoord2s : t -> int -> int -> int -> unit
+    val glMultiTexCoord2sARB : t -> int -> int -> int -> unit
+    val glMultiTexCoord3d : t -> int -> float -> float -> float -> unit
+    val glMultiTexCoord3dARB : t -> int -> float -> float -> float -> unit
+    val glMultiTexCoord3f : t -> int -> float -> float -> float -> unit
+    val glMultiTexCoord3fARB : t -> int -> float -> float -> float -> unit
+    val glMultiTexCoord3hNV : t -> int -> int -> int -> int -> unit
+    val glMultiTexCoord3i : t -> int -> int -> int -> int -> unit
+    val glMultiTexCoord3iARB : t -> int -> int -> int -> int -> unit
+    val glMultiTexCoord3s : t -> int -> int -> int -> int -> unit
+    val glMultiTexCoord3sARB : t -> int -> int -> int -> int -> unit
+    val glMultiTexCoord4d :
+      t -> int -> float -> float -> float -> float -> unit
+    val glMultiTexCoord4dARB :
+      t -> int -> float -> float -> float -> float -> unit
+    val glMultiTexCoord4f :
+      t -> int -> float -> float -> float -> float -> unit
+    val glMultiTexCoord4fARB :
+      t -> int -> float -> float -> float -> float -> unit
+    val glMultiTexCoord4hNV : t -> int -> int -> int -> int -> int -> unit
+    val glMultiTexCoord4i : t -> int -> int -> int -> int -> int -> unit
+    val glMultiTexCoord4iARB : t -> int -> int -> int -> int -> int -> unit
+    val glMultiTexCoord4s : t -> int -> int -> int -> int -> int -> unit
+    val glMultiTexCoord4sARB : t -> int -> int -> int -> int -> int -> unit
+    val glNewList : t -> int -> int -> unit
+    val glNormal3b : t -> int -> int -> int -> unit
+    val glNormal3d : t -> float -> float -> float -> unit
+    val glNormal3f : t -> float -> float -> float -> unit
+    val glNormal3fVertex3fSUN :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glNormal3hNV : t -> int -> int -> int -> unit
+    val glNormal3i : t -> int -> int -> int -> unit
+    val glNormal3s : t -> int -> int -> int -> unit
+    val glNormalStream3bATI : t -> int -> int -> int -> int -> unit
+    val glNormalStream3dATI : t -> int -> float -> float -> float -> unit
+    val glNormalStream3fATI : t -> int -> float -> float -> float -> unit
+    val glNormalStream3iATI : t -> int -> int -> int -> int -> unit
+    val glNormalStream3sATI : t -> int -> int -> int -> int -> unit
+    val glOrtho :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glOrthofOES :
+      t -> float -> float -> float -> float -> float -> float -> unit
+    val glPNTrianglesfATI : t -> int -> float -> unit
+    val glPNTrianglesiATI : t -> int -> int -> unit
+    val glPassTexCoordATI : t -> int -> int -> int -> unit
+    val glPassThrough : t -> float -> unit
+    val glPixelStoref : t -> int -> float -> unit
+    val glPixelStorei : t -> int -> int -> unit
+    val glPixelTexGenSGIX : t -> int -> unit
+    val glPixelTransferf : t -> int -> float -> unit
+    val glPixelTransferi : t -> int -> int -> unit
+    val glPixelTransformParameterfEXT : t -> int -> int -> float -> unit
+    val glPixelTransformParameteriEXT : t -> int -> int -> int -> unit
+    val glPixelZoom : t -> float -> float -> unit
+    val glPointParameterf : t -> int -> float -> unit
+    val glPointParameterfARB : t -> int -> float -> unit
+    val glPointParameterfEXT : t -> int -> float -> unit
+    val glPointParameteriNV : t -> int -> int -> unit
+    val glPointSize : t -> float -> unit
+    val glPolygonMode : t -> int -> int -> unit
+    val glPolygonOffset : t -> float -> float -> unit
+    val glPolygonOffsetEXT : t -> float -> float -> unit
+    val glPopAttrib : t -> unit
+    val glPopClientAttrib : t -> unit
+    val glPopMatrix : t -> unit
+    val glPopName : t -> unit
+    val glPrimitiveRestartIndex : t -> int -> unit
+    val glPrimitiveRestartIndexNV : t -> int -> unit
+    val glPrimitiveRestartNV : t -> unit
+    val glProgramEnvParameter4dARB :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramEnvParameter4fARB :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramEnvParameterI4iNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glProgramEnvParameterI4uiNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glProgramLocalParameter4dARB :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramLocalParameter4fARB :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramLocalParameterI4iNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glProgramLocalParameterI4uiNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glProgramParameter4dNV :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramParameter4fNV :
+      t -> int -> int -> float -> float -> float -> float -> unit
+    val glProgramParameteri : t -> int -> int -> int -> unit
+    val glProgramParameteriEXT : t -> int -> int -> int -> unit
+    val glProgramVertexLimitNV : t -> int -> int -> unit
+    val glPushAttrib : t -> int -> unit
+    val glPushClientAttrib : t -> int -> unit
+    val glPushMatrix : t -> unit
+    val glPushName : t -> int -> unit
+    val glQueryCounter : t -> int -> int -> unit
+    val glRasterPos2d : t -> float -> float -> unit
+    val glRasterPos2f : t -> float -> float -> unit
+    val glRasterPos2i : t -> int -> int -> unit
+    val glRasterPos2s : t -> int -> int -> unit
+    val glRasterPos3d : t -> float -> float -> float -> unit
+    val glRasterPos3f : t -> float -> float -> float -> unit
+    val glRasterPos3i : t -> int -> int -> int -> unit
+    val glRasterPos3s : t -> int -> int -> int -> unit
+    val glRasterPos4d : t -> float -> float -> float -> float -> unit
+    val glRasterPos4f : t -> float -> float -> float -> float -> unit
+    val glRasterPos4i : t -> int -> int -> int -> int -> unit
+    val glRasterPos4s : t -> int -> int -> int -> int -> unit
+    val glReadBuffer : t -> int -> unit
+    val glRectd : t -> float -> float -> float -> float -> unit
+    val glRectf : t -> float -> float -> float -> float -> unit
+    val glRecti : t -> int -> int -> int -> int -> unit
+    val glRects : t -> int -> int -> int -> int -> unit
+    val glRenderbufferStorage : t -> int -> int -> int -> int -> unit
+    val glRenderbufferStorageEXT : t -> int -> int -> int -> int -> unit
+    val glRenderbufferStorageMultisample :
+      t -> int -> int -> int -> int -> int -> unit
+    val glRenderbufferStorageMultisampleCoverageNV :
+      t -> int -> int -> int -> int -> int -> int -> unit
+    val glRenderbufferStorageMultisampleEXT :
+      t -> int -> int -> int -> int -> int -> unit
+    val glReplacementCodeubSUN : t -> int -> unit
+    val glReplacementCodeuiColor3fVertex3fSUN :
+      t -> int -> float -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiColor4fNormal3fVertex3fSUN :
+      t ->
+      int ->
+      float ->
+      float ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiColor4ubVertex3fSUN :
+      t -> int -> int -> int -> int -> int -> float -> float -> float -> unit
+    val glReplacementCodeuiNormal3fVertex3fSUN :
+      t -> int -> float -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiSUN : t -> int -> unit
+    val glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN :
+      t ->
+      int ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN :
+      t ->
+      int ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiTexCoord2fVertex3fSUN :
+      t -> int -> float -> float -> float -> float -> float -> unit
+    val glReplacementCodeuiVertex3fSUN :
+      t -> int -> float -> float -> float -> unit
+    val glReplacementCodeusSUN : t -> int -> unit
+    val glResetHistogram : t -> int -> unit
+    val glResetHistogramEXT : t -> int -> unit
+    val glResetMinmax : t -> int -> unit
+    val glResetMinmaxEXT : t -> int -> unit
+    val glResizeBuffersMESA : t -> unit
+    val glRotated : t -> float -> float -> float -> float -> unit
+    val glRotatef : t -> float -> float -> float -> float -> unit
+    val glSampleCoverage : t -> float -> bool -> unit
+    val glSampleCoverageARB : t -> float -> bool -> unit
+    val glSampleMapATI : t -> int -> int -> int -> unit
+    val glSampleMaskEXT : t -> float -> bool -> unit
+    val glSampleMaskSGIS : t -> float -> bool -> unit
+    val glSamplePatternEXT : t -> int -> unit
+    val glSamplePatternSGIS : t -> int -> unit
+    val glSamplerParameterf : t -> int -> int -> float -> unit
+    val glSamplerParameteri : t -> int -> int -> int -> unit
+    val glScaled : t -> float -> float -> float -> unit
+    val glScalef : t -> float -> float -> float -> unit
+    val glScissor : t -> int -> int -> int -> int -> unit
+    val glSecondaryColor3b : t -> int -> int -> int -> unit
+    val glSecondaryColor3bEXT : t -> int -> int -> int -> unit
+    val glSecondaryColor3d : t -> float -> float -> float -> unit
+    val glSecondaryColor3dEXT : t -> float -> float -> float -> unit
+    val glSecondaryColor3f : t -> float -> float -> float -> unit
+    val glSecondaryColor3fEXT : t -> float -> float -> float -> unit
+    val glSecondaryColor3hNV : t -> int -> int -> int -> unit
+    val glSecondaryColor3i : t -> int -> int -> int -> unit
+    val glSecondaryColor3iEXT : t -> int -> int -> int -> unit
+    val glSecondaryColor3s : t -> int -> int -> int -> unit
+    val glSecondaryColor3sEXT : t -> int -> int -> int -> unit
+    val glSecondaryColor3ub : t -> int -> int -> int -> unit
+    val glSecondaryColor3ubEXT : t -> int -> int -> int -> unit
+    val glSecondaryColor3ui : t -> int -> int -> int -> unit
+    val glSecondaryColor3uiEXT : t -> int -> int -> int -> unit
+    val glSecondaryColor3us : t -> int -> int -> int -> unit
+    val glSecondaryColor3usEXT : t -> int -> int -> int -> unit
+    val glSetFenceAPPLE : t -> int -> unit
+    val glSetFenceNV : t -> int -> int -> unit
+    val glShadeModel : t -> int -> unit
+    val glShaderOp1EXT : t -> int -> int -> int -> unit
+    val glShaderOp2EXT : t -> int -> int -> int -> int -> unit
+    val glShaderOp3EXT : t -> int -> int -> int -> int -> int -> unit
+    val glSpriteParameterfSGIX : t -> int -> float -> unit
+    val glSpriteParameteriSGIX : t -> int -> int -> unit
+    val glStencilFunc : t -> int -> int -> int -> unit
+    val glStencilFuncSeparate : t -> int -> int -> int -> int -> unit
+    val glStencilFuncSeparateATI : t -> int -> int -> int -> int -> unit
+    val glStencilMask : t -> int -> unit
+    val glStencilMaskSeparate : t -> int -> int -> unit
+    val glStencilOp : t -> int -> int -> int -> unit
+    val glStencilOpSeparate : t -> int -> int -> int -> int -> unit
+    val glStencilOpSeparateATI : t -> int -> int -> int -> int -> unit
+    val glSwizzleEXT : t -> int -> int -> int -> int -> int -> int -> unit
+    val glTagSampleBufferSGIX : t -> unit
+    val glTbufferMask3DFX : t -> int -> unit
+    val glTexBuffer : t -> int -> int -> int -> unit
+    val glTexBufferEXT : t -> int -> int -> int -> unit
+    val glTexCoord1d : t -> float -> unit
+    val glTexCoord1f : t -> float -> unit
+    val glTexCoord1hNV : t -> int -> unit
+    val glTexCoord1i : t -> int -> unit
+    val glTexCoord1s : t -> int -> unit
+    val glTexCoord2d : t -> float -> float -> unit
+    val glTexCoord2f : t -> float -> float -> unit
+    val glTexCoord2fColor3fVertex3fSUN :
+      t ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glTexCoord2fColor4fNormal3fVertex3fSUN :
+      t ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glTexCoord2fColor4ubVertex3fSUN :
+      t ->
+      float ->
+      float -> int -> int -> int -> int -> float -> float -> float -> unit
+    val glTexCoord2fNormal3fVertex3fSUN :
+      t ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glTexCoord2fVertex3fSUN :
+      t -> float -> float -> float -> float -> float -> unit
+    val glTexCoord2hNV : t -> int -> int -> unit
+    val glTexCoord2i : t -> int -> int -> unit
+    val glTexCoord2s : t -> int -> int -> unit
+    val glTexCoord3d : t -> float -> float -> float -> unit
+    val glTexCoord3f : t -> float -> float -> float -> unit
+    val glTexCoord3hNV : t -> int -> int -> int -> unit
+    val glTexCoord3i : t -> int -> int -> int -> unit
+    val glTexCoord3s : t -> int -> int -> int -> unit
+    val glTexCoord4d : t -> float -> float -> float -> float -> unit
+    val glTexCoord4f : t -> float -> float -> float -> float -> unit
+    val glTexCoord4fColor4fNormal3fVertex4fSUN :
+      t ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glTexCoord4fVertex4fSUN :
+      t ->
+      float ->
+      float -> float -> float -> float -> float -> float -> float -> unit
+    val glTexCoord4hNV : t -> int -> int -> int -> int -> unit
+    val glTexCoord4i : t -> int -> int -> int -> int -> unit
+    val glTexCoord4s : t -> int -> int -> int -> int -> unit
+    val glTexEnvf : t -> int -> int -> float -> unit
+    val glTexEnvi : t -> int -> int -> int -> unit
+    val glTexGend : t -> int -> int -> float -> unit
+    val glTexGenf : t -> int -> int -> float -> unit
+    val glTexGeni : t -> int -> int -> int -> unit
+    val glTexParameterf : t -> int -> int -> float -> unit
+    val glTexParameteri : t -> int -> int -> int -> unit
+    val glTexScissorFuncINTEL : t -> int -> int -> int -> unit
+    val glTexScissorINTEL : t -> int -> float -> float -> unit
+    val glTexStorage2D : t -> int -> int -> int -> int -> int -> unit
+    val glTextureFogSGIX : t -> int -> unit
+    val glTextureLightEXT : t -> int -> unit
+    val glTextureMaterialEXT : t -> int -> int -> unit
+    val glTextureNormalEXT : t -> int -> unit
+    val glTrackMatrixNV : t -> int -> int -> int -> int -> unit
+    val glTranslated : t -> float -> float -> float -> unit
+    val glTranslatef : t -> float -> float -> float -> unit
+    val glUniform1f : t -> int -> float -> unit
+    val glUniform1fARB : t -> int -> float -> unit
+    val glUniform1i : t -> int -> int -> unit
+    val glUniform1iARB : t -> int -> int -> unit
+    val glUniform1uiEXT : t -> int -> int -> unit
+    val glUniform2f : t -> int -> float -> float -> unit
+    val glUniform2fARB : t -> int -> float -> float -> unit
+    val glUniform2i : t -> int -> int -> int -> unit
+    val glUniform2iARB : t -> int -> int -> int -> unit
+    val glUniform2uiEXT : t -> int -> int -> int -> unit
+    val glUniform3f : t -> int -> float -> float -> float -> unit
+    val glUniform3fARB : t -> int -> float -> float -> float -> unit
+    val glUniform3i : t -> int -> int -> int -> int -> unit
+    val glUniform3iARB : t -> int -> int -> int -> int -> unit
+    val glUniform3uiEXT : t -> int -> int -> int -> int -> unit
+    val glUniform4f : t -> int -> float -> float -> float -> float -> unit
+    val glUniform4fARB : t -> int -> float -> float -> float -> float -> unit
+    val glUniform4i : t -> int -> int -> int -> int -> int -> unit
+    val glUniform4iARB : t -> int -> int -> int -> int -> int -> unit
+    val glUniform4uiEXT : t -> int -> int -> int -> int -> int -> unit
+    val glUniformBlockBinding : t -> int -> int -> int -> unit
+    val glUniformBufferEXT : t -> int -> int -> int -> unit
+    val glUnlockArraysEXT : t -> unit
+    val glUnmapObjectBufferATI : t -> int -> unit
+    val glUseProgram : t -> int -> unit
+    val glUseProgramObjectARB : t -> int -> unit
+    val glValidateProgram : t -> int -> unit
+    val glValidateProgramARB : t -> int -> unit
+    val glVariantArrayObjectATI :
+      t -> int -> int -> int -> int -> int -> unit
+    val glVertex2d : t -> float -> float -> unit
+    val glVertex2f : t -> float -> float -> unit
+    val glVertex2hNV : t -> int -> int -> unit
+    val glVertex2i : t -> int -> int -> unit
+    val glVertex2s : t -> int -> int -> unit
+    val glVertex3d : t -> float -> float -> float -> unit
+    val glVertex3f : t -> float -> float -> float -> unit
+    val glVertex3hNV : t -> int -> int -> int -> unit
+    val glVertex3i : t -> int -> int -> int -> unit
+    val glVertex3s : t -> int -> int -> int -> unit
+    val glVertex4d : t -> float -> float -> float -> float -> unit
+    val glVertex4f : t -> float -> float -> float -> float -> unit
+    val glVertex4hNV : t -> int -> int -> int -> int -> unit
+    val glVertex4i : t -> int -> int -> int -> int -> unit
+    val glVertex4s : t -> int -> int -> int -> int -> unit
+    val glVertexArrayParameteriAPPLE : t -> int -> int -> unit
+    val glVertexAttrib1d : t -> int -> float -> unit
+    val glVertexAttrib1dARB : t -> int -> float -> unit
+    val glVertexAttrib1dNV : t -> int -> float -> unit
+    val glVertexAttrib1f : t -> int -> float -> unit
+    val glVertexAttrib1fARB : t -> int -> float -> unit
+    val glVertexAttrib1fNV : t -> int -> float -> unit
+    val glVertexAttrib1hNV : t -> int -> int -> unit
+    val glVertexAttrib1s : t -> int -> int -> unit
+    val glVertexAttrib1sARB : t -> int -> int -> unit
+    val glVertexAttrib1sNV : t -> int -> int -> unit
+    val glVertexAttrib2d : t -> int -> float -> float -> unit
+    val glVertexAttrib2dARB : t -> int -> float -> float -> unit
+    val glVertexAttrib2dNV : t -> int -> float -> float -> unit
+    val glVertexAttrib2f : t -> int -> float -> float -> unit
+    val glVertexAttrib2fARB : t -> int -> float -> float -> unit
+    val glVertexAttrib2fNV : t -> int -> float -> float -> unit
+    val glVertexAttrib2hNV : t -> int -> int -> int -> unit
+    val glVertexAttrib2s : t -> int -> int -> int -> unit
+    val glVertexAttrib2sARB : t -> int -> int -> int -> unit
+    val glVertexAttrib2sNV : t -> int -> int -> int -> unit
+    val glVertexAttrib3d : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3dARB : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3dNV : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3f : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3fARB : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3fNV : t -> int -> float -> float -> float -> unit
+    val glVertexAttrib3hNV : t -> int -> int -> int -> int -> unit
+    val glVertexAttrib3s : t -> int -> int -> int -> int -> unit
+    val glVertexAttrib3sARB : t -> int -> int -> int -> int -> unit
+    val glVertexAttrib3sNV : t -> int -> int -> int -> int -> unit
+    val glVertexAttrib4Nub : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4NubARB : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4d :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4dARB :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4dNV :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4f :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4fARB :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4fNV :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexAttrib4hNV : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4s : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4sARB : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4sNV : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttrib4ubNV : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttribArrayObjectATI :
+      t -> int -> int -> int -> bool -> int -> int -> int -> unit
+    val glVertexAttribDivisor : t -> int -> int -> unit
+    val glVertexAttribI1iEXT : t -> int -> int -> unit
+    val glVertexAttribI1uiEXT : t -> int -> int -> unit
+    val glVertexAttribI2iEXT : t -> int -> int -> int -> unit
+    val glVertexAttribI2uiEXT : t -> int -> int -> int -> unit
+    val glVertexAttribI3iEXT : t -> int -> int -> int -> int -> unit
+    val glVertexAttribI3uiEXT : t -> int -> int -> int -> int -> unit
+    val glVertexAttribI4iEXT : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttribI4uiEXT : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttribIPointer : t -> int -> int -> int -> int -> int -> unit
+    val glVertexAttribPointer :
+      t -> int -> int -> int -> bool -> int -> int -> unit
+    val glVertexBlendARB : t -> int -> unit
+    val glVertexBlendEnvfATI : t -> int -> float -> unit
+    val glVertexBlendEnviATI : t -> int -> int -> unit
+    val glVertexStream2dATI : t -> int -> float -> float -> unit
+    val glVertexStream2fATI : t -> int -> float -> float -> unit
+    val glVertexStream2iATI : t -> int -> int -> int -> unit
+    val glVertexStream2sATI : t -> int -> int -> int -> unit
+    val glVertexStream3dATI : t -> int -> float -> float -> float -> unit
+    val glVertexStream3fATI : t -> int -> float -> float -> float -> unit
+    val glVertexStream3iATI : t -> int -> int -> int -> int -> unit
+    val glVertexStream3sATI : t -> int -> int -> int -> int -> unit
+    val glVertexStream4dATI :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexStream4fATI :
+      t -> int -> float -> float -> float -> float -> unit
+    val glVertexStream4iATI : t -> int -> int -> int -> int -> int -> unit
+    val glVertexStream4sATI : t -> int -> int -> int -> int -> int -> unit
+    val glVertexWeightfEXT : t -> float -> unit
+    val glVertexWeighthNV : t -> int -> unit
+    val glViewport : t -> int -> int -> int -> int -> unit
+    val glWindowPos2d : t -> float -> float -> unit
+    val glWindowPos2dARB : t -> float -> float -> unit
+    val glWindowPos2dMESA : t -> float -> float -> unit
+    val glWindowPos2f : t -> float -> float -> unit
+    val glWindowPos2fARB : t -> float -> float -> unit
+    val glWindowPos2fMESA : t -> float -> float -> unit
+    val glWindowPos2i : t -> int -> int -> unit
+    val glWindowPos2iARB : t -> int -> int -> unit
+    val glWindowPos2iMESA : t -> int -> int -> unit
+    val glWindowPos2s : t -> int -> int -> unit
+    val glWindowPos2sARB : t -> int -> int -> unit
+    val glWindowPos2sMESA : t -> int -> int -> unit
+    val glWindowPos3d : t -> float -> float -> float -> unit
+    val glWindowPos3dARB : t -> float -> float -> float -> unit
+    val glWindowPos3dMESA : t -> float -> float -> float -> unit
+    val glWindowPos3f : t -> float -> float -> float -> unit
+    val glWindowPos3fARB : t -> float -> float -> float -> unit
+    val glWindowPos3fMESA : t -> float -> float -> float -> unit
+    val glWindowPos3i : t -> int -> int -> int -> unit
+    val glWindowPos3iARB : t -> int -> int -> int -> unit
+    val glWindowPos3iMESA : t -> int -> int -> int -> unit
+    val glWindowPos3s : t -> int -> int -> int -> unit
+    val glWindowPos3sARB : t -> int -> int -> int -> unit
+    val glWindowPos3sMESA : t -> int -> int -> int -> unit
+    val glWindowPos4dMESA : t -> float -> float -> float -> float -> unit
+    val glWindowPos4fMESA : t -> float -> float -> float -> float -> unit
+    val glWindowPos4iMESA : t -> int -> int -> int -> int -> unit
+    val glWindowPos4sMESA : t -> int -> int -> int -> int -> unit
+    val glWriteMaskEXT : t -> int -> int -> int -> int -> int -> int -> unit
+  end
+external monotonic_clock : unit -> float = "glstub_monotonic_clock"
+val gl_major_version : unit -> int
+val has_extension : string -> bool
+val status : ('a -> 'b -> int array -> 'c) -> 'a -> 'b -> bool
+val info_log :
+  ('a -> int -> int array -> 'b) ->
+  ('a -> int -> int array -> string -> 'c) -> 'a -> string
+module Cached :
+  sig
+    type state = {
+      mutable active_texture : int;
+      mutable program : int;
+      mutable vertex_array : int;
+      mutable blend_src : int;
+      mutable blend_dst : int;
+      textures : (int, int) Hashtbl.t;
+      buffers : (int, int) Hashtbl.t;
+      capabilities : (int, int) Hashtbl.t;
+      mutable issued : int;
+      mutable elided : int;
+    }
+    val create : unit -> state
+    val current : state ref
+    val make_current : state -> unit
+    val get_current : unit -> state
+    val invalidate : unit -> unit
+    val issued : unit -> int
+    val elided : unit -> int
+    val reset_counters : unit -> unit
+    val find : ('a, int) Hashtbl.t -> 'a -> int
+    val change : state -> int -> int -> (int -> 'a) -> (unit -> unit) -> unit
+    val active_unit : state -> int
+    val unit_key : state -> int -> int
+    val is_texture_capability : int -> bool
+    val capability_key : state -> int -> int
+    val unbind : ('a, int) Hashtbl.t -> int array -> unit
+    val glActiveTexture : int -> unit
+    val glBindTexture : int -> int -> unit
+    val glBindBuffer : int -> int -> unit
+    val glBindVertexArray : int -> unit
+    val glUseProgram : int -> unit
+    val set_capability : int -> int -> (int -> unit) -> unit
+    val glEnable : int -> unit
+    val glDisable : int -> unit
+    val glBlendFunc : int -> int -> unit
+    val glBlendFuncSeparate : int -> int -> int -> int -> unit
+    val glDeleteTextures : int -> int array -> unit
+    val glDeleteBuffers : int -> int array -> unit
+    val glDeleteVertexArrays : int -> int array -> unit
+    val glDeleteProgram : int -> unit
+    val glPopAttrib : unit -> unit
+    val glPopClientAttrib : unit -> unit
+  end
+module Mapped :
+  sig
+    external map_buffer :
+      int ->
+      int ->
+      ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+      = "glstub_map_buffer"
+    external map_buffer_range :
+      int ->
+      int ->
+      int ->
+      int ->
+      ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+      = "glstub_map_buffer_range"
+    external unmap_view : ('a, 'b, 'c) Bigarray.Array1.t -> unit
+      = "glstub_unmap_view"
+    val views : (int, unit -> unit) Hashtbl.t
+    val bindings : (int * int) list
+    val buffer : int -> int
+    val track :
+      int -> ('a, 'b, 'c) Bigarray.Array1.t -> ('a, 'b, 'c) Bigarray.Array1.t
+    val glMapBuffer :
+      int ->
+      int ->
+      ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+    val glMapBufferRange :
+      int ->
+      int ->
+      int ->
+      int ->
+      ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+    val glUnmapBuffer : int -> bool
+  end
+module Arena :
+  sig
+    type t = {
+      mutable chunks : ubyte_array list;
+      mutable retired : ubyte_array list;
+      mutable used : int;
+    }
+    external alloc_chunk : int -> ubyte_array = "glstub_arena_alloc"
+    external free_chunk : ubyte_array -> unit = "glstub_arena_free"
+    external slice :
+      ubyte_array ->
+      int ->
+      int ->
+      ('a, 'b) Bigarray.kind -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+      = "glstub_arena_slice"
+    val alignment : int
+    val destroy : t -> unit
+    val create : int -> t
+    val alloc :
+      t ->
+      ('a, 'b) Bigarray.kind ->
+      int -> ('a, 'b, Bigarray.c_layout) Bigarray.Array1.t
+    val reset : t -> unit
+    val used : t -> int
+    val capacity : t -> int
+  end
+module Readback :
+  sig
+    type ticket = {
+      slot : int;
+      serial : int;
+      frame : int;
+      rows : int;
+      row_bytes : int;
+    }
+    type t = {
+      buffers : int array;
+      sizes : int array;
+      serials : int array;
+      latency : int;
+      mutable next : int;
+      mutable frames : int;
+    }
+    external copy_rows :
+      ubyte_array -> ubyte_array -> int -> int -> int -> bool -> unit
+      = "glstub_copy_rows_byte" "glstub_copy_rows"
+    val create : ?slots:int -> ?latency:int -> unit -> t
+    val destroy : t -> unit
+    val pixel_size : int -> int -> int
+    val read : t -> int -> int -> int -> int -> int -> int -> ticket
+    val end_frame : t -> unit
+    val ready : t -> ticket -> bool
+    val valid : t -> ticket -> bool
+    val size : ticket -> int
+    val with_mapping :
+      t ->
+      ticket ->
+      ((int, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t ->
+       'a) ->
+      unit
+    val fetch : t -> ticket -> ubyte_array -> unit
+    val get :
+      t ->
+      ticket ->
+      (int, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t
+    val fetch_rows : t -> ticket -> ubyte_array -> int -> unit
+  end
+module Texture_stream :
+  sig
+    type t = {
+      texture : int;
+      target : int;
+      width : int;
+      height : int;
+      format : int;
+      typ : int;
+      bytes : int;
+      buffers : int array;
+      mutable next : int;
+      mutable mapped : bool;
+    }
+    val create :
+      ?slots:int -> ?target:int -> int -> int -> int -> int -> int -> t
+    val destroy : t -> unit
+    val begin_update :
+      t ->
+      (int, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t
+    val end_update : t -> unit
+    val cancel_update : t -> unit
+    val update :
+      t ->
+      ((int, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t ->
+       'a) ->
+      unit
+  end
+module Gpu_profiler :
+  sig
+    type scope = {
+      mutable count : int;
+      mutable total : float;
+      mutable min : float;
+      mutable max : float;
+    }
+    type sample = { name : string; first : int; last : int; }
+    type t = {
+      mutable support : int;
+      mutable free : int list;
+      mutable open_scopes : (string * int) list;
+      pending : sample Queue.t;
+      scopes : (string, scope) Hashtbl.t;
+      word : word_array;
+      dword : dword_array;
+    }
+    val create : unit -> t
+    val support : t -> int
+    val available : t -> bool
+    val query : t -> int
+    val begin_scope : t -> string -> unit
+    val end_scope : t -> unit
+    val scope : t -> string -> (unit -> 'a) -> 'a
+    val result_available : t -> int -> bool
+    val result : t -> int -> float
+    val record : t -> string -> float -> unit
+    val end_frame : t -> unit
+    val report : t -> (string * int * float * float * float) list
+    val reset : t -> unit
+    val destroy : t -> unit
+  end
+module Stats :
+  sig
+    external enabled : unit -> bool = "glstub_stats_enabled"
+    external snapshot' : unit -> (string * int * float) array
+      = "glstub_stats_snapshot"
+    external reset : unit -> unit = "glstub_stats_reset"
+    val snapshot : unit -> (string * int * float) array
+  end
+module Batch :
+  sig
+    type t = {
+      mutable first : word_array;
+      mutable offsets : int_array;
+      mutable count : word_array;
+      mutable length : int;
+    }
+    val check : string -> int -> ('a, 'b, 'c) Bigarray.Array1.t -> unit
+    val multi_draw_arrays : int -> word_array -> word_array -> int -> unit
+    val multi_draw_elements :
+      int -> word_array -> int -> int_array -> int -> unit
+    val create : int -> t
+    val length : t -> int
+    val clear : t -> unit
+    val grow : t -> unit
+    val add : t -> int -> int -> unit
+    val flush_arrays : t -> int -> unit
+    val flush_elements : t -> int -> int -> unit
+  end
+module Mat4 :
+  sig
+    type t = float_array
+    external mul : t -> t -> t -> unit = "glstub_mat4_mul"
+    external invert : t -> t -> bool = "glstub_mat4_invert"
+    external perspective :
+      t ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+      = "glstub_mat4_perspective" "glstub_mat4_perspective_nat"
+    external ortho :
+      t ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+      = "glstub_mat4_ortho_byte" "glstub_mat4_ortho_nat"
+    external look_at :
+      t ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) ->
+      (float [@unboxed]) -> (float [@unboxed]) -> (float [@unboxed]) -> unit
+      = "glstub_mat4_look_at_byte" "glstub_mat4_look_at_nat"
+    external mul_batch : float_matrix -> t -> float_matrix -> int -> unit
+      = "glstub_mat4_mul_batch"
+    external transform_points :
+      float_array -> t -> float_array -> int -> unit
+      = "glstub_mat4_transform_points"
+    val identity : t -> unit
+    val create : unit -> t
+    val copy : t -> t -> unit
+    val transpose : t -> unit
+    val translation : t -> float -> float -> float -> unit
+    val scaling : t -> float -> float -> float -> unit
+    val rotation : t -> float -> float -> float -> float -> unit
+    val uniform : int -> t -> unit
+    val load : t -> unit
+    type stack = { mutable depth : int; levels : t array; scratch : t; }
+    val stack : int -> stack
+    val top : stack -> t
+    val push : stack -> unit
+    val pop : stack -> unit
+    val load_identity : stack -> unit
+    val load_matrix : stack -> t -> unit
+    val mult : stack -> t -> unit
+    val translate : stack -> float -> float -> float -> unit
+    val scale : stack -> float -> float -> float -> unit
+    val rotate : stack -> float -> float -> float -> float -> unit
+  end
+module Recorder :
+  sig
+    type mesh = {
+      vbo : int;
+      vertices : int;
+      colors : bool;
+      normals : bool;
+      texcoords : bool;
+      groups : (int * word_array * word_array * int) list;
+    }
+    type recording = {
+      mutable data : float_array;
+      mutable len : int;
+      current : float_array;
+      mutable mode : int;
+      mutable first : int;
+      mutable ranges : (int * int * int) list;
+      mutable has_colors : bool;
+      mutable has_normals : bool;
+      mutable has_texcoords : bool;
+    }
+    val vertex_size : int
+    val stride : int
+    val recording : recording option ref
+    val new_recording : unit -> recording
+    val grow : recording -> unit
+    val emit : recording -> float -> float -> float -> float -> unit
+    val primitive_size : int -> int
+    val glBegin : int -> unit
+    val glEnd : unit -> unit
+    val set_color : recording -> float -> float -> float -> float -> unit
+    val set_normal : recording -> float -> float -> float -> unit
+    val set_texcoord : recording -> float -> float -> unit
+    val glVertex2f : float -> float -> unit
+    val glVertex2d : float -> float -> unit
+    val glVertex2i : int -> int -> unit
+    val glVertex2iv : int array -> unit
+    val glVertex3f : float -> float -> float -> unit
+    val glVertex3d : float -> float -> float -> unit
+    val glVertex3i : int -> int -> int -> unit
+    val glVertex3fv : float array -> unit
+    val glVertex4f : float -> float -> float -> float -> unit
+    val glVertex4d : float -> float -> float -> float -> unit
+    val glColor3f : float -> float -> float -> unit
+    val glColor3d : float -> float -> float -> unit
+    val glColor4f : float -> float -> float -> float -> unit
+    val glColor4d : float -> float -> float -> float -> unit
+    val glColor3ub : int -> int -> int -> unit
+    val glColor4ub : int -> int -> int -> int -> unit
+    val glNormal3f : float -> float -> float -> unit
+    val glNormal3d : float -> float -> float -> unit
+    val glTexCoord2f : float -> float -> unit
+    val glTexCoord2d : float -> float -> unit
+    val make_groups :
+      (int * int * int) list -> (int * word_array * word_array * int) list
+    val record : (unit -> unit) -> mesh
+    val vertices : mesh -> int
+    val draw : mesh -> unit
+    val delete : mesh -> unit
+  end
+module Program_cache :
+  sig
+    type t = {
+      dir : string;
+      mutable support : int;
+      mutable driver : string;
+      mutable hits : int;
+      mutable misses : int;
+    }
+    val create : string -> t
+    val hits : t -> int
+    val misses : t -> int
+    val support : t -> int
+    val available : t -> bool
+    val compile : t -> (int -> unit) -> (int * string) list -> int
+    val path : t -> string -> (int * string) list -> string
+    val read_binary : string -> (int * string) option
+    val write_binary : string -> int -> unit
+    val load : int -> string -> int option
+    val program :
+      t ->
+      ?setup:(int -> unit) -> ?key:string -> (int * string) list -> int
+  end
+module Shader_compiler :
+  sig
+    type result = Pending | Ready of int | Failed of string
+    type job = {
+      sources : (int * string) list;
+      setup : int -> unit;
+      mutable shaders : int array;
+      mutable program : int;
+      mutable result : result;
+    }
+    type t = {
+      mutable support : int;
+      budget : float;
+      waiting : job Queue.t;
+      mutable compiling : job list;
+      mutable linking : job list;
+    }
+    val create : ?budget:float -> unit -> t
+    val support : t -> int
+    val available : t -> bool
+    val result : job -> result
+    val pending : t -> int
+    val fail : job -> string -> unit
+    val compile : job list -> unit
+    val link : job -> unit
+    val finish : job -> unit
+    val linked : t -> job -> unit
+    val submit_all :
+      t -> ?setup:(int -> unit) -> (int * string) list list -> job list
+    val submit : t -> ?setup:(int -> unit) -> (int * string) list -> job
+    val build : job -> unit
+    val update : t -> unit
+    val flush : t -> unit
+  end
+module Fence :
+  sig
+    type t = sync
+    external client_wait : sync -> int -> int -> int = "glstub_fence_wait"
+    val insert : unit -> sync
+    val signaled : sync -> bool
+    val wait : ?timeout:int -> sync -> bool
+    val delete : sync -> unit
+    type ring = { fences : t option array; mutable next : int; }
+    val ring : int -> ring
+    val acquire : ring -> int
+    val release : ring -> int -> unit
+    val destroy : ring -> unit
+  end
+module Render_target :
+  sig
+    type target = {
+      framebuffer : int;
+      color : int;
+      depth : int;
+      width : int;
+      height : int;
+      format : int;
+      depth_format : int;
+      samples : int;
+      mutable released : int;
+    }
+    type t = {
+      free : (int * int * int * int * int, target list) Hashtbl.t;
+      mutable transients : target list;
+      mutable frame : int;
+      keep : int;
+      mutable created : int;
+      mutable reused : int;
+    }
+    val create : ?keep:int -> unit -> t
+    val created : t -> int
+    val reused : t -> int
+    val key : target -> int * int * int * int * int
+    val get : int -> int
+    val gen : (int -> int array -> 'a) -> int
+    val delete : target -> unit
+    val renderbuffer : int -> int -> int -> int -> int
+    val pixel_format : int -> int * int
+    val make : int -> int -> int -> int -> int -> target
+    val acquire : t -> ?depth:int -> ?samples:int -> int -> int -> int -> target
+    val release : t -> target -> unit
+    val transient :
+      t -> ?depth:int -> ?samples:int -> int -> int -> int -> target
+    val end_frame : t -> unit
+    val bind : target -> unit
+    val texture : target -> int
+    val resolve : target -> target -> unit
+    val destroy : t -> unit
+  end
+module Handle :
+  sig
+    type t
+    type kind =
+        Texture
+      | Buffer
+      | Renderbuffer
+      | Framebuffer
+      | Program
+      | Shader
+      | Vertex_array
+      | Query
+      | Sampler
+    external wrap : kind -> int -> int -> t = "glstub_handle_wrap"
+    external name : t -> int = "glstub_handle_name"
+    external set_bytes : t -> int -> unit = "glstub_handle_set_bytes"
+    external delete : t -> unit = "glstub_handle_delete"
+    external collect : unit -> unit = "glstub_handle_collect"
+    external live : kind -> int = "glstub_handle_live"
+    external bytes : kind -> int = "glstub_handle_bytes"
+    val kinds : kind list
+    val stats : unit -> (kind * int * int) list
+    val gen : kind -> (int -> int array -> 'a) -> int -> t
+    val texture : ?bytes:int -> unit -> t
+    val buffer : ?bytes:int -> unit -> t
+    val renderbuffer : ?bytes:int -> unit -> t
+    val framebuffer : unit -> t
+    val vertex_array : unit -> t
+    val query : unit -> t
+    val sampler : unit -> t
+    val program : unit -> t
+    val shader : int -> t
+  end
+module Residency :
+  sig
+    type source = Reload of (unit -> int * int) | Cached of int * int * bool
+    type texture = {
+      source : source;
+      mutable name : int;
+      mutable bytes : int;
+      mutable last_used : int;
+      mutable pixels : ubyte_array;
+      mutable newer : texture option;
+      mutable older : texture option;
+    }
+    type t = {
+      mutable budget : int;
+      mutable used : int;
+      mutable frame : int;
+      mutable newest : texture option;
+      mutable oldest : texture option;
+      mutable hits : int;
+      mutable misses : int;
+      mutable evictions : int;
+    }
+    val create : int -> t
+    val set_budget : t -> int -> unit
+    val used : t -> int
+    val hits : t -> int
+    val misses : t -> int
+    val evictions : t -> int
+    val hit_rate : t -> float
+    val reset_counters : t -> unit
+    val name : texture -> int
+    val no_pixels : ubyte_array
+    val unlink : t -> texture -> unit
+    val push : t -> texture -> unit
+    val add : t -> source -> int -> int -> texture
+    val add_reload : t -> (unit -> int * int) -> texture
+    val add_cached : t -> ?mipmap:bool -> int -> int -> int -> texture
+    val unload : t -> texture -> unit
+    val evict : t -> texture -> unit
+    val load : t -> texture -> unit
+    val make_room : t -> int -> unit
+    val use : t -> texture -> int
+    val bind : t -> int -> texture -> unit
+    val end_frame : t -> unit
+    val remove : t -> texture -> unit
+  end
+module Render_queue :
+  sig
+    type t = {
+      mutable draws : word_array;
+      mutable payloads : int array;
+      mutable keys : dword_array;
+      mutable order : word_array;
+      mutable length : int;
+      mutable program_binds : int;
+      mutable texture_binds : int;
+    }
+    external sort' : word_array -> int -> dword_array -> word_array -> unit
+      = "glstub_render_queue_sort"
+    val max_length : int
+    val create : int -> t
+    val length : t -> int
+    val clear : t -> unit
+    val program_binds : t -> int
+    val texture_binds : t -> int
+    val grow : t -> unit
+    val add :
+      t ->
+      pass:int -> program:int -> texture:int -> depth:float -> int -> unit
+    val sort : t -> unit
+    val sorted : t -> int -> int
+    val execute : t -> ?pass:(int -> unit) -> (int -> unit) -> unit
+  end
@@ -0,0 +1,21 @@
+#ifndef GLCAML_DRAIN_H
+
+#define GLCAML_DRAIN_H
+
+#include <caml/mlvalues.h>
+#include <caml/callback.h>
+
+/*
+ * Glcaml.Handle registers its collect function under the name "Glcaml.Handle.collect" when it is initialised.
+ * The swap stubs call it after every swap, so that the objects of collected handles are deleted on the thread that
+ * owns the context. The lookup goes through the Ocaml runtime, so it works however glcaml_stub is linked, and
+ * does nothing in programs that do not use Glcaml.
+ */
+#define DRAIN_DELETIONS() \
+    do { \
+        static const value *drain_deletions = NULL; \
+        if(drain_deletions == NULL) drain_deletions = caml_named_value("Glcaml.Handle.collect"); \
+        if(drain_deletions != NULL) caml_callback(*drain_deletions, Val_unit); \
+    } while(0)
+
+#endif
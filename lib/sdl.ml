@@ -75,6 +75,8 @@ module Video = struct
   = "sdlstub_surface_width"
   external surface_height : surface -> int
   = "sdlstub_surface_height"
+  external surface_pitch : surface -> int
+  = "sdlstub_surface_pitch"
   external surface_flags : surface -> video_flag list
   = "sdlstub_surface_flags"
   external surface_bpp : surface -> int
@@ -89,6 +89,9 @@ module Video : sig
   (** Get the surface height in pixels *)
   val surface_height : surface -> int
 
+  (** Get the length of a row of pixels in bytes, which may be more than the width times the bytes per pixel *)
+  val surface_pitch : surface -> int
+
   (** Get a list of the surface flags *)
   val surface_flags : surface -> video_flag list
 
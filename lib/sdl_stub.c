@@ -40,6 +40,7 @@ void set_audiospec(SDL_AudioSpec *in, int freq, int format, int channels, int sa
 }
 
 #include "caml.h"
+#include "glcaml_drain.h"
 
 value nil(void)
 {
@@ -412,7 +413,7 @@ value sdlstub_unlock_surface(value s) {
 value sdlstub_surface_pixels(value ps) {
     CAMLparam1(ps);
     SDL_Surface *s = ((SDL_Surface*) ps);
-    CAMLreturn (alloc_bigarray_dims(BIGARRAY_UINT8 | BIGARRAY_C_LAYOUT, 1, s->pixels, s->w * s->h * (s->format->BitsPerPixel/8)));
+    CAMLreturn (alloc_bigarray_dims(BIGARRAY_UINT8 | BIGARRAY_C_LAYOUT, 1, s->pixels, s->h * s->pitch));
 }
 
 value sdlstub_surface_width(value s) {
@@ -425,6 +426,11 @@ value sdlstub_surface_height(value s) {
     CAMLreturn (Val_int(((SDL_Surface*) s)->h));
 }
 
+value sdlstub_surface_pitch(value s) {
+    CAMLparam1(s);
+    CAMLreturn (Val_int(((SDL_Surface*) s)->pitch));
+}
+
 value sdlstub_surface_flags(value s) {
     CAMLparam1(s);
     CAMLreturn (val_video_flag(((SDL_Surface*) s)->flags));
@@ -1076,6 +1082,7 @@ value sdlstub_get_grab_input(value u)
 value sdlstub_GL_swap_buffers(value u) {
     CAMLparam1(u);
     SDL_GL_SwapBuffers();
+    DRAIN_DELETIONS();
     CAMLreturn(Val_unit);
 }
 
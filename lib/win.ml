@@ -55,6 +55,17 @@ let init_opengl () =
   init_gl' title;
   Graphics.set_window_title "";;
 
+(*
+ * Offscreen rendering, without a window or an X server (Linux only).
+ * init_offscreen width height creates an EGL context, on Mesa's surfaceless platform when
+ * available, and binds a framebuffer object of that size with colour and depth buffers as
+ * the draw target. Rebind offscreen_framebuffer () instead of framebuffer 0 after drawing
+ * into other framebuffers, and read the frames back with glReadPixels.
+ * swap_buffers does nothing for an offscreen context.
+ *)
+external init_offscreen : int -> int -> unit = "stub_init_offscreen"
+external offscreen_framebuffer : unit -> int = "stub_offscreen_framebuffer"
+
 (* Sleep for n microseconds *)
 external usleep: int -> unit = "stub_usleep"
 
@@ -32,6 +32,14 @@ val init_opengl : unit -> unit
 (** Swap the back buffer to the screen *)
 external swap_buffers : unit -> unit = "stub_swap_buffers" "stub_swap_buffers"
 
+(** Create an OpenGL context without a window or an X server, drawing into a framebuffer object
+   of the given width and height. Uses EGL, on Mesa's surfaceless platform when available
+   (e.g. llvmpipe on machines without a GPU). Linux only; raises [Failure] if no context can be made *)
+external init_offscreen : int -> int -> unit = "stub_init_offscreen"
+
+(** The framebuffer object created by [init_offscreen], to bind instead of framebuffer 0 *)
+external offscreen_framebuffer : unit -> int = "stub_offscreen_framebuffer"
+
 (** Sleep for n microseconds *)
 external usleep: int -> unit = "stub_usleep"
 
@@ -6,6 +6,7 @@
 #include <X11/Xutil.h>
 #include <X11/Xatom.h>
 #include <GL/glx.h>
+#include <dlfcn.h>
 #endif
 
 #ifdef _WIN32
@@ -20,11 +21,16 @@
 #include <caml/callback.h>
 #include <caml/bigarray.h>
 
+#include "glcaml_drain.h"
+
 #ifdef __unix__
 Window gwin;
 Display *gdisplay = NULL;
 #endif
 
+int goffscreen = 0;
+unsigned int gframebuffer = 0;
+
 #ifdef _WIN32
 HWND ghWnd = NULL;
 HDC ghDC = NULL;
@@ -142,15 +148,226 @@ value stub_swap_buffers(value unit)
     CAMLparam1(unit);
     CAMLlocal1(result);
 #ifdef __unix__
-    glXSwapBuffers(gdisplay, gwin);
+    if(!goffscreen) glXSwapBuffers(gdisplay, gwin);
 #endif
 #ifdef _WIN32
     wglSwapLayerBuffers(ghDC, WGL_SWAP_MAIN_PLANE);
 #endif
+    DRAIN_DELETIONS();
     result = Val_unit;
     CAMLreturn(result);
 }
 
+/*
+ * Offscreen rendering without a window or an X server: an EGL context, on Mesa's surfaceless platform when it is
+ * available (e.g. llvmpipe on a machine without a GPU) and on the default display otherwise, drawing into a
+ * framebuffer object of the requested size. libEGL is loaded at run time, so it is only needed by programs that
+ * call init_offscreen.
+ */
+#ifdef __unix__
+/* The few EGL types and constants used here, so that building Win does not need the EGL headers */
+typedef void *EGLDisplay;
+typedef void *EGLSurface;
+typedef void *EGLContext;
+typedef void *EGLConfig;
+typedef void *EGLNativeDisplayType;
+typedef int EGLint;
+typedef unsigned int EGLenum;
+typedef unsigned int EGLBoolean;
+
+#define EGL_NO_DISPLAY ((EGLDisplay)0)
+#define EGL_NO_SURFACE ((EGLSurface)0)
+#define EGL_NO_CONTEXT ((EGLContext)0)
+#define EGL_DEFAULT_DISPLAY ((EGLNativeDisplayType)0)
+#define EGL_PBUFFER_BIT 0x0001
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_ALPHA_SIZE 0x3021
+#define EGL_BLUE_SIZE 0x3022
+#define EGL_GREEN_SIZE 0x3023
+#define EGL_RED_SIZE 0x3024
+#define EGL_DEPTH_SIZE 0x3025
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_NONE 0x3038
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_EXTENSIONS 0x3055
+#define EGL_HEIGHT 0x3056
+#define EGL_WIDTH 0x3057
+#define EGL_OPENGL_API 0x30A2
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#define GL_RENDERBUFFER 0x8D41
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#define GL_DEPTH_ATTACHMENT 0x8D00
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+#ifndef GL_DEPTH_COMPONENT24
+#define GL_DEPTH_COMPONENT24 0x81A6
+#endif
+
+static void *egl_lib = NULL;
+static EGLDisplay egl_display = EGL_NO_DISPLAY;
+static EGLSurface egl_surface = EGL_NO_SURFACE;
+static EGLContext egl_context = EGL_NO_CONTEXT;
+
+static void *(*p_eglGetProcAddress)(const char *);
+static const char *(*p_eglQueryString)(EGLDisplay, EGLint);
+static EGLDisplay (*p_eglGetDisplay)(EGLNativeDisplayType);
+static EGLDisplay (*p_eglGetPlatformDisplayEXT)(EGLenum, void *, const EGLint *);
+static EGLBoolean (*p_eglInitialize)(EGLDisplay, EGLint *, EGLint *);
+static EGLBoolean (*p_eglBindAPI)(EGLenum);
+static EGLBoolean (*p_eglChooseConfig)(EGLDisplay, const EGLint *, EGLConfig *, EGLint, EGLint *);
+static EGLSurface (*p_eglCreatePbufferSurface)(EGLDisplay, EGLConfig, const EGLint *);
+static EGLContext (*p_eglCreateContext)(EGLDisplay, EGLConfig, EGLContext, const EGLint *);
+static EGLBoolean (*p_eglMakeCurrent)(EGLDisplay, EGLSurface, EGLSurface, EGLContext);
+static EGLBoolean (*p_eglDestroyContext)(EGLDisplay, EGLContext);
+static EGLBoolean (*p_eglDestroySurface)(EGLDisplay, EGLSurface);
+
+#define LOAD_EGL(f) \
+    if((*(void **)&p_##f = dlsym(egl_lib, #f)) == NULL) failwith("Win.init_offscreen: " #f " is missing from libEGL")
+
+#define LOAD_GL(p, f) \
+    if((*(void **)&p = p_eglGetProcAddress(#f)) == NULL) return "Win.init_offscreen: " #f " is not available"
+
+static void open_egl()
+{
+    const char *exts;
+    if(egl_lib == NULL) egl_lib = dlopen("libEGL.so.1", RTLD_LAZY);
+    if(egl_lib == NULL) failwith("Win.init_offscreen: cannot load libEGL.so.1");
+    LOAD_EGL(eglGetProcAddress);
+    LOAD_EGL(eglQueryString);
+    LOAD_EGL(eglGetDisplay);
+    LOAD_EGL(eglInitialize);
+    LOAD_EGL(eglBindAPI);
+    LOAD_EGL(eglChooseConfig);
+    LOAD_EGL(eglCreatePbufferSurface);
+    LOAD_EGL(eglCreateContext);
+    LOAD_EGL(eglMakeCurrent);
+    LOAD_EGL(eglDestroyContext);
+    LOAD_EGL(eglDestroySurface);
+    /* Client extensions, or NULL if the implementation has none */
+    exts = p_eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if(exts != NULL && strstr(exts, "EGL_MESA_platform_surfaceless") != NULL)
+    {
+        *(void **)&p_eglGetPlatformDisplayEXT = p_eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if(p_eglGetPlatformDisplayEXT != NULL)
+            egl_display = p_eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+    if(egl_display == EGL_NO_DISPLAY) egl_display = p_eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if(egl_display == EGL_NO_DISPLAY || !p_eglInitialize(egl_display, NULL, NULL))
+    {
+        egl_display = EGL_NO_DISPLAY;
+        failwith("Win.init_offscreen: no EGL display");
+    }
+}
+
+/* Release the context and surface of an initialisation that failed half-way */
+static void release_egl()
+{
+    p_eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if(egl_context != EGL_NO_CONTEXT) p_eglDestroyContext(egl_display, egl_context);
+    if(egl_surface != EGL_NO_SURFACE) p_eglDestroySurface(egl_display, egl_surface);
+    egl_context = EGL_NO_CONTEXT;
+    egl_surface = EGL_NO_SURFACE;
+}
+
+/*
+ * A framebuffer object with an RGBA8 colour buffer and a 24-bit depth buffer, bound as the draw target. Returns
+ * NULL, or an error message if the framebuffer can not be made.
+ */
+static const char *make_framebuffer(int width, int height)
+{
+    void (*gen_framebuffers)(GLsizei, GLuint *);
+    void (*bind_framebuffer)(GLenum, GLuint);
+    void (*gen_renderbuffers)(GLsizei, GLuint *);
+    void (*bind_renderbuffer)(GLenum, GLuint);
+    void (*renderbuffer_storage)(GLenum, GLenum, GLsizei, GLsizei);
+    void (*framebuffer_renderbuffer)(GLenum, GLenum, GLenum, GLuint);
+    GLenum (*check_framebuffer_status)(GLenum);
+    void (*viewport)(GLint, GLint, GLsizei, GLsizei);
+    GLuint fb, rb[2];
+    LOAD_GL(gen_framebuffers, glGenFramebuffers);
+    LOAD_GL(bind_framebuffer, glBindFramebuffer);
+    LOAD_GL(gen_renderbuffers, glGenRenderbuffers);
+    LOAD_GL(bind_renderbuffer, glBindRenderbuffer);
+    LOAD_GL(renderbuffer_storage, glRenderbufferStorage);
+    LOAD_GL(framebuffer_renderbuffer, glFramebufferRenderbuffer);
+    LOAD_GL(check_framebuffer_status, glCheckFramebufferStatus);
+    LOAD_GL(viewport, glViewport);
+    gen_renderbuffers(2, rb);
+    bind_renderbuffer(GL_RENDERBUFFER, rb[0]);
+    renderbuffer_storage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    bind_renderbuffer(GL_RENDERBUFFER, rb[1]);
+    renderbuffer_storage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    bind_renderbuffer(GL_RENDERBUFFER, 0);
+    gen_framebuffers(1, &fb);
+    bind_framebuffer(GL_FRAMEBUFFER, fb);
+    framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rb[0]);
+    framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rb[1]);
+    if(check_framebuffer_status(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        return "Win.init_offscreen: the framebuffer is incomplete";
+    viewport(0, 0, width, height);
+    gframebuffer = fb;
+    return NULL;
+}
+#endif
+
+value stub_init_offscreen(value width, value height)
+{
+    CAMLparam2(width, height);
+#ifdef __unix__
+    EGLint config_attribs[] = {
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_RED_SIZE, 8,
+                EGL_GREEN_SIZE, 8,
+                EGL_BLUE_SIZE, 8,
+                EGL_ALPHA_SIZE, 8,
+                EGL_DEPTH_SIZE, 24,
+                EGL_NONE};
+    EGLint pbuffer_attribs[] = { EGL_WIDTH, Int_val(width), EGL_HEIGHT, Int_val(height), EGL_NONE };
+    EGLConfig config;
+    EGLint n = 0;
+    const char *error;
+    if(goffscreen) failwith("Win.init_offscreen: already initialised");
+    if(egl_display == EGL_NO_DISPLAY) open_egl();
+    if(!p_eglBindAPI(EGL_OPENGL_API)) failwith("Win.init_offscreen: desktop OpenGL is not supported");
+    if(!p_eglChooseConfig(egl_display, config_attribs, &config, 1, &n) || n == 0)
+    {
+        /* The surfaceless platform has no pbuffers; the context is made current without a surface */
+        config_attribs[1] = 0;
+        if(!p_eglChooseConfig(egl_display, config_attribs, &config, 1, &n) || n == 0)
+            failwith("Win.init_offscreen: no suitable EGL configuration");
+    }
+    else
+        egl_surface = p_eglCreatePbufferSurface(egl_display, config, pbuffer_attribs);
+    egl_context = p_eglCreateContext(egl_display, config, EGL_NO_CONTEXT, NULL);
+    if(egl_context == EGL_NO_CONTEXT)
+    {
+        release_egl();
+        failwith("Win.init_offscreen: cannot create an OpenGL context");
+    }
+    if(!p_eglMakeCurrent(egl_display, egl_surface, egl_surface, egl_context))
+        error = "Win.init_offscreen: cannot make the OpenGL context current";
+    else
+        error = make_framebuffer(Int_val(width), Int_val(height));
+    if(error != NULL)
+    {
+        release_egl();
+        failwith(error);
+    }
+    goffscreen = 1;
+#else
+    failwith("Win.init_offscreen: not supported on this platform");
+#endif
+    CAMLreturn(Val_unit);
+}
+
+value stub_offscreen_framebuffer(value unit)
+{
+    return Val_int(gframebuffer);
+}
+
 #ifdef _WIN32
 #  include <windows.h>
 #  define usleep(t) Sleep((t) / 1000)